@@ -16,6 +16,32 @@
 typedef void (^FICImageCacheCompletionBlock)(id <FICEntity> _Nullable entity, NSString * _Nonnull formatName, UIImage * _Nullable image);
 typedef void (^FICImageRequestCompletionBlock)(UIImage * _Nullable sourceImage);
 
+/**
+ Memory use and paging of an image table, e.g. to pick its format's `maximumCount`. Page counts are since the table was created.
+ */
+typedef struct {
+    /** Images stored in the table. */
+    NSUInteger entryCount;
+    /** Images the table keeps before evicting: the format's `maximumCount`, rounded up to fill a chunk. */
+    NSUInteger maximumCount;
+    /** Bytes taken by each image in the table file, page aligned. */
+    NSUInteger entryLength;
+    /** Bytes in a page of memory. */
+    NSUInteger pageSize;
+    /** Length of the table file, in bytes. */
+    unsigned long long fileLength;
+    /** Address space the table file is mapped into, in bytes. */
+    unsigned long long mappedLength;
+    /** Bytes of the table file that are in memory. */
+    unsigned long long residentLength;
+    /** Pages that weren't in memory when their image was retrieved or drawn, so reading or drawing it faulted them in. */
+    unsigned long long pageFaults;
+    /** Pages that weren't in memory when their image was prefetched. */
+    unsigned long long prefetchedPages;
+    /** Pages in memory that were given back on memory warnings. */
+    unsigned long long droppedPages;
+} FICImageTableStatistics;
+
 NS_ASSUME_NONNULL_BEGIN
 
 /**
@@ -145,6 +171,23 @@ NS_ASSUME_NONNULL_BEGIN
  */
 - (void)setImage:(UIImage *)image forEntity:(id <FICEntity>)entity withFormatName:(NSString *)formatName completionBlock:(nullable FICImageCacheCompletionBlock)completionBlock;
 
+/**
+ Draws an image for a particular entity and format name straight into the image cache, on the calling thread.
+ 
+ @param entity The entity that uniquely identifies the source image.
+ 
+ @param formatName The format name that uniquely identifies which image table to draw the image into.
+ 
+ @param drawingBlock The block that draws the image. It is passed a bitmap context whose backing store is the image table entry, and the format's image size.
+ 
+ @return `YES` if the image was drawn into the image table, `NO` if there is no format with that name or the entity is missing its UUIDs.
+ 
+ @discussion Unlike <[FICImageCache setImage:forEntity:withFormatName:completionBlock:]>, there is no source image: the block draws the image at the format's size, so
+ images that are drawn rather than loaded, like procedural artwork, skip rendering a source image and scaling it down. The delegate isn't asked for anything, and other
+ formats in the format's family aren't drawn. Images can be drawn for different entities on several threads at once.
+ */
+- (BOOL)drawImageForEntity:(id <FICEntity>)entity withFormatName:(NSString *)formatName drawingBlock:(FICEntityImageDrawingBlock)drawingBlock;
+
 /**
  Attempts to synchronously retrieve an image from the image cache.
  
@@ -206,6 +249,22 @@ NS_ASSUME_NONNULL_BEGIN
  */
 - (void)deleteImageForEntity:(id <FICEntity>)entity withFormatName:(NSString *)formatName;
 
+///-------------------------
+/// @name Prefetching Images
+///-------------------------
+
+/**
+ Asks for the images of entities that are about to be displayed to be read into memory ahead of time.
+ 
+ @param entities The entities whose images to prefetch. Entities without an image in the image cache are skipped.
+ 
+ @param formatName The format name that uniquely identifies which image table to look in for the cached images.
+ 
+ @discussion Image tables are mapped into memory, so the first time an image is displayed, its pages are read from disk as Core Animation draws it. Prefetching starts
+ reading them in the background instead. It doesn't retrieve the images or ask the delegate for missing ones.
+ */
+- (void)prefetchImagesForEntities:(NSArray<id <FICEntity>> *)entities withFormatName:(NSString *)formatName;
+
 ///-------------------------------
 /// @name Canceling Image Requests
 ///-------------------------------
@@ -237,6 +296,24 @@ NS_ASSUME_NONNULL_BEGIN
  */
 - (BOOL)imageExistsForEntity:(id <FICEntity>)entity withFormatName:(NSString *)formatName;
 
+///----------------------------
+/// @name Inspecting Memory Use
+///----------------------------
+
+/**
+ Returns the memory use and paging of the image table of a format.
+ 
+ @param formatName The format name that uniquely identifies the image table.
+ 
+ @return The statistics of the image table, or all zeros if there is no format with that name.
+ 
+ @discussion `residentLength` and `pageFaults` together show whether a format's `maximumCount` fits how the application uses it: images that fault often while the table is
+ full are evicted before they are shown again.
+ 
+ This checks the residency of every page of the table file with the table locked, so it is meant for diagnostics. Read a format's `maximumCount` from `<formatWithName:>`.
+ */
+- (FICImageTableStatistics)statisticsForFormatName:(NSString *)formatName;
+
 ///--------------------------------
 /// @name Resetting the Image Cache
 ///--------------------------------
@@ -327,6 +327,25 @@ static void _FICAddCompletionBlockForEntity(NSString *formatName, NSMutableDicti
     }
 }
 
+- (BOOL)drawImageForEntity:(id <FICEntity>)entity withFormatName:(NSString *)formatName drawingBlock:(FICEntityImageDrawingBlock)drawingBlock {
+    BOOL imageWasDrawn = NO;
+    
+    FICImageTable *imageTable = [_imageTables objectForKey:formatName];
+    NSString *entityUUID = [entity fic_UUID];
+    NSString *sourceImageUUID = [entity fic_sourceImageUUID];
+    
+    if (imageTable == nil) {
+        [self _logMessage:[NSString stringWithFormat:@"*** FIC Error: %s Couldn't find image table with format name %@", __PRETTY_FUNCTION__, formatName]];
+    } else if (entityUUID == nil || sourceImageUUID == nil) {
+        [self _logMessage:[NSString stringWithFormat:@"*** FIC Error: %s entity %@ is missing its UUID or source image UUID.", __PRETTY_FUNCTION__, entity]];
+    } else if (drawingBlock != NULL) {
+        [imageTable setEntryForEntityUUID:entityUUID sourceImageUUID:sourceImageUUID imageDrawingBlock:drawingBlock];
+        imageWasDrawn = [imageTable entryExistsForEntityUUID:entityUUID sourceImageUUID:sourceImageUUID];
+    }
+    
+    return imageWasDrawn;
+}
+
 - (void)_processImage:(UIImage *)image forEntity:(id <FICEntity>)entity completionBlocksDictionary:(NSDictionary *)completionBlocksDictionary {
     for (NSString *formatToProcess in [self formatsToProcessForCompletionBlocks:completionBlocksDictionary
                                                                          entity:entity]) {
@@ -423,6 +442,23 @@ static void _FICAddCompletionBlockForEntity(NSString *formatName, NSMutableDicti
     return formatsToProcess;
 }
 
+#pragma mark - Prefetching Images
+
+- (void)prefetchImagesForEntities:(NSArray<id <FICEntity>> *)entities withFormatName:(NSString *)formatName {
+    FICImageTable *imageTable = [_imageTables objectForKey:formatName];
+    if (imageTable != nil && [entities count] > 0) {
+        NSMutableArray *entityUUIDs = [NSMutableArray arrayWithCapacity:[entities count]];
+        for (id <FICEntity> entity in entities) {
+            NSString *entityUUID = [entity fic_UUID];
+            if (entityUUID != nil) {
+                [entityUUIDs addObject:entityUUID];
+            }
+        }
+        
+        [imageTable prefetchEntriesForEntityUUIDs:entityUUIDs];
+    }
+}
+
 #pragma mark - Checking for Image Existence
 
 - (BOOL)imageExistsForEntity:(id <FICEntity>)entity withFormatName:(NSString *)formatName {
@@ -473,6 +509,20 @@ static void _FICAddCompletionBlockForEntity(NSString *formatName, NSMutableDicti
     }
 }
 
+#pragma mark - Inspecting Memory Use
+
+- (FICImageTableStatistics)statisticsForFormatName:(NSString *)formatName {
+    FICImageTableStatistics statistics = {0};
+    FICImageTable *imageTable = [_imageTables objectForKey:formatName];
+    if (imageTable != nil) {
+        statistics = [imageTable statistics];
+    }
+    
+    return statistics;
+}
+
+#pragma mark - Resetting the Image Cache
+
 - (void)reset {
     for (FICImageTable *imageTable in [_imageTables allValues]) {
         dispatch_async([[self class] dispatchQueue], ^{
@@ -38,6 +38,8 @@ extern NSString *const FICImageTableScreenScaleKey;
 
 /**
  The file system path where the image table's metadata file is located.
+ 
+ @discussion The metadata is a journal: changes are appended to it, and it is compacted once most of it is out of date.
  */
 @property (nonatomic, copy, readonly) NSString *metadataFilePath;
 
@@ -158,6 +160,28 @@ extern NSString *const FICImageTableScreenScaleKey;
  */
 - (BOOL)entryExistsForEntityUUID:(NSString *)entityUUID sourceImageUUID:(NSString *)sourceImageUUID;
 
+///---------------------------------
+/// @name Managing Memory and Paging
+///---------------------------------
+
+/**
+ Asks for the image entry data of entities that are about to be displayed to be read into memory.
+ 
+ @param entityUUIDs The UUIDs of the entities whose entries to prefetch. UUIDs without an entry are skipped.
+ 
+ @discussion The image table file is mapped once, and advised for random access, so entries are only read in when they're touched. Prefetching advises the kernel that
+ the entries will be needed soon, so it starts reading them in without blocking the caller.
+ */
+- (void)prefetchEntriesForEntityUUIDs:(NSArray<NSString *> *)entityUUIDs;
+
+/**
+ Returns the memory use and paging of the image table.
+ 
+ @discussion Page faults are counted by checking which pages of an entry are resident when it is read or drawn into. On memory warnings, the pages of chunks no image
+ uses are given back, and counted as dropped.
+ */
+- (FICImageTableStatistics)statistics;
+
 ///--------------------------------
 /// @name Resetting the Image Table
 ///--------------------------------
@@ -1,5 +1,5 @@
 //
-//  FICImageTable.m
+//  FICImageTable.mm
 //  FastImageCache
 //
 //  Copyright (c) 2013 Path, Inc.
@@ -11,11 +11,15 @@
 #import "FICImageCache.h"
 #import "FICImageTableChunk.h"
 #import "FICImageTableEntry.h"
+#import "FICImageTableIndex.h"
+#import "FICImageTableMapping.h"
 #import "FICUtilities.h"
-#import <libkern/OSAtomic.h>
 
 #import "FICImageCache+FICErrorLogging.h"
 
+#import <memory>
+#import <vector>
+
 #pragma mark External Definitions
 
 NSString *const FICImageTableEntryDataVersionKey = @"FICImageTableEntryDataVersionKey";
@@ -23,9 +27,11 @@ NSString *const FICImageTableScreenScaleKey = @"FICImageTableScreenScaleKey";
 
 #pragma mark - Internal Definitions
 
-static NSString *const FICImageTableMetadataFileExtension = @"metadata";
+static NSString *const FICImageTableMetadataFileExtension = @"metadataJournal";
+static NSString *const FICImageTableLegacyMetadataFileExtension = @"metadata";
 static NSString *const FICImageTableFileExtension = @"imageTable";
 
+// Keys of the metadata files written before the journal
 static NSString *const FICImageTableIndexMapKey = @"indexMap";
 static NSString *const FICImageTableContextMapKey = @"contextMap";
 static NSString *const FICImageTableMRUArrayKey = @"mruArray";
@@ -33,6 +39,29 @@ static NSString *const FICImageTableFormatKey = @"format";
 
 static BOOL FICProtectedDataAvailable = NO;
 
+static_assert(sizeof(CFUUIDBytes) == sizeof(FIC::UUID), "FIC::UUID must match CFUUIDBytes.");
+
+static FIC::UUID FICIndexUUIDWithString(NSString *string) {
+    CFUUIDBytes UUIDBytes = FICUUIDBytesWithString(string);
+    FIC::UUID UUID;
+    memcpy(UUID.bytes, &UUIDBytes, sizeof(UUID.bytes));
+    return UUID;
+}
+
+#pragma mark - Table File Mapping
+
+// Owns the mapping of an image table file. Chunks retain it, so images can outlive their table.
+@interface FICImageTableMappingOwner : NSObject {
+@public
+    std::unique_ptr<FIC::ImageTableMapping> _mapping;
+}
+
+@end
+
+@implementation FICImageTableMappingOwner
+
+@end
+
 #pragma mark - Class Extension
 
 @interface FICImageTable () {
@@ -52,20 +81,18 @@ static BOOL FICProtectedDataAvailable = NO;
     size_t _chunkLength;
     NSInteger _chunkCount;
     
-    NSMutableDictionary *_chunkDictionary;
-    NSCountedSet *_chunkSet;
+    // The whole table file is mapped once. Chunks are views into the mapping, looked up by index.
+    FICImageTableMappingOwner *_mappingOwner;
+    FIC::ImageTableMapping *_mapping;
+    std::vector<FICImageTableChunk *> _chunks;
     
     NSRecursiveLock *_lock;
     CFMutableDictionaryRef _indexNumbers;
     
-    // Image table metadata
-    NSMutableDictionary *_indexMap;         // Key: entity UUID, value: integer index into the table file
-    NSMutableDictionary *_sourceImageMap;   // Key: entity UUID, value: source image UUID
-    NSMutableIndexSet *_occupiedIndexes;
-    NSMutableOrderedSet *_MRUEntries;
-    NSCountedSet *_inUseEntries;
+    // Image table metadata: entity UUID -> entry index, source image UUIDs, and MRU order, journaled to disk
+    FIC::ImageTableIndex _index;
     NSDictionary *_imageFormatDictionary;
-    int32_t _metadataVersion;
+    NSData *_imageFormatData;
 
     NSString *_fileDataProtectionMode;
     BOOL _canAccessData;
@@ -97,6 +124,13 @@ static BOOL FICProtectedDataAvailable = NO;
     return metadataFilePath;
 }
 
+- (NSString *)_legacyMetadataFilePath {
+    NSString *metadataFilePath = [[_imageFormat name] stringByAppendingPathExtension:FICImageTableLegacyMetadataFileExtension];
+    metadataFilePath = [[self directoryPath] stringByAppendingPathComponent:metadataFilePath];
+    
+    return metadataFilePath;
+}
+
 - (NSString *) directoryPath {
     NSString *directoryPath = [FICImageTable directoryPath];
     if (self.imageCache.nameSpace) {
@@ -179,6 +213,7 @@ static BOOL FICProtectedDataAvailable = NO;
         
         _imageFormat = [imageFormat copy];
         _imageFormatDictionary = [imageFormat dictionaryRepresentation];
+        _imageFormatData = [NSJSONSerialization dataWithJSONObject:_imageFormatDictionary options:kNilOptions error:NULL];
         
         _screenScale = [[UIScreen mainScreen] scale];
         
@@ -187,21 +222,8 @@ static BOOL FICProtectedDataAvailable = NO;
         _imageRowLength = (NSInteger)FICByteAlignForCoreAnimation(pixelSize.width * bytesPerPixel);
         _imageLength = _imageRowLength * (NSInteger)pixelSize.height;
         
-        _chunkDictionary = [[NSMutableDictionary alloc] init];
-        _chunkSet = [[NSCountedSet alloc] init];
-        
-        _indexMap = [[NSMutableDictionary alloc] init];
-        _occupiedIndexes = [[NSMutableIndexSet alloc] init];
-        
-        _MRUEntries = [[NSMutableOrderedSet alloc] init];
-        _inUseEntries = [NSCountedSet set];
-
-        _sourceImageMap = [[NSMutableDictionary alloc] init];
-        
         _filePath = [[self tableFilePath] copy];
         
-        [self _loadMetadata];
-        
         NSString *directoryPath = [self directoryPath];
         
         NSFileManager *fileManager = [[NSFileManager alloc] init];
@@ -211,6 +233,8 @@ static BOOL FICProtectedDataAvailable = NO;
             [fileManager createDirectoryAtPath:directoryPath withIntermediateDirectories:YES attributes:nil error:nil];
         }
         
+        [self _loadMetadata];
+        
         if ([fileManager fileExistsAtPath:_filePath] == NO) {
             NSMutableDictionary *attributes = [NSMutableDictionary dictionary];
             [attributes setValue:[_imageFormat protectionModeString] forKeyPath:NSFileProtectionKey];
@@ -241,11 +265,24 @@ static BOOL FICProtectedDataAvailable = NO;
             _entryCount = (NSInteger)(_fileLength / _entryLength);
             _chunkCount = (_entryCount + _entriesPerChunk - 1) / _entriesPerChunk;
             
-            if ([_indexMap count] > _entryCount) {
+            // Map room for the maximum count up front, so the mapping doesn't change as the table fills up.
+            NSInteger reservedChunkCount = ([self _maximumCount] + _entriesPerChunk - 1) / _entriesPerChunk;
+            _mappingOwner = [[FICImageTableMappingOwner alloc] init];
+            _mappingOwner->_mapping.reset(new FIC::ImageTableMapping(_fileDescriptor, _chunkLength, (size_t)reservedChunkCount));
+            _mapping = _mappingOwner->_mapping.get();
+            [self _updateMapping];
+            
+            if (_index.count() > _entryCount) {
                 // It's possible that someone deleted the image table file but left behind the metadata file. If this happens, the metadata
                 // will obviously become out of sync with the image table file, so we need to reset the image table.
                 [self reset];
             }
+            
+            // Drops entries past the end of the table file.
+            _index.setSlotCount((uint32_t)_entryCount);
+            
+            [NSNotificationCenter.defaultCenter addObserver:self selector:@selector(_applicationDidEnterBackground:) name:UIApplicationDidEnterBackgroundNotification object:nil];
+            [NSNotificationCenter.defaultCenter addObserver:self selector:@selector(_applicationDidReceiveMemoryWarning:) name:UIApplicationDidReceiveMemoryWarningNotification object:nil];
         } else {
             // If something goes wrong and we can't open the image table file, then we have no choice but to release and nil self.
             NSString *message = [NSString stringWithFormat:@"*** FIC Error: %s could not open the image table file at path %@. The image table was not created.", __PRETTY_FUNCTION__, _filePath];
@@ -259,23 +296,32 @@ static BOOL FICProtectedDataAvailable = NO;
 }
 
 - (void)dealloc {
+    [NSNotificationCenter.defaultCenter removeObserver:self];
     if (_fileDescriptor >= 0) {
         close(_fileDescriptor);
     }
 }
 
-#pragma mark - Working with Chunks
+- (void)_applicationDidEnterBackground:(NSNotification *)notification {
+    // Accesses are only journaled with the next change: save the MRU order while we still can.
+    [_lock lock];
+    _index.flush();
+    [_lock unlock];
+}
 
-- (FICImageTableChunk *)_cachedChunkAtIndex:(NSInteger)index {
-    return [_chunkDictionary objectForKey:@(index)];
+- (void)_applicationDidReceiveMemoryWarning:(NSNotification *)notification {
+    // Entries are written back as soon as they're drawn, so the pages of chunks no image uses can be read in again later.
+    [_lock lock];
+    _mapping->dropUnusedChunks();
+    [_lock unlock];
 }
 
-- (void)_setChunk:(FICImageTableChunk *)chunk index:(NSInteger)index {
-    NSNumber *indexNumber = @(index);
-    if (chunk != nil) {
-        [_chunkDictionary setObject:chunk forKey:indexNumber];
-    } else {
-        [_chunkDictionary removeObjectForKey:indexNumber];
+#pragma mark - Working with Chunks
+
+- (void)_updateMapping {
+    if (_mapping->setFileLength((size_t)_fileLength) == NO) {
+        NSString *message = [NSString stringWithFormat:@"*** FIC Error: %s couldn't map the image table file at path %@, length = %lld, errno = %d. Chunks will be mapped one at a time.", __PRETTY_FUNCTION__, _filePath, _fileLength, errno];
+        [self.imageCache _logMessage:message];
     }
 }
 
@@ -283,17 +329,27 @@ static BOOL FICProtectedDataAvailable = NO;
     FICImageTableChunk *chunk = nil;
     
     if (index < _chunkCount) {
-        chunk = [self _cachedChunkAtIndex:index];
+        if ((size_t)index >= _chunks.size()) {
+            _chunks.resize((size_t)_chunkCount);
+        }
+        chunk = _chunks[index];
         
-        if (chunk == nil) {
-            size_t chunkLength = _chunkLength;
-            off_t chunkOffset = index * (off_t)_chunkLength;
-            if (chunkOffset + chunkLength > _fileLength) {
-                chunkLength = (size_t)(_fileLength - chunkOffset);
+        // A chunk made before the file was mapped again still works, but new entries should use the current mapping.
+        uint8_t *mappedBytes = _mapping->chunkBytes((size_t)index);
+        if (chunk == nil || (mappedBytes != NULL && [chunk bytes] != mappedBytes)) {
+            if (mappedBytes != NULL) {
+                chunk = [[FICImageTableChunk alloc] initWithBytes:mappedBytes index:index length:_chunkLength mapping:_mappingOwner];
+            } else {
+                // The file couldn't be mapped whole: fall back to mapping just this chunk.
+                size_t chunkLength = _chunkLength;
+                off_t chunkOffset = index * (off_t)_chunkLength;
+                if (chunkOffset + chunkLength > _fileLength) {
+                    chunkLength = (size_t)(_fileLength - chunkOffset);
+                }
+                
+                chunk = [[FICImageTableChunk alloc] initWithFileDescriptor:_fileDescriptor index:index length:chunkLength];
             }
-                    
-            chunk = [[FICImageTableChunk alloc] initWithFileDescriptor:_fileDescriptor index:index length:chunkLength];
-            [self _setChunk:chunk index:index];
+            _chunks[index] = chunk;
         }
     }
     
@@ -334,17 +390,15 @@ static BOOL FICProtectedDataAvailable = NO;
             // Create context whose backing store *is* the mapped file data
             FICImageTableEntry *entryData = [self _entryDataAtIndex:newEntryIndex];
             if (entryData != nil) {
+                // Pages that aren't resident fault as the image is drawn
+                _mapping->willAccess((size_t)(newEntryIndex * _entryLength), (size_t)_entryLength);
+                
                 [entryData setEntityUUIDBytes:FICUUIDBytesWithString(entityUUID)];
                 [entryData setSourceImageUUIDBytes:FICUUIDBytesWithString(sourceImageUUID)];
                 
-                // Update our book-keeping
-                [_indexMap setObject:[NSNumber numberWithUnsignedInteger:newEntryIndex] forKey:entityUUID];
-                [_occupiedIndexes addIndex:newEntryIndex];
-                [_sourceImageMap setObject:sourceImageUUID forKey:entityUUID];
-                
-                // Update MRU array
-                [self _entryWasAccessedWithEntityUUID:entityUUID];
-                [self saveMetadata];
+                // Update our book-keeping, which also makes the entry the most recently used one
+                BOOL journaled = _index.setEntry((uint32_t)newEntryIndex, FICIndexUUIDWithString(entityUUID), FICIndexUUIDWithString(sourceImageUUID));
+                [self _metadataWasSaved:journaled];
                 
                 // Unique, unchanging pointer for this entry's index
                 NSNumber *indexNumber = [self _numberForEntryAtIndex:newEntryIndex];
@@ -395,15 +449,17 @@ static BOOL FICProtectedDataAvailable = NO;
                     // The UUIDs don't match, so we need to invalidate the entry.
                     [self deleteEntryForEntityUUID:entityUUID];
                 } else {
-                    [self _entryWasAccessedWithEntityUUID:entityUUID];
+                    _index.entryWasAccessed((uint32_t)[entryData index]);
+                    _mapping->willAccess((size_t)([entryData index] * _entryLength), (size_t)_entryLength);
                     
                     // Create CGImageRef whose backing store *is* the mapped image table entry. We avoid a memcpy this way.
                     CGDataProviderRef dataProvider = CGDataProviderCreateWithData((__bridge_retained void *)entryData, [entryData bytes], [entryData imageLength], _FICReleaseImageData);
                     
-                    [_inUseEntries addObject:entityUUID];
+                    // The entry can't be evicted while its image is alive.
+                    FIC::ImageTableIndex::Use use = _index.beginUse((uint32_t)[entryData index]);
                     __weak FICImageTable *weakSelf = self;
                     [entryData executeBlockOnDealloc:^{
-                        [weakSelf removeInUseForEntityUUID:entityUUID];
+                        [weakSelf _endUse:use];
                     }];
                     
                     CGSize pixelSize = [_imageFormat pixelSize];
@@ -443,9 +499,9 @@ static void _FICReleaseImageData(void *info, const void *data, size_t size) {
     }
 }
 
-- (void)removeInUseForEntityUUID:(NSString *)entityUUID {
+- (void)_endUse:(FIC::ImageTableIndex::Use)use {
     [_lock lock];
-    [_inUseEntries removeObject:entityUUID];
+    _index.endUse(use);
     [_lock unlock];
 }
 
@@ -453,17 +509,10 @@ static void _FICReleaseImageData(void *info, const void *data, size_t size) {
     if (entityUUID != nil) {
         [_lock lock];
         
-        NSInteger MRUIndex = [_MRUEntries indexOfObject:entityUUID];
-        if (MRUIndex != NSNotFound) {
-            [_MRUEntries removeObjectAtIndex:MRUIndex];
-        }
-        
         NSInteger index = [self _indexOfEntryForEntityUUID:entityUUID];
         if (index != NSNotFound) {
-            [_sourceImageMap removeObjectForKey:entityUUID];
-            [_indexMap removeObjectForKey:entityUUID];
-            [_occupiedIndexes removeIndex:index];
-            [self saveMetadata];
+            BOOL journaled = _index.removeEntryAtSlot((uint32_t)index);
+            [self _metadataWasSaved:journaled];
         }
         
         [_lock unlock];
@@ -499,6 +548,45 @@ static void _FICReleaseImageData(void *info, const void *data, size_t size) {
     return imageExists;
 }
 
+#pragma mark - Managing Memory and Paging
+
+- (void)prefetchEntriesForEntityUUIDs:(NSArray<NSString *> *)entityUUIDs {
+    [_lock lock];
+    
+    if ([self canAccessEntryData]) {
+        for (NSString *entityUUID in entityUUIDs) {
+            NSInteger index = [self _indexOfEntryForEntityUUID:entityUUID];
+            if (index != NSNotFound) {
+                _mapping->prefetch((size_t)(index * _entryLength), (size_t)_entryLength);
+            }
+        }
+    }
+    
+    [_lock unlock];
+}
+
+- (FICImageTableStatistics)statistics {
+    [_lock lock];
+    
+    FIC::ImageTableMapping::Statistics mappingStatistics = _mapping->statistics();
+    
+    FICImageTableStatistics statistics;
+    statistics.entryCount = _index.count();
+    statistics.maximumCount = [self _maximumCount];
+    statistics.entryLength = _entryLength;
+    statistics.pageSize = FIC::ImageTableMapping::pageSize();
+    statistics.fileLength = _fileLength;
+    statistics.mappedLength = mappingStatistics.mappedLength;
+    statistics.residentLength = mappingStatistics.residentLength;
+    statistics.pageFaults = mappingStatistics.pageFaults;
+    statistics.prefetchedPages = mappingStatistics.prefetchedPages;
+    statistics.droppedPages = mappingStatistics.droppedPages;
+    
+    [_lock unlock];
+    
+    return statistics;
+}
+
 #pragma mark - Working with Entries
 
 - (NSInteger)_maximumCount {
@@ -516,15 +604,16 @@ static void _FICReleaseImageData(void *info, const void *data, size_t size) {
         } else {
             _fileLength = fileLength;
             _entryCount = entryCount;
+            _index.setSlotCount((uint32_t)entryCount);
             _chunkCount = _entriesPerChunk > 0 ? ((_entryCount + _entriesPerChunk - 1) / _entriesPerChunk) : 0;
+            [self _updateMapping];
             
-            NSDictionary *chunkDictionary = [_chunkDictionary copy];
-            for (FICImageTableChunk *chunk in [chunkDictionary allValues]) {
+            for (FICImageTableChunk * __strong &chunk : _chunks) {
                 if ([chunk length] != _chunkLength) {
                     // Issue 31: https://github.com/path/FastImageCache/issues/31
                     // Somehow, we have a partial chunk whose length needs to be adjusted
                     // since we changed our file length.
-                    [self _setChunk:nil index:[chunk index]];
+                    chunk = nil;
                 }
             }
         }
@@ -579,7 +668,7 @@ static void _FICReleaseImageData(void *info, const void *data, size_t size) {
             if (entryData) {
                 [entryData setImageCache:self.imageCache];
                 [entryData setIndex:index];
-                [_chunkSet addObject:chunk];
+                _mapping->beginUse((size_t)chunkIndex);
             
                 __weak FICImageTable *weakSelf = self;
                 [entryData executeBlockOnDealloc:^{
@@ -606,28 +695,28 @@ static void _FICReleaseImageData(void *info, const void *data, size_t size) {
 
 - (void)_entryWasDeallocatedFromChunk:(FICImageTableChunk *)chunk {
     [_lock lock];
-    [_chunkSet removeObject:chunk];
-    if ([_chunkSet countForObject:chunk] == 0) {
-        [self _setChunk:nil index:[chunk index]];
+    size_t chunkIndex = (size_t)[chunk index];
+    _mapping->endUse(chunkIndex);
+    
+    // A chunk that maps its own portion of the file keeps it mapped for as long as it lives, so drop it once no entry
+    // uses it; it is mapped again when needed. Views into the whole-file mapping cost nothing to keep.
+    if (_mapping->useCount(chunkIndex) == 0 && _mapping->chunkBytes(chunkIndex) == NULL
+        && chunkIndex < _chunks.size() && _chunks[chunkIndex] == chunk) {
+        _chunks[chunkIndex] = nil;
     }
     [_lock unlock];
 }
 
 - (NSInteger)_nextEntryIndex {
-    NSMutableIndexSet *unoccupiedIndexes = [[NSMutableIndexSet alloc] initWithIndexesInRange:NSMakeRange(0, _entryCount)];
-    [unoccupiedIndexes removeIndexes:_occupiedIndexes];
-    
-    NSInteger index = [unoccupiedIndexes firstIndex];
-    if (index == NSNotFound) {
-        index = _entryCount;
-    }
-    
-    if (index >= [self _maximumCount] && [_MRUEntries count]) {
-        // Evict the oldest/least-recently accessed entry here
-
-        NSString *oldestEvictableEntityUUID = [self oldestEvictableEntityUUID];
-        if (oldestEvictableEntityUUID) {
-            [self deleteEntryForEntityUUID:oldestEvictableEntityUUID];
+    uint32_t freeSlot = _index.freeSlot();
+    NSInteger index = freeSlot != FIC::ImageTableIndex::NotFound ? (NSInteger)freeSlot : (NSInteger)_entryCount;
+    
+    if (index >= [self _maximumCount] && _index.count() > 0) {
+        // Evict the oldest/least-recently accessed entry that isn't in use here
+        uint32_t evictableSlot = _index.evictableSlot();
+        if (evictableSlot != FIC::ImageTableIndex::NotFound) {
+            BOOL journaled = _index.removeEntryAtSlot(evictableSlot);
+            [self _metadataWasSaved:journaled];
             index = [self _nextEntryIndex];
         }
     }
@@ -640,31 +729,12 @@ static void _FICReleaseImageData(void *info, const void *data, size_t size) {
     return index;
 }
 
-- (NSString *)oldestEvictableEntityUUID {
-    NSString *uuid = nil;
-    for (NSInteger i = [_MRUEntries count] - 1; i >= 0; i--) {
-        NSString *candidateUUID = [_MRUEntries objectAtIndex:i];
-        if (![_inUseEntries containsObject:candidateUUID]) {
-            uuid = candidateUUID;
-            break;
-        }
-    }
-
-    return uuid;
-}
-
 - (NSInteger)_indexOfEntryForEntityUUID:(NSString *)entityUUID {
     NSInteger index = NSNotFound;
-    if (_indexMap != nil && entityUUID != nil) {
-        NSNumber *indexNumber = [_indexMap objectForKey:entityUUID];
-        index = indexNumber ? [indexNumber integerValue] : NSNotFound;
-        
-        if (index != NSNotFound && index >= _entryCount) {
-            [_indexMap removeObjectForKey:entityUUID];
-            [_occupiedIndexes removeIndex:index];
-            [_sourceImageMap removeObjectForKey:entityUUID];
-            index = NSNotFound;
-        }
+    if (entityUUID != nil) {
+        // The index never holds entries past the end of the table file.
+        uint32_t slot = _index.slotForEntity(FICIndexUUIDWithString(entityUUID));
+        index = slot != FIC::ImageTableIndex::NotFound ? (NSInteger)slot : NSNotFound;
     }
     
     return index;
@@ -680,17 +750,6 @@ static void _FICReleaseImageData(void *info, const void *data, size_t size) {
     return entryData;
 }
 
-- (void)_entryWasAccessedWithEntityUUID:(NSString *)entityUUID {
-    // Update MRU array
-    NSInteger index = [_MRUEntries indexOfObject:entityUUID];
-    if (index == NSNotFound) {
-        [_MRUEntries insertObject:entityUUID atIndex:0];
-    } else if (index != 0) {
-        [_MRUEntries removeObjectAtIndex:index];
-        [_MRUEntries insertObject:entityUUID atIndex:0];
-    }
-}
-
 // Unchanging pointer value for a given entry index to synchronize on
 - (NSNumber *)_numberForEntryAtIndex:(NSInteger)index {
     NSNumber *resultNumber = (__bridge id)CFDictionaryGetValue(_indexNumbers, (const void *)index);
@@ -703,59 +762,52 @@ static void _FICReleaseImageData(void *info, const void *data, size_t size) {
 
 #pragma mark - Working with Metadata
 
-- (void)saveMetadata {
-    @autoreleasepool {
-        [_lock lock];
-        
-        NSDictionary *metadataDictionary = [NSDictionary dictionaryWithObjectsAndKeys:
-                                            [_indexMap copy], FICImageTableIndexMapKey,
-                                            [_sourceImageMap copy], FICImageTableContextMapKey,
-                                            [[_MRUEntries array] copy], FICImageTableMRUArrayKey,
-                                            [_imageFormatDictionary copy], FICImageTableFormatKey, nil];
+- (void)_metadataWasSaved:(BOOL)saved {
+    if (saved == NO) {
+        NSString *message = [NSString stringWithFormat:@"*** FIC Error: %s couldn't write metadata for format %@", __PRETTY_FUNCTION__, [_imageFormat name]];
+        [self.imageCache _logMessage:message];
+    }
+}
 
-        __block int32_t metadataVersion = OSAtomicIncrement32(&_metadataVersion);
+- (std::string)_imageFormatUserData {
+    return std::string((const char *)[_imageFormatData bytes], [_imageFormatData length]);
+}
 
-        [_lock unlock];
-        
-        static dispatch_queue_t __metadataQueue = nil;
-        static dispatch_once_t onceToken;
-        dispatch_once(&onceToken, ^{
-            __metadataQueue = dispatch_queue_create("com.path.FastImageCache.ImageTableMetadataQueue", NULL);
-        });
+- (void)_loadMetadata {
+    if (_index.open([[self metadataFilePath] fileSystemRepresentation]) == NO) {
+        NSString *message = [NSString stringWithFormat:@"*** FIC Error: %s couldn't open the metadata journal for format %@. Entries won't persist.", __PRETTY_FUNCTION__, [_imageFormat name]];
+        [self.imageCache _logMessage:message];
+    }
+    
+    const std::string &userData = _index.userData();
+    if (userData.empty()) {
+        // A new journal: carry over the entries of a metadata file written before the journal, if any.
+        _index.reset([self _imageFormatUserData]);
+        [self _importLegacyMetadata];
+        return;
+    }
+    
+    NSData *formatData = [NSData dataWithBytes:userData.data() length:userData.size()];
+    NSDictionary *formatDictionary = [NSJSONSerialization JSONObjectWithData:formatData options:kNilOptions error:NULL];
+    if ([formatDictionary isEqual:_imageFormatDictionary] == NO) {
+        // Something about this image format has changed, so the existing metadata is no longer valid. The image table file
+        // must be deleted and recreated.
+        [[NSFileManager defaultManager] removeItemAtPath:_filePath error:NULL];
+        _index.reset([self _imageFormatUserData]);
         
-        dispatch_async(__metadataQueue, ^{
-            // Cancel serialization if a new metadata version is queued to be saved
-            if (metadataVersion != _metadataVersion) {
-                return;
-            }
-
-            @autoreleasepool {
-                NSData *data = [NSJSONSerialization dataWithJSONObject:metadataDictionary options:kNilOptions error:NULL];
-
-                // Cancel disk writing if a new metadata version is queued to be saved
-                if (metadataVersion != _metadataVersion) {
-                    return;
-                }
-
-                BOOL fileWriteResult = [data writeToFile:[self metadataFilePath] atomically:NO];
-                if (fileWriteResult == NO) {
-                    NSString *message = [NSString stringWithFormat:@"*** FIC Error: %s couldn't write metadata for format %@", __PRETTY_FUNCTION__, [_imageFormat name]];
-                    [self.imageCache _logMessage:message];
-                }
-            }
-        });
+        NSString *message = [NSString stringWithFormat:@"*** FIC Notice: Image format %@ has changed; deleting data and starting over.", [_imageFormat name]];
+        [self.imageCache _logMessage:message];
     }
 }
 
-- (void)_loadMetadata {
-    NSString *metadataFilePath = [self metadataFilePath];
+- (void)_importLegacyMetadata {
+    NSString *metadataFilePath = [self _legacyMetadataFilePath];
     NSData *metadataData = [NSData dataWithContentsOfURL:[NSURL fileURLWithPath:metadataFilePath] options:NSDataReadingMappedAlways error:NULL];
     if (metadataData != nil) {
         NSDictionary *metadataDictionary = (NSDictionary *)[NSJSONSerialization JSONObjectWithData:metadataData options:kNilOptions error:NULL];
         
         if (!metadataDictionary) {
             // The image table was likely previously stored as a .plist
-            // We'll read it into memory as a .plist and later store it (during -saveMetadata) using NSJSONSerialization for performance reasons
             metadataDictionary = (NSDictionary *)[NSPropertyListSerialization propertyListWithData:metadataData options:0 format:NULL error:NULL];
         }
         
@@ -764,28 +816,41 @@ static void _FICReleaseImageData(void *info, const void *data, size_t size) {
             // Something about this image format has changed, so the existing metadata is no longer valid. The image table file
             // must be deleted and recreated.
             [[NSFileManager defaultManager] removeItemAtPath:_filePath error:NULL];
-            [[NSFileManager defaultManager] removeItemAtPath:metadataFilePath error:NULL];
             metadataDictionary = nil;
             
             NSString *message = [NSString stringWithFormat:@"*** FIC Notice: Image format %@ has changed; deleting data and starting over.", [_imageFormat name]];
             [self.imageCache _logMessage:message];
         }
         
-        [_indexMap setDictionary:[metadataDictionary objectForKey:FICImageTableIndexMapKey]];
-        
-        for (NSNumber *index in [_indexMap allValues]) {
-            [_occupiedIndexes addIndex:[index intValue]];
+        NSDictionary *indexMap = [metadataDictionary objectForKey:FICImageTableIndexMapKey];
+        NSDictionary *sourceImageMap = [metadataDictionary objectForKey:FICImageTableContextMapKey];
+        NSArray *MRUArray = [metadataDictionary objectForKey:FICImageTableMRUArrayKey];
+        
+        // Least recently used first, so the most recently used entry ends up first: entries missing from the MRU array, then
+        // the MRU array backwards.
+        NSMutableArray *entityUUIDs = [NSMutableArray arrayWithCapacity:[indexMap count]];
+        NSSet *MRUEntityUUIDs = [NSSet setWithArray:MRUArray ?: @[]];
+        for (NSString *entityUUID in indexMap) {
+            if ([MRUEntityUUIDs containsObject:entityUUID] == NO) {
+                [entityUUIDs addObject:entityUUID];
+            }
         }
-        
-        [_sourceImageMap setDictionary:[metadataDictionary objectForKey:FICImageTableContextMapKey]];
-        
-        [_MRUEntries removeAllObjects];
-        
-        NSArray *mruArray = [metadataDictionary objectForKey:FICImageTableMRUArrayKey];
-        if (mruArray) {
-            [_MRUEntries addObjectsFromArray:mruArray];
+        [entityUUIDs addObjectsFromArray:[[MRUArray reverseObjectEnumerator] allObjects]];
+        
+        for (NSString *entityUUID in entityUUIDs) {
+            NSNumber *index = [indexMap objectForKey:entityUUID];
+            NSString *sourceImageUUID = [sourceImageMap objectForKey:entityUUID];
+            if (index != nil && sourceImageUUID != nil) {
+                if ([index unsignedIntValue] >= _index.slotCount()) {
+                    _index.setSlotCount([index unsignedIntValue] + 1);
+                }
+                _index.setEntry([index unsignedIntValue], FICIndexUUIDWithString(entityUUID), FICIndexUUIDWithString(sourceImageUUID));
+            }
         }
+        _index.compact();
     }
+    
+    [[NSFileManager defaultManager] removeItemAtPath:metadataFilePath error:NULL];
 }
 
 #pragma mark - Resetting the Image Table
@@ -793,16 +858,11 @@ static void _FICReleaseImageData(void *info, const void *data, size_t size) {
 - (void)reset {
     [_lock lock];
     
-    [_indexMap removeAllObjects];
-    [_occupiedIndexes removeAllIndexes];
-    [_inUseEntries removeAllObjects];
-    [_MRUEntries removeAllObjects];
-    [_sourceImageMap removeAllObjects];
-    [_chunkDictionary removeAllObjects];
-    [_chunkSet removeAllObjects];
+    BOOL journaled = _index.reset([self _imageFormatUserData]);
+    [self _metadataWasSaved:journaled];
+    _chunks.clear();
     
     [self _setEntryCount:0];
-    [self saveMetadata];
     
     [_lock unlock];
 }
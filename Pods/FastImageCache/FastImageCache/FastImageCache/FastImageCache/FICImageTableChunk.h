@@ -14,6 +14,8 @@ NS_ASSUME_NONNULL_BEGIN
 
 /**
  `FICImageTableChunk` represents a contiguous portion of image table file data.
+ 
+ @discussion A chunk either maps its own portion of the file, or is a view into a mapping of the whole file kept by its image table.
  */
 @interface FICImageTableChunk : NSObject
 
@@ -61,6 +63,21 @@ NS_ASSUME_NONNULL_BEGIN
  */
 - (nullable instancetype)initWithFileDescriptor:(int)fileDescriptor index:(NSInteger)index length:(size_t)length;
 
+/**
+ Initializes a new image table chunk that is a view into an existing mapping of the image table file.
+ 
+ @param bytes The start of the chunk in the mapping.
+ 
+ @param index The index of the chunk.
+ 
+ @param length The length, in bytes, of the chunk.
+ 
+ @param mapping The object that owns the mapping. The chunk retains it, so `bytes` stay mapped as long as the chunk is alive.
+ 
+ @return A new image table chunk.
+ */
+- (instancetype)initWithBytes:(void *)bytes index:(NSInteger)index length:(size_t)length mapping:(id)mapping;
+
 @end
 
 NS_ASSUME_NONNULL_END
\ No newline at end of file
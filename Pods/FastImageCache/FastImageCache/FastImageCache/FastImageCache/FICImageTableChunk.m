@@ -17,6 +17,7 @@
     void *_bytes;
     size_t _length;
     off_t _fileOffset;
+    id _mapping;
 }
 
 @end
@@ -50,8 +51,23 @@
     return self;
 }
 
+- (instancetype)initWithBytes:(void *)bytes index:(NSInteger)index length:(size_t)length mapping:(id)mapping {
+    self = [super init];
+    
+    if (self != nil) {
+        _index = index;
+        _length = length;
+        _fileOffset = _index * _length;
+        _bytes = bytes;
+        _mapping = mapping;
+    }
+    
+    return self;
+}
+
 - (void)dealloc {
-    if (_bytes != NULL) {
+    // Views into a mapping leave unmapping to its owner.
+    if (_bytes != NULL && _mapping == nil) {
         munmap(_bytes, _length);
     }
 }
@@ -0,0 +1,533 @@
+//
+//  FICImageTableIndex.cpp
+//  FastImageCache
+//
+//  Copyright (c) 2013 Path, Inc.
+//  See LICENSE for full license agreement.
+//
+
+#include "FICImageTableIndex.h"
+
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace FIC {
+
+#pragma mark - Journal Format
+
+// A journal is a header, the user data, then records, all in host byte order: the file never leaves the device.
+
+static const uint32_t JournalMagic = 0x4a434946; // "FICJ"
+static const uint32_t JournalVersion = 1;
+
+// Compact once the journal holds this many records, and more than this many per live entry.
+static const size_t CompactionMinimumRecordCount = 256;
+static const size_t CompactionRecordsPerEntry = 2;
+
+// Accesses kept in memory before they are written on their own.
+static const size_t MaximumPendingAccessCount = 256;
+
+// Replayed records can't grow the table past this: a record that does is damaged, even if its checksum matches.
+static const uint32_t MaximumSlotCount = 1 << 24;
+
+struct JournalHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t userDataLength;
+    uint32_t checksum;
+};
+
+enum RecordKind : uint32_t {
+    RecordKindSetEntry = 1,
+    RecordKindRemoveEntry = 2,
+    RecordKindAccessEntry = 3,
+};
+
+struct ImageTableIndex::Record {
+    uint32_t kind;
+    uint32_t slot;
+    UUID entityUUID;
+    UUID sourceImageUUID;
+    uint32_t reserved;
+    uint32_t checksum;
+};
+
+static_assert(sizeof(ImageTableIndex::Record) == 48, "Journal records must keep their size.");
+
+// FNV-1a: a torn or zeroed record fails it.
+static uint32_t Checksum(const void *bytes, size_t length, uint32_t checksum = 2166136261u) {
+    const uint8_t *p = (const uint8_t *)bytes;
+    for (size_t i = 0; i < length; i++) {
+        checksum = (checksum ^ p[i]) * 16777619u;
+    }
+    return checksum;
+}
+
+static uint32_t HeaderChecksum(const JournalHeader &header, const std::string &userData) {
+    uint32_t checksum = Checksum(&header, offsetof(JournalHeader, checksum));
+    return Checksum(userData.data(), userData.size(), checksum);
+}
+
+static uint32_t RecordChecksum(const ImageTableIndex::Record &record) {
+    return Checksum(&record, offsetof(ImageTableIndex::Record, checksum));
+}
+
+static bool WriteAll(int fileDescriptor, const void *bytes, size_t length) {
+    const uint8_t *p = (const uint8_t *)bytes;
+    while (length > 0) {
+        ssize_t written = write(fileDescriptor, p, length);
+        if (written < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return false;
+        }
+        p += written;
+        length -= (size_t)written;
+    }
+    return true;
+}
+
+#pragma mark - UUID
+
+bool UUID::operator==(const UUID &other) const {
+    return memcmp(bytes, other.bytes, sizeof(bytes)) == 0;
+}
+
+bool UUID::isNull() const {
+    static const UUID null = {};
+    return *this == null;
+}
+
+#pragma mark - Object Lifecycle
+
+const uint32_t ImageTableIndex::NotFound;
+
+ImageTableIndex::ImageTableIndex() {
+    rehash(16);
+}
+
+ImageTableIndex::~ImageTableIndex() {
+    if (_fileDescriptor >= 0) {
+        flush();
+        close(_fileDescriptor);
+    }
+}
+
+#pragma mark - Journal
+
+bool ImageTableIndex::open(const std::string &path) {
+    _path = path;
+    int fileDescriptor = ::open(path.c_str(), O_RDWR | O_CREAT | O_APPEND, 0666);
+    if (fileDescriptor < 0) {
+        return false;
+    }
+
+    struct stat fileStatus;
+    size_t length = fstat(fileDescriptor, &fileStatus) == 0 ? (size_t)fileStatus.st_size : 0;
+    size_t validLength = 0;
+    if (length >= sizeof(JournalHeader)) {
+        void *mappedBytes = mmap(NULL, length, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+        if (mappedBytes != MAP_FAILED) {
+            const uint8_t *bytes = (const uint8_t *)mappedBytes;
+            JournalHeader header;
+            memcpy(&header, bytes, sizeof(header));
+            if (header.magic == JournalMagic && header.version == JournalVersion && header.userDataLength <= length - sizeof(header)) {
+                std::string userData((const char *)bytes + sizeof(header), header.userDataLength);
+                if (header.checksum == HeaderChecksum(header, userData)) {
+                    _userData.swap(userData);
+                    size_t offset = sizeof(header) + header.userDataLength;
+                    while (offset + sizeof(Record) <= length) {
+                        Record record;
+                        memcpy(&record, bytes + offset, sizeof(record));
+                        if (record.checksum != RecordChecksum(record) || record.reserved != 0
+                            || record.kind < RecordKindSetEntry || record.kind > RecordKindAccessEntry || record.slot >= MaximumSlotCount) {
+                            break;
+                        }
+                        apply(record);
+                        _journalRecordCount++;
+                        offset += sizeof(record);
+                    }
+                    validLength = offset;
+                }
+            }
+            munmap(mappedBytes, length);
+        }
+    }
+
+    _droppedJournalLength = length - validLength;
+    if (validLength == 0) {
+        // New, or the header itself is damaged: start an empty journal.
+        close(fileDescriptor);
+        return reset(std::string());
+    }
+    if (validLength < length && ftruncate(fileDescriptor, (off_t)validLength) != 0) {
+        close(fileDescriptor);
+        return false;
+    }
+    _fileDescriptor = fileDescriptor;
+    compactIfNeeded();
+    return true;
+}
+
+bool ImageTableIndex::reset(const std::string &userData) {
+    for (uint32_t slot = 0; slot < _slots.size(); slot++) {
+        if (_slots[slot].occupied) {
+            eraseEntry(slot);
+        }
+    }
+    _userData = userData;
+    return compact();
+}
+
+bool ImageTableIndex::flush() {
+    return _pendingAccesses.empty() || append(NULL);
+}
+
+bool ImageTableIndex::compact() {
+    _pendingAccesses.clear();
+    if (_path.empty()) {
+        return false;
+    }
+
+    // Write the new journal next to the old one, then move it over: a crash leaves one or the other.
+    std::string compactingPath = _path + ".compacting";
+    int fileDescriptor = -1;
+    if (!writeJournal(compactingPath, &fileDescriptor)) {
+        ::unlink(compactingPath.c_str());
+        return false;
+    }
+    if (rename(compactingPath.c_str(), _path.c_str()) != 0) {
+        close(fileDescriptor);
+        ::unlink(compactingPath.c_str());
+        return false;
+    }
+    if (_fileDescriptor >= 0) {
+        close(_fileDescriptor);
+    }
+    _fileDescriptor = fileDescriptor;
+    return true;
+}
+
+bool ImageTableIndex::writeJournal(const std::string &path, int *fileDescriptor) {
+    int newFileDescriptor = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_APPEND, 0666);
+    if (newFileDescriptor < 0) {
+        return false;
+    }
+
+    JournalHeader header = {JournalMagic, JournalVersion, (uint32_t)_userData.size(), 0};
+    header.checksum = HeaderChecksum(header, _userData);
+    std::vector<uint8_t> bytes(sizeof(header) + _userData.size() + _count * sizeof(Record));
+    memcpy(bytes.data(), &header, sizeof(header));
+    memcpy(bytes.data() + sizeof(header), _userData.data(), _userData.size());
+
+    // Least recently used first, so replaying puts the entries back in order.
+    uint8_t *p = bytes.data() + sizeof(header) + _userData.size();
+    for (const List *list : {&_evictable, &_inUse}) {
+        for (uint32_t slot = list->tail; slot != NotFound; slot = _slots[slot].previous) {
+            Record record = {RecordKindSetEntry, slot, _slots[slot].entityUUID, _slots[slot].sourceImageUUID, 0, 0};
+            record.checksum = RecordChecksum(record);
+            memcpy(p, &record, sizeof(record));
+            p += sizeof(record);
+        }
+    }
+
+    if (!WriteAll(newFileDescriptor, bytes.data(), bytes.size()) || fsync(newFileDescriptor) != 0) {
+        close(newFileDescriptor);
+        return false;
+    }
+    *fileDescriptor = newFileDescriptor;
+    _journalRecordCount = _count;
+    return true;
+}
+
+bool ImageTableIndex::append(const Record *record) {
+    std::vector<Record> records;
+    records.reserve(_pendingAccesses.size() + 1);
+    for (uint32_t slot : _pendingAccesses) {
+        // The entry may have been replaced since.
+        if (slot < _slots.size() && _slots[slot].occupied) {
+            Record access = {RecordKindAccessEntry, slot, _slots[slot].entityUUID, _slots[slot].sourceImageUUID, 0, 0};
+            records.push_back(access);
+        }
+    }
+    _pendingAccesses.clear();
+    if (record != NULL) {
+        records.push_back(*record);
+    }
+    for (Record &pendingRecord : records) {
+        pendingRecord.checksum = RecordChecksum(pendingRecord);
+    }
+
+    if (_fileDescriptor < 0 || records.empty()) {
+        return _fileDescriptor >= 0;
+    }
+    bool written = WriteAll(_fileDescriptor, records.data(), records.size() * sizeof(Record));
+    _journalRecordCount += records.size();
+    compactIfNeeded();
+    return written;
+}
+
+void ImageTableIndex::compactIfNeeded() {
+    if (_journalRecordCount >= CompactionMinimumRecordCount && _journalRecordCount > _count * CompactionRecordsPerEntry) {
+        compact();
+    }
+}
+
+void ImageTableIndex::apply(const Record &record) {
+    switch (record.kind) {
+        case RecordKindSetEntry:
+            if (record.slot >= _slots.size()) {
+                setSlotCount(record.slot + 1);
+            }
+            insertEntry(record.slot, record.entityUUID, record.sourceImageUUID);
+            break;
+        case RecordKindRemoveEntry:
+            if (record.slot < _slots.size() && _slots[record.slot].occupied && _slots[record.slot].entityUUID == record.entityUUID) {
+                eraseEntry(record.slot);
+            }
+            break;
+        case RecordKindAccessEntry:
+            if (record.slot < _slots.size() && _slots[record.slot].occupied && _slots[record.slot].entityUUID == record.entityUUID) {
+                moveToFront(record.slot);
+            }
+            break;
+    }
+}
+
+#pragma mark - Slots
+
+void ImageTableIndex::setSlotCount(uint32_t slotCount) {
+    uint32_t oldSlotCount = (uint32_t)_slots.size();
+    for (uint32_t slot = slotCount; slot < oldSlotCount; slot++) {
+        removeEntryAtSlot(slot);
+    }
+
+    Slot freeSlot = {};
+    freeSlot.previous = NotFound;
+    freeSlot.next = NotFound;
+    _slots.resize(slotCount, freeSlot);
+    _freeSlots.resize((slotCount + 63) / 64, 0);
+    for (uint32_t slot = oldSlotCount; slot < slotCount; slot++) {
+        setSlotFree(slot, true);
+    }
+    if (slotCount % 64 != 0) {
+        // Clear the bits of slots that were cut off.
+        _freeSlots.back() &= (UINT64_C(1) << (slotCount % 64)) - 1;
+    }
+}
+
+uint32_t ImageTableIndex::freeSlot() const {
+    for (size_t word = 0; word < _freeSlots.size(); word++) {
+        if (_freeSlots[word] != 0) {
+            return (uint32_t)(word * 64 + __builtin_ctzll(_freeSlots[word]));
+        }
+    }
+    return NotFound;
+}
+
+void ImageTableIndex::setSlotFree(uint32_t slot, bool free) {
+    uint64_t bit = UINT64_C(1) << (slot % 64);
+    if (free) {
+        _freeSlots[slot / 64] |= bit;
+    } else {
+        _freeSlots[slot / 64] &= ~bit;
+    }
+}
+
+#pragma mark - Entries
+
+uint32_t ImageTableIndex::slotForEntity(const UUID &entityUUID) const {
+    for (size_t bucket = hash(entityUUID) & _tableMask;; bucket = (bucket + 1) & _tableMask) {
+        uint32_t slot = _table[bucket];
+        if (slot == NotFound || _slots[slot].entityUUID == entityUUID) {
+            return slot;
+        }
+    }
+}
+
+bool ImageTableIndex::setEntry(uint32_t slot, const UUID &entityUUID, const UUID &sourceImageUUID) {
+    if (slot >= _slots.size()) {
+        return false;
+    }
+    insertEntry(slot, entityUUID, sourceImageUUID);
+    Record record = {RecordKindSetEntry, slot, entityUUID, sourceImageUUID, 0, 0};
+    return append(&record);
+}
+
+bool ImageTableIndex::removeEntryAtSlot(uint32_t slot) {
+    if (slot >= _slots.size() || !_slots[slot].occupied) {
+        return true;
+    }
+    Record record = {RecordKindRemoveEntry, slot, _slots[slot].entityUUID, _slots[slot].sourceImageUUID, 0, 0};
+    eraseEntry(slot);
+    return append(&record);
+}
+
+void ImageTableIndex::entryWasAccessed(uint32_t slot) {
+    if (slot >= _slots.size() || !_slots[slot].occupied || listOfSlot(slot).head == slot) {
+        return;
+    }
+    moveToFront(slot);
+    _pendingAccesses.push_back(slot);
+    if (_pendingAccesses.size() >= MaximumPendingAccessCount) {
+        flush();
+    }
+}
+
+ImageTableIndex::Use ImageTableIndex::beginUse(uint32_t slot) {
+    if (slot >= _slots.size() || !_slots[slot].occupied) {
+        return Use{NotFound, 0};
+    }
+    Slot &entry = _slots[slot];
+    if (entry.useCount == 0) {
+        unlink(_evictable, slot);
+        pushFront(_inUse, slot);
+    }
+    entry.useCount++;
+    return Use{slot, entry.generation};
+}
+
+void ImageTableIndex::endUse(Use use) {
+    if (use.slot >= _slots.size()) {
+        return;
+    }
+    Slot &entry = _slots[use.slot];
+    if (!entry.occupied || entry.generation != use.generation || entry.useCount == 0) {
+        return;
+    }
+    entry.useCount--;
+    if (entry.useCount == 0) {
+        unlink(_inUse, use.slot);
+        pushFront(_evictable, use.slot);
+    }
+}
+
+void ImageTableIndex::insertEntry(uint32_t slot, const UUID &entityUUID, const UUID &sourceImageUUID) {
+    if (_slots[slot].occupied) {
+        eraseEntry(slot);
+    }
+    uint32_t previousSlot = slotForEntity(entityUUID);
+    if (previousSlot != NotFound) {
+        eraseEntry(previousSlot);
+    }
+
+    Slot &entry = _slots[slot];
+    entry.entityUUID = entityUUID;
+    entry.sourceImageUUID = sourceImageUUID;
+    entry.useCount = 0;
+    entry.occupied = true;
+    setSlotFree(slot, false);
+    pushFront(_evictable, slot);
+    _count++;
+    if ((_count + 1) * 2 > _table.size()) {
+        rehash(_table.size() * 2);
+    } else {
+        insertIntoTable(slot);
+    }
+}
+
+void ImageTableIndex::eraseEntry(uint32_t slot) {
+    Slot &entry = _slots[slot];
+    eraseFromTable(slot);
+    unlink(listOfSlot(slot), slot);
+    entry.occupied = false;
+    entry.useCount = 0;
+    entry.generation++;
+    setSlotFree(slot, true);
+    _count--;
+}
+
+void ImageTableIndex::moveToFront(uint32_t slot) {
+    List &list = listOfSlot(slot);
+    if (list.head != slot) {
+        unlink(list, slot);
+        pushFront(list, slot);
+    }
+}
+
+#pragma mark - Lists
+
+void ImageTableIndex::unlink(List &list, uint32_t slot) {
+    Slot &entry = _slots[slot];
+    if (entry.previous != NotFound) {
+        _slots[entry.previous].next = entry.next;
+    } else {
+        list.head = entry.next;
+    }
+    if (entry.next != NotFound) {
+        _slots[entry.next].previous = entry.previous;
+    } else {
+        list.tail = entry.previous;
+    }
+    entry.previous = NotFound;
+    entry.next = NotFound;
+}
+
+void ImageTableIndex::pushFront(List &list, uint32_t slot) {
+    Slot &entry = _slots[slot];
+    entry.previous = NotFound;
+    entry.next = list.head;
+    if (list.head != NotFound) {
+        _slots[list.head].previous = slot;
+    } else {
+        list.tail = slot;
+    }
+    list.head = slot;
+}
+
+#pragma mark - Hash Table
+
+size_t ImageTableIndex::hash(const UUID &uuid) {
+    // Entity UUIDs are random or MD5 hashes, but mix the halves anyway.
+    uint64_t a, b;
+    memcpy(&a, uuid.bytes, sizeof(a));
+    memcpy(&b, uuid.bytes + sizeof(a), sizeof(b));
+    uint64_t x = a ^ (b * 0x9e3779b97f4a7c15ULL);
+    x ^= x >> 33;
+    x *= 0xff51afd7ed558ccdULL;
+    x ^= x >> 33;
+    return (size_t)x;
+}
+
+void ImageTableIndex::rehash(size_t capacity) {
+    _table.assign(capacity, NotFound);
+    _tableMask = capacity - 1;
+    for (uint32_t slot = 0; slot < _slots.size(); slot++) {
+        if (_slots[slot].occupied) {
+            insertIntoTable(slot);
+        }
+    }
+}
+
+void ImageTableIndex::insertIntoTable(uint32_t slot) {
+    size_t bucket = hash(_slots[slot].entityUUID) & _tableMask;
+    while (_table[bucket] != NotFound) {
+        bucket = (bucket + 1) & _tableMask;
+    }
+    _table[bucket] = slot;
+}
+
+void ImageTableIndex::eraseFromTable(uint32_t slot) {
+    size_t bucket = hash(_slots[slot].entityUUID) & _tableMask;
+    while (_table[bucket] != slot) {
+        bucket = (bucket + 1) & _tableMask;
+    }
+    // Backward shift: move later entries of the probe run into the hole unless that puts them before their home bucket.
+    size_t hole = bucket;
+    for (size_t next = (hole + 1) & _tableMask; _table[next] != NotFound; next = (next + 1) & _tableMask) {
+        size_t home = hash(_slots[_table[next]].entityUUID) & _tableMask;
+        bool homeIsAfterHole = hole <= next ? (hole < home && home <= next) : (hole < home || home <= next);
+        if (!homeIsAfterHole) {
+            _table[hole] = _table[next];
+            hole = next;
+        }
+    }
+    _table[hole] = NotFound;
+}
+
+} // namespace FIC
@@ -0,0 +1,186 @@
+//
+//  FICImageTableIndex.h
+//  FastImageCache
+//
+//  Copyright (c) 2013 Path, Inc.
+//  See LICENSE for full license agreement.
+//
+
+#pragma once
+
+// Plain C++ and POSIX, without Foundation, so the index can be built and tested against real files on any platform.
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace FIC {
+
+/// 16 bytes, laid out like CFUUIDBytes.
+struct UUID {
+    uint8_t bytes[16];
+
+    bool operator==(const UUID &other) const;
+    bool operator!=(const UUID &other) const { return !(*this == other); }
+    bool isNull() const;
+};
+
+/**
+ The bookkeeping of an image table: the slot of the table file each entity's image is stored in, the source image it
+ was drawn from, and the order entries were used in.
+
+ - Entity UUID -> slot lookups go through an open-addressing hash table: finding, adding and removing an entry is O(1).
+ - Occupied slots are on one of two intrusive lists, most recently used first: entries whose image is in use, and the
+   others. The least recently used entry that can be evicted is the tail of the second list.
+ - Free slots are handed out lowest first, so the table file stays compact.
+ - Changes are appended to a journal file as fixed-size, checksummed records, rather than rewriting all the metadata
+   on every change. Accesses are only recorded with the next change or flush. Once most records in the journal are
+   dead, the live entries are written to a new file, which atomically replaces the journal.
+ - Opening replays the journal. A record torn by a crash fails its checksum, and it and anything after it are dropped,
+   so the entries come back as of the last complete record.
+
+ Not thread safe: FICImageTable calls it with its lock held.
+ */
+class ImageTableIndex {
+public:
+    static const uint32_t NotFound = UINT32_MAX;
+
+    /// Identifies a use of an entry's image. Released uses of an entry that has since been replaced are ignored.
+    struct Use {
+        uint32_t slot;
+        uint32_t generation;
+    };
+
+    /// A change, as stored in the journal.
+    struct Record;
+
+    ImageTableIndex();
+    ~ImageTableIndex();
+
+    ImageTableIndex(const ImageTableIndex &) = delete;
+    ImageTableIndex &operator=(const ImageTableIndex &) = delete;
+
+    /**
+     Opens the journal at `path` and replays it, or creates an empty one. Returns false if the file can't be read or
+     created; the index then works in memory only.
+     */
+    bool open(const std::string &path);
+
+    /// Opaque data stored with the journal, e.g. a description of the image format. Empty for a new journal.
+    const std::string &userData() const { return _userData; }
+
+    /// Removes all entries and starts a new journal with `userData`. The slot count is kept; uses are ended.
+    bool reset(const std::string &userData);
+
+    /// Writes accesses recorded since the last change to the journal.
+    bool flush();
+
+    /// Writes the live entries to a new journal, which replaces the current one.
+    bool compact();
+
+#pragma mark Slots
+
+    /// The number of slots, i.e. entries the table file has room for.
+    uint32_t slotCount() const { return (uint32_t)_slots.size(); }
+
+    /// Grows or shrinks the table. Entries in slots past the new count are dropped.
+    void setSlotCount(uint32_t slotCount);
+
+    /// The lowest unoccupied slot, or NotFound if all are occupied.
+    uint32_t freeSlot() const;
+
+    /// The least recently used slot whose image isn't in use, or NotFound.
+    uint32_t evictableSlot() const { return _evictable.tail; }
+
+#pragma mark Entries
+
+    size_t count() const { return _count; }
+
+    /// The slot of an entity's entry, or NotFound.
+    uint32_t slotForEntity(const UUID &entityUUID) const;
+
+    const UUID &entityUUIDAtSlot(uint32_t slot) const { return _slots[slot].entityUUID; }
+    const UUID &sourceImageUUIDAtSlot(uint32_t slot) const { return _slots[slot].sourceImageUUID; }
+
+    /**
+     Stores an entry in `slot`, replacing any entry there and any other entry for the entity, and makes it the most
+     recently used one. Returns false if it couldn't be written to the journal; the entry is stored in memory anyway.
+     */
+    bool setEntry(uint32_t slot, const UUID &entityUUID, const UUID &sourceImageUUID);
+
+    /// Removes the entry in `slot`, if any.
+    bool removeEntryAtSlot(uint32_t slot);
+
+    /// Makes the entry in `slot` the most recently used one.
+    void entryWasAccessed(uint32_t slot);
+
+    /// Keeps the entry in `slot` from being evicted until the use is ended.
+    Use beginUse(uint32_t slot);
+    void endUse(Use use);
+
+#pragma mark Journal
+
+    /// Records in the journal, live or not.
+    size_t journalRecordCount() const { return _journalRecordCount; }
+
+    /// Bytes dropped from the end of the journal when it was opened, e.g. a record torn by a crash.
+    size_t droppedJournalLength() const { return _droppedJournalLength; }
+
+private:
+    struct Slot {
+        UUID entityUUID;
+        UUID sourceImageUUID;
+        uint32_t previous;
+        uint32_t next;
+        uint32_t useCount;
+        uint32_t generation;
+        bool occupied;
+    };
+
+    struct List {
+        uint32_t head = NotFound;
+        uint32_t tail = NotFound;
+    };
+
+    List &listOfSlot(uint32_t slot) { return _slots[slot].useCount > 0 ? _inUse : _evictable; }
+    void unlink(List &list, uint32_t slot);
+    void pushFront(List &list, uint32_t slot);
+
+    void apply(const Record &record);
+    void insertEntry(uint32_t slot, const UUID &entityUUID, const UUID &sourceImageUUID);
+    void eraseEntry(uint32_t slot);
+    void moveToFront(uint32_t slot);
+    void setSlotFree(uint32_t slot, bool free);
+
+    static size_t hash(const UUID &uuid);
+    void rehash(size_t capacity);
+    void insertIntoTable(uint32_t slot);
+    void eraseFromTable(uint32_t slot);
+
+    /// Writes the pending accesses, then `record` if not null.
+    bool append(const Record *record);
+    bool writeJournal(const std::string &path, int *fileDescriptor);
+    void compactIfNeeded();
+
+    std::vector<Slot> _slots;
+    size_t _count = 0;
+    List _evictable;
+    List _inUse;
+    /// A bit per slot, set if the slot is unoccupied.
+    std::vector<uint64_t> _freeSlots;
+
+    /// Open addressing over slot indexes, linear probing, at most half full. Empty buckets are NotFound.
+    std::vector<uint32_t> _table;
+    size_t _tableMask = 0;
+
+    std::string _path;
+    std::string _userData;
+    int _fileDescriptor = -1;
+    size_t _journalRecordCount = 0;
+    size_t _droppedJournalLength = 0;
+    /// Accesses not yet in the journal, in order.
+    std::vector<uint32_t> _pendingAccesses;
+};
+
+} // namespace FIC
@@ -0,0 +1,187 @@
+//
+//  FICImageTableMapping.cpp
+//  FastImageCache
+//
+//  Copyright (c) 2013 Path, Inc.
+//  See LICENSE for full license agreement.
+//
+
+#include "FICImageTableMapping.h"
+
+#include <algorithm>
+#include <sys/mman.h>
+#include <unistd.h>
+
+namespace FIC {
+
+// mincore takes a char vector on Darwin and an unsigned char one elsewhere.
+template <typename Address, typename Vector>
+static int Mincore(int (*function)(Address, size_t, Vector *), void *bytes, size_t length, std::vector<unsigned char> &vector) {
+    return function((Address)bytes, length, (Vector *)vector.data());
+}
+
+ImageTableMapping::ImageTableMapping(int fileDescriptor, size_t chunkLength, size_t reservedChunkCount)
+    : _fileDescriptor(fileDescriptor), _chunkLength(chunkLength), _reservedChunkCount(reservedChunkCount) {}
+
+ImageTableMapping::~ImageTableMapping() {
+    if (_bytes != nullptr) {
+        munmap(_bytes, _mappedLength);
+    }
+    for (const Region &region : _retiredRegions) {
+        munmap(region.bytes, region.length);
+    }
+}
+
+size_t ImageTableMapping::pageSize() {
+    static const size_t pageSize = (size_t)getpagesize();
+    return pageSize;
+}
+
+bool ImageTableMapping::setFileLength(size_t fileLength) {
+    _fileLength = fileLength;
+    if (_chunkLength == 0) {
+        return _bytes != nullptr || fileLength == 0;
+    }
+
+    // Count uses of every chunk of the file, mapped or not: chunks that map their own portion of the file, when it
+    // couldn't be mapped whole, are only dropped once nothing uses them.
+    size_t chunkCount = (fileLength + _chunkLength - 1) / _chunkLength;
+    if (_useCounts.size() < chunkCount) {
+        _useCounts.resize(chunkCount, 0);
+    }
+    if (fileLength <= _mappedLength) {
+        return _bytes != nullptr || fileLength == 0;
+    }
+
+    // Leave room to grow, so a table that outgrows its maximum count isn't mapped again for every chunk.
+    size_t mappedChunkCount = this->mappedChunkCount();
+    chunkCount = std::max(chunkCount, std::max(_reservedChunkCount, mappedChunkCount + mappedChunkCount / 2));
+
+    size_t length = chunkCount * _chunkLength;
+    void *bytes = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_FILE | MAP_SHARED, _fileDescriptor, 0);
+    if (bytes == MAP_FAILED) {
+        return false;
+    }
+    madvise(bytes, length, MADV_RANDOM);
+
+    if (_bytes != nullptr) {
+        _retiredRegions.push_back({_bytes, _mappedLength});
+    }
+    _bytes = (uint8_t *)bytes;
+    _mappedLength = length;
+    _useCounts.resize(std::max(_useCounts.size(), chunkCount), 0);
+    return true;
+}
+
+uint8_t *ImageTableMapping::chunkBytes(size_t chunk) const {
+    return chunk < mappedChunkCount() ? _bytes + chunk * _chunkLength : nullptr;
+}
+
+#pragma mark - Uses
+
+void ImageTableMapping::beginUse(size_t chunk) {
+    if (chunk >= _useCounts.size()) {
+        _useCounts.resize(chunk + 1, 0);
+    }
+    _useCounts[chunk]++;
+}
+
+void ImageTableMapping::endUse(size_t chunk) {
+    if (chunk < _useCounts.size() && _useCounts[chunk] > 0) {
+        _useCounts[chunk]--;
+    }
+}
+
+#pragma mark - Advice
+
+bool ImageTableMapping::pageRange(size_t offset, size_t length, uint8_t **bytes, size_t *pageAlignedLength) const {
+    size_t end = std::min(offset + length, std::min(_fileLength, _mappedLength));
+    if (_bytes == nullptr || offset >= end) {
+        return false;
+    }
+
+    size_t pageSize = ImageTableMapping::pageSize();
+    size_t start = offset - offset % pageSize;
+    end = (end + pageSize - 1) / pageSize * pageSize;
+    *bytes = _bytes + start;
+    *pageAlignedLength = end - start;
+    return true;
+}
+
+size_t ImageTableMapping::nonresidentPageCount(uint8_t *bytes, size_t length) const {
+    size_t pageCount = length / pageSize();
+    std::vector<unsigned char> pages(pageCount);
+    if (Mincore(::mincore, bytes, length, pages) != 0) {
+        return 0;
+    }
+    return (size_t)std::count_if(pages.begin(), pages.end(), [](unsigned char page) { return (page & 1) == 0; });
+}
+
+size_t ImageTableMapping::prefetch(size_t offset, size_t length) {
+    uint8_t *bytes;
+    if (!pageRange(offset, length, &bytes, &length)) {
+        return 0;
+    }
+
+    size_t nonresidentPageCount = this->nonresidentPageCount(bytes, length);
+    if (nonresidentPageCount > 0) {
+        madvise(bytes, length, MADV_WILLNEED);
+        _prefetchedPages += nonresidentPageCount;
+    }
+    return nonresidentPageCount;
+}
+
+size_t ImageTableMapping::willAccess(size_t offset, size_t length) {
+    uint8_t *bytes;
+    if (!pageRange(offset, length, &bytes, &length)) {
+        return 0;
+    }
+
+    size_t nonresidentPageCount = this->nonresidentPageCount(bytes, length);
+    _pageFaults += nonresidentPageCount;
+    return nonresidentPageCount;
+}
+
+size_t ImageTableMapping::dropUnusedChunks() {
+    size_t droppedPageCount = 0;
+    size_t chunkCount = std::min(mappedChunkCount(), (_fileLength + _chunkLength - 1) / _chunkLength);
+    for (size_t chunk = 0; chunk < chunkCount; chunk++) {
+        uint8_t *bytes;
+        size_t length;
+        if (_useCounts[chunk] > 0 || !pageRange(chunk * _chunkLength, _chunkLength, &bytes, &length)) {
+            continue;
+        }
+
+        size_t residentPageCount = length / pageSize() - nonresidentPageCount(bytes, length);
+        if (residentPageCount > 0 && madvise(bytes, length, MADV_DONTNEED) == 0) {
+            droppedPageCount += residentPageCount;
+        }
+    }
+    _droppedPages += droppedPageCount;
+    return droppedPageCount;
+}
+
+#pragma mark - Statistics
+
+size_t ImageTableMapping::residentPageCount(size_t offset, size_t length) const {
+    uint8_t *bytes;
+    if (!pageRange(offset, length, &bytes, &length)) {
+        return 0;
+    }
+    return length / pageSize() - nonresidentPageCount(bytes, length);
+}
+
+ImageTableMapping::Statistics ImageTableMapping::statistics() const {
+    Statistics statistics;
+    statistics.mappedLength = _mappedLength;
+    for (const Region &region : _retiredRegions) {
+        statistics.mappedLength += region.length;
+    }
+    statistics.residentLength = residentPageCount(0, _fileLength) * pageSize();
+    statistics.pageFaults = _pageFaults;
+    statistics.prefetchedPages = _prefetchedPages;
+    statistics.droppedPages = _droppedPages;
+    return statistics;
+}
+
+} // namespace FIC
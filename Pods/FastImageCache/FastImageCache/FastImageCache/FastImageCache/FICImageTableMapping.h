@@ -0,0 +1,129 @@
+//
+//  FICImageTableMapping.h
+//  FastImageCache
+//
+//  Copyright (c) 2013 Path, Inc.
+//  See LICENSE for full license agreement.
+//
+
+#pragma once
+
+// Plain C++ and POSIX, without Foundation, so the mapping can be built and tested against real files on any platform.
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace FIC {
+
+/**
+ A single mapping of a whole image table file, split into fixed-size chunks.
+
+ - The file is mapped once, with room for the chunks the table is expected to grow to, rather than a mapping per chunk
+   being made and torn down as entries come and go. The mapping is advised MADV_RANDOM: entries are read one at a time,
+   so reading ahead of them only pulls in images nobody asked for.
+ - Chunks are looked up by index in flat arrays. Each has a count of the entry images using it, whether or not the
+   chunk is in the mapping.
+ - Entries about to be shown can be prefetched with MADV_WILLNEED, so their pages are read in before they're drawn.
+ - Under memory pressure, chunks no image uses are advised MADV_DONTNEED, which gives their pages back to the system.
+   The file keeps their contents, so they're read in again when next used.
+ - Page faults are estimated with mincore: the pages of an entry that aren't resident when it is read or drawn into are
+   the pages that fault.
+
+ If the table outgrows the mapping, the file is mapped again, larger. Earlier mappings stay valid until the mapping is
+ destroyed, since images may still point into them.
+
+ Not thread safe: FICImageTable calls it with its lock held.
+ */
+class ImageTableMapping {
+public:
+    struct Statistics {
+        /// Address space mapped for the table, in bytes.
+        size_t mappedLength;
+        /// Bytes of the table file that are resident.
+        size_t residentLength;
+        /// Pages that weren't resident when their entry was read or drawn into.
+        uint64_t pageFaults;
+        /// Pages that weren't resident when their entry was prefetched.
+        uint64_t prefetchedPages;
+        /// Resident pages given back under memory pressure.
+        uint64_t droppedPages;
+    };
+
+    /// Maps nothing until the file length is set.
+    ImageTableMapping(int fileDescriptor, size_t chunkLength, size_t reservedChunkCount);
+    ~ImageTableMapping();
+
+    ImageTableMapping(const ImageTableMapping &) = delete;
+    ImageTableMapping &operator=(const ImageTableMapping &) = delete;
+
+    static size_t pageSize();
+
+    size_t chunkLength() const { return _chunkLength; }
+
+    /// Chunks the current mapping has room for.
+    size_t mappedChunkCount() const { return _mappedLength / _chunkLength; }
+
+    /**
+     Records the length of the file, mapping it again if it grew past the mapping. Pages past the end of the file must not
+     be touched. Returns false if the file couldn't be mapped; chunks then have no bytes.
+     */
+    bool setFileLength(size_t fileLength);
+
+    size_t fileLength() const { return _fileLength; }
+
+    /// The start of a chunk in the current mapping, or null if the chunk isn't mapped.
+    uint8_t *chunkBytes(size_t chunk) const;
+
+#pragma mark Uses
+
+    void beginUse(size_t chunk);
+    void endUse(size_t chunk);
+    uint32_t useCount(size_t chunk) const { return chunk < _useCounts.size() ? _useCounts[chunk] : 0; }
+
+#pragma mark Advice
+
+    /// Asks for a range of the file to be read in. Returns the pages that weren't resident.
+    size_t prefetch(size_t offset, size_t length);
+
+    /// Records that a range of the file is about to be read or written. Returns the pages that will fault.
+    size_t willAccess(size_t offset, size_t length);
+
+    /// Gives back the pages of chunks no image uses. Returns the resident pages dropped.
+    size_t dropUnusedChunks();
+
+#pragma mark Statistics
+
+    /// Resident pages in a range of the file.
+    size_t residentPageCount(size_t offset, size_t length) const;
+
+    Statistics statistics() const;
+
+private:
+    struct Region {
+        uint8_t *bytes;
+        size_t length;
+    };
+
+    /// Clamps a range to the file and widens it to whole pages. Returns false if nothing is left.
+    bool pageRange(size_t offset, size_t length, uint8_t **bytes, size_t *pageAlignedLength) const;
+    size_t nonresidentPageCount(uint8_t *bytes, size_t length) const;
+
+    int _fileDescriptor;
+    size_t _chunkLength;
+    size_t _reservedChunkCount;
+    size_t _fileLength = 0;
+
+    uint8_t *_bytes = nullptr;
+    size_t _mappedLength = 0;
+    /// Earlier, smaller mappings, kept for images that still point into them.
+    std::vector<Region> _retiredRegions;
+
+    std::vector<uint32_t> _useCounts;
+
+    uint64_t _pageFaults = 0;
+    uint64_t _prefetchedPages = 0;
+    uint64_t _droppedPages = 0;
+};
+
+} // namespace FIC
@@ -0,0 +1,343 @@
+//
+//  FICImageTableIndexTests.cpp
+//  FastImageCache
+//
+//  Copyright (c) 2013 Path, Inc.
+//  See LICENSE for full license agreement.
+//
+
+// Tests FIC::ImageTableIndex against real journal files: random changes checked against a reference model, reopening
+// (which replays the journal through mmap), compaction, and recovery from torn and corrupted records. Then times
+// journaled changes against an index in memory only.
+//
+//   g++ -std=c++14 -O2 -Wno-unknown-pragmas -I../FastImageCache/FastImageCache/FastImageCache ../FastImageCache/FastImageCache/FastImageCache/FICImageTableIndex.cpp FICImageTableIndexTests.cpp -o index_tests && ./index_tests
+
+#include "FICImageTableIndex.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+using FIC::ImageTableIndex;
+
+namespace {
+
+int failures = 0;
+
+void expect(bool condition, const char *description) {
+    if (!condition) {
+        std::printf("FAILED: %s\n", description);
+        failures++;
+    }
+}
+
+FIC::UUID UUIDWithNumber(uint32_t number) {
+    FIC::UUID uuid = {};
+    memcpy(uuid.bytes, &number, sizeof(number));
+    uuid.bytes[15] = 1;
+    return uuid;
+}
+
+uint32_t numberOfUUID(const FIC::UUID &uuid) {
+    uint32_t number;
+    memcpy(&number, uuid.bytes, sizeof(number));
+    return number;
+}
+
+size_t fileLength(const std::string &path) {
+    struct stat fileStatus;
+    return stat(path.c_str(), &fileStatus) == 0 ? (size_t)fileStatus.st_size : 0;
+}
+
+// The journal layout, from FICImageTableIndex.cpp (Record is only declared in the header)
+const size_t JournalHeaderLength = 16;
+const size_t RecordLength = 48;
+const std::string UserData = "format";
+
+/// What the index should contain: the slot of each entity, and the entities from most to least recently used.
+struct Model {
+    std::map<uint32_t, uint32_t> slotOfEntity;
+    std::vector<uint32_t> recentlyUsed;
+
+    void remove(uint32_t entity) {
+        slotOfEntity.erase(entity);
+        recentlyUsed.erase(std::find(recentlyUsed.begin(), recentlyUsed.end(), entity));
+    }
+
+    void touch(uint32_t entity) {
+        auto it = std::find(recentlyUsed.begin(), recentlyUsed.end(), entity);
+        if (it != recentlyUsed.end()) {
+            recentlyUsed.erase(it);
+        }
+        recentlyUsed.insert(recentlyUsed.begin(), entity);
+    }
+
+    void set(uint32_t entity, uint32_t slot) {
+        for (const auto &entry : slotOfEntity) {
+            if (entry.second == slot && entry.first != entity) {
+                remove(entry.first);
+                break;
+            }
+        }
+        slotOfEntity[entity] = slot;
+        touch(entity);
+    }
+};
+
+bool matches(const ImageTableIndex &index, const Model &model) {
+    if (index.count() != model.slotOfEntity.size()) {
+        return false;
+    }
+    for (const auto &entry : model.slotOfEntity) {
+        const uint32_t slot = index.slotForEntity(UUIDWithNumber(entry.first));
+        if (slot != entry.second || index.sourceImageUUIDAtSlot(slot) != UUIDWithNumber(entry.first + 1000)) {
+            return false;
+        }
+    }
+    if (model.recentlyUsed.empty()) {
+        return index.evictableSlot() == ImageTableIndex::NotFound;
+    }
+    return index.evictableSlot() != ImageTableIndex::NotFound && numberOfUUID(index.entityUUIDAtSlot(index.evictableSlot())) == model.recentlyUsed.back();
+}
+
+/// Checks the whole eviction order, by beginning a use of each evictable entry in turn. Ends the uses again.
+bool evictsInOrder(ImageTableIndex &index, const Model &model) {
+    std::vector<ImageTableIndex::Use> uses;
+    bool ordered = true;
+    for (auto it = model.recentlyUsed.rbegin(); it != model.recentlyUsed.rend() && ordered; ++it) {
+        const uint32_t slot = index.evictableSlot();
+        ordered = slot != ImageTableIndex::NotFound && numberOfUUID(index.entityUUIDAtSlot(slot)) == *it;
+        if (ordered) {
+            uses.push_back(index.beginUse(slot));
+        }
+    }
+    ordered = ordered && index.evictableSlot() == ImageTableIndex::NotFound;
+    for (const ImageTableIndex::Use &use : uses) {
+        index.endUse(use);
+    }
+    return ordered;
+}
+
+/// A random change: store (evicting if full), access or remove an entry.
+void randomChange(ImageTableIndex &index, Model &model, std::mt19937 &random) {
+    const uint32_t entity = random() % 200;
+    const uint32_t operation = random() % 10;
+    uint32_t slot = index.slotForEntity(UUIDWithNumber(entity));
+    if (operation < 5) {
+        if (slot == ImageTableIndex::NotFound) {
+            slot = index.freeSlot();
+        }
+        if (slot == ImageTableIndex::NotFound) {
+            slot = index.evictableSlot();
+        }
+        index.setEntry(slot, UUIDWithNumber(entity), UUIDWithNumber(entity + 1000));
+        model.set(entity, slot);
+    } else if (slot != ImageTableIndex::NotFound && operation < 8) {
+        index.entryWasAccessed(slot);
+        model.touch(entity);
+    } else if (slot != ImageTableIndex::NotFound) {
+        index.removeEntryAtSlot(slot);
+        model.remove(entity);
+    }
+}
+
+void testJournalAndReopen(const std::string &path) {
+    std::mt19937 random(3);
+    Model model;
+    size_t largestJournal = 0;
+    bool compacted = false;
+    bool consistent = true;
+
+    for (int round = 0; round < 8 && consistent; round++) {
+        ImageTableIndex index;
+        expect(index.open(path), "the journal opens");
+        if (round == 0) {
+            index.reset(UserData);
+        }
+        expect(index.userData() == UserData, "the user data survives reopening");
+        expect(index.droppedJournalLength() == 0, "a cleanly closed journal has nothing to drop");
+        index.setSlotCount(64);
+        consistent = matches(index, model) && evictsInOrder(index, model);
+
+        for (int step = 0; step < 5000 && consistent; step++) {
+            const size_t recordCount = index.journalRecordCount();
+            randomChange(index, model, random);
+            consistent = matches(index, model);
+            compacted = compacted || index.journalRecordCount() < recordCount;
+            largestJournal = std::max(largestJournal, index.journalRecordCount());
+        }
+        index.flush();
+        expect(fileLength(path) == JournalHeaderLength + UserData.size() + index.journalRecordCount() * RecordLength,
+               "the journal file holds the header, the user data and every record");
+    }
+    expect(consistent, "entries and eviction order match the model, across reopens");
+    expect(compacted, "the journal was compacted");
+    // Compaction starts at 256 records, or at twice the live entries (at most 64) once past that
+    expect(largestJournal <= 256 + 256, "compaction keeps the journal bounded");
+
+    {
+        ImageTableIndex index;
+        index.open(path);
+        index.setSlotCount(64);
+        index.compact();
+        expect(index.journalRecordCount() == index.count(), "a compacted journal holds one record per entry");
+    }
+    ImageTableIndex index;
+    index.open(path);
+    index.setSlotCount(64);
+    expect(matches(index, model) && evictsInOrder(index, model), "a compacted journal replays the same entries in the same order");
+    std::printf("journal: 40000 random changes over 8 reopens match the model\n");
+}
+
+void testDamagedJournal(const std::string &path) {
+    Model model;
+    {
+        ImageTableIndex index;
+        index.open(path);
+        index.reset(UserData);
+        index.setSlotCount(8);
+        for (uint32_t entity = 0; entity < 6; entity++) {
+            index.setEntry(entity, UUIDWithNumber(entity), UUIDWithNumber(entity + 1000));
+            model.set(entity, entity);
+        }
+    }
+
+    // A crash in the middle of appending a record
+    const size_t intactLength = fileLength(path);
+    {
+        ImageTableIndex index;
+        index.open(path);
+        index.setEntry(6, UUIDWithNumber(6), UUIDWithNumber(1006));
+    }
+    expect(truncate(path.c_str(), (off_t)(intactLength + RecordLength - 10)) == 0, "truncates the journal");
+    {
+        ImageTableIndex index;
+        expect(index.open(path), "a torn journal opens");
+        expect(index.droppedJournalLength() == RecordLength - 10, "the torn record is dropped");
+        expect(fileLength(path) == intactLength, "the torn record is cut off the file");
+        expect(matches(index, model), "the entries come back as of the last complete record");
+    }
+
+    // A damaged record in the middle drops everything from it on
+    const off_t thirdRecord = (off_t)(JournalHeaderLength + UserData.size() + 2 * RecordLength);
+    int fileDescriptor = open(path.c_str(), O_RDWR);
+    uint8_t byte = 0;
+    expect(pread(fileDescriptor, &byte, 1, thirdRecord + 20) == 1, "reads the journal");
+    byte ^= 0x40;
+    expect(pwrite(fileDescriptor, &byte, 1, thirdRecord + 20) == 1, "corrupts the journal");
+    close(fileDescriptor);
+    {
+        ImageTableIndex index;
+        expect(index.open(path), "a corrupted journal opens");
+        expect(index.droppedJournalLength() == 4 * RecordLength, "records from the corrupted one on are dropped");
+        expect(index.count() == 2 && index.slotForEntity(UUIDWithNumber(1)) == 1 && index.slotForEntity(UUIDWithNumber(2)) == ImageTableIndex::NotFound,
+               "the entries before the corrupted record are kept");
+    }
+
+    // A damaged header starts over
+    fileDescriptor = open(path.c_str(), O_RDWR);
+    const uint32_t garbage = 0xdeadbeef;
+    expect(pwrite(fileDescriptor, &garbage, sizeof(garbage), 0) == sizeof(garbage), "corrupts the header");
+    close(fileDescriptor);
+    {
+        ImageTableIndex index;
+        expect(index.open(path), "a journal with a damaged header opens");
+        expect(index.count() == 0 && index.userData().empty(), "a damaged header empties the index");
+    }
+    std::printf("journal: torn and corrupted records are dropped\n");
+}
+
+void testUses() {
+    ImageTableIndex index;
+    index.setSlotCount(4);
+    index.setEntry(0, UUIDWithNumber(1), UUIDWithNumber(2));
+    const ImageTableIndex::Use use = index.beginUse(0);
+    expect(index.evictableSlot() == ImageTableIndex::NotFound, "an entry in use isn't evictable");
+
+    // Replacing the entry starts a new generation; ending the old use doesn't release the new entry's uses.
+    index.setEntry(0, UUIDWithNumber(3), UUIDWithNumber(4));
+    index.endUse(use);
+    expect(index.evictableSlot() == 0, "a replaced entry is evictable");
+    const ImageTableIndex::Use newUse = index.beginUse(0);
+    index.endUse(use);
+    expect(index.evictableSlot() == ImageTableIndex::NotFound, "a stale use can't end a current one");
+    index.endUse(newUse);
+    expect(index.evictableSlot() == 0, "ending the current use makes the entry evictable");
+
+    index.setSlotCount(2);
+    index.setEntry(1, UUIDWithNumber(5), UUIDWithNumber(6));
+    expect(index.freeSlot() == ImageTableIndex::NotFound, "a full table has no free slot");
+    index.removeEntryAtSlot(0);
+    expect(index.freeSlot() == 0, "free slots are handed out lowest first");
+}
+
+double microsecondsPerOperation(std::chrono::steady_clock::time_point start, int operations) {
+    return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() / operations;
+}
+
+void benchmark(const std::string &path) {
+    // 2000 slots, 4000 entities: half of the lookups miss and store an entry over the least recently used one.
+    const int operationCount = 200000;
+    for (bool journaled : {false, true}) {
+        std::mt19937 random(1);
+        ImageTableIndex index;
+        if (journaled) {
+            unlink(path.c_str());
+            index.open(path);
+            index.reset(UserData);
+        }
+        index.setSlotCount(2000);
+        int stores = 0;
+        const auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < operationCount; i++) {
+            const uint32_t entity = random() % 4000;
+            uint32_t slot = index.slotForEntity(UUIDWithNumber(entity));
+            if (slot != ImageTableIndex::NotFound) {
+                index.entryWasAccessed(slot);
+                continue;
+            }
+            slot = index.freeSlot();
+            if (slot == ImageTableIndex::NotFound) {
+                slot = index.evictableSlot();
+            }
+            index.setEntry(slot, UUIDWithNumber(entity), UUIDWithNumber(entity + 1000));
+            stores++;
+        }
+        index.flush();
+        std::printf("%-10s %.3fus per lookup (%d stores)\n", journaled ? "journaled" : "in memory", microsecondsPerOperation(start, operationCount), stores);
+    }
+}
+
+} // namespace
+
+int main() {
+    char directory[] = "/tmp/FICImageTableIndexTests.XXXXXX";
+    if (mkdtemp(directory) == NULL) {
+        std::printf("FAILED: can't create a temporary directory\n");
+        return EXIT_FAILURE;
+    }
+    const std::string path = std::string(directory) + "/index.journal";
+
+    testJournalAndReopen(path);
+    unlink(path.c_str());
+    testDamagedJournal(path);
+    testUses();
+    benchmark(path);
+
+    unlink(path.c_str());
+    rmdir(directory);
+    if (failures > 0) {
+        return EXIT_FAILURE;
+    }
+    std::printf("OK\n");
+    return EXIT_SUCCESS;
+}
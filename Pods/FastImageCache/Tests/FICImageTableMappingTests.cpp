@@ -0,0 +1,152 @@
+//
+//  FICImageTableMappingTests.cpp
+//  FastImageCache
+//
+//  Copyright (c) 2013 Path, Inc.
+//  See LICENSE for full license agreement.
+//
+
+// Tests FIC::ImageTableMapping against real files: chunks of the whole-file mapping, growing past it while earlier
+// mappings stay valid, and use counts. Use counts are checked both with the file mapped and in the fallback
+// FICImageTable takes when it can't be, where chunks map their own portion of the file and are dropped by
+// -_entryWasDeallocatedFromChunk: once their use count is back to 0.
+//
+//   g++ -std=c++14 -O2 -Wno-unknown-pragmas -I../FastImageCache/FastImageCache/FastImageCache ../FastImageCache/FastImageCache/FastImageCache/FICImageTableMapping.cpp FICImageTableMappingTests.cpp -o mapping_tests && ./mapping_tests
+
+#include "FICImageTableMapping.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <fcntl.h>
+#include <unistd.h>
+
+using FIC::ImageTableMapping;
+
+namespace {
+
+int failures = 0;
+
+void expect(bool condition, const char *description) {
+    if (!condition) {
+        std::printf("FAILED: %s\n", description);
+        failures++;
+    }
+}
+
+const size_t ChunkLength = ImageTableMapping::pageSize() * 4;
+
+// FICImageTable drops a chunk that maps its own portion of the file when the last entry using it is deallocated.
+bool chunkWouldBeDropped(const ImageTableMapping &mapping, size_t chunk) {
+    return mapping.useCount(chunk) == 0 && mapping.chunkBytes(chunk) == nullptr;
+}
+
+void testMappedFile(const std::string &path) {
+    int fileDescriptor = open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+    expect(fileDescriptor >= 0, "the table file opens");
+    ImageTableMapping mapping(fileDescriptor, ChunkLength, 2);
+    expect(mapping.chunkBytes(0) == nullptr, "nothing is mapped before the file length is set");
+
+    expect(ftruncate(fileDescriptor, (off_t)(ChunkLength * 2)) == 0, "the file grows");
+    expect(mapping.setFileLength(ChunkLength * 2), "the file maps");
+    expect(mapping.mappedChunkCount() == 2, "the reserved chunks are mapped");
+    uint8_t *firstChunk = mapping.chunkBytes(0);
+    expect(firstChunk != nullptr && mapping.chunkBytes(1) == firstChunk + ChunkLength, "chunks are views into one mapping");
+    expect(mapping.chunkBytes(2) == nullptr, "chunks past the mapping have no bytes");
+    std::memset(firstChunk, 0x5a, ChunkLength);
+
+    mapping.beginUse(0);
+    mapping.beginUse(0);
+    mapping.endUse(0);
+    expect(mapping.useCount(0) == 1, "uses are counted per chunk");
+    expect(!chunkWouldBeDropped(mapping, 0), "a chunk in the mapping is never dropped");
+
+    // Growing past the mapping maps the file again, larger, and keeps the old mapping for images pointing into it
+    expect(ftruncate(fileDescriptor, (off_t)(ChunkLength * 3)) == 0, "the file grows");
+    expect(mapping.setFileLength(ChunkLength * 3), "the grown file maps");
+    expect(mapping.mappedChunkCount() == 3, "the mapping grows to the file");
+    expect(mapping.chunkBytes(0) != nullptr && mapping.chunkBytes(0)[0] == 0x5a, "the new mapping shows the file");
+    expect(firstChunk[ChunkLength - 1] == 0x5a, "the old mapping stays valid");
+    expect(mapping.useCount(0) == 1, "uses survive mapping again");
+    expect(mapping.statistics().mappedLength == ChunkLength * 5, "both mappings are accounted for");
+
+    mapping.endUse(0);
+    mapping.endUse(0);
+    expect(mapping.useCount(0) == 0, "use counts don't go below 0");
+
+    // Once the file can't be mapped again, the chunks past the mapping fall back, and still have their uses counted
+    int duplicate = dup(fileDescriptor);
+    ImageTableMapping failing(duplicate, ChunkLength, 1);
+    expect(failing.setFileLength(ChunkLength), "the file maps");
+    close(duplicate);
+    expect(!failing.setFileLength(ChunkLength * 3), "a closed file can't be mapped again");
+    expect(failing.chunkBytes(0) != nullptr, "the earlier mapping is kept");
+    expect(failing.chunkBytes(2) == nullptr, "chunks the file grew by have no bytes");
+    failing.beginUse(2);
+    failing.beginUse(2);
+    failing.endUse(2);
+    expect(failing.useCount(2) == 1, "chunks the file grew by have their uses counted");
+    expect(!chunkWouldBeDropped(failing, 2), "a fallback chunk in use is kept");
+    failing.endUse(2);
+    expect(chunkWouldBeDropped(failing, 2), "a fallback chunk is dropped once unused");
+    // Only the mapped chunk is given back, and the file keeps its contents
+    failing.dropUnusedChunks();
+    expect(failing.chunkBytes(0)[0] == 0x5a, "a dropped chunk is read in again from the file");
+
+    close(fileDescriptor);
+}
+
+void testUnmappableFile(const std::string &path) {
+    // A file opened read only can't be mapped shared and writable, like a table whose mmap fails
+    int fileDescriptor = open(path.c_str(), O_RDONLY);
+    expect(fileDescriptor >= 0, "the table file opens");
+    ImageTableMapping mapping(fileDescriptor, ChunkLength, 4);
+
+    expect(!mapping.setFileLength(ChunkLength * 3), "the file doesn't map");
+    expect(mapping.mappedChunkCount() == 0 && mapping.chunkBytes(0) == nullptr, "no chunk has bytes");
+
+    // Three entries of chunk 1 are alive; each deallocation checks whether the chunk can be dropped
+    for (int entry = 0; entry < 3; entry++) {
+        mapping.beginUse(1);
+    }
+    expect(mapping.useCount(1) == 3, "fallback chunks have their uses counted");
+    for (int entry = 0; entry < 3; entry++) {
+        mapping.endUse(1);
+        const bool lastEntry = entry == 2;
+        expect(chunkWouldBeDropped(mapping, 1) == lastEntry, "a fallback chunk is dropped with its last entry only");
+    }
+
+    // Entries past the counts, e.g. in a chunk the file grew by since, are counted too
+    mapping.beginUse(7);
+    expect(mapping.useCount(7) == 1, "chunks past the file have their uses counted");
+    expect(!chunkWouldBeDropped(mapping, 7), "a chunk past the file in use is kept");
+    mapping.endUse(7);
+    expect(chunkWouldBeDropped(mapping, 7), "a chunk past the file is dropped once unused");
+
+    expect(mapping.dropUnusedChunks() == 0, "nothing mapped, nothing dropped");
+    expect(mapping.statistics().mappedLength == 0, "nothing is mapped");
+    close(fileDescriptor);
+}
+
+} // namespace
+
+int main() {
+    char directory[] = "/tmp/FICImageTableMappingTests.XXXXXX";
+    if (mkdtemp(directory) == NULL) {
+        std::printf("FAILED: can't create a temporary directory\n");
+        return EXIT_FAILURE;
+    }
+    const std::string path = std::string(directory) + "/table.imageTable";
+
+    testMappedFile(path);
+    testUnmappableFile(path);
+
+    unlink(path.c_str());
+    rmdir(directory);
+    if (failures > 0) {
+        return EXIT_FAILURE;
+    }
+    std::printf("OK\n");
+    return EXIT_SUCCESS;
+}
@@ -92,6 +92,7 @@
 #import "ASElementMap.h"
 #import "ASGraphicsContext.h"
 #import "ASHashing.h"
+#import "ASLayoutMemoCache.h"
 #import "ASHighlightOverlayLayer.h"
 #import "ASImageContainerProtocolCategories.h"
 #import "ASImageProtocols.h"
@@ -1917,6 +1917,11 @@ static NSString * const kReuseIdentifier = @"_ASCollectionReuseIdentifier";
   return NO; // ASCellLayoutModeNone
 }
 
+- (NSArray<NSIndexPath *> *)indexPathsForVisibleItemsInDataController:(ASDataController *)dataController
+{
+  return self.indexPathsForVisibleItems;
+}
+
 - (BOOL)dataControllerShouldSerializeNodeCreation:(ASDataController *)dataController
 {
   return ASCellLayoutModeIncludes(ASCellLayoutModeSerializeNodeCreation);
@@ -125,6 +125,7 @@ ASLayoutElementStyleExtensibilityForwarding
 
 - (ASPrimitiveTraitCollection)primitiveTraitCollection
 {
+  ASDisplayNodeNoteTraitCollectionRead();
   AS::MutexLocker l(__instanceLock__);
   return _primitiveTraitCollection;
 }
@@ -214,6 +215,34 @@ ASLayoutElementStyleExtensibilityForwarding
   return _calculatedDisplayNodeLayout.constrainedSize;
 }
 
+- (BOOL)_hasValidLayoutForConstrainedSize:(ASSizeRange)constrainedSize
+{
+  MutexLocker l(__instanceLock__);
+  const NSUInteger version = _layoutVersion;
+  return _calculatedDisplayNodeLayout.isValid(constrainedSize, constrainedSize.max, version)
+      || _pendingDisplayNodeLayout.isValid(constrainedSize, constrainedSize.max, version);
+}
+
+- (BOOL)_invalidateLayoutsThatReadTraitCollection
+{
+  ASDisplayNodeAssertMainThread();
+  __block BOOL invalidated = NO;
+  ASDisplayNodePerformBlockOnEveryNode(nil, self, NO, ^(ASDisplayNode *node) {
+    if ((node->_atomicFlags.load() & LayoutReadTraitCollection) == 0) {
+      return;
+    }
+    invalidated = YES;
+    // The cached layouts of the ancestors embed this node's layout, so they go too.
+    for (ASDisplayNode *n = node; n != nil && n != self; n = n.supernode) {
+      [n setNeedsLayout];
+    }
+  });
+  if (invalidated) {
+    [self setNeedsLayout];
+  }
+  return invalidated;
+}
+
 @end
 
 #pragma mark -
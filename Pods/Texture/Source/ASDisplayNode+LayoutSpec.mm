@@ -79,7 +79,8 @@
   // Manually propagate the trait collection here so that any layoutSpec children of layoutSpec will get a traitCollection
   {
     AS::SumScopeTimer t(_layoutSpecTotalTime, measureLayoutSpec);
-    ASTraitCollectionPropagateDown(layoutElement, self.primitiveTraitCollection);
+    // Read the ivar directly: propagating isn't a dependency of the layout on the traits.
+    ASTraitCollectionPropagateDown(layoutElement, ASLockedSelf(_primitiveTraitCollection));
   }
 
   BOOL measureLayoutComputation = _measurementOptions & ASDisplayNodePerformanceMeasurementOptionLayoutComputation;
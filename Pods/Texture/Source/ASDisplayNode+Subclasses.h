@@ -163,6 +163,18 @@ AS_CATEGORY_IMPLEMENTABLE
  */
 - (CGSize)calculateSizeThatFits:(CGSize)constrainedSize;
 
+/**
+ * @abstract A key for sharing measurements with equivalent nodes through the layout memo cache.
+ *
+ * @return An immutable object (typically an ASLayoutMemoKey) that, together with the node's class and the resolved
+ * size range, fully determines the node's layout. nil, the default, opts out.
+ *
+ * @discussion Only consulted when ASExperimentalLayoutMemoCache is enabled, and only layouts without sublayouts are
+ * shared. On a hit, -calculateLayoutThatFits: is skipped and the cached ascender and descender are applied to the
+ * node's style. See ASLayoutMemoCache.h.
+ */
+- (nullable id)layoutMemoKey;
+
 /**
  * @abstract Invalidate previously measured and cached layout.
  *
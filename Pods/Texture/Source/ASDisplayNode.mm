@@ -27,7 +27,9 @@
 #import <AsyncDisplayKit/ASEqualityHelpers.h>
 #import <AsyncDisplayKit/ASGraphicsContext.h>
 #import <AsyncDisplayKit/ASInternalHelpers.h>
+#import <AsyncDisplayKit/ASLayoutArena.h>
 #import <AsyncDisplayKit/ASLayoutElementStylePrivate.h>
+#import <AsyncDisplayKit/ASLayoutMemoCache.h>
 #import <AsyncDisplayKit/ASMainThreadDeallocation.h>
 #import <AsyncDisplayKit/ASNodeController+Beta.h>
 #import <AsyncDisplayKit/ASRunLoopQueue.h>
@@ -1051,6 +1053,29 @@ ASSynthesizeLockingMethodsWithMutex(__instanceLock__);
 
 #pragma mark Calculation
 
+/// The node whose layout is being calculated on this thread. Inputs read during the calculation are attributed to it.
+static _Thread_local unowned ASDisplayNode *tls_layoutCalculatingNode;
+
+void ASDisplayNodeNoteTraitCollectionRead(void)
+{
+  unowned ASDisplayNode *node = tls_layoutCalculatingNode;
+  if (node != nil) {
+    node->_atomicFlags.fetch_or(LayoutReadTraitCollection);
+  }
+}
+
+ASDisplayNode *ASDisplayNodeGetLayoutCalculatingNode(void)
+{
+  return tls_layoutCalculatingNode;
+}
+
+ASDisplayNode *ASDisplayNodeSetLayoutCalculatingNode(ASDisplayNode *node)
+{
+  unowned ASDisplayNode *previousNode = tls_layoutCalculatingNode;
+  tls_layoutCalculatingNode = node;
+  return previousNode;
+}
+
 - (ASLayout *)calculateLayoutThatFits:(ASSizeRange)constrainedSize
                      restrictedToSize:(ASLayoutElementSize)size
                  relativeToParentSize:(CGSize)parentSize
@@ -1067,9 +1092,31 @@ ASSynthesizeLockingMethodsWithMutex(__instanceLock__);
   }
 #endif
 
+  // The outermost layout on this thread owns the arena; all stack layouts beneath it share it.
+  AS::ArenaScope arenaScope(ASActivateExperimentalFeature(ASExperimentalLayoutArena));
+
   ASSizeRange styleAndParentSize = ASLayoutElementSizeResolve(self.style.size, parentSize);
   const ASSizeRange resolvedRange = ASSizeRangeIntersect(constrainedSize, styleAndParentSize);
-  ASLayout *result = [self calculateLayoutThatFits:resolvedRange];
+  ASLayout *result = nil;
+  id memoKey = ASActivateExperimentalFeature(ASExperimentalLayoutMemoCache) ? [self layoutMemoKey] : nil;
+  ASLayoutMemoValue memoValue;
+  if (memoKey != nil && ASLayoutMemoCacheLookup([self class], memoKey, resolvedRange, &memoValue)) {
+    ASLayoutElementStyle *style = self.style;
+    style.ascender = memoValue.ascender;
+    style.descender = memoValue.descender;
+    result = [ASLayout layoutWithLayoutElement:self size:memoValue.size];
+  } else {
+    // Track which inputs this calculation reads. A memo hit keeps the flags of the last real calculation.
+    unowned ASDisplayNode *previousCalculatingNode = tls_layoutCalculatingNode;
+    tls_layoutCalculatingNode = self;
+    setFlag(LayoutReadTraitCollection, NO);
+    result = [self calculateLayoutThatFits:resolvedRange];
+    tls_layoutCalculatingNode = previousCalculatingNode;
+    if (memoKey != nil && result != nil && result.sublayouts.count == 0) {
+      ASLayoutElementStyle *style = self.style;
+      ASLayoutMemoCacheStore([self class], memoKey, resolvedRange, {result.size, style.ascender, style.descender});
+    }
+  }
   as_log_verbose(ASLayoutLog(), "Calculated layout %@", result);
 
 #if AS_SIGNPOST_ENABLE
@@ -1081,6 +1128,11 @@ ASSynthesizeLockingMethodsWithMutex(__instanceLock__);
   return result;
 }
 
+- (id)layoutMemoKey
+{
+  return nil;
+}
+
 - (ASLayout *)calculateLayoutThatFits:(ASSizeRange)constrainedSize
 {
   __ASDisplayNodeCheckForLayoutMethodOverrides;
@@ -1297,6 +1349,10 @@ NSString * const ASRenderingEngineDidDisplayNodesScheduledBeforeTimestamp = @"AS
                                                           userInfo:@{ASRenderingEngineDidDisplayNodesScheduledBeforeTimestamp: @(timestamp)}];
       }
     }];
+    if (ASActivateExperimentalFeature(ASExperimentalRunLoopQueueBudget)) {
+      // Display as many nodes per turn as fit in a quarter of a 60Hz frame, rather than one.
+      renderQueue.timeBudget = 0.004;
+    }
   });
 
   as_log_verbose(ASDisplayLog(), "%s %@", sel_getName(_cmd), node);
@@ -3100,6 +3156,7 @@ ASDISPLAYNODE_INLINE BOOL subtreeIsRasterized(ASDisplayNode *node) {
 #endif
   
   DISABLED_ASAssertUnlocked(__instanceLock__);
+  [self _setDisplayOperationVisible:YES];
   [self didEnterVisibleState];
   [self enumerateInterfaceStateDelegates:^(id<ASInterfaceStateDelegate> del) {
     [del didEnterVisibleState];
@@ -3114,6 +3171,7 @@ ASDISPLAYNODE_INLINE BOOL subtreeIsRasterized(ASDisplayNode *node) {
 {
   ASDisplayNodeAssertMainThread();
   DISABLED_ASAssertUnlocked(__instanceLock__);
+  [self _setDisplayOperationVisible:NO];
   [self didExitVisibleState];
   [self enumerateInterfaceStateDelegates:^(id<ASInterfaceStateDelegate> del) {
     [del didExitVisibleState];
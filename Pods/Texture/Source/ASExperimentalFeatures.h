@@ -29,6 +29,15 @@ typedef NS_OPTIONS(NSUInteger, ASExperimentalFeatures) {
   ASExperimentalDrawingGlobal = 1 << 8,                                     // exp_drawing_global
   ASExperimentalOptimizeDataControllerPipeline = 1 << 9,                    // exp_optimize_data_controller_pipeline
   ASExperimentalDoNotCacheAccessibilityElements = 1 << 10,                  // exp_do_not_cache_accessibility_elements
+  ASExperimentalLayoutArena = 1 << 11,                                      // exp_layout_arena
+  ASExperimentalLayoutMemoCache = 1 << 12,                                  // exp_layout_memo_cache
+  ASExperimentalIncrementalRelayout = 1 << 13,                              // exp_incremental_relayout
+  ASExperimentalRunLoopQueueBudget = 1 << 14,                               // exp_run_loop_queue_budget
+  ASExperimentalAdaptiveRanges = 1 << 15,                                   // exp_adaptive_ranges
+  ASExperimentalCoalesceChangeSets = 1 << 16,                               // exp_coalesce_change_sets
+  ASExperimentalViewportPriorityAllocation = 1 << 17,                       // exp_viewport_priority_allocation
+  ASExperimentalLazyMeasurement = 1 << 18,                                  // exp_lazy_measurement
+  ASExperimentalTextWidthReuse = 1 << 19,                                   // exp_text_width_reuse
   ASExperimentalFeatureAll = 0xFFFFFFFF
 };
 
@@ -22,7 +22,16 @@ NSArray<NSString *> *ASExperimentalFeaturesGetNames(ASExperimentalFeatures flags
                                       @"exp_dispatch_apply",
                                       @"exp_drawing_global",
                                       @"exp_optimize_data_controller_pipeline",
-                                      @"exp_do_not_cache_accessibility_elements"]));
+                                      @"exp_do_not_cache_accessibility_elements",
+                                      @"exp_layout_arena",
+                                      @"exp_layout_memo_cache",
+                                      @"exp_incremental_relayout",
+                                      @"exp_run_loop_queue_budget",
+                                      @"exp_adaptive_ranges",
+                                      @"exp_coalesce_change_sets",
+                                      @"exp_viewport_priority_allocation",
+                                      @"exp_lazy_measurement",
+                                      @"exp_text_width_reuse"]));
   if (flags == ASExperimentalFeatureAll) {
     return allNames;
   }
@@ -20,6 +20,26 @@ NS_ASSUME_NONNULL_BEGIN
 @interface ASAbstractRunLoopQueue : NSObject
 @end
 
+#define ASRunLoopQueueHistogramBucketCount 8
+
+/**
+ * Per-turn statistics of an ASRunLoopQueue. Only turns that found items are counted.
+ */
+typedef struct {
+  /** Run loop turns that processed items. */
+  NSUInteger turns;
+  /**
+   * Turns by number of items processed: bucket 0 is 1 item, bucket i is [2^i, 2^(i+1)) items, the last bucket also
+   * holds everything above.
+   */
+  NSUInteger processedCounts[ASRunLoopQueueHistogramBucketCount];
+  /**
+   * Turns that went over the time budget, by how much: bucket 0 is under 0.25ms, bucket i is [0.25 * 2^(i-1),
+   * 0.25 * 2^i) ms, the last bucket also holds everything above. Only with a time budget.
+   */
+  NSUInteger overruns[ASRunLoopQueueHistogramBucketCount];
+} ASRunLoopQueueStatistics;
+
 AS_SUBCLASSING_RESTRICTED
 @interface ASRunLoopQueue<ObjectType> : ASAbstractRunLoopQueue <ASLocking>
 
@@ -44,7 +64,20 @@ AS_SUBCLASSING_RESTRICTED
 @property (readonly) BOOL isEmpty;
 
 @property (nonatomic) NSUInteger batchSize;           // Default == 1.
-@property (nonatomic) BOOL ensureExclusiveMembership; // Default == YES.  Set-like behavior.
+@property (nonatomic) BOOL ensureExclusiveMembership; // Default == YES.  Set-like behavior. O(1) per enqueue.
+
+/**
+ * Time budget of a run loop turn, in seconds. Default == 0, which processes batchSize items per turn.
+ *
+ * @discussion When positive, each turn processes items until the budget is used up (at least one item per turn),
+ * and batchSize is ignored. Whatever is left is processed in the next turn.
+ */
+@property (nonatomic) NSTimeInterval timeBudget;
+
+/// Statistics since creation or the last reset.
+@property (readonly) ASRunLoopQueueStatistics statistics;
+
+- (void)resetStatistics;
 
 @end
 
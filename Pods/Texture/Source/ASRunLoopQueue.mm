@@ -13,6 +13,7 @@
 #import <AsyncDisplayKit/ASRunLoopQueue.h>
 #import <AsyncDisplayKit/ASThread.h>
 #import <AsyncDisplayKit/ASSignpost.h>
+#import <QuartzCore/QuartzCore.h>
 #import <vector>
 
 #define ASRunLoopQueueLoggingEnabled 0
@@ -104,11 +105,48 @@ static void runLoopSourceCallback(void *info) {
 
 #pragma mark - ASRunLoopQueue
 
+namespace {
+
+/**
+ * An enqueued object. The queue holds it strongly or weakly depending on retainsObjects; the address is kept
+ * separately, so it can be unregistered from the membership map after a weak object went away.
+ */
+struct RunLoopQueueEntry {
+  id strongObject;
+  __weak id weakObject;
+  const void *key;
+};
+
+NSUInteger RunLoopQueueBucket(NSUInteger value)
+{
+  NSUInteger bucket = 0;
+  while (value > 1 && bucket < ASRunLoopQueueHistogramBucketCount - 1) {
+    value >>= 1;
+    bucket++;
+  }
+  return bucket;
+}
+
+} // namespace
+
 @interface ASRunLoopQueue () {
   CFRunLoopRef _runLoop;
   CFRunLoopSourceRef _runLoopSource;
   CFRunLoopObserverRef _runLoopObserver;
-  NSPointerArray *_internalQueue; // Use NSPointerArray so we can decide __strong or __weak per-instance.
+  BOOL _retainsObjects;
+
+  // Ring buffer of entries. The capacity is a power of two, _head is the oldest entry, and entries are numbered by
+  // a sequence that only grows (_headSequence is the number of _head).
+  std::vector<RunLoopQueueEntry> _ring;
+  size_t _head;
+  size_t _count;
+  uint64_t _headSequence;
+
+  // Object address -> sequence number of its entry, for exclusive membership.
+  // No retain, no release, pointer hash, pointer equality, like the hash set of ASCATransactionQueue.
+  CFMutableDictionaryRef _membership;
+
+  ASRunLoopQueueStatistics _statistics;
   AS::RecursiveMutex _internalQueueLock;
 
   // In order to not pollute the top-level activities, each queue has 1 root activity.
@@ -129,8 +167,10 @@ static void runLoopSourceCallback(void *info) {
 {
   if (self = [super init]) {
     _runLoop = runloop;
-    NSPointerFunctionsOptions options = retainsObjects ? NSPointerFunctionsStrongMemory : NSPointerFunctionsWeakMemory;
-    _internalQueue = [[NSPointerArray alloc] initWithOptions:options];
+    _retainsObjects = retainsObjects;
+    static constexpr size_t kInitialCapacity = 16;
+    _ring.resize(kInitialCapacity);
+    _membership = CFDictionaryCreateMutable(NULL, 0, NULL, NULL);
     _queueConsumer = handlerBlock;
     _batchSize = 1;
     _ensureExclusiveMembership = YES;
@@ -184,73 +224,153 @@ static void runLoopSourceCallback(void *info) {
   }
   CFRelease(_runLoopObserver);
   _runLoopObserver = nil;
+
+  CFRelease(_membership);
 }
 
 #if ASRunLoopQueueLoggingEnabled
 - (void)checkRunLoop
 {
-    NSLog(@"<%@> - Jobs: %ld", self, _internalQueue.count);
+    NSLog(@"<%@> - Jobs: %ld", self, _count);
 }
 #endif
 
+#pragma mark Ring Buffer
+
+- (RunLoopQueueEntry &)_locked_entryWithSequence:(uint64_t)sequence
+{
+  DISABLED_ASAssertLocked(_internalQueueLock);
+  return _ring[(_head + (size_t)(sequence - _headSequence)) & (_ring.size() - 1)];
+}
+
+- (void)_locked_pushObject:(id)object
+{
+  DISABLED_ASAssertLocked(_internalQueueLock);
+  if (_count == _ring.size()) {
+    // Full: unroll into a buffer twice the size, oldest entry first.
+    std::vector<RunLoopQueueEntry> ring(_ring.size() * 2);
+    for (size_t i = 0; i < _count; i++) {
+      ring[i] = std::move(_ring[(_head + i) & (_ring.size() - 1)]);
+    }
+    _ring.swap(ring);
+    _head = 0;
+  }
+
+  const uint64_t sequence = _headSequence + _count;
+  RunLoopQueueEntry &entry = _ring[(_head + _count) & (_ring.size() - 1)];
+  if (_retainsObjects) {
+    entry.strongObject = object;
+  } else {
+    entry.weakObject = object;
+  }
+  entry.key = (__bridge const void *)object;
+  _count++;
+
+  if (_ensureExclusiveMembership) {
+    CFDictionarySetValue(_membership, entry.key, (const void *)(uintptr_t)sequence);
+  }
+}
+
+/**
+ * Removes the oldest entry. Returns its object, which is nil if it was held weakly and went away.
+ */
+- (id)_locked_popObject
+{
+  DISABLED_ASAssertLocked(_internalQueueLock);
+  ASDisplayNodeAssert(_count > 0, @"Popping from an empty queue");
+  RunLoopQueueEntry &entry = _ring[_head];
+  id object = _retainsObjects ? std::move(entry.strongObject) : entry.weakObject;
+  entry.strongObject = nil;
+  entry.weakObject = nil;
+
+  // Only unregister the address if it still refers to this entry, and not to a newer object at the same address.
+  const void *sequence;
+  if (CFDictionaryGetValueIfPresent(_membership, entry.key, &sequence) && (uint64_t)(uintptr_t)sequence == _headSequence) {
+    CFDictionaryRemoveValue(_membership, entry.key);
+  }
+  entry.key = NULL;
+
+  _head = (_head + 1) & (_ring.size() - 1);
+  _headSequence++;
+  _count--;
+  return object;
+}
+
+/**
+ * Pops entries until one with an object is found, or the queue is empty.
+ */
+- (id)_locked_popNextObject
+{
+  DISABLED_ASAssertLocked(_internalQueueLock);
+  while (_count > 0) {
+    if (id object = [self _locked_popObject]) {
+      return object;
+    }
+  }
+  return nil;
+}
+
+#pragma mark Processing
+
 - (void)processQueue
 {
   BOOL hasExecutionBlock = (_queueConsumer != nil);
+  const NSTimeInterval timeBudget = self.timeBudget;
 
   // If we have an execution block, this vector will be populated, otherwise remains empty.
   // This is to avoid needlessly retaining/releasing the objects if we don't have a block.
   std::vector<id> itemsToProcess;
 
   BOOL isQueueDrained = NO;
+  NSUInteger processedCount = 0;
+  CFTimeInterval startTime = 0;
   {
     MutexLocker l(_internalQueueLock);
 
-    NSInteger internalQueueCount = _internalQueue.count;
     // Early-exit if the queue is empty.
-    if (internalQueueCount == 0) {
+    if (_count == 0) {
       return;
     }
 
     ASSignpostStart(RunLoopQueueBatch, self, "%s", object_getClassName(self));
 
-    // Snatch the next batch of items.
-    NSInteger maxCountToProcess = MIN(internalQueueCount, self.batchSize);
-
-    /**
-     * For each item in the next batch, if it's non-nil then NULL it out
-     * and if we have an execution block then add it in.
-     * This could be written a bunch of different ways but
-     * this particular one nicely balances readability, safety, and efficiency.
-     */
-    NSInteger foundItemCount = 0;
-    for (NSInteger i = 0; i < internalQueueCount && foundItemCount < maxCountToProcess; i++) {
-      /**
-       * It is safe to use unsafe_unretained here. If the queue is weak, the
-       * object will be added to the autorelease pool. If the queue is strong,
-       * it will retain the object until we transfer it (retain it) in itemsToProcess.
-       */
-      unowned id ptr = (__bridge id)[_internalQueue pointerAtIndex:i];
-      if (ptr != nil) {
-        foundItemCount++;
+    if (timeBudget <= 0) {
+      // Snatch the next batch of items.
+      const NSUInteger maxCountToProcess = self.batchSize;
+      while (processedCount < maxCountToProcess) {
+        id object = [self _locked_popNextObject];
+        if (object == nil) {
+          break;
+        }
+        processedCount++;
         if (hasExecutionBlock) {
-          itemsToProcess.push_back(ptr);
+          itemsToProcess.push_back(object);
         }
-        [_internalQueue replacePointerAtIndex:i withPointer:NULL];
       }
+      isQueueDrained = (_count == 0);
     }
+  }
 
-    if (foundItemCount == 0) {
-      // If _internalQueue holds weak references, and all of them just become NULL, then the array
-      // is never marked as needsCompletion, and compact will return early, not removing the NULL's.
-      // Inserting a NULL here ensures the compaction will take place.
-      // See http://www.openradar.me/15396578 and https://stackoverflow.com/a/40274426/1136669
-      [_internalQueue addPointer:NULL];
-    }
-
-    [_internalQueue compact];
-    if (_internalQueue.count == 0) {
-      isQueueDrained = YES;
-    }
+  if (timeBudget > 0) {
+    // Process one item at a time until the budget is used up, so items enqueued meanwhile can still make it.
+    as_activity_scope_verbose(as_activity_create("Process run loop queue batch", _rootActivity, OS_ACTIVITY_FLAG_DEFAULT));
+    startTime = CACurrentMediaTime();
+    do {
+      id object;
+      {
+        MutexLocker l(_internalQueueLock);
+        object = [self _locked_popNextObject];
+        isQueueDrained = (_count == 0);
+      }
+      if (object == nil) {
+        break;
+      }
+      processedCount++;
+      if (hasExecutionBlock) {
+        _queueConsumer(object, isQueueDrained);
+        as_log_verbose(ASDisplayLog(), "processed %@", object);
+      }
+    } while (!isQueueDrained && CACurrentMediaTime() - startTime < timeBudget);
   }
 
   // itemsToProcess will be empty if _queueConsumer == nil so no need to check again.
@@ -263,8 +383,23 @@ static void runLoopSourceCallback(void *info) {
       _queueConsumer(value, isQueueDrained && iterator == itemsEnd - 1);
       as_log_verbose(ASDisplayLog(), "processed %@", value);
     }
-    if (count > 1) {
-      as_log_verbose(ASDisplayLog(), "processed %lu items", (unsigned long)count);
+  }
+  if (processedCount > 1) {
+    as_log_verbose(ASDisplayLog(), "processed %lu items", (unsigned long)processedCount);
+  }
+
+  if (processedCount > 0) {
+    MutexLocker l(_internalQueueLock);
+    _statistics.turns++;
+    _statistics.processedCounts[RunLoopQueueBucket(processedCount)]++;
+    if (timeBudget > 0) {
+      const CFTimeInterval overrun = CACurrentMediaTime() - startTime - timeBudget;
+      if (overrun > 0) {
+        // In units of 0.25ms: bucket 0 is under one unit, bucket i is [2^(i-1), 2^i) units.
+        const NSUInteger units = (NSUInteger)(overrun * 4000.0);
+        const NSUInteger bucket = units == 0 ? 0 : MIN(RunLoopQueueBucket(units) + 1, ASRunLoopQueueHistogramBucketCount - 1);
+        _statistics.overruns[bucket]++;
+      }
     }
   }
 
@@ -274,7 +409,7 @@ static void runLoopSourceCallback(void *info) {
     CFRunLoopWakeUp(_runLoop);
   }
   
-  ASSignpostEnd(RunLoopQueueBatch, self, "count: %d", (int)count);
+  ASSignpostEnd(RunLoopQueueBatch, self, "count: %d", (int)processedCount);
 }
 
 - (void)enqueue:(id)object
@@ -285,23 +420,39 @@ static void runLoopSourceCallback(void *info) {
   
   MutexLocker l(_internalQueueLock);
 
-  // Check if the object exists.
-  BOOL foundObject = NO;
-    
+  // Check if the object exists. The address may also belong to a weak object that went away while queued, in
+  // which case the entry is nil and the object is queued again.
   if (_ensureExclusiveMembership) {
-    for (id currentObject in _internalQueue) {
-      if (currentObject == object) {
-        foundObject = YES;
-        break;
+    const void *sequence;
+    if (CFDictionaryGetValueIfPresent(_membership, (__bridge const void *)object, &sequence)) {
+      RunLoopQueueEntry &entry = [self _locked_entryWithSequence:(uint64_t)(uintptr_t)sequence];
+      if ((_retainsObjects ? entry.strongObject : entry.weakObject) == object) {
+        return;
       }
     }
   }
 
-  if (!foundObject) {
-    [_internalQueue addPointer:(__bridge void *)object];
-    if (_internalQueue.count == 1) {
-      CFRunLoopSourceSignal(_runLoopSource);
-      CFRunLoopWakeUp(_runLoop);
+  [self _locked_pushObject:object];
+  if (_count == 1) {
+    CFRunLoopSourceSignal(_runLoopSource);
+    CFRunLoopWakeUp(_runLoop);
+  }
+}
+
+- (void)setEnsureExclusiveMembership:(BOOL)ensureExclusiveMembership
+{
+  MutexLocker l(_internalQueueLock);
+  if (ensureExclusiveMembership == _ensureExclusiveMembership) {
+    return;
+  }
+  _ensureExclusiveMembership = ensureExclusiveMembership;
+
+  // The map only tracks entries while membership is exclusive.
+  CFDictionaryRemoveAllValues(_membership);
+  if (ensureExclusiveMembership) {
+    for (size_t i = 0; i < _count; i++) {
+      const uint64_t sequence = _headSequence + i;
+      CFDictionarySetValue(_membership, [self _locked_entryWithSequence:sequence].key, (const void *)(uintptr_t)sequence);
     }
   }
 }
@@ -309,7 +460,19 @@ static void runLoopSourceCallback(void *info) {
 - (BOOL)isEmpty
 {
   MutexLocker l(_internalQueueLock);
-  return _internalQueue.count == 0;
+  return _count == 0;
+}
+
+- (ASRunLoopQueueStatistics)statistics
+{
+  MutexLocker l(_internalQueueLock);
+  return _statistics;
+}
+
+- (void)resetStatistics
+{
+  MutexLocker l(_internalQueueLock);
+  _statistics = {};
 }
 
 ASSynthesizeLockingMethodsWithMutex(_internalQueueLock)
@@ -32,6 +32,8 @@
 
 
 static NSString * const kCellReuseIdentifier = @"_ASTableViewCell";
+// With lazy measurement, the rows measured ahead of time on either side of the visible ones, in screenfuls.
+static const CGFloat kASTableViewLazyMeasurementScreenfuls = 2.0;
 
 //#define LOG(...) NSLog(__VA_ARGS__)
 #define LOG(...)
@@ -190,6 +192,18 @@ static NSString * const kCellReuseIdentifier = @"_ASTableViewCell";
 
   CGFloat _nodesConstrainedWidth;
   BOOL _queuedNodeHeightUpdate;
+
+  // Lazy measurement (ASExperimentalLazyMeasurement): rows are sized with estimates until they get close to the screen.
+  BOOL _measuresLazily;
+  // The last measured height of each row still in the table since the last reload, and their sum. Their average is the
+  // estimate for unmeasured rows. Rows are dropped when an update removes them.
+  NSMapTable<ASCollectionElement *, NSNumber *> *_measuredRowHeights;
+  CGFloat _measuredRowHeightTotal;
+  // The content offset around which rows were last measured ahead of time.
+  CGFloat _lazyMeasurementOffset;
+  // The top visible row during -layoutSubviews, and whether a row above it was measured since.
+  NSIndexPath *_lazyMeasurementAnchorIndexPath;
+  BOOL _measuredRowAboveAnchor;
   BOOL _isDeallocating;
   NSHashTable<_ASTableViewCell *> *_cellsForVisibilityUpdates;
   
@@ -316,6 +330,11 @@ static NSString * const kCellReuseIdentifier = @"_ASTableViewCell";
   }
   _cellsForVisibilityUpdates = [NSHashTable hashTableWithOptions:NSHashTableObjectPointerPersonality];
   _cellsForLayoutUpdates = [NSHashTable hashTableWithOptions:NSHashTableObjectPointerPersonality];
+  // Before the delegate is set, as UITableView checks once whether it provides estimated heights.
+  _measuresLazily = ASActivateExperimentalFeature(ASExperimentalLazyMeasurement);
+  if (_measuresLazily) {
+    _measuredRowHeights = [NSMapTable mapTableWithKeyOptions:NSMapTableObjectPointerPersonality valueOptions:NSMapTableStrongMemory];
+  }
   if (!dataControllerClass) {
     dataControllerClass = [[self class] dataControllerClass];
   }
@@ -545,6 +564,10 @@ static NSString * const kCellReuseIdentifier = @"_ASTableViewCell";
     };
   }
   
+  // The old rows say little about the new ones.
+  [_measuredRowHeights removeAllObjects];
+  _measuredRowHeightTotal = 0;
+
   [self beginUpdates];
   [_changeSet reloadData];
   [self endUpdatesWithCompletion:batchUpdatesCompletion];
@@ -774,8 +797,33 @@ static NSString * const kCellReuseIdentifier = @"_ASTableViewCell";
     }
   }
 
+  // With lazy measurement, UIKit replaces the estimated heights of the rows it lays out for the first time. Above the top
+  // visible row, that would shift the content under the user: keep that row where it was instead.
+  NSIndexPath *anchorIndexPath = nil;
+  CGFloat anchorOffset = 0.0;
+  if (_measuresLazily) {
+    anchorIndexPath = [self.indexPathsForVisibleRows sortedArrayUsingSelector:@selector(compare:)].firstObject;
+    if (anchorIndexPath != nil) {
+      anchorOffset = [self rectForRowAtIndexPath:anchorIndexPath].origin.y - self.bounds.origin.y;
+    }
+    _lazyMeasurementAnchorIndexPath = anchorIndexPath;
+    _measuredRowAboveAnchor = NO;
+  }
+
   // To ensure _nodesConstrainedWidth is up-to-date for every usage, this call to super must be done last
   [super layoutSubviews];
+
+  if (anchorIndexPath != nil) {
+    _lazyMeasurementAnchorIndexPath = nil;
+    if (_measuredRowAboveAnchor) {
+      const CGFloat offset = [self rectForRowAtIndexPath:anchorIndexPath].origin.y - self.bounds.origin.y;
+      if (offset != anchorOffset) {
+        CGPoint contentOffset = self.contentOffset;
+        contentOffset.y += offset - anchorOffset;
+        self.contentOffset = contentOffset;
+      }
+    }
+  }
   [_rangeController updateIfNeeded];
 }
 
@@ -935,22 +983,119 @@ static NSString * const kCellReuseIdentifier = @"_ASTableViewCell";
     ASDisplayNodeAssertNotNil(node, @"Node must not be nil!");
     height = [node layoutThatFits:element.constrainedSize].size.height;
   }
-  
+  height = [self _rowHeightForNodeHeight:height];
+
+  if (_measuresLazily && element != nil) {
+    // UITableView asks for the same row many times; each row counts once, with its latest height.
+    NSNumber *previousHeight = [_measuredRowHeights objectForKey:element];
+    if (previousHeight == nil || previousHeight.doubleValue != height) {
+      _measuredRowHeightTotal += height - previousHeight.doubleValue;
+      [_measuredRowHeights setObject:@(height) forKey:element];
+    }
+    if (_lazyMeasurementAnchorIndexPath != nil && [indexPath compare:_lazyMeasurementAnchorIndexPath] == NSOrderedAscending) {
+      _measuredRowAboveAnchor = YES;
+    }
+  }
+  return height;
+}
+
+/// Call after the visible map is updated. Deleted and reloaded rows leave the map, and their old elements with them;
+/// their heights shouldn't skew the estimate, nor should their elements and nodes be kept alive for it.
+- (void)_removeMeasuredRowHeightsOfDeletedRows
+{
+  if (_measuredRowHeights.count == 0) {
+    return;
+  }
+  ASElementMap *map = _dataController.visibleMap;
+  NSMutableArray<ASCollectionElement *> *deletedElements = nil;
+  for (ASCollectionElement *element in _measuredRowHeights) {
+    if ([map indexPathForElement:element] == nil) {
+      if (deletedElements == nil) {
+        deletedElements = [NSMutableArray array];
+      }
+      [deletedElements addObject:element];
+    }
+  }
+  for (ASCollectionElement *element in deletedElements) {
+    _measuredRowHeightTotal -= [_measuredRowHeights objectForKey:element].doubleValue;
+    [_measuredRowHeights removeObjectForKey:element];
+  }
+  if (_measuredRowHeights.count == 0) {
+    // Don't let rounding errors pile up
+    _measuredRowHeightTotal = 0;
+  }
+}
+
+- (CGFloat)_rowHeightForNodeHeight:(CGFloat)height
+{
 #if TARGET_OS_IOS
   /**
-   * Weirdly enough, Apple expects the return value here to _include_ the height
+   * Weirdly enough, Apple expects the return value in tableView:heightForRowAtIndexPath: to _include_ the height
    * of the separator, if there is one! So if our node wants to be 43.5, we need
    * to return 44. UITableView will make a cell of height 44 with a content view
    * of height 43.5.
    */
-  if (tableView.separatorStyle != UITableViewCellSeparatorStyleNone) {
+  if (self.separatorStyle != UITableViewCellSeparatorStyleNone) {
     height += 1.0 / ASScreenScale();
   }
 #endif
-  
   return height;
 }
 
+- (CGFloat)tableView:(UITableView *)tableView estimatedHeightForRowAtIndexPath:(NSIndexPath *)indexPath
+{
+  // See -respondsToSelector:.
+  if (!_measuresLazily) {
+    return [(id<UITableViewDelegate>)_asyncDelegate tableView:tableView estimatedHeightForRowAtIndexPath:indexPath];
+  }
+
+  ASCollectionElement *element = [_dataController.visibleMap elementForItemAtIndexPath:indexPath];
+  ASCellNode *node = element.nodeIfAllocated;
+  ASLayout *layout = node.calculatedLayout;
+  if (layout != nil && ASSizeRangeEqualToSizeRange(node.constrainedSizeForCalculatedLayout, element.constrainedSize)) {
+    // Measured already: the exact height.
+    return [self _rowHeightForNodeHeight:layout.size.height];
+  }
+  const NSUInteger measuredRowCount = _measuredRowHeights.count;
+  if (measuredRowCount > 0) {
+    return _measuredRowHeightTotal / measuredRowCount;
+  }
+  return (self.rowHeight > 0 ? self.rowHeight : 44.0);
+}
+
+- (BOOL)respondsToSelector:(SEL)aSelector
+{
+  // Providing estimated heights makes UITableView ask for the exact heights of the rows it shows only. Unless measuring
+  // lazily, leave that to the delegate, as before this was intercepted.
+  if (aSelector == @selector(tableView:estimatedHeightForRowAtIndexPath:)) {
+    return _measuresLazily || [_asyncDelegate respondsToSelector:aSelector];
+  }
+  return [super respondsToSelector:aSelector];
+}
+
+/**
+ * With lazy measurement, has the rows within a few screenfuls of the visible ones measured in the background, once
+ * the view scrolled half a screenful since the last time.
+ */
+- (void)_measureRowsNearViewportIfNeeded
+{
+  const CGRect bounds = self.bounds;
+  if (!_measuresLazily || bounds.size.height <= 0 || fabs(bounds.origin.y - _lazyMeasurementOffset) < bounds.size.height / 2) {
+    return;
+  }
+  _lazyMeasurementOffset = bounds.origin.y;
+
+  const CGFloat margin = bounds.size.height * kASTableViewLazyMeasurementScreenfuls;
+  ASElementMap *map = _dataController.visibleMap;
+  const auto elements = [[NSMutableArray<ASCollectionElement *> alloc] init];
+  for (NSIndexPath *indexPath in [self indexPathsForRowsInRect:CGRectInset(bounds, 0, -margin)]) {
+    if (ASCollectionElement *element = [map elementForItemAtIndexPath:indexPath]) {
+      [elements addObject:element];
+    }
+  }
+  [_dataController measureElements:elements];
+}
+
 - (NSInteger)numberOfSectionsInTableView:(UITableView *)tableView
 {
   return _dataController.visibleMap.numberOfSections;
@@ -1265,6 +1410,7 @@ static NSString * const kCellReuseIdentifier = @"_ASTableViewCell";
   if (ASInterfaceStateIncludesVisible(interfaceState)) {
     [self _checkForBatchFetching];
   }  
+  [self _measureRowsNearViewportIfNeeded];
   for (_ASTableViewCell *tableCell in _cellsForVisibilityUpdates) {
     [[tableCell node] cellNodeVisibilityEvent:ASCellNodeVisibilityEventVisibleRectChanged
                                  inScrollView:scrollView
@@ -1558,6 +1704,7 @@ static NSString * const kCellReuseIdentifier = @"_ASTableViewCell";
         NSLog(@"-[super reloadData]");
       }
       updates();
+      [self _removeMeasuredRowHeightsOfDeletedRows];
       [super reloadData];
       // Flush any range changes that happened as part of submitting the reload.
       [self->_rangeController updateIfNeeded];
@@ -1578,6 +1725,7 @@ static NSString * const kCellReuseIdentifier = @"_ASTableViewCell";
   [super beginUpdates];
 
   updates();
+  [self _removeMeasuredRowHeightsOfDeletedRows];
   
   for (_ASHierarchyItemChange *change in [changeSet itemChangesOfType:_ASHierarchyChangeTypeReload]) {
     NSArray<NSIndexPath *> *indexPaths = change.indexPaths;
@@ -1694,6 +1842,16 @@ static NSString * const kCellReuseIdentifier = @"_ASTableViewCell";
   return YES;
 }
 
+- (NSArray<NSIndexPath *> *)indexPathsForVisibleItemsInDataController:(ASDataController *)dataController
+{
+  return self.indexPathsForVisibleRows ?: @[];
+}
+
+- (BOOL)dataControllerShouldMeasureLazily:(ASDataController *)dataController
+{
+  return _measuresLazily;
+}
+
 - (BOOL)dataControllerShouldSerializeNodeCreation:(ASDataController *)dataController
 {
   return NO;
@@ -25,6 +25,8 @@
 #import <AsyncDisplayKit/ASDisplayNodeInternal.h>
 #import <AsyncDisplayKit/ASGraphicsContext.h>
 #import <AsyncDisplayKit/ASHighlightOverlayLayer.h>
+#import <AsyncDisplayKit/ASInternalHelpers.h>
+#import <AsyncDisplayKit/ASLayoutMemoCache.h>
 
 #import <AsyncDisplayKit/ASTextKitCoreTextAdditions.h>
 #import <AsyncDisplayKit/ASTextKitRenderer+Positioning.h>
@@ -415,6 +417,46 @@ static NSArray *DefaultLinkAttributeNames() {
   return ASLockedSelf(_textContainerInset);
 }
 
+- (id)layoutMemoKey
+{
+  // Subclasses that measure differently have to provide their own key.
+  if (ASSubclassOverridesSelector([ASTextNode class], [self class], @selector(calculateSizeThatFits:))) {
+    return nil;
+  }
+
+  ASLockScopeSelf();
+
+  // Exclusion paths and font scaling are rare, and make the size depend on more than we want to compare.
+  if (_exclusionPaths.count > 0 || _pointSizeScaleFactors.count > 0) {
+    return nil;
+  }
+
+  struct {
+    NSLineBreakMode truncationMode;
+    NSUInteger maximumNumberOfLines;
+    UIEdgeInsets textContainerInset;
+    CGSize shadowOffset;
+    CGFloat shadowOpacity;
+    CGFloat shadowRadius;
+    BOOL hasShadowColor;
+  } values;
+  memset(&values, 0, sizeof(values));
+  values.truncationMode = _truncationMode;
+  values.maximumNumberOfLines = _maximumNumberOfLines;
+  values.textContainerInset = _textContainerInset;
+  values.shadowOffset = _shadowOffset;
+  values.shadowOpacity = _shadowOpacity;
+  values.shadowRadius = _shadowRadius;
+  values.hasShadowColor = (_shadowColor != NULL);
+
+  NSNull *null = [NSNull null];
+  return [[ASLayoutMemoKey alloc] initWithObjects:@[_attributedText ?: null,
+                                                    _truncationAttributedText ?: null,
+                                                    _additionalTruncationMessage ?: null]
+                                            bytes:&values
+                                           length:sizeof(values)];
+}
+
 - (CGSize)calculateSizeThatFits:(CGSize)constrainedSize
 {
   ASLockScopeSelf();
@@ -10,7 +10,6 @@
 #import <AsyncDisplayKit/ASTextNode.h>  // Definition of ASTextNodeDelegate
 
 #import <tgmath.h>
-#import <deque>
 
 #import <AsyncDisplayKit/_ASDisplayLayer.h>
 #import <AsyncDisplayKit/ASDisplayNode+FrameworkPrivate.h>
@@ -18,21 +17,15 @@
 #import <AsyncDisplayKit/ASDisplayNodeExtras.h>
 #import <AsyncDisplayKit/ASDisplayNodeInternal.h>
 #import <AsyncDisplayKit/ASHighlightOverlayLayer.h>
+#import <AsyncDisplayKit/ASInternalHelpers.h>
+#import <AsyncDisplayKit/ASLayoutMemoCache.h>
+#import <AsyncDisplayKit/ASTextLayoutCache.h>
 
 #import <AsyncDisplayKit/ASTextKitRenderer+Positioning.h>
 #import <AsyncDisplayKit/ASEqualityHelpers.h>
 
 #import <AsyncDisplayKit/ASTextLayout.h>
 
-@interface ASTextCacheValue : NSObject {
-  @package
-  AS::Mutex _m;
-  std::deque<std::tuple<CGSize, ASTextLayout *>> _layouts;
-}
-@end
-@implementation ASTextCacheValue
-@end
-
 /**
  * If set, we will record all values set to attributedText into an array
  * and once we get 2000, we'll write them all out into a plist file.
@@ -43,92 +36,12 @@
 #define AS_TEXTNODE2_RECORD_ATTRIBUTED_STRINGS 0
 
 /**
- * If it can't find a compatible layout, this method creates one.
+ * If it can't find a compatible layout, this method creates one. See ASTextLayoutCache.h.
  *
- * NOTE: Be careful to copy `text` if needed.
+ * NOTE: The cache copies `text` if it keeps it.
  */
-static NS_RETURNS_RETAINED ASTextLayout *ASTextNodeCompatibleLayoutWithContainerAndText(ASTextContainer *container, NSAttributedString *text)  {
-  static dispatch_once_t onceToken;
-  static AS::Mutex *layoutCacheLock;
-  static NSCache<NSAttributedString *, ASTextCacheValue *> *textLayoutCache;
-  dispatch_once(&onceToken, ^{
-    layoutCacheLock = new AS::Mutex();
-    textLayoutCache = [[NSCache alloc] init];
-  });
-
-  layoutCacheLock->lock();
-
-  ASTextCacheValue *cacheValue = [textLayoutCache objectForKey:text];
-  if (cacheValue == nil) {
-    cacheValue = [[ASTextCacheValue alloc] init];
-    [textLayoutCache setObject:cacheValue forKey:[text copy]];
-  }
-
-  // Lock the cache item for the rest of the method. Only after acquiring can we release the NSCache.
-  AS::MutexLocker lock(cacheValue->_m);
-  layoutCacheLock->unlock();
-
-  CGRect containerBounds = (CGRect){ .size = container.size };
-  {
-    for (const auto &t : cacheValue->_layouts) {
-      CGSize constrainedSize = std::get<0>(t);
-      ASTextLayout *layout = std::get<1>(t);
-
-      CGSize layoutSize = layout.textBoundingSize;
-      // 1. CoreText can return frames that are narrower than the constrained width, for obvious reasons.
-      // 2. CoreText can return frames that are slightly wider than the constrained width, for some reason.
-      //    We have to trust that somehow it's OK to try and draw within our size constraint, despite the return value.
-      // 3. Thus, those two values (constrained width & returned width) form a range, where
-      //    intermediate values in that range will be snapped. Thus, we can use a given layout as long as our
-      //    width is in that range, between the min and max of those two values.
-      CGRect minRect = CGRectMake(0, 0, MIN(layoutSize.width, constrainedSize.width), MIN(layoutSize.height, constrainedSize.height));
-      if (!CGRectContainsRect(containerBounds, minRect)) {
-        continue;
-      }
-      CGRect maxRect = CGRectMake(0, 0, MAX(layoutSize.width, constrainedSize.width), MAX(layoutSize.height, constrainedSize.height));
-      if (!CGRectContainsRect(maxRect, containerBounds)) {
-        continue;
-      }
-      if (!CGSizeEqualToSize(container.size, constrainedSize)) {
-        continue;
-      }
-
-      // Now check container params.
-      ASTextContainer *otherContainer = layout.container;
-      if (!UIEdgeInsetsEqualToEdgeInsets(container.insets, otherContainer.insets)) {
-        continue;
-      }
-      if (!ASObjectIsEqual(container.exclusionPaths, otherContainer.exclusionPaths)) {
-        continue;
-      }
-      if (container.maximumNumberOfRows != otherContainer.maximumNumberOfRows) {
-        continue;
-      }
-      if (container.truncationType != otherContainer.truncationType) {
-        continue;
-      }
-      if (!ASObjectIsEqual(container.truncationToken, otherContainer.truncationToken)) {
-        continue;
-      }
-      // TODO: When we get a cache hit, move this entry to the front (LRU).
-      return layout;
-    }
-  }
-
-  // Cache Miss. Compute the text layout.
-  ASTextLayout *layout = [ASTextLayout layoutWithContainer:container text:text];
-
-  // Store the result in the cache.
-  {
-    // This is a critical section. However we also must hold the lock until this point, in case
-    // another thread requests this cache item while a layout is being calculated, so they don't race.
-    cacheValue->_layouts.push_front(std::make_tuple(container.size, layout));
-    if (cacheValue->_layouts.size() > 3) {
-      cacheValue->_layouts.pop_back();
-    }
-  }
-
-  return layout;
+static ASTextLayout *ASTextNodeCompatibleLayoutWithContainerAndText(ASTextContainer *container, NSAttributedString *text)  {
+  return ASTextLayoutCacheGetLayout(container, text);
 }
 
 static const NSTimeInterval ASTextNodeHighlightFadeOutDuration = 0.15;
@@ -337,6 +250,40 @@ static NSArray *DefaultLinkAttributeNames() {
   return _textContainer.linePositionModifier;
 }
 
+- (id)layoutMemoKey
+{
+  // Subclasses that measure differently have to provide their own key.
+  if (ASSubclassOverridesSelector([ASTextNode2 class], [self class], @selector(calculateSizeThatFits:))) {
+    return nil;
+  }
+
+  ASLockScopeSelf();
+
+  // Exclusion paths, line position modifiers and font scaling make the size depend on more than we want to compare.
+  if (_textContainer.exclusionPaths.count > 0 || _textContainer.linePositionModifier != nil || _pointSizeScaleFactors.count > 0) {
+    return nil;
+  }
+
+  struct {
+    NSLineBreakMode truncationMode;
+    ASTextTruncationType truncationType;
+    NSUInteger maximumNumberOfRows;
+    UIEdgeInsets insets;
+  } values;
+  memset(&values, 0, sizeof(values));
+  values.truncationMode = _truncationMode;
+  values.truncationType = _textContainer.truncationType;
+  values.maximumNumberOfRows = _textContainer.maximumNumberOfRows;
+  values.insets = _textContainer.insets;
+
+  NSNull *null = [NSNull null];
+  return [[ASLayoutMemoKey alloc] initWithObjects:@[_attributedText ?: null,
+                                                    _truncationAttributedText ?: null,
+                                                    _additionalTruncationMessage ?: null]
+                                            bytes:&values
+                                           length:sizeof(values)];
+}
+
 - (CGSize)calculateSizeThatFits:(CGSize)constrainedSize
 {
   ASDisplayNodeAssert(constrainedSize.width >= 0, @"Constrained width for text (%f) is too  narrow", constrainedSize.width);
@@ -102,6 +102,8 @@
 #import <AsyncDisplayKit/ASDisplayNode+Subclasses.h>
 #import <AsyncDisplayKit/ASEqualityHelpers.h>
 #import <AsyncDisplayKit/ASHashing.h>
+#import <AsyncDisplayKit/ASLayoutMemoCache.h>
+#import <AsyncDisplayKit/ASTextLayoutCache.h>
 #import <AsyncDisplayKit/ASHighlightOverlayLayer.h>
 #import <AsyncDisplayKit/ASImageContainerProtocolCategories.h>
 #import <AsyncDisplayKit/ASLocking.h>
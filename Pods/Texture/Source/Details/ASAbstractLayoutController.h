@@ -20,6 +20,13 @@ ASDK_EXTERN CGRect CGRectExpandToRangeWithScrollableDirections(CGRect rect, ASRa
 
 @interface ASAbstractLayoutController : NSObject <ASLayoutController>
 
+/**
+ * With ASExperimentalAdaptiveRanges, the largest display or preload range in full range mode, visible area included,
+ * in screenfuls. Ranges are extended ahead of fast scrolling up to this size, which bounds their memory use.
+ * Default == 8.
+ */
+@property (nonatomic) CGFloat adaptiveRangeMaximumScreenfuls;
+
 @end
 
 @interface ASAbstractLayoutController (Unavailable)
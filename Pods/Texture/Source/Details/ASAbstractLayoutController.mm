@@ -9,7 +9,10 @@
 
 #import <AsyncDisplayKit/ASAbstractLayoutController.h>
 #import <AsyncDisplayKit/ASAbstractLayoutController+FrameworkPrivate.h>
+#import <AsyncDisplayKit/ASAdaptiveRange.h>
 #import <AsyncDisplayKit/ASAssert.h>
+#import <AsyncDisplayKit/ASConfigurationInternal.h>
+#import <QuartzCore/QuartzCore.h>
 
 ASRangeTuningParameters const ASRangeTuningParametersZero = {};
 
@@ -80,8 +83,13 @@ CGRect CGRectExpandToRangeWithScrollableDirections(CGRect rect, ASRangeTuningPar
   return rect;
 }
 
+// Seconds for an item entering a range to be ready: displayed for the display range, its data loaded for preload.
+static const CGFloat kASAdaptiveRangeDisplayLatency = 0.15;
+static const CGFloat kASAdaptiveRangePreloadLatency = 0.6;
+
 @interface ASAbstractLayoutController () {
   std::vector<std::vector<ASRangeTuningParameters>> _tuningParameters;
+  AS::AdaptiveRange _adaptiveRange;
 }
 @end
 
@@ -169,6 +177,46 @@ CGRect CGRectExpandToRangeWithScrollableDirections(CGRect rect, ASRangeTuningPar
   _tuningParameters[rangeMode][rangeType] = tuningParameters;
 }
 
+- (CGFloat)adaptiveRangeMaximumScreenfuls
+{
+  return _adaptiveRange.configuration().maximumScreenfuls;
+}
+
+- (void)setAdaptiveRangeMaximumScreenfuls:(CGFloat)maximumScreenfuls
+{
+  AS::AdaptiveRange::Configuration configuration = _adaptiveRange.configuration();
+  configuration.maximumScreenfuls = maximumScreenfuls;
+  _adaptiveRange.setConfiguration(configuration);
+}
+
+- (void)sampleScrollBounds:(CGRect)bounds scrollableDirections:(ASScrollDirection)scrollableDirections
+{
+  if (!ASActivateExperimentalFeature(ASExperimentalAdaptiveRanges)) {
+    return;
+  }
+
+  // Ranges are updated on every scroll tick, so the bounds at each update are a good enough trace of the scroll offset.
+  const BOOL vertical = ASScrollDirectionContainsVerticalDirection(scrollableDirections);
+  _adaptiveRange.sample(CACurrentMediaTime(),
+                        vertical ? CGRectGetMinY(bounds) : CGRectGetMinX(bounds),
+                        vertical ? CGRectGetHeight(bounds) : CGRectGetWidth(bounds));
+}
+
+- (ASRangeTuningParameters)adaptedTuningParametersForRangeMode:(ASLayoutRangeMode)rangeMode
+                                                     rangeType:(ASLayoutRangeType)rangeType
+{
+  ASRangeTuningParameters tuningParameters = [self tuningParametersForRangeMode:rangeMode rangeType:rangeType];
+  if (rangeMode != ASLayoutRangeModeFull || !ASActivateExperimentalFeature(ASExperimentalAdaptiveRanges)) {
+    return tuningParameters;
+  }
+
+  const CGFloat latency = (rangeType == ASLayoutRangeTypeDisplay) ? kASAdaptiveRangeDisplayLatency : kASAdaptiveRangePreloadLatency;
+  const AS::AdaptiveRange::Buffers buffers = _adaptiveRange.adapt({tuningParameters.leadingBufferScreenfuls, tuningParameters.trailingBufferScreenfuls}, latency);
+  tuningParameters.leadingBufferScreenfuls = buffers.leading;
+  tuningParameters.trailingBufferScreenfuls = buffers.trailing;
+  return tuningParameters;
+}
+
 #pragma mark - Abstract Index Path Range Support
 
 - (NSHashTable<ASCollectionElement *> *)elementsForScrolling:(ASScrollDirection)scrollDirection rangeMode:(ASLayoutRangeMode)rangeMode rangeType:(ASLayoutRangeType)rangeType map:(ASElementMap *)map
@@ -16,9 +16,12 @@
 #import <AsyncDisplayKit/ASLayout.h>
 #import <AsyncDisplayKit/ASLayoutSpecUtilities.h>
 #import <AsyncDisplayKit/ASPageTable.h>
+#import <AsyncDisplayKit/ASScrollDirection.h>
+#import <AsyncDisplayKit/ASSpatialIndex.h>
 #import <AsyncDisplayKit/ASThread.h>
 
 #import <queue>
+#import <vector>
 
 @implementation NSMapTable (ASCollectionLayoutConvenience)
 
@@ -34,7 +37,9 @@
   CGSize _contentSize;
   ASCollectionLayoutContext *_context;
   NSMapTable<ASCollectionElement *, UICollectionViewLayoutAttributes *> *_elementToLayoutAttributesTable;
-  ASPageToLayoutAttributesTable *_pageToLayoutAttributesTable;
+  // All attributes, in the order of the spatial index positions, and the index used for rect queries.
+  NSArray<UICollectionViewLayoutAttributes *> *_indexedLayoutAttributes;
+  AS::SpatialIndex _spatialIndex;
   ASPageToLayoutAttributesTable *_unmeasuredPageToLayoutAttributesTable;
 }
 
@@ -105,7 +110,7 @@ elementToLayoutAttributesTable:[NSMapTable elementToLayoutAttributesTable]];
     _contentSize = contentSize;
     _elementToLayoutAttributesTable = [table copy]; // Copy the given table to make sure clients can't mutate it after this point.
     CGSize pageSize = context.viewportSize;
-    _pageToLayoutAttributesTable = [ASPageTable pageTableWithLayoutAttributes:table.objectEnumerator contentSize:contentSize pageSize:pageSize];
+    [self _buildSpatialIndex];
     _unmeasuredPageToLayoutAttributesTable = [ASCollectionLayoutState _unmeasuredLayoutAttributesTableFromTable:table contentSize:contentSize pageSize:pageSize];
   }
   return self;
@@ -146,33 +151,28 @@ elementToLayoutAttributesTable:[NSMapTable elementToLayoutAttributesTable]];
 
 - (NSArray<UICollectionViewLayoutAttributes *> *)layoutAttributesForElementsInRect:(CGRect)rect
 {
-  CGSize pageSize = _context.viewportSize;
-  NSPointerArray *pages = ASPageCoordinatesForPagesThatIntersectRect(rect, _contentSize, pageSize);
-  if (pages.count == 0) {
+  if (CGRectIsNull(rect) || CGRectIsEmpty(rect)) {
     return @[];
   }
 
-  // Use a set here because some items may span multiple pages
-  const auto result = [[NSMutableSet<UICollectionViewLayoutAttributes *> alloc] init];
-  for (id pagePtr in pages) {
-    ASPageCoordinate page = (ASPageCoordinate)pagePtr;
-    NSArray<UICollectionViewLayoutAttributes *> *allAttrs = [_pageToLayoutAttributesTable objectForPage:page];
-    if (allAttrs.count > 0) {
-      CGRect pageRect = ASPageCoordinateGetPageRect(page, pageSize);
-
-      if (CGRectContainsRect(rect, pageRect)) {
-        [result addObjectsFromArray:allAttrs];
-      } else {
-        for (UICollectionViewLayoutAttributes *attrs in allAttrs) {
-          if (CGRectIntersectsRect(rect, attrs.frame)) {
-            [result addObject:attrs];
-          }
-        }
+  // Hits come in ascending spans of _indexedLayoutAttributes. A list is a single span, which is returned as is.
+  NSArray<UICollectionViewLayoutAttributes *> *indexedAttrs = _indexedLayoutAttributes;
+  NSArray<UICollectionViewLayoutAttributes *> *firstSpan = nil;
+  NSMutableArray<UICollectionViewLayoutAttributes *> *result = nil;
+  rect = CGRectStandardize(rect);
+  _spatialIndex.query({rect.origin.x, rect.origin.y, rect.size.width, rect.size.height}, [&](uint32_t begin, uint32_t end) {
+    NSArray<UICollectionViewLayoutAttributes *> *span = [indexedAttrs subarrayWithRange:NSMakeRange(begin, end - begin)];
+    if (firstSpan == nil) {
+      firstSpan = span;
+    } else {
+      if (result == nil) {
+        result = [firstSpan mutableCopy];
       }
+      [result addObjectsFromArray:span];
     }
-  }
+  });
 
-  return [result allObjects];
+  return result ?: (firstSpan ?: @[]);
 }
 
 - (ASPageToLayoutAttributesTable *)getAndRemoveUnmeasuredLayoutAttributesPageTableInRect:(CGRect)rect
@@ -235,6 +235,31 @@ elementToLayoutAttributesTable:[NSMapTable elementToLayoutAttributesTable]];
 
 #pragma mark - Private methods
 
+- (void)_buildSpatialIndex
+{
+  NSArray<UICollectionViewLayoutAttributes *> *allAttrs = [_elementToLayoutAttributesTable.objectEnumerator allObjects];
+  const NSUInteger count = allAttrs.count;
+  std::vector<AS::SpatialIndex::Rect> rects;
+  rects.reserve(count);
+  for (UICollectionViewLayoutAttributes *attrs in allAttrs) {
+    const CGRect frame = attrs.frame;
+    rects.push_back({frame.origin.x, frame.origin.y, frame.size.width, frame.size.height});
+  }
+
+  // Only horizontal collections are indexed along x; everything else (including no scrolling at all) along y.
+  const ASScrollDirection scrollableDirections = _context.scrollableDirections;
+  const auto axis = (ASScrollDirectionContainsHorizontalDirection(scrollableDirections) && !ASScrollDirectionContainsVerticalDirection(scrollableDirections))
+      ? AS::SpatialIndex::Horizontal : AS::SpatialIndex::Vertical;
+  _spatialIndex = AS::SpatialIndex(rects.data(), (uint32_t)count, axis);
+
+  std::vector<id> sortedAttrs;
+  sortedAttrs.reserve(count);
+  for (uint32_t position = 0; position < count; position++) {
+    sortedAttrs.push_back(allAttrs[_spatialIndex.indexAtPosition(position)]);
+  }
+  _indexedLayoutAttributes = [NSArray arrayWithObjects:sortedAttrs.data() count:count];
+}
+
 + (ASPageToLayoutAttributesTable *)_unmeasuredLayoutAttributesTableFromTable:(NSMapTable<ASCollectionElement *, UICollectionViewLayoutAttributes *> *)table
                                                                  contentSize:(CGSize)contentSize
                                                                     pageSize:(CGSize)pageSize
@@ -9,6 +9,7 @@
 
 #import <AsyncDisplayKit/ASCollectionViewLayoutController.h>
 
+#import <AsyncDisplayKit/ASAbstractLayoutController+FrameworkPrivate.h>
 #import <AsyncDisplayKit/ASAssert.h>
 #import <AsyncDisplayKit/ASCollectionView+Undeprecated.h>
 #import <AsyncDisplayKit/ASElementMap.h>
@@ -43,10 +44,14 @@ typedef struct ASRangeGeometry ASRangeGeometry;
   return self;
 }
 
+- (void)prepareForRangeUpdate
+{
+  [self sampleScrollBounds:_collectionView.bounds scrollableDirections:[_collectionView scrollableDirections]];
+}
+
 - (NSHashTable<ASCollectionElement *> *)elementsForScrolling:(ASScrollDirection)scrollDirection rangeMode:(ASLayoutRangeMode)rangeMode rangeType:(ASLayoutRangeType)rangeType map:(ASElementMap *)map
 {
-  ASRangeTuningParameters tuningParameters = [self tuningParametersForRangeMode:rangeMode rangeType:rangeType];
-  CGRect rangeBounds = [self rangeBoundsWithScrollDirection:scrollDirection rangeTuningParameters:tuningParameters];
+  CGRect rangeBounds = [self rangeBoundsWithScrollDirection:scrollDirection rangeMode:rangeMode rangeType:rangeType];
   return [self elementsWithinRangeBounds:rangeBounds map:map];
 }
 
@@ -56,10 +61,8 @@ typedef struct ASRangeGeometry ASRangeGeometry;
     return;
   }
   
-  ASRangeTuningParameters displayParams = [self tuningParametersForRangeMode:rangeMode rangeType:ASLayoutRangeTypeDisplay];
-  ASRangeTuningParameters preloadParams = [self tuningParametersForRangeMode:rangeMode rangeType:ASLayoutRangeTypePreload];
-  CGRect displayBounds = [self rangeBoundsWithScrollDirection:scrollDirection rangeTuningParameters:displayParams];
-  CGRect preloadBounds = [self rangeBoundsWithScrollDirection:scrollDirection rangeTuningParameters:preloadParams];
+  CGRect displayBounds = [self rangeBoundsWithScrollDirection:scrollDirection rangeMode:rangeMode rangeType:ASLayoutRangeTypeDisplay];
+  CGRect preloadBounds = [self rangeBoundsWithScrollDirection:scrollDirection rangeMode:rangeMode rangeType:ASLayoutRangeTypePreload];
   
   CGRect unionBounds = CGRectUnion(displayBounds, preloadBounds);
   NSArray *layoutAttributes = [_collectionViewLayout layoutAttributesForElementsInRect:unionBounds];
@@ -116,11 +119,14 @@ typedef struct ASRangeGeometry ASRangeGeometry;
 }
 
 - (CGRect)rangeBoundsWithScrollDirection:(ASScrollDirection)scrollDirection
-                   rangeTuningParameters:(ASRangeTuningParameters)tuningParameters
+                               rangeMode:(ASLayoutRangeMode)rangeMode
+                               rangeType:(ASLayoutRangeType)rangeType
 {
   CGRect rect = _collectionView.bounds;
+  ASScrollDirection scrollableDirections = [_collectionView scrollableDirections];
+  ASRangeTuningParameters tuningParameters = [self adaptedTuningParametersForRangeMode:rangeMode rangeType:rangeType];
   
-  return CGRectExpandToRangeWithScrollableDirections(rect, tuningParameters, [_collectionView scrollableDirections], scrollDirection);
+  return CGRectExpandToRangeWithScrollableDirections(rect, tuningParameters, scrollableDirections, scrollDirection);
 }
 
 @end
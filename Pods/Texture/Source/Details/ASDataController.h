@@ -35,6 +35,32 @@ typedef NSUInteger ASDataControllerAnimationOptions;
 ASDK_EXTERN NSString * const ASDataControllerRowNodeKind;
 ASDK_EXTERN NSString * const ASCollectionInvalidUpdateException;
 
+/**
+ * Counts of the cell nodes considered by -relayoutAllNodesWithInvalidationBlock: and -environmentDidChange.
+ */
+typedef struct {
+  /** Nodes whose layout was recalculated, or invalidated so it will be. */
+  NSUInteger relaidOutNodes;
+  /** Nodes whose layout was kept because none of its inputs changed. */
+  NSUInteger skippedNodes;
+} ASDataControllerRelayoutStatistics;
+
+/**
+ * Timings of the node allocation and layout for a change set, measured from -updateWithChangeSet:.
+ */
+typedef struct {
+  /** Seconds until the nodes of the items that are on screen were allocated and laid out. */
+  NSTimeInterval timeToVisibleNodes;
+  /** Seconds until all the new nodes were allocated and laid out. */
+  NSTimeInterval timeToAllNodes;
+  /** Nodes allocated first, because their items are on screen. */
+  NSUInteger visibleNodes;
+  /** All nodes allocated. */
+  NSUInteger allocatedNodes;
+  /** Nodes left unallocated when measuring lazily, to be measured once near the screen. */
+  NSUInteger deferredNodes;
+} ASDataControllerAllocationStatistics;
+
 /**
  Data source for data controller
  It will be invoked in the same thread as the api call of ASDataController.
@@ -97,6 +123,19 @@ ASDK_EXTERN NSString * const ASCollectionInvalidUpdateException;
 
 - (nullable id<ASSectionContext>)dataController:(ASDataController *)dataController contextForSection:(NSInteger)section;
 
+/**
+ The index paths of the items on screen, in the data the view currently presents (the visible map). With
+ ASExperimentalViewportPriorityAllocation, their nodes are allocated before all others.
+ */
+- (NSArray<NSIndexPath *> *)indexPathsForVisibleItemsInDataController:(ASDataController *)dataController;
+
+/**
+ Whether to allocate and measure only the nodes near the items on screen during updates. The view must then size the
+ other items with estimates, and have them measured with -measureElements: as they get close. Called for every
+ update, and only if no data controller layout delegate is provided.
+ */
+- (BOOL)dataControllerShouldMeasureLazily:(ASDataController *)dataController;
+
 @end
 
 /**
@@ -224,6 +263,14 @@ ASDK_EXTERN NSString * const ASCollectionInvalidUpdateException;
 
 - (void)updateWithChangeSet:(_ASHierarchyChangeSet *)changeSet;
 
+/**
+ * Allocates and measures the nodes of the given elements of the visible map that aren't yet, in the background.
+ *
+ * @discussion Used by views whose data source measures lazily (see -dataControllerShouldMeasureLazily:) to measure
+ * the items that get close to the screen before they are shown.
+ */
+- (void)measureElements:(NSArray<ASCollectionElement *> *)elements;
+
 /**
  * Re-measures all loaded nodes in the backing store.
  * 
@@ -242,6 +289,25 @@ ASDK_EXTERN NSString * const ASCollectionInvalidUpdateException;
  */
 - (void)relayoutNodes:(id<NSFastEnumeration>)nodes nodesSizeChanged:(NSMutableArray<ASCellNode *> *)nodesSizesChanged;
 
+/**
+ * Relayout counts since the data controller was created. Main thread only.
+ *
+ * @discussion With ASExperimentalIncrementalRelayout, a relayout skips the nodes whose constrained size is unchanged
+ * and whose layout is still valid, and an environment change only invalidates the nodes that read the trait
+ * collection while calculating their layout. Without it, a relayout counts every allocated node as relaid out and an
+ * environment change counts nothing.
+ */
+@property (nonatomic, readonly) ASDataControllerRelayoutStatistics relayoutStatistics;
+
+/**
+ * Allocation timings of the last change set that allocated nodes. Main thread only.
+ *
+ * @discussion With ASExperimentalViewportPriorityAllocation, the nodes of the items on screen are allocated and laid
+ * out first, then the others in order of distance from them, so timeToVisibleNodes is usually well below
+ * timeToAllNodes. Without it, nodes are allocated in index order and both are the same.
+ */
+@property (nonatomic, readonly) ASDataControllerAllocationStatistics allocationStatistics;
+
 /**
  * See ASCollectionNode.h for full documentation of these methods.
  */
@@ -14,6 +14,7 @@
 #import <AsyncDisplayKit/ASCellNode.h>
 #import <AsyncDisplayKit/ASCollectionElement.h>
 #import <AsyncDisplayKit/ASCollectionLayoutContext.h>
+#import <AsyncDisplayKit/ASConfigurationInternal.h>
 #import <AsyncDisplayKit/ASDispatch.h>
 #import <AsyncDisplayKit/ASDisplayNodeExtras.h>
 #import <AsyncDisplayKit/ASElementMap.h>
@@ -27,9 +28,12 @@
 
 #import <AsyncDisplayKit/ASInternalHelpers.h>
 #import <AsyncDisplayKit/ASCellNode+Internal.h>
+#import <AsyncDisplayKit/ASDisplayNode+FrameworkPrivate.h>
 #import <AsyncDisplayKit/ASDisplayNode+Subclasses.h>
 #import <AsyncDisplayKit/NSIndexSet+ASHelpers.h>
 
+#import <algorithm>
+
 //#define LOG(...) NSLog(__VA_ARGS__)
 #define LOG(...)
 
@@ -38,6 +42,11 @@
 const static char * kASDataControllerEditingQueueKey = "kASDataControllerEditingQueueKey";
 const static char * kASDataControllerEditingQueueContext = "kASDataControllerEditingQueueContext";
 
+// With ASExperimentalViewportPriorityAllocation, the number of leading items allocated first while nothing is on screen.
+static const NSUInteger kASDataControllerInitialVisibleItemCount = 16;
+// When measuring lazily, the items measured up front on either side of the visible ones, in multiples of their count.
+static const NSUInteger kASDataControllerLazyMeasurementScreenfuls = 2;
+
 NSString * const ASDataControllerRowNodeKind = @"_ASDataControllerRowNodeKind";
 NSString * const ASCollectionInvalidUpdateException = @"ASCollectionInvalidUpdateException";
 
@@ -71,7 +80,15 @@ typedef void (^ASDataControllerSynchronizationBlock)();
     unsigned int constrainedSizeForNodeAtIndexPath:1;
     unsigned int constrainedSizeForSupplementaryNodeOfKindAtIndexPath:1;
     unsigned int contextForSection:1;
+    unsigned int indexPathsForVisibleItems:1;
+    unsigned int shouldMeasureLazily:1;
   } _dataSourceFlags;
+
+  ASDataControllerRelayoutStatistics _relayoutStatistics; // Main thread only.
+  ASDataControllerAllocationStatistics _allocationStatistics; // Main thread only.
+
+  NSInteger _uncommittedUpdateCount;                                // Main thread only.
+  NSMutableArray<_ASHierarchyChangeSet *> *_uncommittedChangeSets; // Main thread only.
 }
 
 @property (copy) ASElementMap *pendingMap;
@@ -97,6 +114,8 @@ typedef void (^ASDataControllerSynchronizationBlock)();
   _dataSourceFlags.constrainedSizeForNodeAtIndexPath = [_dataSource respondsToSelector:@selector(dataController:constrainedSizeForNodeAtIndexPath:)];
   _dataSourceFlags.constrainedSizeForSupplementaryNodeOfKindAtIndexPath = [_dataSource respondsToSelector:@selector(dataController:constrainedSizeForSupplementaryNodeOfKind:atIndexPath:)];
   _dataSourceFlags.contextForSection = [_dataSource respondsToSelector:@selector(dataController:contextForSection:)];
+  _dataSourceFlags.indexPathsForVisibleItems = [_dataSource respondsToSelector:@selector(indexPathsForVisibleItemsInDataController:)];
+  _dataSourceFlags.shouldMeasureLazily = [_dataSource respondsToSelector:@selector(dataControllerShouldMeasureLazily:)];
 
   self.visibleMap = self.pendingMap = [[ASElementMap alloc] init];
   
@@ -176,6 +195,102 @@ typedef void (^ASDataControllerSynchronizationBlock)();
   ASSignpostEnd(DataControllerBatch, self, "count: %lu", (unsigned long)nodeCount);
 }
 
+/**
+ * Like -_allocateNodesFromElements:, but the nodes of the items in `visibleItems` (flat indexes in `map`) go first, then
+ * the others by distance from them. A supplementary element is as far as the first item of its section. Elements
+ * further than `maximumDistance` items are left alone.
+ */
+- (void)_allocateNodesFromElements:(NSArray<ASCollectionElement *> *)elements
+                             inMap:(ASElementMap *)map
+                      visibleItems:(NSRange)visibleItems
+                   maximumDistance:(NSUInteger)maximumDistance
+                        updateTime:(CFTimeInterval)updateTime
+                        statistics:(ASDataControllerAllocationStatistics *)statistics
+{
+  ASSERT_ON_EDITING_QUEUE;
+
+  const NSInteger sectionCount = map.numberOfSections;
+  std::vector<NSInteger> sectionOffsets(sectionCount + 1, 0);
+  for (NSInteger section = 0; section < sectionCount; section++) {
+    sectionOffsets[section + 1] = sectionOffsets[section] + [map numberOfItemsInSection:section];
+  }
+
+  // (distance, index in elements), so sorting keeps index order among equal distances.
+  std::vector<std::pair<NSUInteger, NSUInteger>> order;
+  order.reserve(elements.count);
+  NSUInteger visibleCount = 0;
+  for (ASCollectionElement *element in elements) {
+    NSInteger flatIndex = NSNotFound;
+    if (element.supplementaryElementKind == nil) {
+      flatIndex = [map flatIndexOfItemElement:element];
+    } else if (NSIndexPath *indexPath = [map indexPathForElement:element]) {
+      flatIndex = sectionOffsets[indexPath.section];
+    }
+    NSUInteger distance = NSUIntegerMax;
+    if (flatIndex != NSNotFound) {
+      if ((NSUInteger)flatIndex < visibleItems.location) {
+        distance = visibleItems.location - flatIndex;
+      } else if ((NSUInteger)flatIndex >= NSMaxRange(visibleItems)) {
+        distance = flatIndex - NSMaxRange(visibleItems) + 1;
+      } else {
+        distance = 0;
+        visibleCount++;
+      }
+    }
+    order.emplace_back(distance, order.size());
+  }
+  std::sort(order.begin(), order.end());
+
+  const auto visibleElements = [[NSMutableArray<ASCollectionElement *> alloc] initWithCapacity:visibleCount];
+  const auto otherElements = [[NSMutableArray<ASCollectionElement *> alloc] initWithCapacity:order.size() - visibleCount];
+  for (const auto &entry : order) {
+    if (entry.first > maximumDistance) {
+      break;
+    }
+    [(entry.first == 0 ? visibleElements : otherElements) addObject:elements[entry.second]];
+  }
+
+  [self _allocateNodesFromElements:visibleElements];
+  statistics->timeToVisibleNodes = CACurrentMediaTime() - updateTime;
+  statistics->visibleNodes = visibleCount;
+  [self _allocateNodesFromElements:otherElements];
+  statistics->timeToAllNodes = CACurrentMediaTime() - updateTime;
+  statistics->allocatedNodes = visibleElements.count + otherElements.count;
+  statistics->deferredNodes = order.size() - statistics->allocatedNodes;
+}
+
+/**
+ * The flat indexes in `newMap` of the items on screen, for -_allocateNodesFromElements:inMap:visibleItems:...
+ * Before anything is on screen, the first few items.
+ */
+- (NSRange)_visibleItemsInMap:(ASElementMap *)newMap previousMap:(ASElementMap *)previousMap changeSet:(_ASHierarchyChangeSet *)changeSet
+{
+  ASDisplayNodeAssertMainThread();
+  NSArray<NSIndexPath *> *indexPaths = nil;
+  if (_dataSourceFlags.indexPathsForVisibleItems) {
+    indexPaths = [_dataSource indexPathsForVisibleItemsInDataController:self];
+  }
+
+  // The view's index paths are in the visible map, but the change set starts from the previous pending map. If these
+  // differ, or the items were deleted or reloaded, the index paths are kept as they are: good enough for an order.
+  const BOOL canMapIndexPaths = (!changeSet.includesReloadData && previousMap == self.visibleMap);
+  NSInteger first = NSIntegerMax;
+  NSInteger last = NSIntegerMin;
+  for (NSIndexPath *indexPath in indexPaths) {
+    NSIndexPath *newIndexPath = (canMapIndexPaths ? [changeSet newIndexPathForOldIndexPath:indexPath] : nil) ?: indexPath;
+    ASCollectionElement *element = [newMap elementForItemAtIndexPath:newIndexPath];
+    if (element != nil) {
+      const NSInteger flatIndex = [newMap flatIndexOfItemElement:element];
+      first = MIN(first, flatIndex);
+      last = MAX(last, flatIndex);
+    }
+  }
+  if (first > last) {
+    return NSMakeRange(0, MIN(kASDataControllerInitialVisibleItemCount, (NSUInteger)newMap.numberOfItems));
+  }
+  return NSMakeRange(first, last - first + 1);
+}
+
 /**
  * Measure and layout the given node with the constrained size range.
  */
@@ -529,6 +644,7 @@ typedef void (^ASDataControllerSynchronizationBlock)();
 - (void)updateWithChangeSet:(_ASHierarchyChangeSet *)changeSet
 {
   ASDisplayNodeAssertMainThread();
+  const CFTimeInterval updateTime = CACurrentMediaTime();
 
   _synchronized = NO;
 
@@ -589,6 +705,9 @@ typedef void (^ASDataControllerSynchronizationBlock)();
   }
 
   BOOL canDelegate = (self.layoutDelegate != nil);
+  const BOOL measureLazily = (!canDelegate && _dataSourceFlags.shouldMeasureLazily && [_dataSource dataControllerShouldMeasureLazily:self]);
+  const BOOL prioritizeVisibleItems = (!canDelegate && (measureLazily || ASActivateExperimentalFeature(ASExperimentalViewportPriorityAllocation)));
+  NSRange visibleItems = NSMakeRange(0, 0);
   ASElementMap *newMap;
   ASCollectionLayoutContext *layoutContext;
   {
@@ -612,6 +731,9 @@ typedef void (^ASDataControllerSynchronizationBlock)();
       newMap = [mutableMap copy];
     }
     self.pendingMap = newMap;
+    if (prioritizeVisibleItems) {
+      visibleItems = [self _visibleItemsInMap:newMap previousMap:previousMap changeSet:changeSet];
+    }
 
     // Step 2: Ask layout delegate for contexts
     if (canDelegate) {
@@ -622,12 +744,14 @@ typedef void (^ASDataControllerSynchronizationBlock)();
   os_log_debug(ASCollectionLog(), "New content: %@", newMap.smallDescription);
 
   Class<ASDataControllerLayoutDelegate> layoutDelegateClass = [self.layoutDelegate class];
+  ++_uncommittedUpdateCount;
   ++_editingTransactionGroupCount;
   dispatch_group_async(_editingTransactionGroup, _editingTransactionQueue, ^{
     __block __unused os_activity_scope_state_s preparationScope = {}; // unused if deployment target < iOS10
     as_activity_scope_enter(as_activity_create("Prepare nodes for collection update", AS_ACTIVITY_CURRENT, OS_ACTIVITY_FLAG_DEFAULT), &preparationScope);
 
     // Step 3: Call the layout delegate if possible. Otherwise, allocate and layout all elements
+    ASDataControllerAllocationStatistics statistics = {};
     if (canDelegate) {
       [layoutDelegateClass calculateLayoutWithContext:layoutContext];
     } else {
@@ -642,22 +766,24 @@ typedef void (^ASDataControllerSynchronizationBlock)();
           [elementsToProcess addObject:element];
         }
       }
-      [self _allocateNodesFromElements:elementsToProcess];
+      if (prioritizeVisibleItems) {
+        const NSUInteger maximumDistance = (measureLazily ? visibleItems.length * kASDataControllerLazyMeasurementScreenfuls : NSUIntegerMax);
+        [self _allocateNodesFromElements:elementsToProcess inMap:newMap visibleItems:visibleItems maximumDistance:maximumDistance updateTime:updateTime statistics:&statistics];
+      } else {
+        [self _allocateNodesFromElements:elementsToProcess];
+        statistics.timeToVisibleNodes = statistics.timeToAllNodes = CACurrentMediaTime() - updateTime;
+        statistics.allocatedNodes = elementsToProcess.count;
+      }
+      os_log_debug(ASCollectionLog(), "Allocated %lu nodes, %lu visible, in %.1fms, visible ones in %.1fms, %lu deferred", (unsigned long)statistics.allocatedNodes, (unsigned long)statistics.visibleNodes, statistics.timeToAllNodes * 1000, statistics.timeToVisibleNodes * 1000, (unsigned long)statistics.deferredNodes);
     }
 
     // Step 4: Inform the delegate on main thread
     [self->_mainSerialQueue performBlockOnMainThread:^{
       as_activity_scope_leave(&preparationScope);
-      [self->_delegate dataController:self updateWithChangeSet:changeSet updates:^{
-        // Step 5: Deploy the new data as "completed"
-        //
-        // Note that since the backing collection view might be busy responding to user events (e.g scrolling),
-        // it will not consume the batch update blocks immediately.
-        // As a result, in a short intermidate time, the view will still be relying on the old data source state.
-        // Thus, we can't just swap the new map immediately before step 4, but until this update block is executed.
-        // (https://github.com/TextureGroup/Texture/issues/378)
-        self.visibleMap = newMap;
-      }];
+      if (statistics.allocatedNodes > 0) {
+        self->_allocationStatistics = statistics;
+      }
+      [self _commitChangeSet:changeSet map:newMap];
     }];
     --self->_editingTransactionGroupCount;
   });
@@ -833,6 +959,39 @@ typedef void (^ASDataControllerSynchronizationBlock)();
   }
 }
 
+- (void)measureElements:(NSArray<ASCollectionElement *> *)elements
+{
+  ASDisplayNodeAssertMainThread();
+  const auto elementsToMeasure = [[NSMutableArray<ASCollectionElement *> alloc] init];
+  for (ASCollectionElement *element in elements) {
+    ASCellNode *nodeIfAllocated = element.nodeIfAllocated;
+    if (nodeIfAllocated == nil || (!nodeIfAllocated.shouldUseUIKitCell && nodeIfAllocated.calculatedLayout == nil)) {
+      [elementsToMeasure addObject:element];
+    }
+  }
+  if (elementsToMeasure.count == 0) {
+    return;
+  }
+
+  // On the editing queue, so it can't overtake the update that created the elements. Not counted as processing
+  // updates, since the data doesn't change.
+  dispatch_group_async(_editingTransactionGroup, _editingTransactionQueue, ^{
+    [self _allocateNodesFromElements:elementsToMeasure];
+  });
+}
+
+- (ASDataControllerAllocationStatistics)allocationStatistics
+{
+  ASDisplayNodeAssertMainThread();
+  return _allocationStatistics;
+}
+
+- (ASDataControllerRelayoutStatistics)relayoutStatistics
+{
+  ASDisplayNodeAssertMainThread();
+  return _relayoutStatistics;
+}
+
 - (void)relayoutAllNodesWithInvalidationBlock:(nullable void (^)())invalidationBlock
 {
   ASDisplayNodeAssertMainThread();
@@ -870,6 +1029,7 @@ typedef void (^ASDataControllerSynchronizationBlock)();
   _pendingMap = [newMap copy];
   _visibleMap = _pendingMap;
 
+  const BOOL incremental = ASActivateExperimentalFeature(ASExperimentalIncrementalRelayout);
   for (ASCollectionElement *element in _visibleMap) {
     // Ignore this element if it is no longer in the latest data. It is still recognized in the UIKit world but will be deleted soon.
     NSIndexPath *indexPathInPendingMap = [_pendingMap indexPathForElement:element];
@@ -881,13 +1041,22 @@ typedef void (^ASDataControllerSynchronizationBlock)();
     ASSizeRange newConstrainedSize = [self constrainedSizeForNodeOfKind:kind atIndexPath:indexPathInPendingMap];
 
     if (ASSizeRangeHasSignificantArea(newConstrainedSize)) {
+      const ASSizeRange oldConstrainedSize = element.constrainedSize;
       element.constrainedSize = newConstrainedSize;
 
       // Node may not be allocated yet (e.g node virtualization or same size optimization)
       // Call context.nodeIfAllocated here to avoid premature node allocation and layout
       ASCellNode *node = element.nodeIfAllocated;
       if (node) {
+        // Nothing to do if the node was measured with the same constraint and its layout is still valid and applied.
+        if (incremental && ASSizeRangeEqualToSizeRange(oldConstrainedSize, newConstrainedSize)
+            && [node _hasValidLayoutForConstrainedSize:newConstrainedSize]
+            && CGSizeEqualToSize(node.frame.size, node.calculatedSize)) {
+          _relayoutStatistics.skippedNodes++;
+          continue;
+        }
         [self _layoutNode:node withConstrainedSize:newConstrainedSize];
+        _relayoutStatistics.relaidOutNodes++;
       }
     }
   }
@@ -906,8 +1075,23 @@ typedef void (^ASDataControllerSynchronizationBlock)();
     // i.e there might be some elements that were allocated using the old trait collection but haven't been added to _visibleMap
     [self _scheduleBlockOnMainSerialQueue:^{
       ASPrimitiveTraitCollection newTraitCollection = [self.node primitiveTraitCollection];
+      const BOOL incremental = ASActivateExperimentalFeature(ASExperimentalIncrementalRelayout);
       for (ASCollectionElement *element in self->_visibleMap) {
+        const BOOL traitsChanged = !ASPrimitiveTraitCollectionIsEqualToASPrimitiveTraitCollection(element.traitCollection, newTraitCollection);
         element.traitCollection = newTraitCollection;
+
+        // Only the cells with a node in them that read the traits depend on the change. Invalidating the cell
+        // requeries its size through -nodeDidInvalidateSize:, the subtrees that didn't read the traits stay cached.
+        ASCellNode *node = element.nodeIfAllocated;
+        if (!incremental || !traitsChanged || node == nil) {
+          continue;
+        }
+        if ([node _invalidateLayoutsThatReadTraitCollection]) {
+          [node _u_setNeedsLayoutFromAbove];
+          self->_relayoutStatistics.relaidOutNodes++;
+        } else {
+          self->_relayoutStatistics.skippedNodes++;
+        }
       }
     }];
   });
@@ -924,6 +1108,39 @@ typedef void (^ASDataControllerSynchronizationBlock)();
 
 # pragma mark - Helper methods
 
+/**
+ * Step 4 of -updateWithChangeSet:, on the main serial queue. With ASExperimentalCoalesceChangeSets, a change set whose
+ * successor is already being prepared is held back and submitted together with it, as one batch update: during a burst
+ * of updates, the view then animates once and lays out once rather than once per update.
+ */
+- (void)_commitChangeSet:(_ASHierarchyChangeSet *)changeSet map:(ASElementMap *)newMap
+{
+  ASDisplayNodeAssertMainThread();
+  --_uncommittedUpdateCount;
+  if (ASActivateExperimentalFeature(ASExperimentalCoalesceChangeSets)) {
+    if (_uncommittedChangeSets == nil) {
+      _uncommittedChangeSets = [[NSMutableArray alloc] init];
+    }
+    [_uncommittedChangeSets addObject:changeSet];
+    if (_uncommittedUpdateCount > 0) {
+      return;
+    }
+    changeSet = [_ASHierarchyChangeSet changeSetByMergingChangeSets:_uncommittedChangeSets];
+    [_uncommittedChangeSets removeAllObjects];
+  }
+
+  [_delegate dataController:self updateWithChangeSet:changeSet updates:^{
+    // Step 5: Deploy the new data as "completed"
+    //
+    // Note that since the backing collection view might be busy responding to user events (e.g scrolling),
+    // it will not consume the batch update blocks immediately.
+    // As a result, in a short intermidate time, the view will still be relying on the old data source state.
+    // Thus, we can't just swap the new map immediately before step 4, but until this update block is executed.
+    // (https://github.com/TextureGroup/Texture/issues/378)
+    self.visibleMap = newMap;
+  }];
+}
+
 - (void)_scheduleBlockOnMainSerialQueue:(dispatch_block_t)block
 {
   ASDisplayNodeAssertMainThread();
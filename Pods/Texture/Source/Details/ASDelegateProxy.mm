@@ -33,6 +33,7 @@
           // handled by ASTableView node<->cell machinery
           selector == @selector(tableView:cellForRowAtIndexPath:) ||
           selector == @selector(tableView:heightForRowAtIndexPath:) ||
+          selector == @selector(tableView:estimatedHeightForRowAtIndexPath:) ||
           
           // Selection, highlighting, menu
           selector == @selector(tableView:willSelectRowAtIndexPath:) ||
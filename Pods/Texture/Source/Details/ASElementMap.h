@@ -60,6 +60,23 @@ AS_SUBCLASSING_RESTRICTED
  */
 @property (copy, readonly) NSArray<ASCollectionElement *> *itemElements;
 
+/**
+ * The number of item elements in this map. O(1)
+ */
+@property (readonly) NSInteger numberOfItems;
+
+/**
+ * Returns the index of the given item element in itemElements, or NSNotFound if it isn't an item of this map. O(1)
+ *
+ * Flat indexes let clients keep per-item state in plain arrays or bitsets instead of index path sets.
+ */
+- (NSInteger)flatIndexOfItemElement:(ASCollectionElement *)element;
+
+/**
+ * Returns the item element at the given index of itemElements, or nil if the index is out of bounds. O(1)
+ */
+- (nullable ASCollectionElement *)itemElementAtFlatIndex:(NSInteger)flatIndex;
+
 /**
  * Returns the index path that corresponds to the same element in @c map at the given @c indexPath.
  * O(1) for items, fast O(N) for sections.
@@ -10,26 +10,38 @@
 #import <AsyncDisplayKit/ASElementMap.h>
 #import <UIKit/UIKit.h>
 #import <AsyncDisplayKit/ASCollectionElement.h>
-#import <AsyncDisplayKit/ASTwoDimensionalArrayUtils.h>
+#import <AsyncDisplayKit/ASElementMapStorage.h>
 #import <AsyncDisplayKit/ASMutableElementMap.h>
 #import <AsyncDisplayKit/ASSection.h>
 #import <AsyncDisplayKit/ASObjectDescriptionHelpers.h>
+#import <AsyncDisplayKit/ASThread.h>
+
+#import <atomic>
+#import <vector>
 
 @interface ASElementMap () <ASDescriptionProvider>
 
 @property (nonatomic, readonly) NSArray<ASSection *> *sections;
 
-// Element -> IndexPath
-@property (nonatomic, readonly) NSMapTable<ASCollectionElement *, NSIndexPath *> *elementToIndexPathMap;
-
-// The items, in a 2D array
-@property (nonatomic, readonly) ASCollectionElementTwoDimensionalArray *sectionsOfItems;
+// Supplementary element -> IndexPath. Items are looked up in _itemIndex.
+@property (nonatomic, readonly) NSMapTable<ASCollectionElement *, NSIndexPath *> *supplementaryElementToIndexPathMap;
 
 @property (nonatomic, readonly) ASSupplementaryElementDictionary *supplementaryElements;
 
 @end
 
-@implementation ASElementMap
+@implementation ASElementMap {
+  // The items, with sections shared with the maps this one was edited from or into.
+  std::shared_ptr<const AS::ElementMapStorage> _storage;
+
+  // Item element -> flat index, built on first lookup.
+  AS::ElementIndex _itemIndex;
+  std::atomic<bool> _hasItemIndex;
+  AS::Mutex _itemIndexLock;
+
+  // The supplementary elements, kept alive by _supplementaryElements, for enumeration.
+  std::vector<unowned ASCollectionElement *> _supplementaryElementList;
+}
 
 - (instancetype)init
 {
@@ -38,28 +50,26 @@
 
 - (instancetype)initWithSections:(NSArray<ASSection *> *)sections items:(ASCollectionElementTwoDimensionalArray *)items supplementaryElements:(ASSupplementaryElementDictionary *)supplementaryElements
 {
-  NSCParameterAssert(items.count == sections.count);
+  return [self initWithSections:sections storage:AS::ElementMapStorage(items) supplementaryElements:supplementaryElements];
+}
+
+- (instancetype)initWithSections:(NSArray<ASSection *> *)sections storage:(const AS::ElementMapStorage &)storage supplementaryElements:(ASSupplementaryElementDictionary *)supplementaryElements
+{
+  NSCParameterAssert(storage.sectionCount() == (NSInteger)sections.count);
 
   if (self = [super init]) {
     _sections = [sections copy];
-    _sectionsOfItems = [[NSArray alloc] initWithArray:items copyItems:YES];
+    auto sharedStorage = std::make_shared<AS::ElementMapStorage>(storage);
+    sharedStorage->updateOffsets();
+    _storage = sharedStorage;
     _supplementaryElements = [[NSDictionary alloc] initWithDictionary:supplementaryElements copyItems:YES];
 
-    // Setup our index path map
-    _elementToIndexPathMap = [NSMapTable mapTableWithKeyOptions:(NSMapTableStrongMemory | NSMapTableObjectPointerPersonality) valueOptions:NSMapTableCopyIn];
-    NSInteger s = 0;
-    for (NSArray *section in _sectionsOfItems) {
-      NSInteger i = 0;
-      for (ASCollectionElement *element in section) {
-        NSIndexPath *indexPath = [NSIndexPath indexPathForItem:i inSection:s];
-        [_elementToIndexPathMap setObject:indexPath forKey:element];
-        i++;
-      }
-      s++;
-    }
+    // Setup our index path map for supplementary elements. There are usually a handful per section at most.
+    _supplementaryElementToIndexPathMap = [NSMapTable mapTableWithKeyOptions:(NSMapTableStrongMemory | NSMapTableObjectPointerPersonality) valueOptions:NSMapTableCopyIn];
     for (NSDictionary *supplementariesForKind in [_supplementaryElements objectEnumerator]) {
       [supplementariesForKind enumerateKeysAndObjectsUsingBlock:^(NSIndexPath *_Nonnull indexPath, ASCollectionElement * _Nonnull element, BOOL * _Nonnull stop) {
-        [_elementToIndexPathMap setObject:indexPath forKey:element];
+        [_supplementaryElementToIndexPathMap setObject:indexPath forKey:element];
+        _supplementaryElementList.push_back(element);
       }];
     }
   }
@@ -68,22 +78,59 @@
 
 - (NSUInteger)count
 {
-  return _elementToIndexPathMap.count;
+  return _storage->itemCount() + _supplementaryElementList.size();
 }
 
 - (NSArray<NSIndexPath *> *)itemIndexPaths
 {
-  return ASIndexPathsForTwoDimensionalArray(_sectionsOfItems);
+  NSMutableArray<NSIndexPath *> *result = [[NSMutableArray alloc] initWithCapacity:_storage->itemCount()];
+  _storage->forEachItem([&](ASCollectionElement *element, NSInteger section, NSInteger item) {
+    [result addObject:[NSIndexPath indexPathForItem:item inSection:section]];
+  });
+  return result;
 }
 
 - (NSArray<ASCollectionElement *> *)itemElements
 {
-  return ASElementsInTwoDimensionalArray(_sectionsOfItems);
+  std::vector<unowned ASCollectionElement *> elements;
+  elements.reserve(_storage->itemCount());
+  _storage->forEachItem([&](ASCollectionElement *element, NSInteger section, NSInteger item) {
+    elements.push_back(element);
+  });
+  return [NSArray arrayWithObjects:elements.data() count:elements.size()];
+}
+
+- (NSInteger)numberOfItems
+{
+  return _storage->itemCount();
+}
+
+- (NSInteger)flatIndexOfItemElement:(ASCollectionElement *)element
+{
+  if (element == nil || element.supplementaryElementKind != nil) {
+    return NSNotFound;
+  }
+  if (!_hasItemIndex.load(std::memory_order_acquire)) {
+    AS::MutexLocker l(_itemIndexLock);
+    if (!_hasItemIndex.load(std::memory_order_relaxed)) {
+      _itemIndex.build(*_storage);
+      _hasItemIndex.store(true, std::memory_order_release);
+    }
+  }
+  return _itemIndex.find(element);
+}
+
+- (nullable ASCollectionElement *)itemElementAtFlatIndex:(NSInteger)flatIndex
+{
+  if (flatIndex < 0 || flatIndex >= _storage->itemCount()) {
+    return nil;
+  }
+  return _storage->elementAtFlatIndex(flatIndex);
 }
 
 - (NSInteger)numberOfSections
 {
-  return _sectionsOfItems.count;
+  return _storage->sectionCount();
 }
 
 - (NSArray<NSString *> *)supplementaryElementKinds
@@ -97,7 +144,7 @@
     return 0;
   }
 
-  return _sectionsOfItems[section].count;
+  return _storage->itemCountInSection(section);
 }
 
 - (id<ASSectionContext>)contextForSection:(NSInteger)section
@@ -111,7 +158,18 @@
 
 - (nullable NSIndexPath *)indexPathForElement:(ASCollectionElement *)element
 {
-  return element ? [_elementToIndexPathMap objectForKey:element] : nil;
+  if (element == nil) {
+    return nil;
+  } else if (element.supplementaryElementKind != nil) {
+    return [_supplementaryElementToIndexPathMap objectForKey:element];
+  }
+
+  NSInteger flatIndex = [self flatIndexOfItemElement:element];
+  if (flatIndex == NSNotFound) {
+    return nil;
+  }
+  NSInteger section = _storage->sectionOfFlatIndex(flatIndex);
+  return [NSIndexPath indexPathForItem:flatIndex - _storage->sectionOffset(section) inSection:section];
 }
 
 - (nullable NSIndexPath *)indexPathForElementIfCell:(ASCollectionElement *)element
@@ -130,7 +188,7 @@
     return nil;
   }
 
-  return _sectionsOfItems[section][item];
+  return _storage->element(section, item);
 }
 
 - (nullable ASCollectionElement *)supplementaryElementOfKind:(NSString *)supplementaryElementKind atIndexPath:(NSIndexPath *)indexPath
@@ -188,24 +246,48 @@
 
 - (id)mutableCopyWithZone:(NSZone *)zone
 {
-  return [[ASMutableElementMap alloc] initWithSections:_sections items:_sectionsOfItems supplementaryElements:_supplementaryElements];
+  return [[ASMutableElementMap alloc] initWithSections:_sections storage:*_storage supplementaryElements:_supplementaryElements];
 }
 
 #pragma mark - NSFastEnumeration
 
 - (NSUInteger)countByEnumeratingWithState:(NSFastEnumerationState *)state objects:(id  _Nullable unowned [])buffer count:(NSUInteger)len
 {
-  return [_elementToIndexPathMap countByEnumeratingWithState:state objects:buffer count:len];
+  // Items in ascending order, then supplementary elements. state->state is the position of the next one.
+  // The map is immutable, so there are no mutations to watch.
+  state->mutationsPtr = &state->extra[0];
+  state->itemsPtr = buffer;
+
+  const NSUInteger itemCount = _storage->itemCount();
+  NSUInteger position = state->state;
+  NSUInteger count = 0;
+  if (position < itemCount) {
+    NSInteger section = _storage->sectionOfFlatIndex(position);
+    NSInteger item = position - _storage->sectionOffset(section);
+    while (count < len && position < itemCount) {
+      if (item == _storage->itemCountInSection(section)) {
+        section++;
+        item = 0;
+        continue;
+      }
+      buffer[count++] = _storage->element(section, item++);
+      position++;
+    }
+  }
+  while (count < len && position - itemCount < _supplementaryElementList.size()) {
+    buffer[count++] = _supplementaryElementList[position - itemCount];
+    position++;
+  }
+  state->state = position;
+  return count;
 }
 
 - (NSString *)smallDescription
 {
   NSMutableArray *sectionDescriptions = [NSMutableArray array];
 
-  NSUInteger i = 0;
-  for (NSArray *section in _sectionsOfItems) {
-    [sectionDescriptions addObject:[NSString stringWithFormat:@"<S%tu: %tu>", i, section.count]];
-    i++;
+  for (NSInteger i = 0; i < _storage->sectionCount(); i++) {
+    [sectionDescriptions addObject:[NSString stringWithFormat:@"<S%ld: %ld>", (long)i, (long)_storage->itemCountInSection(i)]];
   }
   return ASObjectDescriptionMakeWithoutObject(@[ @{ @"itemCounts": sectionDescriptions }]);
 }
@@ -220,7 +302,14 @@
 - (NSMutableArray<NSDictionary *> *)propertiesForDescription
 {
   NSMutableArray *result = [NSMutableArray array];
-  [result addObject:@{ @"items" : _sectionsOfItems }];
+  NSMutableArray<NSMutableArray<ASCollectionElement *> *> *items = [NSMutableArray array];
+  for (NSInteger i = 0; i < _storage->sectionCount(); i++) {
+    [items addObject:[NSMutableArray array]];
+  }
+  _storage->forEachItem([&](ASCollectionElement *element, NSInteger section, NSInteger item) {
+    [items[section] addObject:element];
+  });
+  [result addObject:@{ @"items" : items }];
   [result addObject:@{ @"supplementaryElements" : _supplementaryElements }];
   return result;
 }
@@ -232,7 +321,7 @@
  */
 - (BOOL)sectionIndexIsValid:(NSInteger)section assert:(BOOL)assert
 {
-  NSInteger sectionCount = _sectionsOfItems.count;
+  NSInteger sectionCount = _storage->sectionCount();
   if (section >= sectionCount || section < 0) {
     if (assert) {
       ASDisplayNodeFailAssert(@"Invalid section index %ld when there are only %ld sections!", (long)section, (long)sectionCount);
@@ -259,7 +348,7 @@
     return NO;
   }
 
-  NSInteger itemCount = _sectionsOfItems[section].count;
+  NSInteger itemCount = _storage->itemCountInSection(section);
   NSInteger item = indexPath.item;
   if (item >= itemCount || item < 0) {
     if (assert) {
@@ -13,12 +13,15 @@ NS_ASSUME_NONNULL_BEGIN
 
 /**
  * An objective-C wrapper for unordered_map.
+ *
+ * Maps created for an update are stored as ranges of keys that are shifted by the same amount, O(changed ranges)
+ * in size, and become a plain unordered_map when mutated.
  */
 AS_SUBCLASSING_RESTRICTED
 @interface ASIntegerMap : NSObject <NSCopying>
 
 /**
- * Creates a map based on the specified update to an array.
+ * Creates a map based on the specified update to an array. O(changed ranges), lookups O(log changed ranges).
  *
  * If oldCount is 0, returns the empty map.
  * If deleted and inserted are empty, returns the identity map.
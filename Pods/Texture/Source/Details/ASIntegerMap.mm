@@ -8,19 +8,103 @@
 
 #import "ASIntegerMap.h"
 #import <AsyncDisplayKit/ASAssert.h>
+#import <algorithm>
 #import <unordered_map>
+#import <vector>
 #import <AsyncDisplayKit/ASObjectDescriptionHelpers.h>
 
+namespace {
+
+/**
+ * Keys in [start, end) map to key + delta. Maps built from an update are increasing, so they are a few such
+ * segments, one per run of items between changes, sorted by start.
+ */
+struct ASIntegerMapSegment {
+  NSInteger start;
+  NSInteger end;
+  NSInteger delta;
+};
+
+typedef std::vector<ASIntegerMapSegment> ASIntegerMapSegments;
+
+std::vector<NSRange> ASIntegerMapRanges(NSIndexSet *indexes)
+{
+  std::vector<NSRange> ranges;
+  [indexes enumerateRangesUsingBlock:^(NSRange range, BOOL * _Nonnull stop) {
+    ranges.push_back(range);
+  }];
+  return ranges;
+}
+
 /**
- * This is just a friendly Objective-C interface to unordered_map<NSInteger, NSInteger>
+ * The segments for an update, in one pass over the deleted and inserted ranges: each run of surviving old
+ * indexes takes the next free new indexes, skipping inserted ones.
+ */
+ASIntegerMapSegments ASIntegerMapSegmentsForUpdate(NSInteger oldCount, const std::vector<NSRange> &deleted, const std::vector<NSRange> &inserted)
+{
+  ASIntegerMapSegments segments;
+  segments.reserve(deleted.size() + inserted.size() + 1);
+
+  NSInteger newIndex = 0;
+  auto insertion = inserted.begin();
+  const auto addRun = [&](NSInteger start, NSInteger end) {
+    while (start < end) {
+      // Inserted indexes are taken.
+      while (insertion != inserted.end() && (NSInteger)insertion->location <= newIndex) {
+        newIndex = std::max(newIndex, (NSInteger)NSMaxRange(*insertion));
+        insertion++;
+      }
+      const NSInteger available = (insertion != inserted.end() ? (NSInteger)insertion->location - newIndex : NSIntegerMax);
+      const NSInteger length = std::min(end - start, available);
+      const NSInteger delta = newIndex - start;
+      if (!segments.empty() && segments.back().end == start && segments.back().delta == delta) {
+        segments.back().end += length;
+      } else {
+        segments.push_back({start, start + length, delta});
+      }
+      start += length;
+      newIndex += length;
+    }
+  };
+
+  NSInteger oldIndex = 0;
+  for (const NSRange &range : deleted) {
+    const NSInteger location = std::min((NSInteger)range.location, oldCount);
+    addRun(oldIndex, location);
+    oldIndex = std::max(oldIndex, std::min((NSInteger)NSMaxRange(range), oldCount));
+  }
+  addRun(oldIndex, oldCount);
+  return segments;
+}
+
+NSInteger ASIntegerMapSegmentsLookup(const ASIntegerMapSegments &segments, NSInteger key)
+{
+  // The last segment starting at or before the key.
+  auto segment = std::upper_bound(segments.begin(), segments.end(), key, [](NSInteger key, const ASIntegerMapSegment &segment) {
+    return key < segment.start;
+  });
+  if (segment == segments.begin()) {
+    return NSNotFound;
+  }
+  segment--;
+  return key < segment->end ? key + segment->delta : NSNotFound;
+}
+
+} // namespace
+
+/**
+ * This is just a friendly Objective-C interface to unordered_map<NSInteger, NSInteger>. Maps for updates are
+ * kept as segments instead, until they are mutated.
  */
 @interface ASIntegerMap () <ASDescriptionProvider>
 @end
 
 @implementation ASIntegerMap {
   std::unordered_map<NSInteger, NSInteger> _map;
+  ASIntegerMapSegments _segments;
   BOOL _isIdentity;
   BOOL _isEmpty;
+  BOOL _isSegmented; // _segments holds the map, _map is unused.
   BOOL _immutable; // identity map and empty mape are immutable.
 }
 
@@ -61,31 +145,8 @@
   }
 
   ASIntegerMap *result = [[ASIntegerMap alloc] init];
-  // Start with the old indexes
-  NSMutableIndexSet *indexes = [NSMutableIndexSet indexSetWithIndexesInRange:NSMakeRange(0, oldCount)];
-
-  // Descending order, shift deleted ranges left
-  [deletions enumerateRangesWithOptions:NSEnumerationReverse usingBlock:^(NSRange range, BOOL * _Nonnull stop) {
-    [indexes shiftIndexesStartingAtIndex:NSMaxRange(range) by:-range.length];
-  }];
-
-  // Ascending order, shift inserted ranges right
-  [insertions enumerateRangesUsingBlock:^(NSRange range, BOOL * _Nonnull stop) {
-    [indexes shiftIndexesStartingAtIndex:range.location by:range.length];
-  }];
-
-  __block NSInteger oldIndex = 0;
-  [indexes enumerateRangesUsingBlock:^(NSRange range, BOOL * _Nonnull stop) {
-    // Note we advance oldIndex unconditionally, not newIndex
-    for (NSInteger newIndex = range.location; newIndex < NSMaxRange(range); oldIndex++) {
-      if ([deletions containsIndex:oldIndex]) {
-        // index was deleted, do nothing, just let oldIndex advance.
-      } else {
-        // assign the next index for this item.
-        result->_map[oldIndex] = newIndex++;
-      }
-    }
-  }];
+  result->_segments = ASIntegerMapSegmentsForUpdate(oldCount, ASIntegerMapRanges(deletions), ASIntegerMapRanges(insertions));
+  result->_isSegmented = YES;
   return result;
 }
 
@@ -95,6 +156,8 @@
     return key;
   } else if (_isEmpty) {
     return NSNotFound;
+  } else if (_isSegmented) {
+    return ASIntegerMapSegmentsLookup(_segments, key);
   }
 
   const auto result = _map.find(key);
@@ -108,6 +171,7 @@
     return;
   }
 
+  [self _materializeSegments];
   _map[key] = value;
 }
 
@@ -118,7 +182,17 @@
   }
 
   const auto result = [[ASIntegerMap alloc] init];
-  
+
+  if (_isSegmented) {
+    // Increasing maps are one-to-one, so the inverse is the same segments, moved.
+    result->_isSegmented = YES;
+    result->_segments.reserve(_segments.size());
+    for (const auto &segment : _segments) {
+      result->_segments.push_back({segment.start + segment.delta, segment.end + segment.delta, -segment.delta});
+    }
+    return result;
+  }
+
   for (const auto &e : _map) {
     result->_map[e.second] = e.first;
   }
@@ -135,6 +209,8 @@
 
   const auto newMap = [[ASIntegerMap allocWithZone:zone] init];
   newMap->_map = _map;
+  newMap->_segments = _segments;
+  newMap->_isSegmented = _isSegmented;
   return newMap;
 }
 
@@ -151,6 +227,11 @@
   } else {
     // { 1->2 3->4 5->6 }
     NSMutableString *str = [NSMutableString string];
+    for (const auto &segment : _segments) {
+      for (NSInteger key = segment.start; key < segment.end; key++) {
+        [str appendFormat:@" %ld->%ld", (long)key, (long)(key + segment.delta)];
+      }
+    }
     for (const auto &e : _map) {
       [str appendFormat:@" %ld->%ld", (long)e.first, (long)e.second];
     }
@@ -176,9 +257,47 @@
   }
 
   if (ASIntegerMap *otherMap = ASDynamicCast(object, ASIntegerMap)) {
-    return otherMap->_map == _map;
+    if (_isSegmented && otherMap->_isSegmented) {
+      // Segments are merged as they are built, so equal maps have equal segments.
+      return _segments.size() == otherMap->_segments.size()
+          && std::equal(_segments.begin(), _segments.end(), otherMap->_segments.begin(), [](const ASIntegerMapSegment &a, const ASIntegerMapSegment &b) {
+        return a.start == b.start && a.end == b.end && a.delta == b.delta;
+      });
+    }
+    return [self _entries] == [otherMap _entries];
   }
   return NO;
 }
 
+#pragma mark - Internal
+
+/**
+ * All the entries, as a hash map. O(N) for segmented maps.
+ */
+- (std::unordered_map<NSInteger, NSInteger>)_entries
+{
+  if (!_isSegmented) {
+    return _map;
+  }
+  std::unordered_map<NSInteger, NSInteger> entries;
+  for (const auto &segment : _segments) {
+    for (NSInteger key = segment.start; key < segment.end; key++) {
+      entries[key] = key + segment.delta;
+    }
+  }
+  return entries;
+}
+
+/**
+ * Moves segments into the hash map, which holds arbitrary maps.
+ */
+- (void)_materializeSegments
+{
+  if (_isSegmented) {
+    _map = [self _entries];
+    _segments.clear();
+    _isSegmented = NO;
+  }
+}
+
 @end
@@ -35,6 +35,11 @@ typedef struct ASDirectionalScreenfulBuffer ASDirectionalScreenfulBuffer;
 
 @optional
 
+/**
+ * Called by the range controller at the start of every range update, before it asks for any range.
+ */
+- (void)prepareForRangeUpdate;
+
 @end
 
 NS_ASSUME_NONNULL_END
@@ -0,0 +1,78 @@
+//
+//  ASLayoutMemoCache.h
+//  Texture
+//
+//  Copyright (c) Pinterest, Inc.  All rights reserved.
+//  Licensed under Apache 2.0: http://www.apache.org/licenses/LICENSE-2.0
+//
+
+#import <Foundation/Foundation.h>
+#import <AsyncDisplayKit/ASBaseDefines.h>
+#import <AsyncDisplayKit/ASDimension.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ * The layout memo cache shares measurements between equivalent nodes, e.g. the text nodes of structurally
+ * identical cells. It is enabled with ASExperimentalLayoutMemoCache.
+ *
+ * A node opts in by returning a key from -[ASDisplayNode layoutMemoKey]. Nodes of the same class, with equal keys,
+ * measured with the same size range, are assumed to lay out identically. Only leaf layouts (without sublayouts)
+ * are cached, so an entry is just a size and the baseline metrics of the node's style.
+ *
+ * The cache is process-wide, thread safe, and holds at most a fixed number of entries, evicting the least
+ * recently used one.
+ */
+
+/**
+ * An immutable layout memo key: a list of objects compared with -isEqual:, plus raw bytes compared bitwise.
+ * The hash combines the hashes of the objects with ASHashBytes() of the bytes.
+ *
+ * @warning Like with ASHashBytes(), zero out structs before filling them in, so padding doesn't differ.
+ */
+AS_SUBCLASSING_RESTRICTED
+@interface ASLayoutMemoKey : NSObject <NSCopying>
+
+- (instancetype)initWithObjects:(NSArray *)objects bytes:(nullable const void *)bytes length:(size_t)length NS_DESIGNATED_INITIALIZER;
+
+- (instancetype)init NS_UNAVAILABLE;
++ (instancetype)new NS_UNAVAILABLE;
+
+@end
+
+typedef struct {
+  /** Lookups that returned a cached measurement. */
+  NSUInteger hits;
+  /** Lookups that found nothing, i.e. the node was measured. */
+  NSUInteger misses;
+  /** Entries dropped to make room for newer ones. */
+  NSUInteger evictions;
+  /** Entries currently in the cache. */
+  NSUInteger count;
+} ASLayoutMemoCacheStatistics;
+
+/// A snapshot of the cache statistics since launch or the last reset.
+ASDK_EXTERN ASLayoutMemoCacheStatistics ASLayoutMemoCacheGetStatistics(void);
+
+/// Resets hits, misses and evictions to zero.
+ASDK_EXTERN void ASLayoutMemoCacheResetStatistics(void);
+
+/// Drops all entries. Called on memory warnings; call it yourself e.g. after a content size category change.
+ASDK_EXTERN void ASLayoutMemoCacheRemoveAllEntries(void);
+
+#pragma mark - Internal
+
+/// A cached measurement.
+typedef struct {
+  CGSize size;
+  CGFloat ascender;
+  CGFloat descender;
+} ASLayoutMemoValue;
+
+/// Used by ASDisplayNode. Returns YES and fills in `value` on a hit.
+ASDK_EXTERN BOOL ASLayoutMemoCacheLookup(Class nodeClass, id key, ASSizeRange sizeRange, ASLayoutMemoValue *value);
+
+/// Used by ASDisplayNode.
+ASDK_EXTERN void ASLayoutMemoCacheStore(Class nodeClass, id key, ASSizeRange sizeRange, ASLayoutMemoValue value);
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,227 @@
+//
+//  ASLayoutMemoCache.mm
+//  Texture
+//
+//  Copyright (c) Pinterest, Inc.  All rights reserved.
+//  Licensed under Apache 2.0: http://www.apache.org/licenses/LICENSE-2.0
+//
+
+#import <AsyncDisplayKit/ASLayoutMemoCache.h>
+
+#import <UIKit/UIKit.h>
+
+#import <list>
+#import <unordered_map>
+
+#import <AsyncDisplayKit/ASHashing.h>
+#import <AsyncDisplayKit/ASThread.h>
+
+using AS::MutexLocker;
+
+#pragma mark - ASLayoutMemoKey
+
+@implementation ASLayoutMemoKey {
+  NSArray *_objects;
+  NSData *_bytes;
+  NSUInteger _hash;
+}
+
+- (instancetype)initWithObjects:(NSArray *)objects bytes:(const void *)bytes length:(size_t)length
+{
+  if (self = [super init]) {
+    _objects = [objects copy];
+    _bytes = length > 0 ? [NSData dataWithBytes:bytes length:length] : nil;
+
+    struct {
+      NSUInteger objectsHash;
+      NSUInteger bytesHash;
+    } data;
+    data.objectsHash = 0;
+    for (id object in _objects) {
+      data.objectsHash = data.objectsHash * 31 + [object hash];
+    }
+    data.bytesHash = length > 0 ? ASHashBytes((void *)bytes, length) : 0;
+    _hash = ASHashBytes(&data, sizeof(data));
+  }
+  return self;
+}
+
+- (id)copyWithZone:(NSZone *)zone
+{
+  return self;
+}
+
+- (NSUInteger)hash
+{
+  return _hash;
+}
+
+- (BOOL)isEqual:(id)object
+{
+  if (self == object) {
+    return YES;
+  }
+  if (![object isKindOfClass:[ASLayoutMemoKey class]]) {
+    return NO;
+  }
+  ASLayoutMemoKey *other = object;
+  return _hash == other->_hash
+      && (_bytes == other->_bytes || [_bytes isEqualToData:other->_bytes])
+      && [_objects isEqualToArray:other->_objects];
+}
+
+@end
+
+#pragma mark - Cache
+
+namespace {
+
+/// Number of entries kept. Cells on screen plus the preload range rarely have more distinct leaves than this.
+static const size_t kCapacity = 1024;
+
+struct Key {
+  unowned Class nodeClass;
+  id key;
+  ASSizeRange sizeRange;
+  NSUInteger hash;
+
+  Key(Class nodeClass, id key, ASSizeRange sizeRange) : nodeClass(nodeClass), key(key), sizeRange(sizeRange)
+  {
+    struct {
+      uintptr_t nodeClass;
+      NSUInteger keyHash;
+      ASSizeRange sizeRange;
+    } data;
+    data.nodeClass = (uintptr_t)(__bridge void *)nodeClass;
+    data.keyHash = [key hash];
+    data.sizeRange = sizeRange;
+    hash = ASHashBytes(&data, sizeof(data));
+  }
+
+  bool operator==(const Key &other) const
+  {
+    return hash == other.hash
+        && nodeClass == other.nodeClass
+        && ASSizeRangeEqualToSizeRange(sizeRange, other.sizeRange)
+        && (key == other.key || [key isEqual:other.key]);
+  }
+};
+
+struct Entry {
+  Key key;
+  ASLayoutMemoValue value;
+};
+
+struct KeyPointerHash {
+  size_t operator()(const Key *key) const { return key->hash; }
+};
+
+struct KeyPointerEqual {
+  bool operator()(const Key *lhs, const Key *rhs) const { return *lhs == *rhs; }
+};
+
+/**
+ * LRU map from keys to measurements. The list holds the entries, most recently used first;
+ * the map indexes them by key.
+ */
+class LayoutMemoCache {
+public:
+  static LayoutMemoCache &shared()
+  {
+    static LayoutMemoCache *cache;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+      cache = new LayoutMemoCache();
+      [[NSNotificationCenter defaultCenter] addObserverForName:UIApplicationDidReceiveMemoryWarningNotification object:nil queue:nil usingBlock:^(NSNotification *note) {
+        cache->removeAllEntries();
+      }];
+    });
+    return *cache;
+  }
+
+  bool lookup(const Key &key, ASLayoutMemoValue *value)
+  {
+    MutexLocker l(_mutex);
+    const auto it = _index.find(&key);
+    if (it == _index.end()) {
+      _statistics.misses++;
+      return false;
+    }
+    _entries.splice(_entries.begin(), _entries, it->second);
+    *value = it->second->value;
+    _statistics.hits++;
+    return true;
+  }
+
+  void store(Key &&key, const ASLayoutMemoValue &value)
+  {
+    MutexLocker l(_mutex);
+    const auto it = _index.find(&key);
+    if (it != _index.end()) {
+      it->second->value = value;
+      _entries.splice(_entries.begin(), _entries, it->second);
+      return;
+    }
+    if (_entries.size() >= kCapacity) {
+      _index.erase(&_entries.back().key);
+      _entries.pop_back();
+      _statistics.evictions++;
+    }
+    _entries.push_front({std::move(key), value});
+    _index.emplace(&_entries.front().key, _entries.begin());
+  }
+
+  ASLayoutMemoCacheStatistics statistics()
+  {
+    MutexLocker l(_mutex);
+    ASLayoutMemoCacheStatistics statistics = _statistics;
+    statistics.count = _entries.size();
+    return statistics;
+  }
+
+  void resetStatistics()
+  {
+    MutexLocker l(_mutex);
+    _statistics = {};
+  }
+
+  void removeAllEntries()
+  {
+    MutexLocker l(_mutex);
+    _index.clear();
+    _entries.clear();
+  }
+
+private:
+  AS::Mutex _mutex;
+  std::list<Entry> _entries;
+  std::unordered_map<const Key *, std::list<Entry>::iterator, KeyPointerHash, KeyPointerEqual> _index;
+  ASLayoutMemoCacheStatistics _statistics = {};
+};
+
+} // namespace
+
+BOOL ASLayoutMemoCacheLookup(Class nodeClass, id key, ASSizeRange sizeRange, ASLayoutMemoValue *value)
+{
+  return LayoutMemoCache::shared().lookup(Key(nodeClass, key, sizeRange), value);
+}
+
+void ASLayoutMemoCacheStore(Class nodeClass, id key, ASSizeRange sizeRange, ASLayoutMemoValue value)
+{
+  LayoutMemoCache::shared().store(Key(nodeClass, key, sizeRange), value);
+}
+
+ASLayoutMemoCacheStatistics ASLayoutMemoCacheGetStatistics(void)
+{
+  return LayoutMemoCache::shared().statistics();
+}
+
+void ASLayoutMemoCacheResetStatistics(void)
+{
+  LayoutMemoCache::shared().resetStatistics();
+}
+
+void ASLayoutMemoCacheRemoveAllEntries(void)
+{
+  LayoutMemoCache::shared().removeAllEntries();
+}
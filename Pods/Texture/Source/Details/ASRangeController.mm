@@ -16,6 +16,7 @@
 #import <AsyncDisplayKit/ASDisplayNodeExtras.h>
 #import <AsyncDisplayKit/ASDisplayNodeInternal.h> // Required for interfaceState and hierarchyState setter methods.
 #import <AsyncDisplayKit/ASElementMap.h>
+#import <AsyncDisplayKit/ASIndexBitset.h>
 #import <AsyncDisplayKit/ASSignpost.h>
 
 #import <AsyncDisplayKit/ASCellNode+Internal.h>
@@ -32,7 +33,12 @@
 {
   BOOL _rangeIsValid;
   BOOL _needsRangeUpdate;
-  NSSet<NSIndexPath *> *_allPreviousIndexPaths;
+  // The items in each range, by flat index in the element map, reused across updates. The previous range is the
+  // union of the ranges of the last update.
+  AS::IndexBitset _visibleRange;
+  AS::IndexBitset _displayRange;
+  AS::IndexBitset _preloadRange;
+  AS::IndexBitset _previousRange;
   NSHashTable<ASCellNode *> *_visibleNodes;
   ASLayoutRangeMode _currentRangeMode;
   BOOL _contentHasBeenScrolled;
@@ -48,6 +54,8 @@
   
 #if AS_RANGECONTROLLER_LOG_UPDATE_FREQ
   NSUInteger _updateCountThisFrame;
+  NSUInteger _transitionCountThisFrame;
+  CFTimeInterval _updateDurationThisFrame;
   CADisplayLink *_displayLink;
 #endif
 }
@@ -56,6 +64,17 @@
 
 static UIApplicationState __ApplicationState = UIApplicationStateActive;
 
+static void ASRangeBitsetFill(AS::IndexBitset &range, NSHashTable<ASCollectionElement *> *elements, ASElementMap *map, NSInteger itemCount)
+{
+  range.reset(itemCount);
+  for (ASCollectionElement *element in elements) {
+    const NSInteger index = [map flatIndexOfItemElement:element];
+    if (index != NSNotFound) {
+      range.set(index);
+    }
+  }
+}
+
 @implementation ASRangeController
 
 #pragma mark - Lifecycle
@@ -213,6 +232,7 @@ static UIApplicationState __ApplicationState = UIApplicationStateActive;
 
 #if AS_RANGECONTROLLER_LOG_UPDATE_FREQ
   _updateCountThisFrame += 1;
+  const CFTimeInterval updateStartTime = CACurrentMediaTime();
 #endif
   
   ASElementMap *map = [_dataSource elementMapForRangeController:self];
@@ -231,6 +251,11 @@ static UIApplicationState __ApplicationState = UIApplicationStateActive;
   }
   _previousScrollDirection = scrollDirection;
 
+  // Lets the layout controller take its per-update measurements (e.g. the scroll position) once, before any range.
+  if ([_layoutController respondsToSelector:@selector(prepareForRangeUpdate)]) {
+    [_layoutController prepareForRangeUpdate];
+  }
+
   if (visibleElements.count == 0) { // if we don't have any visibleNodes currently (scrolled before or after content)...
     // Verify the actual state by checking the layout with a "VisibleOnly" range.
     // This allows us to avoid thrashing through -didExitVisibleState in the case of -reloadData, since that generates didEndDisplayingCell calls.
@@ -296,76 +321,71 @@ static UIApplicationState __ApplicationState = UIApplicationStateActive;
     }
   }
   
-  // For now we are only interested in items. Filter-map out from element to item-index-path.
-  NSSet<NSIndexPath *> *visibleIndexPaths = ASSetByFlatMapping(visibleElements, ASCollectionElement *element, [map indexPathForElementIfCell:element]);
-  NSSet<NSIndexPath *> *displayIndexPaths = ASSetByFlatMapping(displayElements, ASCollectionElement *element, [map indexPathForElementIfCell:element]);
-  NSSet<NSIndexPath *> *preloadIndexPaths = ASSetByFlatMapping(preloadElements, ASCollectionElement *element, [map indexPathForElementIfCell:element]);
+  // For now we are only interested in items. Mark each range in a bitset over the flat item indexes of the map.
+  const NSInteger itemCount = map.numberOfItems;
+  ASRangeBitsetFill(_visibleRange, visibleElements, map, itemCount);
+  if (displayElements == visibleElements) {
+    _displayRange = _visibleRange;
+  } else {
+    ASRangeBitsetFill(_displayRange, displayElements, map, itemCount);
+  }
+  if (preloadElements == displayElements) {
+    _preloadRange = _displayRange;
+  } else if (preloadElements == visibleElements) {
+    _preloadRange = _visibleRange;
+  } else {
+    ASRangeBitsetFill(_preloadRange, preloadElements, map, itemCount);
+  }
+  const AS::IndexBitset &visibleRange = _visibleRange;
+  const AS::IndexBitset &displayRange = _displayRange;
+  const AS::IndexBitset &preloadRange = _preloadRange;
+  const AS::IndexBitset &previousRange = _previousRange;
 
-  // Prioritize the order in which we visit each.  Visible nodes should be updated first so they are enqueued on
-  // the network or display queues before preloading (offscreen) nodes are enqueued.
-  NSMutableOrderedSet<NSIndexPath *> *allIndexPaths = [[NSMutableOrderedSet alloc] initWithSet:visibleIndexPaths];
-  
-  // Typically the preloadIndexPaths will be the largest, and be a superset of the others, though it may be disjoint.
-  // Because allIndexPaths is an NSMutableOrderedSet, this adds the non-duplicate items /after/ the existing items.
-  // This means that during iteration, we will first visit visible, then display, then preload nodes.
-  [allIndexPaths unionSet:displayIndexPaths];
-  [allIndexPaths unionSet:preloadIndexPaths];
-  
-  // Add anything we had applied interfaceState to in the last update, but is no longer in range, so we can clear any
-  // range flags it still has enabled.  Most of the time, all but a few elements are equal; a large programmatic
-  // scroll or major main thread stall could cause entirely disjoint sets.  In either case we must visit all.
-  // Calling "-set" on NSMutableOrderedSet just references the underlying mutable data store, so we must copy it.
-  NSSet<NSIndexPath *> *allCurrentIndexPaths = [[allIndexPaths set] copy];
-  [allIndexPaths unionSet:_allPreviousIndexPaths];
-  _allPreviousIndexPaths = allCurrentIndexPaths;
-  
   _currentRangeMode = rangeMode;
   _preserveCurrentRangeMode = NO;
-  
-  if (!_rangeIsValid) {
-    [allIndexPaths addObjectsFromArray:map.itemIndexPaths];
-  }
-  
+
 #if ASRangeControllerLoggingEnabled
-  ASDisplayNodeAssertTrue([visibleIndexPaths isSubsetOfSet:displayIndexPaths]);
+  AS::IndexBitset::forEachIndex(itemCount, [&](size_t w) { return visibleRange.word(w) & ~displayRange.word(w); }, [](size_t index) {
+    ASDisplayNodeFailAssert(@"Visible item %zu is not in the display range.", index);
+  });
   NSMutableArray<NSIndexPath *> *modifiedIndexPaths = (ASRangeControllerLoggingEnabled ? [NSMutableArray array] : nil);
 #endif
 
-  for (NSIndexPath *indexPath in allIndexPaths) {
+  const auto visit = [&](size_t index) {
     // Before a node / indexPath is exposed to ASRangeController, ASDataController should have already measured it.
     // For consistency, make sure each node knows that it should measure itself if something changes.
     ASInterfaceState interfaceState = ASInterfaceStateMeasureLayout;
-    
+
     if (ASInterfaceStateIncludesVisible(selfInterfaceState)) {
-      if ([visibleIndexPaths containsObject:indexPath]) {
+      if (visibleRange.test(index)) {
         interfaceState |= (ASInterfaceStateVisible | ASInterfaceStateDisplay | ASInterfaceStatePreload);
       } else {
-        if ([preloadIndexPaths containsObject:indexPath]) {
+        if (preloadRange.test(index)) {
           interfaceState |= ASInterfaceStatePreload;
         }
-        if ([displayIndexPaths containsObject:indexPath]) {
+        if (displayRange.test(index)) {
           interfaceState |= ASInterfaceStateDisplay;
         }
       }
     } else {
-      // If selfInterfaceState isn't visible, then visibleIndexPaths represents either what /will/ be immediately visible at the
+      // If selfInterfaceState isn't visible, then visibleRange represents either what /will/ be immediately visible at the
       // instant we come onscreen, or what /will/ no longer be visible at the instant we come offscreen.
       // So, preload and display all of those things, but don't waste resources displaying others.
       //
       // DO NOT set Visible: even though these elements are in the visible range / "viewport",
       // our overall container object is itself not yet, or no longer, visible.
       // The moment it becomes visible, we will run the condition above.
-      if ([visibleIndexPaths containsObject:indexPath]) {
+      if (visibleRange.test(index)) {
         interfaceState |= ASInterfaceStatePreload;
         if (rangeMode != ASLayoutRangeModeLowMemory) {
           interfaceState |= ASInterfaceStateDisplay;
         }
-      } else if ([displayIndexPaths containsObject:indexPath]) {
+      } else if (displayRange.test(index)) {
         interfaceState |= ASInterfaceStatePreload;
       }
     }
 
-    ASCellNode *node = [map elementForItemAtIndexPath:indexPath].nodeIfAllocated;
+    ASCellNode *node = [map itemElementAtFlatIndex:index].nodeIfAllocated;
     if (node != nil) {
       ASDisplayNodeAssert(node.hierarchyState & ASHierarchyStateRangeManaged, @"All nodes reaching this point should be range-managed, or interfaceState may be incorrectly reset.");
       if (ASInterfaceStateIncludesVisible(interfaceState)) {
@@ -374,7 +394,10 @@ static UIApplicationState __ApplicationState = UIApplicationStateActive;
       // Skip the many method calls of the recursive operation if the top level cell node already has the right interfaceState.
       if (node.pendingInterfaceState != interfaceState) {
 #if ASRangeControllerLoggingEnabled
-        [modifiedIndexPaths addObject:indexPath];
+        [modifiedIndexPaths addObject:[map indexPathForElement:[map itemElementAtFlatIndex:index]]];
+#endif
+#if AS_RANGECONTROLLER_LOG_UPDATE_FREQ
+        _transitionCountThisFrame += 1;
 #endif
 
         BOOL nodeShouldScheduleDisplay = [node shouldScheduleDisplayWithNewInterfaceState:interfaceState];
@@ -388,7 +411,29 @@ static UIApplicationState __ApplicationState = UIApplicationStateActive;
         }
       }
     }
-  }
+  };
+
+  // Prioritize the order in which we visit each.  Visible nodes should be updated first so they are enqueued on
+  // the network or display queues before preloading (offscreen) nodes are enqueued. So we visit visible, then
+  // display, then preload items, each range minus the ones before it.
+  AS::IndexBitset::forEachIndex(itemCount, [&](size_t w) { return visibleRange.word(w); }, visit);
+  AS::IndexBitset::forEachIndex(itemCount, [&](size_t w) { return displayRange.word(w) & ~visibleRange.word(w); }, visit);
+  AS::IndexBitset::forEachIndex(itemCount, [&](size_t w) {
+    return preloadRange.word(w) & ~(visibleRange.word(w) | displayRange.word(w));
+  }, visit);
+
+  // Visit anything we had applied interfaceState to in the last update, but is no longer in range, so we can clear any
+  // range flags it still has enabled.  Most of the time, all but a few elements are equal; a large programmatic
+  // scroll or major main thread stall could cause entirely disjoint sets.  In either case we must visit all.
+  // After a data change, the indexes no longer match up, so we visit all remaining items instead.
+  const BOOL visitAllItems = !_rangeIsValid;
+  AS::IndexBitset::forEachIndex(itemCount, [&](size_t w) {
+    const AS::IndexBitset::Word inRange = visibleRange.word(w) | displayRange.word(w) | preloadRange.word(w);
+    return visitAllItems ? ~inRange : (previousRange.word(w) & ~inRange);
+  }, visit);
+
+  _previousRange.reset(itemCount);
+  _previousRange.assignUnion(visibleRange, displayRange, preloadRange);
 
   [self _setVisibleNodes:newVisibleNodes];
   
@@ -409,6 +454,10 @@ static UIApplicationState __ApplicationState = UIApplicationStateActive;
   }
   
   _rangeIsValid = YES;
+
+#if AS_RANGECONTROLLER_LOG_UPDATE_FREQ
+  _updateDurationThisFrame += CACurrentMediaTime() - updateStartTime;
+#endif
   
 #if ASRangeControllerLoggingEnabled
 //  NSSet *visibleNodePathsSet = [NSSet setWithArray:visibleNodePaths];
@@ -627,7 +676,13 @@ static ASLayoutRangeMode __rangeModeForMemoryWarnings = ASLayoutRangeModeLowMemo
   if (_updateCountThisFrame > 1) {
     NSLog(@"ASRangeController %p updated %lu times this frame.", self, (unsigned long)_updateCountThisFrame);
   }
+  if (_updateCountThisFrame > 0) {
+    NSLog(@"ASRangeController %p spent %.3fms updating ranges this frame; %lu elements changed interface state.",
+          self, _updateDurationThisFrame * 1000.0, (unsigned long)_transitionCountThisFrame);
+  }
   _updateCountThisFrame = 0;
+  _transitionCountThisFrame = 0;
+  _updateDurationThisFrame = 0;
 }
 #endif
 
@@ -647,7 +702,14 @@ static ASLayoutRangeMode __rangeModeForMemoryWarnings = ASLayoutRangeModeLowMemo
 
 - (NSString *)description
 {
-  NSArray<NSIndexPath *> *indexPaths = [[_allPreviousIndexPaths allObjects] sortedArrayUsingSelector:@selector(compare:)];
+  ASElementMap *map = [_dataSource elementMapForRangeController:self];
+  NSMutableArray<NSIndexPath *> *indexPaths = [[NSMutableArray alloc] init];
+  const AS::IndexBitset &previousRange = _previousRange;
+  AS::IndexBitset::forEachIndex(previousRange.size(), [&](size_t w) { return previousRange.word(w); }, [&](size_t index) {
+    if (NSIndexPath *indexPath = [map indexPathForElement:[map itemElementAtFlatIndex:index]]) {
+      [indexPaths addObject:indexPath];
+    }
+  });
   return [self descriptionWithIndexPaths:indexPaths];
 }
 
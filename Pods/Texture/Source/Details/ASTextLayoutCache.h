@@ -0,0 +1,73 @@
+//
+//  ASTextLayoutCache.h
+//  Texture
+//
+//  Copyright (c) Pinterest, Inc.  All rights reserved.
+//  Licensed under Apache 2.0: http://www.apache.org/licenses/LICENSE-2.0
+//
+
+#import <Foundation/Foundation.h>
+#import <AsyncDisplayKit/ASBaseDefines.h>
+
+@class ASTextContainer;
+@class ASTextLayout;
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ * The text layout cache keeps the last few layouts of each attributed string measured by ASTextNode2, so text that is
+ * measured again, e.g. when a cell is remeasured or a node is recreated for the same model, reuses its layout.
+ *
+ * The cache is process-wide and thread safe. It is split into shards by the hash of the attributed string, each with
+ * its own lock, so threads measuring different text rarely wait for each other. Within a shard, strings are kept in
+ * least recently used order, and so are the layouts of each string. Strings are evicted, least recently used first,
+ * once the estimated size of the cached layouts goes over a byte limit. All entries are dropped on memory warnings.
+ *
+ * With exp_text_width_reuse, a layout also answers lookups at other widths when its lines would break the same way
+ * there, so rotating or resizing doesn't lay out every string again. Narrower widths are checked against the extent of
+ * each line, and wider ones by asking CoreText where each line would break. Single-line text, and text whose lines all
+ * end in a line break, is reused at any width it fits in. Text that is aligned against the right edge, justified, or
+ * truncated is always laid out again.
+ */
+
+typedef struct {
+  /** Lookups that returned a cached layout. */
+  NSUInteger hits;
+  /** Lookups that found nothing, i.e. the text was laid out. */
+  NSUInteger misses;
+  /** Of the hits, lookups answered by a layout for another width, whose lines break the same way at the new one. */
+  NSUInteger widthHits;
+  /** Strings dropped, with all their layouts, to stay within the byte limit. */
+  NSUInteger evictions;
+  /** Shard lock acquisitions that had to wait for another thread. */
+  NSUInteger contendedLocks;
+  /** Seconds spent waiting for shard locks, over all threads. */
+  NSTimeInterval lockWaitTime;
+  /** Strings currently in the cache. */
+  NSUInteger count;
+  /** Estimated size of the cached strings and layouts, in bytes. */
+  NSUInteger byteCount;
+} ASTextLayoutCacheStatistics;
+
+/// A snapshot of the cache statistics since launch or the last reset. The hit rate is hits / (hits + misses).
+ASDK_EXTERN ASTextLayoutCacheStatistics ASTextLayoutCacheGetStatistics(void);
+
+/// Resets hits, misses, width hits, evictions, contended locks and lock wait time to zero.
+ASDK_EXTERN void ASTextLayoutCacheResetStatistics(void);
+
+/// Drops all entries.
+ASDK_EXTERN void ASTextLayoutCacheRemoveAllEntries(void);
+
+/// The estimated size the cache is kept under, in bytes. Defaults to 8 MB. Setting a lower limit evicts right away.
+ASDK_EXTERN NSUInteger ASTextLayoutCacheGetByteLimit(void);
+ASDK_EXTERN void ASTextLayoutCacheSetByteLimit(NSUInteger byteLimit);
+
+#pragma mark - Internal
+
+/**
+ * Used by ASTextNode2. Returns a cached layout of `text` compatible with `container`, or lays it out and caches the
+ * result. Concurrent lookups of the same string wait for each other, so it is laid out once.
+ */
+ASDK_EXTERN ASTextLayout *ASTextLayoutCacheGetLayout(ASTextContainer *container, NSAttributedString *text);
+
+NS_ASSUME_NONNULL_END
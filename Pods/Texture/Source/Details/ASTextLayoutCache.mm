@@ -0,0 +1,578 @@
+//
+//  ASTextLayoutCache.mm
+//  Texture
+//
+//  Copyright (c) Pinterest, Inc.  All rights reserved.
+//  Licensed under Apache 2.0: http://www.apache.org/licenses/LICENSE-2.0
+//
+
+#import <AsyncDisplayKit/ASTextLayoutCache.h>
+
+#import <CoreText/CoreText.h>
+#import <UIKit/UIKit.h>
+
+#import <algorithm>
+#import <atomic>
+#import <chrono>
+#import <deque>
+#import <list>
+#import <memory>
+#import <unordered_map>
+
+#import <AsyncDisplayKit/ASConfigurationInternal.h>
+#import <AsyncDisplayKit/ASEqualityHelpers.h>
+#import <AsyncDisplayKit/ASTextLayout.h>
+#import <AsyncDisplayKit/ASThread.h>
+
+using AS::MutexLocker;
+
+namespace {
+
+/// A power of two. Enough that a thread per core rarely meets another in the same shard.
+static const size_t kShardCount = 16;
+
+/// Layouts kept per string, i.e. distinct container sizes it is commonly measured at.
+static const size_t kLayoutsPerString = 3;
+
+static const NSUInteger kDefaultByteLimit = 8 * 1024 * 1024;
+
+/**
+ * Rough memory cost of a layout: the layout object, plus a CTLine, its runs and glyph positions per line.
+ */
+static size_t ByteCountOfLayout(ASTextLayout *layout)
+{
+  return 512 + layout.lines.count * 256;
+}
+
+static size_t ByteCountOfText(NSAttributedString *text)
+{
+  return 128 + text.length * sizeof(unichar);
+}
+
+/**
+ * Rough memory cost of a typesetter: its glyphs, advances and string indices.
+ */
+static size_t ByteCountOfTypesetter(NSAttributedString *text)
+{
+  return 256 + text.length * 32;
+}
+
+/**
+ * Whether the container parameters other than the size are the same.
+ */
+static BOOL ContainerParametersAreEqual(ASTextContainer *container, ASTextContainer *otherContainer)
+{
+  return UIEdgeInsetsEqualToEdgeInsets(container.insets, otherContainer.insets)
+      && ASObjectIsEqual(container.exclusionPaths, otherContainer.exclusionPaths)
+      && container.maximumNumberOfRows == otherContainer.maximumNumberOfRows
+      && container.truncationType == otherContainer.truncationType
+      && ASObjectIsEqual(container.truncationToken, otherContainer.truncationToken);
+}
+
+/**
+ * Whether a layout calculated for `constrainedSize` can be used for `container`.
+ */
+static BOOL LayoutIsCompatible(ASTextLayout *layout, CGSize constrainedSize, ASTextContainer *container)
+{
+  CGRect containerBounds = (CGRect){ .size = container.size };
+  CGSize layoutSize = layout.textBoundingSize;
+  // 1. CoreText can return frames that are narrower than the constrained width, for obvious reasons.
+  // 2. CoreText can return frames that are slightly wider than the constrained width, for some reason.
+  //    We have to trust that somehow it's OK to try and draw within our size constraint, despite the return value.
+  // 3. Thus, those two values (constrained width & returned width) form a range, where
+  //    intermediate values in that range will be snapped. Thus, we can use a given layout as long as our
+  //    width is in that range, between the min and max of those two values.
+  CGRect minRect = CGRectMake(0, 0, MIN(layoutSize.width, constrainedSize.width), MIN(layoutSize.height, constrainedSize.height));
+  if (!CGRectContainsRect(containerBounds, minRect)) {
+    return NO;
+  }
+  CGRect maxRect = CGRectMake(0, 0, MAX(layoutSize.width, constrainedSize.width), MAX(layoutSize.height, constrainedSize.height));
+  if (!CGRectContainsRect(maxRect, containerBounds)) {
+    return NO;
+  }
+  if (!CGSizeEqualToSize(container.size, constrainedSize)) {
+    return NO;
+  }
+
+  // Now check container params.
+  return ContainerParametersAreEqual(container, layout.container);
+}
+
+/**
+ * Whether a line ends in a line or paragraph break, i.e. can't take in text from the next line however wide it gets.
+ */
+static BOOL LineEndsInBreak(NSString *string, NSRange range)
+{
+  if (range.length == 0) {
+    return NO;
+  }
+  switch ([string characterAtIndex:NSMaxRange(range) - 1]) {
+    case '\n':
+    case '\r':
+    case 0x0085:
+    case 0x2028:
+    case 0x2029:
+      return YES;
+    default:
+      return NO;
+  }
+}
+
+/**
+ * The widths a layout's lines break the same way at. CoreText breaks lines greedily, so these form a range: from the
+ * extent of the longest line, up to the first width where a line takes in the next word. The upper end is only known
+ * as far as it has been checked.
+ */
+struct LineBreaks {
+  /// NO until the layout is first looked at for another width.
+  bool analyzed = false;
+  /// NO if the layout depends on the container width other than through its line breaks, e.g. for centered text.
+  bool reusable = false;
+  /// Narrower containers cut into the longest line.
+  CGFloat minimumWidth = 0;
+  /// The widest container known to break the same way.
+  CGFloat maximumWidth = 0;
+  /// The narrowest container known to break differently.
+  CGFloat rejectedWidth = CGFLOAT_MAX;
+};
+
+struct CachedLayout {
+  CachedLayout(CGSize constrainedSize, ASTextLayout *layout) : constrainedSize(constrainedSize), layout(layout) {}
+
+  CGSize constrainedSize;
+  ASTextLayout *layout;
+  LineBreaks breaks;
+};
+
+/**
+ * Fills in the line breaks of a layout: whether lines are placed independently of the container width, and the range
+ * of widths known to break the same way.
+ */
+static void AnalyzeLineBreaks(CachedLayout &cached)
+{
+  LineBreaks &breaks = cached.breaks;
+  breaks.analyzed = true;
+  ASTextLayout *layout = cached.layout;
+  ASTextContainer *container = layout.container;
+  NSAttributedString *text = layout.text;
+  NSArray<ASTextLine *> *lines = layout.lines;
+  if (container.path != nil || container.exclusionPaths.count > 0 || container.isVerticalForm
+      || container.linePositionModifier != nil || layout.truncatedLine != nil || layout.needDrawBlockBorder
+      || NSMaxRange(layout.visibleRange) < text.length || lines.count == 0) {
+    return;
+  }
+
+  // Lines must start at the left edge and break greedily, within the container alone.
+  __block BOOL stylesAllowReuse = YES;
+  [text enumerateAttribute:NSParagraphStyleAttributeName inRange:NSMakeRange(0, text.length) options:kNilOptions usingBlock:^(id value, NSRange range, BOOL *stop) {
+    if (value == nil) {
+      return;
+    }
+    NSParagraphStyle *style = ASDynamicCast(value, NSParagraphStyle);
+    if (style == nil
+        || (style.alignment != NSTextAlignmentLeft && style.alignment != NSTextAlignmentNatural)
+        || (style.lineBreakMode != NSLineBreakByWordWrapping && style.lineBreakMode != NSLineBreakByCharWrapping)
+        || style.tailIndent != 0 || style.hyphenationFactor != 0) {
+      stylesAllowReuse = NO;
+      *stop = YES;
+    }
+  }];
+  if (!stylesAllowReuse) {
+    return;
+  }
+
+  NSString *string = text.string;
+  CGFloat extent = 0;
+  BOOL allLinesEndInBreaks = YES;
+  for (ASTextLine *line in lines) {
+    // Natural alignment follows the writing direction: right-to-left text is placed against the right edge.
+    NSArray *runs = (__bridge NSArray *)CTLineGetGlyphRuns(line.CTLine);
+    for (id run in runs) {
+      if (CTRunGetStatus((__bridge CTRunRef)run) & kCTRunStatusRightToLeft) {
+        return;
+      }
+    }
+    // Trailing white space hangs past the edge.
+    extent = MAX(extent, line.right - line.trailingWhitespaceWidth);
+    if (line != lines.lastObject && !LineEndsInBreak(string, line.range)) {
+      allLinesEndInBreaks = NO;
+    }
+  }
+  breaks.reusable = true;
+  breaks.minimumWidth = extent + container.insets.right;
+  breaks.maximumWidth = allLinesEndInBreaks ? CGFLOAT_MAX : container.size.width;
+}
+
+/**
+ * The layouts of one attributed string. Shared with lookups in progress, so evicting it doesn't pull it from under
+ * them.
+ */
+struct Entry {
+  Entry(NSUInteger hash, NSAttributedString *text) : hash(hash), text(text) {}
+
+  const NSUInteger hash;
+  NSAttributedString * const text;
+
+  ~Entry()
+  {
+    if (typesetter != NULL) {
+      CFRelease(typesetter);
+    }
+  }
+
+  /// Held while looking through or adding to the layouts, including while laying out on a miss.
+  AS::Mutex mutex;
+  /// Most recently used first. Guarded by `mutex`.
+  std::deque<CachedLayout> layouts;
+  /// Created to check line breaks at wider widths. Guarded by `mutex`.
+  CTTypesetterRef typesetter = NULL;
+
+  /// Estimated size of the text and layouts. Guarded by the shard lock.
+  size_t byteCount = 0;
+  /// NO once evicted. Guarded by the shard lock.
+  bool cached = true;
+};
+
+typedef std::list<std::shared_ptr<Entry>> EntryList;
+
+/**
+ * A least recently used list of strings, indexed by hash. Counters are atomic since hits are counted outside the lock.
+ */
+class Shard {
+public:
+  /** The entry for `text`, created if needed, and made the most recently used one. */
+  std::shared_ptr<Entry> entry(NSUInteger hash, NSAttributedString *text)
+  {
+    lock();
+    std::shared_ptr<Entry> result;
+    const auto range = _index.equal_range(hash);
+    for (auto it = range.first; it != range.second; ++it) {
+      const std::shared_ptr<Entry> &entry = *it->second;
+      if (entry->text == text || [entry->text isEqualToAttributedString:text]) {
+        _entries.splice(_entries.begin(), _entries, it->second);
+        result = entry;
+        break;
+      }
+    }
+    if (result == nullptr) {
+      result = std::make_shared<Entry>(hash, [text copy]);
+      result->byteCount = ByteCountOfText(text);
+      _byteCount += result->byteCount;
+      _entries.push_front(result);
+      _index.emplace(hash, _entries.begin());
+    }
+    _mutex.unlock();
+    return result;
+  }
+
+  /** Accounts for a change in the size of an entry, and evicts others if over the limit. */
+  void entryDidChange(const std::shared_ptr<Entry> &entry, size_t byteCount, size_t byteLimit)
+  {
+    lock();
+    if (entry->cached) {
+      _byteCount += byteCount - entry->byteCount;
+      entry->byteCount = byteCount;
+    }
+    evict(byteLimit, entry.get());
+    _mutex.unlock();
+  }
+
+  /** Evicts least recently used entries until within `byteLimit`. */
+  void trim(size_t byteLimit)
+  {
+    lock();
+    evict(byteLimit, nullptr);
+    _mutex.unlock();
+  }
+
+  void removeAllEntries()
+  {
+    lock();
+    for (const auto &entry : _entries) {
+      entry->cached = false;
+    }
+    _entries.clear();
+    _index.clear();
+    _byteCount = 0;
+    _mutex.unlock();
+  }
+
+  void addStatistics(ASTextLayoutCacheStatistics &statistics)
+  {
+    lock();
+    statistics.count += _entries.size();
+    statistics.byteCount += _byteCount;
+    _mutex.unlock();
+    statistics.hits += hits.load(std::memory_order_relaxed);
+    statistics.misses += misses.load(std::memory_order_relaxed);
+    statistics.widthHits += widthHits.load(std::memory_order_relaxed);
+    statistics.evictions += evictions.load(std::memory_order_relaxed);
+    statistics.contendedLocks += contendedLocks.load(std::memory_order_relaxed);
+    statistics.lockWaitTime += lockWaitNanoseconds.load(std::memory_order_relaxed) / 1e9;
+  }
+
+  void resetStatistics()
+  {
+    hits = 0;
+    misses = 0;
+    widthHits = 0;
+    evictions = 0;
+    contendedLocks = 0;
+    lockWaitNanoseconds = 0;
+  }
+
+  std::atomic<NSUInteger> hits{0};
+  std::atomic<NSUInteger> misses{0};
+  std::atomic<NSUInteger> widthHits{0};
+  std::atomic<NSUInteger> evictions{0};
+  std::atomic<NSUInteger> contendedLocks{0};
+  std::atomic<uint64_t> lockWaitNanoseconds{0};
+
+private:
+  /** Locks the shard, timing the wait if another thread holds it. */
+  void lock()
+  {
+    if (_mutex.try_lock()) {
+      return;
+    }
+    const auto start = std::chrono::steady_clock::now();
+    _mutex.lock();
+    const auto wait = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+    contendedLocks.fetch_add(1, std::memory_order_relaxed);
+    lockWaitNanoseconds.fetch_add(wait.count(), std::memory_order_relaxed);
+  }
+
+  /** Evicts least recently used entries until within `byteLimit`, except `keep`, which is in use. */
+  void evict(size_t byteLimit, const Entry *keep)
+  {
+    while (_byteCount > byteLimit && !_entries.empty() && _entries.back().get() != keep) {
+      const std::shared_ptr<Entry> entry = _entries.back();
+      const auto range = _index.equal_range(entry->hash);
+      for (auto it = range.first; it != range.second; ++it) {
+        if (it->second->get() == entry.get()) {
+          _index.erase(it);
+          break;
+        }
+      }
+      _entries.pop_back();
+      _byteCount -= entry->byteCount;
+      entry->cached = false;
+      evictions.fetch_add(1, std::memory_order_relaxed);
+    }
+  }
+
+  AS::Mutex _mutex;
+  EntryList _entries;
+  std::unordered_multimap<NSUInteger, EntryList::iterator> _index;
+  size_t _byteCount = 0;
+};
+
+class TextLayoutCache {
+public:
+  static TextLayoutCache &shared()
+  {
+    static TextLayoutCache *cache;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+      cache = new TextLayoutCache();
+      [[NSNotificationCenter defaultCenter] addObserverForName:UIApplicationDidReceiveMemoryWarningNotification object:nil queue:nil usingBlock:^(NSNotification *note) {
+        cache->removeAllEntries();
+      }];
+    });
+    return *cache;
+  }
+
+  ASTextLayout *layout(ASTextContainer *container, NSAttributedString *text)
+  {
+    // Hash once: it picks the shard and the bucket within it.
+    const NSUInteger hash = text.hash;
+    Shard &shard = shardForHash(hash);
+    const std::shared_ptr<Entry> entry = shard.entry(hash, text);
+
+    // Hold the entry while laying out, in case another thread requests the same text meanwhile, so they don't race.
+    MutexLocker l(entry->mutex);
+    auto &layouts = entry->layouts;
+    for (auto it = layouts.begin(); it != layouts.end(); ++it) {
+      if (LayoutIsCompatible(it->layout, it->constrainedSize, container)) {
+        if (it != layouts.begin()) {
+          std::rotate(layouts.begin(), it, it + 1);
+        }
+        shard.hits.fetch_add(1, std::memory_order_relaxed);
+        return layouts.front().layout;
+      }
+    }
+
+    if (ASActivateExperimentalFeature(ASExperimentalTextWidthReuse)) {
+      for (auto it = layouts.begin(); it != layouts.end(); ++it) {
+        const bool hadTypesetter = (entry->typesetter != NULL);
+        const bool breaksAlike = linesBreakAlike(*entry, *it, container);
+        if (!hadTypesetter && entry->typesetter != NULL) {
+          shard.entryDidChange(entry, byteCountOfEntry(*entry), shardByteLimit());
+        }
+        if (breaksAlike) {
+          if (it != layouts.begin()) {
+            std::rotate(layouts.begin(), it, it + 1);
+          }
+          shard.hits.fetch_add(1, std::memory_order_relaxed);
+          shard.widthHits.fetch_add(1, std::memory_order_relaxed);
+          return layouts.front().layout;
+        }
+      }
+    }
+
+    // Cache miss. Compute the text layout.
+    shard.misses.fetch_add(1, std::memory_order_relaxed);
+    ASTextLayout *layout = [ASTextLayout layoutWithContainer:container text:text];
+    layouts.emplace_front(container.size, layout);
+    if (layouts.size() > kLayoutsPerString) {
+      layouts.pop_back();
+    }
+    shard.entryDidChange(entry, byteCountOfEntry(*entry), shardByteLimit());
+    return layout;
+  }
+
+  ASTextLayoutCacheStatistics statistics()
+  {
+    ASTextLayoutCacheStatistics statistics = {};
+    for (Shard &shard : _shards) {
+      shard.addStatistics(statistics);
+    }
+    return statistics;
+  }
+
+  void resetStatistics()
+  {
+    for (Shard &shard : _shards) {
+      shard.resetStatistics();
+    }
+  }
+
+  void removeAllEntries()
+  {
+    for (Shard &shard : _shards) {
+      shard.removeAllEntries();
+    }
+  }
+
+  NSUInteger byteLimit() const { return _byteLimit.load(std::memory_order_relaxed); }
+
+  void setByteLimit(NSUInteger byteLimit)
+  {
+    _byteLimit.store(byteLimit, std::memory_order_relaxed);
+    for (Shard &shard : _shards) {
+      shard.trim(shardByteLimit());
+    }
+  }
+
+private:
+  /**
+   * Whether a cached layout is the one `container` would get: its lines break the same way at the container width,
+   * and nothing else about it depends on the width. Called with the entry mutex held.
+   */
+  static bool linesBreakAlike(Entry &entry, CachedLayout &cached, ASTextContainer *container)
+  {
+    ASTextLayout *layout = cached.layout;
+    if (container.path != nil || container.isVerticalForm || container.linePositionModifier != nil
+        || !ContainerParametersAreEqual(container, layout.container)
+        || container.size.height < layout.textBoundingSize.height) {
+      return false;
+    }
+    LineBreaks &breaks = cached.breaks;
+    if (!breaks.analyzed) {
+      AnalyzeLineBreaks(cached);
+    }
+    const CGFloat width = container.size.width;
+    if (!breaks.reusable || width < breaks.minimumWidth || width >= breaks.rejectedWidth) {
+      return false;
+    }
+    if (width <= breaks.maximumWidth) {
+      return true;
+    }
+
+    // Wider than checked so far: ask CoreText where each line would break now, from the top. Lines are only checked
+    // up to the first that breaks differently, and lines ending in a line break keep it at any width.
+    if (entry.typesetter == NULL) {
+      entry.typesetter = CTTypesetterCreateWithAttributedString((__bridge CFAttributedStringRef)entry.text);
+      if (entry.typesetter == NULL) {
+        return false;
+      }
+    }
+    NSString *string = entry.text.string;
+    NSArray<ASTextLine *> *lines = layout.lines;
+    const CGFloat right = width - container.insets.right;
+    for (NSUInteger i = 0; i + 1 < lines.count; i++) {
+      ASTextLine *line = lines[i];
+      const NSRange range = line.range;
+      if (LineEndsInBreak(string, range)) {
+        continue;
+      }
+      // The line starts at its paragraph's indent, which is where it is placed.
+      if (CTTypesetterSuggestLineBreak(entry.typesetter, range.location, right - line.left) != (CFIndex)range.length) {
+        breaks.rejectedWidth = width;
+        return false;
+      }
+    }
+    breaks.maximumWidth = width;
+    return true;
+  }
+
+  static size_t byteCountOfEntry(const Entry &entry)
+  {
+    size_t byteCount = ByteCountOfText(entry.text);
+    for (const auto &cached : entry.layouts) {
+      byteCount += ByteCountOfLayout(cached.layout);
+    }
+    if (entry.typesetter != NULL) {
+      byteCount += ByteCountOfTypesetter(entry.text);
+    }
+    return byteCount;
+  }
+
+  Shard &shardForHash(NSUInteger hash)
+  {
+    // String hashes vary most in their low bits, but don't trust them: mix before picking.
+    uint64_t x = hash;
+    x ^= x >> 33;
+    x *= 0xff51afd7ed558ccdULL;
+    x ^= x >> 33;
+    return _shards[x & (kShardCount - 1)];
+  }
+
+  /** Each shard gets an even share: strings spread evenly over the shards, so their sizes do too. */
+  size_t shardByteLimit() const { return byteLimit() / kShardCount; }
+
+  Shard _shards[kShardCount];
+  std::atomic<NSUInteger> _byteLimit{kDefaultByteLimit};
+};
+
+} // namespace
+
+ASTextLayout *ASTextLayoutCacheGetLayout(ASTextContainer *container, NSAttributedString *text)
+{
+  return TextLayoutCache::shared().layout(container, text);
+}
+
+ASTextLayoutCacheStatistics ASTextLayoutCacheGetStatistics(void)
+{
+  return TextLayoutCache::shared().statistics();
+}
+
+void ASTextLayoutCacheResetStatistics(void)
+{
+  TextLayoutCache::shared().resetStatistics();
+}
+
+void ASTextLayoutCacheRemoveAllEntries(void)
+{
+  TextLayoutCache::shared().removeAllEntries();
+}
+
+NSUInteger ASTextLayoutCacheGetByteLimit(void)
+{
+  return TextLayoutCache::shared().byteLimit();
+}
+
+void ASTextLayoutCacheSetByteLimit(NSUInteger byteLimit)
+{
+  TextLayoutCache::shared().setByteLimit(byteLimit);
+}
@@ -10,7 +10,40 @@
 #import <AsyncDisplayKit/NSArray+Diffing.h>
 #import <UIKit/NSIndexPath+UIKitAdditions.h>
 #import <AsyncDisplayKit/ASAssert.h>
+#import <AsyncDisplayKit/ASDiff.h>
 #import <unordered_map>
+#import <vector>
+
+/**
+ * Maps the elements of both arrays to dense integer symbols, where elements that are equal by -hash and -isEqual:
+ * share a symbol. Every element is hashed once, so the diff itself only has to compare integers.
+ *
+ * @return The number of distinct symbols.
+ */
+static size_t ASDiffAssignSymbols(const std::vector<unowned id> &oldObjects, const std::vector<unowned id> &newObjects,
+                                  std::vector<uint32_t> &oldSymbols, std::vector<uint32_t> &newSymbols)
+{
+  struct NSObjectHash
+  {
+    std::size_t operator()(id <NSObject> k) const { return (std::size_t) [k hash]; };
+  };
+  struct NSObjectCompare
+  {
+    bool operator()(id <NSObject> lhs, id <NSObject> rhs) const { return (bool) [lhs isEqual:rhs]; };
+  };
+  std::unordered_map<unowned id, uint32_t, NSObjectHash, NSObjectCompare> symbols;
+  symbols.reserve(oldObjects.size() + newObjects.size());
+
+  oldSymbols.resize(oldObjects.size());
+  for (size_t i = 0; i < oldObjects.size(); i++) {
+    oldSymbols[i] = symbols.emplace(oldObjects[i], (uint32_t)symbols.size()).first->second;
+  }
+  newSymbols.resize(newObjects.size());
+  for (size_t j = 0; j < newObjects.size(); j++) {
+    newSymbols[j] = symbols.emplace(newObjects[j], (uint32_t)symbols.size()).first->second;
+  }
+  return symbols.size();
+}
 
 @implementation NSArray (Diffing)
 
@@ -37,126 +70,78 @@ typedef BOOL (^compareBlock)(id _Nonnull lhs, id _Nonnull rhs);
 - (void)asdk_diffWithArray:(NSArray *)array insertions:(NSIndexSet **)insertions deletions:(NSIndexSet **)deletions
                      moves:(NSArray<NSIndexPath *> **)moves compareBlock:(compareBlock)comparison
 {
-  struct NSObjectHash
-  {
-    std::size_t operator()(id <NSObject> k) const { return (std::size_t) [k hash]; };
-  };
-  struct NSObjectCompare
-  {
-    bool operator()(id <NSObject> lhs, id <NSObject> rhs) const { return (bool) [lhs isEqual:rhs]; };
-  };
-  std::unordered_multimap<unowned id, NSUInteger, NSObjectHash, NSObjectCompare> potentialMoves;
-
   NSAssert(comparison != nil, @"Comparison block is required");
   NSAssert(moves == nil || comparison == [NSArray defaultCompareBlock], @"move detection requires isEqual: and hash (no custom compare)");
-  NSMutableArray<NSIndexPath *> *moveIndexPaths = nil;
-  NSMutableIndexSet *insertionIndexes = nil, *deletionIndexes = nil;
-  if (moves) {
-    moveIndexPaths = [NSMutableArray new];
-  }
-  NSMutableIndexSet *commonIndexes = [self _asdk_commonIndexesWithArray:array compareBlock:comparison];
 
-  if (deletions || moves) {
-    deletionIndexes = [NSMutableIndexSet indexSet];
-    NSUInteger i = 0;
-    for (id element in self) {
-      if (![commonIndexes containsIndex:i]) {
-        [deletionIndexes addIndex:i];
-      }
-      if (moves) {
-        potentialMoves.insert(std::pair<id, NSUInteger>(element, i));
-      }
-      ++i;
-    }
-  }
+  const NSUInteger selfCount = self.count;
+  const NSUInteger arrayCount = array.count;
+  // Read the elements out once, the inner loops shouldn't go through -objectAtIndex:.
+  std::vector<unowned id> oldObjects(selfCount);
+  std::vector<unowned id> newObjects(arrayCount);
+  [self getObjects:oldObjects.data() range:NSMakeRange(0, selfCount)];
+  [array getObjects:newObjects.data() range:NSMakeRange(0, arrayCount)];
 
-  if (insertions || moves) {
-    insertionIndexes = [NSMutableIndexSet indexSet];
-    NSArray *commonObjects = [self objectsAtIndexes:commonIndexes];
-    for (NSUInteger i = 0, j = 0; j < array.count; j++) {
-      auto moveFound = potentialMoves.find(array[j]);
-      NSUInteger movedFrom = NSNotFound;
-      if (moveFound != potentialMoves.end() && moveFound->second != j) {
-        movedFrom = moveFound->second;
-        potentialMoves.erase(moveFound);
-        [moveIndexPaths addObject:[NSIndexPath indexPathForItem:j inSection:movedFrom]];
-      }
-      if (i < commonObjects.count && j < array.count && comparison(commonObjects[i], array[j])) {
-        i++;
+  NSMutableIndexSet *insertionIndexes = [NSMutableIndexSet indexSet];
+  NSMutableIndexSet *deletionIndexes = [NSMutableIndexSet indexSet];
+
+  if (moves) {
+    // Pair up equal elements; every pair that changed its index is a move.
+    std::vector<uint32_t> oldSymbols, newSymbols;
+    const size_t symbolCount = ASDiffAssignSymbols(oldObjects, newObjects, oldSymbols, newSymbols);
+    const std::vector<size_t> oldForNew = AS::Diff::matchSymbols(oldSymbols, newSymbols, symbolCount);
+
+    NSMutableArray<NSIndexPath *> *moveIndexPaths = [NSMutableArray array];
+    std::vector<bool> matched(selfCount, false);
+    for (NSUInteger j = 0; j < arrayCount; j++) {
+      const size_t i = oldForNew[j];
+      if (i == AS::Diff::kNotFound) {
+        [insertionIndexes addIndex:j];
       } else {
-        if (movedFrom != NSNotFound) {
-          // moves will coalesce a delete / insert - the insert is just not done, and here we remove the delete:
-          [deletionIndexes removeIndex:movedFrom];
-          // OR a move will have come from the LCS:
-          if ([commonIndexes containsIndex:movedFrom]) {
-            [commonIndexes removeIndex:movedFrom];
-            commonObjects = [self objectsAtIndexes:commonIndexes];
-          }
-        } else {
-          [insertionIndexes addIndex:j];
+        matched[i] = true;
+        if (i != j) {
+          [moveIndexPaths addObject:[NSIndexPath indexPathForItem:j inSection:i]];
         }
       }
     }
-  }
-
-  if (moves) {*moves = moveIndexPaths;}
-  if (deletions) {*deletions = deletionIndexes;}
-  if (insertions) {*insertions = insertionIndexes;}
-}
-
-// https://github.com/raywenderlich/swift-algorithm-club/tree/master/Longest%20Common%20Subsequence is not exactly this code (obviously), but
-// is a good commentary on the algorithm.
-- (NSMutableIndexSet *)_asdk_commonIndexesWithArray:(NSArray *)array compareBlock:(BOOL (^)(id lhs, id rhs))comparison
-{
-  NSAssert(comparison != nil, @"Comparison block is required");
-
-  NSInteger selfCount = self.count;
-  NSInteger arrayCount = array.count;
-
-  // Allocate the diff map in the heap so we don't blow the stack for large arrays.
-  NSInteger **lengths = NULL;
-  lengths = (NSInteger **)malloc(sizeof(NSInteger*) * (selfCount+1));
-  if (lengths == NULL) {
-    ASDisplayNodeFailAssert(@"Failed to allocate memory for diffing");
-    return nil;
-  }
-  // Fill in a LCS length matrix:
-  for (NSInteger i = 0; i <= selfCount; i++) {
-    lengths[i] = (NSInteger *)malloc(sizeof(NSInteger) * (arrayCount+1));
-    if (lengths[i] == NULL) {
-      ASDisplayNodeFailAssert(@"Failed to allocate memory for diffing");
-      return nil;
-    }
-    id selfObj = i > 0 ? self[i-1] : nil;
-    for (NSInteger j = 0; j <= arrayCount; j++) {
-      if (i == 0 || j == 0) {
-        lengths[i][j] = 0;
-      } else if (comparison(selfObj, array[j-1])) {
-        lengths[i][j] = 1 + lengths[i-1][j-1];
-      } else {
-        lengths[i][j] = MAX(lengths[i-1][j], lengths[i][j-1]);
+    for (NSUInteger i = 0; i < selfCount; i++) {
+      if (!matched[i]) {
+        [deletionIndexes addIndex:i];
       }
     }
-  }
-  // Backtrack to fill in indices based on length matrix:
-  NSMutableIndexSet *common = [NSMutableIndexSet indexSet];
-  NSInteger i = selfCount, j = arrayCount;
-  while(i > 0 && j > 0) {
-    if (comparison(self[i-1], array[j-1])) {
-      [common addIndex:(i-1)];
-      i--; j--;
-    } else if (lengths[i-1][j] > lengths[i][j-1]) {
-      i--;
+    *moves = moveIndexPaths;
+  } else {
+    // Everything outside of the longest common subsequence is deleted from self or inserted from array.
+    std::vector<bool> oldCommon(selfCount, false);
+    std::vector<bool> newCommon(arrayCount, false);
+    const auto common = [&](size_t i, size_t j) {
+      oldCommon[i] = true;
+      newCommon[j] = true;
+    };
+    if (comparison == [NSArray defaultCompareBlock]) {
+      std::vector<uint32_t> oldSymbols, newSymbols;
+      ASDiffAssignSymbols(oldObjects, newObjects, oldSymbols, newSymbols);
+      AS::Diff::longestCommonSubsequence(selfCount, arrayCount, [&](size_t i, size_t j) {
+        return oldSymbols[i] == newSymbols[j];
+      }, common);
     } else {
-      j--;
+      AS::Diff::longestCommonSubsequence(selfCount, arrayCount, [&](size_t i, size_t j) {
+        return (bool)comparison(oldObjects[i], newObjects[j]);
+      }, common);
+    }
+    for (NSUInteger i = 0; i < selfCount; i++) {
+      if (!oldCommon[i]) {
+        [deletionIndexes addIndex:i];
+      }
+    }
+    for (NSUInteger j = 0; j < arrayCount; j++) {
+      if (!newCommon[j]) {
+        [insertionIndexes addIndex:j];
+      }
     }
   }
 
-  for (NSInteger i = 0; i <= selfCount; i++) {
-    free(lengths[i]);
-  }
-  free(lengths);
-  return common;
+  if (deletions) {*deletions = deletionIndexes;}
+  if (insertions) {*insertions = insertionIndexes;}
 }
 
 static compareBlock defaultCompare = nil;
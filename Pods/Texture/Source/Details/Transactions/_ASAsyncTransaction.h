@@ -34,6 +34,62 @@ typedef NS_ENUM(NSUInteger, ASAsyncTransactionState) {
 
 ASDK_EXTERN NSInteger const ASDefaultTransactionPriority;
 
+/**
+ Contention counters of the queue that runs the operations of all transactions, since launch or the last reset.
+ */
+typedef struct {
+  /** Operations added to transactions. */
+  NSUInteger scheduledOperations;
+  /** Acquisitions of the queue's locks, to schedule or to dequeue an operation. */
+  NSUInteger lockCount;
+  /** Acquisitions that had to wait for another thread. */
+  NSUInteger contendedLockCount;
+  /** Total time spent waiting for the queue's locks, in seconds. */
+  NSTimeInterval lockWaitTime;
+  /** The most operations waiting at once for a single dispatch queue. */
+  NSUInteger maxQueueDepth;
+  /** Operations whose execution block was run. */
+  NSUInteger startedOperations;
+  /** Operations cancelled through their handle before they started, whose execution block was skipped. */
+  NSUInteger cancelledOperations;
+  /** Priority changes of waiting operations through their handle. */
+  NSUInteger reprioritizedOperations;
+  /** Total time from adding to starting the started operations, in seconds. */
+  NSTimeInterval queueLatency;
+  /** The longest time an operation waited to start, in seconds. */
+  NSTimeInterval maxQueueLatency;
+} ASAsyncTransactionQueueStatistics;
+
+ASDK_EXTERN ASAsyncTransactionQueueStatistics ASAsyncTransactionQueueGetStatistics(void);
+
+/** The operations currently waiting to run, by priority. */
+ASDK_EXTERN NSDictionary<NSNumber *, NSNumber *> *ASAsyncTransactionQueueGetQueueDepths(void);
+
+ASDK_EXTERN void ASAsyncTransactionQueueResetStatistics(void);
+
+/**
+ A handle to an operation added to a transaction, which acts on it while it still waits in the queue. Once the
+ operation started, both methods do nothing.
+ */
+AS_SUBCLASSING_RESTRICTED
+@interface _ASAsyncTransactionOperationHandle : NSObject
+
+/**
+ Drops the operation from the queue without running its execution block. Its completion block is still called.
+ Thread safe, doesn't lock.
+ */
+- (void)cancel;
+
+/**
+ Moves the operation to the given priority, e.g. ahead of others when its node became visible. Thread safe.
+ */
+- (void)setPriority:(NSInteger)priority;
+
+- (instancetype)init NS_UNAVAILABLE;
++ (instancetype)new NS_UNAVAILABLE;
+
+@end
+
 /**
  @summary ASAsyncTransaction provides lightweight transaction semantics for asynchronous operations.
 
@@ -87,11 +143,12 @@ ASDK_EXTERN NSInteger const ASDefaultTransactionPriority;
  @param queue The dispatch queue on which to execute the block.
  @param completion The completion block that will be executed with the output of the execution block when all of the
  operations in the transaction are completed. Executed and released on callbackQueue.
+ @return A handle to cancel or reprioritize the operation before it starts.
  */
-- (void)addOperationWithBlock:(asyncdisplaykit_async_transaction_operation_block_t)block
-                     priority:(NSInteger)priority
-                        queue:(dispatch_queue_t)queue
-                   completion:(nullable asyncdisplaykit_async_transaction_operation_completion_block_t)completion;
+- (_ASAsyncTransactionOperationHandle *)addOperationWithBlock:(asyncdisplaykit_async_transaction_operation_block_t)block
+                                                     priority:(NSInteger)priority
+                                                        queue:(dispatch_queue_t)queue
+                                                   completion:(nullable asyncdisplaykit_async_transaction_operation_completion_block_t)completion;
 
 /**
  @summary Cancels all operations in the transaction.
@@ -12,8 +12,13 @@
 #import <AsyncDisplayKit/_ASAsyncTransactionGroup.h>
 #import <AsyncDisplayKit/ASAssert.h>
 #import <AsyncDisplayKit/ASThread.h>
+#import <algorithm>
+#import <atomic>
+#import <chrono>
+#import <deque>
 #import <list>
 #import <map>
+#import <memory>
 
 #ifndef __STRICT_ANSI__
   #warning "Texture must be compiled with std=c++11 to prevent layout issues. gnu++ is not supported. This is hopefully temporary."
@@ -65,6 +70,24 @@ NSInteger const ASDefaultTransactionPriority = 0;
 class ASAsyncTransactionQueue
 {
 public:
+
+  class GroupImpl;
+
+  // Shared by an operation's queue entries and its handle. An operation runs, or is dropped if it was cancelled, when
+  // the first of its entries is dequeued; reprioritizing adds another entry, and later ones are discarded.
+  struct OperationControl
+  {
+    enum State : int { Queued, Cancelled, Started };
+
+    std::atomic<int> _state;
+    dispatch_block_t _block;
+    GroupImpl *_group;
+    dispatch_queue_t _queue;
+    NSInteger _priority; // of the newest entry; guarded by the shard
+    std::chrono::steady_clock::time_point _enqueueTime;
+
+    OperationControl() : _state(Queued) {}
+  };
   
   // Similar to dispatch_group_t
   class Group
@@ -74,7 +97,7 @@ public:
     virtual void release() = 0;
     
     // schedule block on given queue
-    virtual void schedule(NSInteger priority, dispatch_queue_t queue, dispatch_block_t block) = 0;
+    virtual std::shared_ptr<OperationControl> schedule(NSInteger priority, dispatch_queue_t queue, dispatch_block_t block) = 0;
     
     // dispatch block on given queue when all previously scheduled blocks finished executing
     virtual void notify(dispatch_queue_t queue, dispatch_block_t block) = 0;
@@ -94,7 +117,16 @@ public:
   Group *createGroup();
   
   static ASAsyncTransactionQueue &instance();
-  
+
+  ASAsyncTransactionQueueStatistics statistics();
+  NSDictionary<NSNumber *, NSNumber *> *queueDepths();
+  void resetStatistics();
+
+  // An operation that has not started is skipped when dequeued. O(1), doesn't lock.
+  static void cancel(OperationControl &control);
+  // Enqueues the operation again with the new priority, if it has not started. O(log #priorities).
+  void setPriority(const std::shared_ptr<OperationControl> &control, NSInteger priority);
+
 private:
   
   struct GroupNotify
@@ -103,6 +135,9 @@ private:
     dispatch_queue_t _queue;
   };
   
+public:
+  // Groups don't share any lock with each other or with the queue. The counter only goes through the group's mutex
+  // when it may drop to zero, which is when notify blocks are flushed and a released group deletes itself.
   class GroupImpl : public Group
   {
   public:
@@ -114,42 +149,73 @@ private:
     }
     
     virtual void release();
-    virtual void schedule(NSInteger priority, dispatch_queue_t queue, dispatch_block_t block);
+    virtual std::shared_ptr<OperationControl> schedule(NSInteger priority, dispatch_queue_t queue, dispatch_block_t block);
     virtual void notify(dispatch_queue_t queue, dispatch_block_t block);
     virtual void enter();
     virtual void leave();
     virtual void wait();
     
-    int _pendingOperations;
+    std::atomic<int> _pendingOperations;
+    std::mutex _mutex;
     std::list<GroupNotify> _notifyList;
     std::condition_variable _condition;
     BOOL _releaseCalled;
     ASAsyncTransactionQueue &_queue;
   };
-  
+
+private:
   struct Operation
   {
-    dispatch_block_t _block;
-    GroupImpl *_group;
+    std::shared_ptr<OperationControl> _control;
     NSInteger _priority;
+    uint64_t _sequence; // order of scheduling within the dispatch entry
   };
     
   struct DispatchEntry // entry for each dispatch queue
   {
-    typedef std::list<Operation> OperationQueue;
-    typedef std::list<OperationQueue::iterator> OperationIteratorList; // each item points to operation queue
-    typedef std::map<NSInteger, OperationIteratorList> OperationPriorityMap; // sorted by priority
+    typedef std::deque<Operation> OperationQueue;
+    typedef std::map<NSInteger, OperationQueue> OperationPriorityMap; // FIFO per priority, sorted by priority
 
-    OperationQueue _operationQueue;
     OperationPriorityMap _operationPriorityMap;
-    int _threadCount;
+    size_t _operationCount = 0;
+    uint64_t _nextSequence = 0;
+    int _threadCount = 0;
       
-    Operation popNextOperation(bool respectPriority);  // assumes locked mutex
-    void pushOperation(Operation operation);           // assumes locked mutex
+    Operation popNextOperation(bool respectPriority);  // assumes locked shard
+    void pushOperation(Operation operation);           // assumes locked shard
   };
-  
-  std::map<dispatch_queue_t, DispatchEntry> _entries;
-  std::mutex _mutex;
+
+  // Dispatch queues are spread over shards by address, so threads working for different queues don't contend.
+  struct Shard
+  {
+    AS::Mutex _mutex;
+    std::map<dispatch_queue_t, DispatchEntry> _entries;
+
+    // Contention counters, updated with _mutex held.
+    NSUInteger _lockCount = 0;
+    NSUInteger _contendedLockCount = 0;
+    std::chrono::steady_clock::duration _lockWaitTime = std::chrono::steady_clock::duration::zero();
+    NSUInteger _scheduledOperations = 0;
+    size_t _maxOperationCount = 0;
+
+    // Dequeue counters, updated with _mutex held.
+    NSUInteger _startedOperations = 0;
+    NSUInteger _cancelledOperations = 0;
+    NSUInteger _reprioritizedOperations = 0;
+    std::chrono::steady_clock::duration _queueLatency = std::chrono::steady_clock::duration::zero();
+    std::chrono::steady_clock::duration _maxQueueLatency = std::chrono::steady_clock::duration::zero();
+  };
+
+  static const size_t kShardCount = 8;
+
+  Shard &shardForQueue(dispatch_queue_t queue)
+  {
+    return _shards[(((uintptr_t)(__bridge void *)queue) >> 4) % kShardCount];
+  }
+
+  static void lockShard(Shard &shard);
+
+  Shard _shards[kShardCount];
 };
 
 ASAsyncTransactionQueue::Group* ASAsyncTransactionQueue::createGroup()
@@ -158,69 +224,72 @@ ASAsyncTransactionQueue::Group* ASAsyncTransactionQueue::createGroup()
   return res;
 }
 
+void ASAsyncTransactionQueue::lockShard(Shard &shard)
+{
+  if (shard._mutex.try_lock()) {
+    shard._lockCount++;
+    return;
+  }
+  const auto start = std::chrono::steady_clock::now();
+  shard._mutex.lock();
+  shard._lockCount++;
+  shard._contendedLockCount++;
+  shard._lockWaitTime += std::chrono::steady_clock::now() - start;
+}
+
 void ASAsyncTransactionQueue::GroupImpl::release()
 {
-  std::lock_guard<std::mutex> l(_queue._mutex);
-  
-  if (_pendingOperations == 0)  {
-    delete this;
-  } else {
+  bool shouldDelete;
+  {
+    std::lock_guard<std::mutex> l(_mutex);
+    shouldDelete = (_pendingOperations.load() == 0);
     _releaseCalled = YES;
   }
+  if (shouldDelete) {
+    delete this;
+  }
 }
 
 ASAsyncTransactionQueue::Operation ASAsyncTransactionQueue::DispatchEntry::popNextOperation(bool respectPriority)
 {
-  NSCAssert(!_operationQueue.empty() && !_operationPriorityMap.empty(), @"No scheduled operations available");
+  NSCAssert(_operationCount > 0, @"No scheduled operations available");
 
-  OperationQueue::iterator queueIterator;
-  OperationPriorityMap::iterator mapIterator;
-  
+  // Buckets are kept when they run empty; there are only a handful of distinct priorities.
+  OperationPriorityMap::iterator mapIterator = _operationPriorityMap.end();
   if (respectPriority) {
-    mapIterator = --_operationPriorityMap.end();  // highest priority "bucket"
-    queueIterator = *mapIterator->second.begin();
+    // highest priority non-empty "bucket"
+    do {
+      --mapIterator;
+    } while (mapIterator->second.empty());
   } else {
-    queueIterator = _operationQueue.begin();
-    mapIterator = _operationPriorityMap.find(queueIterator->_priority);
-  }
-  
-  // no matter what, first item in "bucket" must match item in queue
-  NSCAssert(mapIterator->second.front() == queueIterator, @"Queue inconsistency");
-  
-  Operation res = *queueIterator;
-  _operationQueue.erase(queueIterator);
-  
-  mapIterator->second.pop_front();
-  if (mapIterator->second.empty()) {
-    _operationPriorityMap.erase(mapIterator);
+    // oldest operation across all buckets
+    for (auto it = _operationPriorityMap.begin(); it != _operationPriorityMap.end(); ++it) {
+      if (!it->second.empty()
+          && (mapIterator == _operationPriorityMap.end() || it->second.front()._sequence < mapIterator->second.front()._sequence)) {
+        mapIterator = it;
+      }
+    }
   }
 
+  Operation res = mapIterator->second.front();
+  mapIterator->second.pop_front();
+  --_operationCount;
   return res;
 }
 
 void ASAsyncTransactionQueue::DispatchEntry::pushOperation(ASAsyncTransactionQueue::Operation operation)
 {
-  _operationQueue.push_back(operation);
-
-  OperationIteratorList &list = _operationPriorityMap[operation._priority];
-  list.push_back(--_operationQueue.end());
+  operation._sequence = _nextSequence++;
+  _operationPriorityMap[operation._priority].push_back(operation);
+  ++_operationCount;
 }
 
-void ASAsyncTransactionQueue::GroupImpl::schedule(NSInteger priority, dispatch_queue_t queue, dispatch_block_t block)
+std::shared_ptr<ASAsyncTransactionQueue::OperationControl> ASAsyncTransactionQueue::GroupImpl::schedule(NSInteger priority, dispatch_queue_t queue, dispatch_block_t block)
 {
-  ASAsyncTransactionQueue &q = _queue;
-  std::lock_guard<std::mutex> l(q._mutex);
-  
-  DispatchEntry &entry = q._entries[queue];
-  
-  Operation operation;
-  operation._block = block;
-  operation._group = this;
-  operation._priority = priority;
-  entry.pushOperation(operation);
-  
-  ++_pendingOperations; // enter group
-  
+  ASAsyncTransactionQueue::Shard &shard = _queue.shardForQueue(queue);
+
+  enter();
+
 #if ASDISPLAYNODE_DELAY_DISPLAY
   NSUInteger maxThreads = 1;
 #else 
@@ -230,6 +299,25 @@ void ASAsyncTransactionQueue::GroupImpl::schedule(NSInteger priority, dispatch_q
   if ([[NSRunLoop mainRunLoop].currentMode isEqualToString:UITrackingRunLoopMode])
     --maxThreads;
 #endif
+
+  lockShard(shard);
+  AS::UniqueLock l(shard._mutex, std::adopt_lock);
+  
+  DispatchEntry &entry = shard._entries[queue];
+
+  const auto control = std::make_shared<OperationControl>();
+  control->_block = block;
+  control->_group = this;
+  control->_queue = queue;
+  control->_priority = priority;
+  control->_enqueueTime = std::chrono::steady_clock::now();
+
+  Operation operation;
+  operation._control = control;
+  operation._priority = priority;
+  entry.pushOperation(operation);
+  shard._scheduledOperations++;
+  shard._maxOperationCount = MAX(shard._maxOperationCount, entry._operationCount);
   
   if (entry._threadCount < maxThreads) { // we need to spawn another thread
 
@@ -238,34 +326,84 @@ void ASAsyncTransactionQueue::GroupImpl::schedule(NSInteger priority, dispatch_q
     ++entry._threadCount;
     
     dispatch_async(queue, ^{
-      std::unique_lock<std::mutex> lock(q._mutex);
+      lockShard(shard);
+      AS::UniqueLock lock(shard._mutex, std::adopt_lock);
       
       // go until there are no more pending operations
-      while (!entry._operationQueue.empty()) {
+      while (entry._operationCount > 0) {
         Operation operation = entry.popNextOperation(respectPriority);
+        OperationControl &control = *operation._control;
+
+        // Claim the operation; an entry left behind by a reprioritization finds it already claimed.
+        int state = OperationControl::Queued;
+        if (!control._state.compare_exchange_strong(state, OperationControl::Started)
+            && !(state == OperationControl::Cancelled && control._state.compare_exchange_strong(state, OperationControl::Started))) {
+          continue;
+        }
+        const bool run = (state == OperationControl::Queued);
+        if (run) {
+          const auto latency = std::chrono::steady_clock::now() - control._enqueueTime;
+          shard._startedOperations++;
+          shard._queueLatency += latency;
+          shard._maxQueueLatency = std::max(shard._maxQueueLatency, latency);
+        } else {
+          shard._cancelledOperations++;
+        }
         lock.unlock();
-        if (operation._block) {
-          operation._block();
+        if (run && control._block) {
+          control._block();
         }
-        operation._group->leave();
-        operation._block = nil; // the block must be freed while mutex is unlocked
-        lock.lock();
+        control._group->leave();
+        control._block = nil; // the block must be freed while mutex is unlocked
+        operation._control.reset();
+        lockShard(shard);
+        lock = AS::UniqueLock(shard._mutex, std::adopt_lock);
       }
       --entry._threadCount;
       
       if (entry._threadCount == 0) {
-        NSCAssert(entry._operationQueue.empty() || entry._operationPriorityMap.empty(), @"No working threads but operations are still scheduled"); // this shouldn't happen
-        q._entries.erase(queue);
+        NSCAssert(entry._operationCount == 0, @"No working threads but operations are still scheduled"); // this shouldn't happen
+        shard._entries.erase(queue);
       }
     });
   }
+
+  return control;
+}
+
+void ASAsyncTransactionQueue::cancel(OperationControl &control)
+{
+  int state = OperationControl::Queued;
+  control._state.compare_exchange_strong(state, OperationControl::Cancelled);
+}
+
+void ASAsyncTransactionQueue::setPriority(const std::shared_ptr<OperationControl> &control, NSInteger priority)
+{
+  if (control->_state.load() != OperationControl::Queued) {
+    return;
+  }
+  Shard &shard = shardForQueue(control->_queue);
+  lockShard(shard);
+  AS::MutexLocker l(shard._mutex, std::adopt_lock);
+
+  // The entry exists as long as one of the operation's entries is queued.
+  const auto it = shard._entries.find(control->_queue);
+  if (it == shard._entries.end() || control->_state.load() != OperationControl::Queued || control->_priority == priority) {
+    return;
+  }
+  control->_priority = priority;
+  Operation operation;
+  operation._control = control;
+  operation._priority = priority;
+  it->second.pushOperation(operation);
+  shard._reprioritizedOperations++;
 }
 
 void ASAsyncTransactionQueue::GroupImpl::notify(dispatch_queue_t queue, dispatch_block_t block)
 {
-  std::lock_guard<std::mutex> l(_queue._mutex);
+  std::lock_guard<std::mutex> l(_mutex);
 
-  if (_pendingOperations == 0) {
+  if (_pendingOperations.load() == 0) {
     dispatch_async(queue, block);
   } else {
     _notifyList.push_back({block, queue});
@@ -274,37 +412,48 @@ void ASAsyncTransactionQueue::GroupImpl::notify(dispatch_queue_t queue, dispatch
 
 void ASAsyncTransactionQueue::GroupImpl::enter()
 {
-  std::lock_guard<std::mutex> l(_queue._mutex);
-  ++_pendingOperations;
+  _pendingOperations.fetch_add(1);
 }
 
 void ASAsyncTransactionQueue::GroupImpl::leave()
 {
-  std::lock_guard<std::mutex> l(_queue._mutex);
-  --_pendingOperations;
-  
-  if (_pendingOperations == 0) {
-    std::list<GroupNotify> notifyList;
-    _notifyList.swap(notifyList);
-    
-    for (GroupNotify & notify : notifyList) {
-      dispatch_async(notify._queue, notify._block);
+  // Not the last pending operation: just count down.
+  int pending = _pendingOperations.load();
+  while (pending > 1) {
+    if (_pendingOperations.compare_exchange_weak(pending, pending - 1)) {
+      return;
     }
-    
-    _condition.notify_one();
-    
-    // there was attempt to release the group before, but we still
-    // had operations scheduled so now is good time
-    if (_releaseCalled) {
-      delete this;
+  }
+
+  // Possibly the last one. The counter only reaches zero with _mutex held, so release() can't delete the group
+  // underneath us.
+  std::list<GroupNotify> notifyList;
+  bool shouldDelete = false;
+  {
+    std::lock_guard<std::mutex> l(_mutex);
+    if (_pendingOperations.fetch_sub(1) == 1) {
+      _notifyList.swap(notifyList);
+      _condition.notify_one();
+
+      // there was attempt to release the group before, but we still
+      // had operations scheduled so now is good time
+      shouldDelete = _releaseCalled;
     }
   }
+
+  for (GroupNotify & notify : notifyList) {
+    dispatch_async(notify._queue, notify._block);
+  }
+
+  if (shouldDelete) {
+    delete this;
+  }
 }
 
 void ASAsyncTransactionQueue::GroupImpl::wait()
 {
-  std::unique_lock<std::mutex> lock(_queue._mutex);
-  while (_pendingOperations > 0) {
+  std::unique_lock<std::mutex> lock(_mutex);
+  while (_pendingOperations.load() > 0) {
     _condition.wait(lock);
   }
 }
@@ -315,6 +464,105 @@ ASAsyncTransactionQueue & ASAsyncTransactionQueue::instance()
   return *instance;
 }
 
+ASAsyncTransactionQueueStatistics ASAsyncTransactionQueue::statistics()
+{
+  ASAsyncTransactionQueueStatistics statistics = {};
+  std::chrono::steady_clock::duration lockWaitTime = std::chrono::steady_clock::duration::zero();
+  std::chrono::steady_clock::duration queueLatency = std::chrono::steady_clock::duration::zero();
+  std::chrono::steady_clock::duration maxQueueLatency = std::chrono::steady_clock::duration::zero();
+  for (Shard &shard : _shards) {
+    AS::MutexLocker l(shard._mutex);
+    statistics.scheduledOperations += shard._scheduledOperations;
+    statistics.lockCount += shard._lockCount;
+    statistics.contendedLockCount += shard._contendedLockCount;
+    statistics.maxQueueDepth = MAX(statistics.maxQueueDepth, shard._maxOperationCount);
+    statistics.startedOperations += shard._startedOperations;
+    statistics.cancelledOperations += shard._cancelledOperations;
+    statistics.reprioritizedOperations += shard._reprioritizedOperations;
+    lockWaitTime += shard._lockWaitTime;
+    queueLatency += shard._queueLatency;
+    maxQueueLatency = std::max(maxQueueLatency, shard._maxQueueLatency);
+  }
+  statistics.lockWaitTime = std::chrono::duration<NSTimeInterval>(lockWaitTime).count();
+  statistics.queueLatency = std::chrono::duration<NSTimeInterval>(queueLatency).count();
+  statistics.maxQueueLatency = std::chrono::duration<NSTimeInterval>(maxQueueLatency).count();
+  return statistics;
+}
+
+NSDictionary<NSNumber *, NSNumber *> *ASAsyncTransactionQueue::queueDepths()
+{
+  std::map<NSInteger, NSUInteger> depths;
+  for (Shard &shard : _shards) {
+    AS::MutexLocker l(shard._mutex);
+    for (const auto &entry : shard._entries) {
+      for (const auto &bucket : entry.second._operationPriorityMap) {
+        depths[bucket.first] += bucket.second.size();
+      }
+    }
+  }
+  NSMutableDictionary<NSNumber *, NSNumber *> *result = [[NSMutableDictionary alloc] init];
+  for (const auto &depth : depths) {
+    result[@(depth.first)] = @(depth.second);
+  }
+  return result;
+}
+
+void ASAsyncTransactionQueue::resetStatistics()
+{
+  for (Shard &shard : _shards) {
+    AS::MutexLocker l(shard._mutex);
+    shard._scheduledOperations = 0;
+    shard._lockCount = 0;
+    shard._contendedLockCount = 0;
+    shard._lockWaitTime = std::chrono::steady_clock::duration::zero();
+    shard._maxOperationCount = 0;
+    shard._startedOperations = 0;
+    shard._cancelledOperations = 0;
+    shard._reprioritizedOperations = 0;
+    shard._queueLatency = std::chrono::steady_clock::duration::zero();
+    shard._maxQueueLatency = std::chrono::steady_clock::duration::zero();
+  }
+}
+
+ASAsyncTransactionQueueStatistics ASAsyncTransactionQueueGetStatistics(void)
+{
+  return ASAsyncTransactionQueue::instance().statistics();
+}
+
+NSDictionary<NSNumber *, NSNumber *> *ASAsyncTransactionQueueGetQueueDepths(void)
+{
+  return ASAsyncTransactionQueue::instance().queueDepths();
+}
+
+void ASAsyncTransactionQueueResetStatistics(void)
+{
+  ASAsyncTransactionQueue::instance().resetStatistics();
+}
+
+@implementation _ASAsyncTransactionOperationHandle {
+  std::shared_ptr<ASAsyncTransactionQueue::OperationControl> _control;
+}
+
+- (instancetype)initWithControl:(const std::shared_ptr<ASAsyncTransactionQueue::OperationControl> &)control
+{
+  if ((self = [super init])) {
+    _control = control;
+  }
+  return self;
+}
+
+- (void)cancel
+{
+  ASAsyncTransactionQueue::cancel(*_control);
+}
+
+- (void)setPriority:(NSInteger)priority
+{
+  ASAsyncTransactionQueue::instance().setPriority(_control, priority);
+}
+
+@end
+
 @interface _ASAsyncTransaction ()
 @property ASAsyncTransactionState state;
 @end
@@ -348,10 +596,10 @@ ASAsyncTransactionQueue & ASAsyncTransactionQueue::instance()
 
 #pragma mark - Transaction Management
 
-- (void)addOperationWithBlock:(asyncdisplaykit_async_transaction_operation_block_t)block
-                     priority:(NSInteger)priority
-                        queue:(dispatch_queue_t)queue
-                   completion:(asyncdisplaykit_async_transaction_operation_completion_block_t)completion
+- (_ASAsyncTransactionOperationHandle *)addOperationWithBlock:(asyncdisplaykit_async_transaction_operation_block_t)block
+                                                     priority:(NSInteger)priority
+                                                        queue:(dispatch_queue_t)queue
+                                                   completion:(asyncdisplaykit_async_transaction_operation_completion_block_t)completion
 {
   ASDisplayNodeAssertMainThread();
   NSAssert(self.state == ASAsyncTransactionStateOpen, @"You can only add operations to open transactions");
@@ -360,13 +608,14 @@ ASAsyncTransactionQueue & ASAsyncTransactionQueue::instance()
 
   ASAsyncTransactionOperation *operation = [[ASAsyncTransactionOperation alloc] initWithOperationCompletionBlock:completion];
   [_operations addObject:operation];
-  _group->schedule(priority, queue, ^{
+  const auto control = _group->schedule(priority, queue, ^{
     @autoreleasepool {
       if (self.state != ASAsyncTransactionStateCanceled) {
         operation.value = block();
       }
     }
   });
+  return [[_ASAsyncTransactionOperationHandle alloc] initWithControl:control];
 }
 
 - (void)cancel
@@ -13,6 +13,9 @@
 #import <queue>
 
 #import <AsyncDisplayKit/ASCollections.h>
+#import <AsyncDisplayKit/ASConfigurationInternal.h>
+#import <AsyncDisplayKit/ASLayoutArena.h>
+#import <AsyncDisplayKit/ASLayoutPrivate.h>
 #import <AsyncDisplayKit/ASLayoutSpecUtilities.h>
 #import <AsyncDisplayKit/ASLayoutSpec+Subclasses.h>
 
@@ -52,6 +55,8 @@ ASDISPLAYNODE_INLINE AS_WARN_UNUSED_RESULT BOOL ASLayoutIsDisplayNodeType(ASLayo
 {
   ASLayoutElementType _layoutElementType;
   std::atomic_bool _retainSublayoutElements;
+  // Built lazily by ASLayoutGetFlatLayout(). Accessed with std::atomic_load/store.
+  std::shared_ptr<const AS::FlatLayout> _flatLayout;
 }
 @end
 
@@ -274,6 +279,38 @@ static std::atomic_bool static_retainsSublayoutLayoutElements = ATOMIC_VAR_INIT(
   return YES;
 }
 
+#pragma mark - Flat Layout
+
+static std::shared_ptr<const AS::FlatLayout> ASLayoutCreateFlatLayout(ASLayout *root)
+{
+  const auto flatLayout = std::make_shared<AS::FlatLayout>();
+  NSArray<ASLayout *> *sublayouts = root.sublayouts;
+  flatLayout->reserve(sublayouts.count);
+
+  // Only the direct sublayouts: -frameForElement: never looks deeper, and a filtered node layout has no deeper levels.
+  for (ASLayout *sublayout in sublayouts) {
+    const CGRect frame = sublayout.frame;
+    flatLayout->append((__bridge AS::FlatLayout::Element)sublayout.layoutElement,
+                       {frame.origin.x, frame.origin.y, frame.size.width, frame.size.height});
+  }
+
+  flatLayout->finalize();
+  return flatLayout;
+}
+
+std::shared_ptr<const AS::FlatLayout> ASLayoutGetFlatLayout(ASLayout *layout)
+{
+  std::shared_ptr<const AS::FlatLayout> flatLayout = std::atomic_load(&layout->_flatLayout);
+  if (flatLayout == nullptr) {
+    std::shared_ptr<const AS::FlatLayout> built = ASLayoutCreateFlatLayout(layout);
+    // If another thread won the race, use its copy.
+    if (std::atomic_compare_exchange_strong(&layout->_flatLayout, &flatLayout, built)) {
+      flatLayout = std::move(built);
+    }
+  }
+  return flatLayout;
+}
+
 #pragma mark - Accessors
 
 - (ASLayoutElementType)type
@@ -283,6 +320,13 @@ static std::atomic_bool static_retainsSublayoutLayoutElements = ATOMIC_VAR_INIT(
 
 - (CGRect)frameForElement:(id<ASLayoutElement>)layoutElement
 {
+  // Only use the flat layout if the sublayout elements are retained, otherwise a stale element id could match.
+  if (_sublayouts.count >= ASLayoutFlatLookupThreshold && _retainSublayoutElements.load()) {
+    const auto flatLayout = ASLayoutGetFlatLayout(self);
+    const uint32_t index = flatLayout->indexOfElement((__bridge AS::FlatLayout::Element)layoutElement);
+    return index != AS::FlatLayout::kNotFound ? ASFlatLayoutRectToCGRect(flatLayout->frame(index)) : CGRectNull;
+  }
+
   for (ASLayout *l in _sublayouts) {
     if (l->_layoutElement == layoutElement) {
       return l.frame;
@@ -370,6 +414,7 @@ ASLayout *ASCalculateLayout(id<ASLayoutElement> layoutElement, const ASSizeRange
 
 ASLayout *ASCalculateRootLayout(id<ASLayoutElement> rootLayoutElement, const ASSizeRange sizeRange)
 {
+  AS::ArenaScope arenaScope(ASActivateExperimentalFeature(ASExperimentalLayoutArena));
   ASLayout *layout = ASCalculateLayout(rootLayoutElement, sizeRange, sizeRange.max);
   // Here could specific verfication happen
   return layout;
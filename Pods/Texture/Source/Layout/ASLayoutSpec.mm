@@ -13,6 +13,7 @@
 #import <AsyncDisplayKit/ASLayoutSpec+Subclasses.h>
 
 #import <AsyncDisplayKit/ASCollections.h>
+#import <AsyncDisplayKit/ASDisplayNode+FrameworkPrivate.h>
 #import <AsyncDisplayKit/ASLayoutElementStylePrivate.h>
 #import <AsyncDisplayKit/ASEqualityHelpers.h>
 
@@ -142,6 +143,7 @@ ASLayoutElementLayoutCalculationDefaults
 
 - (ASPrimitiveTraitCollection)primitiveTraitCollection
 {
+  ASDisplayNodeNoteTraitCollectionRead();
   AS::MutexLocker l(__instanceLock__);
   return _primitiveTraitCollection;
 }
@@ -13,7 +13,9 @@
 #import <vector>
 
 #import <AsyncDisplayKit/ASCollections.h>
+#import <AsyncDisplayKit/ASConfigurationInternal.h>
 #import <AsyncDisplayKit/ASLayout.h>
+#import <AsyncDisplayKit/ASLayoutArena.h>
 #import <AsyncDisplayKit/ASLayoutElementStylePrivate.h>
 #import <AsyncDisplayKit/ASLayoutSpecUtilities.h>
 #import <AsyncDisplayKit/ASLog.h>
@@ -133,16 +135,21 @@
  
   as_activity_scope_verbose(as_activity_create("Calculate stack layout", AS_ACTIVITY_CURRENT, OS_ACTIVITY_FLAG_DEFAULT));
   as_log_verbose(ASLayoutLog(), "Stack layout %@", self);
+  // Stacks measured on a concurrent worker thread are not covered by the node's arena scope, so open one here too.
+  AS::ArenaScope arenaScope(ASActivateExperimentalFeature(ASExperimentalLayoutArena));
+
   // Accessing the style and size property is pretty costly we create layout spec children we use to figure
   // out the layout for each child
-  const auto stackChildren = AS::map(children, [&](const id<ASLayoutElement> child) -> ASStackLayoutSpecChild {
+  AS::ArenaVector<ASStackLayoutSpecChild> stackChildren;
+  stackChildren.reserve(children.count);
+  for (id<ASLayoutElement> child in children) {
     ASLayoutElementStyle *style = child.style;
-    return {child, style, style.size};
-  });
+    stackChildren.push_back({child, style, style.size});
+  }
   
   const ASStackLayoutSpecStyle style = {.direction = _direction, .spacing = _spacing, .justifyContent = _justifyContent, .alignItems = _alignItems, .flexWrap = _flexWrap, .alignContent = _alignContent, .lineSpacing = _lineSpacing};
   
-  const auto unpositionedLayout = ASStackUnpositionedLayout::compute(stackChildren, style, constrainedSize, _concurrent);
+  auto unpositionedLayout = ASStackUnpositionedLayout::compute(stackChildren, style, constrainedSize, _concurrent);
   const auto positionedLayout = ASStackPositionedLayout::compute(unpositionedLayout, style, constrainedSize);
   
   if (style.direction == ASStackLayoutDirectionVertical) {
@@ -150,10 +157,10 @@
     self.style.descender = stackChildren.back().style.descender;
   }
 
-  ASLayout *rawSublayouts[positionedLayout.items.size()];
+  ASLayout *rawSublayouts[positionedLayout.sublayouts.size()];
   int i = 0;
-  for (const auto &item : positionedLayout.items) {
-    rawSublayouts[i++] = item.layout;
+  for (ASLayout *sublayout : positionedLayout.sublayouts) {
+    rawSublayouts[i++] = sublayout;
   }
 
   const auto sublayouts = [NSArray<ASLayout *> arrayByTransferring:rawSublayouts count:i];
@@ -18,4 +18,18 @@
 
 + (std::vector<std::vector<ASRangeTuningParameters>>)defaultTuningParameters; 
 
+/**
+ * Records the scroll position for ASExperimentalAdaptiveRanges. Subclasses call it from -prepareForRangeUpdate with
+ * the bounds of their scroll view, so there is exactly one sample per range update.
+ */
+- (void)sampleScrollBounds:(CGRect)bounds scrollableDirections:(ASScrollDirection)scrollableDirections;
+
+/**
+ * The tuning parameters for computing a range. These are the configured ones, except with
+ * ASExperimentalAdaptiveRanges in full range mode, where they are adapted to the scroll velocity measured from the
+ * samples of successive range updates (see ASAdaptiveRange.h).
+ */
+- (ASRangeTuningParameters)adaptedTuningParametersForRangeMode:(ASLayoutRangeMode)rangeMode
+                                                     rangeType:(ASLayoutRangeType)rangeType;
+
 @end
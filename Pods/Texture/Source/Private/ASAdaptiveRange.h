@@ -0,0 +1,147 @@
+//
+//  ASAdaptiveRange.h
+//  Texture
+//
+//  Copyright (c) Pinterest, Inc.  All rights reserved.
+//  Licensed under Apache 2.0: http://www.apache.org/licenses/LICENSE-2.0
+//
+
+#pragma once
+
+/**
+ Velocity-aware range tuning. Plain C++, like ASWorkStealing.h.
+
+ Static tuning parameters are a compromise: at fling speed, a leading buffer of a screenful or two is crossed before
+ its cells are displayed, while at reading speed it holds backing stores that won't be needed for seconds. This model
+ tracks the scroll offset along the scroll axis and extends the leading buffer by the distance covered while a cell
+ gets ready (the latency of the range type). The extension is capped at the distance left before a decelerating scroll
+ stops, and the whole range (leading + visible + trailing) at a budget in screenfuls. When scrolling has been idle
+ for a while, both buffers shrink.
+
+ The model is only fed samples; it has no clock of its own, so replaying a recorded trace is deterministic.
+ */
+
+#include <algorithm>
+#include <cmath>
+
+namespace AS {
+
+class AdaptiveRange {
+public:
+  typedef double Float;
+
+  struct Configuration {
+    /** Time constant of the velocity and deceleration smoothing, in seconds. */
+    Float smoothing = 0.05;
+    /** Seconds without movement after which scrolling is idle. */
+    Float idleDelay = 0.5;
+    /** Factor applied to both buffers while idle. */
+    Float idleScale = 0.5;
+    /** Below this speed, in screenfuls per second, the buffers are left alone. */
+    Float minimumSpeed = 0.5;
+    /** Largest range, visible screenful included, in screenfuls. This bounds the backing store memory. */
+    Float maximumScreenfuls = 8;
+  };
+
+  struct Buffers {
+    Float leading;
+    Float trailing;
+  };
+
+  AdaptiveRange() {}
+  explicit AdaptiveRange(const Configuration &configuration) : _configuration(configuration) {}
+
+  const Configuration &configuration() const { return _configuration; }
+  void setConfiguration(const Configuration &configuration) { _configuration = configuration; }
+
+  /**
+   Records the scroll offset (the minimum of the viewport along the scroll axis) at a time, in seconds. Samples with
+   the same or an earlier time than the last one are ignored, except for updating the viewport length.
+   */
+  void sample(Float time, Float offset, Float viewportLength)
+  {
+    _viewportLength = viewportLength;
+    if (!_hasSample) {
+      _hasSample = true;
+      _time = _lastMovementTime = time;
+      _offset = offset;
+      return;
+    }
+    const Float dt = time - _time;
+    if (!(dt > 0)) {
+      return;
+    }
+
+    const Float instantVelocity = (offset - _offset) / dt;
+    const Float alpha = 1 - std::exp(-dt / _configuration.smoothing);
+    const Float previousSpeed = std::fabs(_velocity);
+    _velocity += alpha * (instantVelocity - _velocity);
+    const Float instantDeceleration = (previousSpeed - std::fabs(_velocity)) / dt;
+    _deceleration += alpha * (std::max<Float>(instantDeceleration, 0) - _deceleration);
+
+    if (offset != _offset) {
+      _lastMovementTime = time;
+    } else if (time - _lastMovementTime >= _configuration.idleDelay) {
+      // Stopped: forget the motion rather than letting it decay, so the next scroll starts from rest.
+      _velocity = 0;
+      _deceleration = 0;
+    }
+    _time = time;
+    _offset = offset;
+  }
+
+  /** Smoothed velocity along the scroll axis, in points per second. */
+  Float velocity() const { return _velocity; }
+
+  /** Smoothed deceleration, in points per second squared. Zero while accelerating. */
+  Float deceleration() const { return _deceleration; }
+
+  bool isIdle() const { return _hasSample && _time - _lastMovementTime >= _configuration.idleDelay; }
+
+  /**
+   Adapts static buffers (in screenfuls) to the current motion.
+   @param latency Seconds it takes an item entering the range to be ready, e.g. to be displayed for the display range.
+   */
+  Buffers adapt(Buffers buffers, Float latency) const
+  {
+    if (!_hasSample || !(_viewportLength > 0)) {
+      return buffers;
+    }
+    if (isIdle()) {
+      buffers.leading *= _configuration.idleScale;
+      buffers.trailing *= _configuration.idleScale;
+      return buffers;
+    }
+
+    const Float speed = std::fabs(_velocity);
+    if (speed / _viewportLength >= _configuration.minimumSpeed) {
+      Float distance = speed * latency;
+      if (_deceleration > 0) {
+        // Won't go further than where the scroll stops.
+        distance = std::min(distance, speed * speed / (2 * _deceleration));
+      }
+      buffers.leading += distance / _viewportLength;
+    }
+
+    // Over budget: the trailing buffer goes first, down to a quarter screenful, then the leading one.
+    const Float budget = std::max<Float>(_configuration.maximumScreenfuls - 1, 0);
+    if (buffers.leading + buffers.trailing > budget) {
+      buffers.trailing = std::max<Float>(std::min<Float>(buffers.trailing, 0.25), budget - buffers.leading);
+      buffers.trailing = std::min(buffers.trailing, budget);
+      buffers.leading = std::min(buffers.leading, budget - buffers.trailing);
+    }
+    return buffers;
+  }
+
+private:
+  Configuration _configuration;
+  bool _hasSample = false;
+  Float _time = 0;
+  Float _offset = 0;
+  Float _lastMovementTime = 0;
+  Float _viewportLength = 0;
+  Float _velocity = 0;
+  Float _deceleration = 0;
+};
+
+} // namespace AS
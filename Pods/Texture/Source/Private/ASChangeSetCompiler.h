@@ -0,0 +1,335 @@
+//
+//  ASChangeSetCompiler.h
+//  Texture
+//
+//  Copyright (c) Pinterest, Inc.  All rights reserved.
+//  Licensed under Apache 2.0: http://www.apache.org/licenses/LICENSE-2.0
+//
+
+#pragma once
+
+/**
+ Merges consecutive batch updates into one. Plain C++, like ASWorkStealing.h; _ASHierarchyChangeSet converts to and
+ from it.
+
+ A change set has UIKit batch update semantics: deletes and reloads use indexes before the update, inserts indexes
+ after it, and item changes in deleted, inserted or reloaded sections don't count. compose(a, b) returns the change
+ set that takes the data from before `a` to after `b`:
+
+ - What either one deletes is deleted, unless `a` inserted it, in which case it was never there.
+ - What either one inserts is inserted, unless `b` deletes it.
+ - What either one reloads and both keep is reloaded. Items of a reloaded section get no item changes.
+
+ Changes are sorted vectors of indexes, so an index moves through an update in O(log changes): the position of an
+ index among the survivors is found with a binary search over the deletes, and its position after the update with
+ one over the inserts. Nothing is done per unchanged item or section.
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace AS {
+
+class ChangeSetCompiler {
+public:
+  typedef std::ptrdiff_t Index;
+  typedef std::uint64_t Options;
+
+  enum : Index { kNotFound = -1 };
+
+  struct SectionChange {
+    Index section;
+    Options options;
+  };
+
+  struct ItemChange {
+    Index section;
+    Index item;
+    Options options;
+  };
+
+  struct ChangeSet {
+    /** Item counts per section, before and after the update. */
+    std::vector<Index> oldCounts;
+    std::vector<Index> newCounts;
+
+    /** Sorted and unique, see normalize(). */
+    std::vector<SectionChange> deletedSections;
+    std::vector<SectionChange> insertedSections;
+    std::vector<SectionChange> reloadedSections;
+    std::vector<ItemChange> deletedItems;
+    std::vector<ItemChange> insertedItems;
+    std::vector<ItemChange> reloadedItems;
+
+    /** Sorts the changes by index. For duplicate indexes, the last options win. */
+    void normalize()
+    {
+      normalizeChanges(deletedSections);
+      normalizeChanges(insertedSections);
+      normalizeChanges(reloadedSections);
+      normalizeChanges(deletedItems);
+      normalizeChanges(insertedItems);
+      normalizeChanges(reloadedItems);
+    }
+  };
+
+  /** The change set for `a` followed by `b`. Both must be normalized, and `b` must start where `a` ends. */
+  static ChangeSet compose(const ChangeSet &a, const ChangeSet &b)
+  {
+    ChangeSet result;
+    result.oldCounts = a.oldCounts;
+    result.newCounts = b.newCounts;
+
+    Mapping sectionsA, sectionsB;
+    sectionsA.assign(range(a.deletedSections), range(a.insertedSections));
+    sectionsB.assign(range(b.deletedSections), range(b.insertedSections));
+    Workspace workspace;
+
+    for (Index s = 0; s < (Index)a.oldCounts.size(); s++) {
+      const Index m = sectionsA.forward(s);
+      const Index n = (m == kNotFound ? kNotFound : sectionsB.forward(m));
+      if (m == kNotFound) {
+        result.deletedSections.push_back({s, find(a.deletedSections, s)->options});
+      } else if (n == kNotFound) {
+        result.deletedSections.push_back({s, find(b.deletedSections, m)->options});
+      } else if (const SectionChange *reload = find(b.reloadedSections, m)) {
+        result.reloadedSections.push_back({s, reload->options});
+      } else if (const SectionChange *reload = find(a.reloadedSections, s)) {
+        result.reloadedSections.push_back({s, reload->options});
+      } else {
+        composeItems(a, b, s, m, n, workspace, result);
+      }
+    }
+
+    for (Index n = 0; n < (Index)b.newCounts.size(); n++) {
+      const Index m = sectionsB.backward(n);
+      if (m == kNotFound) {
+        result.insertedSections.push_back({n, find(b.insertedSections, n)->options});
+      } else if (sectionsA.backward(m) == kNotFound) {
+        result.insertedSections.push_back({n, find(a.insertedSections, m)->options});
+      }
+    }
+
+    // Sections are visited in order, and both mappings are increasing, so every list is already sorted.
+    return result;
+  }
+
+  /**
+   The change set for all of `changeSets`, in order. Composes neighbors pairwise, level by level, so each change is
+   copied O(log n) times rather than once per later change set.
+   */
+  static ChangeSet composeAll(std::vector<ChangeSet> changeSets)
+  {
+    if (changeSets.empty()) {
+      return ChangeSet();
+    }
+    while (changeSets.size() > 1) {
+      std::size_t count = 0;
+      for (std::size_t i = 0; i < changeSets.size(); i += 2) {
+        changeSets[count++] = (i + 1 < changeSets.size() ? compose(changeSets[i], changeSets[i + 1]) : std::move(changeSets[i]));
+      }
+      changeSets.resize(count);
+    }
+    return std::move(changeSets.front());
+  }
+
+private:
+  /**
+   The index mapping of an update, from sorted unique deleted (old) and inserted (new) indexes.
+   */
+  class Mapping {
+  public:
+    /** Sets the changes, reusing the storage of the previous ones. */
+    template <typename Change>
+    void assign(std::pair<const Change *, const Change *> deleted, std::pair<const Change *, const Change *> inserted)
+    {
+      assignIndexes(_deleted, _deletedShifted, deleted);
+      assignIndexes(_inserted, _insertedShifted, inserted);
+    }
+
+    /** The new index of an old one, or kNotFound if it was deleted. */
+    Index forward(Index index) const { return map(index, _deleted, _insertedShifted); }
+
+    /** The old index of a new one, or kNotFound if it was inserted. */
+    Index backward(Index index) const { return map(index, _inserted, _deletedShifted); }
+
+  private:
+    /** Also keeps index[j] - j, which is non-decreasing for sorted unique indexes. */
+    template <typename Change>
+    static void assignIndexes(std::vector<Index> &indexes, std::vector<Index> &shifted,
+                              std::pair<const Change *, const Change *> changes)
+    {
+      indexes.clear();
+      shifted.clear();
+      for (const Change *c = changes.first; c != changes.second; c++) {
+        shifted.push_back(indexOf(*c) - (Index)indexes.size());
+        indexes.push_back(indexOf(*c));
+      }
+    }
+
+    static Index map(Index index, const std::vector<Index> &removed, const std::vector<Index> &addedShifted)
+    {
+      const auto r = std::lower_bound(removed.begin(), removed.end(), index);
+      if (r != removed.end() && *r == index) {
+        return kNotFound;
+      }
+      // Rank among the survivors, then skip every added index at or before the result: the added index j lands at
+      // or before rank + j exactly when added[j] - j <= rank.
+      const Index rank = index - (r - removed.begin());
+      return rank + (std::upper_bound(addedShifted.begin(), addedShifted.end(), rank) - addedShifted.begin());
+    }
+
+    std::vector<Index> _deleted;
+    std::vector<Index> _inserted;
+    std::vector<Index> _deletedShifted;
+    std::vector<Index> _insertedShifted;
+  };
+
+  /** Storage reused across the sections of a compose(). */
+  struct Workspace {
+    Mapping itemsA;
+    Mapping itemsB;
+    std::vector<ItemChange> merged;
+  };
+
+  /** Item changes of a section that survives both updates, and isn't reloaded: s -> m -> n. */
+  static void composeItems(const ChangeSet &a, const ChangeSet &b, Index s, Index m, Index n, Workspace &workspace,
+                           ChangeSet &result)
+  {
+    const auto deletedA = inSection(a.deletedItems, s), insertedA = inSection(a.insertedItems, m);
+    const auto reloadedA = inSection(a.reloadedItems, s);
+    const auto deletedB = inSection(b.deletedItems, m), insertedB = inSection(b.insertedItems, n);
+    const auto reloadedB = inSection(b.reloadedItems, m);
+    if (deletedA.first == deletedA.second && insertedA.first == insertedA.second && reloadedA.first == reloadedA.second
+        && deletedB.first == deletedB.second && insertedB.first == insertedB.second && reloadedB.first == reloadedB.second) {
+      return;
+    }
+    Mapping &itemsA = workspace.itemsA, &itemsB = workspace.itemsB;
+    itemsA.assign(deletedA, insertedA);
+    itemsB.assign(deletedB, insertedB);
+
+    // Each list gets two ascending runs for the section, merged in place.
+    std::size_t start = result.deletedItems.size();
+    for (const ItemChange *c = deletedA.first; c != deletedA.second; c++) {
+      result.deletedItems.push_back({s, c->item, c->options});
+    }
+    std::size_t middle = result.deletedItems.size();
+    for (const ItemChange *c = deletedB.first; c != deletedB.second; c++) {
+      const Index i = itemsA.backward(c->item);
+      if (i != kNotFound) {
+        result.deletedItems.push_back({s, i, c->options});
+      }
+    }
+    mergeRuns(result.deletedItems, start, middle, workspace.merged);
+
+    start = result.insertedItems.size();
+    for (const ItemChange *c = insertedB.first; c != insertedB.second; c++) {
+      result.insertedItems.push_back({n, c->item, c->options});
+    }
+    middle = result.insertedItems.size();
+    for (const ItemChange *c = insertedA.first; c != insertedA.second; c++) {
+      const Index k = itemsB.forward(c->item);
+      if (k != kNotFound) {
+        result.insertedItems.push_back({n, k, c->options});
+      }
+    }
+    mergeRuns(result.insertedItems, start, middle, workspace.merged);
+
+    // Both may reload an item. Those of `b` come second, so their options win.
+    start = result.reloadedItems.size();
+    for (const ItemChange *c = reloadedA.first; c != reloadedA.second; c++) {
+      const Index j = itemsA.forward(c->item);
+      if (j != kNotFound && itemsB.forward(j) != kNotFound) {
+        result.reloadedItems.push_back({s, c->item, c->options});
+      }
+    }
+    middle = result.reloadedItems.size();
+    for (const ItemChange *c = reloadedB.first; c != reloadedB.second; c++) {
+      const Index i = itemsA.backward(c->item);
+      if (i != kNotFound) {
+        result.reloadedItems.push_back({s, i, c->options});
+      }
+    }
+    mergeRuns(result.reloadedItems, start, middle, workspace.merged);
+  }
+
+  /** Merges the ascending runs [start, middle) and [middle, end) of `changes`, keeping the last of equal indexes. */
+  static void mergeRuns(std::vector<ItemChange> &changes, std::size_t start, std::size_t middle,
+                        std::vector<ItemChange> &merged)
+  {
+    if (start == middle || middle == changes.size()) {
+      return;
+    }
+    merged.clear();
+    std::size_t i = start, j = middle;
+    while (i < middle || j < changes.size()) {
+      if (j == changes.size() || (i < middle && precedes(changes[i], changes[j]))) {
+        merged.push_back(changes[i++]);
+      } else {
+        if (i < middle && sameIndex(changes[i], changes[j])) {
+          i++;
+        }
+        merged.push_back(changes[j++]);
+      }
+    }
+    changes.resize(start);
+    changes.insert(changes.end(), merged.begin(), merged.end());
+  }
+
+  typedef std::pair<const ItemChange *, const ItemChange *> ItemRange;
+
+  static ItemRange inSection(const std::vector<ItemChange> &changes, Index section)
+  {
+    const auto begin = std::lower_bound(changes.begin(), changes.end(), section, [](const ItemChange &c, Index section) {
+      return c.section < section;
+    });
+    const auto end = std::upper_bound(begin, changes.end(), section, [](Index section, const ItemChange &c) {
+      return section < c.section;
+    });
+    const ItemChange *data = changes.data();
+    return ItemRange(data + (begin - changes.begin()), data + (end - changes.begin()));
+  }
+
+  static const SectionChange *find(const std::vector<SectionChange> &changes, Index section)
+  {
+    const auto c = std::lower_bound(changes.begin(), changes.end(), section, [](const SectionChange &c, Index section) {
+      return c.section < section;
+    });
+    return (c != changes.end() && c->section == section) ? &*c : nullptr;
+  }
+
+  static std::pair<const SectionChange *, const SectionChange *> range(const std::vector<SectionChange> &changes)
+  {
+    return std::make_pair(changes.data(), changes.data() + changes.size());
+  }
+
+  static Index indexOf(const SectionChange &c) { return c.section; }
+  static Index indexOf(const ItemChange &c) { return c.item; }
+
+  static bool precedes(const SectionChange &a, const SectionChange &b) { return a.section < b.section; }
+  static bool precedes(const ItemChange &a, const ItemChange &b)
+  {
+    return a.section < b.section || (a.section == b.section && a.item < b.item);
+  }
+  static bool sameIndex(const SectionChange &a, const SectionChange &b) { return a.section == b.section; }
+  static bool sameIndex(const ItemChange &a, const ItemChange &b) { return a.section == b.section && a.item == b.item; }
+
+  template <typename Change>
+  static void normalizeChanges(std::vector<Change> &changes)
+  {
+    std::stable_sort(changes.begin(), changes.end(), [](const Change &a, const Change &b) { return precedes(a, b); });
+    // Keep the last of each run of equal indexes.
+    std::size_t count = 0;
+    for (std::size_t i = 0; i < changes.size(); i++) {
+      if (i + 1 < changes.size() && sameIndex(changes[i], changes[i + 1])) {
+        continue;
+      }
+      changes[count++] = changes[i];
+    }
+    changes.resize(count);
+  }
+};
+
+} // namespace AS
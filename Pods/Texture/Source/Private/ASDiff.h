@@ -0,0 +1,190 @@
+//
+//  ASDiff.h
+//  Texture
+//
+//  Copyright (c) Pinterest, Inc.  All rights reserved.
+//  Licensed under Apache 2.0: http://www.apache.org/licenses/LICENSE-2.0
+//
+
+#pragma once
+
+/**
+ Sequence diffing core behind NSArray+Diffing. Plain C++; elements are only seen through an `equal(i, j)` predicate
+ or as integer symbols, so it can be driven (and fuzzed) without Foundation.
+
+ - longestCommonSubsequence() is Myers' O((N+M)D) algorithm with the linear-space middle snake refinement,
+   where D is the size of the edit script. Common prefixes and suffixes are stripped at every level.
+ - matchSymbols() is a Heckel-style O(N+M) pairing of equal symbols, used for move detection.
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+namespace AS {
+namespace Diff {
+
+static const std::size_t kNotFound = (std::size_t)-1;
+
+namespace Detail {
+
+template <typename Equal, typename Common>
+class Myers {
+public:
+  Myers(std::size_t n, std::size_t m, Equal &equal, Common &common)
+  : _equal(equal), _common(common), _forward(2 * (n + m) + 3), _backward(2 * (n + m) + 3) {}
+
+  void compare(std::size_t a0, std::size_t a1, std::size_t b0, std::size_t b1)
+  {
+    // Strip the common prefix.
+    while (a0 < a1 && b0 < b1 && _equal(a0, b0)) {
+      _common(a0++, b0++);
+    }
+    // Strip the common suffix. Its pairs are reported after the middle, to keep them in increasing order.
+    std::size_t suffix = 0;
+    while (a0 < a1 && b0 < b1 && _equal(a1 - 1, b1 - 1)) {
+      a1--;
+      b1--;
+      suffix++;
+    }
+
+    if (a0 < a1 && b0 < b1) {
+      std::ptrdiff_t x, y, u, v;
+      middleSnake(a0, a1 - a0, b0, b1 - b0, x, y, u, v);
+      compare(a0, a0 + x, b0, b0 + y);
+      for (std::ptrdiff_t i = x; i < u; i++) {
+        _common(a0 + i, b0 + (i - x + y));
+      }
+      compare(a0 + u, a1, b0 + v, b1);
+    }
+
+    for (std::size_t i = 0; i < suffix; i++) {
+      _common(a1 + i, b1 + i);
+    }
+  }
+
+private:
+  /**
+   Finds the middle snake of the edit graph between a[a0, a0 + n) and b[b0, b0 + m), i.e. the diagonal run where the
+   furthest reaching forward and backward D/2-paths overlap. Returns its start (x, y) and end (u, v), relative to a0/b0.
+   */
+  void middleSnake(std::size_t a0, std::ptrdiff_t n, std::size_t b0, std::ptrdiff_t m,
+                   std::ptrdiff_t &x, std::ptrdiff_t &y, std::ptrdiff_t &u, std::ptrdiff_t &v)
+  {
+    const std::ptrdiff_t delta = n - m;
+    const bool odd = (delta & 1) != 0;
+    const std::ptrdiff_t maxD = (n + m + 1) / 2;
+    // Diagonal k is stored at k + offset. Backward paths run on the reversed sequences, where diagonal k corresponds
+    // to the forward diagonal delta - k.
+    const std::ptrdiff_t offset = maxD + 1;
+    std::ptrdiff_t *vf = _forward.data();
+    std::ptrdiff_t *vb = _backward.data();
+    vf[offset + 1] = 0;
+    vb[offset + 1] = 0;
+
+    for (std::ptrdiff_t d = 0; d <= maxD; d++) {
+      for (std::ptrdiff_t k = -d; k <= d; k += 2) {
+        std::ptrdiff_t px = (k == -d || (k != d && vf[offset + k - 1] < vf[offset + k + 1])) ? vf[offset + k + 1] : vf[offset + k - 1] + 1;
+        std::ptrdiff_t py = px - k;
+        const std::ptrdiff_t sx = px, sy = py;
+        while (px < n && py < m && _equal(a0 + px, b0 + py)) {
+          px++;
+          py++;
+        }
+        vf[offset + k] = px;
+        const std::ptrdiff_t rk = delta - k;
+        if (odd && rk >= -(d - 1) && rk <= d - 1 && px + vb[offset + rk] >= n) {
+          x = sx; y = sy; u = px; v = py;
+          return;
+        }
+      }
+
+      for (std::ptrdiff_t k = -d; k <= d; k += 2) {
+        std::ptrdiff_t px = (k == -d || (k != d && vb[offset + k - 1] < vb[offset + k + 1])) ? vb[offset + k + 1] : vb[offset + k - 1] + 1;
+        std::ptrdiff_t py = px - k;
+        const std::ptrdiff_t sx = px, sy = py;
+        while (px < n && py < m && _equal(a0 + n - px - 1, b0 + m - py - 1)) {
+          px++;
+          py++;
+        }
+        vb[offset + k] = px;
+        const std::ptrdiff_t fk = delta - k;
+        if (!odd && fk >= -d && fk <= d && px + vf[offset + fk] >= n) {
+          x = n - px; y = m - py; u = n - sx; v = m - sy;
+          return;
+        }
+      }
+    }
+
+    // Unreachable for non-empty inputs: the paths always meet by D/2. Fall back to "no common elements".
+    x = y = 0;
+    u = v = 0;
+  }
+
+  Equal &_equal;
+  Common &_common;
+  std::vector<std::ptrdiff_t> _forward;
+  std::vector<std::ptrdiff_t> _backward;
+};
+
+} // namespace Detail
+
+/**
+ Computes a longest common subsequence of two sequences of length n and m.
+
+ @param equal `bool equal(std::size_t i, std::size_t j)` compares old element i with new element j.
+ @param common `void common(std::size_t i, std::size_t j)` is called for every pair of the subsequence,
+               in increasing order of i (and j).
+ */
+template <typename Equal, typename Common>
+void longestCommonSubsequence(std::size_t n, std::size_t m, Equal &&equal, Common &&common)
+{
+  if (n == 0 || m == 0) {
+    return;
+  }
+  Detail::Myers<typename std::remove_reference<Equal>::type, typename std::remove_reference<Common>::type> myers(n, m, equal, common);
+  myers.compare(0, n, 0, m);
+}
+
+/**
+ Pairs equal symbols of two sequences: the k-th occurrence of a symbol in `newSymbols` is paired with its k-th
+ occurrence in `oldSymbols`, as long as there is one.
+
+ Symbols must be dense, i.e. in [0, symbolCount).
+
+ @return for every new position, the paired old position or kNotFound.
+ */
+inline std::vector<std::size_t> matchSymbols(const std::vector<uint32_t> &oldSymbols,
+                                             const std::vector<uint32_t> &newSymbols,
+                                             const std::size_t symbolCount)
+{
+  // Bucket the old positions by symbol, keeping them in increasing order (a counting sort).
+  std::vector<std::size_t> bucketStart(symbolCount + 1, 0);
+  for (uint32_t symbol : oldSymbols) {
+    bucketStart[symbol + 1]++;
+  }
+  for (std::size_t s = 0; s < symbolCount; s++) {
+    bucketStart[s + 1] += bucketStart[s];
+  }
+  std::vector<std::size_t> cursor(bucketStart.begin(), bucketStart.end() - 1);
+  std::vector<std::size_t> positions(oldSymbols.size());
+  for (std::size_t i = 0; i < oldSymbols.size(); i++) {
+    positions[cursor[oldSymbols[i]]++] = i;
+  }
+
+  // Hand out the old positions of each symbol in order.
+  std::copy(bucketStart.begin(), bucketStart.end() - 1, cursor.begin());
+  std::vector<std::size_t> oldForNew(newSymbols.size(), kNotFound);
+  for (std::size_t j = 0; j < newSymbols.size(); j++) {
+    const uint32_t symbol = newSymbols[j];
+    if (symbol < symbolCount && cursor[symbol] < bucketStart[symbol + 1]) {
+      oldForNew[j] = positions[cursor[symbol]++];
+    }
+  }
+  return oldForNew;
+}
+
+} // namespace Diff
+} // namespace AS
@@ -8,11 +8,16 @@
 
 #import <AsyncDisplayKit/ASDispatch.h>
 #import <AsyncDisplayKit/ASConfigurationInternal.h>
+#import <AsyncDisplayKit/ASWorkStealing.h>
 
+#import <memory>
 
 // Prefer C atomics in this file because ObjC blocks can't capture C++ atomics well.
 #import <stdatomic.h>
 
+// Iterations are scheduled with AS::WorkStealingRange: every dispatched block is a worker with its own slice of the
+// index space, instead of all of them incrementing one shared counter per iteration.
+
 /**
  * Like dispatch_apply, but you can set the thread count. 0 means 2*active CPUs.
  *
@@ -28,6 +33,19 @@ void ASDispatchApply(size_t iterationCount, dispatch_queue_t queue, NSUInteger t
     threadCount = NSProcessInfo.processInfo.activeProcessorCount * 2;
   }
   dispatch_group_t group = dispatch_group_create();
+  if (iterationCount <= AS::WorkStealingRange::kMaxCount) {
+    // Don't start more workers than there are iterations.
+    const unsigned workerCount = (unsigned)MIN(threadCount, (NSUInteger)MAX(iterationCount, (size_t)1));
+    AS::WorkStealingRange range(iterationCount, workerCount);
+    AS::WorkStealingRange *rangePtr = &range;
+    for (unsigned t = 0; t < workerCount; t++) {
+      dispatch_group_async(group, queue, ^{
+        rangePtr->run(t, work);
+      });
+    }
+    dispatch_group_wait(group, DISPATCH_TIME_FOREVER);
+    return;
+  }
   __block atomic_size_t counter = ATOMIC_VAR_INIT(0);
   for (NSUInteger t = 0; t < threadCount; t++) {
     dispatch_group_async(group, queue, ^{
@@ -50,6 +68,17 @@ void ASDispatchAsync(size_t iterationCount, dispatch_queue_t queue, NSUInteger t
   if (threadCount == 0) {
     threadCount = NSProcessInfo.processInfo.activeProcessorCount * 2;
   }
+  if (iterationCount <= AS::WorkStealingRange::kMaxCount) {
+    const unsigned workerCount = (unsigned)MIN(threadCount, (NSUInteger)MAX(iterationCount, (size_t)1));
+    // The workers outlive this call, so they share ownership of the range.
+    const auto range = std::make_shared<AS::WorkStealingRange>(iterationCount, workerCount);
+    for (unsigned t = 0; t < workerCount; t++) {
+      dispatch_async(queue, ^{
+        range->run(t, work);
+      });
+    }
+    return;
+  }
   __block atomic_size_t counter = ATOMIC_VAR_INIT(0);
   for (NSUInteger t = 0; t < threadCount; t++) {
     dispatch_async(queue, ^{
@@ -60,4 +89,3 @@ void ASDispatchAsync(size_t iterationCount, dispatch_queue_t queue, NSUInteger t
     });
   }
 };
-
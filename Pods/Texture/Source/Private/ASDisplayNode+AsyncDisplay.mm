@@ -413,6 +413,9 @@ using AS::MutexLocker;
   // This block is called back on the main thread after rendering at the completion of the current async transaction, or immediately if !asynchronously
   asyncdisplaykit_async_transaction_operation_completion_block_t completionBlock = ^(id<NSObject> value, BOOL canceled){
     ASDisplayNodeCAssertMainThread();
+    if (!isCancelledBlock()) {
+      self->_displayOperationHandle = nil;
+    }
     if (!canceled && !isCancelledBlock()) {
       UIImage *image = (UIImage *)value;
       BOOL stretchable = (NO == UIEdgeInsetsEqualToEdgeInsets(image.capInsets, UIEdgeInsetsZero));
@@ -455,7 +458,14 @@ using AS::MutexLocker;
     
     // Adding this displayBlock operation to the transaction will start it IMMEDIATELY.
     // The only function of the transaction commit is to gate the calling of the completionBlock.
-    [transaction addOperationWithBlock:displayBlock priority:self.drawingPriority queue:[_ASDisplayLayer displayQueue] completion:completionBlock];
+    // Visible nodes go ahead of the ones that are only in the display range.
+    NSInteger priority = self.drawingPriority;
+    if (ASInterfaceStateIncludesVisible(self.interfaceState)) {
+      priority = ASVisibleDrawingPriority;
+    }
+    // The previous operation, if it didn't start yet, is stale since the sentinel moved on: drop it from the queue.
+    [_displayOperationHandle cancel];
+    _displayOperationHandle = [transaction addOperationWithBlock:displayBlock priority:priority queue:[_ASDisplayLayer displayQueue] completion:completionBlock];
   } else {
     UIImage *contents = (UIImage *)displayBlock();
     completionBlock(contents, NO);
@@ -465,6 +475,16 @@ using AS::MutexLocker;
 - (void)cancelDisplayAsyncLayer:(_ASDisplayLayer *)asyncLayer
 {
   _displaySentinel.fetch_add(1);
+  if (ASDisplayNodeThreadIsMain()) {
+    [_displayOperationHandle cancel];
+    _displayOperationHandle = nil;
+  }
+}
+
+- (void)_setDisplayOperationVisible:(BOOL)visible
+{
+  ASDisplayNodeAssertMainThread();
+  [_displayOperationHandle setPriority:(visible ? ASVisibleDrawingPriority : self.drawingPriority)];
 }
 
 - (ASDisplayNodeContextModifier)willDisplayNodeContentWithRenderingContext
@@ -279,8 +279,42 @@ __unused static NSString * _Nonnull NSStringFromASHierarchyStateChange(ASHierarc
  */
 - (void)_layoutSublayouts;
 
+/**
+ * Whether the calculated or pending layout can be reused for the given constrained size, i.e. -layoutThatFits:
+ * would return it without calculating.
+ */
+- (BOOL)_hasValidLayoutForConstrainedSize:(ASSizeRange)constrainedSize;
+
+/**
+ * Invalidates the layout of every node in the subtree whose last layout calculation read the trait collection,
+ * along with their supernodes up to and including the receiver. Other layouts stay cached.
+ * Must be called on the main thread.
+ *
+ * @return YES if any layout was invalidated.
+ */
+- (BOOL)_invalidateLayoutsThatReadTraitCollection;
+
 @end
 
+/**
+ * Records that the node whose layout is being calculated on this thread, if any, read its trait collection.
+ * Called by the primitiveTraitCollection getters.
+ */
+ASDK_EXTERN void ASDisplayNodeNoteTraitCollectionRead(void);
+
+/**
+ * The node whose layout is being calculated on this thread, if any. Work that measures on other threads on its
+ * behalf carries it over with ASDisplayNodeSetLayoutCalculatingNode(), so their reads are attributed to it too.
+ */
+ASDK_EXTERN ASDisplayNode * _Nullable ASDisplayNodeGetLayoutCalculatingNode(void);
+
+/**
+ * Sets the node whose layout is being calculated on this thread.
+ *
+ * @return The previous node, to restore once the work is done.
+ */
+ASDK_EXTERN ASDisplayNode * _Nullable ASDisplayNodeSetLayoutCalculatingNode(ASDisplayNode * _Nullable node);
+
 @interface ASDisplayNode (ASLayoutTransitionInternal)
 
 /**
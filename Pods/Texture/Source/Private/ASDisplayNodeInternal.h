@@ -27,6 +27,7 @@ NS_ASSUME_NONNULL_BEGIN
 @protocol _ASDisplayLayerDelegate;
 @class _ASDisplayLayer;
 @class _ASPendingState;
+@class _ASAsyncTransactionOperationHandle;
 @class ASNodeController;
 struct ASDisplayNodeFlags;
 
@@ -52,6 +53,8 @@ typedef NS_OPTIONS(uint_least32_t, ASDisplayNodeAtomicFlags)
 {
   Synchronous = 1 << 0,
   YogaLayoutInProgress = 1 << 1,
+  /** The primitive trait collection was read while this node's layout was last calculated. */
+  LayoutReadTraitCollection = 1 << 2,
 };
 
 // Can be called without the node's lock. Client is responsible for thread safety.
@@ -74,6 +77,10 @@ static constexpr CACornerMask kASCACornerAllCorners =
 
 #define NUM_CLIP_CORNER_LAYERS 4
 
+// Drawing priority of the display operations of visible nodes, so they run before those of nodes that are only in the
+// display range.
+static const NSInteger ASVisibleDrawingPriority = NSIntegerMax;
+
 @interface ASDisplayNode () <_ASTransitionContextCompletionDelegate, CALayerDelegate>
 {
 @package
@@ -164,6 +171,8 @@ static constexpr CACornerMask kASCACornerAllCorners =
   NSArray<ASDisplayNode *> *_cachedSubnodes;
 
   std::atomic_uint _displaySentinel;
+  // The async display operation that hasn't completed yet, if any. Main thread only.
+  _ASAsyncTransactionOperationHandle *_displayOperationHandle;
 
   // This is the desired contentsScale, not the scale at which the layer's contents should be displayed
   CGFloat _contentsScaleForDisplay;
@@ -327,6 +336,9 @@ static constexpr CACornerMask kASCACornerAllCorners =
 /// Display the node's view/layer immediately on the current thread, bypassing the background thread rendering. Will be deprecated.
 - (void)displayImmediately;
 
+/// Moves the pending display operation, if any, ahead of the others when visible, or back to drawingPriority.
+- (void)_setDisplayOperationVisible:(BOOL)visible;
+
 /// Refreshes any precomposited or drawn clip corners, setting up state as required to transition corner config.
 - (void)updateCornerRoundingWithType:(ASCornerRoundingType)newRoundingType
                         cornerRadius:(CGFloat)newCornerRadius
@@ -0,0 +1,251 @@
+//
+//  ASElementMapStorage.h
+//  Texture
+//
+//  Copyright (c) Pinterest, Inc.  All rights reserved.
+//  Licensed under Apache 2.0: http://www.apache.org/licenses/LICENSE-2.0
+//
+
+#pragma once
+
+/**
+ Item storage shared by ASElementMap and ASMutableElementMap.
+
+ Each section's items are one contiguous vector, and the flat index of each section's first item is kept as a prefix
+ sum over the section sizes, so item and flat index lookups are an array access (a binary search over the sections
+ for flat index -> index path). Sections are reference counted and copy-on-write: copying a storage copies one
+ pointer per section, and editing a section that a snapshot still shares copies just that section. A data update
+ that touches a few sections thus leaves the others shared between the old and the new map.
+
+ The element -> flat index table (ElementIndex) is open-addressing over element pointers. Only immutable maps build
+ it, on their first lookup, since most intermediate maps are never queried.
+ */
+
+#import <Foundation/Foundation.h>
+#import <AsyncDisplayKit/ASAssert.h>
+#import <AsyncDisplayKit/ASElementMap.h>
+#import <AsyncDisplayKit/ASMutableElementMap.h>
+
+#import <algorithm>
+#import <cstdint>
+#import <memory>
+#import <vector>
+
+namespace AS {
+
+class ElementMapStorage {
+public:
+  /** The items of a section. Strong references, under ARC. */
+  typedef std::vector<ASCollectionElement *> Section;
+
+  ElementMapStorage() : _offsets(1, 0) {}
+
+  explicit ElementMapStorage(ASCollectionElementTwoDimensionalArray *sectionsOfItems)
+  {
+    _sections.reserve(sectionsOfItems.count);
+    for (NSArray<ASCollectionElement *> *items in sectionsOfItems) {
+      auto section = std::make_shared<Section>();
+      section->reserve(items.count);
+      for (ASCollectionElement *element in items) {
+        section->push_back(element);
+      }
+      _sections.push_back(std::move(section));
+    }
+    updateOffsets();
+  }
+
+#pragma mark Queries
+
+  // Queries need up-to-date offsets: call updateOffsets() after editing.
+
+  NSInteger sectionCount() const { return (NSInteger)_sections.size(); }
+
+  NSInteger itemCount() const
+  {
+    ASDisplayNodeCAssert(!_offsets.empty(), @"Element map storage queried while being edited.");
+    return _offsets.back();
+  }
+
+  NSInteger itemCountInSection(NSInteger section) const { return (NSInteger)_sections[section]->size(); }
+
+  ASCollectionElement *element(NSInteger section, NSInteger item) const { return (*_sections[section])[item]; }
+
+  /** The flat index of the first item of a section. */
+  NSInteger sectionOffset(NSInteger section) const
+  {
+    ASDisplayNodeCAssert(!_offsets.empty(), @"Element map storage queried while being edited.");
+    return _offsets[section];
+  }
+
+  /** The section holding the item at a flat index. O(log sections) */
+  NSInteger sectionOfFlatIndex(NSInteger flatIndex) const
+  {
+    ASDisplayNodeCAssert(!_offsets.empty(), @"Element map storage queried while being edited.");
+    // The last section starting at or before the index; empty sections share the offset of the next one.
+    return (std::upper_bound(_offsets.begin(), _offsets.end(), flatIndex) - _offsets.begin()) - 1;
+  }
+
+  ASCollectionElement *elementAtFlatIndex(NSInteger flatIndex) const
+  {
+    const NSInteger section = sectionOfFlatIndex(flatIndex);
+    return element(section, flatIndex - _offsets[section]);
+  }
+
+  /** Calls `void body(ASCollectionElement *element, NSInteger section, NSInteger item)` for every item, in order. */
+  template <typename Body>
+  void forEachItem(Body &&body) const
+  {
+    for (NSInteger s = 0; s < (NSInteger)_sections.size(); s++) {
+      const Section &section = *_sections[s];
+      for (NSInteger i = 0; i < (NSInteger)section.size(); i++) {
+        body(section[i], s, i);
+      }
+    }
+  }
+
+#pragma mark Editing
+
+  void removeAll()
+  {
+    _sections.clear();
+    _offsets.clear();
+  }
+
+  void insertSection(NSInteger index)
+  {
+    _sections.insert(_sections.begin() + index, std::make_shared<Section>());
+    _offsets.clear();
+  }
+
+  void removeSection(NSInteger index)
+  {
+    _sections.erase(_sections.begin() + index);
+    _offsets.clear();
+  }
+
+  void insertItem(ASCollectionElement *element, NSInteger section, NSInteger item)
+  {
+    Section &items = mutableSection(section);
+    items.insert(items.begin() + item, element);
+    _offsets.clear();
+  }
+
+  void removeItem(NSInteger section, NSInteger item)
+  {
+    Section &items = mutableSection(section);
+    items.erase(items.begin() + item);
+    _offsets.clear();
+  }
+
+  /** Recomputes the section offsets. O(sections) */
+  void updateOffsets()
+  {
+    _offsets.resize(_sections.size() + 1);
+    _offsets[0] = 0;
+    for (size_t s = 0; s < _sections.size(); s++) {
+      _offsets[s + 1] = _offsets[s] + (NSInteger)_sections[s]->size();
+    }
+  }
+
+private:
+  /** The section, copied first if another storage shares it. */
+  Section &mutableSection(NSInteger index)
+  {
+    std::shared_ptr<Section> &section = _sections[index];
+    // Only this storage can add references to a section it owns alone, so a count of 1 can't go stale.
+    if (section.use_count() > 1) {
+      section = std::make_shared<Section>(*section);
+    }
+    return *section;
+  }
+
+  std::vector<std::shared_ptr<Section>> _sections;
+  /** Flat index of the first item of each section, then the item count. Empty while being edited. */
+  std::vector<NSInteger> _offsets;
+};
+
+/**
+ Element -> flat index table. Linear probing over a power-of-two table at most half full, keyed by pointer identity,
+ like the NSMapTable it replaces. The elements aren't retained: the storage it was built from keeps them alive.
+ */
+class ElementIndex {
+public:
+  void build(const ElementMapStorage &storage)
+  {
+    const NSInteger count = storage.itemCount();
+    size_t capacity = 16;
+    while (capacity < (size_t)count * 2) {
+      capacity *= 2;
+    }
+    _mask = capacity - 1;
+    _slots.assign(capacity, Slot{nullptr, 0});
+    NSInteger flatIndex = 0;
+    storage.forEachItem([&](ASCollectionElement *element, NSInteger section, NSInteger item) {
+      const void *key = (__bridge const void *)element;
+      size_t i = hash(key) & _mask;
+      while (_slots[i].key != nullptr) {
+        i = (i + 1) & _mask;
+      }
+      _slots[i] = Slot{key, flatIndex++};
+    });
+  }
+
+  /** The flat index of the element, or NSNotFound. */
+  NSInteger find(ASCollectionElement *element) const
+  {
+    if (_slots.empty() || element == nil) {
+      return NSNotFound;
+    }
+    const void *key = (__bridge const void *)element;
+    for (size_t i = hash(key) & _mask;; i = (i + 1) & _mask) {
+      if (_slots[i].key == key) {
+        return _slots[i].flatIndex;
+      } else if (_slots[i].key == nullptr) {
+        return NSNotFound;
+      }
+    }
+  }
+
+private:
+  struct Slot {
+    const void *key;
+    NSInteger flatIndex;
+  };
+
+  static size_t hash(const void *pointer)
+  {
+    // The low bits of heap pointers are all alike: mix them all in.
+    uint64_t x = (uintptr_t)pointer;
+    x ^= x >> 33;
+    x *= 0xff51afd7ed558ccdULL;
+    x ^= x >> 33;
+    return (size_t)x;
+  }
+
+  std::vector<Slot> _slots;
+  size_t _mask = 0;
+};
+
+} // namespace AS
+
+NS_ASSUME_NONNULL_BEGIN
+
+@interface ASElementMap (Storage)
+
+/** Shares the item sections of `storage`. O(sections) */
+- (instancetype)initWithSections:(NSArray<ASSection *> *)sections
+                         storage:(const AS::ElementMapStorage &)storage
+           supplementaryElements:(ASSupplementaryElementDictionary *)supplementaryElements;
+
+@end
+
+@interface ASMutableElementMap (Storage)
+
+/** Shares the item sections of `storage` until they are edited. O(sections) */
+- (instancetype)initWithSections:(NSArray<ASSection *> *)sections
+                         storage:(const AS::ElementMapStorage &)storage
+           supplementaryElements:(ASSupplementaryElementDictionary *)supplementaryElements;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,96 @@
+//
+//  ASIndexBitset.h
+//  Texture
+//
+//  Copyright (c) Pinterest, Inc.  All rights reserved.
+//  Licensed under Apache 2.0: http://www.apache.org/licenses/LICENSE-2.0
+//
+
+#pragma once
+
+/**
+ A set of indexes in [0, size), one bit each. Plain C++, like ASWorkStealing.h.
+
+ Meant to be kept around and reset for every use: resetting only reallocates when the size outgrows the capacity.
+ Set algebra is done a 64-bit word at a time by forEachIndex(), which combines the words of several sets with a
+ caller-provided expression, so e.g. "in display but not visible" costs one AND-NOT per 64 indexes.
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace AS {
+
+class IndexBitset {
+public:
+  typedef uint64_t Word;
+  static const std::size_t kBitsPerWord = 64;
+
+  /** Empties the set and sets its size. */
+  void reset(std::size_t size)
+  {
+    _size = size;
+    _words.assign(wordCountForSize(size), 0);
+  }
+
+  std::size_t size() const { return _size; }
+  std::size_t wordCount() const { return _words.size(); }
+
+  /** The word at `w`, or 0 beyond the end, so sets of different sizes can be combined. */
+  Word word(std::size_t w) const { return w < _words.size() ? _words[w] : 0; }
+
+  void set(std::size_t index) { _words[index / kBitsPerWord] |= Word(1) << (index % kBitsPerWord); }
+
+  bool test(std::size_t index) const
+  {
+    return index < _size && (_words[index / kBitsPerWord] & (Word(1) << (index % kBitsPerWord))) != 0;
+  }
+
+  /** The number of indexes in the set. */
+  std::size_t count() const
+  {
+    std::size_t count = 0;
+    for (Word word : _words) {
+      count += __builtin_popcountll(word);
+    }
+    return count;
+  }
+
+  /** Replaces the contents with the union of the given sets, which must all have the size of this one. */
+  void assignUnion(const IndexBitset &a, const IndexBitset &b, const IndexBitset &c)
+  {
+    for (std::size_t w = 0; w < _words.size(); w++) {
+      _words[w] = a.word(w) | b.word(w) | c.word(w);
+    }
+  }
+
+  /**
+   Calls `void body(std::size_t index)`, in ascending order, for every index below `size` whose bit is set in
+   `Word word(std::size_t w)`.
+   */
+  template <typename WordFunction, typename Body>
+  static void forEachIndex(std::size_t size, WordFunction &&word, Body &&body)
+  {
+    const std::size_t wordCount = wordCountForSize(size);
+    for (std::size_t w = 0; w < wordCount; w++) {
+      Word bits = word(w);
+      if (w == wordCount - 1 && size % kBitsPerWord != 0) {
+        bits &= (Word(1) << (size % kBitsPerWord)) - 1;
+      }
+      while (bits != 0) {
+        body(w * kBitsPerWord + __builtin_ctzll(bits));
+        bits &= bits - 1;
+      }
+    }
+  }
+
+private:
+  static std::size_t wordCountForSize(std::size_t size) { return (size + kBitsPerWord - 1) / kBitsPerWord; }
+
+  std::size_t _size = 0;
+  std::vector<Word> _words;
+};
+
+} // namespace AS
@@ -11,23 +11,28 @@
 
 #import <AsyncDisplayKit/ASCollectionElement.h>
 #import <AsyncDisplayKit/ASElementMap.h>
-#import <AsyncDisplayKit/ASTwoDimensionalArrayUtils.h>
-
-typedef NSMutableArray<NSMutableArray<ASCollectionElement *> *> ASMutableCollectionElementTwoDimensionalArray;
+#import <AsyncDisplayKit/ASElementMapStorage.h>
+#import <AsyncDisplayKit/ASInternalHelpers.h>
 
 typedef NSMutableDictionary<NSString *, NSMutableDictionary<NSIndexPath *, ASCollectionElement *> *> ASMutableSupplementaryElementDictionary;
 
 @implementation ASMutableElementMap {
   ASMutableSupplementaryElementDictionary *_supplementaryElements;
   NSMutableArray<ASSection *> *_sections;
-  ASMutableCollectionElementTwoDimensionalArray *_sectionsOfItems;
+  // Sections of items are shared with the map this one was copied from until edited.
+  AS::ElementMapStorage _storage;
 }
 
 - (instancetype)initWithSections:(NSArray<ASSection *> *)sections items:(ASCollectionElementTwoDimensionalArray *)items supplementaryElements:(ASSupplementaryElementDictionary *)supplementaryElements
+{
+  return [self initWithSections:sections storage:AS::ElementMapStorage(items) supplementaryElements:supplementaryElements];
+}
+
+- (instancetype)initWithSections:(NSArray<ASSection *> *)sections storage:(const AS::ElementMapStorage &)storage supplementaryElements:(ASSupplementaryElementDictionary *)supplementaryElements
 {
   if (self = [super init]) {
     _sections = [sections mutableCopy];
-    _sectionsOfItems = (ASMutableCollectionElementTwoDimensionalArray *)ASTwoDimensionalArrayDeepMutableCopy(items);
+    _storage = storage;
     _supplementaryElements = [ASMutableElementMap deepMutableCopyOfElementsDictionary:supplementaryElements];
   }
   return self;
@@ -35,7 +40,7 @@ typedef NSMutableDictionary<NSString *, NSMutableDictionary<NSIndexPath *, ASCol
 
 - (id)copyWithZone:(NSZone *)zone
 {
-  return [[ASElementMap alloc] initWithSections:_sections items:_sectionsOfItems supplementaryElements:_supplementaryElements];
+  return [[ASElementMap alloc] initWithSections:_sections storage:_storage supplementaryElements:_supplementaryElements];
 }
 
 - (void)removeAllSections
@@ -50,7 +55,24 @@ typedef NSMutableDictionary<NSString *, NSMutableDictionary<NSIndexPath *, ASCol
 
 - (void)removeItemsAtIndexPaths:(NSArray<NSIndexPath *> *)indexPaths
 {
-  ASDeleteElementsInTwoDimensionalArrayAtIndexPaths(_sectionsOfItems, indexPaths);
+#if ASDISPLAYNODE_ASSERTIONS_ENABLED
+  NSArray *sortedIndexPaths = [indexPaths sortedArrayUsingSelector:@selector(asdk_inverseCompare:)];
+  ASDisplayNodeAssert([sortedIndexPaths isEqualToArray:indexPaths], @"Expected array of index paths to be sorted in descending order.");
+#endif
+
+  for (NSIndexPath *indexPath in indexPaths) {
+    NSInteger section = indexPath.section;
+    if (section >= _storage.sectionCount()) {
+      ASDisplayNodeFailAssert(@"Invalid section index %ld – only %ld sections", (long)section, (long)_storage.sectionCount());
+      continue;
+    }
+    NSInteger item = indexPath.item;
+    if (item >= _storage.itemCountInSection(section)) {
+      ASDisplayNodeFailAssert(@"Invalid item index %ld – only %ld items in section %ld", (long)item, (long)_storage.itemCountInSection(section), (long)section);
+      continue;
+    }
+    _storage.removeItem(section, item);
+  }
 }
 
 - (void)removeSectionsAtIndexes:(NSIndexSet *)indexes
@@ -65,19 +87,21 @@ typedef NSMutableDictionary<NSString *, NSMutableDictionary<NSIndexPath *, ASCol
 
 - (void)removeAllElements
 {
-  [_sectionsOfItems removeAllObjects];
+  _storage.removeAll();
   [_supplementaryElements removeAllObjects];
 }
 
 - (void)removeSectionsOfItems:(NSIndexSet *)itemSections
 {
-  [_sectionsOfItems removeObjectsAtIndexes:itemSections];
+  [itemSections enumerateIndexesWithOptions:NSEnumerationReverse usingBlock:^(NSUInteger idx, BOOL * _Nonnull stop) {
+    _storage.removeSection(idx);
+  }];
 }
 
 - (void)insertEmptySectionsOfItemsAtIndexes:(NSIndexSet *)sections
 {
   [sections enumerateIndexesUsingBlock:^(NSUInteger idx, BOOL * _Nonnull stop) {
-    [_sectionsOfItems insertObject:[[NSMutableArray alloc] init]  atIndex:idx];
+    _storage.insertSection(idx);
   }];
 }
 
@@ -85,7 +109,7 @@ typedef NSMutableDictionary<NSString *, NSMutableDictionary<NSIndexPath *, ASCol
 {
   NSString *kind = element.supplementaryElementKind;
   if (kind == nil) {
-    [_sectionsOfItems[indexPath.section] insertObject:element atIndex:indexPath.item];
+    _storage.insertItem(element, indexPath.section, indexPath.item);
   } else {
     NSMutableDictionary *supplementariesForKind = _supplementaryElements[kind];
     if (supplementariesForKind == nil) {
@@ -0,0 +1,138 @@
+//
+//  ASWorkStealing.h
+//  Texture
+//
+//  Copyright (c) Pinterest, Inc.  All rights reserved.
+//  Licensed under Apache 2.0: http://www.apache.org/licenses/LICENSE-2.0
+//
+
+#pragma once
+
+/**
+ Work-stealing scheduling of a parallel loop over [0, count). Plain C++, like ASStackLayoutEngine.h; the threads are
+ provided by the caller (ASDispatch.mm runs one worker per dispatched block on the caller's queue, so the workers
+ inherit its QoS).
+
+ The index space is split into one contiguous slice per worker. A worker takes chunks off the front of its own slice;
+ the chunk size shrinks with what is left of the slice (guided scheduling), so cheap iterations cost few atomic
+ operations while the tail stays fine-grained for balancing. A worker whose slice is empty steals the back half of the
+ largest remaining slice, and continues on it as its own.
+
+ Each slice is a single 64-bit word (begin and end, 32 bits each), so taking a chunk and stealing are both one
+ compare-and-swap on the victim's word, and the owner and thieves never touch the same element. Workers that never
+ start (e.g. because the system ran fewer threads than requested) simply have their slices stolen.
+ */
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace AS {
+
+class WorkStealingRange {
+public:
+  /** The largest supported iteration count. */
+  static const std::size_t kMaxCount = UINT32_MAX;
+
+  WorkStealingRange(std::size_t count, unsigned workerCount)
+      : _workerCount(workerCount > 0 ? workerCount : 1), _slots(new Slot[_workerCount])
+  {
+    const uint64_t total = count < kMaxCount ? count : kMaxCount;
+    for (unsigned w = 0; w < _workerCount; w++) {
+      const uint32_t begin = (uint32_t)(total * w / _workerCount);
+      const uint32_t end = (uint32_t)(total * (w + 1) / _workerCount);
+      _slots[w].range.store(pack(begin, end), std::memory_order_relaxed);
+    }
+  }
+
+  unsigned workerCount() const { return _workerCount; }
+
+  /**
+   Runs `void body(std::size_t i)` for indexes from the worker's slice, then from stolen ones, until none are left
+   anywhere. Each index is run exactly once across all workers. Call at most once per worker index.
+   */
+  template <typename Body>
+  void run(unsigned worker, Body &&body)
+  {
+    uint32_t begin, end;
+    do {
+      while (take(worker, begin, end)) {
+        for (uint32_t i = begin; i < end; i++) {
+          body((std::size_t)i);
+        }
+      }
+    } while (steal(worker));
+  }
+
+private:
+  /** Padded so the words of different workers don't share a cache line. */
+  struct Slot {
+    std::atomic<uint64_t> range;
+    char padding[64];
+  };
+
+  static uint64_t pack(uint32_t begin, uint32_t end) { return ((uint64_t)end << 32) | begin; }
+  static uint32_t beginOf(uint64_t range) { return (uint32_t)range; }
+  static uint32_t endOf(uint64_t range) { return (uint32_t)(range >> 32); }
+
+  /** Takes a chunk off the front of the worker's own slice. */
+  bool take(unsigned worker, uint32_t &begin, uint32_t &end)
+  {
+    std::atomic<uint64_t> &slot = _slots[worker].range;
+    uint64_t range = slot.load(std::memory_order_relaxed);
+    for (;;) {
+      const uint32_t b = beginOf(range), e = endOf(range);
+      if (b >= e) {
+        return false;
+      }
+      // Guided: an eighth of the rest, so a slice is consumed in O(log n) takes and the last ones are single indexes.
+      const uint32_t remaining = e - b;
+      const uint32_t chunk = remaining >= 16 ? remaining / 8 : 1;
+      if (slot.compare_exchange_weak(range, pack(b + chunk, e), std::memory_order_relaxed)) {
+        begin = b;
+        end = b + chunk;
+        return true;
+      }
+    }
+  }
+
+  /** Moves the back half of the largest other slice into the worker's (empty) slice. */
+  bool steal(unsigned worker)
+  {
+    for (;;) {
+      unsigned victim = worker;
+      uint32_t largest = 0;
+      for (unsigned n = 1; n < _workerCount; n++) {
+        const unsigned w = (worker + n) % _workerCount;
+        const uint64_t range = _slots[w].range.load(std::memory_order_relaxed);
+        const uint32_t b = beginOf(range), e = endOf(range);
+        if (b < e && e - b > largest) {
+          largest = e - b;
+          victim = w;
+        }
+      }
+      if (victim == worker) {
+        return false;
+      }
+
+      std::atomic<uint64_t> &slot = _slots[victim].range;
+      uint64_t range = slot.load(std::memory_order_relaxed);
+      const uint32_t b = beginOf(range), e = endOf(range);
+      if (b >= e) {
+        continue;
+      }
+      const uint32_t middle = e - (e - b + 1) / 2;
+      if (slot.compare_exchange_strong(range, pack(b, middle), std::memory_order_relaxed)) {
+        // Nobody else writes an empty slice, so a plain store publishes the stolen one.
+        _slots[worker].range.store(pack(middle, e), std::memory_order_relaxed);
+        return true;
+      }
+    }
+  }
+
+  const unsigned _workerCount;
+  const std::unique_ptr<Slot[]> _slots;
+};
+
+} // namespace AS
@@ -0,0 +1,97 @@
+//
+//  ASFlatLayout.h
+//  Texture
+//
+//  Copyright (c) Pinterest, Inc.  All rights reserved.
+//  Licensed under Apache 2.0: http://www.apache.org/licenses/LICENSE-2.0
+//
+
+#pragma once
+
+/**
+ Frame lookup table for the direct sublayouts of a layout. Plain C++, like ASStackLayoutEngine.h.
+
+ Frames are stored as four contiguous Float arrays, in sublayout order, next to opaque element ids. Elements are looked
+ up through an index of the sublayouts sorted by element, instead of by scanning the sublayout objects.
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace AS {
+
+class FlatLayout {
+public:
+  typedef double Float;
+  typedef const void *Element;
+  static const uint32_t kNotFound = UINT32_MAX;
+
+  struct Rect {
+    Float x, y, width, height;
+  };
+
+  /**
+   Appends a sublayout, in sublayout order.
+   @return The index of the sublayout.
+   */
+  uint32_t append(Element element, const Rect &frame)
+  {
+    const uint32_t index = (uint32_t)_element.size();
+    _element.push_back(element);
+    _x.push_back(frame.x);
+    _y.push_back(frame.y);
+    _width.push_back(frame.width);
+    _height.push_back(frame.height);
+    return index;
+  }
+
+  /** Builds the element lookup index. Call once, after the last append. */
+  void finalize()
+  {
+    _byElement.resize(_element.size());
+    for (uint32_t i = 0; i < _byElement.size(); i++) {
+      _byElement[i] = i;
+    }
+    const auto &elements = _element;
+    std::sort(_byElement.begin(), _byElement.end(), [&elements](uint32_t a, uint32_t b) {
+      return std::less<Element>()(elements[a], elements[b]) || (elements[a] == elements[b] && a < b);
+    });
+  }
+
+  void reserve(std::size_t count)
+  {
+    _element.reserve(count);
+    _x.reserve(count);
+    _y.reserve(count);
+    _width.reserve(count);
+    _height.reserve(count);
+  }
+
+  uint32_t count() const { return (uint32_t)_element.size(); }
+  Element element(uint32_t index) const { return _element[index]; }
+  Rect frame(uint32_t index) const { return {_x[index], _y[index], _width[index], _height[index]}; }
+
+  /** The first sublayout of `element`, or kNotFound. O(log n). */
+  uint32_t indexOfElement(Element element) const
+  {
+    const auto &elements = _element;
+    const auto it = std::lower_bound(_byElement.begin(), _byElement.end(), element, [&elements](uint32_t index, Element e) {
+      return std::less<Element>()(elements[index], e);
+    });
+    return (it != _byElement.end() && _element[*it] == element) ? *it : kNotFound;
+  }
+
+private:
+  std::vector<Float> _x;
+  std::vector<Float> _y;
+  std::vector<Float> _width;
+  std::vector<Float> _height;
+  std::vector<Element> _element;
+  /** Sublayout indexes sorted by element, then index. */
+  std::vector<uint32_t> _byElement;
+};
+
+} // namespace AS
@@ -0,0 +1,247 @@
+//
+//  ASLayoutArena.h
+//  Texture
+//
+//  Copyright (c) Pinterest, Inc.  All rights reserved.
+//  Licensed under Apache 2.0: http://www.apache.org/licenses/LICENSE-2.0
+//
+
+#pragma once
+
+/**
+ Per-thread bump allocator for the scratch memory of a layout pass.
+
+ Plain C++, like ASStackLayoutEngine.h. Usage:
+
+ {
+   AS::ArenaScope scope(enabled);   // Outermost scope on this thread activates the thread's arena.
+   AS::ArenaVector<Item> items;     // Allocates from the arena while a scope is active, from the heap otherwise.
+   ...
+ }                                  // Outermost scope rewinds the arena. Arena memory must not escape the scope.
+
+ Deallocation is a no-op for arena memory; the arena is rewound as a whole when the outermost scope ends. After a pass
+ that needed more than one block, the blocks are coalesced into one, so steady-state passes do no malloc at all.
+
+ An ArenaAllocator binds to the arena that is current when it is constructed. A container must only grow on the thread
+ that created it; elements may be mutated from other threads (e.g. during a concurrent stack layout).
+ */
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+namespace AS {
+
+/** Snapshot of process-wide layout allocation counters. */
+struct ArenaStatistics {
+  /** Allocations served from an arena. */
+  uint64_t arenaAllocations;
+  /** Allocations made through an ArenaAllocator while no arena was active, i.e. one malloc each. */
+  uint64_t heapAllocations;
+  /** Blocks malloc'd by arenas. */
+  uint64_t blockAllocations;
+  /** Number of outermost scopes that ended, i.e. layout passes that used an arena. */
+  uint64_t passes;
+};
+
+namespace ArenaDetail {
+  enum Counter { ArenaAllocations, HeapAllocations, BlockAllocations, Passes, CounterCount };
+
+  inline std::atomic<uint64_t> *counters()
+  {
+    static std::atomic<uint64_t> counters[CounterCount];
+    return counters;
+  }
+
+  inline void increment(Counter counter)
+  {
+    counters()[counter].fetch_add(1, std::memory_order_relaxed);
+  }
+}
+
+inline ArenaStatistics ArenaStatisticsGet()
+{
+  const auto c = ArenaDetail::counters();
+  return {
+    c[ArenaDetail::ArenaAllocations].load(std::memory_order_relaxed),
+    c[ArenaDetail::HeapAllocations].load(std::memory_order_relaxed),
+    c[ArenaDetail::BlockAllocations].load(std::memory_order_relaxed),
+    c[ArenaDetail::Passes].load(std::memory_order_relaxed),
+  };
+}
+
+inline void ArenaStatisticsReset()
+{
+  for (int i = 0; i < ArenaDetail::CounterCount; i++) {
+    ArenaDetail::counters()[i].store(0, std::memory_order_relaxed);
+  }
+}
+
+class Arena {
+public:
+  static const std::size_t kDefaultBlockSize = 16 * 1024;
+
+  Arena() : _blocks(nullptr), _cursor(nullptr), _end(nullptr), _used(0) {}
+  ~Arena() { freeBlocks(_blocks); }
+
+  Arena(const Arena &) = delete;
+  Arena &operator=(const Arena &) = delete;
+
+  void *allocate(std::size_t size, std::size_t alignment)
+  {
+    char *p = align(_cursor, alignment);
+    if (_cursor == nullptr || p + size > _end) {
+      addBlock(size + alignment);
+      p = align(_cursor, alignment);
+    }
+    _cursor = p + size;
+    _used += size;
+    ArenaDetail::increment(ArenaDetail::ArenaAllocations);
+    return p;
+  }
+
+  /** Rewinds the arena. If the last pass spilled into more than one block, they are replaced by a single larger one. */
+  void reset()
+  {
+    if (_blocks != nullptr && _blocks->next != nullptr) {
+      std::size_t capacity = kDefaultBlockSize;
+      while (capacity < _used) {
+        capacity *= 2;
+      }
+      freeBlocks(_blocks);
+      _blocks = nullptr;
+      addBlock(capacity);
+    } else if (_blocks != nullptr) {
+      _cursor = _blocks->data();
+    }
+    _used = 0;
+  }
+
+  /** The arena of the layout pass running on this thread, or nullptr if there is none. */
+  static Arena *&current()
+  {
+    static thread_local Arena *current = nullptr;
+    return current;
+  }
+
+  static Arena &threadArena()
+  {
+    static thread_local Arena arena;
+    return arena;
+  }
+
+private:
+  struct Block {
+    Block *next;
+    std::size_t capacity;
+    char *data() { return reinterpret_cast<char *>(this + 1); }
+  };
+
+  static char *align(char *p, std::size_t alignment)
+  {
+    const uintptr_t mask = alignment - 1;
+    return reinterpret_cast<char *>((reinterpret_cast<uintptr_t>(p) + mask) & ~mask);
+  }
+
+  void addBlock(std::size_t minimumCapacity)
+  {
+    std::size_t capacity = kDefaultBlockSize;
+    while (capacity < minimumCapacity) {
+      capacity *= 2;
+    }
+    Block *block = static_cast<Block *>(std::malloc(sizeof(Block) + capacity));
+    if (block == nullptr) {
+      std::abort();
+    }
+    ArenaDetail::increment(ArenaDetail::BlockAllocations);
+    block->next = _blocks;
+    block->capacity = capacity;
+    _blocks = block;
+    _cursor = block->data();
+    _end = _cursor + capacity;
+  }
+
+  static void freeBlocks(Block *block)
+  {
+    while (block != nullptr) {
+      Block *next = block->next;
+      std::free(block);
+      block = next;
+    }
+  }
+
+  Block *_blocks;
+  char *_cursor;
+  char *_end;
+  std::size_t _used;
+};
+
+/**
+ Activates the thread's arena for the duration of the outermost enabled scope on this thread.
+ Nested scopes are no-ops.
+ */
+class ArenaScope {
+public:
+  explicit ArenaScope(bool enabled = true) : _owner(enabled && Arena::current() == nullptr)
+  {
+    if (_owner) {
+      Arena::current() = &Arena::threadArena();
+    }
+  }
+
+  ~ArenaScope()
+  {
+    if (_owner) {
+      Arena::current() = nullptr;
+      Arena::threadArena().reset();
+      ArenaDetail::increment(ArenaDetail::Passes);
+    }
+  }
+
+  ArenaScope(const ArenaScope &) = delete;
+  ArenaScope &operator=(const ArenaScope &) = delete;
+
+private:
+  const bool _owner;
+};
+
+/** STL allocator that allocates from the arena current at construction time, or from the heap if there is none. */
+template <typename T>
+struct ArenaAllocator {
+  typedef T value_type;
+  typedef std::true_type propagate_on_container_move_assignment;
+  typedef std::true_type propagate_on_container_swap;
+
+  ArenaAllocator() : arena(Arena::current()) {}
+  template <typename U> ArenaAllocator(const ArenaAllocator<U> &other) : arena(other.arena) {}
+
+  T *allocate(std::size_t n)
+  {
+    if (arena != nullptr) {
+      return static_cast<T *>(arena->allocate(n * sizeof(T), alignof(T)));
+    }
+    ArenaDetail::increment(ArenaDetail::HeapAllocations);
+    return static_cast<T *>(::operator new(n * sizeof(T)));
+  }
+
+  void deallocate(T *p, std::size_t /*n*/)
+  {
+    if (arena == nullptr) {
+      ::operator delete(p);
+    }
+  }
+
+  template <typename U> bool operator==(const ArenaAllocator<U> &other) const { return arena == other.arena; }
+  template <typename U> bool operator!=(const ArenaAllocator<U> &other) const { return arena != other.arena; }
+
+  Arena *arena;
+};
+
+template <typename T>
+using ArenaVector = std::vector<T, ArenaAllocator<T>>;
+
+} // namespace AS
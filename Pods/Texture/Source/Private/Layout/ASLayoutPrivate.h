@@ -0,0 +1,42 @@
+//
+//  ASLayoutPrivate.h
+//  Texture
+//
+//  Copyright (c) Pinterest, Inc.  All rights reserved.
+//  Licensed under Apache 2.0: http://www.apache.org/licenses/LICENSE-2.0
+//
+
+#pragma once
+
+#import <memory>
+
+#import <AsyncDisplayKit/ASLayout.h>
+#import <AsyncDisplayKit/ASFlatLayout.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/**
+ * Number of sublayouts from which -frameForElement: looks elements up in the flat layout rather than
+ * scanning the sublayouts. Below it, building the flat layout costs more than it saves (see
+ * Tests/Native/ASFlatLayoutBenchmark.cpp).
+ */
+static NSUInteger const ASLayoutFlatLookupThreshold = 64;
+
+/**
+ * The frame lookup table of `layout`'s direct sublayouts, for -frameForElement:. Frames are relative to `layout`,
+ * and element ids are the (unretained) layout elements.
+ *
+ * Built on first use and cached on the layout, so the tree must no longer be mutated (e.g. by assigning sublayout
+ * positions) at that point. Thread safe.
+ */
+std::shared_ptr<const AS::FlatLayout> ASLayoutGetFlatLayout(ASLayout *layout);
+
+/**
+ * Converts a frame of a flat layout back to a CGRect.
+ */
+ASDISPLAYNODE_INLINE CGRect ASFlatLayoutRectToCGRect(const AS::FlatLayout::Rect &rect)
+{
+  return CGRectMake(rect.x, rect.y, rect.width, rect.height);
+}
+
+NS_ASSUME_NONNULL_END
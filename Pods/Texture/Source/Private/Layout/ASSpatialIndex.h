@@ -0,0 +1,226 @@
+//
+//  ASSpatialIndex.h
+//  Texture
+//
+//  Copyright (c) Pinterest, Inc.  All rights reserved.
+//  Licensed under Apache 2.0: http://www.apache.org/licenses/LICENSE-2.0
+//
+
+#pragma once
+
+/**
+ Static spatial index over a set of rects, for rect queries. Plain C++, like ASFlatLayout.h.
+
+ The rects are sorted along the scroll axis (then the cross axis), so the items of a list or of a grid row are
+ consecutive. On top of that order sits a packed R-tree: each leaf bounds kFanout consecutive items, and each inner
+ node bounds kFanout consecutive nodes of the level below. Since the tree follows the sorted order, a query walks the
+ nodes front to back and reports its hits as ascending, maximal spans of consecutive positions: one span for a list,
+ about one per row for a grid. Nodes fully inside the query rect are reported without visiting their items.
+
+ Built once, then immutable: queries are thread safe and don't allocate.
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace AS {
+
+class SpatialIndex {
+public:
+  typedef double Float;
+
+  enum Axis { Vertical, Horizontal };
+
+  struct Rect {
+    Float x, y, width, height;
+  };
+
+  SpatialIndex() {}
+
+  /**
+   Builds the index. The rects are copied.
+   @param axis The scroll axis, i.e. the one along which most items follow each other.
+   */
+  SpatialIndex(const Rect *rects, uint32_t count, Axis axis)
+  {
+    _order.resize(count);
+    for (uint32_t i = 0; i < count; i++) {
+      _order[i] = i;
+    }
+    const bool vertical = (axis == Vertical);
+    std::sort(_order.begin(), _order.end(), [rects, vertical](uint32_t a, uint32_t b) {
+      const Float aMain = vertical ? rects[a].y : rects[a].x, bMain = vertical ? rects[b].y : rects[b].x;
+      if (aMain != bMain) {
+        return aMain < bMain;
+      }
+      const Float aCross = vertical ? rects[a].x : rects[a].y, bCross = vertical ? rects[b].x : rects[b].y;
+      return aCross < bCross || (aCross == bCross && a < b);
+    });
+
+    _items.reserve(count);
+    uint32_t emptyItemCount = 0;
+    for (uint32_t i = 0; i < count; i++) {
+      _items.push_back(Box(rects[_order[i]]));
+      if (!_items.back().hasArea()) {
+        emptyItemCount++;
+      }
+    }
+    if (emptyItemCount > 0) {
+      _emptyItemCount.resize(count + 1);
+      for (uint32_t i = 0; i < count; i++) {
+        _emptyItemCount[i + 1] = _emptyItemCount[i] + (_items[i].hasArea() ? 0 : 1);
+      }
+    }
+
+    // Level 0 bounds runs of items, every further level runs of the level below, up to a level that fits in a node.
+    const std::vector<Box> *below = &_items;
+    while (below->size() > kFanout || (_levels.empty() && !below->empty())) {
+      std::vector<Box> level((below->size() + kFanout - 1) / kFanout);
+      for (size_t n = 0; n < level.size(); n++) {
+        const size_t end = std::min(below->size(), (n + 1) * kFanout);
+        Box box = (*below)[n * kFanout];
+        for (size_t c = n * kFanout + 1; c < end; c++) {
+          box.add((*below)[c]);
+        }
+        level[n] = box;
+      }
+      _levels.push_back(std::move(level));
+      below = &_levels.back();
+    }
+  }
+
+  uint32_t count() const { return (uint32_t)_order.size(); }
+
+  /** The index, as passed to the constructor, of the item at a sorted position. */
+  uint32_t indexAtPosition(uint32_t position) const { return _order[position]; }
+
+  /**
+   Finds the items intersecting `rect`, with CGRectIntersectsRect() semantics (touching edges don't count).
+   @param span `void span(uint32_t begin, uint32_t end)` is called with ascending, disjoint, non-adjacent ranges of
+               sorted positions. Use indexAtPosition() to map them back.
+   */
+  template <typename Span>
+  void query(const Rect &rect, Span &&span) const
+  {
+    if (_levels.empty()) {
+      return;
+    }
+    const Box q(rect);
+    Spans<Span> spans(span);
+    const size_t top = _levels.size() - 1;
+    for (uint32_t n = 0; n < _levels[top].size(); n++) {
+      visit(top, n, q, spans);
+    }
+    spans.flush();
+  }
+
+private:
+  static const size_t kFanout = 16;
+
+  struct Box {
+    Float minX, minY, maxX, maxY;
+
+    Box() {}
+    explicit Box(const Rect &r) : minX(r.x), minY(r.y), maxX(r.x + r.width), maxY(r.y + r.height) {}
+
+    void add(const Box &b)
+    {
+      minX = std::min(minX, b.minX);
+      minY = std::min(minY, b.minY);
+      maxX = std::max(maxX, b.maxX);
+      maxY = std::max(maxY, b.maxY);
+    }
+
+    bool hasArea() const { return minX < maxX && minY < maxY; }
+
+    bool intersects(const Box &b) const { return minX < b.maxX && b.minX < maxX && minY < b.maxY && b.minY < maxY; }
+
+    bool contains(const Box &b) const { return minX <= b.minX && minY <= b.minY && b.maxX <= maxX && b.maxY <= maxY; }
+  };
+
+  /** Merges adjacent ranges before reporting them. */
+  template <typename Span>
+  struct Spans {
+    Span &span;
+    uint32_t begin = 0, end = 0;
+
+    explicit Spans(Span &span) : span(span) {}
+
+    void add(uint32_t b, uint32_t e)
+    {
+      if (b != end || begin == end) {
+        flush();
+        begin = b;
+      }
+      end = e;
+    }
+
+    void flush()
+    {
+      if (begin < end) {
+        span(begin, end);
+      }
+      begin = end;
+    }
+  };
+
+  /** Visits node `n` of `level`, which covers items [n * kFanout^(level+1), (n+1) * kFanout^(level+1)). */
+  template <typename Span>
+  void visit(size_t level, uint32_t n, const Box &q, Spans<Span> &spans) const
+  {
+    const Box &box = _levels[level][n];
+    if (!q.intersects(box)) {
+      return;
+    }
+
+    if (q.contains(box)) {
+      // Every item of the node with an area intersects the query. One without may lie on the query's edge, which
+      // doesn't count, so those nodes are still checked item by item.
+      size_t width = kFanout;
+      for (size_t l = 0; l < level; l++) {
+        width *= kFanout;
+      }
+      const uint32_t begin = (uint32_t)(n * width), end = (uint32_t)std::min(_items.size(), (n + 1) * width);
+      if (allHaveArea(begin, end)) {
+        spans.add(begin, end);
+        return;
+      }
+    }
+
+    if (level == 0) {
+      const uint32_t end = (uint32_t)std::min(_items.size(), (size_t)(n + 1) * kFanout);
+      for (uint32_t i = n * (uint32_t)kFanout; i < end; i++) {
+        if (q.intersects(_items[i])) {
+          spans.add(i, i + 1);
+        }
+      }
+    } else {
+      const std::vector<Box> &below = _levels[level - 1];
+      const uint32_t end = (uint32_t)std::min(below.size(), (size_t)(n + 1) * kFanout);
+      for (uint32_t c = n * (uint32_t)kFanout; c < end; c++) {
+        visit(level - 1, c, q, spans);
+      }
+    }
+  }
+
+  bool allHaveArea(uint32_t begin, uint32_t end) const
+  {
+    if (_emptyItemCount.empty()) {
+      return true;
+    }
+    return _emptyItemCount[end] == _emptyItemCount[begin];
+  }
+
+  /** Sorted position -> original index. */
+  std::vector<uint32_t> _order;
+  /** Item boxes in sorted order. */
+  std::vector<Box> _items;
+  /** Node boxes, leaves first. */
+  std::vector<std::vector<Box>> _levels;
+  /** Prefix counts of zero-area items, only when there are any. */
+  std::vector<uint32_t> _emptyItemCount;
+};
+
+} // namespace AS
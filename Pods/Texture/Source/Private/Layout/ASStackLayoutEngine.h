@@ -0,0 +1,1021 @@
+//
+//  ASStackLayoutEngine.h
+//  Texture
+//
+//  Copyright (c) Facebook, Inc. and its affiliates.  All rights reserved.
+//  Changes after 4/13/2017 are: Copyright (c) Pinterest, Inc.  All rights reserved.
+//  Licensed under Apache 2.0: http://www.apache.org/licenses/LICENSE-2.0
+//
+
+#pragma once
+
+/**
+ Platform-neutral flexbox engine behind ASStackLayoutSpec.
+
+ This header is plain C++ and must not import Foundation, UIKit or any ASDK header other than the equally portable
+ ASLayoutArena.h. It works on measured sizes and
+ style values only; children are identified by their index and are measured through a client-provided measurer, so
+ the same algorithm can be driven by ASStackUnpositionedLayout on device or by a synthetic harness on any platform.
+
+ A measurer must provide:
+
+   // Lays out the child at `index` within `range` and returns its size and baseline metrics.
+   AS::Stack::Measurement measure(std::size_t index, const AS::Stack::SizeRange &range, const AS::Stack::Size &parentSize);
+
+   // Returns an empty measurement for a child that the engine defers (see useOptimizedFlexing).
+   AS::Stack::Measurement placeholder(std::size_t index);
+
+   // Calls work(i) for every i in [0, count). May run concurrently; every i touches a distinct item.
+   template <typename F> void apply(std::size_t count, F &&work);
+
+ All scratch vectors are AS::ArenaVectors, so a pass running inside an AS::ArenaScope does no per-child heap allocation.
+ */
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <cstddef>
+#include <numeric>
+
+#include "ASLayoutArena.h"
+
+namespace AS {
+namespace Stack {
+
+/** CGFloat is a double on every 64-bit Apple platform; keep the same precision so results match bit for bit. */
+typedef double Float;
+
+template <typename T>
+using Vector = ArenaVector<T>;
+
+struct Size {
+  Float width;
+  Float height;
+};
+
+struct Point {
+  Float x;
+  Float y;
+};
+
+struct SizeRange {
+  Size min;
+  Size max;
+};
+
+// The enum values mirror ASStackLayoutDefines.h and ASDimension.h so that adapters can convert with a cast.
+enum class Direction : unsigned char { Vertical, Horizontal };
+enum class JustifyContent : unsigned char { Start, Center, End, SpaceBetween, SpaceAround };
+enum class AlignItems : unsigned char { Start, End, Center, Stretch, BaselineFirst, BaselineLast, NotSet };
+enum class AlignSelf : unsigned char { Auto, Start, End, Center, Stretch };
+enum class FlexWrap : unsigned char { NoWrap, Wrap };
+enum class AlignContent : unsigned char { Start, Center, End, SpaceBetween, SpaceAround, Stretch };
+enum class DimensionUnit : unsigned char { Auto, Points, Fraction };
+
+struct Dimension {
+  DimensionUnit unit;
+  Float value;
+};
+
+/** The threshold that determines if a violation has actually occurred. */
+static constexpr Float kViolationEpsilon = 0.01;
+
+/** Style of the stack itself. */
+struct Style {
+  Direction direction;
+  Float spacing;
+  JustifyContent justifyContent;
+  AlignItems alignItems;
+  FlexWrap flexWrap;
+  AlignContent alignContent;
+  Float lineSpacing;
+  /** Pixel scale used to floor centered offsets, i.e. ASScreenScale(). */
+  Float scale;
+};
+
+/** Style values of a child. These are read once, before any measurement. */
+struct ChildStyle {
+  Float flexGrow;
+  Float flexShrink;
+  Dimension flexBasis;
+  Float spacingBefore;
+  Float spacingAfter;
+  AlignSelf alignSelf;
+  /** The child's own size range, resolved against an undefined parent size. Only consulted when stretching. */
+  SizeRange size;
+};
+
+/**
+ The result of measuring a child. Baseline metrics are reported with the size because measuring a child may update
+ them (e.g. a nested stack adopts the ascender of its first child).
+ */
+struct Measurement {
+  Size size;
+  Float ascender;
+  Float descender;
+};
+
+struct Item {
+  /** Index of the child in the vector passed to computeUnpositioned(). */
+  std::size_t index;
+  Measurement measurement;
+  /** Only valid once the item went through computePositioned(). */
+  Point position;
+};
+
+/** A contiguous run of items, e.g. the items of a line. */
+struct ItemRange {
+  Item *first;
+  Item *last;
+
+  Item *begin() const { return first; }
+  Item *end() const { return last; }
+  std::size_t size() const { return last - first; }
+  bool empty() const { return first == last; }
+  Item &operator[](std::size_t i) const { return first[i]; }
+};
+
+struct Line {
+  /** Location and length of the line's items in UnpositionedLayout::items. */
+  std::size_t location;
+  std::size_t length;
+  /** The total size of the items in the stack dimension, including all spacing. */
+  Float stackDimensionSum;
+  /** The size in the cross dimension */
+  Float crossSize;
+  /** The baseline of the line which baseline aligned items should align to */
+  Float baseline;
+};
+
+/** A set of items that have their final size computed, but are not yet positioned. */
+struct UnpositionedLayout {
+  /** All items, in line order. */
+  Vector<Item> items;
+  Vector<Line> lines;
+  /**
+   In a single line stack (e.g no wrap), this is the total size of the items in the stack dimension, including all spacing.
+   In a multi-line stack, this is the largest stack dimension among lines.
+   */
+  Float stackDimensionSum;
+  Float crossDimensionSum;
+
+  ItemRange itemsInLine(const Line &line)
+  {
+    Item *first = items.data() + line.location;
+    return {first, first + line.length};
+  }
+};
+
+/** A set of laid out and positioned items, in line order. */
+struct PositionedLayout {
+  Vector<Item> items;
+  /** Final size of the stack */
+  Size size;
+};
+
+#pragma mark - Geometry helpers
+
+inline Float stackDimension(const Direction direction, const Size &size)
+{
+  return (direction == Direction::Vertical) ? size.height : size.width;
+}
+
+inline Float crossDimension(const Direction direction, const Size &size)
+{
+  return (direction == Direction::Vertical) ? size.width : size.height;
+}
+
+inline Point directionPoint(const Direction direction, const Float stack, const Float cross)
+{
+  return (direction == Direction::Vertical) ? Point{cross, stack} : Point{stack, cross};
+}
+
+inline Size directionSize(const Direction direction, const Float stack, const Float cross)
+{
+  return (direction == Direction::Vertical) ? Size{cross, stack} : Size{stack, cross};
+}
+
+inline SizeRange directionSizeRange(const Direction direction,
+                                    const Float stackMin,
+                                    const Float stackMax,
+                                    const Float crossMin,
+                                    const Float crossMax)
+{
+  return {directionSize(direction, stackMin, crossMin), directionSize(direction, stackMax, crossMax)};
+}
+
+inline void setStackValueToPoint(const Direction direction, const Float stack, Point &point)
+{
+  (direction == Direction::Vertical) ? (point.y = stack) : (point.x = stack);
+}
+
+inline Point operator+(const Point &p1, const Point &p2)
+{
+  return {p1.x + p2.x, p1.y + p2.y};
+}
+
+inline Float resolveDimension(const Dimension &dimension, const Float parentSize, const Float autoSize)
+{
+  switch (dimension.unit) {
+    case DimensionUnit::Auto:
+      return autoSize;
+    case DimensionUnit::Points:
+      return dimension.value;
+    case DimensionUnit::Fraction:
+      return dimension.value * parentSize;
+  }
+  return autoSize;
+}
+
+inline Float floorPixelValue(const Float f, const Float scale)
+{
+  return std::floor((f + FLT_EPSILON) * scale) / scale;
+}
+
+inline Size clampSize(const SizeRange &range, const Size &size)
+{
+  return {std::max(range.min.width, std::min(range.max.width, size.width)),
+          std::max(range.min.height, std::min(range.max.height, size.height))};
+}
+
+inline AlignItems alignment(const AlignSelf childAlignment, const AlignItems stackAlignment)
+{
+  switch (childAlignment) {
+    case AlignSelf::Center:
+      return AlignItems::Center;
+    case AlignSelf::End:
+      return AlignItems::End;
+    case AlignSelf::Start:
+      return AlignItems::Start;
+    case AlignSelf::Stretch:
+      return AlignItems::Stretch;
+    case AlignSelf::Auto:
+    default:
+      return stackAlignment;
+  }
+}
+
+#pragma mark - Violations
+
+/**
+ Computes the violation by comparing a stack dimension sum with the overall allowable size range for the stack.
+
+ Violation is the distance you would have to add to the unbounded stack-direction length of the stack's
+ children in order to bring the stack within its allowed sizeRange. It is positive when the children underflow
+ the minimum size and negative when they overflow the maximum size.
+ */
+inline Float computeStackViolation(const Float stackDimensionSum, const Style &style, const SizeRange &sizeRange)
+{
+  const Float minStackDimension = stackDimension(style.direction, sizeRange.min);
+  const Float maxStackDimension = stackDimension(style.direction, sizeRange.max);
+  if (stackDimensionSum < minStackDimension) {
+    return minStackDimension - stackDimensionSum;
+  } else if (stackDimensionSum > maxStackDimension) {
+    return maxStackDimension - stackDimensionSum;
+  }
+  return 0;
+}
+
+/**
+ Computes the violation by comparing a cross dimension sum with the overall allowable size range for the stack.
+ Same sign convention as computeStackViolation().
+ */
+inline Float computeCrossViolation(const Float crossDimensionSum, const Style &style, const SizeRange &sizeRange)
+{
+  const Float minCrossDimension = crossDimension(style.direction, sizeRange.min);
+  const Float maxCrossDimension = crossDimension(style.direction, sizeRange.max);
+  if (crossDimensionSum < minCrossDimension) {
+    return minCrossDimension - crossDimensionSum;
+  } else if (crossDimensionSum > maxCrossDimension) {
+    return maxCrossDimension - crossDimensionSum;
+  }
+  return 0;
+}
+
+inline bool itemIsBaselineAligned(const Style &style, const ChildStyle &child)
+{
+  const AlignItems alignItems = alignment(child.alignSelf, style.alignItems);
+  return alignItems == AlignItems::BaselineFirst || alignItems == AlignItems::BaselineLast;
+}
+
+inline Float baselineForItem(const Style &style, const ChildStyle &child, const Measurement &measurement)
+{
+  switch (alignment(child.alignSelf, style.alignItems)) {
+    case AlignItems::BaselineFirst:
+      return measurement.ascender;
+    case AlignItems::BaselineLast:
+      return crossDimension(style.direction, measurement.size) + measurement.descender;
+    default:
+      return 0;
+  }
+}
+
+inline bool isFlexibleInBothDirections(const ChildStyle &child)
+{
+  return child.flexGrow > 0 && child.flexShrink > 0;
+}
+
+/**
+ If we have a single flexible (both shrinkable and growable) child, and our allowed size range is set to a specific
+ number then we may avoid the first "intrinsic" size calculation.
+ */
+inline bool useOptimizedFlexing(const Vector<ChildStyle> &children, const Style &style, const SizeRange &sizeRange)
+{
+  const auto flexibleChildren = std::count_if(children.begin(), children.end(), isFlexibleInBothDirections);
+  return ((flexibleChildren == 1)
+          && (stackDimension(style.direction, sizeRange.min) == stackDimension(style.direction, sizeRange.max)));
+}
+
+#pragma mark - Unpositioned layout
+
+namespace Detail {
+
+/**
+ Sizes the child given the parameters specified, resolving the cross range for stretched children.
+ */
+template <typename Measurer>
+Measurement crossChildLayout(Measurer &measurer,
+                             const std::size_t index,
+                             const ChildStyle &child,
+                             const Style &style,
+                             const Float stackMin,
+                             const Float stackMax,
+                             const Float crossMin,
+                             const Float crossMax,
+                             const Size &parentSize)
+{
+  const AlignItems alignItems = alignment(child.alignSelf, style.alignItems);
+  Float childCrossMin = 0;
+  Float childCrossMax = crossMax;
+  if (alignItems == AlignItems::Stretch) {
+    // stretched children will have a cross dimension of at least crossMin, unless they explicitly define a child size
+    // that is smaller than the constraint of the parent.
+    const Float explicitMin = crossDimension(style.direction, child.size.min);
+    childCrossMin = (explicitMin != 0) ? explicitMin : crossMin;
+    // stretched children may have a cross direction max that is smaller than the minimum size constraint of the parent.
+    const Float explicitMax = crossDimension(style.direction, child.size.max);
+    childCrossMax = (explicitMax == INFINITY) ? crossMax : explicitMax;
+  }
+  const SizeRange childSizeRange = directionSizeRange(style.direction, stackMin, stackMax, childCrossMin, childCrossMax);
+  return measurer.measure(index, childSizeRange, parentSize);
+}
+
+inline Float computeLinesCrossDimensionSum(const Vector<Line> &lines, const Style &style)
+{
+  return std::accumulate(lines.begin(), lines.end(),
+                         // Start from default spacing between each line:
+                         lines.empty() ? 0 : style.lineSpacing * (lines.size() - 1),
+                         [&](Float x, const Line &l) {
+                           return x + l.crossSize;
+                         });
+}
+
+inline Float computeItemsStackDimensionSum(const ItemRange items,
+                                           const Vector<ChildStyle> &children,
+                                           const Style &style)
+{
+  // Sum up the children's spacing
+  const Float childSpacingSum = std::accumulate(items.begin(), items.end(),
+                                                // Start from default spacing between each child:
+                                                items.empty() ? 0 : style.spacing * (items.size() - 1),
+                                                [&](Float x, const Item &l) {
+                                                  return x + children[l.index].spacingBefore + children[l.index].spacingAfter;
+                                                });
+
+  // Sum up the children's dimensions (including spacing) in the stack direction.
+  return std::accumulate(items.begin(), items.end(), childSpacingSum, [&](Float x, const Item &l) {
+    return x + stackDimension(style.direction, l.measurement.size);
+  });
+}
+
+/**
+ Performs the first unconstrained layout of the children, generating the unpositioned items that are then flexed and
+ stretched.
+ */
+template <typename Measurer>
+void layoutItemsAlongUnconstrainedStackDimension(const ItemRange items,
+                                                 const Vector<ChildStyle> &children,
+                                                 const Style &style,
+                                                 const SizeRange &sizeRange,
+                                                 const Size &parentSize,
+                                                 const bool optimizedFlexing,
+                                                 Measurer &measurer)
+{
+  const Float minCrossDimension = crossDimension(style.direction, sizeRange.min);
+  const Float maxCrossDimension = crossDimension(style.direction, sizeRange.max);
+  const Float parentStackDimension = stackDimension(style.direction, parentSize);
+
+  measurer.apply(items.size(), [&](std::size_t i) {
+    auto &item = items[i];
+    const auto &child = children[item.index];
+    if (optimizedFlexing && isFlexibleInBothDirections(child)) {
+      item.measurement = measurer.placeholder(item.index);
+    } else {
+      item.measurement = crossChildLayout(measurer, item.index, child, style,
+                                          resolveDimension(child.flexBasis, parentStackDimension, 0),
+                                          resolveDimension(child.flexBasis, parentStackDimension, INFINITY),
+                                          minCrossDimension,
+                                          maxCrossDimension,
+                                          parentSize);
+    }
+  });
+}
+
+/**
+ Groups the items into lines. Items are already in line order, so a line is just a run of them.
+ https://www.w3.org/TR/css-flexbox-1/#algo-line-break
+ */
+inline void collectChildrenIntoLines(UnpositionedLayout &layout,
+                                     const Vector<ChildStyle> &children,
+                                     const Style &style,
+                                     const SizeRange &sizeRange)
+{
+  auto &items = layout.items;
+  auto &lines = layout.lines;
+
+  //TODO if infinite max stack size, fast path
+  if (style.flexWrap == FlexWrap::NoWrap) {
+    lines.push_back({0, items.size(), 0, 0, 0});
+    return;
+  }
+
+  std::size_t lineLocation = 0;
+  Float lineStackDimensionSum = 0;
+  Float interitemSpacing = 0;
+
+  for (std::size_t i = 0; i < items.size(); i++) {
+    const auto &item = items[i];
+    const auto &child = children[item.index];
+    const Float itemStackDimension = stackDimension(style.direction, item.measurement.size);
+    const Float itemAndSpacingStackDimension = child.spacingBefore + itemStackDimension + child.spacingAfter;
+    const bool negativeViolationIfAddItem = (computeStackViolation(lineStackDimensionSum + interitemSpacing + itemAndSpacingStackDimension, style, sizeRange) < 0);
+    const bool breakCurrentLine = negativeViolationIfAddItem && i > lineLocation;
+
+    if (breakCurrentLine) {
+      lines.push_back({lineLocation, i - lineLocation, 0, 0, 0});
+      lineLocation = i;
+      lineStackDimensionSum = 0;
+      interitemSpacing = 0;
+    }
+
+    lineStackDimensionSum += interitemSpacing + itemAndSpacingStackDimension;
+    interitemSpacing = style.spacing;
+  }
+
+  // Handle last line
+  lines.push_back({lineLocation, items.size() - lineLocation, 0, 0, 0});
+}
+
+/**
+ Computes the relevant flex factor of a child based on the given violation.
+ */
+struct FlexFactor {
+  enum class Kind : unsigned char { None, Grow, Shrink };
+  Kind kind;
+
+  explicit FlexFactor(const Float violation)
+  : kind(std::fabs(violation) < kViolationEpsilon ? Kind::None : (violation > 0 ? Kind::Grow : Kind::Shrink)) {}
+
+  Float operator()(const ChildStyle &child) const
+  {
+    switch (kind) {
+      case Kind::Grow:
+        return child.flexGrow;
+      case Kind::Shrink:
+        return child.flexShrink;
+      case Kind::None:
+        return 0;
+    }
+    return 0;
+  }
+};
+
+/**
+ Computes a flex grow adjustment for an item: the violation is distributed proportionally to each item's flex grow factor.
+ */
+struct FlexGrowAdjustment {
+  const Vector<ChildStyle> &children;
+  const Float violation;
+  const Float flexFactorSum;
+
+  Float operator()(const Item &item) const
+  {
+    return std::floor(violation * (children[item.index].flexGrow / flexFactorSum));
+  }
+};
+
+/**
+ Computes a flex shrink adjustment for an item. Unlike the flex grow adjustment the flex shrink adjustment needs to take
+ the size of each item into account.
+ */
+struct FlexShrinkAdjustment {
+  const Vector<ChildStyle> &children;
+  const Style &style;
+  const Float violation;
+  const Float flexFactorSum;
+  Float scaledFlexShrinkFactorSum;
+
+  FlexShrinkAdjustment(const ItemRange items,
+                       const Vector<ChildStyle> &children,
+                       const Style &style,
+                       const Float violation,
+                       const Float flexFactorSum)
+  : children(children), style(style), violation(violation), flexFactorSum(flexFactorSum), scaledFlexShrinkFactorSum(0)
+  {
+    for (const auto &item : items) {
+      scaledFlexShrinkFactorSum += scaledFlexShrinkFactor(item);
+    }
+  }
+
+  Float scaledFlexShrinkFactor(const Item &item) const
+  {
+    return stackDimension(style.direction, item.measurement.size) * (children[item.index].flexShrink / flexFactorSum);
+  }
+
+  Float operator()(const Item &item) const
+  {
+    if (scaledFlexShrinkFactorSum == 0.0) {
+      return 0.0;
+    }
+    // The item should shrink proportionally to the scaled flex shrink factor ratio.
+    const Float scaledFlexShrinkFactorRatio = scaledFlexShrinkFactor(item) / scaledFlexShrinkFactorSum;
+    return -std::fabs(scaledFlexShrinkFactorRatio * violation);
+  }
+};
+
+/**
+ The flexible children may have been left not laid out in the initial layout pass, so we may have to go through and size
+ these children at zero size so that the children layouts are at least present.
+ */
+template <typename Measurer>
+void layoutFlexibleChildrenAtZeroSize(const ItemRange items,
+                                      const Vector<ChildStyle> &children,
+                                      const Style &style,
+                                      const SizeRange &sizeRange,
+                                      const Size &parentSize,
+                                      Measurer &measurer)
+{
+  measurer.apply(items.size(), [&](std::size_t i) {
+    auto &item = items[i];
+    const auto &child = children[item.index];
+    if (isFlexibleInBothDirections(child)) {
+      item.measurement = crossChildLayout(measurer, item.index, child, style, 0, 0,
+                                          crossDimension(style.direction, sizeRange.min),
+                                          crossDimension(style.direction, sizeRange.max),
+                                          parentSize);
+    }
+  });
+}
+
+/**
+ Applies the given flex adjustment to the items of a line and re-lays out the ones that flex.
+ */
+template <typename Adjustment, typename Measurer>
+void flexItemsAlongStackDimension(const ItemRange items,
+                                  const Vector<ChildStyle> &children,
+                                  const Style &style,
+                                  const SizeRange &sizeRange,
+                                  const Size &parentSize,
+                                  const Float violation,
+                                  const Adjustment &flexAdjustment,
+                                  Measurer &measurer)
+{
+  // Compute any remaining violation to the first flexible item.
+  Float remainingViolation = violation;
+  for (const auto &item : items) {
+    remainingViolation -= flexAdjustment(item);
+  }
+
+  std::size_t firstFlexItem = -1;
+  for (std::size_t i = 0; i < items.size(); i++) {
+    // Items are consider inflexible if they do not need to make a flex adjustment.
+    if (flexAdjustment(items[i]) != 0) {
+      firstFlexItem = i;
+      break;
+    }
+  }
+  if (firstFlexItem == (std::size_t)-1) {
+    return;
+  }
+
+  measurer.apply(items.size(), [&](std::size_t i) {
+    auto &item = items[i];
+    const auto &child = children[item.index];
+    const Float currentFlexAdjustment = flexAdjustment(item);
+    // Items are consider inflexible if they do not need to make a flex adjustment.
+    if (currentFlexAdjustment != 0) {
+      const Float originalStackSize = stackDimension(style.direction, item.measurement.size);
+      // Only apply the remaining violation for the first flexible item that has a flex grow factor.
+      const Float flexedStackSize = originalStackSize + currentFlexAdjustment + (i == firstFlexItem && child.flexGrow > 0 ? remainingViolation : 0);
+      item.measurement = crossChildLayout(measurer, item.index, child, style,
+                                          std::max(flexedStackSize, 0.0),
+                                          std::max(flexedStackSize, 0.0),
+                                          crossDimension(style.direction, sizeRange.min),
+                                          crossDimension(style.direction, sizeRange.max),
+                                          parentSize);
+    }
+  });
+}
+
+/**
+ Flexes children in the stack axis to resolve a min or max stack size violation. First, determines which children are
+ flexible. Then computes how much to flex each flexible child and performs re-layout. Note that there may still be a
+ non-zero violation even after flexing.
+
+ The actual CSS flexbox spec describes an iterative looping algorithm here:
+ http://www.w3.org/TR/css3-flexbox/#resolve-flexible-lengths
+ */
+template <typename Measurer>
+void flexLinesAlongStackDimension(UnpositionedLayout &layout,
+                                  const Vector<ChildStyle> &children,
+                                  const Style &style,
+                                  const SizeRange &sizeRange,
+                                  const Size &parentSize,
+                                  const bool optimizedFlexing,
+                                  Measurer &measurer)
+{
+  for (const auto &line : layout.lines) {
+    const ItemRange items = layout.itemsInLine(line);
+    const Float violation = computeStackViolation(computeItemsStackDimensionSum(items, children, style), style, sizeRange);
+    const FlexFactor flexFactor(violation);
+    // The flex factor sum is needed to determine if flexing is necessary.
+    // This value is also needed if the violation is positive and flexible items need to grow, so keep it around.
+    Float flexFactorSum = 0;
+    for (const auto &item : items) {
+      flexFactorSum += flexFactor(children[item.index]);
+    }
+
+    // If no items are able to flex then there is nothing left to do with this line. Bail.
+    if (flexFactorSum == 0) {
+      // If optimized flexing was used then we have to clean up the unsized items and lay them out at zero size.
+      if (optimizedFlexing) {
+        layoutFlexibleChildrenAtZeroSize(items, children, style, sizeRange, parentSize, measurer);
+      }
+      continue;
+    }
+
+    if (violation > 0) {
+      const FlexGrowAdjustment adjustment = {children, violation, flexFactorSum};
+      flexItemsAlongStackDimension(items, children, style, sizeRange, parentSize, violation, adjustment, measurer);
+    } else {
+      const FlexShrinkAdjustment adjustment(items, children, style, violation, flexFactorSum);
+      flexItemsAlongStackDimension(items, children, style, sizeRange, parentSize, violation, adjustment, measurer);
+    }
+  }
+}
+
+/**
+ Computes cross size and baseline of each line.
+ https://www.w3.org/TR/css-flexbox-1/#algo-cross-line
+ */
+inline void computeLinesCrossSizeAndBaseline(UnpositionedLayout &layout,
+                                             const Vector<ChildStyle> &children,
+                                             const Style &style,
+                                             const SizeRange &sizeRange)
+{
+  auto &lines = layout.lines;
+  const bool isSingleLine = (lines.size() == 1);
+
+  const Float minCrossSize = crossDimension(style.direction, sizeRange.min);
+  const Float maxCrossSize = crossDimension(style.direction, sizeRange.max);
+  const bool definiteCrossSize = (minCrossSize == maxCrossSize);
+
+  // If the stack is single-line and has a definite cross size, the cross size of the line is the stack's definite cross size.
+  if (isSingleLine && definiteCrossSize) {
+    auto &line = lines[0];
+    line.crossSize = minCrossSize;
+
+    // We still need to determine the line's baseline
+    for (const auto &item : layout.itemsInLine(line)) {
+      const auto &child = children[item.index];
+      if (itemIsBaselineAligned(style, child)) {
+        line.baseline = std::max(line.baseline, baselineForItem(style, child, item.measurement));
+      }
+    }
+    return;
+  }
+
+  for (auto &line : lines) {
+    Float maxStartToBaselineDistance = 0;
+    Float maxBaselineToEndDistance = 0;
+    Float maxItemCrossSize = 0;
+
+    for (const auto &item : layout.itemsInLine(line)) {
+      const auto &child = children[item.index];
+      if (itemIsBaselineAligned(style, child)) {
+        // Step 1. Collect all the items whose align-self is baseline. Find the largest of the distances
+        // between each item’s baseline and its hypothetical outer cross-start edge (aka. its baseline value),
+        // and the largest of the distances between each item’s baseline and its hypothetical outer cross-end edge,
+        // and sum these two values.
+        const Float baseline = baselineForItem(style, child, item.measurement);
+        maxStartToBaselineDistance = std::max(maxStartToBaselineDistance, baseline);
+        maxBaselineToEndDistance = std::max(maxBaselineToEndDistance, crossDimension(style.direction, item.measurement.size) - baseline);
+      } else {
+        // Step 2. Among all the items not collected by the previous step, find the largest outer hypothetical cross size.
+        maxItemCrossSize = std::max(maxItemCrossSize, crossDimension(style.direction, item.measurement.size));
+      }
+    }
+
+    // Step 3. The used cross-size of the flex line is the largest of the numbers found in the previous two steps and zero.
+    line.crossSize = std::max(maxStartToBaselineDistance + maxBaselineToEndDistance, maxItemCrossSize);
+    if (isSingleLine) {
+      // If the stack is single-line, then clamp the line’s cross-size to be within the stack's min and max cross-size properties.
+      line.crossSize = std::min(std::max(minCrossSize, line.crossSize), maxCrossSize);
+    }
+
+    line.baseline = maxStartToBaselineDistance;
+  }
+}
+
+/**
+ Stretches items to lay out along the cross axis according to their alignSelf and the stack's alignItems.
+ This does not do the actual alignment of the items once stretched though; computePositioned() will do centering etc.
+ */
+template <typename Measurer>
+void stretchItemsAlongCrossDimension(const ItemRange items,
+                                     const Vector<ChildStyle> &children,
+                                     const Style &style,
+                                     const Size &parentSize,
+                                     const Float crossSize,
+                                     Measurer &measurer)
+{
+  measurer.apply(items.size(), [&](std::size_t i) {
+    auto &item = items[i];
+    const auto &child = children[item.index];
+    if (alignment(child.alignSelf, style.alignItems) == AlignItems::Stretch) {
+      const Float cross = crossDimension(style.direction, item.measurement.size);
+      const Float stack = stackDimension(style.direction, item.measurement.size);
+      const Float violation = crossSize - cross;
+
+      // Only stretch if violation is positive. Compare against kViolationEpsilon here to avoid stretching against a tiny violation.
+      if (violation > kViolationEpsilon) {
+        item.measurement = crossChildLayout(measurer, item.index, child, style, stack, stack, crossSize, crossSize, parentSize);
+      }
+    }
+  });
+}
+
+/**
+ Stretch lines and their items according to alignContent, alignItems and alignSelf.
+ https://www.w3.org/TR/css-flexbox-1/#algo-line-stretch
+ https://www.w3.org/TR/css-flexbox-1/#algo-stretch
+ */
+template <typename Measurer>
+void stretchLinesAlongCrossDimension(UnpositionedLayout &layout,
+                                     const Vector<ChildStyle> &children,
+                                     const Style &style,
+                                     const SizeRange &sizeRange,
+                                     const Size &parentSize,
+                                     Measurer &measurer)
+{
+  auto &lines = layout.lines;
+  const std::size_t numOfLines = lines.size();
+  const Float violation = computeCrossViolation(computeLinesCrossDimensionSum(lines, style), style, sizeRange);
+  // Don't stretch if the stack is single line, because the line's cross size was clamped against the stack's constrained size.
+  const bool shouldStretchLines = (numOfLines > 1
+                                   && style.alignContent == AlignContent::Stretch
+                                   && violation > kViolationEpsilon);
+
+  const Float extraCrossSizePerLine = violation / numOfLines;
+  for (auto &line : lines) {
+    if (shouldStretchLines) {
+      line.crossSize += extraCrossSizePerLine;
+    }
+
+    stretchItemsAlongCrossDimension(layout.itemsInLine(line), children, style, parentSize, line.crossSize, measurer);
+  }
+}
+
+} // namespace Detail
+
+/**
+ Given a set of children, computes their final sizes and groups them into lines, without positioning them.
+ */
+template <typename Measurer>
+UnpositionedLayout computeUnpositioned(const Vector<ChildStyle> &children,
+                                       const Style &style,
+                                       const SizeRange &sizeRange,
+                                       const Size &parentSize,
+                                       Measurer &measurer)
+{
+  UnpositionedLayout layout = {};
+  if (children.empty()) {
+    return layout;
+  }
+
+  // We may be able to avoid some redundant layout passes
+  const bool optimizedFlexing = useOptimizedFlexing(children, style, sizeRange);
+
+  layout.items.resize(children.size());
+  for (std::size_t i = 0; i < layout.items.size(); i++) {
+    layout.items[i].index = i;
+  }
+  const ItemRange allItems = {layout.items.data(), layout.items.data() + layout.items.size()};
+
+  // We do a first pass of all the children, generating an unpositioned layout for each with an unbounded range along
+  // the stack dimension.  This allows us to compute the "intrinsic" size of each child and find the available violation
+  // which determines whether we must grow or shrink the flexible children.
+  Detail::layoutItemsAlongUnconstrainedStackDimension(allItems, children, style, sizeRange, parentSize, optimizedFlexing, measurer);
+
+  // Collect items into lines (https://www.w3.org/TR/css-flexbox-1/#algo-line-break)
+  Detail::collectChildrenIntoLines(layout, children, style, sizeRange);
+
+  // Resolve the flexible lengths (https://www.w3.org/TR/css-flexbox-1/#resolve-flexible-lengths)
+  Detail::flexLinesAlongStackDimension(layout, children, style, sizeRange, parentSize, optimizedFlexing, measurer);
+
+  // Calculate the cross size of each flex line (https://www.w3.org/TR/css-flexbox-1/#algo-cross-line)
+  Detail::computeLinesCrossSizeAndBaseline(layout, children, style, sizeRange);
+
+  // Handle 'align-content: stretch' (https://www.w3.org/TR/css-flexbox-1/#algo-line-stretch)
+  // Determine the used cross size of each item (https://www.w3.org/TR/css-flexbox-1/#algo-stretch)
+  Detail::stretchLinesAlongCrossDimension(layout, children, style, sizeRange, parentSize, measurer);
+
+  // Compute stack dimension sum of each line and the whole stack
+  Float layoutStackDimensionSum = 0;
+  for (auto &line : layout.lines) {
+    line.stackDimensionSum = Detail::computeItemsStackDimensionSum(layout.itemsInLine(line), children, style);
+    // layoutStackDimensionSum is the max stackDimensionSum among all lines
+    layoutStackDimensionSum = std::max(line.stackDimensionSum, layoutStackDimensionSum);
+  }
+  layout.stackDimensionSum = layoutStackDimensionSum;
+  layout.crossDimensionSum = Detail::computeLinesCrossDimensionSum(layout.lines, style);
+  return layout;
+}
+
+#pragma mark - Positioned layout
+
+namespace Detail {
+
+inline Float crossOffsetForItem(const Item &item,
+                                const ChildStyle &child,
+                                const Style &style,
+                                const Float crossSize,
+                                const Float baseline)
+{
+  switch (alignment(child.alignSelf, style.alignItems)) {
+    case AlignItems::End:
+      return crossSize - crossDimension(style.direction, item.measurement.size);
+    case AlignItems::Center:
+      return floorPixelValue((crossSize - crossDimension(style.direction, item.measurement.size)) / 2, style.scale);
+    case AlignItems::BaselineFirst:
+    case AlignItems::BaselineLast:
+      return baseline - baselineForItem(style, child, item.measurement);
+    case AlignItems::Start:
+    case AlignItems::Stretch:
+    case AlignItems::NotSet:
+      return 0;
+  }
+  return 0;
+}
+
+inline void crossOffsetAndSpacingForEachLine(const std::size_t numOfLines,
+                                             const Float crossViolation,
+                                             AlignContent alignContent,
+                                             Float &offset,
+                                             Float &spacing)
+{
+  // Handle edge cases
+  if (alignContent == AlignContent::SpaceBetween && (crossViolation < kViolationEpsilon || numOfLines == 1)) {
+    alignContent = AlignContent::Start;
+  } else if (alignContent == AlignContent::SpaceAround && (crossViolation < kViolationEpsilon || numOfLines == 1)) {
+    alignContent = AlignContent::Center;
+  }
+
+  offset = 0;
+  spacing = 0;
+
+  switch (alignContent) {
+    case AlignContent::Center:
+      offset = crossViolation / 2;
+      break;
+    case AlignContent::End:
+      offset = crossViolation;
+      break;
+    case AlignContent::SpaceBetween:
+      // Spacing between the lines, no spaces at the edges, evenly distributed
+      spacing = crossViolation / (numOfLines - 1);
+      break;
+    case AlignContent::SpaceAround: {
+      // Spacing between lines are twice the spacing on the edges
+      const Float spacingUnit = crossViolation / (numOfLines * 2);
+      offset = spacingUnit;
+      spacing = spacingUnit * 2;
+      break;
+    }
+    case AlignContent::Start:
+    case AlignContent::Stretch:
+      break;
+  }
+}
+
+inline void stackOffsetAndSpacingForEachItem(const std::size_t numOfItems,
+                                             const Float stackViolation,
+                                             JustifyContent justifyContent,
+                                             Float &offset,
+                                             Float &spacing)
+{
+  // Handle edge cases
+  if (justifyContent == JustifyContent::SpaceBetween && (stackViolation < kViolationEpsilon || numOfItems == 1)) {
+    justifyContent = JustifyContent::Start;
+  } else if (justifyContent == JustifyContent::SpaceAround && (stackViolation < kViolationEpsilon || numOfItems == 1)) {
+    justifyContent = JustifyContent::Center;
+  }
+
+  offset = 0;
+  spacing = 0;
+
+  switch (justifyContent) {
+    case JustifyContent::Center:
+      offset = stackViolation / 2;
+      break;
+    case JustifyContent::End:
+      offset = stackViolation;
+      break;
+    case JustifyContent::SpaceBetween:
+      // Spacing between the items, no spaces at the edges, evenly distributed
+      spacing = stackViolation / (numOfItems - 1);
+      break;
+    case JustifyContent::SpaceAround: {
+      // Spacing between items are twice the spacing on the edges
+      const Float spacingUnit = stackViolation / (numOfItems * 2);
+      offset = spacingUnit;
+      spacing = spacingUnit * 2;
+      break;
+    }
+    case JustifyContent::Start:
+      break;
+  }
+}
+
+inline void positionItemsInLine(const ItemRange items,
+                                const Line &line,
+                                const Vector<ChildStyle> &children,
+                                const Style &style,
+                                const Point &startingPoint,
+                                const Float stackSpacing)
+{
+  Point p = startingPoint;
+  bool first = true;
+
+  for (auto &item : items) {
+    const auto &child = children[item.index];
+    p = p + directionPoint(style.direction, child.spacingBefore, 0);
+    if (!first) {
+      p = p + directionPoint(style.direction, style.spacing + stackSpacing, 0);
+    }
+    first = false;
+    item.position = p + directionPoint(style.direction, 0, crossOffsetForItem(item, child, style, line.crossSize, line.baseline));
+
+    p = p + directionPoint(style.direction, stackDimension(style.direction, item.measurement.size) + child.spacingAfter, 0);
+  }
+}
+
+} // namespace Detail
+
+/**
+ Given an unpositioned layout, computes the positions each item should be placed at.
+ Consumes the items of `layout`.
+ */
+inline PositionedLayout computePositioned(UnpositionedLayout &layout,
+                                          const Vector<ChildStyle> &children,
+                                          const Style &style,
+                                          const SizeRange &sizeRange)
+{
+  auto &lines = layout.lines;
+  if (lines.empty()) {
+    return {};
+  }
+
+  const auto numOfLines = lines.size();
+  const auto direction = style.direction;
+  const Float crossViolation = computeCrossViolation(layout.crossDimensionSum, style, sizeRange);
+  Float crossOffset;
+  Float crossSpacing;
+  Detail::crossOffsetAndSpacingForEachLine(numOfLines, crossViolation, style.alignContent, crossOffset, crossSpacing);
+
+  Point p = directionPoint(direction, 0, crossOffset);
+  bool first = true;
+  for (const auto &line : lines) {
+    if (!first) {
+      p = p + directionPoint(direction, 0, crossSpacing + style.lineSpacing);
+    }
+    first = false;
+
+    const Float stackViolation = computeStackViolation(line.stackDimensionSum, style, sizeRange);
+    Float stackOffset;
+    Float stackSpacing;
+    Detail::stackOffsetAndSpacingForEachItem(line.length, stackViolation, style.justifyContent, stackOffset, stackSpacing);
+
+    setStackValueToPoint(direction, stackOffset, p);
+    Detail::positionItemsInLine(layout.itemsInLine(line), line, children, style, p, stackSpacing);
+
+    p = p + directionPoint(direction, -stackOffset, line.crossSize);
+  }
+
+  const Size finalSize = directionSize(direction, layout.stackDimensionSum, layout.crossDimensionSum);
+  // Lines are runs of the items vector, so the items are already in line order.
+  return {std::move(layout.items), clampSize(sizeRange, finalSize)};
+}
+
+} // namespace Stack
+} // namespace AS
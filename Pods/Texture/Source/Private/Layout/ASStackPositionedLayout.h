@@ -13,12 +13,13 @@
 
 /** Represents a set of laid out and positioned stack layout children. */
 struct ASStackPositionedLayout {
-  const std::vector<ASStackLayoutSpecItem> items;
+  /** Positioned layouts of the children, in line order. */
+  const AS::ArenaVector<ASLayout *> sublayouts;
   /** Final size of the stack */
   const CGSize size;
   
-  /** Given an unpositioned layout, computes the positions each child should be placed at. */
-  static ASStackPositionedLayout compute(const ASStackUnpositionedLayout &unpositionedLayout,
+  /** Given an unpositioned layout, computes the positions each child should be placed at. Consumes the unpositioned lines. */
+  static ASStackPositionedLayout compute(ASStackUnpositionedLayout &unpositionedLayout,
                                          const ASStackLayoutSpecStyle &style,
                                          const ASSizeRange &constrainedSize);
 };
@@ -9,7 +9,9 @@
 
 #import <vector>
 
+#import <AsyncDisplayKit/ASInternalHelpers.h>
 #import <AsyncDisplayKit/ASLayout.h>
+#import <AsyncDisplayKit/ASStackLayoutEngine.h>
 #import <AsyncDisplayKit/ASStackLayoutSpecUtilities.h>
 #import <AsyncDisplayKit/ASStackLayoutSpec.h>
 
@@ -25,49 +27,46 @@ struct ASStackLayoutSpecChild {
   ASLayoutElementSize size;
 };
 
-struct ASStackLayoutSpecItem {
-  /** The original source child. */
-  ASStackLayoutSpecChild child;
-  /** The proposed layout or nil if no is calculated yet. */
-  ASLayout *layout;
-};
-
-struct ASStackUnpositionedLine {
-  /** The set of proposed children in this line, each contains child layout, not yet positioned. */
-  std::vector<ASStackLayoutSpecItem> items;
-  /** The total size of the children in the stack dimension, including all spacing. */
-  CGFloat stackDimensionSum;
-  /** The size in the cross dimension */
-  CGFloat crossSize;
-  /** The baseline of the stack which baseline aligned children should align to */
-  CGFloat baseline;
-};
-
-/** Represents a set of stack layout children that have their final layout computed, but are not yet positioned. */
+/**
+ Represents a set of stack layout children that have their final layout computed, but are not yet positioned.
+ This is a thin adapter around AS::Stack::computeUnpositioned(); the flexbox algorithm itself lives in ASStackLayoutEngine.h.
+ */
 struct ASStackUnpositionedLayout {
-  /** The set of proposed lines, each contains child layouts, not yet positioned. */
-  const std::vector<ASStackUnpositionedLine> lines;
-  /** 
-   * In a single line stack (e.g no wrao), this is the total size of the children in the stack dimension, including all spacing.
-   * In a multi-line stack, this is the largest stack dimension among lines.
-   */
-  const CGFloat stackDimensionSum;
-  const CGFloat crossDimensionSum;
-  
+  /** Engine styles of the children, in the order they were passed to compute(). */
+  AS::Stack::Vector<AS::Stack::ChildStyle> childStyles;
+  /** Lines of items. Each item's index refers to `childStyles` and `sublayouts`. */
+  AS::Stack::UnpositionedLayout layout;
+  /** The latest layout computed for each child, in the order they were passed to compute(). */
+  AS::ArenaVector<ASLayout *> sublayouts;
+
   /** Given a set of children, computes the unpositioned layouts for those children. */
-  static ASStackUnpositionedLayout compute(const std::vector<ASStackLayoutSpecChild> &children,
+  static ASStackUnpositionedLayout compute(const AS::ArenaVector<ASStackLayoutSpecChild> &children,
                                            const ASStackLayoutSpecStyle &style,
                                            const ASSizeRange &sizeRange,
                                            const BOOL concurrent);
-  
-  static CGFloat baselineForItem(const ASStackLayoutSpecStyle &style,
-                                 const ASStackLayoutSpecItem &l);
-  
-  static CGFloat computeStackViolation(const CGFloat stackDimensionSum,
-                                       const ASStackLayoutSpecStyle &style,
-                                       const ASSizeRange &sizeRange);
-
-  static CGFloat computeCrossViolation(const CGFloat crossDimensionSum,
-                                       const ASStackLayoutSpecStyle &style,
-                                       const ASSizeRange &sizeRange);
 };
+
+/** Converts between ASDK layout types and the platform-neutral ones used by AS::Stack. */
+inline AS::Stack::Style ASStackLayoutEngineStyle(const ASStackLayoutSpecStyle &style)
+{
+  return {
+    .direction = (AS::Stack::Direction)style.direction,
+    .spacing = style.spacing,
+    .justifyContent = (AS::Stack::JustifyContent)style.justifyContent,
+    .alignItems = (AS::Stack::AlignItems)style.alignItems,
+    .flexWrap = (AS::Stack::FlexWrap)style.flexWrap,
+    .alignContent = (AS::Stack::AlignContent)style.alignContent,
+    .lineSpacing = style.lineSpacing,
+    .scale = ASScreenScale(),
+  };
+}
+
+inline AS::Stack::Size ASStackLayoutEngineSize(const CGSize size)
+{
+  return {size.width, size.height};
+}
+
+inline AS::Stack::SizeRange ASStackLayoutEngineSizeRange(const ASSizeRange &sizeRange)
+{
+  return {ASStackLayoutEngineSize(sizeRange.min), ASStackLayoutEngineSize(sizeRange.max)};
+}
@@ -124,6 +124,16 @@ NSString *NSStringFromASHierarchyChangeType(_ASHierarchyChangeType changeType);
 
 - (instancetype)initWithOldData:(std::vector<NSInteger>)oldItemCounts NS_DESIGNATED_INITIALIZER;
 
+/**
+ * Returns a completed change set equivalent to the given ones applied in order, e.g. to submit a burst of updates as
+ * a single batch update. Items deleted, inserted or reloaded by any of them are, unless a later one cancels it out.
+ * Merging in a reload data gives a reload data. Executing the completion handler of the result executes those of all
+ * the given change sets.
+ *
+ * @precondition The change sets must be completed, and each must start from the data the previous one ends with.
+ */
++ (_ASHierarchyChangeSet *)changeSetByMergingChangeSets:(NSArray<_ASHierarchyChangeSet *> *)changeSets;
+
 /**
  * Append the given completion handler to the combined @c completionHandler.
  *
@@ -8,6 +8,7 @@
 //
 
 #import <AsyncDisplayKit/_ASHierarchyChangeSet.h>
+#import <AsyncDisplayKit/ASChangeSetCompiler.h>
 #import <AsyncDisplayKit/ASInternalHelpers.h>
 #import <AsyncDisplayKit/ASCollections.h>
 #import <AsyncDisplayKit/NSIndexSet+ASHelpers.h>
@@ -154,6 +155,53 @@ NSString *NSStringFromASHierarchyChangeType(_ASHierarchyChangeType changeType)
   return self;
 }
 
++ (_ASHierarchyChangeSet *)changeSetByMergingChangeSets:(NSArray<_ASHierarchyChangeSet *> *)changeSets
+{
+  ASDisplayNodeAssert(changeSets.count > 0, @"Nothing to merge.");
+  if (changeSets.count == 1) {
+    return changeSets.firstObject;
+  }
+
+  _ASHierarchyChangeSet *first = changeSets.firstObject;
+  _ASHierarchyChangeSet *last = changeSets.lastObject;
+  _ASHierarchyChangeSet *result = [[_ASHierarchyChangeSet alloc] initWithOldData:first->_oldItemCounts];
+
+  BOOL includesReloadData = NO;
+  BOOL animated = YES;
+  NSUInteger countForAsyncLayout = 0;
+  for (_ASHierarchyChangeSet *changeSet in changeSets) {
+    ASDisplayNodeAssert(changeSet.completed, @"Attempt to merge incomplete changeset %@", changeSet);
+    includesReloadData |= changeSet.includesReloadData;
+    animated &= changeSet.animated;
+    countForAsyncLayout += changeSet.countForAsyncLayout;
+  }
+
+  if (includesReloadData) {
+    // Reloading reads the data as of the last change set, which covers all of them.
+    [result reloadData];
+  } else {
+    std::vector<AS::ChangeSetCompiler::ChangeSet> compilerChangeSets;
+    compilerChangeSets.reserve(changeSets.count);
+    for (_ASHierarchyChangeSet *changeSet in changeSets) {
+      compilerChangeSets.push_back([changeSet _compilerChangeSet]);
+    }
+    [result _addCompilerChangeSet:AS::ChangeSetCompiler::composeAll(std::move(compilerChangeSets))];
+  }
+
+  result.animated = animated;
+  result.countForAsyncLayout = countForAsyncLayout;
+  result.rootActivity = last.rootActivity;
+  result.submitActivity = last.submitActivity;
+  NSArray<_ASHierarchyChangeSet *> *mergedChangeSets = [changeSets copy];
+  [result addCompletionHandler:^(BOOL finished) {
+    for (_ASHierarchyChangeSet *changeSet in mergedChangeSets) {
+      [changeSet executeCompletionHandlerWithFinished:finished];
+    }
+  }];
+  [result markCompletedWithNewItemCounts:last->_newItemCounts];
+  return result;
+}
+
 #pragma mark External API
 
 - (BOOL)isEmpty
@@ -432,6 +480,90 @@ NSString *NSStringFromASHierarchyChangeType(_ASHierarchyChangeType changeType)
 
 #pragma mark Private
 
+/**
+ * The changes as submitted, i.e. with reloads not yet split into deletes and inserts.
+ */
+- (AS::ChangeSetCompiler::ChangeSet)_compilerChangeSet
+{
+  AS::ChangeSetCompiler::ChangeSet result;
+  result.oldCounts.assign(_oldItemCounts.begin(), _oldItemCounts.end());
+  result.newCounts.assign(_newItemCounts.begin(), _newItemCounts.end());
+
+  const auto addSectionChanges = [](NSArray<_ASHierarchySectionChange *> *changes, std::vector<AS::ChangeSetCompiler::SectionChange> &sections) {
+    for (_ASHierarchySectionChange *change in changes) {
+      const ASDataControllerAnimationOptions options = change.animationOptions;
+      [change.indexSet enumerateRangesUsingBlock:^(NSRange range, BOOL * _Nonnull stop) {
+        for (NSUInteger i = range.location; i < NSMaxRange(range); i++) {
+          sections.push_back({(AS::ChangeSetCompiler::Index)i, options});
+        }
+      }];
+    }
+  };
+  addSectionChanges(_originalDeleteSectionChanges, result.deletedSections);
+  addSectionChanges(_originalInsertSectionChanges, result.insertedSections);
+  addSectionChanges(_reloadSectionChanges, result.reloadedSections);
+
+  const auto addItemChanges = [](NSArray<_ASHierarchyItemChange *> *changes, std::vector<AS::ChangeSetCompiler::ItemChange> &items) {
+    for (_ASHierarchyItemChange *change in changes) {
+      for (NSIndexPath *indexPath in change.indexPaths) {
+        items.push_back({indexPath.section, indexPath.item, change.animationOptions});
+      }
+    }
+  };
+  addItemChanges(_originalDeleteItemChanges, result.deletedItems);
+  addItemChanges(_originalInsertItemChanges, result.insertedItems);
+  addItemChanges(_reloadItemChanges, result.reloadedItems);
+
+  result.normalize();
+  return result;
+}
+
+/**
+ * Submits the changes, one change per run of equal animation options.
+ */
+- (void)_addCompilerChangeSet:(const AS::ChangeSetCompiler::ChangeSet &)changeSet
+{
+  const auto forEachSectionRun = [](const std::vector<AS::ChangeSetCompiler::SectionChange> &changes, void (^block)(NSIndexSet *, ASDataControllerAnimationOptions)) {
+    NSMutableIndexSet *sections = [[NSMutableIndexSet alloc] init];
+    for (size_t i = 0; i < changes.size(); i++) {
+      [sections addIndex:changes[i].section];
+      if (i + 1 == changes.size() || changes[i + 1].options != changes[i].options) {
+        block(sections, (ASDataControllerAnimationOptions)changes[i].options);
+        sections = [[NSMutableIndexSet alloc] init];
+      }
+    }
+  };
+  forEachSectionRun(changeSet.deletedSections, ^(NSIndexSet *sections, ASDataControllerAnimationOptions options) {
+    [self deleteSections:sections animationOptions:options];
+  });
+  forEachSectionRun(changeSet.insertedSections, ^(NSIndexSet *sections, ASDataControllerAnimationOptions options) {
+    [self insertSections:sections animationOptions:options];
+  });
+  forEachSectionRun(changeSet.reloadedSections, ^(NSIndexSet *sections, ASDataControllerAnimationOptions options) {
+    [self reloadSections:sections animationOptions:options];
+  });
+
+  const auto forEachItemRun = [](const std::vector<AS::ChangeSetCompiler::ItemChange> &changes, void (^block)(NSArray<NSIndexPath *> *, ASDataControllerAnimationOptions)) {
+    NSMutableArray<NSIndexPath *> *indexPaths = [[NSMutableArray alloc] init];
+    for (size_t i = 0; i < changes.size(); i++) {
+      [indexPaths addObject:[NSIndexPath indexPathForItem:changes[i].item inSection:changes[i].section]];
+      if (i + 1 == changes.size() || changes[i + 1].options != changes[i].options) {
+        block(indexPaths, (ASDataControllerAnimationOptions)changes[i].options);
+        indexPaths = [[NSMutableArray alloc] init];
+      }
+    }
+  };
+  forEachItemRun(changeSet.deletedItems, ^(NSArray<NSIndexPath *> *indexPaths, ASDataControllerAnimationOptions options) {
+    [self deleteItems:indexPaths animationOptions:options];
+  });
+  forEachItemRun(changeSet.insertedItems, ^(NSArray<NSIndexPath *> *indexPaths, ASDataControllerAnimationOptions options) {
+    [self insertItems:indexPaths animationOptions:options];
+  });
+  forEachItemRun(changeSet.reloadedItems, ^(NSArray<NSIndexPath *> *indexPaths, ASDataControllerAnimationOptions options) {
+    [self reloadItems:indexPaths animationOptions:options];
+  });
+}
+
 - (BOOL)_ensureNotCompleted
 {
   NSAssert(!_completed, @"Attempt to modify completed changeset %@", self);
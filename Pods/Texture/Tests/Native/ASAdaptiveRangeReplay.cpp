@@ -0,0 +1,176 @@
+//
+//  ASAdaptiveRangeReplay.cpp
+//  Texture
+//
+//  Copyright (c) Pinterest, Inc.  All rights reserved.
+//  Licensed under Apache 2.0: http://www.apache.org/licenses/LICENSE-2.0
+//
+
+// Replays a scroll trace through AS::AdaptiveRange the way the range controller feeds it: one sample per range
+// update, then one adapt() per range type. Compares blank rows and display range size with the static tuning.
+//
+//   g++ -std=c++14 -O2 -Wno-unknown-pragmas -I../../Source/Private ASAdaptiveRangeReplay.cpp -o adaptive_range_replay && ./adaptive_range_replay
+
+#include "ASAdaptiveRange.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+namespace {
+
+int failures = 0;
+
+void expect(bool condition, const char *description)
+{
+  if (!condition) {
+    std::printf("FAILED: %s\n", description);
+    failures++;
+  }
+}
+
+// Matches kASAdaptiveRangeDisplayLatency and kASAdaptiveRangePreloadLatency in ASAbstractLayoutController.mm
+const double kDisplayLatency = 0.15;
+const double kPreloadLatency = 0.6;
+const double kViewport = 667;
+
+void checkModel()
+{
+  AS::AdaptiveRange range;
+  const AS::AdaptiveRange::Buffers display = {1.0, 0.5}, preload = {2.5, 1.5};
+  auto buffers = range.adapt(display, kDisplayLatency);
+  expect(buffers.leading == 1.0 && buffers.trailing == 0.5, "no samples leaves the buffers alone");
+
+  // Steady 3000pt/s at 60Hz
+  double t = 0, y = 0;
+  for (int frame = 0; frame < 60; frame++) {
+    range.sample(t, y, kViewport);
+    t += 1 / 60.0;
+    y += 50;
+  }
+  expect(std::fabs(range.velocity() - 3000) < 1, "velocity converges to the scroll speed");
+  buffers = range.adapt(display, kDisplayLatency);
+  expect(std::fabs(buffers.leading - (1.0 + 3000 * kDisplayLatency / kViewport)) < 1e-3, "display leading buffer covers the latency");
+  buffers = range.adapt(preload, kPreloadLatency);
+  expect(buffers.leading + buffers.trailing <= range.configuration().maximumScreenfuls - 1, "preload range stays within the budget");
+
+  // Over a tighter budget, the trailing buffer goes down to a quarter screenful before the leading one is cut
+  AS::AdaptiveRange::Configuration configuration = range.configuration();
+  configuration.maximumScreenfuls = 5;
+  range.setConfiguration(configuration);
+  buffers = range.adapt(preload, kPreloadLatency);
+  expect(buffers.trailing == 0.25 && std::fabs(buffers.leading - 3.75) < 1e-9, "the trailing buffer is cut first when over budget");
+  range.setConfiguration(AS::AdaptiveRange::Configuration());
+
+  // A second sample at the same time would be a zero-length interval; it must not disturb the velocity.
+  const double velocity = range.velocity();
+  range.sample(t - 1 / 60.0, y + 500, kViewport);
+  expect(range.velocity() == velocity, "samples without elapsed time are ignored");
+
+  // Stop, and stay still past the idle delay
+  for (int frame = 0; frame < 60; frame++) {
+    range.sample(t, y, kViewport);
+    t += 1 / 60.0;
+  }
+  expect(range.isIdle(), "a still scroll view is idle");
+  buffers = range.adapt(display, kDisplayLatency);
+  expect(buffers.leading == 0.5 && buffers.trailing == 0.25, "idle halves both buffers");
+}
+
+struct Sample {
+  double time;
+  double offset;
+};
+
+// 60Hz: slow browsing, flings with an exponential (UIScrollView-like) decay, pauses, both directions
+std::vector<Sample> trace()
+{
+  std::vector<Sample> samples;
+  double t = 0, y = 0;
+  const double dt = 1 / 60.0;
+  auto run = [&](double duration, double velocity, double decay) {
+    for (double elapsed = 0; elapsed < duration; elapsed += dt) {
+      y += velocity * dt;
+      velocity *= std::pow(decay, dt * 1000);
+      t += dt;
+      samples.push_back({t, std::max(0.0, y)});
+    }
+  };
+  for (int k = 0; k < 4; k++) {
+    run(3, 150, 1.0);
+    run(0.5, 0, 1);
+    run(2.5, 9000, 0.998);
+    run(1.5, 0, 1);
+    run(3, -300, 1.0);
+    run(2.0, -7000, 0.998);
+  }
+  return samples;
+}
+
+struct ReplayResult {
+  double blankPercent;
+  double meanScreenfuls;
+};
+
+// A row is blank until it has been in the display range for the display latency.
+ReplayResult replay(bool adaptive)
+{
+  const double rowHeight = 60;
+  const auto samples = trace();
+  AS::AdaptiveRange range;
+  std::vector<double> enteredAt(200000, -1);
+  long visibleRowFrames = 0, blankRowFrames = 0;
+  double screenfuls = 0, previousOffset = 0;
+
+  for (const Sample &sample : samples) {
+    AS::AdaptiveRange::Buffers display = {1.0, 0.5};
+    const bool down = sample.offset >= previousOffset;
+    previousOffset = sample.offset;
+    if (adaptive) {
+      // Once per range update, as ASRangeController does through -prepareForRangeUpdate
+      range.sample(sample.time, sample.offset, kViewport);
+      display = range.adapt(display, kDisplayLatency);
+      range.adapt({2.5, 1.5}, kPreloadLatency);
+    }
+    const double low = sample.offset - (down ? display.trailing : display.leading) * kViewport;
+    const double high = sample.offset + kViewport + (down ? display.leading : display.trailing) * kViewport;
+    screenfuls += (high - low) / kViewport;
+
+    const int firstRow = std::max(0, (int)(low / rowHeight)), lastRow = (int)(high / rowHeight);
+    for (int row = std::max(0, firstRow - 400); row < lastRow + 400 && row < (int)enteredAt.size(); row++) {
+      if (row < firstRow || row > lastRow) {
+        enteredAt[row] = -1;
+      } else if (enteredAt[row] < 0) {
+        enteredAt[row] = sample.time;
+      }
+    }
+    for (int row = (int)(sample.offset / rowHeight); row <= (int)((sample.offset + kViewport) / rowHeight); row++) {
+      visibleRowFrames++;
+      if (enteredAt[row] < 0 || sample.time - enteredAt[row] < kDisplayLatency) {
+        blankRowFrames++;
+      }
+    }
+  }
+  return {100.0 * blankRowFrames / visibleRowFrames, screenfuls / samples.size()};
+}
+
+} // namespace
+
+int main()
+{
+  checkModel();
+
+  const ReplayResult fixed = replay(false), adaptive = replay(true);
+  std::printf("static   (1.0/0.5): %.2f%% blank row-frames, %.2f screenfuls mean\n", fixed.blankPercent, fixed.meanScreenfuls);
+  std::printf("adaptive:           %.2f%% blank row-frames, %.2f screenfuls mean\n", adaptive.blankPercent, adaptive.meanScreenfuls);
+  expect(adaptive.blankPercent < fixed.blankPercent, "adaptive ranges leave fewer blank rows");
+  expect(adaptive.meanScreenfuls < fixed.meanScreenfuls * 1.1, "adaptive ranges stay about as large on average");
+
+  if (failures > 0) {
+    return EXIT_FAILURE;
+  }
+  std::printf("OK\n");
+  return EXIT_SUCCESS;
+}
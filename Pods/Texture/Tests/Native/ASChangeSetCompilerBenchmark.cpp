@@ -0,0 +1,395 @@
+//
+//  ASChangeSetCompilerBenchmark.cpp
+//  Texture
+//
+//  Copyright (c) Pinterest, Inc.  All rights reserved.
+//  Licensed under Apache 2.0: http://www.apache.org/licenses/LICENSE-2.0
+//
+
+// Checks AS::ChangeSetCompiler on random chains of batch updates: applying the composed change set with UIKit batch
+// update semantics must give the same data as applying the chain one update at a time. Then times coalescing a burst
+// of updates, folded pairwise and with composeAll().
+//
+//   g++ -std=c++14 -O2 -Wno-unknown-pragmas -I../../Source/Private ASChangeSetCompilerBenchmark.cpp -o change_set_benchmark && ./change_set_benchmark
+
+#include "ASChangeSetCompiler.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <set>
+#include <vector>
+
+namespace {
+
+typedef AS::ChangeSetCompiler Compiler;
+typedef Compiler::ChangeSet ChangeSet;
+typedef Compiler::Index Index;
+
+int failures = 0;
+long nextItemId = 0;
+
+/** An item of the data: an id that survives updates, or -1 for one inserted since the start */
+struct Item {
+  long id;
+  bool reloaded;
+
+  bool operator==(const Item &other) const { return id == other.id && (id < 0 || reloaded == other.reloaded); }
+};
+
+/** A section; a fresh one (inserted or reloaded since the start) only has a count that matters */
+struct Section {
+  bool fresh;
+  std::vector<Item> items;
+};
+
+typedef std::vector<Section> Data;
+
+std::vector<Index> countsOf(const Data &data)
+{
+  std::vector<Index> counts;
+  for (const Section &section : data) {
+    counts.push_back((Index)section.items.size());
+  }
+  return counts;
+}
+
+bool same(const Data &a, const Data &b)
+{
+  if (a.size() != b.size()) {
+    return false;
+  }
+  for (std::size_t s = 0; s < a.size(); s++) {
+    if (a[s].fresh != b[s].fresh || a[s].items.size() != b[s].items.size()) {
+      return false;
+    }
+    if (!a[s].fresh && a[s].items != b[s].items) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/** Applies a change set the way UITableView and UICollectionView do. Returns false if it is inconsistent. */
+bool apply(const Data &data, const ChangeSet &changeSet, Data *result)
+{
+  std::set<Index> deletedSections, reloadedSections, insertedSections;
+  for (const auto &c : changeSet.deletedSections) {
+    deletedSections.insert(c.section);
+  }
+  for (const auto &c : changeSet.reloadedSections) {
+    reloadedSections.insert(c.section);
+  }
+  for (const auto &c : changeSet.insertedSections) {
+    insertedSections.insert(c.section);
+  }
+
+  // Deletes and reloads use indexes before the update
+  std::vector<Section> survivors;
+  for (Index s = 0; s < (Index)data.size(); s++) {
+    if (deletedSections.count(s)) {
+      continue;
+    }
+    Section section = data[s];
+    if (reloadedSections.count(s)) {
+      section = {true, {}};
+    } else {
+      std::set<Index> deletedItems, reloadedItems;
+      for (const auto &c : changeSet.deletedItems) {
+        if (c.section == s) {
+          deletedItems.insert(c.item);
+        }
+      }
+      for (const auto &c : changeSet.reloadedItems) {
+        if (c.section == s) {
+          reloadedItems.insert(c.item);
+        }
+      }
+      std::vector<Item> items;
+      for (Index i = 0; i < (Index)section.items.size(); i++) {
+        if (!deletedItems.count(i)) {
+          items.push_back(section.items[i]);
+          items.back().reloaded = items.back().reloaded || reloadedItems.count(i) > 0;
+        }
+      }
+      section.items = items;
+    }
+    survivors.push_back(section);
+  }
+
+  // Inserts use indexes after it
+  result->clear();
+  std::size_t next = 0;
+  for (Index n = 0; n < (Index)changeSet.newCounts.size(); n++) {
+    const Index count = changeSet.newCounts[n];
+    if (insertedSections.count(n)) {
+      result->push_back({true, std::vector<Item>(count, Item{-1, false})});
+      continue;
+    }
+    if (next == survivors.size()) {
+      return false;
+    }
+    Section section = survivors[next++];
+    if (section.fresh) {
+      section.items.assign(count, Item{-1, false});
+    } else {
+      std::set<Index> insertedItems;
+      for (const auto &c : changeSet.insertedItems) {
+        if (c.section == n) {
+          insertedItems.insert(c.item);
+        }
+      }
+      std::vector<Item> items;
+      std::size_t kept = 0;
+      for (Index i = 0; i < count; i++) {
+        if (insertedItems.count(i)) {
+          items.push_back({-1, false});
+        } else if (kept < section.items.size()) {
+          items.push_back(section.items[kept++]);
+        } else {
+          return false;
+        }
+      }
+      if (kept != section.items.size()) {
+        return false;
+      }
+      section.items = items;
+    }
+    result->push_back(section);
+  }
+  return next == survivors.size();
+}
+
+Compiler::Options randomOptions(std::mt19937 &random)
+{
+  return random() % 3;
+}
+
+/** A random, consistent batch update of `data`, with section and item deletes, inserts and reloads */
+ChangeSet randomChangeSet(const Data &data, std::mt19937 &random)
+{
+  enum Fate { Keep, Delete, Reload };
+  ChangeSet changeSet;
+  changeSet.oldCounts = countsOf(data);
+
+  const Index oldCount = (Index)data.size();
+  std::vector<Fate> fates(oldCount, Keep);
+  std::vector<Index> survivors;
+  for (Index s = 0; s < oldCount; s++) {
+    switch (random() % 10) {
+      case 0:
+        fates[s] = Delete;
+        changeSet.deletedSections.push_back({s, randomOptions(random)});
+        continue;
+      case 1:
+        fates[s] = Reload;
+        changeSet.reloadedSections.push_back({s, randomOptions(random)});
+        break;
+      default:
+        break;
+    }
+    survivors.push_back(s);
+  }
+
+  // kNotFound marks an inserted section, otherwise the old index
+  std::vector<Index> newSections(survivors);
+  for (int k = random() % 3; k > 0; k--) {
+    newSections.insert(newSections.begin() + random() % (newSections.size() + 1), Compiler::kNotFound);
+  }
+
+  changeSet.newCounts.assign(newSections.size(), 0);
+  for (Index n = 0; n < (Index)newSections.size(); n++) {
+    const Index s = newSections[n];
+    if (s == Compiler::kNotFound) {
+      changeSet.insertedSections.push_back({n, randomOptions(random)});
+      changeSet.newCounts[n] = random() % 5;
+      continue;
+    }
+    if (fates[s] == Reload) {
+      changeSet.newCounts[n] = random() % 6;
+      continue;
+    }
+
+    Index count = (Index)data[s].items.size();
+    std::vector<bool> inserted;
+    for (Index i = 0; i < (Index)data[s].items.size(); i++) {
+      switch (random() % 8) {
+        case 0:
+          changeSet.deletedItems.push_back({s, i, randomOptions(random)});
+          count--;
+          continue;
+        case 1:
+          changeSet.reloadedItems.push_back({s, i, randomOptions(random)});
+          break;
+        default:
+          break;
+      }
+      inserted.push_back(false);
+    }
+    for (int k = random() % 4; k > 0; k--) {
+      inserted.insert(inserted.begin() + random() % (inserted.size() + 1), true);
+      count++;
+    }
+    for (Index i = 0; i < count; i++) {
+      if (inserted[i]) {
+        changeSet.insertedItems.push_back({n, i, randomOptions(random)});
+      }
+    }
+    changeSet.newCounts[n] = count;
+  }
+  changeSet.normalize();
+  return changeSet;
+}
+
+void fuzz()
+{
+  std::mt19937 random(7);
+  for (int iteration = 0; iteration < 20000; iteration++) {
+    Data data;
+    for (int s = random() % 6; s > 0; s--) {
+      Section section = {false, {}};
+      for (int i = random() % 8; i > 0; i--) {
+        section.items.push_back({nextItemId++, false});
+      }
+      data.push_back(section);
+    }
+
+    std::vector<ChangeSet> chain;
+    Data sequential = data;
+    ChangeSet folded;
+    for (int length = 2 + random() % 4; length > 0; length--) {
+      ChangeSet changeSet = randomChangeSet(sequential, random);
+      Data next;
+      if (!apply(sequential, changeSet, &next)) {
+        std::printf("FAILED: generated an inconsistent update in iteration %d\n", iteration);
+        failures++;
+        return;
+      }
+      sequential = next;
+      folded = chain.empty() ? changeSet : Compiler::compose(folded, changeSet);
+      chain.push_back(changeSet);
+    }
+
+    Data viaFolded, viaComposeAll;
+    if (!apply(data, folded, &viaFolded) || !same(viaFolded, sequential)) {
+      std::printf("FAILED: compose() of iteration %d differs from applying the updates in turn\n", iteration);
+      failures++;
+      return;
+    }
+    if (!apply(data, Compiler::composeAll(chain), &viaComposeAll) || !same(viaComposeAll, sequential)) {
+      std::printf("FAILED: composeAll() of iteration %d differs from applying the updates in turn\n", iteration);
+      failures++;
+      return;
+    }
+  }
+  std::printf("fuzz: 20000 random update chains compose correctly\n");
+}
+
+double microsecondsSince(std::chrono::steady_clock::time_point start)
+{
+  return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+}
+
+void benchmark()
+{
+  // 100 sections of 500 items, then a burst of 200 updates that each delete, reload and insert 5 items
+  std::mt19937 random(8);
+  Data data;
+  for (int s = 0; s < 100; s++) {
+    Section section = {false, {}};
+    for (int i = 0; i < 500; i++) {
+      section.items.push_back({nextItemId++, false});
+    }
+    data.push_back(section);
+  }
+
+  std::vector<ChangeSet> burst;
+  Data sequential = data;
+  for (int update = 0; update < 200; update++) {
+    ChangeSet changeSet;
+    changeSet.oldCounts = countsOf(sequential);
+    changeSet.newCounts = changeSet.oldCounts;
+    std::set<std::pair<Index, Index>> deleted;
+    for (int k = 0; k < 5; k++) {
+      const Index s = random() % 100, i = random() % changeSet.oldCounts[s];
+      if (deleted.insert({s, i}).second) {
+        changeSet.deletedItems.push_back({s, i, 0});
+        changeSet.newCounts[s]--;
+      }
+    }
+    for (int k = 0; k < 5; k++) {
+      const Index s = random() % 100, i = random() % changeSet.oldCounts[s];
+      if (!deleted.count({s, i})) {
+        changeSet.reloadedItems.push_back({s, i, 0});
+      }
+    }
+    for (int k = 0; k < 5; k++) {
+      const Index s = random() % 100, at = random() % (changeSet.newCounts[s] + 1);
+      for (auto &c : changeSet.insertedItems) {
+        if (c.section == s && c.item >= at) {
+          c.item++;
+        }
+      }
+      changeSet.insertedItems.push_back({s, at, 0});
+      changeSet.newCounts[s]++;
+    }
+    changeSet.normalize();
+    Data next;
+    if (!apply(sequential, changeSet, &next)) {
+      std::printf("FAILED: generated an inconsistent burst update\n");
+      failures++;
+      return;
+    }
+    sequential = next;
+    burst.push_back(changeSet);
+  }
+
+  const int repeats = 20;
+  ChangeSet folded;
+  auto start = std::chrono::steady_clock::now();
+  for (int r = 0; r < repeats; r++) {
+    folded = burst[0];
+    for (std::size_t u = 1; u < burst.size(); u++) {
+      folded = Compiler::compose(folded, burst[u]);
+    }
+  }
+  const double foldTime = microsecondsSince(start) / repeats;
+
+  ChangeSet merged;
+  start = std::chrono::steady_clock::now();
+  for (int r = 0; r < repeats; r++) {
+    merged = Compiler::composeAll(burst);
+  }
+  const double composeAllTime = microsecondsSince(start) / repeats;
+
+  Data viaFolded, viaMerged;
+  if (!apply(data, folded, &viaFolded) || !same(viaFolded, sequential) || !apply(data, merged, &viaMerged) || !same(viaMerged, sequential)) {
+    std::printf("FAILED: the merged burst differs from applying the updates in turn\n");
+    failures++;
+  }
+
+  std::printf("200 updates of 100x500 items: pairwise fold %.0fus, composeAll %.0fus\n", foldTime, composeAllTime);
+  std::printf("merged into %zu deletes, %zu inserts, %zu reloads\n", merged.deletedItems.size(), merged.insertedItems.size(), merged.reloadedItems.size());
+  for (std::size_t n : {2, 8, 32}) {
+    const std::vector<ChangeSet> prefix(burst.begin(), burst.begin() + n);
+    start = std::chrono::steady_clock::now();
+    for (int r = 0; r < 200; r++) {
+      merged = Compiler::composeAll(prefix);
+    }
+    std::printf("composeAll of %zu updates: %.1fus\n", n, microsecondsSince(start) / 200);
+  }
+}
+
+} // namespace
+
+int main()
+{
+  fuzz();
+  benchmark();
+  if (failures > 0) {
+    return EXIT_FAILURE;
+  }
+  std::printf("OK\n");
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,213 @@
+//
+//  ASDiffBenchmark.cpp
+//  Texture
+//
+//  Copyright (c) Pinterest, Inc.  All rights reserved.
+//  Licensed under Apache 2.0: http://www.apache.org/licenses/LICENSE-2.0
+//
+
+// Checks AS::Diff against the dynamic-programming LCS that NSArray+Diffing used before, on random sequences, then times
+// both on list-sized updates.
+//
+//   g++ -std=c++14 -O2 -I../../Source/Private ASDiffBenchmark.cpp -o diff_benchmark && ./diff_benchmark
+
+#include "ASDiff.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+namespace {
+
+int failures = 0;
+
+// The old algorithm: an (n + 1) x (m + 1) length matrix, one malloc per row, then a backtrack. Returns the LCS pairs in
+// increasing order.
+std::vector<std::pair<std::size_t, std::size_t>> dynamicProgrammingLCS(const std::vector<int> &a, const std::vector<int> &b, std::size_t *comparisons)
+{
+  const std::size_t n = a.size(), m = b.size();
+  std::vector<long *> lengths(n + 1);
+  for (std::size_t i = 0; i <= n; i++) {
+    lengths[i] = (long *)std::malloc(sizeof(long) * (m + 1));
+    for (std::size_t j = 0; j <= m; j++) {
+      if (i == 0 || j == 0) {
+        lengths[i][j] = 0;
+      } else if (++*comparisons, a[i - 1] == b[j - 1]) {
+        lengths[i][j] = 1 + lengths[i - 1][j - 1];
+      } else {
+        lengths[i][j] = std::max(lengths[i - 1][j], lengths[i][j - 1]);
+      }
+    }
+  }
+  std::vector<std::pair<std::size_t, std::size_t>> common;
+  std::size_t i = n, j = m;
+  while (i > 0 && j > 0) {
+    if (a[i - 1] == b[j - 1]) {
+      common.push_back({i - 1, j - 1});
+      i--;
+      j--;
+    } else if (lengths[i - 1][j] > lengths[i][j - 1]) {
+      i--;
+    } else {
+      j--;
+    }
+  }
+  for (long *row : lengths) {
+    std::free(row);
+  }
+  std::reverse(common.begin(), common.end());
+  return common;
+}
+
+std::vector<std::pair<std::size_t, std::size_t>> myersLCS(const std::vector<int> &a, const std::vector<int> &b, std::size_t *comparisons)
+{
+  std::vector<std::pair<std::size_t, std::size_t>> common;
+  AS::Diff::longestCommonSubsequence(a.size(), b.size(),
+                                     [&](std::size_t i, std::size_t j) { ++*comparisons; return a[i] == b[j]; },
+                                     [&](std::size_t i, std::size_t j) { common.push_back({i, j}); });
+  return common;
+}
+
+void fuzz()
+{
+  std::mt19937 random(1);
+  for (int iteration = 0; iteration < 200000; iteration++) {
+    std::vector<int> a(random() % 12), b(random() % 12);
+    const int alphabet = 1 + random() % 5;
+    for (int &x : a) {
+      x = random() % alphabet;
+    }
+    for (int &x : b) {
+      x = random() % alphabet;
+    }
+
+    std::size_t comparisons = 0;
+    const auto expected = dynamicProgrammingLCS(a, b, &comparisons);
+    const auto common = myersLCS(a, b, &comparisons);
+    bool valid = common.size() == expected.size();
+    for (std::size_t k = 0; valid && k < common.size(); k++) {
+      valid = a[common[k].first] == b[common[k].second] &&
+              (k == 0 || (common[k].first > common[k - 1].first && common[k].second > common[k - 1].second));
+    }
+    if (!valid) {
+      std::printf("FAILED: LCS of iteration %d has %zu pairs, expected %zu\n", iteration, common.size(), expected.size());
+      failures++;
+      return;
+    }
+
+    // The k-th occurrence of a symbol in the new sequence pairs with its k-th occurrence in the old one
+    const std::vector<uint32_t> oldSymbols(a.begin(), a.end()), newSymbols(b.begin(), b.end());
+    const auto oldForNew = AS::Diff::matchSymbols(oldSymbols, newSymbols, alphabet);
+    std::vector<int> newSeen(alphabet, 0);
+    for (std::size_t j = 0; j < b.size(); j++) {
+      const int occurrence = newSeen[b[j]]++;
+      std::size_t expectedOld = AS::Diff::kNotFound;
+      for (std::size_t i = 0, seen = 0; i < a.size(); i++) {
+        if (a[i] == b[j] && (int)seen++ == occurrence) {
+          expectedOld = i;
+          break;
+        }
+      }
+      if (oldForNew[j] != expectedOld) {
+        std::printf("FAILED: matchSymbols of iteration %d paired new %zu wrongly\n", iteration, j);
+        failures++;
+        return;
+      }
+    }
+  }
+  std::printf("fuzz: 200000 random sequences match the dynamic-programming LCS\n");
+}
+
+// A list of `count` distinct items after `edits` random deletes, inserts and moves
+void listUpdate(std::size_t count, std::size_t edits, std::mt19937 &random, std::vector<int> *before, std::vector<int> *after)
+{
+  before->resize(count);
+  for (std::size_t i = 0; i < count; i++) {
+    (*before)[i] = (int)i;
+  }
+  *after = *before;
+  int next = (int)count;
+  for (std::size_t e = 0; e < edits && !after->empty(); e++) {
+    const std::size_t at = random() % after->size();
+    switch (random() % 3) {
+      case 0:
+        after->erase(after->begin() + at);
+        break;
+      case 1:
+        after->insert(after->begin() + at, next++);
+        break;
+      default: {
+        const int moved = (*after)[at];
+        after->erase(after->begin() + at);
+        after->insert(after->begin() + random() % (after->size() + 1), moved);
+        break;
+      }
+    }
+  }
+}
+
+template <typename F>
+double microseconds(int repeats, F &&work)
+{
+  const auto start = std::chrono::steady_clock::now();
+  for (int r = 0; r < repeats; r++) {
+    work();
+  }
+  return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() / repeats;
+}
+
+void benchmark()
+{
+  std::mt19937 random(2);
+  std::printf("%8s %6s %14s %14s %14s %14s %12s\n", "items", "edits", "DP us", "Myers us", "DP compares", "Myers compares", "Heckel us");
+  const std::size_t counts[] = {100, 1000, 4000, 50000};
+  for (std::size_t count : counts) {
+    for (std::size_t edits : {count / 100 + 1, count / 10}) {
+      std::vector<int> before, after;
+      listUpdate(count, edits, random, &before, &after);
+      const int repeats = count <= 1000 ? 50 : 3;
+
+      std::size_t dpComparisons = 0, myersComparisons = 0;
+      double dp = -1;
+      if (count <= 4000) {
+        dp = microseconds(repeats, [&] { dpComparisons = 0; dynamicProgrammingLCS(before, after, &dpComparisons); });
+      }
+      std::size_t myersLength = 0;
+      const double myers = microseconds(repeats, [&] { myersComparisons = 0; myersLength = myersLCS(before, after, &myersComparisons).size(); });
+      if (count <= 4000) {
+        std::size_t ignored = 0;
+        if (dynamicProgrammingLCS(before, after, &ignored).size() != myersLength) {
+          std::printf("FAILED: LCS lengths differ for %zu items\n", count);
+          failures++;
+        }
+      }
+
+      // Items are their own dense symbols here
+      const std::vector<uint32_t> oldSymbols(before.begin(), before.end()), newSymbols(after.begin(), after.end());
+      const std::size_t symbolCount = count + edits + 1;
+      const double heckel = microseconds(repeats, [&] { AS::Diff::matchSymbols(oldSymbols, newSymbols, symbolCount); });
+
+      if (dp >= 0) {
+        std::printf("%8zu %6zu %14.1f %14.1f %14zu %14zu %12.1f\n", count, edits, dp, myers, dpComparisons, myersComparisons, heckel);
+      } else {
+        std::printf("%8zu %6zu %14s %14.1f %14s %14zu %12.1f\n", count, edits, "-", myers, "-", myersComparisons, heckel);
+      }
+    }
+  }
+}
+
+} // namespace
+
+int main()
+{
+  fuzz();
+  benchmark();
+  if (failures > 0) {
+    return EXIT_FAILURE;
+  }
+  std::printf("OK\n");
+  return EXIT_SUCCESS;
+}
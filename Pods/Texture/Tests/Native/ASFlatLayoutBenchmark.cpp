@@ -0,0 +1,155 @@
+//
+//  ASFlatLayoutBenchmark.cpp
+//  Texture
+//
+//  Copyright (c) Pinterest, Inc.  All rights reserved.
+//  Licensed under Apache 2.0: http://www.apache.org/licenses/LICENSE-2.0
+//
+
+// Checks AS::FlatLayout's element lookup against a linear scan, then times what -_layoutSublayouts does for a layout
+// with n sublayouts: one -frameForElement: per sublayout, as a scan of heap-allocated sublayouts versus building the
+// lookup table once and looking each element up in it. The crossover is what ASLayoutFlatLookupThreshold is set from.
+//
+//   g++ -std=c++14 -O2 -Wno-unknown-pragmas -I../../Source/Private/Layout ASFlatLayoutBenchmark.cpp -o flat_layout_benchmark && ./flat_layout_benchmark
+
+#include "ASFlatLayout.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace {
+
+typedef AS::FlatLayout::Rect Rect;
+
+int failures = 0;
+
+/** Stands in for an ASLayout: a heap object per sublayout */
+struct Sublayout {
+  const void *element;
+  Rect frame;
+};
+
+std::vector<std::unique_ptr<Sublayout>> makeSublayouts(std::mt19937 &random, uint32_t count, const std::vector<int> &elements)
+{
+  std::vector<std::unique_ptr<Sublayout>> sublayouts;
+  for (uint32_t i = 0; i < count; i++) {
+    const Rect frame = {double(random() % 1000), double(random() % 1000), double(random() % 100), double(random() % 100)};
+    sublayouts.emplace_back(new Sublayout{&elements[random() % elements.size()], frame});
+  }
+  return sublayouts;
+}
+
+AS::FlatLayout makeFlatLayout(const std::vector<std::unique_ptr<Sublayout>> &sublayouts)
+{
+  AS::FlatLayout flatLayout;
+  flatLayout.reserve(sublayouts.size());
+  for (const auto &sublayout : sublayouts) {
+    flatLayout.append(sublayout->element, sublayout->frame);
+  }
+  flatLayout.finalize();
+  return flatLayout;
+}
+
+/** -frameForElement:'s scan: the first sublayout of the element */
+const Sublayout *scan(const std::vector<std::unique_ptr<Sublayout>> &sublayouts, const void *element)
+{
+  for (const auto &sublayout : sublayouts) {
+    if (sublayout->element == element) {
+      return sublayout.get();
+    }
+  }
+  return nullptr;
+}
+
+void fuzz()
+{
+  std::mt19937 random(1);
+  for (int iteration = 0; iteration < 5000; iteration++) {
+    // Few distinct elements, so some repeat and some are missing
+    const std::vector<int> elements(1 + random() % 100);
+    const auto sublayouts = makeSublayouts(random, random() % 80, elements);
+    const AS::FlatLayout flatLayout = makeFlatLayout(sublayouts);
+
+    if (flatLayout.count() != sublayouts.size()) {
+      std::printf("FAILED: count %u, expected %zu\n", flatLayout.count(), sublayouts.size());
+      failures++;
+    }
+    for (const int &element : elements) {
+      const Sublayout *expected = scan(sublayouts, &element);
+      const uint32_t index = flatLayout.indexOfElement(&element);
+      const bool matches = expected == nullptr
+        ? index == AS::FlatLayout::kNotFound
+        : index != AS::FlatLayout::kNotFound && sublayouts[index].get() == expected
+          && flatLayout.frame(index).x == expected->frame.x && flatLayout.frame(index).height == expected->frame.height;
+      if (!matches) {
+        std::printf("FAILED: iteration %d, element %td: index %u\n", iteration, &element - elements.data(), index);
+        failures++;
+      }
+    }
+  }
+}
+
+double microsecondsSince(std::chrono::steady_clock::time_point start, int repetitions)
+{
+  return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() / repetitions;
+}
+
+void benchmark()
+{
+  std::printf("%10s %12s %12s\n", "sublayouts", "scan", "flat");
+  for (uint32_t count : {4, 8, 16, 32, 64, 256, 1024, 4096}) {
+    std::mt19937 random(count);
+    std::vector<int> elements(count);
+    std::vector<std::unique_ptr<Sublayout>> sublayouts;
+    for (uint32_t i = 0; i < count; i++) {
+      sublayouts.emplace_back(new Sublayout{&elements[i], {double(i), 0, 1, 1}});
+    }
+    // Scattered across the heap like ASLayouts built over time
+    std::shuffle(sublayouts.begin(), sublayouts.end(), random);
+    std::vector<const void *> lookups;
+    for (const auto &sublayout : sublayouts) {
+      lookups.push_back(sublayout->element);
+    }
+    std::shuffle(sublayouts.begin(), sublayouts.end(), random);
+
+    const int repetitions = std::max(1, 200000 / int(count * std::max(1u, count / 64)));
+    double sum = 0;
+
+    auto start = std::chrono::steady_clock::now();
+    for (int r = 0; r < repetitions; r++) {
+      for (const void *element : lookups) {
+        sum += scan(sublayouts, element)->frame.x;
+      }
+    }
+    const double scanTime = microsecondsSince(start, repetitions);
+
+    start = std::chrono::steady_clock::now();
+    for (int r = 0; r < repetitions; r++) {
+      const AS::FlatLayout flatLayout = makeFlatLayout(sublayouts);
+      for (const void *element : lookups) {
+        sum += flatLayout.frame(flatLayout.indexOfElement(element)).x;
+      }
+    }
+    const double flatTime = microsecondsSince(start, repetitions);
+
+    std::printf("%10u %10.2fus %10.2fus%s\n", count, scanTime, flatTime, sum < 0 ? " " : "");
+  }
+}
+
+} // namespace
+
+int main()
+{
+  fuzz();
+  benchmark();
+  if (failures > 0) {
+    return EXIT_FAILURE;
+  }
+  std::printf("OK\n");
+  return EXIT_SUCCESS;
+}
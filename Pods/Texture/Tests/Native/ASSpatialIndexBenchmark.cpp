@@ -0,0 +1,179 @@
+//
+//  ASSpatialIndexBenchmark.cpp
+//  Texture
+//
+//  Copyright (c) Pinterest, Inc.  All rights reserved.
+//  Licensed under Apache 2.0: http://www.apache.org/licenses/LICENSE-2.0
+//
+
+// Checks AS::SpatialIndex against a linear scan on random rects, then times rect queries against the page table
+// lookup ASCollectionLayoutState did before: items bucketed into viewport-sized pages, every item of a partially
+// covered page retested, and results merged into a set.
+//
+//   g++ -std=c++14 -O2 -Wno-unknown-pragmas -I../../Source/Private/Layout ASSpatialIndexBenchmark.cpp -o spatial_benchmark && ./spatial_benchmark
+
+#include "ASSpatialIndex.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace {
+
+typedef AS::SpatialIndex::Rect Rect;
+
+int failures = 0;
+
+/** CGRectIntersectsRect() for rects with non-negative sizes */
+bool intersects(const Rect &a, const Rect &b)
+{
+  return a.x < b.x + b.width && b.x < a.x + a.width && a.y < b.y + b.height && b.y < a.y + a.height;
+}
+
+void fuzz()
+{
+  std::mt19937 random(1);
+  for (int iteration = 0; iteration < 3000; iteration++) {
+    // Includes empty rects, duplicates and overlaps
+    std::vector<Rect> rects(random() % 300);
+    for (Rect &rect : rects) {
+      rect = {double(random() % 100), double(random() % 100),
+              double(random() % 4 == 0 ? 0 : random() % 20), double(random() % 5 == 0 ? 0 : random() % 20)};
+    }
+    const auto axis = random() % 2 ? AS::SpatialIndex::Vertical : AS::SpatialIndex::Horizontal;
+    const AS::SpatialIndex index(rects.data(), (uint32_t)rects.size(), axis);
+
+    for (int q = 0; q < 20; q++) {
+      const Rect query = {double(random() % 110) - 5, double(random() % 110) - 5, double(random() % 60), double(random() % 60)};
+      std::vector<uint32_t> found;
+      bool ordered = true;
+      long previousEnd = -2;
+      index.query(query, [&](uint32_t begin, uint32_t end) {
+        // Spans are non-empty, ascending and never adjacent
+        ordered = ordered && begin < end && (long)begin > previousEnd;
+        previousEnd = end;
+        for (uint32_t position = begin; position < end; position++) {
+          found.push_back(index.indexAtPosition(position));
+        }
+      });
+
+      std::vector<uint32_t> expected;
+      for (uint32_t i = 0; i < rects.size(); i++) {
+        if (intersects(query, rects[i])) {
+          expected.push_back(i);
+        }
+      }
+      std::sort(found.begin(), found.end());
+      if (!ordered || found != expected) {
+        std::printf("FAILED: query %d of iteration %d found %zu items, expected %zu\n", q, iteration, found.size(), expected.size());
+        failures++;
+        return;
+      }
+    }
+  }
+  std::printf("fuzz: 3000 random rect sets match a linear scan\n");
+}
+
+/** The old lookup: items bucketed into pages of one viewport */
+struct PageTable {
+  double pageHeight;
+  const std::vector<Rect> &rects;
+  std::unordered_map<long, std::vector<uint32_t>> pages;
+
+  PageTable(double pageHeight, const std::vector<Rect> &rects) : pageHeight(pageHeight), rects(rects)
+  {
+    for (uint32_t i = 0; i < rects.size(); i++) {
+      const long first = long(rects[i].y / pageHeight), last = long((rects[i].y + rects[i].height - 1e-9) / pageHeight);
+      for (long page = first; page <= last; page++) {
+        pages[page].push_back(i);
+      }
+    }
+  }
+
+  std::size_t query(const Rect &rect) const
+  {
+    std::unordered_set<uint32_t> result;
+    for (long page = long(rect.y / pageHeight); page <= long((rect.y + rect.height) / pageHeight); page++) {
+      const auto it = pages.find(page);
+      if (it == pages.end()) {
+        continue;
+      }
+      const double pageY = page * pageHeight;
+      const bool covered = rect.y <= pageY && pageY + pageHeight <= rect.y + rect.height;
+      for (uint32_t i : it->second) {
+        if (covered || intersects(rect, rects[i])) {
+          result.insert(i);
+        }
+      }
+    }
+    return result.size();
+  }
+};
+
+double microsecondsSince(std::chrono::steady_clock::time_point start)
+{
+  return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+}
+
+void benchmark()
+{
+  // A three-column vertical grid of 125x100 items, queried with a 375x667 viewport extended by a screen each way
+  const double viewportHeight = 667, queryHeight = 3 * viewportHeight;
+  const int queryCount = 20000;
+  std::printf("%8s %10s %12s %12s\n", "items", "build us", "index us", "pages us");
+  for (int rows : {100, 1000, 10000, 100000}) {
+    std::vector<Rect> rects;
+    for (int row = 0; row < rows; row++) {
+      for (int column = 0; column < 3; column++) {
+        rects.push_back({column * 125.0, row * 100.0, 125, 100});
+      }
+    }
+    const double contentHeight = rows * 100.0;
+    const auto queryAt = [&](int q) -> Rect {
+      return {0, std::fmod(q * 37.0, std::max(1.0, contentHeight - queryHeight)), 375, queryHeight};
+    };
+
+    auto start = std::chrono::steady_clock::now();
+    const AS::SpatialIndex index(rects.data(), (uint32_t)rects.size(), AS::SpatialIndex::Vertical);
+    const double build = microsecondsSince(start);
+    const PageTable pageTable(viewportHeight, rects);
+
+    std::size_t indexHits = 0, pageHits = 0;
+    start = std::chrono::steady_clock::now();
+    for (int q = 0; q < queryCount; q++) {
+      index.query(queryAt(q), [&](uint32_t begin, uint32_t end) { indexHits += end - begin; });
+    }
+    const double indexQuery = microsecondsSince(start) / queryCount;
+
+    start = std::chrono::steady_clock::now();
+    for (int q = 0; q < queryCount; q++) {
+      pageHits += pageTable.query(queryAt(q));
+    }
+    const double pageQuery = microsecondsSince(start) / queryCount;
+
+    if (indexHits != pageHits) {
+      std::printf("FAILED: %zu index hits vs %zu page table hits for %zu items\n", indexHits, pageHits, rects.size());
+      failures++;
+    }
+    std::printf("%8zu %10.0f %12.2f %12.2f\n", rects.size(), build, indexQuery, pageQuery);
+  }
+}
+
+} // namespace
+
+int main()
+{
+  fuzz();
+  benchmark();
+  if (failures > 0) {
+    return EXIT_FAILURE;
+  }
+  std::printf("OK\n");
+  return EXIT_SUCCESS;
+}
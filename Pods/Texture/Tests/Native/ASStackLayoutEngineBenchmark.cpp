@@ -0,0 +1,186 @@
+//
+//  ASStackLayoutEngineBenchmark.cpp
+//  Texture
+//
+//  Copyright (c) Pinterest, Inc.  All rights reserved.
+//  Licensed under Apache 2.0: http://www.apache.org/licenses/LICENSE-2.0
+//
+
+// Drives AS::Stack with synthetic children, off device. Checks a few layouts whose results are known, then times full
+// unpositioned + positioned passes with and without a layout arena.
+//
+//   g++ -std=c++14 -O2 -Wno-unknown-pragmas -I../../Source/Private/Layout ASStackLayoutEngineBenchmark.cpp -o stack_benchmark && ./stack_benchmark
+
+#include "ASStackLayoutEngine.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+using namespace AS::Stack;
+
+namespace {
+
+// Children with a fixed intrinsic size, clamped to the range they're measured in, like a fixed-size node.
+struct IntrinsicMeasurer {
+  std::vector<Size> intrinsicSizes;
+  std::size_t measureCount = 0;
+
+  Measurement measure(std::size_t index, const SizeRange &range, const Size &)
+  {
+    measureCount++;
+    Size size = intrinsicSizes[index];
+    size.width = std::max(range.min.width, std::min(range.max.width, size.width));
+    size.height = std::max(range.min.height, std::min(range.max.height, size.height));
+    return {size, size.height * 0.8, -size.height * 0.2};
+  }
+
+  Measurement placeholder(std::size_t) { return {{0, 0}, 0, 0}; }
+
+  template <typename F>
+  void apply(std::size_t count, F &&work)
+  {
+    for (std::size_t i = 0; i < count; i++) {
+      work(i);
+    }
+  }
+};
+
+ChildStyle childStyle(Float flexGrow, Float flexShrink)
+{
+  return {flexGrow, flexShrink, {DimensionUnit::Auto, 0}, 0, 0, AlignSelf::Auto, {{0, 0}, {INFINITY, INFINITY}}};
+}
+
+Style stackStyle(Direction direction, Float spacing, JustifyContent justify, AlignItems align, FlexWrap wrap)
+{
+  return {direction, spacing, justify, align, wrap, AlignContent::Start, 0, 2};
+}
+
+PositionedLayout layOut(const Vector<ChildStyle> &children, const Style &style, const SizeRange &range, IntrinsicMeasurer &measurer)
+{
+  UnpositionedLayout unpositioned = computeUnpositioned(children, style, range, Size{NAN, NAN}, measurer);
+  return computePositioned(unpositioned, children, style, range);
+}
+
+int failures = 0;
+
+void expect(bool condition, const char *description)
+{
+  if (!condition) {
+    std::printf("FAILED: %s\n", description);
+    failures++;
+  }
+}
+
+void checkKnownLayouts()
+{
+  AS::ArenaScope scope;
+
+  // A horizontal row where the middle child grows into the space the others leave
+  {
+    Vector<ChildStyle> children;
+    IntrinsicMeasurer measurer;
+    for (int i = 0; i < 3; i++) {
+      children.push_back(childStyle(i == 1 ? 1 : 0, 0));
+      measurer.intrinsicSizes.push_back({50, 20});
+    }
+    PositionedLayout layout = layOut(children, stackStyle(Direction::Horizontal, 10, JustifyContent::Start, AlignItems::Start, FlexWrap::NoWrap),
+                                     {{300, 0}, {300, INFINITY}}, measurer);
+    expect(layout.items.size() == 3, "row keeps every child");
+    expect(layout.items[1].measurement.size.width == 180, "flex grow fills the remaining width");
+    expect(layout.items[2].position.x == 250, "last child is pushed to the end");
+    expect(layout.size.width == 300 && layout.size.height == 20, "row size");
+  }
+
+  // Children that overflow a column shrink in proportion to their size
+  {
+    Vector<ChildStyle> children;
+    IntrinsicMeasurer measurer;
+    children.push_back(childStyle(0, 1));
+    children.push_back(childStyle(0, 1));
+    measurer.intrinsicSizes = {{10, 100}, {10, 300}};
+    PositionedLayout layout = layOut(children, stackStyle(Direction::Vertical, 0, JustifyContent::Start, AlignItems::Start, FlexWrap::NoWrap),
+                                     {{0, 0}, {INFINITY, 200}}, measurer);
+    expect(layout.items[0].measurement.size.height == 50 && layout.items[1].measurement.size.height == 150, "flex shrink is proportional");
+  }
+
+  // Wrapping 7 children of 40pt into exactly 150pt gives lines of 3, 3 and 1, each centered in the stack
+  {
+    Vector<ChildStyle> children;
+    IntrinsicMeasurer measurer;
+    for (int i = 0; i < 7; i++) {
+      children.push_back(childStyle(0, 0));
+      measurer.intrinsicSizes.push_back({40, 20});
+    }
+    PositionedLayout layout = layOut(children, stackStyle(Direction::Horizontal, 5, JustifyContent::Center, AlignItems::Start, FlexWrap::Wrap),
+                                     {{150, 0}, {150, INFINITY}}, measurer);
+    expect(layout.items[3].position.y == 20 && layout.items[6].position.y == 40, "wrapped lines stack vertically");
+    expect(layout.items[0].position.x == 10 && layout.items[6].position.x == 55, "lines are centered");
+    expect(layout.size.height == 60, "wrapped stack height");
+  }
+}
+
+struct Case {
+  const char *name;
+  Style style;
+  SizeRange range;
+  int childCount;
+  Float flexGrow;
+  Float flexShrink;
+};
+
+void benchmark()
+{
+  const Case cases[] = {
+    {"row of 5, one flexible", stackStyle(Direction::Horizontal, 8, JustifyContent::Start, AlignItems::Center, FlexWrap::NoWrap), {{375, 0}, {375, INFINITY}}, 5, 1, 0},
+    {"column of 20, all shrinking", stackStyle(Direction::Vertical, 4, JustifyContent::Start, AlignItems::Stretch, FlexWrap::NoWrap), {{0, 0}, {375, 600}}, 20, 0, 1},
+    {"baseline row of 8", stackStyle(Direction::Horizontal, 4, JustifyContent::SpaceBetween, AlignItems::BaselineFirst, FlexWrap::NoWrap), {{375, 0}, {375, INFINITY}}, 8, 0, 1},
+    {"wrapping grid of 100", stackStyle(Direction::Horizontal, 4, JustifyContent::Start, AlignItems::Start, FlexWrap::Wrap), {{0, 0}, {375, INFINITY}}, 100, 0, 0},
+  };
+
+  std::printf("%-30s %12s %12s %16s\n", "case", "heap us", "arena us", "heap allocs/pass");
+  for (const Case &c : cases) {
+    Vector<ChildStyle> children;
+    IntrinsicMeasurer measurer;
+    for (int i = 0; i < c.childCount; i++) {
+      children.push_back(childStyle(i % 5 == 2 ? c.flexGrow : 0, c.flexShrink));
+      measurer.intrinsicSizes.push_back({Float(30 + (i * 37) % 50), Float(20 + (i * 11) % 24)});
+    }
+
+    const int passes = 20000;
+    double microseconds[2];
+    uint64_t heapAllocations = 0;
+    for (int arena = 0; arena < 2; arena++) {
+      AS::ArenaStatisticsReset();
+      const auto start = std::chrono::steady_clock::now();
+      Float checksum = 0;
+      for (int pass = 0; pass < passes; pass++) {
+        AS::ArenaScope scope(arena == 1);
+        checksum += layOut(children, c.style, c.range, measurer).size.height;
+      }
+      microseconds[arena] = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() / passes;
+      if (arena == 0) {
+        heapAllocations = AS::ArenaStatisticsGet().heapAllocations / passes;
+      }
+      if (checksum <= 0) {
+        std::printf("FAILED: %s laid out empty\n", c.name);
+        failures++;
+      }
+    }
+    std::printf("%-30s %12.2f %12.2f %16llu\n", c.name, microseconds[0], microseconds[1], (unsigned long long)heapAllocations);
+  }
+}
+
+} // namespace
+
+int main()
+{
+  checkKnownLayouts();
+  benchmark();
+  if (failures > 0) {
+    return EXIT_FAILURE;
+  }
+  std::printf("OK\n");
+  return EXIT_SUCCESS;
+}
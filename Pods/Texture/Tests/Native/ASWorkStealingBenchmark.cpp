@@ -0,0 +1,188 @@
+//
+//  ASWorkStealingBenchmark.cpp
+//  Texture
+//
+//  Copyright (c) Pinterest, Inc.  All rights reserved.
+//  Licensed under Apache 2.0: http://www.apache.org/licenses/LICENSE-2.0
+//
+
+// Stresses AS::WorkStealingRange with threads racing to take chunks off their own slices and to steal from each other:
+// random counts and worker counts, workers that start late or never, and iterations that yield mid-loop so steals land
+// while owners are taking. Every index must run exactly once, and the completion count must reach the iteration count
+// once all started workers return. Then times ASDispatchApply's old shared counter against work stealing, with 2 x CPU
+// threads like ASDispatchApply starts. Run it under TSan too (-fsanitize=thread).
+//
+//   g++ -std=c++14 -O2 -pthread -Wno-unknown-pragmas -I../../Source/Private ASWorkStealingBenchmark.cpp -o work_stealing_benchmark && ./work_stealing_benchmark
+
+#include "ASWorkStealing.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <random>
+#include <thread>
+#include <vector>
+
+namespace {
+
+int failures = 0;
+
+void stress()
+{
+  std::mt19937 random(1);
+  for (int iteration = 0; iteration < 3000; iteration++) {
+    // Mostly small counts, where steals of single indexes race the most, and some large ones
+    const std::size_t count = random() % 10 == 0 ? random() % 200000 : random() % 2000;
+    const unsigned workerCount = 1 + random() % 24;
+    // Some workers never start: their slices have to be stolen
+    const unsigned startedCount = 1 + random() % workerCount;
+    const bool yields = random() % 4 == 0;
+    const unsigned yieldMask = (1u << (random() % 6)) - 1;
+
+    std::unique_ptr<std::atomic<uint8_t>[]> runs(new std::atomic<uint8_t>[count]);
+    for (std::size_t i = 0; i < count; i++) {
+      runs[i].store(0, std::memory_order_relaxed);
+    }
+    std::atomic<std::size_t> completed(0);
+    AS::WorkStealingRange range(count, workerCount);
+
+    auto work = [&](unsigned worker) {
+      range.run(worker, [&](std::size_t i) {
+        runs[i].fetch_add(1, std::memory_order_relaxed);
+        if (yields && (i & yieldMask) == 0) {
+          std::this_thread::yield();
+        }
+        completed.fetch_add(1, std::memory_order_relaxed);
+      });
+    };
+
+    // Start the workers in a random order; the last one only once the others are done, so it finds nothing left
+    std::vector<unsigned> workers(workerCount);
+    for (unsigned w = 0; w < workerCount; w++) {
+      workers[w] = w;
+    }
+    std::shuffle(workers.begin(), workers.end(), random);
+    std::vector<std::thread> threads;
+    for (unsigned n = 0; n + 1 < startedCount; n++) {
+      threads.emplace_back(work, workers[n]);
+    }
+    const bool lastStartsLate = startedCount > 1 && random() % 2 == 0;
+    if (!lastStartsLate) {
+      threads.emplace_back(work, workers[startedCount - 1]);
+    }
+    for (std::thread &thread : threads) {
+      thread.join();
+    }
+    if (lastStartsLate) {
+      const std::size_t before = completed.load();
+      work(workers[startedCount - 1]);
+      if (completed.load() != before) {
+        std::printf("FAILED: iteration %d: a worker started after the others returned ran %zu indexes\n", iteration, completed.load() - before);
+        failures++;
+      }
+    }
+
+    if (completed.load() != count) {
+      std::printf("FAILED: iteration %d: %zu of %zu indexes ran (%u of %u workers started)\n", iteration, completed.load(), count, startedCount, workerCount);
+      failures++;
+    }
+    for (std::size_t i = 0; i < count; i++) {
+      if (runs[i].load() != 1) {
+        std::printf("FAILED: iteration %d: index %zu of %zu ran %d times (%u of %u workers started)\n", iteration, i, count, (int)runs[i].load(), startedCount, workerCount);
+        failures++;
+        break;
+      }
+    }
+  }
+}
+
+void spin(unsigned nanoseconds)
+{
+  if (nanoseconds == 0) {
+    return;
+  }
+  const auto end = std::chrono::steady_clock::now() + std::chrono::nanoseconds(nanoseconds);
+  while (std::chrono::steady_clock::now() < end) {
+  }
+}
+
+template <typename Function>
+double bestMicroseconds(Function function)
+{
+  double best = 1e18;
+  for (int repetition = 0; repetition < 5; repetition++) {
+    const auto start = std::chrono::steady_clock::now();
+    function();
+    best = std::min(best, std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count());
+  }
+  return best;
+}
+
+void benchmark()
+{
+  const unsigned threadCount = std::max(1u, std::thread::hardware_concurrency()) * 2;
+  std::printf("%u threads\n%10s %8s %12s %12s\n", threadCount, "cost/iter", "count", "counter", "stealing");
+  for (unsigned cost : {0u, 50u, 1000u, 20000u}) {
+    for (std::size_t count : {16, 256, 100000}) {
+      if ((double)count * cost > 4e8) {
+        continue;
+      }
+      std::atomic<std::size_t> sink(0);
+
+      // ASDispatchApply before: every thread increments one shared counter per iteration
+      const double counterTime = bestMicroseconds([&] {
+        std::atomic<std::size_t> counter(0);
+        std::vector<std::thread> threads;
+        for (unsigned t = 0; t < threadCount; t++) {
+          threads.emplace_back([&] {
+            std::size_t i, sum = 0;
+            while ((i = counter.fetch_add(1)) < count) {
+              spin(cost);
+              sum += i;
+            }
+            sink += sum;
+          });
+        }
+        for (std::thread &thread : threads) {
+          thread.join();
+        }
+      });
+
+      const double stealingTime = bestMicroseconds([&] {
+        AS::WorkStealingRange range(count, threadCount);
+        std::vector<std::thread> threads;
+        for (unsigned t = 0; t < threadCount; t++) {
+          threads.emplace_back([&, t] {
+            std::size_t sum = 0;
+            range.run(t, [&](std::size_t i) {
+              spin(cost);
+              sum += i;
+            });
+            sink += sum;
+          });
+        }
+        for (std::thread &thread : threads) {
+          thread.join();
+        }
+      });
+
+      std::printf("%8uns %8zu %10.0fus %10.0fus\n", cost, count, counterTime, stealingTime);
+    }
+  }
+}
+
+} // namespace
+
+int main()
+{
+  stress();
+  if (failures > 0) {
+    return EXIT_FAILURE;
+  }
+  benchmark();
+  std::printf("OK\n");
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,201 @@
+//
+//  AlbumArtDetailTests.mm
+//  RelistenTests
+//
+//  Copyright © 2018 Alec Gorge. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+
+#include "../Shared/AlbumArt/AlbumArtDisplayList.h"
+
+#include <cmath>
+#include <vector>
+
+using namespace AlbumArt;
+
+namespace {
+
+// The budget AlbumArt::DisplayList::detailForSize picks tiers by, against Detail::Full at the same size
+const double JustNoticeableDifference = 2.3;
+const double MaximumShareOverJustNoticeableDifference = 0.05;
+const double MinimumSSIM = 0.995;
+
+// The sizes the image cache renders, and the ones between where detailForSize changes tiers
+const int Sizes[] = {64, 128, 224, 256, 448, 512, 768};
+const size_t SizeCount = sizeof(Sizes) / sizeof(Sizes[0]);
+
+// Palette::forBaseColor of 0x3498DB, written out so the reference renders don't depend on libm's pow
+const Palette ReferencePalette = {{{0, 0.503113329f, 0.793738186f, 1}, {0, 0.47822085f, 0.721156776f, 1}, {0.204050645f, 0.596006751f, 0.859003425f, 1}, {0.386762828f, 0.770438969f, 1, 1}, {0.245334849f, 0.852698684f, 1, 1}}};
+
+// FNV-1a of each design's render in ReferencePalette at each of Sizes, with labels, replayed before detail tiers held
+// any backgrounds back. Detail::Full has to keep drawing exactly these.
+const uint64_t ReferenceChecksums[][SizeCount] = {
+    {0xd55cffac35fb989eull, 0x51653b2af504ac7eull, 0xe8088491d8c9e2a7ull, 0x8215fb6e329b6a7bull, 0xd936832ae629a3c0ull, 0x35a180658a1e00cdull, 0x730bfc5b7a49f958ull},
+    {0x6d0fbd6c48b565fdull, 0x349d467a6ae64a25ull, 0xc9dec27910cdf3b1ull, 0x9e6298ec566028beull, 0x4b2b992debd14bb8ull, 0x39ba5a91b8b1e845ull, 0x454fc528b5680105ull},
+    {0xcea4ca6a684e76caull, 0x388e1e1f9828152full, 0x48a829254745721full, 0x53687c2d671c96dcull, 0x299d63ff2a56e021ull, 0xd7fdd1c56a45ace5ull, 0x2ce6c8568e6955deull},
+    {0x395b19fcecaee4e5ull, 0x1efbfcb1d7379096ull, 0xbee498303a5ee67cull, 0x1e1c3c36e4fb107bull, 0xc60b5160f72a1c08ull, 0x4dd0268246d7359cull, 0x625927971c88b3bfull},
+};
+
+struct Lab {
+    double L, a, b;
+};
+
+double linearized(double component) {
+    return component <= 0.04045 ? component / 12.92 : std::pow((component + 0.055) / 1.055, 2.4);
+}
+
+double labCurve(double t) {
+    return t > 0.008856 ? std::cbrt(t) : 7.787 * t + 16.0 / 116;
+}
+
+// A premultiplied 0xAARRGGBB pixel composited over white, in CIELAB under D65
+Lab labForPixel(uint32_t pixel) {
+    const double transparency = 1 - (pixel >> 24) / 255.0;
+    const double red = linearized(((pixel >> 16) & 0xFF) / 255.0 + transparency);
+    const double green = linearized(((pixel >> 8) & 0xFF) / 255.0 + transparency);
+    const double blue = linearized((pixel & 0xFF) / 255.0 + transparency);
+
+    const double x = labCurve((0.4124 * red + 0.3576 * green + 0.1805 * blue) / 0.95047);
+    const double y = labCurve(0.2126 * red + 0.7152 * green + 0.0722 * blue);
+    const double z = labCurve((0.0193 * red + 0.1192 * green + 0.9505 * blue) / 1.08883);
+    return {116 * y - 16, 500 * (x - y), 200 * (y - z)};
+}
+
+struct Difference {
+    // Share of pixels whose dE76 is past JustNoticeableDifference
+    double shareOverJustNoticeableDifference;
+    // Mean SSIM of L* over 8x8 windows, 4 pixels apart
+    double ssim;
+};
+
+Difference difference(const std::vector<uint32_t> &reference, const std::vector<uint32_t> &pixels, int size) {
+    Difference difference = {0, 0};
+    std::vector<double> referenceL(reference.size()), pixelsL(pixels.size());
+    int overJustNoticeableDifference = 0;
+    for (size_t i = 0; i < reference.size(); i++) {
+        const Lab expected = labForPixel(reference[i]);
+        const Lab actual = labForPixel(pixels[i]);
+        referenceL[i] = expected.L;
+        pixelsL[i] = actual.L;
+        const double deltaE = std::sqrt((expected.L - actual.L) * (expected.L - actual.L) + (expected.a - actual.a) * (expected.a - actual.a) + (expected.b - actual.b) * (expected.b - actual.b));
+        overJustNoticeableDifference += deltaE > JustNoticeableDifference;
+    }
+    difference.shareOverJustNoticeableDifference = overJustNoticeableDifference / (double)reference.size();
+
+    // L* runs from 0 to 100
+    const double c1 = (0.01 * 100) * (0.01 * 100);
+    const double c2 = (0.03 * 100) * (0.03 * 100);
+    const int window = 8;
+    double total = 0;
+    int windowCount = 0;
+    for (int top = 0; top + window <= size; top += window / 2) {
+        for (int left = 0; left + window <= size; left += window / 2) {
+            double meanX = 0, meanY = 0, xx = 0, yy = 0, xy = 0;
+            for (int y = top; y < top + window; y++) {
+                for (int x = left; x < left + window; x++) {
+                    const double a = referenceL[(size_t)y * size + x];
+                    const double b = pixelsL[(size_t)y * size + x];
+                    meanX += a;
+                    meanY += b;
+                    xx += a * a;
+                    yy += b * b;
+                    xy += a * b;
+                }
+            }
+            const int n = window * window;
+            meanX /= n;
+            meanY /= n;
+            const double varianceX = xx / n - meanX * meanX;
+            const double varianceY = yy / n - meanY * meanY;
+            const double covariance = xy / n - meanX * meanY;
+            total += ((2 * meanX * meanY + c1) * (2 * covariance + c2)) / ((meanX * meanX + meanY * meanY + c1) * (varianceX + varianceY + c2));
+            windowCount++;
+        }
+    }
+    difference.ssim = total / windowCount;
+    return difference;
+}
+
+std::vector<uint32_t> rendered(Design design, const Palette &palette, int size, Detail detail) {
+    std::vector<uint32_t> pixels((size_t)size * size, 0);
+    DisplayList::shared().render(design, palette, true, {pixels.data(), size, size, (size_t)size * 4}, detail, nullptr);
+    return pixels;
+}
+
+uint64_t checksum(const std::vector<uint32_t> &pixels) {
+    uint64_t hash = 0xcbf29ce484222325ull;
+    for (uint32_t pixel : pixels) {
+        for (int shift = 0; shift < 32; shift += 8) {
+            hash ^= (pixel >> shift) & 0xFF;
+            hash *= 0x100000001b3ull;
+        }
+    }
+    return hash;
+}
+
+const char *detailName(Detail detail) {
+    switch (detail) {
+        case Detail::Full:
+            return "Full";
+        case Detail::Reduced:
+            return "Reduced";
+        case Detail::Minimal:
+            return "Minimal";
+    }
+    return "?";
+}
+
+} // namespace
+
+@interface AlbumArtDetailTests : XCTestCase
+
+@end
+
+@implementation AlbumArtDetailTests
+
+- (void)testFullMatchesTheReferenceRenders {
+    const DisplayList &list = DisplayList::shared();
+    XCTAssertEqual(list.designCount(), sizeof(ReferenceChecksums) / sizeof(ReferenceChecksums[0]));
+
+    for (size_t design = 0; design < list.designCount(); design++) {
+        for (size_t i = 0; i < SizeCount; i++) {
+            const uint64_t actual = checksum(rendered((Design)design, ReferencePalette, Sizes[i], Detail::Full));
+            XCTAssertEqual(actual, ReferenceChecksums[design][i], @"design %zu at %dpx: Full draws differently than before detail tiers, checksum 0x%016llx", design, Sizes[i], (unsigned long long)actual);
+        }
+    }
+}
+
+- (void)testEveryDetailStaysWithinItsBudget {
+    const DisplayList &list = DisplayList::shared();
+    XCTAssertEqual(list.designCount(), (size_t)4);
+
+    const Color baseColors[] = {{0.204f, 0.596f, 0.859f, 1}, {0.9f, 0.3f, 0.2f, 1}, {0.2f, 0.7f, 0.3f, 1}};
+    for (const Color &baseColor : baseColors) {
+        const Palette palette = Palette::forBaseColor(baseColor);
+        for (int size : Sizes) {
+            const Detail leastDetail = list.detailForSize(size, size);
+            for (size_t design = 0; design < list.designCount(); design++) {
+                const std::vector<uint32_t> full = rendered((Design)design, palette, size, Detail::Full);
+
+                for (Detail detail : {Detail::Reduced, Detail::Minimal}) {
+                    // Tiers are ordered from most detail to least; detailForSize never picks one past its own
+                    if (detail > leastDetail) {
+                        continue;
+                    }
+
+                    const Difference difference = ::difference(full, rendered((Design)design, palette, size, detail), size);
+                    XCTAssertLessThanOrEqual(difference.shareOverJustNoticeableDifference, MaximumShareOverJustNoticeableDifference, @"design %zu at %dpx: %s has too many pixels past dE76 %.1f", design, size, detailName(detail), JustNoticeableDifference);
+                    XCTAssertGreaterThanOrEqual(difference.ssim, MinimumSSIM, @"design %zu at %dpx: %s has SSIM %.4f", design, size, detailName(detail), difference.ssim);
+                }
+
+                // Without a tier, render picks detailForSize's
+                std::vector<uint32_t> automatic((size_t)size * size, 0);
+                list.render((Design)design, palette, true, {automatic.data(), size, size, (size_t)size * 4}, nullptr);
+                XCTAssertTrue(automatic == rendered((Design)design, palette, size, leastDetail), @"design %zu at %dpx: render doesn't use %s", design, size, detailName(leastDetail));
+            }
+        }
+    }
+}
+
+@end
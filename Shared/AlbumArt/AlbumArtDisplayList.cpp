@@ -0,0 +1,981 @@
+//
+//  AlbumArtDisplayList.cpp
+//  RelistenShared
+//
+//  Copyright © 2018 Alec Gorge. All rights reserved.
+//
+
+#include "AlbumArtDisplayList.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+// Replays are compared against checksums of reference renders (RelistenTests/AlbumArtDetailTests.mm), so keep the
+// arithmetic the same on every platform: no fused multiply-adds where the compiler would otherwise contract.
+#pragma STDC FP_CONTRACT OFF
+
+namespace AlbumArt {
+
+#pragma mark - Colors
+
+// The offsets from the base color in L, a and b, from PHODColorPalleteForBaseColor
+static const double PaletteTransforms[Palette::ColorCount][3] = {
+    {-11.3280589, -9.818462023, -8.794142144},
+    {-12.86407494, -6.368568016, -0.52404444},
+    {0, 0, 0},
+    {16.40182009, 0.099009545, -3.887684593},
+    {22.23518689, -8.385507143, -6.493886917},
+};
+
+// sRGB, 2° observer and D65 white point, the same as EDColor's UIColor+CIELAB
+static const double ReferenceX = 95.047;
+static const double ReferenceY = 100.0;
+static const double ReferenceZ = 108.883;
+
+static void RGBToLab(double red, double green, double blue, double *L, double *A, double *B) {
+    double linear[3] = {red, green, blue};
+    for (double &component : linear) {
+        component = (component > 0.04045 ? std::pow((component + 0.055) / 1.055, 2.4) : component / 12.92) * 100.0;
+    }
+
+    double xyz[3] = {
+        (linear[0] * 0.4124 + linear[1] * 0.3576 + linear[2] * 0.1805) / ReferenceX,
+        (linear[0] * 0.2126 + linear[1] * 0.7152 + linear[2] * 0.0722) / ReferenceY,
+        (linear[0] * 0.0193 + linear[1] * 0.1192 + linear[2] * 0.9505) / ReferenceZ,
+    };
+    for (double &component : xyz) {
+        component = component > 0.008856 ? std::pow(component, 1.0 / 3.0) : 7.787 * component + 16.0 / 116.0;
+    }
+
+    *L = 116.0 * xyz[1] - 16.0;
+    *A = 500.0 * (xyz[0] - xyz[1]);
+    *B = 200.0 * (xyz[1] - xyz[2]);
+}
+
+static void LabToRGB(double L, double A, double B, double *red, double *green, double *blue) {
+    double y = (L + 16.0) / 116.0;
+    double xyz[3] = {A / 500.0 + y, y, y - B / 200.0};
+    for (double &component : xyz) {
+        double cubed = component * component * component;
+        component = cubed > 0.008856 ? cubed : (component - 16.0 / 116.0) / 7.787;
+    }
+    xyz[0] *= ReferenceX / 100.0;
+    xyz[1] *= ReferenceY / 100.0;
+    xyz[2] *= ReferenceZ / 100.0;
+
+    double rgb[3] = {
+        xyz[0] * 3.2406 + xyz[1] * -1.5372 + xyz[2] * -0.4986,
+        xyz[0] * -0.9689 + xyz[1] * 1.8758 + xyz[2] * 0.0415,
+        xyz[0] * 0.0557 + xyz[1] * -0.2040 + xyz[2] * 1.0570,
+    };
+    for (double &component : rgb) {
+        component = component > 0.0031308 ? 1.055 * std::pow(component, 1 / 2.4) - 0.055 : 12.92 * component;
+    }
+
+    *red = rgb[0];
+    *green = rgb[1];
+    *blue = rgb[2];
+}
+
+static float Clamp(double value) {
+    return (float)std::min(std::max(value, 0.0), 1.0);
+}
+
+Palette Palette::forBaseColor(Color baseColor) {
+    double L, A, B;
+    RGBToLab(baseColor.red, baseColor.green, baseColor.blue, &L, &A, &B);
+
+    Palette palette;
+    for (int i = 0; i < ColorCount; i++) {
+        double red, green, blue;
+        LabToRGB(L + PaletteTransforms[i][0], A + PaletteTransforms[i][1], B + PaletteTransforms[i][2], &red, &green, &blue);
+        // UIKit keeps components outside 0 to 1, but they're clamped when drawn into a bitmap
+        palette.colors[i] = {Clamp(red), Clamp(green), Clamp(blue), baseColor.alpha};
+    }
+    return palette;
+}
+
+// Premultiplied 0xAARRGGBB
+static uint32_t PremultipliedPixel(const Color &color) {
+    float alpha = Clamp(color.alpha);
+    uint32_t a = (uint32_t)std::lround(alpha * 255);
+    uint32_t r = (uint32_t)std::lround(Clamp(color.red) * alpha * 255);
+    uint32_t g = (uint32_t)std::lround(Clamp(color.green) * alpha * 255);
+    uint32_t b = (uint32_t)std::lround(Clamp(color.blue) * alpha * 255);
+    return a << 24 | r << 16 | g << 8 | b;
+}
+
+// Scales every channel of a pixel by `scale` / 256, two channels at a time
+static inline uint32_t ScalePixel(uint32_t pixel, uint32_t scale) {
+    uint32_t redBlue = ((pixel & 0x00FF00FF) * scale >> 8) & 0x00FF00FF;
+    uint32_t alphaGreen = ((pixel >> 8) & 0x00FF00FF) * scale & 0xFF00FF00;
+    return alphaGreen | redBlue;
+}
+
+// Source over, with the source scaled by a coverage from 0 to 256
+static inline uint32_t BlendPixel(uint32_t destination, uint32_t source, uint32_t coverage) {
+    if (coverage < 256) {
+        source = ScalePixel(source, coverage);
+    }
+    uint32_t sourceAlpha = source >> 24;
+    return sourceAlpha == 255 ? source : source + ScalePixel(destination, 256 - (sourceAlpha + (sourceAlpha >> 7)));
+}
+
+#pragma mark - Transforms
+
+Transform Transform::scale(float sx, float sy) {
+    Transform transform;
+    transform.a = sx;
+    transform.d = sy;
+    return transform;
+}
+
+Transform Transform::concatenating(const Transform &other) const {
+    Transform result;
+    result.a = a * other.a + c * other.b;
+    result.b = b * other.a + d * other.b;
+    result.c = a * other.c + c * other.d;
+    result.d = b * other.c + d * other.d;
+    result.tx = a * other.tx + c * other.ty + tx;
+    result.ty = b * other.tx + d * other.ty + ty;
+    return result;
+}
+
+void Transform::apply(float x, float y, float *outX, float *outY) const {
+    *outX = a * x + c * y + tx;
+    *outY = b * x + d * y + ty;
+}
+
+#pragma mark - Reading
+
+namespace {
+
+class Reader {
+public:
+    Reader(const uint8_t *bytes, size_t length) : _bytes(bytes), _length(length) {}
+
+    bool canRead(size_t length) const { return _length - _offset >= length; }
+    size_t offset() const { return _offset; }
+    const uint8_t *current() const { return _bytes + _offset; }
+    bool atEnd() const { return _offset == _length; }
+
+    void skip(size_t length) { _offset += length; }
+    uint8_t u8() { return _bytes[_offset++]; }
+
+    uint16_t u16() {
+        uint16_t value = (uint16_t)(_bytes[_offset] | _bytes[_offset + 1] << 8);
+        _offset += 2;
+        return value;
+    }
+
+    int16_t i16() { return (int16_t)u16(); }
+
+    uint32_t u32() {
+        uint32_t value = (uint32_t)u16();
+        return value | (uint32_t)u16() << 16;
+    }
+
+    float coordinate() { return i16() * (1.0f / (1 << Format::CoordinateFractionBits)); }
+
+private:
+    const uint8_t *_bytes;
+    size_t _length;
+    size_t _offset = 0;
+};
+
+// The operand bytes of each op, after the op itself. Paths add their length on top.
+size_t OperandLength(Format::Op op) {
+    switch (op) {
+        case Format::Op::Save:
+        case Format::Op::Restore:
+            return 0;
+        case Format::Op::Translate:
+            return 4;
+        case Format::Op::Rotate:
+            return 2;
+        case Format::Op::ClipRect:
+            return 8;
+        case Format::Op::FillPath:
+            return 14;
+        case Format::Op::LinearGradient:
+            return 10;
+        case Format::Op::Text:
+            return 12;
+    }
+    return SIZE_MAX;
+}
+
+size_t VerbOperandLength(Format::PathVerb verb) {
+    switch (verb) {
+        case Format::PathVerb::Move:
+        case Format::PathVerb::Line:
+            return 4;
+        case Format::PathVerb::Curve:
+            return 12;
+        case Format::PathVerb::Close:
+            return 0;
+        case Format::PathVerb::Rect:
+        case Format::PathVerb::Oval:
+            return 8;
+        case Format::PathVerb::RoundedRect:
+            return 10;
+    }
+    return SIZE_MAX;
+}
+
+bool PathIsValid(const uint8_t *bytes, size_t length) {
+    Reader reader(bytes, length);
+    while (!reader.atEnd()) {
+        size_t operandLength = VerbOperandLength((Format::PathVerb)reader.u8());
+        if (operandLength == SIZE_MAX || !reader.canRead(operandLength)) {
+            return false;
+        }
+        reader.skip(operandLength);
+    }
+    return true;
+}
+
+} // namespace
+
+bool DisplayList::load(const uint8_t *bytes, size_t length) {
+    _designs.clear();
+
+    Reader reader(bytes, length);
+    if (!reader.canRead(12) || std::memcmp(bytes, "RADL", 4) != 0) {
+        return false;
+    }
+    reader.skip(4);
+    uint16_t version = reader.u16();
+    uint16_t designCount = reader.u16();
+    _canvasWidth = reader.u16();
+    _canvasHeight = reader.u16();
+    if (version != Format::Version || _canvasWidth == 0 || _canvasHeight == 0 || !reader.canRead(designCount * 8)) {
+        return false;
+    }
+
+    std::vector<DesignData> designs(designCount);
+    for (DesignData &design : designs) {
+        uint32_t offset = reader.u32();
+        uint32_t designLength = reader.u32();
+        if (offset > length || designLength > length - offset || !loadDesign(bytes + offset, designLength, &design)) {
+            return false;
+        }
+    }
+
+    _designs = std::move(designs);
+    return true;
+}
+
+bool DisplayList::loadDesign(const uint8_t *bytes, size_t length, DesignData *design) {
+    Reader reader(bytes, length);
+
+    if (!reader.canRead(1)) {
+        return false;
+    }
+    for (uint8_t count = reader.u8(); count > 0; count--) {
+        if (!reader.canRead(2)) {
+            return false;
+        }
+        uint8_t source = reader.u8();
+        Color color = {0, 0, 0, reader.u8() / 255.0f};
+        if (source == Format::LiteralColor) {
+            if (!reader.canRead(3)) {
+                return false;
+            }
+            color.red = color.alpha;
+            color.green = reader.u8() / 255.0f;
+            color.blue = reader.u8() / 255.0f;
+            color.alpha = reader.u8() / 255.0f;
+        } else if (source >= Palette::ColorCount) {
+            return false;
+        }
+        design->colors.push_back({source, color});
+    }
+
+    if (!reader.canRead(1)) {
+        return false;
+    }
+    for (uint8_t count = reader.u8(); count > 0; count--) {
+        if (!reader.canRead(1)) {
+            return false;
+        }
+        Gradient gradient;
+        for (uint8_t stopCount = reader.u8(); stopCount > 0; stopCount--) {
+            if (!reader.canRead(3)) {
+                return false;
+            }
+            uint8_t color = reader.u8();
+            float location = reader.u16() / 65535.0f;
+            if (color >= design->colors.size()) {
+                return false;
+            }
+            gradient.stops.push_back({color, location});
+        }
+        if (gradient.stops.empty()) {
+            return false;
+        }
+        design->gradients.push_back(gradient);
+    }
+
+    if (!reader.canRead(4)) {
+        return false;
+    }
+    size_t labelOffset = reader.u32();
+    if (labelOffset < reader.offset() || labelOffset > length) {
+        return false;
+    }
+    design->ops = reader.current();
+    design->artLength = labelOffset - reader.offset();
+    design->labelLength = length - labelOffset;
+
+    while (!reader.atEnd()) {
+        size_t opOffset = reader.offset();
+        Format::Op op = (Format::Op)reader.u8();
+        size_t operandLength = OperandLength(op);
+        if (operandLength == SIZE_MAX || !reader.canRead(operandLength)) {
+            return false;
+        }
+
+        const uint8_t *operands = reader.current();
+        reader.skip(operandLength);
+        switch (op) {
+            case Format::Op::FillPath: {
+                size_t pathLength = (size_t)(operands[12] | operands[13] << 8);
+                if (operands[0] >= design->colors.size() || !reader.canRead(pathLength) || !PathIsValid(reader.current(), pathLength)) {
+                    return false;
+                }
+                reader.skip(pathLength);
+                break;
+            }
+            case Format::Op::LinearGradient:
+                if (operands[0] >= design->gradients.size()) {
+                    return false;
+                }
+                break;
+            case Format::Op::Text:
+                if (operands[0] > (uint8_t)Label::Text::Location || operands[1] > (uint8_t)Label::FontStyle::Italic || operands[3] >= design->colors.size()) {
+                    return false;
+                }
+                break;
+            default:
+                break;
+        }
+
+        // Ops can't straddle the art and the label
+        if (opOffset < labelOffset && reader.offset() > labelOffset) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+const DisplayList &DisplayList::shared() {
+    static const DisplayList *displayList = [] {
+        DisplayList *displayList = new DisplayList();
+        displayList->load(RelistenAlbumArtsDisplayList, RelistenAlbumArtsDisplayListLength);
+        return displayList;
+    }();
+    return *displayList;
+}
+
+#pragma mark - Rasterizing
+
+namespace {
+
+struct ClipRect {
+    int minX, minY, maxX, maxY;
+
+    bool isEmpty() const { return minX >= maxX || minY >= maxY; }
+
+    bool contains(const ClipRect &other) const {
+        return minX <= other.minX && minY <= other.minY && maxX >= other.maxX && maxY >= other.maxY;
+    }
+
+    ClipRect intersecting(const ClipRect &other) const {
+        return {std::max(minX, other.minX), std::max(minY, other.minY), std::min(maxX, other.maxX), std::min(maxY, other.maxY)};
+    }
+};
+
+/**
+ Fills paths by accumulating the signed area each edge covers in every pixel of the path's bounds, then summing each row:
+ the running sum is the winding of the pixel, with partial coverage at the edges, so shapes are antialiased exactly
+ without supersampling. Clamping the sum fills with the nonzero rule.
+
+ Curves are flattened in the bitmap's pixels, into as many lines as keep them within a quarter pixel of the curve, so a
+ shape a few pixels across is a few lines.
+ */
+class Rasterizer {
+public:
+    explicit Rasterizer(const Bitmap &bitmap) : _bitmap(bitmap) {}
+
+    void fill(const uint8_t *path, size_t length, const Transform &transform, const ClipRect &bounds, uint32_t color);
+    /// Fills a box in the bitmap, covering each pixel by the share of it the box overlaps.
+    void fillBox(float minX, float minY, float maxX, float maxY, const ClipRect &clip, uint32_t color);
+    /// Fills the clip with an opaque color, without blending.
+    void fillSolid(uint32_t color, const ClipRect &clip);
+    /**
+     Fills the clip with a gradient. If `background` isn't zero, it's an opaque color the ramp has already been blended
+     over, which is drawn where the gradient doesn't, so the pixels are written without reading them.
+     */
+    void fillGradient(const uint32_t *ramp, float t0, float dtdx, float dtdy, uint8_t flags, uint32_t background, const ClipRect &clip);
+
+private:
+    static constexpr float Tolerance = 0.25f;
+
+    void moveTo(float x, float y);
+    void lineTo(float x, float y);
+    void curveTo(float x1, float y1, float x2, float y2, float x, float y);
+    void close();
+    void addRoundedRect(const Transform &transform, float x, float y, float width, float height, float rx, float ry);
+
+    void accumulateLine(float x0, float y0, float x1, float y1);
+    void accumulateClampedLine(float x0, float y0, float x1, float y1);
+
+    uint32_t *row(int y) const { return (uint32_t *)((uint8_t *)_bitmap.pixels + (size_t)y * _bitmap.bytesPerRow); }
+
+    Bitmap _bitmap;
+
+    // The area of the bitmap being filled, and its accumulated coverage, `_width + 2` to a row
+    int _originX = 0;
+    int _originY = 0;
+    int _width = 0;
+    int _height = 0;
+    std::vector<float> _coverage;
+    // The columns of each row that edges touched. The winding is zero on either side.
+    std::vector<std::pair<int, int>> _spans;
+
+    float _startX = 0, _startY = 0;
+    float _currentX = 0, _currentY = 0;
+};
+
+void Rasterizer::fill(const uint8_t *path, size_t length, const Transform &transform, const ClipRect &bounds, uint32_t color) {
+    _originX = bounds.minX;
+    _originY = bounds.minY;
+    _width = bounds.maxX - bounds.minX;
+    _height = bounds.maxY - bounds.minY;
+    size_t coverageLength = (size_t)(_width + 2) * (size_t)_height;
+    if (_coverage.size() < coverageLength) {
+        _coverage.resize(coverageLength, 0);
+    }
+    _spans.assign((size_t)_height, {_width + 2, 0});
+
+    // Work relative to the filled area
+    Transform local = transform;
+    local.tx -= _originX;
+    local.ty -= _originY;
+
+    Reader reader(path, length);
+    float points[6];
+    while (!reader.atEnd()) {
+        Format::PathVerb verb = (Format::PathVerb)reader.u8();
+        switch (verb) {
+            case Format::PathVerb::Move:
+            case Format::PathVerb::Line:
+                points[0] = reader.coordinate();
+                points[1] = reader.coordinate();
+                local.apply(points[0], points[1], &points[0], &points[1]);
+                if (verb == Format::PathVerb::Move) {
+                    moveTo(points[0], points[1]);
+                } else {
+                    lineTo(points[0], points[1]);
+                }
+                break;
+            case Format::PathVerb::Curve:
+                for (int i = 0; i < 6; i += 2) {
+                    points[i] = reader.coordinate();
+                    points[i + 1] = reader.coordinate();
+                    local.apply(points[i], points[i + 1], &points[i], &points[i + 1]);
+                }
+                curveTo(points[0], points[1], points[2], points[3], points[4], points[5]);
+                break;
+            case Format::PathVerb::Close:
+                close();
+                break;
+            case Format::PathVerb::Rect:
+            case Format::PathVerb::RoundedRect:
+            case Format::PathVerb::Oval: {
+                float x = reader.coordinate(), y = reader.coordinate();
+                float width = reader.coordinate(), height = reader.coordinate();
+                float radius = 0;
+                if (verb == Format::PathVerb::RoundedRect) {
+                    radius = std::min(reader.coordinate(), std::min(width, height) / 2);
+                }
+
+                addRoundedRect(local, x, y, width, height, verb == Format::PathVerb::Oval ? width / 2 : radius, verb == Format::PathVerb::Oval ? height / 2 : radius);
+                break;
+            }
+        }
+    }
+    close();
+
+    // Sum the coverage along each row, blend, and leave the coverage cleared for the next path
+    size_t stride = (size_t)_width + 2;
+    for (int y = 0; y < _height; y++) {
+        float *coverage = _coverage.data() + (size_t)y * stride;
+        uint32_t *pixels = row(_originY + y) + _originX;
+        int end = std::min(_spans[y].second, _width);
+        float winding = 0;
+        for (int x = _spans[y].first; x < end; x++) {
+            winding += coverage[x];
+            coverage[x] = 0;
+            uint32_t alpha = (uint32_t)(std::min(std::fabs(winding), 1.0f) * 256 + 0.5f);
+            if (alpha > 0) {
+                pixels[x] = BlendPixel(pixels[x], color, alpha);
+            }
+        }
+        for (int x = std::max(end, _spans[y].first); x < _spans[y].second; x++) {
+            coverage[x] = 0;
+        }
+    }
+}
+
+void Rasterizer::moveTo(float x, float y) {
+    close();
+    _startX = _currentX = x;
+    _startY = _currentY = y;
+}
+
+void Rasterizer::lineTo(float x, float y) {
+    accumulateLine(_currentX, _currentY, x, y);
+    _currentX = x;
+    _currentY = y;
+}
+
+void Rasterizer::curveTo(float x1, float y1, float x2, float y2, float x, float y) {
+    // The curve's second differences bound how far its chords stray from it
+    float ddx = std::max(std::fabs(_currentX - 2 * x1 + x2), std::fabs(x1 - 2 * x2 + x));
+    float ddy = std::max(std::fabs(_currentY - 2 * y1 + y2), std::fabs(y1 - 2 * y2 + y));
+    float deviation = std::sqrt(ddx * ddx + ddy * ddy);
+    int segments = std::min(std::max((int)std::ceil(std::sqrt(deviation * 0.75f / Tolerance)), 1), 100);
+
+    float x0 = _currentX, y0 = _currentY;
+    for (int i = 1; i <= segments; i++) {
+        float t = (float)i / segments, u = 1 - t;
+        float px = u * u * u * x0 + 3 * u * u * t * x1 + 3 * u * t * t * x2 + t * t * t * x;
+        float py = u * u * u * y0 + 3 * u * u * t * y1 + 3 * u * t * t * y2 + t * t * t * y;
+        lineTo(px, py);
+    }
+}
+
+void Rasterizer::close() {
+    if (_currentX != _startX || _currentY != _startY) {
+        lineTo(_startX, _startY);
+    }
+}
+
+void Rasterizer::addRoundedRect(const Transform &transform, float x, float y, float width, float height, float rx, float ry) {
+    // Clockwise from the top left, with each corner a quarter of an ellipse
+    const float kappa = 0.5522847498f;
+    float kx = rx * kappa, ky = ry * kappa;
+    float maxX = x + width, maxY = y + height;
+    const float sides[4][8] = {
+        // The end of the side's line, then the corner's control points and end
+        {maxX - rx, y, maxX - rx + kx, y, maxX, y + ry - ky, maxX, y + ry},
+        {maxX, maxY - ry, maxX, maxY - ry + ky, maxX - rx + kx, maxY, maxX - rx, maxY},
+        {x + rx, maxY, x + rx - kx, maxY, x, maxY - ry + ky, x, maxY - ry},
+        {x, y + ry, x, y + ry - ky, x + rx - kx, y, x + rx, y},
+    };
+
+    float points[8];
+    transform.apply(x + rx, y, &points[0], &points[1]);
+    moveTo(points[0], points[1]);
+    for (const float *side : sides) {
+        for (int i = 0; i < 8; i += 2) {
+            transform.apply(side[i], side[i + 1], &points[i], &points[i + 1]);
+        }
+        lineTo(points[0], points[1]);
+        if (rx > 0 && ry > 0) {
+            curveTo(points[2], points[3], points[4], points[5], points[6], points[7]);
+        }
+    }
+    close();
+}
+
+void Rasterizer::accumulateLine(float x0, float y0, float x1, float y1) {
+    // Rows above or below the area don't matter, and columns left of it cover its first column. Split the line where it
+    // crosses either side, so each piece can be clamped into the area.
+    if (y0 == y1 || std::max(y0, y1) <= 0 || std::min(y0, y1) >= _height) {
+        return;
+    }
+
+    float width = (float)_width;
+    float crossings[2];
+    int crossingCount = 0;
+    for (float edge : {0.0f, width}) {
+        if ((x0 < edge) != (x1 < edge) && x0 != x1) {
+            crossings[crossingCount++] = (edge - x0) / (x1 - x0);
+        }
+    }
+    if (crossingCount == 2 && crossings[0] > crossings[1]) {
+        std::swap(crossings[0], crossings[1]);
+    }
+
+    float startX = x0, startY = y0;
+    for (int i = 0; i <= crossingCount; i++) {
+        float t = i < crossingCount ? crossings[i] : 1.0f;
+        float endX = i < crossingCount ? x0 + (x1 - x0) * t : x1;
+        float endY = i < crossingCount ? y0 + (y1 - y0) * t : y1;
+        accumulateClampedLine(std::min(std::max(startX, 0.0f), width), startY, std::min(std::max(endX, 0.0f), width), endY);
+        startX = endX;
+        startY = endY;
+    }
+}
+
+void Rasterizer::accumulateClampedLine(float x0, float y0, float x1, float y1) {
+    if (y0 == y1) {
+        return;
+    }
+
+    float direction = 1;
+    if (y0 > y1) {
+        std::swap(x0, x1);
+        std::swap(y0, y1);
+        direction = -1;
+    }
+
+    float dxdy = (x1 - x0) / (y1 - y0);
+    float x = x0;
+    if (y0 < 0) {
+        x -= y0 * dxdy;
+        y0 = 0;
+    }
+    y1 = std::min(y1, (float)_height);
+    if (y0 >= y1) {
+        return;
+    }
+
+    size_t stride = (size_t)_width + 2;
+    for (int y = (int)y0; y < (int)std::ceil(y1); y++) {
+        float *coverage = _coverage.data() + (size_t)y * stride;
+        float dy = std::min((float)(y + 1), y1) - std::max((float)y, y0);
+        float nextX = std::min(std::max(x + dxdy * dy, 0.0f), (float)_width);
+        float d = dy * direction;
+        float left = std::min(x, nextX), right = std::max(x, nextX);
+        float leftFloor = std::floor(left);
+        int leftIndex = (int)leftFloor;
+        int rightIndex = (int)std::ceil(right);
+        _spans[y].first = std::min(_spans[y].first, leftIndex);
+        _spans[y].second = std::max(_spans[y].second, rightIndex + 2);
+
+        if (rightIndex <= leftIndex + 1) {
+            // Within one pixel: split the area between it and the next by the line's average x
+            float fraction = 0.5f * (x + nextX) - leftFloor;
+            coverage[leftIndex] += d - d * fraction;
+            coverage[leftIndex + 1] += d * fraction;
+        } else {
+            // Across several pixels: a triangle in the first, a trapezoid in the last, and even steps between
+            float inverseWidth = 1 / (right - left);
+            float leftFraction = left - leftFloor;
+            float firstArea = 0.5f * inverseWidth * (1 - leftFraction) * (1 - leftFraction);
+            float rightFraction = right - std::ceil(right) + 1;
+            float lastArea = 0.5f * inverseWidth * rightFraction * rightFraction;
+            coverage[leftIndex] += d * firstArea;
+            if (rightIndex == leftIndex + 2) {
+                coverage[leftIndex + 1] += d * (1 - firstArea - lastArea);
+            } else {
+                float secondArea = inverseWidth * (1.5f - leftFraction);
+                coverage[leftIndex + 1] += d * (secondArea - firstArea);
+                for (int column = leftIndex + 2; column < rightIndex - 1; column++) {
+                    coverage[column] += d * inverseWidth;
+                }
+                float area = secondArea + (rightIndex - leftIndex - 3) * inverseWidth;
+                coverage[rightIndex - 1] += d * (1 - area - lastArea);
+            }
+            coverage[rightIndex] += d * lastArea;
+        }
+        x = nextX;
+    }
+}
+
+void Rasterizer::fillBox(float minX, float minY, float maxX, float maxY, const ClipRect &clip, uint32_t color) {
+    ClipRect box = {(int)std::floor(minX), (int)std::floor(minY), (int)std::ceil(maxX), (int)std::ceil(maxY)};
+    box = box.intersecting(clip);
+    for (int y = box.minY; y < box.maxY; y++) {
+        float coverageY = std::min(maxY, y + 1.0f) - std::max(minY, (float)y);
+        uint32_t *pixels = row(y);
+        for (int x = box.minX; x < box.maxX; x++) {
+            float coverageX = std::min(maxX, x + 1.0f) - std::max(minX, (float)x);
+            uint32_t alpha = (uint32_t)(coverageX * coverageY * 256 + 0.5f);
+            if (alpha > 0) {
+                pixels[x] = BlendPixel(pixels[x], color, alpha);
+            }
+        }
+    }
+}
+
+void Rasterizer::fillSolid(uint32_t color, const ClipRect &clip) {
+    for (int y = clip.minY; y < clip.maxY; y++) {
+        std::fill(row(y) + clip.minX, row(y) + clip.maxX, color);
+    }
+}
+
+void Rasterizer::fillGradient(const uint32_t *ramp, float t0, float dtdx, float dtdy, uint8_t flags, uint32_t background, const ClipRect &clip) {
+    for (int y = clip.minY; y < clip.maxY; y++) {
+        uint32_t *pixels = row(y);
+        float t = t0 + dtdx * (clip.minX + 0.5f) + dtdy * (y + 0.5f);
+        for (int x = clip.minX; x < clip.maxX; x++, t += dtdx) {
+            if ((t < 0 && !(flags & Format::GradientDrawsBeforeStart)) || (t > 1 && !(flags & Format::GradientDrawsAfterEnd))) {
+                if (background != 0) {
+                    pixels[x] = background;
+                }
+                continue;
+            }
+            int index = (int)(std::min(std::max(t, 0.0f), 1.0f) * 255 + 0.5f);
+            pixels[x] = background != 0 ? ramp[index] : BlendPixel(pixels[x], ramp[index], 256);
+        }
+    }
+}
+
+// Whether a path is a single rect that covers every pixel of the clip
+bool PathIsRectCoveringClip(const uint8_t *path, size_t length, const Transform &transform, const ClipRect &clip) {
+    if (length != 1 + 4 * 2 || (Format::PathVerb)path[0] != Format::PathVerb::Rect || transform.b != 0 || transform.c != 0) {
+        return false;
+    }
+    Reader reader(path + 1, length - 1);
+    float x = reader.coordinate(), y = reader.coordinate();
+    float width = reader.coordinate(), height = reader.coordinate();
+    float minX, minY, maxX, maxY;
+    transform.apply(x, y, &minX, &minY);
+    transform.apply(x + width, y + height, &maxX, &maxY);
+    return std::min(minX, maxX) <= clip.minX && std::min(minY, maxY) <= clip.minY && std::max(minX, maxX) >= clip.maxX && std::max(minY, maxY) >= clip.maxY;
+}
+
+// The graphics state ops save and restore
+struct State {
+    Transform transform;
+    ClipRect clip;
+};
+
+} // namespace
+
+Detail DisplayList::detailForSize(int width, int height) const {
+    float scale = std::min(width / _canvasWidth, height / _canvasHeight);
+    return scale >= 1.0f / 3 ? Detail::Minimal : scale >= 1.0f / 6 ? Detail::Reduced : Detail::Full;
+}
+
+void DisplayList::render(Design design, const Palette &palette, bool label, const Bitmap &bitmap, Detail detail, const std::function<void(const Label &)> &drawLabel) const {
+    if ((size_t)design >= _designs.size() || bitmap.width <= 0 || bitmap.height <= 0) {
+        return;
+    }
+    const DesignData &data = _designs[(size_t)design];
+
+    // Resolve the design's colors against the palette, and its gradients into ramps of 256 pixels
+    std::vector<Color> colors;
+    std::vector<uint32_t> pixels;
+    for (const auto &color : data.colors) {
+        Color resolved = color.second;
+        if (color.first != Format::LiteralColor) {
+            float alpha = resolved.alpha;
+            resolved = palette.colors[color.first];
+            resolved.alpha = alpha;
+        }
+        colors.push_back(resolved);
+        pixels.push_back(PremultipliedPixel(resolved));
+    }
+
+    std::vector<uint32_t> ramps(data.gradients.size() * 256);
+    for (size_t i = 0; i < data.gradients.size(); i++) {
+        const auto &stops = data.gradients[i].stops;
+        for (int step = 0; step < 256; step++) {
+            float location = step / 255.0f;
+            size_t next = 0;
+            while (next < stops.size() && stops[next].second < location) {
+                next++;
+            }
+            const Color &after = colors[stops[std::min(next, stops.size() - 1)].first];
+            const Color &before = colors[stops[next > 0 ? next - 1 : 0].first];
+            float start = stops[next > 0 ? next - 1 : 0].second, end = stops[std::min(next, stops.size() - 1)].second;
+            float t = end > start ? (location - start) / (end - start) : 0;
+            // Colors are interpolated before they're premultiplied, like CGGradient does
+            ramps[i * 256 + step] = PremultipliedPixel({before.red + (after.red - before.red) * t,
+                                                        before.green + (after.green - before.green) * t,
+                                                        before.blue + (after.blue - before.blue) * t,
+                                                        before.alpha + (after.alpha - before.alpha) * t});
+        }
+    }
+
+    Rasterizer rasterizer(bitmap);
+    // Paths smaller than this many pixels across are drawn as boxes
+    float boxSize = detail == Detail::Full ? 0 : detail == Detail::Reduced ? 2 : 4;
+
+    // An opaque fill of the whole clip, held back until something else is drawn in case it's a gradient that can be
+    // blended over it instead
+    uint32_t background = 0;
+    ClipRect backgroundClip = {0, 0, 0, 0};
+    auto drawBackground = [&]() {
+        if (background != 0) {
+            rasterizer.fillSolid(background, backgroundClip);
+            background = 0;
+        }
+    };
+
+    Transform canvas = Transform::scale(bitmap.width / _canvasWidth, bitmap.height / _canvasHeight);
+    State state = {Transform(), {0, 0, bitmap.width, bitmap.height}};
+    std::vector<State> states;
+
+    Reader reader(data.ops, data.artLength + (label ? data.labelLength : 0));
+    while (!reader.atEnd()) {
+        Format::Op op = (Format::Op)reader.u8();
+        switch (op) {
+            case Format::Op::Save:
+                states.push_back(state);
+                break;
+            case Format::Op::Restore:
+                if (!states.empty()) {
+                    state = states.back();
+                    states.pop_back();
+                }
+                break;
+            case Format::Op::Translate: {
+                Transform translation;
+                translation.tx = reader.coordinate();
+                translation.ty = reader.coordinate();
+                state.transform = state.transform.concatenating(translation);
+                break;
+            }
+            case Format::Op::Rotate: {
+                // In double precision, so libms that differ in the last bit of sin and cos still round to the same float
+                double angle = reader.i16() / 100.0 * M_PI / 180;
+                Transform rotation;
+                rotation.a = rotation.d = (float)std::cos(angle);
+                rotation.b = (float)std::sin(angle);
+                rotation.c = -rotation.b;
+                state.transform = state.transform.concatenating(rotation);
+                break;
+            }
+            case Format::Op::ClipRect:
+            case Format::Op::FillPath: {
+                uint8_t color = op == Format::Op::FillPath ? reader.u8() : 0;
+                uint8_t coverage = 0, centroidX = 0, centroidY = 0;
+                if (op == Format::Op::FillPath) {
+                    coverage = reader.u8();
+                    centroidX = reader.u8();
+                    centroidY = reader.u8();
+                }
+                float minX = reader.coordinate(), minY = reader.coordinate();
+                float maxX = reader.coordinate(), maxY = reader.coordinate();
+                if (op == Format::Op::ClipRect) {
+                    maxX += minX;
+                    maxY += minY;
+                }
+
+                // Bounds in the bitmap
+                Transform transform = canvas.concatenating(state.transform);
+                float xs[4], ys[4];
+                transform.apply(minX, minY, &xs[0], &ys[0]);
+                transform.apply(maxX, minY, &xs[1], &ys[1]);
+                transform.apply(maxX, maxY, &xs[2], &ys[2]);
+                transform.apply(minX, maxY, &xs[3], &ys[3]);
+                float boundsMinX = *std::min_element(xs, xs + 4), boundsMaxX = *std::max_element(xs, xs + 4);
+                float boundsMinY = *std::min_element(ys, ys + 4), boundsMaxY = *std::max_element(ys, ys + 4);
+
+                if (op == Format::Op::ClipRect) {
+                    ClipRect clip = {(int)std::lround(boundsMinX), (int)std::lround(boundsMinY), (int)std::lround(boundsMaxX), (int)std::lround(boundsMaxY)};
+                    state.clip = state.clip.intersecting(clip);
+                    break;
+                }
+
+                size_t pathLength = reader.u16();
+                ClipRect bounds = {(int)std::floor(boundsMinX), (int)std::floor(boundsMinY), (int)std::ceil(boundsMaxX), (int)std::ceil(boundsMaxY)};
+                bounds = bounds.intersecting(state.clip);
+                if (bounds.isEmpty()) {
+                    reader.skip(pathLength);
+                    break;
+                }
+
+                if ((pixels[color] >> 24) == 0xFF && PathIsRectCoveringClip(reader.current(), pathLength, transform, state.clip)) {
+                    if (!state.clip.contains(backgroundClip)) {
+                        drawBackground();
+                    }
+                    background = pixels[color];
+                    backgroundClip = state.clip;
+                    reader.skip(pathLength);
+                    break;
+                }
+                drawBackground();
+
+                float boundsWidth = boundsMaxX - boundsMinX, boundsHeight = boundsMaxY - boundsMinY;
+                if (std::max(boundsWidth, boundsHeight) < boxSize) {
+                    // A box the same area as the path, around its centroid
+                    float determinant = std::fabs(transform.a * transform.d - transform.b * transform.c);
+                    float area = coverage / 255.0f * (maxX - minX) * (maxY - minY) * determinant;
+                    if (area > 0) {
+                        float shrink = std::sqrt(std::min(area / (boundsWidth * boundsHeight), 1.0f)) / 2;
+                        float centerX, centerY;
+                        transform.apply(minX + (maxX - minX) * centroidX / 255.0f, minY + (maxY - minY) * centroidY / 255.0f, &centerX, &centerY);
+                        rasterizer.fillBox(centerX - boundsWidth * shrink, centerY - boundsHeight * shrink,
+                                           centerX + boundsWidth * shrink, centerY + boundsHeight * shrink, state.clip, pixels[color]);
+                    }
+                } else {
+                    rasterizer.fill(reader.current(), pathLength, transform, bounds, pixels[color]);
+                }
+                reader.skip(pathLength);
+                break;
+            }
+            case Format::Op::LinearGradient: {
+                uint8_t gradient = reader.u8();
+                float startX = reader.coordinate(), startY = reader.coordinate();
+                float endX = reader.coordinate(), endY = reader.coordinate();
+                uint8_t flags = reader.u8();
+                if (state.clip.isEmpty()) {
+                    break;
+                }
+                if (background != 0 && !(backgroundClip.contains(state.clip) && state.clip.contains(backgroundClip))) {
+                    drawBackground();
+                }
+
+                // Where a pixel falls along the gradient, as a function of its position in the bitmap
+                Transform transform = canvas.concatenating(state.transform);
+                float determinant = transform.a * transform.d - transform.b * transform.c;
+                float dx = endX - startX, dy = endY - startY;
+                float lengthSquared = dx * dx + dy * dy;
+                if (determinant == 0 || lengthSquared == 0) {
+                    break;
+                }
+                Transform inverse;
+                inverse.a = transform.d / determinant;
+                inverse.b = -transform.b / determinant;
+                inverse.c = -transform.c / determinant;
+                inverse.d = transform.a / determinant;
+                inverse.tx = (transform.c * transform.ty - transform.d * transform.tx) / determinant;
+                inverse.ty = (transform.b * transform.tx - transform.a * transform.ty) / determinant;
+                float dtdx = (inverse.a * dx + inverse.b * dy) / lengthSquared;
+                float dtdy = (inverse.c * dx + inverse.d * dy) / lengthSquared;
+                float t0 = ((inverse.tx - startX) * dx + (inverse.ty - startY) * dy) / lengthSquared;
+                const uint32_t *ramp = &ramps[gradient * 256];
+                uint32_t blended[256];
+                if (background != 0) {
+                    for (int i = 0; i < 256; i++) {
+                        blended[i] = BlendPixel(background, ramp[i], 256);
+                    }
+                    ramp = blended;
+                }
+                rasterizer.fillGradient(ramp, t0, dtdx, dtdy, flags, background, state.clip);
+                background = 0;
+                break;
+            }
+            case Format::Op::Text: {
+                Label text;
+                text.text = (Label::Text)reader.u8();
+                text.fontStyle = (Label::FontStyle)reader.u8();
+                text.fontSize = reader.u8();
+                text.color = colors[reader.u8()];
+                text.x = reader.coordinate();
+                text.y = reader.coordinate();
+                text.width = reader.coordinate();
+                text.height = reader.coordinate();
+                text.transform = state.transform;
+                drawBackground();
+                if (drawLabel) {
+                    drawLabel(text);
+                }
+                break;
+            }
+        }
+    }
+    drawBackground();
+}
+
+} // namespace AlbumArt
@@ -0,0 +1,226 @@
+//
+//  AlbumArtDisplayList.h
+//  RelistenShared
+//
+//  Copyright © 2018 Alec Gorge. All rights reserved.
+//
+
+#pragma once
+
+// Plain C++, without UIKit, so the album art can be replayed and timed on any platform.
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <utility>
+#include <vector>
+
+namespace AlbumArt {
+
+/**
+ The album art designs drawn by RelistenAlbumArts, compiled once by compile_display_list.py into a display list: a compact
+ binary recording of their paths, fills, gradients, transforms and clips. Replaying it rasterizes a design straight into
+ a bitmap of any size, without UIKit or CoreGraphics.
+
+ Designs are parameterized by a palette derived from the show's base color, like PHODColorPalleteForBaseColor does, and by
+ their labels. Labels are handed back to the caller to draw, since text needs the platform's fonts.
+
+ All values are little-endian. Coordinates are in the designs' 768pt canvas, stored as 16-bit fixed point with
+ `CoordinateFractionBits` fractional bits.
+
+     Header      "RADL", u16 version, u16 design count, u16 canvas width, u16 canvas height,
+                 then per design: u32 offset, u32 length
+     Design      u8 color count, colors, u8 gradient count, gradients, u32 label offset, art ops, label ops
+     Color       u8 palette index (0-4) and u8 alpha, or u8 0xFF and u8 red, green, blue, alpha
+     Gradient    u8 stop count, then per stop: u8 color, u16 location (0-65535)
+
+ The label offset is from the start of the design; the label ops run from there to the end of the design, and are only
+ replayed when the label is drawn.
+ */
+namespace Format {
+
+static const uint16_t Version = 2;
+static const int CoordinateFractionBits = 5;
+static const uint8_t LiteralColor = 0xFF;
+
+enum class Op : uint8_t {
+    Save = 1,
+    Restore,
+    /// i16 x, y
+    Translate,
+    /// i16 angle, in hundredths of a degree
+    Rotate,
+    /// i16 x, y, width, height. Clips to the rect's bounding box under the current transform.
+    ClipRect,
+    /// u8 color, u8 coverage, u8 centroid x, y, i16 bounds min x, min y, max x, max y, u16 path length, path. Fills with
+    /// the nonzero winding rule. The coverage is the share of the bounds the path fills, and the centroid is where in
+    /// the bounds the middle of that area is, from 0 to 255, so small paths can be approximated without reading them.
+    FillPath,
+    /// u8 gradient, i16 start x, y, end x, y, u8 `GradientFlags`. Fills the clip.
+    LinearGradient,
+    /// u8 `Label::Text`, u8 `Label::FontStyle`, u8 font size, u8 color, i16 x, y, width, height
+    Text,
+};
+
+enum class PathVerb : uint8_t {
+    /// i16 x, y
+    Move = 1,
+    /// i16 x, y
+    Line,
+    /// i16 control point 1 x, y, control point 2 x, y, end x, y
+    Curve,
+    Close,
+    /// i16 x, y, width, height
+    Rect,
+    /// i16 x, y, width, height, corner radius
+    RoundedRect,
+    /// i16 x, y, width, height
+    Oval,
+};
+
+enum GradientFlags : uint8_t {
+    GradientDrawsBeforeStart = 1 << 0,
+    GradientDrawsAfterEnd = 1 << 1,
+};
+
+} // namespace Format
+
+/// The designs in the order they're compiled, which is the order AlbumArtImageCache picks them in.
+enum class Design : uint8_t {
+    ShatterExplosion,
+    RandomFlowers,
+    Splash,
+    CityGlitters,
+};
+
+/// Components from 0 to 1, not premultiplied.
+struct Color {
+    float red, green, blue, alpha;
+};
+
+/// The five colors a design is drawn in.
+struct Palette {
+    static const int ColorCount = 5;
+    Color colors[ColorCount];
+
+    /// Offsets the base color in CIELAB space, the same way PHODColorPalleteForBaseColor does with EDColor.
+    static Palette forBaseColor(Color baseColor);
+};
+
+struct Transform {
+    float a = 1, b = 0, c = 0, d = 1, tx = 0, ty = 0;
+
+    static Transform scale(float sx, float sy);
+
+    /// Applies `other` first, then this transform, like CGContextConcatCTM.
+    Transform concatenating(const Transform &other) const;
+    void apply(float x, float y, float *outX, float *outY) const;
+};
+
+/// A label for the caller to draw over the art.
+struct Label {
+    enum class Text : uint8_t {
+        Date,
+        Venue,
+        Location,
+    };
+
+    enum class FontStyle : uint8_t {
+        Regular,
+        Bold,
+        Italic,
+    };
+
+    /// The string to draw. The designs draw the location where they say venue and the other way around; the display list
+    /// keeps that.
+    Text text;
+    FontStyle fontStyle;
+    float fontSize;
+    Color color;
+    /// Left aligned, centered vertically, and clipped to the rect.
+    float x, y, width, height;
+    /// The design's own transform at the label, to concatenate onto the canvas's.
+    Transform transform;
+};
+
+/**
+ How closely a render follows the design. Paths only a few pixels across can be drawn as a box with the same area and
+ centroid instead, without reading or flattening them, which is most of the designs' flowers and glitter at list sizes.
+ */
+enum class Detail : uint8_t {
+    /// Every path is rasterized exactly.
+    Full,
+    /// Paths under 2 pixels across are drawn as boxes.
+    Reduced,
+    /// Paths under 4 pixels across are drawn as boxes.
+    Minimal,
+};
+
+/// 32-bit pixels holding 0xAARRGGBB, premultiplied: BGRA in memory on little-endian machines.
+struct Bitmap {
+    uint32_t *pixels;
+    int width;
+    int height;
+    size_t bytesPerRow;
+};
+
+class DisplayList {
+public:
+    /// The compiled RelistenAlbumArts designs.
+    static const DisplayList &shared();
+
+    /**
+     Reads a display list, checking every op and path so that replaying it can't read out of bounds. Returns false if it
+     is malformed; it then has no designs. `bytes` must outlive the display list.
+     */
+    bool load(const uint8_t *bytes, size_t length);
+
+    size_t designCount() const { return _designs.size(); }
+    float canvasWidth() const { return _canvasWidth; }
+    float canvasHeight() const { return _canvasHeight; }
+
+    /**
+     The least detail a bitmap of this size can be drawn with and still look like `Detail::Full`. The smaller the bitmap,
+     the more of the picture a box a few pixels across is, so the more detail it needs.
+
+     A tier looks like `Detail::Full` if, against a `Detail::Full` render of the same size, at most 5% of its pixels are
+     past a CIELAB dE76 of 2.3, and the SSIM of L* is at least 0.995. AlbumArtDetailTests checks every design against it.
+     */
+    Detail detailForSize(int width, int height) const;
+
+    /**
+     Draws a design over `bitmap`, scaling the canvas to fill it. Paths are flattened to the accuracy the bitmap's size
+     needs, and paths outside the clip aren't flattened at all. Opaque fills of the whole clip are held back until
+     something is drawn over them, so a background covered by another, or by a gradient, is never rasterized. Labels are
+     passed to `drawLabel` in the order they're drawn, if `label` is true.
+     */
+    void render(Design design, const Palette &palette, bool label, const Bitmap &bitmap, const std::function<void(const Label &)> &drawLabel) const {
+        render(design, palette, label, bitmap, detailForSize(bitmap.width, bitmap.height), drawLabel);
+    }
+    void render(Design design, const Palette &palette, bool label, const Bitmap &bitmap, Detail detail, const std::function<void(const Label &)> &drawLabel) const;
+
+private:
+    struct Gradient {
+        std::vector<std::pair<uint8_t, float>> stops;
+    };
+
+    struct DesignData {
+        std::vector<std::pair<uint8_t, Color>> colors;
+        std::vector<Gradient> gradients;
+        const uint8_t *ops;
+        size_t artLength;
+        size_t labelLength;
+    };
+
+    bool loadDesign(const uint8_t *bytes, size_t length, DesignData *design);
+
+    float _canvasWidth = 0;
+    float _canvasHeight = 0;
+    std::vector<DesignData> _designs;
+};
+
+/// Written by compile_display_list.py from RelistenAlbumArts.m.
+extern const uint8_t RelistenAlbumArtsDisplayList[];
+extern const size_t RelistenAlbumArtsDisplayListLength;
+
+} // namespace AlbumArt
@@ -29,6 +29,9 @@ class AlbumArtImageCache : NSObject, FICImageCacheDelegate {
     public static let imageFormatFullBounds = CGSize(width: 768, height: 768)
     
     private let imageFamily = "net.relisten.ios.albumart"
+    
+    // Draws album art for many shows ahead of time, straight into the image cache
+    public private(set) lazy var prerenderer = AlbumArtPrerenderer(albumArt: self)
 
     public override init() {
         let small = FICImageFormat()
@@ -63,6 +66,20 @@ class AlbumArtImageCache : NSObject, FICImageCacheDelegate {
         super.init()
         
         cache.delegate = self
+        
+        NotificationCenter.default.addObserver(self, selector: #selector(logStatistics), name: UIApplication.didEnterBackgroundNotification, object: nil)
+    }
+    
+    // Memory use and paging of each format's image table, for sizing its maximumCount, and the prerenderer's progress. A
+    // format whose images keep faulting in while its table is full is evicting images before they're shown again.
+    @objc public func logStatistics() {
+        for formatName in [AlbumArtImageCache.imageFormatSmall, AlbumArtImageCache.imageFormatMedium, AlbumArtImageCache.imageFormatFull] {
+            let statistics = cache.statistics(forFormatName: formatName)
+            LogDebug("\(formatName): \(statistics.entryCount)/\(statistics.maximumCount) images, \(statistics.residentLength / 1024)KB of \(statistics.fileLength / 1024)KB resident, \(statistics.pageFaults) page faults, \(statistics.prefetchedPages) pages prefetched, \(statistics.droppedPages) pages dropped")
+        }
+        
+        let prerender = prerenderer.statistics
+        LogDebug("prerender: \(prerender.rendered) images drawn, \(prerender.skipped) shows cached, \(prerender.failed) failed, \(prerender.queueDepth) queued, \(prerender.inFlight) in flight, \(String(format: "%.1f", prerender.throughput)) images/s")
     }
     
     private func components(from entity: FICEntity) -> URLComponents? {
@@ -104,39 +121,65 @@ class AlbumArtImageCache : NSObject, FICImageCacheDelegate {
         return baseColor(year: year, venue: venue, day: day, artistID: artistID)
     }
     
+    // The designs are drawn on a 768pt square canvas
+    public static let albumArtDesignSize = CGSize(width: 768, height: 768)
+    
+    // Draws the album art of a show into the current context, scaled from the design's canvas to `size`. Returns false if
+    // the show has no date to draw.
+    public func drawAlbumArt(for entity: FICEntity, in size: CGSize) -> Bool {
+        let (artistID, date, venue, location) = parseShowInfo(from: entity)
+        guard let d = date, UIGraphicsGetCurrentContext() != nil else { return false }
+        
+        let (year, month, day) = parseDateComponents(from: d)
+        let baseColor = self.baseColor(year: year, venue: venue, day: day, artistID: artistID)
+        
+        let design : RelistenAlbumArtDesign
+        switch ((year + month + day) % 4) {
+        case 0:
+            design = .shatterExplosion
+        case 1:
+            design = .randomFlowers
+        case 2:
+            design = .splash
+        case 3:
+            fallthrough
+        default:
+            design = .cityGlitters
+        }
+        
+        RelistenAlbumArtRenderer.draw(design, withBaseColor: baseColor, date: d, venue: venue, location: location, drawLabel: true, in: CGRect(origin: .zero, size: size))
+        return true
+    }
+    
+    // The size to render the source image of a format at: its pixel size, but no larger than the design's canvas
+    private func renderSize(forFormatName formatName: String) -> CGSize {
+        let designSize = AlbumArtImageCache.albumArtDesignSize
+        guard let pixelSize = cache.format(withName: formatName)?.pixelSize else { return designSize }
+        return CGSize(width: min(pixelSize.width, designSize.width), height: min(pixelSize.height, designSize.height))
+    }
+    
     public func imageCache(_ imageCache: FICImageCache, wantsSourceImageFor entity: FICEntity, withFormatName formatName: String, completionBlock: FICImageRequestCompletionBlock? = nil) {
         DispatchQueue.global(qos: .default).async {
             var image : UIImage? = nil
-            let (artistID, date, venue, location) = self.parseShowInfo(from: entity)
-            if let date = date {
-                let (year, month, day) = self.parseDateComponents(from: date)
-                
-                let baseColor = self.baseColor(year: year, venue: venue, day: day, artistID: artistID)
-                
-                UIGraphicsBeginImageContext(CGSize(width: 768, height: 768))
-                
-                switch ((year + month + day) % 4) {
-                case 0:
-                    RelistenAlbumArts.drawShatterExplosion(withBaseColor: baseColor, date: date, venue: venue, location: location, drawLabel: true)
-                case 1:
-                    RelistenAlbumArts.drawRandomFlowers(withBaseColor: baseColor, date: date, venue: venue, location: location, drawLabel: true)
-                case 2:
-                    RelistenAlbumArts.drawSplash(withBaseColor: baseColor, date: date, venue: venue, location: location, drawLabel: true)
-                case 3:
-                    fallthrough
-                default:
-                    RelistenAlbumArts.drawCityGlitters(withBaseColor: baseColor, date: date, venue: venue, location: location, drawLabel: true)
-                }
-                
+            let size = self.renderSize(forFormatName: formatName)
+            
+            UIGraphicsBeginImageContext(size)
+            if self.drawAlbumArt(for: entity, in: size) {
                 image = UIGraphicsGetImageFromCurrentImageContext()
-                UIGraphicsEndImageContext()
             }
+            UIGraphicsEndImageContext()
             
             DispatchQueue.main.async {
                 completionBlock?(image)
             }
         }
     }
+    
+    // The source image is only rendered as large as the requested format needs, so the family's other formats are drawn
+    // when they're asked for rather than scaled up from it
+    public func imageCache(_ imageCache: FICImageCache, shouldProcessAllFormatsInFamily formatFamily: String, for entity: FICEntity) -> Bool {
+        return false
+    }
  
     static private let yearColors : [UIColor] = [
                                      UIColor.flatBlack(),
@@ -0,0 +1,278 @@
+//
+//  AlbumArtPrerenderer.swift
+//  RelistenShared
+//
+//  Copyright © 2018 Alec Gorge. All rights reserved.
+//
+
+import Foundation
+import FastImageCache
+
+public struct AlbumArtPrerenderStatistics {
+    // Shows waiting to be drawn
+    public var queueDepth : Int = 0
+    // Shows being drawn right now
+    public var inFlight : Int = 0
+    // Images drawn into the image cache
+    public var rendered : Int = 0
+    // Shows whose images were all cached already
+    public var skipped : Int = 0
+    // Shows that couldn't be drawn, e.g. because they have no date
+    public var failed : Int = 0
+    // Time spent with shows queued or being drawn
+    public var busyTime : TimeInterval = 0
+    
+    // Images drawn per second of busy time
+    public var throughput : Double {
+        return busyTime > 0 ? Double(rendered) / busyTime : 0
+    }
+}
+
+// Draws the album art of shows ahead of time, e.g. for the rows around the visible ones of a show list, so thumbnails are
+// in the image cache by the time their cells are shown.
+//
+// Each caller has its own batch, which replaces the caller's previous one. A batch is capped at half of the smallest
+// image table of its formats: the tables evict least recently used images, so a larger batch would evict its own first
+// images, or the ones on screen, before they're shown.
+//
+// Shows are drawn in the order they're queued, on as many threads as there are cores, at a lower priority than the images
+// cells ask for. Each image is drawn at its format's size straight into the image table, rather than rendering a 768pt
+// source image and scaling it down. When the app goes to the background, the queue keeps being worked through while the
+// system allows; if it runs out of time, the rest waits until the app is active again.
+public class AlbumArtPrerenderer : NSObject {
+    private struct Job {
+        let entity : ShowFICWrapper
+        let formats : [AlbumArtImageFormat]
+        let owner : ObjectIdentifier
+    }
+    
+    private let albumArt : AlbumArtImageCache
+    private let queue = DispatchQueue(label: "net.relisten.ios.albumart.prerender")
+    private let maximumConcurrentRenders = max(1, ProcessInfo.processInfo.activeProcessorCount)
+    
+    // Everything below is only touched on `queue`
+    private var jobs : [Job] = []
+    private var nextJobIndex = 0
+    private var queuedUUIDs = Set<String>()
+    private var inFlight = 0
+    private var isSuspended = false
+    // Set when the app ran out of background time, until it's active again
+    private var isWaitingForForeground = false
+    private var counters = AlbumArtPrerenderStatistics()
+    private var busySince : Date? = nil
+    
+    // Only touched on the main thread
+    private var backgroundTask : UIBackgroundTaskIdentifier = .invalid
+    
+    init(albumArt: AlbumArtImageCache) {
+        self.albumArt = albumArt
+        
+        super.init()
+        
+        NotificationCenter.default.addObserver(self, selector: #selector(applicationDidEnterBackground), name: UIApplication.didEnterBackgroundNotification, object: nil)
+        NotificationCenter.default.addObserver(self, selector: #selector(applicationWillEnterForeground), name: UIApplication.willEnterForegroundNotification, object: nil)
+    }
+    
+    // The most shows a batch in `formats` may hold: half of the smallest image table among them. Read from the formats
+    // rather than the tables' statistics, which check the residency of every page of the table.
+    public func batchLimit(for formats: [AlbumArtImageFormat] = [.small]) -> Int {
+        let tableCounts = formats.map({ albumArt.cache.format(withName: $0.rawValue)?.maximumCount ?? 0 })
+        return max(1, (tableCounts.min() ?? 0) / 2)
+    }
+    
+    // Queues the album art of `shows`, in order, to be drawn in `formats`, up to `batchLimit(for: formats)` of them. This
+    // replaces whatever `owner` queued before that hasn't started drawing yet. Shows that are already queued are skipped.
+    // Call this on the thread the shows belong to.
+    public func prerender(_ shows: [ShowCellDataSource], formats: [AlbumArtImageFormat] = [.small], for owner: AnyObject) {
+        let ownerID = ObjectIdentifier(owner)
+        let batch = formats.count > 0 ? shows.prefix(batchLimit(for: formats)) : []
+        let newJobs = batch.map({ Job(entity: $0.fastImageCacheWrapper(), formats: formats, owner: ownerID) })
+        queue.async {
+            self.removePendingJobs(where: { $0.owner == ownerID })
+            for job in newJobs where !self.queuedUUIDs.contains(job.entity.fic_UUID) {
+                self.queuedUUIDs.insert(job.entity.fic_UUID)
+                self.jobs.append(job)
+            }
+            self.startJobs()
+        }
+    }
+    
+    // Drops the shows `owner` queued that haven't started drawing yet, e.g. when its list goes off screen.
+    public func cancel(for owner: AnyObject) {
+        let ownerID = ObjectIdentifier(owner)
+        queue.async {
+            self.removePendingJobs(where: { $0.owner == ownerID })
+            self.finishIfIdle()
+        }
+    }
+    
+    // Drops every show that hasn't started drawing yet.
+    public func cancelAll() {
+        queue.async {
+            self.removePendingJobs(where: { _ in true })
+            self.finishIfIdle()
+        }
+    }
+    
+    // Stops starting new shows until `resume` is called. Shows being drawn are finished.
+    public func suspend() {
+        queue.async {
+            self.isSuspended = true
+            self.finishIfIdle()
+        }
+    }
+    
+    public func resume() {
+        queue.async {
+            self.isSuspended = false
+            self.startJobs()
+        }
+    }
+    
+    public var statistics : AlbumArtPrerenderStatistics {
+        return queue.sync { () -> AlbumArtPrerenderStatistics in
+            var statistics = counters
+            statistics.queueDepth = jobs.count - nextJobIndex
+            statistics.inFlight = inFlight
+            if let since = busySince {
+                statistics.busyTime += Date().timeIntervalSince(since)
+            }
+            return statistics
+        }
+    }
+    
+    // MARK: Drawing
+    
+    // Called on `queue`
+    private func removePendingJobs(where shouldRemove: (Job) -> Bool) {
+        var pendingJobs : [Job] = []
+        for job in jobs[nextJobIndex...] {
+            if shouldRemove(job) {
+                queuedUUIDs.remove(job.entity.fic_UUID)
+            } else {
+                pendingJobs.append(job)
+            }
+        }
+        jobs = pendingJobs
+        nextJobIndex = 0
+    }
+    
+    // Called on `queue`
+    private func startJobs() {
+        while !isSuspended && !isWaitingForForeground && inFlight < maximumConcurrentRenders && nextJobIndex < jobs.count {
+            let job = jobs[nextJobIndex]
+            nextJobIndex += 1
+            inFlight += 1
+            if busySince == nil {
+                busySince = Date()
+            }
+            
+            DispatchQueue.global(qos: .utility).async {
+                let result = self.render(job)
+                
+                self.queue.async {
+                    self.inFlight -= 1
+                    self.queuedUUIDs.remove(job.entity.fic_UUID)
+                    switch result {
+                    case .rendered(let count):
+                        self.counters.rendered += count
+                    case .skipped:
+                        self.counters.skipped += 1
+                    case .failed:
+                        self.counters.failed += 1
+                    }
+                    
+                    self.startJobs()
+                }
+            }
+        }
+        
+        if nextJobIndex == jobs.count && nextJobIndex > 0 {
+            // Everything queued has started: let go of the finished jobs
+            jobs.removeAll()
+            nextJobIndex = 0
+        }
+        
+        finishIfIdle()
+    }
+    
+    // Called on `queue`
+    private func finishIfIdle() {
+        guard inFlight == 0 && (isSuspended || isWaitingForForeground || nextJobIndex == jobs.count) else { return }
+        
+        if let since = busySince {
+            counters.busyTime += Date().timeIntervalSince(since)
+            busySince = nil
+        }
+        
+        DispatchQueue.main.async {
+            self.endBackgroundTask()
+        }
+    }
+    
+    private enum RenderResult {
+        case rendered(Int)
+        case skipped
+        case failed
+    }
+    
+    private func render(_ job: Job) -> RenderResult {
+        let cache = albumArt.cache
+        var renderedCount = 0
+        
+        for format in job.formats where !cache.imageExists(for: job.entity, withFormatName: format.rawValue) {
+            let drawn = autoreleasepool { () -> Bool in
+                var hasDate = false
+                let imageWasDrawn = cache.drawImage(for: job.entity, withFormatName: format.rawValue) { (context, size) in
+                    context.clear(CGRect(origin: .zero, size: size))
+                    UIGraphicsPushContext(context)
+                    hasDate = self.albumArt.drawAlbumArt(for: job.entity, in: size)
+                    UIGraphicsPopContext()
+                }
+                
+                if imageWasDrawn && !hasDate {
+                    // Don't leave a blank image behind: the cell will show its placeholder instead
+                    cache.deleteImage(for: job.entity, withFormatName: format.rawValue)
+                }
+                return imageWasDrawn && hasDate
+            }
+            
+            guard drawn else { return .failed }
+            renderedCount += 1
+        }
+        
+        return renderedCount > 0 ? .rendered(renderedCount) : .skipped
+    }
+    
+    // MARK: Background Execution
+    
+    @objc private func applicationDidEnterBackground() {
+        guard backgroundTask == .invalid else { return }
+        
+        let hasWork = queue.sync { return inFlight > 0 || (!isSuspended && !isWaitingForForeground && nextJobIndex < jobs.count) }
+        guard hasWork else { return }
+        
+        backgroundTask = UIApplication.shared.beginBackgroundTask(withName: "Album art prerender") { [weak self] in
+            // Out of time: keep what's left for when the app is active again
+            guard let s = self else { return }
+            s.queue.sync { s.isWaitingForForeground = true }
+            s.endBackgroundTask()
+        }
+    }
+    
+    @objc private func applicationWillEnterForeground() {
+        endBackgroundTask()
+        
+        queue.async {
+            self.isWaitingForForeground = false
+            self.startJobs()
+        }
+    }
+    
+    private func endBackgroundTask() {
+        guard backgroundTask != .invalid else { return }
+        
+        UIApplication.shared.endBackgroundTask(backgroundTask)
+        backgroundTask = .invalid
+    }
+}
@@ -0,0 +1,32 @@
+//
+//  RelistenAlbumArtRenderer.h
+//  RelistenShared
+//
+//  Copyright © 2018 Alec Gorge. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+#import <UIKit/UIKit.h>
+
+typedef NS_ENUM(NSInteger, RelistenAlbumArtDesign) {
+    RelistenAlbumArtDesignShatterExplosion,
+    RelistenAlbumArtDesignRandomFlowers,
+    RelistenAlbumArtDesignSplash,
+    RelistenAlbumArtDesignCityGlitters,
+};
+
+// Draws the RelistenAlbumArts designs from their compiled display list (see AlbumArtDisplayList.h), rasterizing them
+// straight into the current context's bitmap at whatever size it's drawn at. Contexts that aren't 32-bit RGB bitmaps, or
+// that are rotated or clipped, are drawn into with RelistenAlbumArts instead.
+@interface RelistenAlbumArtRenderer : NSObject
+
+// Draws a design scaled from its 768pt canvas to fill `rect` of the current context
++ (void)drawDesign:(RelistenAlbumArtDesign)design
+     withBaseColor:(UIColor * _Nonnull)color
+              date:(NSString * _Nullable)dateStr
+             venue:(NSString * _Nullable)venueStr
+          location:(NSString * _Nullable)locationStr
+         drawLabel:(BOOL)drawLabel
+            inRect:(CGRect)rect NS_SWIFT_NAME(draw(_:withBaseColor:date:venue:location:drawLabel:in:));
+
+@end
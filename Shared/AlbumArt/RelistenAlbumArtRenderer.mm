@@ -0,0 +1,137 @@
+//
+//  RelistenAlbumArtRenderer.mm
+//  RelistenShared
+//
+//  Copyright © 2018 Alec Gorge. All rights reserved.
+//
+
+#import "RelistenAlbumArtRenderer.h"
+#import "RelistenAlbumArts.h"
+
+#include "AlbumArtDisplayList.h"
+
+// The pixels of the current context that `rect` covers, if the display list can be replayed straight into them
+static BOOL RelistenAlbumArtBitmapForRect(CGContextRef context, CGRect rect, AlbumArt::Bitmap *bitmap) {
+    uint8_t *data = (uint8_t *)CGBitmapContextGetData(context);
+    if (data == NULL || CGBitmapContextGetBitsPerPixel(context) != 32 || CGBitmapContextGetBitsPerComponent(context) != 8) {
+        return NO;
+    }
+
+    // 0xAARRGGBB in native byte order
+    CGBitmapInfo bitmapInfo = CGBitmapContextGetBitmapInfo(context);
+    CGImageAlphaInfo alphaInfo = (CGImageAlphaInfo)(bitmapInfo & kCGBitmapAlphaInfoMask);
+    if ((bitmapInfo & kCGBitmapByteOrderMask) != kCGBitmapByteOrder32Host || (bitmapInfo & kCGBitmapFloatComponents) ||
+        (alphaInfo != kCGImageAlphaPremultipliedFirst && alphaInfo != kCGImageAlphaNoneSkipFirst)) {
+        return NO;
+    }
+    if (CGColorSpaceGetModel(CGBitmapContextGetColorSpace(context)) != kCGColorSpaceModelRGB) {
+        return NO;
+    }
+
+    // UIKit flips user space so y goes down, the same way the bitmap's rows do
+    CGAffineTransform transform = CGContextGetUserSpaceToDeviceSpaceTransform(context);
+    if (transform.b != 0 || transform.c != 0 || transform.a <= 0 || transform.d >= 0) {
+        return NO;
+    }
+    if (!CGRectContainsRect(CGContextGetClipBoundingBox(context), rect)) {
+        return NO;
+    }
+
+    CGRect deviceRect = CGRectApplyAffineTransform(rect, transform);
+    size_t contextHeight = CGBitmapContextGetHeight(context);
+    long x = lround(CGRectGetMinX(deviceRect));
+    long y = lround(contextHeight - CGRectGetMaxY(deviceRect));
+    long width = lround(CGRectGetWidth(deviceRect));
+    long height = lround(CGRectGetHeight(deviceRect));
+    if (x < 0 || y < 0 || width <= 0 || height <= 0 || x + width > (long)CGBitmapContextGetWidth(context) || y + height > (long)contextHeight) {
+        return NO;
+    }
+
+    size_t bytesPerRow = CGBitmapContextGetBytesPerRow(context);
+    bitmap->pixels = (uint32_t *)(data + y * bytesPerRow) + x;
+    bitmap->width = (int)width;
+    bitmap->height = (int)height;
+    bitmap->bytesPerRow = bytesPerRow;
+    return YES;
+}
+
+static UIFont *RelistenAlbumArtLabelFont(const AlbumArt::Label &label) {
+    switch (label.fontStyle) {
+        case AlbumArt::Label::FontStyle::Bold:
+            return [UIFont boldSystemFontOfSize:label.fontSize];
+        case AlbumArt::Label::FontStyle::Italic:
+            return [UIFont italicSystemFontOfSize:label.fontSize];
+        case AlbumArt::Label::FontStyle::Regular:
+            return [UIFont systemFontOfSize:label.fontSize];
+    }
+}
+
+@implementation RelistenAlbumArtRenderer
+
++ (void)drawDesign:(RelistenAlbumArtDesign)design
+     withBaseColor:(UIColor *)color
+              date:(NSString *)dateStr
+             venue:(NSString *)venueStr
+          location:(NSString *)locationStr
+         drawLabel:(BOOL)drawLabel
+            inRect:(CGRect)rect {
+    CGContextRef context = UIGraphicsGetCurrentContext();
+    if (context == NULL || CGRectIsEmpty(rect)) {
+        return;
+    }
+
+    const AlbumArt::DisplayList &displayList = AlbumArt::DisplayList::shared();
+    AlbumArt::Bitmap bitmap;
+    CGFloat red, green, blue, alpha;
+    if ((NSUInteger)design < displayList.designCount() && RelistenAlbumArtBitmapForRect(context, rect, &bitmap) &&
+        [color getRed:&red green:&green blue:&blue alpha:&alpha]) {
+        AlbumArt::Palette palette = AlbumArt::Palette::forBaseColor({(float)red, (float)green, (float)blue, (float)alpha});
+        CGSize canvasScale = CGSizeMake(CGRectGetWidth(rect) / displayList.canvasWidth(), CGRectGetHeight(rect) / displayList.canvasHeight());
+
+        displayList.render((AlbumArt::Design)design, palette, drawLabel, bitmap, [&](const AlbumArt::Label &label) {
+            NSString *textContent = label.text == AlbumArt::Label::Text::Date ? dateStr : label.text == AlbumArt::Label::Text::Venue ? venueStr : locationStr;
+            if (textContent == nil) {
+                return;
+            }
+
+            NSMutableParagraphStyle *style = NSMutableParagraphStyle.defaultParagraphStyle.mutableCopy;
+            style.alignment = NSTextAlignmentLeft;
+            UIColor *textColor = [UIColor colorWithRed:label.color.red green:label.color.green blue:label.color.blue alpha:label.color.alpha];
+            NSDictionary *fontAttributes = @{NSFontAttributeName: RelistenAlbumArtLabelFont(label), NSForegroundColorAttributeName: textColor, NSParagraphStyleAttributeName: style};
+
+            CGRect labelRect = CGRectMake(label.x, label.y, label.width, label.height);
+            CGFloat textHeight = [textContent boundingRectWithSize:CGSizeMake(labelRect.size.width, INFINITY) options:NSStringDrawingUsesLineFragmentOrigin attributes:fontAttributes context:nil].size.height;
+
+            // The pixels below are already drawn, so the label lands on top of them
+            CGContextSaveGState(context);
+            CGContextTranslateCTM(context, CGRectGetMinX(rect), CGRectGetMinY(rect));
+            CGContextScaleCTM(context, canvasScale.width, canvasScale.height);
+            CGContextConcatCTM(context, CGAffineTransformMake(label.transform.a, label.transform.b, label.transform.c, label.transform.d, label.transform.tx, label.transform.ty));
+            CGContextClipToRect(context, labelRect);
+            [textContent drawInRect:CGRectMake(CGRectGetMinX(labelRect), CGRectGetMinY(labelRect) + (CGRectGetHeight(labelRect) - textHeight) / 2, CGRectGetWidth(labelRect), textHeight) withAttributes:fontAttributes];
+            CGContextRestoreGState(context);
+        });
+        return;
+    }
+
+    CGContextSaveGState(context);
+    CGContextTranslateCTM(context, CGRectGetMinX(rect), CGRectGetMinY(rect));
+    CGContextScaleCTM(context, CGRectGetWidth(rect) / 768, CGRectGetHeight(rect) / 768);
+    switch (design) {
+        case RelistenAlbumArtDesignShatterExplosion:
+            [RelistenAlbumArts drawShatterExplosionWithBaseColor:color date:dateStr venue:venueStr location:locationStr drawLabel:drawLabel];
+            break;
+        case RelistenAlbumArtDesignRandomFlowers:
+            [RelistenAlbumArts drawRandomFlowersWithBaseColor:color date:dateStr venue:venueStr location:locationStr drawLabel:drawLabel];
+            break;
+        case RelistenAlbumArtDesignSplash:
+            [RelistenAlbumArts drawSplashWithBaseColor:color date:dateStr venue:venueStr location:locationStr drawLabel:drawLabel];
+            break;
+        case RelistenAlbumArtDesignCityGlitters:
+            [RelistenAlbumArts drawCityGlittersWithBaseColor:color date:dateStr venue:venueStr location:locationStr drawLabel:drawLabel];
+            break;
+    }
+    CGContextRestoreGState(context);
+}
+
+@end
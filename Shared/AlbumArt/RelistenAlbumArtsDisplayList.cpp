@@ -0,0 +1,4632 @@
+//
+//  RelistenAlbumArtsDisplayList.cpp
+//  RelistenShared
+//
+//  Generated by compile_display_list.py from RelistenAlbumArts.m. Don't edit it: change the designs and compile them
+//  again instead.
+//
+
+#include "AlbumArtDisplayList.h"
+
+namespace AlbumArt {
+
+const uint8_t RelistenAlbumArtsDisplayList[] = {
+    0x52, 0x41, 0x44, 0x4c, 0x02, 0x00, 0x04, 0x00, 0x00, 0x03, 0x00, 0x03, 0x2c, 0x00, 0x00, 0x00, 0x4b, 0x6a, 0x00, 0x00, 0x77, 0x6a, 0x00, 0x00,
+    0xa9, 0x9d, 0x00, 0x00, 0x20, 0x08, 0x01, 0x00, 0xfb, 0x63, 0x00, 0x00, 0x1b, 0x6c, 0x01, 0x00, 0x69, 0x44, 0x00, 0x00, 0x33, 0x00, 0x1a, 0x00,
+    0x33, 0x00, 0x4c, 0x00, 0x66, 0x00, 0x80, 0x00, 0x99, 0x00, 0xb2, 0x00, 0xcc, 0x00, 0xe6, 0x00, 0xff, 0x01, 0x1a, 0x01, 0x33, 0x01, 0x4c, 0x01,
+    0x66, 0x01, 0x80, 0x01, 0x99, 0x01, 0xb2, 0x01, 0xcc, 0x01, 0xe6, 0x01, 0xff, 0x02, 0x1a, 0x02, 0x33, 0x02, 0x4c, 0x02, 0x66, 0x02, 0x80, 0x02,
+    0x99, 0x02, 0xb2, 0x02, 0xcc, 0x02, 0xe6, 0x02, 0xff, 0x03, 0x1a, 0x03, 0x33, 0x03, 0x4c, 0x03, 0x66, 0x03, 0x80, 0x03, 0x99, 0x03, 0xb2, 0x03,
+    0xcc, 0x03, 0xe6, 0x03, 0xff, 0x04, 0x1a, 0x04, 0x33, 0x04, 0x4c, 0x04, 0x66, 0x04, 0x80, 0x04, 0x99, 0x04, 0xb2, 0x04, 0xcc, 0x04, 0xe6, 0x04,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0x02, 0x32, 0x00, 0x00, 0x31, 0xff, 0xff, 0x04, 0x6a, 0x00, 0x00, 0x01, 0x05, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x60, 0x00, 0x60, 0x07, 0x00, 0x80, 0x3e, 0x00, 0x19, 0x00, 0x60, 0x00, 0x60, 0x03, 0x02, 0x06, 0x1a, 0x4a, 0x5a, 0x84, 0x0e, 0xfd, 0xf4,
+    0x3a, 0xd6, 0x06, 0xe1, 0x4c, 0x0f, 0x00, 0x01, 0xd5, 0x06, 0xe0, 0x4c, 0x02, 0x0f, 0xfd, 0xdb, 0x44, 0x02, 0xaa, 0xfd, 0xf5, 0x3a, 0x06, 0x0e,
+    0x74, 0xa2, 0x5d, 0x33, 0x5a, 0x77, 0x54, 0xef, 0x5c, 0x13, 0x59, 0x0f, 0x00, 0x01, 0x35, 0x5a, 0xe0, 0x54, 0x02, 0xad, 0x5c, 0x79, 0x54, 0x02,
+    0xed, 0x5c, 0x11, 0x59, 0x06, 0x16, 0x76, 0x90, 0x97, 0x73, 0x4d, 0xd4, 0x21, 0x21, 0x55, 0xac, 0x27, 0x0f, 0x00, 0x01, 0x75, 0x4d, 0x60, 0x26,
+    0x02, 0xca, 0x52, 0xd5, 0x21, 0x02, 0x1f, 0x55, 0xaa, 0x27, 0x06, 0x1d, 0x6e, 0x6b, 0x81, 0x53, 0x30, 0x9f, 0x47, 0xa7, 0x37, 0xea, 0x4a, 0x0f,
+    0x00, 0x01, 0x55, 0x30, 0xa0, 0x47, 0x02, 0x3d, 0x32, 0xe8, 0x4a, 0x02, 0xa5, 0x37, 0x51, 0x49, 0x06, 0x03, 0x5d, 0xa3, 0x91, 0x93, 0x48, 0x5a,
+    0x34, 0xd4, 0x4b, 0x61, 0x3a, 0x0f, 0x00, 0x01, 0x95, 0x48, 0x60, 0x3a, 0x02, 0xd3, 0x4b, 0x9e, 0x38, 0x02, 0x90, 0x4b, 0x5c, 0x34, 0x06, 0x1d,
+    0x47, 0x8b, 0x91, 0x23, 0x40, 0x8e, 0x07, 0x36, 0x4a, 0xc9, 0x0e, 0x0f, 0x00, 0x01, 0x35, 0x4a, 0xa0, 0x0c, 0x02, 0x7c, 0x46, 0xc8, 0x0e, 0x02,
+    0x24, 0x40, 0x90, 0x07, 0x06, 0x19, 0x77, 0x7d, 0x9f, 0x13, 0x1c, 0xa2, 0x45, 0xfd, 0x26, 0x21, 0x4a, 0x0f, 0x00, 0x01, 0x15, 0x1c, 0x20, 0x4a,
+    0x02, 0x38, 0x21, 0xa4, 0x45, 0x02, 0xfc, 0x26, 0x87, 0x49, 0x06, 0x1e, 0x72, 0x61, 0x5f, 0x9b, 0x55, 0x1f, 0x39, 0xb6, 0x57, 0x95, 0x3c, 0x0f,
+    0x00, 0x01, 0xb5, 0x57, 0x20, 0x39, 0x02, 0xe9, 0x55, 0x94, 0x3c, 0x02, 0x9c, 0x55, 0x88, 0x39, 0x06, 0x21, 0x7d, 0xa7, 0x89, 0xbb, 0x47, 0xee,
+    0x16, 0xb6, 0x4d, 0x61, 0x1a, 0x0f, 0x00, 0x01, 0xb5, 0x4d, 0x60, 0x1a, 0x02, 0xbc, 0x47, 0x08, 0x19, 0x02, 0x84, 0x4d, 0xf0, 0x16, 0x06, 0x09,
+    0x66, 0x6b, 0x93, 0x53, 0x3c, 0x2a, 0x2e, 0x4e, 0x42, 0xb9, 0x33, 0x0f, 0x00, 0x01, 0x55, 0x3c, 0x40, 0x32, 0x02, 0xe0, 0x3d, 0x2c, 0x2e, 0x02,
+    0x4c, 0x42, 0xb7, 0x33, 0x06, 0x09, 0x67, 0x5b, 0x66, 0x6f, 0x31, 0x8c, 0x1b, 0x44, 0x38, 0x41, 0x23, 0x0f, 0x00, 0x01, 0xf5, 0x31, 0x40, 0x23,
+    0x02, 0x43, 0x38, 0x8e, 0x1b, 0x02, 0x70, 0x31, 0x1c, 0x1d, 0x06, 0x1d, 0x38, 0x57, 0x82, 0x33, 0x0e, 0x8b, 0x4c, 0x62, 0x16, 0x21, 0x54, 0x0f,
+    0x00, 0x01, 0x35, 0x0e, 0x20, 0x54, 0x02, 0x61, 0x16, 0x8c, 0x4c, 0x02, 0x6d, 0x0e, 0x98, 0x50, 0x06, 0x1d, 0x35, 0x66, 0x76, 0x96, 0x2d, 0xbf,
+    0x12, 0x36, 0x39, 0x44, 0x1f, 0x0f, 0x00, 0x01, 0x35, 0x39, 0xc0, 0x12, 0x02, 0xe6, 0x2f, 0x91, 0x17, 0x02, 0x97, 0x2d, 0x42, 0x1f, 0x06, 0x1b,
+    0x28, 0x86, 0x93, 0xf3, 0x56, 0x5c, 0x00, 0x13, 0x67, 0x41, 0x09, 0x0f, 0x00, 0x01, 0xf5, 0x56, 0x40, 0x09, 0x02, 0x53, 0x60, 0xde, 0x06, 0x02,
+    0x12, 0x67, 0x5d, 0x00, 0x06, 0x09, 0x43, 0x75, 0x5d, 0x93, 0x50, 0x12, 0x5d, 0xbd, 0x57, 0xc1, 0x5f, 0x0f, 0x00, 0x01, 0x95, 0x50, 0xc0, 0x5f,
+    0x02, 0x48, 0x53, 0x54, 0x5d, 0x02, 0xbb, 0x57, 0x14, 0x5d, 0x06, 0x1d, 0x63, 0x83, 0x78, 0xf0, 0x34, 0x1c, 0x3a, 0xb6, 0x3b, 0x20, 0x3e, 0x0f,
+    0x00, 0x01, 0xb5, 0x3b, 0xc0, 0x3b, 0x02, 0x93, 0x38, 0x1f, 0x3e, 0x02, 0xf2, 0x34, 0x1d, 0x3a, 0x06, 0x15, 0x54, 0x8b, 0x83, 0xf5, 0x22, 0x60,
+    0xfa, 0xb6, 0x30, 0x52, 0x05, 0x0f, 0x00, 0x01, 0xb5, 0x30, 0x40, 0x00, 0x02, 0xa5, 0x2b, 0x51, 0x05, 0x02, 0xf6, 0x22, 0x61, 0xfa, 0x06, 0x2e,
+    0x53, 0x84, 0x8b, 0x53, 0x00, 0xff, 0x3a, 0x7a, 0x12, 0x84, 0x43, 0x0f, 0x00, 0x01, 0x55, 0x00, 0x00, 0x3b, 0x02, 0x57, 0x0a, 0x82, 0x43, 0x02,
+    0x79, 0x12, 0x64, 0x40, 0x06, 0x0d, 0x35, 0x73, 0x5d, 0x73, 0x2a, 0x6e, 0x38, 0x14, 0x33, 0x60, 0x3e, 0x0f, 0x00, 0x01, 0x75, 0x2a, 0x00, 0x39,
+    0x02, 0x84, 0x2d, 0x6f, 0x38, 0x02, 0x13, 0x33, 0x5e, 0x3e, 0x06, 0x2e, 0x36, 0x6e, 0x66, 0x35, 0x49, 0x82, 0x04, 0x76, 0x51, 0x21, 0x0e, 0x0f,
+    0x00, 0x01, 0x75, 0x51, 0x20, 0x0e, 0x02, 0x37, 0x49, 0x62, 0x06, 0x02, 0x98, 0x4b, 0x84, 0x04, 0x06, 0x1c, 0x07, 0x72, 0x77, 0x51, 0x52, 0x9d,
+    0x10, 0xd6, 0x5c, 0x81, 0x1b, 0x0f, 0x00, 0x01, 0xd5, 0x5c, 0x80, 0x1b, 0x02, 0xf4, 0x55, 0xff, 0x14, 0x02, 0x53, 0x52, 0x9e, 0x10, 0x06, 0x1a,
+    0x01, 0x9f, 0x9e, 0x86, 0x10, 0x24, 0xf0, 0x76, 0x12, 0x01, 0x00, 0x0f, 0x00, 0x01, 0x75, 0x12, 0x00, 0x00, 0x02, 0x35, 0x12, 0xd3, 0xfd, 0x02,
+    0x88, 0x10, 0x26, 0xf0, 0x06, 0x19, 0x0f, 0x69, 0x5f, 0x53, 0x3e, 0x7f, 0x0c, 0xa1, 0x48, 0x4c, 0x16, 0x0f, 0x00, 0x01, 0x55, 0x3e, 0x80, 0x0c,
+    0x02, 0x9f, 0x48, 0x4b, 0x16, 0x02, 0xca, 0x40, 0xb5, 0x0d, 0x06, 0x1a, 0x69, 0x98, 0x68, 0x6e, 0x37, 0x1f, 0x20, 0xab, 0x3d, 0x3c, 0x21, 0x0f,
+    0x00, 0x01, 0x55, 0x3c, 0x20, 0x20, 0x02, 0x6f, 0x37, 0x60, 0x20, 0x02, 0xaa, 0x3d, 0x3b, 0x21, 0x06, 0x2f, 0x5a, 0x82, 0x75, 0x1f, 0x0e, 0x34,
+    0x4a, 0xf6, 0x1a, 0xa1, 0x52, 0x0f, 0x00, 0x01, 0xf5, 0x1a, 0xa0, 0x52, 0x02, 0xeb, 0x14, 0x36, 0x4a, 0x02, 0x20, 0x0e, 0x6c, 0x4d, 0x06, 0x13,
+    0x4c, 0x86, 0xa5, 0x3c, 0x54, 0xa7, 0x4e, 0xa8, 0x57, 0x01, 0x53, 0x0f, 0x00, 0x01, 0x35, 0x56, 0x00, 0x53, 0x02, 0x3d, 0x54, 0xc0, 0x52, 0x02,
+    0xa6, 0x57, 0xa9, 0x4e, 0x06, 0x1d, 0x75, 0x5d, 0x9e, 0x88, 0x06, 0x54, 0x1a, 0x01, 0x0b, 0x61, 0x20, 0x0f, 0x00, 0x01, 0xf5, 0x06, 0x60, 0x20,
+    0x02, 0x8a, 0x06, 0x55, 0x1a, 0x02, 0xff, 0x0a, 0x8a, 0x1f, 0x06, 0x1d, 0x4b, 0x60, 0x92, 0xf3, 0x32, 0xdf, 0xff, 0x51, 0x3e, 0x7c, 0x08, 0x0f,
+    0x00, 0x01, 0xf5, 0x32, 0xe0, 0xff, 0x02, 0x50, 0x3e, 0x7b, 0x08, 0x02, 0x6b, 0x34, 0x16, 0x06, 0x06, 0x09, 0x59, 0x91, 0x79, 0x13, 0x4d, 0x1f,
+    0x01, 0x5a, 0x57, 0x69, 0x0d, 0x0f, 0x00, 0x01, 0x15, 0x4d, 0x20, 0x01, 0x02, 0x59, 0x57, 0x64, 0x06, 0x02, 0x5c, 0x54, 0x68, 0x0d, 0x06, 0x17,
+    0x1f, 0x63, 0x5e, 0x7b, 0xfc, 0x82, 0x16, 0xd6, 0x0a, 0x01, 0x1d, 0x0f, 0x00, 0x01, 0xd5, 0x0a, 0x00, 0x1d, 0x02, 0xd9, 0xfe, 0x84, 0x16, 0x02,
+    0x7c, 0xfc, 0x28, 0x17, 0x06, 0x14, 0x74, 0x86, 0x99, 0x50, 0x5a, 0x3f, 0x45, 0x15, 0x5f, 0xe0, 0x47, 0x0f, 0x00, 0x01, 0x15, 0x5d, 0x40, 0x45,
+    0x02, 0x14, 0x5f, 0xdf, 0x47, 0x02, 0x52, 0x5a, 0x5d, 0x47, 0x06, 0x09, 0x05, 0x63, 0x9f, 0x53, 0x2c, 0x7c, 0xf9, 0x74, 0x39, 0xe1, 0x04, 0x0f,
+    0x00, 0x01, 0x55, 0x2c, 0xe0, 0x04, 0x02, 0x84, 0x2e, 0x6f, 0x03, 0x02, 0x72, 0x39, 0x7d, 0xf9, 0x06, 0x26, 0x51, 0x85, 0x64, 0xdc, 0x0c, 0x73,
+    0x4a, 0xd6, 0x0d, 0xa1, 0x50, 0x0f, 0x00, 0x01, 0xd5, 0x0d, 0xa0, 0x50, 0x02, 0x69, 0x0d, 0x75, 0x4a, 0x02, 0xde, 0x0c, 0x89, 0x4b, 0x06, 0x1d,
+    0x73, 0x79, 0x96, 0x1f, 0x04, 0x84, 0x04, 0x16, 0x18, 0x0d, 0x10, 0x0f, 0x00, 0x01, 0x15, 0x18, 0x60, 0x0d, 0x02, 0x9b, 0x0c, 0x86, 0x04, 0x02,
+    0x20, 0x04, 0x0b, 0x10, 0x06, 0x01, 0x73, 0x85, 0x9c, 0xb3, 0x13, 0x6c, 0x41, 0x52, 0x20, 0xc1, 0x46, 0x0f, 0x00, 0x01, 0xb5, 0x13, 0xc0, 0x46,
+    0x02, 0xe3, 0x1a, 0x6e, 0x41, 0x02, 0x50, 0x20, 0xdc, 0x45, 0x06, 0x1d, 0x6b, 0x9c, 0x65, 0x35, 0x16, 0x80, 0x32, 0x96, 0x1b, 0xc2, 0x37, 0x0f,
+    0x00, 0x01, 0x95, 0x1b, 0x80, 0x33, 0x02, 0xb5, 0x1a, 0xc1, 0x37, 0x02, 0x36, 0x16, 0x81, 0x32, 0x06, 0x2a, 0x79, 0x7e, 0x5e, 0x15, 0xfe, 0x01,
+    0x2f, 0x17, 0x04, 0xc1, 0x37, 0x0f, 0x00, 0x01, 0xf5, 0x00, 0xc0, 0x37, 0x02, 0x16, 0x04, 0xe1, 0x2f, 0x02, 0x17, 0xfe, 0x02, 0x2f, 0x06, 0x1d,
+    0x11, 0x7b, 0x8f, 0x73, 0x01, 0x1f, 0x21, 0x57, 0x16, 0xa1, 0x2d, 0x0f, 0x00, 0x01, 0x75, 0x01, 0xa0, 0x2d, 0x02, 0xe5, 0x0a, 0xb1, 0x29, 0x02,
+    0x56, 0x16, 0x21, 0x21, 0x06, 0x04, 0x2a, 0x99, 0x9c, 0x94, 0x54, 0x5f, 0x42, 0xd6, 0x55, 0xe1, 0x43, 0x0f, 0x00, 0x01, 0xd5, 0x55, 0xa0, 0x43,
+    0x02, 0x95, 0x55, 0xe0, 0x43, 0x02, 0x95, 0x54, 0x60, 0x42, 0x06, 0x17, 0x1a, 0x90, 0x7e, 0x89, 0xf7, 0xd4, 0xf6, 0x56, 0x04, 0xc1, 0x00, 0x0f,
+    0x00, 0x01, 0x55, 0x04, 0xc0, 0x00, 0x02, 0x8b, 0xf7, 0xd6, 0xf6, 0x02, 0x60, 0x00, 0xac, 0xfb, 0x06, 0x23, 0x6f, 0x62, 0x96, 0x13, 0x4d, 0x5f,
+    0x40, 0xea, 0x4e, 0x75, 0x41, 0x0f, 0x00, 0x01, 0x15, 0x4d, 0x60, 0x40, 0x02, 0xe8, 0x4e, 0x34, 0x41, 0x02, 0x5c, 0x4d, 0x74, 0x41, 0x06, 0x1f,
+    0x68, 0x5a, 0x65, 0xbb, 0x24, 0x5f, 0x56, 0xf6, 0x28, 0xb1, 0x5b, 0x0f, 0x00, 0x01, 0xf5, 0x28, 0x60, 0x56, 0x02, 0xbc, 0x24, 0x68, 0x57, 0x02,
+    0xfc, 0x24, 0xaf, 0x5b, 0x06, 0x12, 0x15, 0xa5, 0xa0, 0x73, 0x4b, 0xdf, 0x36, 0x15, 0x50, 0x00, 0x39, 0x0f, 0x00, 0x01, 0x75, 0x4b, 0xe0, 0x36,
+    0x02, 0x13, 0x50, 0xbe, 0x38, 0x02, 0xd3, 0x4f, 0xfe, 0x38, 0x06, 0x0b, 0x73, 0x7b, 0x68, 0x85, 0x52, 0xd0, 0x48, 0x99, 0x56, 0x01, 0x4c, 0x0f,
+    0x00, 0x01, 0x55, 0x54, 0x00, 0x4c, 0x02, 0x86, 0x52, 0xd1, 0x48, 0x02, 0x97, 0x56, 0x83, 0x49, 0x06, 0x16, 0x1c, 0x5d, 0x61, 0x23, 0x03, 0xbf,
+    0x0e, 0x96, 0x0c, 0x91, 0x10, 0x0f, 0x00, 0x01, 0x15, 0x04, 0xc0, 0x0e, 0x02, 0x24, 0x03, 0x00, 0x0f, 0x02, 0x94, 0x0c, 0x90, 0x10, 0x06, 0x27,
+    0x48, 0x7c, 0xa5, 0x7a, 0x23, 0x46, 0x16, 0x56, 0x30, 0x45, 0x1b, 0x0f, 0x00, 0x01, 0x55, 0x30, 0x00, 0x1b, 0x02, 0x58, 0x29, 0x44, 0x1b, 0x02,
+    0x7c, 0x23, 0x47, 0x16, 0x06, 0x30, 0x31, 0x7c, 0x62, 0x6a, 0x2a, 0x3f, 0x3a, 0x96, 0x33, 0x39, 0x40, 0x0f, 0x00, 0x01, 0x95, 0x33, 0x40, 0x3a,
+    0x02, 0xa0, 0x2e, 0x2c, 0x3b, 0x02, 0x6c, 0x2a, 0x37, 0x40, 0x06, 0x1d, 0x66, 0x77, 0x70, 0x21, 0x59, 0x7b, 0x2a, 0x92, 0x5a, 0xe1, 0x32, 0x0f,
+    0x00, 0x01, 0xb5, 0x59, 0xe0, 0x32, 0x02, 0x23, 0x59, 0x2e, 0x2d, 0x02, 0x91, 0x5a, 0x7c, 0x2a, 0x06, 0x1a, 0x54, 0x58, 0x73, 0x33, 0x15, 0xea,
+    0x09, 0x3c, 0x1d, 0x81, 0x1a, 0x0f, 0x00, 0x01, 0x75, 0x15, 0x80, 0x1a, 0x02, 0x35, 0x15, 0xc6, 0x0f, 0x02, 0x3b, 0x1d, 0xec, 0x09, 0x06, 0x1d,
+    0x38, 0x80, 0xa6, 0xf3, 0x5a, 0xbf, 0x2c, 0xbb, 0x61, 0xf4, 0x31, 0x0f, 0x00, 0x01, 0xf5, 0x5a, 0xc0, 0x2c, 0x02, 0x67, 0x5e, 0xb3, 0x31, 0x02,
+    0xba, 0x61, 0xf3, 0x31, 0x06, 0x08, 0x7e, 0x61, 0x56, 0x33, 0x2c, 0x3b, 0x0e, 0x32, 0x31, 0x70, 0x18, 0x0f, 0x00, 0x01, 0x35, 0x2c, 0x60, 0x0e,
+    0x02, 0xe3, 0x2c, 0x6e, 0x18, 0x02, 0x31, 0x31, 0x3c, 0x0e, 0x06, 0x1b, 0x2a, 0x6d, 0x89, 0x53, 0x20, 0x3f, 0x26, 0xe7, 0x29, 0x93, 0x31, 0x0f,
+    0x00, 0x01, 0x55, 0x20, 0x40, 0x26, 0x02, 0x0d, 0x23, 0x39, 0x2d, 0x02, 0xe6, 0x29, 0x91, 0x31, 0x06, 0x1d, 0x3c, 0x9d, 0x8a, 0x4d, 0x15, 0xd8,
+    0x17, 0xb3, 0x1c, 0x41, 0x26, 0x0f, 0x00, 0x01, 0x95, 0x1b, 0x40, 0x26, 0x02, 0xb2, 0x1c, 0xdd, 0x20, 0x02, 0x4e, 0x15, 0xda, 0x17, 0x06, 0x09,
+    0x4a, 0x77, 0x6f, 0x25, 0x51, 0xa1, 0xfc, 0xf6, 0x5b, 0x41, 0x0b, 0x0f, 0x00, 0x01, 0xf5, 0x5b, 0x40, 0x0b, 0x02, 0x26, 0x51, 0x12, 0x01, 0x02,
+    0x77, 0x55, 0xa3, 0xfc, 0x06, 0x1d, 0x4b, 0x97, 0x7d, 0xf3, 0x41, 0x23, 0x21, 0x29, 0x46, 0x61, 0x28, 0x0f, 0x00, 0x01, 0xf5, 0x41, 0x60, 0x28,
+    0x02, 0x27, 0x46, 0x93, 0x24, 0x02, 0x3a, 0x45, 0x25, 0x21, 0x06, 0x27, 0x17, 0xa6, 0x97, 0x04, 0x54, 0xe0, 0x34, 0x96, 0x59, 0x41, 0x3b, 0x0f,
+    0x00, 0x01, 0x95, 0x59, 0x40, 0x3b, 0x02, 0x55, 0x59, 0xd1, 0x39, 0x02, 0x05, 0x54, 0xe2, 0x34, 0x06, 0x30, 0x78, 0x9c, 0xa4, 0x7b, 0x19, 0xdf,
+    0x0b, 0x45, 0x24, 0xe9, 0x12, 0x0f, 0x00, 0x01, 0x75, 0x22, 0xe0, 0x0b, 0x02, 0x7c, 0x19, 0xe7, 0x12, 0x02, 0x44, 0x24, 0x6f, 0x12, 0x06, 0x17,
+    0x60, 0x64, 0x91, 0x0f, 0x12, 0xfd, 0x04, 0x16, 0x1f, 0x01, 0x08, 0x0f, 0x00, 0x01, 0x15, 0x1f, 0x00, 0x08, 0x02, 0x53, 0x14, 0xfe, 0x04, 0x02,
+    0x11, 0x12, 0x1c, 0x07, 0x06, 0x1d, 0x7d, 0x8e, 0x59, 0xfc, 0x40, 0xff, 0x56, 0x56, 0x46, 0x66, 0x5a, 0x0f, 0x00, 0x01, 0x55, 0x46, 0x00, 0x57,
+    0x02, 0x99, 0x44, 0x64, 0x5a, 0x02, 0xfe, 0x40, 0x29, 0x57, 0x06, 0x09, 0x4e, 0x6e, 0x84, 0xb3, 0x22, 0xb6, 0x17, 0x8e, 0x2b, 0x3d, 0x1f, 0x0f,
+    0x00, 0x01, 0xb5, 0x22, 0xe0, 0x1b, 0x02, 0x50, 0x25, 0x3c, 0x1f, 0x02, 0x8c, 0x2b, 0xb7, 0x17, 0x06, 0x18, 0x52, 0x70, 0x81, 0xac, 0xf5, 0x7f,
+    0x08, 0xf6, 0x00, 0xf3, 0x23, 0x0f, 0x00, 0x01, 0xf5, 0x00, 0x80, 0x08, 0x02, 0xad, 0xf5, 0xb9, 0x16, 0x02, 0x46, 0xf9, 0xf1, 0x23, 0x06, 0x31,
+    0x22, 0x9e, 0x87, 0x99, 0x36, 0x84, 0x00, 0x16, 0x40, 0xa1, 0x08, 0x0f, 0x00, 0x01, 0x15, 0x40, 0xa0, 0x08, 0x02, 0xc8, 0x3e, 0x53, 0x05, 0x02,
+    0x9b, 0x36, 0x86, 0x00, 0x06, 0x19, 0x4e, 0x94, 0x81, 0x52, 0x2f, 0xbe, 0x08, 0x06, 0x34, 0x01, 0x17, 0x0f, 0x00, 0x01, 0xd5, 0x32, 0x00, 0x17,
+    0x02, 0x04, 0x34, 0x30, 0x10, 0x02, 0x54, 0x2f, 0xbf, 0x08, 0x06, 0x09, 0x6c, 0x72, 0x84, 0xb3, 0x02, 0x9a, 0x2b, 0xb4, 0x0c, 0x81, 0x3d, 0x0f,
+    0x00, 0x01, 0xb5, 0x02, 0x80, 0x3d, 0x02, 0xb3, 0x0c, 0x7e, 0x35, 0x02, 0x10, 0x06, 0x9c, 0x2b, 0x06, 0x27, 0x6f, 0x6d, 0x85, 0x41, 0x10, 0x3f,
+    0x50, 0x92, 0x14, 0xd0, 0x57, 0x0f, 0x00, 0x01, 0x75, 0x11, 0x40, 0x50, 0x02, 0x43, 0x10, 0xce, 0x57, 0x02, 0x91, 0x14, 0x7c, 0x54, 0x06, 0x20,
+    0x55, 0x71, 0xaa, 0xcf, 0x20, 0xfb, 0x04, 0xaf, 0x24, 0x01, 0x0e, 0x0f, 0x00, 0x01, 0x15, 0x22, 0x00, 0x0e, 0x02, 0xd1, 0x20, 0xfc, 0x04, 0x02,
+    0xad, 0x24, 0xf8, 0x0d, 0x06, 0x1b, 0x6f, 0x96, 0x84, 0x13, 0x12, 0x9f, 0x25, 0x97, 0x1c, 0xc3, 0x2e, 0x0f, 0x00, 0x01, 0x15, 0x12, 0xa0, 0x2a,
+    0x02, 0x96, 0x1c, 0xa1, 0x25, 0x02, 0x17, 0x1a, 0xc2, 0x2e, 0x06, 0x1d, 0x65, 0x7a, 0x74, 0x55, 0x17, 0xcf, 0xfc, 0x27, 0x23, 0x21, 0x00, 0x0f,
+    0x00, 0x01, 0x75, 0x1c, 0x20, 0x00, 0x02, 0x26, 0x23, 0xd1, 0xfc, 0x02, 0x57, 0x17, 0x02, 0xfe, 0x06, 0x1d, 0x72, 0x9d, 0x8f, 0xa9, 0x07, 0xff,
+    0xff, 0x76, 0x0f, 0x2e, 0x10, 0x0f, 0x00, 0x01, 0x75, 0x0f, 0x00, 0x00, 0x02, 0xab, 0x07, 0x16, 0x0b, 0x02, 0x41, 0x0e, 0x2c, 0x10, 0x06, 0x13,
+    0x5d, 0xa2, 0x92, 0x33, 0x46, 0xe8, 0x36, 0x0b, 0x49, 0x41, 0x39, 0x0f, 0x00, 0x01, 0x35, 0x46, 0x40, 0x39, 0x02, 0x09, 0x49, 0x94, 0x38, 0x02,
+    0xc9, 0x48, 0xe9, 0x36, 0x06, 0x1b, 0x78, 0x91, 0x5c, 0xd3, 0x58, 0x1f, 0x11, 0x42, 0x60, 0x19, 0x1b, 0x0f, 0x00, 0x01, 0xd5, 0x58, 0x20, 0x11,
+    0x02, 0x40, 0x60, 0xec, 0x11, 0x02, 0x0c, 0x5e, 0x17, 0x1b, 0x06, 0x1c, 0x76, 0x60, 0x85, 0xa8, 0x57, 0x54, 0xf9, 0xc1, 0x60, 0x21, 0x07, 0x0f,
+    0x00, 0x01, 0xd5, 0x58, 0x20, 0x07, 0x02, 0xbf, 0x60, 0x0b, 0x01, 0x02, 0xaa, 0x57, 0x55, 0xf9, 0x06, 0x14, 0x48, 0x80, 0x61, 0x9f, 0x4c, 0xdf,
+    0x3d, 0x96, 0x4f, 0xa8, 0x3f, 0x0f, 0x00, 0x01, 0x95, 0x4f, 0x20, 0x3e, 0x02, 0x1b, 0x4e, 0xe0, 0x3d, 0x02, 0xa1, 0x4c, 0xa6, 0x3f, 0x06, 0x31,
+    0x1d, 0x93, 0xa6, 0x73, 0x5f, 0xdf, 0x23, 0x89, 0x6a, 0x8b, 0x29, 0x0f, 0x00, 0x01, 0x75, 0x5f, 0xe0, 0x23, 0x02, 0x7e, 0x67, 0x49, 0x29, 0x02,
+    0x87, 0x6a, 0x89, 0x29, 0x06, 0x13, 0x2c, 0x9d, 0x97, 0x02, 0x02, 0xed, 0x58, 0xd6, 0x03, 0x99, 0x61, 0x0f, 0x00, 0x01, 0xd5, 0x03, 0xa0, 0x5f,
+    0x02, 0x8c, 0x03, 0x97, 0x61, 0x02, 0x03, 0x02, 0xee, 0x58, 0x06, 0x1d, 0x5d, 0x85, 0x82, 0x20, 0x16, 0xdf, 0x58, 0xec, 0x1a, 0x2e, 0x64, 0x0f,
+    0x00, 0x01, 0xd5, 0x18, 0xe0, 0x58, 0x02, 0xeb, 0x1a, 0xd6, 0x5e, 0x02, 0x21, 0x16, 0x2c, 0x64, 0x06, 0x19, 0x33, 0x73, 0x5b, 0xb3, 0x5e, 0x1f,
+    0x41, 0xf5, 0x66, 0xb1, 0x44, 0x0f, 0x00, 0x01, 0xb5, 0x5e, 0x60, 0x41, 0x02, 0xa4, 0x61, 0x20, 0x41, 0x02, 0xf4, 0x66, 0xaf, 0x44, 0x06, 0x31,
+    0x2e, 0x93, 0xa0, 0x73, 0x01, 0xbf, 0x52, 0x49, 0x0a, 0x06, 0x60, 0x0f, 0x00, 0x01, 0x75, 0x01, 0xc0, 0x52, 0x02, 0x47, 0x0a, 0x72, 0x5e, 0x02,
+    0xd9, 0x07, 0x04, 0x60, 0x06, 0x13, 0x26, 0xa0, 0x67, 0x06, 0x1b, 0x3f, 0x47, 0xa0, 0x1f, 0x94, 0x4b, 0x0f, 0x00, 0x01, 0x15, 0x1f, 0x40, 0x47,
+    0x02, 0x9e, 0x1f, 0x29, 0x48, 0x02, 0x07, 0x1b, 0x93, 0x4b, 0x06, 0x18, 0x17, 0x6d, 0x7d, 0xb3, 0x41, 0x7f, 0x4f, 0x0b, 0x44, 0x76, 0x51, 0x0f,
+    0x00, 0x01, 0xb5, 0x41, 0x80, 0x4f, 0x02, 0x0a, 0x44, 0x75, 0x51, 0x02, 0x5e, 0x42, 0x6a, 0x50, 0x06, 0x09, 0x07, 0x9c, 0x5e, 0xdc, 0xf9, 0xbf,
+    0x46, 0x96, 0x03, 0xaa, 0x52, 0x0f, 0x00, 0x01, 0x95, 0x03, 0xc0, 0x46, 0x02, 0x09, 0x02, 0xf4, 0x47, 0x02, 0xdd, 0xf9, 0xa9, 0x52, 0x06, 0x14,
+    0x5f, 0x79, 0x7a, 0xc0, 0x37, 0xbf, 0x0b, 0x96, 0x43, 0x68, 0x14, 0x0f, 0x00, 0x01, 0x95, 0x43, 0xc0, 0x0b, 0x02, 0xbb, 0x3c, 0x66, 0x14, 0x02,
+    0xc1, 0x37, 0x8c, 0x0f, 0x06, 0x31, 0x62, 0x9d, 0x92, 0x5f, 0xfc, 0x3f, 0x00, 0xcc, 0x09, 0x6d, 0x14, 0x0f, 0x00, 0x01, 0xb5, 0x07, 0x40, 0x00,
+    0x02, 0xcb, 0x09, 0xd6, 0x0e, 0x02, 0x61, 0xfc, 0x6c, 0x14, 0x06, 0x09, 0x6a, 0x77, 0x6d, 0xd0, 0x0d, 0x7f, 0x50, 0x56, 0x18, 0xb0, 0x57, 0x0f,
+    0x00, 0x01, 0x55, 0x18, 0x80, 0x50, 0x02, 0x04, 0x12, 0xaf, 0x57, 0x02, 0xd2, 0x0d, 0x7d, 0x52, 0x06, 0x31, 0x52, 0x77, 0x5f, 0x09, 0x46, 0xdf,
+    0x0f, 0x21, 0x4b, 0xf7, 0x16, 0x0f, 0x00, 0x01, 0x15, 0x48, 0xe0, 0x0f, 0x02, 0x0a, 0x46, 0xf5, 0x16, 0x02, 0x1f, 0x4b, 0xab, 0x10, 0x06, 0x1c,
+    0x34, 0x62, 0x84, 0x2a, 0x00, 0x56, 0x1d, 0xd6, 0x0c, 0x81, 0x2e, 0x0f, 0x00, 0x01, 0xd5, 0x0c, 0x80, 0x2e, 0x02, 0x10, 0x02, 0xdc, 0x26, 0x02,
+    0x2c, 0x00, 0x57, 0x1d, 0x06, 0x19, 0x0a, 0x93, 0x8c, 0x90, 0x1d, 0xfb, 0x07, 0x50, 0x27, 0xbb, 0x0e, 0x0f, 0x00, 0x01, 0xb5, 0x24, 0x60, 0x0c,
+    0x02, 0x91, 0x1d, 0xfd, 0x07, 0x02, 0x4e, 0x27, 0xb9, 0x0e, 0x06, 0x18, 0x6f, 0x61, 0xa0, 0xb3, 0x35, 0x9f, 0x46, 0xf1, 0x39, 0xd6, 0x4a, 0x0f,
+    0x00, 0x01, 0xb5, 0x35, 0xa0, 0x46, 0x02, 0xef, 0x39, 0x5a, 0x4a, 0x02, 0x49, 0x36, 0xd4, 0x4a, 0x06, 0x19, 0x6e, 0x8b, 0x67, 0xb4, 0x54, 0x1f,
+    0x53, 0x16, 0x58, 0xe2, 0x57, 0x0f, 0x00, 0x01, 0x15, 0x58, 0x20, 0x54, 0x02, 0xb5, 0x54, 0x20, 0x53, 0x02, 0xd5, 0x56, 0xe1, 0x57, 0x06, 0x1c,
+    0x4a, 0x87, 0x91, 0xd6, 0x30, 0x01, 0x2c, 0x96, 0x35, 0xb3, 0x31, 0x0f, 0x00, 0x01, 0x95, 0x35, 0x00, 0x30, 0x02, 0xa6, 0x33, 0xb1, 0x31, 0x02,
+    0xd7, 0x30, 0x03, 0x2c, 0x06, 0x13, 0x37, 0xa5, 0x7e, 0xa7, 0x3e, 0x3f, 0x23, 0x36, 0x46, 0x15, 0x27, 0x0f, 0x00, 0x01, 0x35, 0x46, 0x40, 0x23,
+    0x02, 0xce, 0x45, 0x1a, 0x25, 0x02, 0xa8, 0x3e, 0x13, 0x27, 0x06, 0x1b, 0x5b, 0x8d, 0x9b, 0xb3, 0x57, 0x29, 0x3d, 0x81, 0x5c, 0xa7, 0x41, 0x0f,
+    0x00, 0x01, 0xb5, 0x57, 0xe0, 0x40, 0x02, 0xda, 0x5a, 0xa5, 0x41, 0x02, 0x7f, 0x5c, 0x2b, 0x3d, 0x06, 0x23, 0x63, 0x6e, 0x90, 0xf3, 0x40, 0xbf,
+    0x1f, 0x16, 0x4a, 0x61, 0x25, 0x0f, 0x00, 0x01, 0x15, 0x4a, 0x60, 0x25, 0x02, 0x95, 0x43, 0xc0, 0x1f, 0x02, 0xf5, 0x40, 0xa0, 0x23, 0x06, 0x06,
+    0x71, 0x6b, 0x8a, 0x37, 0x43, 0xc2, 0x53, 0x36, 0x44, 0x29, 0x55, 0x0f, 0x00, 0x01, 0x35, 0x44, 0xa0, 0x54, 0x02, 0x79, 0x43, 0xc4, 0x53, 0x02,
+    0x39, 0x43, 0x28, 0x55, 0x06, 0x13, 0x43, 0xa4, 0x7e, 0xb3, 0x18, 0x20, 0x35, 0xe7, 0x1c, 0x61, 0x44, 0x0f, 0x00, 0x01, 0xb5, 0x18, 0x60, 0x44,
+    0x02, 0xe5, 0x1c, 0x91, 0x3c, 0x02, 0x96, 0x1c, 0x21, 0x35, 0x06, 0x30, 0x27, 0x9a, 0x9e, 0xf3, 0x2f, 0x3f, 0x3a, 0x7b, 0x34, 0xaa, 0x3f, 0x0f,
+    0x00, 0x01, 0xf5, 0x2f, 0x40, 0x3a, 0x02, 0x79, 0x34, 0xe4, 0x3e, 0x02, 0x9e, 0x33, 0xa9, 0x3f, 0x06, 0x0d, 0x5f, 0x7d, 0x83, 0x53, 0x09, 0x3f,
+    0x24, 0xec, 0x13, 0x9c, 0x2d, 0x0f, 0x00, 0x01, 0x55, 0x09, 0x40, 0x24, 0x02, 0x50, 0x0e, 0x9b, 0x2d, 0x02, 0xea, 0x13, 0x56, 0x29, 0x06, 0x1d,
+    0x76, 0x5e, 0x91, 0xf3, 0x1e, 0x9f, 0x0a, 0x7b, 0x27, 0x4b, 0x0f, 0x0f, 0x00, 0x01, 0xf5, 0x1e, 0xa0, 0x0a, 0x02, 0x7a, 0x27, 0xe5, 0x0d, 0x02,
+    0xde, 0x1f, 0x4a, 0x0f, 0x06, 0x09, 0x0c, 0x82, 0x8a, 0x93, 0x4b, 0xdf, 0x34, 0xce, 0x4f, 0x19, 0x3b, 0x0f, 0x00, 0x01, 0x95, 0x4b, 0xe0, 0x34,
+    0x02, 0xd1, 0x4d, 0xbc, 0x38, 0x02, 0xcd, 0x4f, 0x18, 0x3b, 0x06, 0x13, 0x65, 0x73, 0x7a, 0xfd, 0x45, 0x24, 0x25, 0x76, 0x50, 0x4c, 0x28, 0x0f,
+    0x00, 0x01, 0x75, 0x50, 0x80, 0x26, 0x02, 0xba, 0x49, 0x25, 0x25, 0x02, 0xff, 0x45, 0x4a, 0x28, 0x06, 0x10, 0x30, 0x8d, 0x5a, 0x76, 0x39, 0x24,
+    0x42, 0xf6, 0x3b, 0x24, 0x44, 0x0f, 0x00, 0x01, 0xf5, 0x3b, 0x40, 0x42, 0x02, 0x77, 0x39, 0x23, 0x44, 0x02, 0x1a, 0x3b, 0x25, 0x42, 0x06, 0x1d,
+    0x50, 0x78, 0x5e, 0x1c, 0x23, 0x93, 0x04, 0xd6, 0x2f, 0xaa, 0x0f, 0x0f, 0x00, 0x01, 0xd5, 0x2f, 0xc0, 0x05, 0x02, 0x69, 0x28, 0x94, 0x04, 0x02,
+    0x1d, 0x23, 0xa9, 0x0f, 0x06, 0x17, 0x73, 0x89, 0x6a, 0xf3, 0x54, 0x4c, 0x0a, 0x44, 0x61, 0x39, 0x13, 0x0f, 0x00, 0x01, 0xf5, 0x54, 0x80, 0x0c,
+    0x02, 0x6c, 0x5c, 0x37, 0x13, 0x02, 0x43, 0x61, 0x4e, 0x0a, 0x06, 0x1d, 0x4e, 0xa3, 0x86, 0x53, 0x21, 0xea, 0xf2, 0x3c, 0x2a, 0xe1, 0x06, 0x0f,
+    0x00, 0x01, 0x55, 0x21, 0xe0, 0x06, 0x02, 0x3a, 0x2a, 0x66, 0xfe, 0x02, 0x80, 0x29, 0xeb, 0xf2, 0x06, 0x1e, 0x16, 0x7e, 0x70, 0x56, 0x0a, 0xe1,
+    0x4d, 0xf6, 0x18, 0x01, 0x55, 0x0f, 0x00, 0x01, 0xf5, 0x18, 0x00, 0x55, 0x02, 0x76, 0x11, 0x22, 0x50, 0x02, 0x58, 0x0a, 0xe3, 0x4d, 0x06, 0x03,
+    0x6f, 0x75, 0x99, 0x33, 0x1a, 0xbf, 0x45, 0x16, 0x22, 0xe1, 0x4d, 0x0f, 0x00, 0x01, 0x35, 0x1a, 0x40, 0x4c, 0x02, 0x35, 0x1d, 0xc0, 0x45, 0x02,
+    0x14, 0x22, 0xe0, 0x4d, 0x06, 0x22, 0x79, 0x91, 0x63, 0xec, 0x54, 0x3f, 0x5d, 0x16, 0x5a, 0x9e, 0x61, 0x0f, 0x00, 0x01, 0x15, 0x5a, 0x40, 0x5d,
+    0x02, 0x91, 0x58, 0x9d, 0x61, 0x02, 0xee, 0x54, 0xf9, 0x5d, 0x06, 0x08, 0x52, 0x85, 0x9b, 0xe6, 0x13, 0xa8, 0x1d, 0x40, 0x1d, 0x41, 0x25, 0x0f,
+    0x00, 0x01, 0x35, 0x19, 0x40, 0x25, 0x02, 0x3e, 0x1d, 0xaa, 0x1d, 0x02, 0xe8, 0x13, 0xf3, 0x23, 0x06, 0x09, 0x3a, 0x9d, 0x73, 0xb3, 0x1b, 0xd2,
+    0x53, 0x50, 0x1d, 0x01, 0x5d, 0x0f, 0x00, 0x01, 0xb5, 0x1b, 0x00, 0x5d, 0x02, 0x4f, 0x1d, 0x1a, 0x57, 0x02, 0x0f, 0x1d, 0xd4, 0x53, 0x06, 0x14,
+    0x79, 0x5e, 0xa6, 0x76, 0x3a, 0x1f, 0x35, 0x1c, 0x3e, 0xa7, 0x3a, 0x0f, 0x00, 0x01, 0xd5, 0x3a, 0x20, 0x35, 0x02, 0x77, 0x3a, 0x63, 0x3a, 0x02,
+    0x1a, 0x3e, 0xa5, 0x3a, 0x06, 0x00, 0x5a, 0x80, 0x87, 0x73, 0x4b, 0xce, 0x46, 0xe5, 0x4d, 0x3f, 0x49, 0x0f, 0x00, 0x01, 0x75, 0x4b, 0x40, 0x48,
+    0x02, 0xe4, 0x4d, 0xcf, 0x46, 0x02, 0xb3, 0x4c, 0x3e, 0x49, 0x06, 0x1d, 0x3a, 0x86, 0x5a, 0xb3, 0x39, 0x67, 0x34, 0x0b, 0x3d, 0x41, 0x39, 0x0f,
+    0x00, 0x01, 0xb5, 0x39, 0x40, 0x39, 0x02, 0x09, 0x3d, 0xb4, 0x34, 0x02, 0x9e, 0x3b, 0x69, 0x34, 0x06, 0x0f, 0x5f, 0xa1, 0x6c, 0x93, 0x23, 0x3f,
+    0x03, 0xf7, 0x25, 0x03, 0x06, 0x0f, 0x00, 0x01, 0x95, 0x23, 0x40, 0x03, 0x02, 0xb6, 0x25, 0x01, 0x06, 0x02, 0xf6, 0x25, 0x02, 0x04, 0x06, 0x1d,
+    0x51, 0x7e, 0x6e, 0xa9, 0x2b, 0xea, 0x48, 0xb6, 0x2e, 0x81, 0x4e, 0x0f, 0x00, 0x01, 0xb5, 0x2e, 0x80, 0x4e, 0x02, 0xab, 0x2b, 0x96, 0x4a, 0x02,
+    0x20, 0x2d, 0xec, 0x48, 0x06, 0x1d, 0x34, 0x9d, 0x6f, 0x73, 0x04, 0xda, 0x37, 0xa4, 0x0b, 0xe1, 0x43, 0x0f, 0x00, 0x01, 0x75, 0x04, 0xe0, 0x43,
+    0x02, 0xa3, 0x0b, 0x8e, 0x3b, 0x02, 0x91, 0x0a, 0xdc, 0x37, 0x06, 0x00, 0x31, 0x86, 0x65, 0x33, 0x56, 0x9f, 0x26, 0x2e, 0x5d, 0xf9, 0x2d, 0x0f,
+    0x00, 0x01, 0x35, 0x56, 0xa0, 0x26, 0x02, 0x41, 0x5a, 0x0c, 0x28, 0x02, 0x2c, 0x5d, 0xf8, 0x2d, 0x06, 0x1d, 0x39, 0x58, 0x7d, 0xf3, 0x02, 0xff,
+    0x4d, 0x2d, 0x0b, 0x8f, 0x55, 0x0f, 0x00, 0x01, 0xf5, 0x02, 0x00, 0x4e, 0x02, 0x35, 0x03, 0x97, 0x51, 0x02, 0x2c, 0x0b, 0x8e, 0x55, 0x06, 0x09,
+    0x56, 0x7a, 0x79, 0x19, 0x45, 0xdf, 0x04, 0x82, 0x48, 0xce, 0x15, 0x0f, 0x00, 0x01, 0x95, 0x46, 0xe0, 0x04, 0x02, 0x1b, 0x45, 0x06, 0x0c, 0x02,
+    0x81, 0x48, 0xcc, 0x15, 0x06, 0x07, 0x78, 0x8d, 0xa2, 0xe9, 0x03, 0x9a, 0x3a, 0xb6, 0x0d, 0x58, 0x42, 0x0f, 0x00, 0x01, 0xb5, 0x0d, 0xa0, 0x41,
+    0x02, 0x50, 0x0a, 0x9b, 0x3a, 0x02, 0xeb, 0x03, 0x56, 0x42, 0x06, 0x13, 0x39, 0x9f, 0x86, 0x70, 0x1c, 0x9f, 0x53, 0xf6, 0x1f, 0xfe, 0x5d, 0x0f,
+    0x00, 0x01, 0xf5, 0x1f, 0xa0, 0x53, 0x02, 0x83, 0x1f, 0x8e, 0x59, 0x02, 0x72, 0x1c, 0xfd, 0x5d, 0x06, 0x2d, 0x2b, 0x5e, 0x6b, 0x53, 0x10, 0xfa,
+    0x58, 0x24, 0x15, 0x90, 0x62, 0x0f, 0x00, 0x01, 0x55, 0x10, 0x80, 0x5b, 0x02, 0x23, 0x15, 0x8e, 0x62, 0x02, 0xd1, 0x10, 0xfc, 0x58, 0x06, 0x18,
+    0x4d, 0x6c, 0x60, 0xd3, 0x5e, 0x5f, 0x3c, 0x57, 0x63, 0xe1, 0x3e, 0x0f, 0x00, 0x01, 0xd5, 0x5e, 0xe0, 0x3e, 0x02, 0x05, 0x60, 0xb1, 0x3c, 0x02,
+    0x56, 0x63, 0x61, 0x3c, 0x06, 0x21, 0x75, 0x6f, 0x95, 0x06, 0x26, 0xb8, 0x5a, 0x96, 0x2e, 0x14, 0x61, 0x0f, 0x00, 0x01, 0x95, 0x2e, 0x80, 0x5f,
+    0x02, 0xae, 0x28, 0xb9, 0x5a, 0x02, 0x07, 0x26, 0x13, 0x61, 0x06, 0x06, 0x7d, 0x5b, 0x66, 0x93, 0x3a, 0xff, 0x2e, 0xe7, 0x3f, 0x03, 0x36, 0x0f,
+    0x00, 0x01, 0x95, 0x3a, 0x00, 0x2f, 0x02, 0xe5, 0x3f, 0x71, 0x30, 0x02, 0xf6, 0x3a, 0x01, 0x36, 0x06, 0x11, 0x10, 0x7f, 0x8a, 0x13, 0x17, 0x7f,
+    0x1b, 0x5f, 0x25, 0x6a, 0x27, 0x0f, 0x00, 0x01, 0x15, 0x17, 0x80, 0x1b, 0x02, 0x19, 0x1e, 0xe4, 0x22, 0x02, 0x5e, 0x25, 0x69, 0x27, 0x06, 0x0b,
+    0x7c, 0x60, 0x64, 0x33, 0x00, 0x1f, 0x51, 0x97, 0x0a, 0xb2, 0x56, 0x0f, 0x00, 0x01, 0x35, 0x00, 0x20, 0x51, 0x02, 0x85, 0x01, 0xb1, 0x56, 0x02,
+    0x96, 0x0a, 0x21, 0x52, 0x06, 0x13, 0x76, 0x85, 0x9f, 0x92, 0xf9, 0x6e, 0x28, 0x76, 0x0a, 0x20, 0x2f, 0x0f, 0x00, 0x01, 0x75, 0x0a, 0x40, 0x2e,
+    0x02, 0x24, 0x03, 0x6f, 0x28, 0x02, 0x94, 0xf9, 0x1f, 0x2f, 0x06, 0x07, 0x64, 0x91, 0x91, 0x8b, 0x28, 0xdb, 0x0b, 0xf6, 0x33, 0xd9, 0x12, 0x0f,
+    0x00, 0x01, 0xf5, 0x33, 0xc0, 0x10, 0x02, 0x91, 0x30, 0xdc, 0x0b, 0x02, 0x8c, 0x28, 0xd8, 0x12, 0x06, 0x1d, 0x7d, 0xa6, 0x95, 0xca, 0x42, 0x1f,
+    0x0b, 0xb6, 0x47, 0x39, 0x14, 0x0f, 0x00, 0x01, 0x75, 0x47, 0x20, 0x0b, 0x02, 0xb5, 0x47, 0x37, 0x14, 0x02, 0xcc, 0x42, 0xee, 0x11, 0x06, 0x18,
+    0x5a, 0x79, 0x80, 0x25, 0x11, 0xc2, 0x0c, 0x3a, 0x14, 0x61, 0x14, 0x0f, 0x00, 0x01, 0x75, 0x12, 0x60, 0x14, 0x02, 0x26, 0x11, 0x92, 0x10, 0x02,
+    0x38, 0x14, 0xc4, 0x0c, 0x06, 0x27, 0x2e, 0x8d, 0x6e, 0x53, 0x22, 0xbf, 0x48, 0x81, 0x2b, 0x97, 0x49, 0x0f, 0x00, 0x01, 0x55, 0x22, 0xc0, 0x48,
+    0x02, 0x6a, 0x28, 0x00, 0x49, 0x02, 0x7f, 0x2b, 0x95, 0x49, 0x06, 0x31, 0x27, 0x6d, 0x78, 0x53, 0x22, 0xf0, 0x3e, 0xa8, 0x28, 0xe1, 0x44, 0x0f,
+    0x00, 0x01, 0x55, 0x22, 0xe0, 0x44, 0x02, 0xa6, 0x28, 0xf2, 0x3e, 0x02, 0x18, 0x24, 0x64, 0x41, 0x06, 0x20, 0x65, 0x89, 0x8d, 0xf6, 0x27, 0xdf,
+    0x16, 0xc7, 0x2f, 0xc4, 0x23, 0x0f, 0x00, 0x01, 0xb5, 0x2c, 0xe0, 0x16, 0x02, 0xc6, 0x2f, 0x71, 0x1f, 0x02, 0xf7, 0x27, 0xc2, 0x23, 0x06, 0x26,
+    0x75, 0x62, 0x81, 0x53, 0x06, 0x3f, 0x59, 0x5b, 0x10, 0xec, 0x66, 0x0f, 0x00, 0x01, 0x55, 0x06, 0x40, 0x59, 0x02, 0x5a, 0x10, 0x65, 0x60, 0x02,
+    0xdf, 0x07, 0xea, 0x66, 0x06, 0x24, 0x6e, 0x99, 0x72, 0x11, 0x56, 0x3f, 0x06, 0xf3, 0x5f, 0x1e, 0x17, 0x0f, 0x00, 0x01, 0xf5, 0x5d, 0x40, 0x06,
+    0x02, 0x13, 0x56, 0xfe, 0x0b, 0x02, 0xf1, 0x5f, 0x1c, 0x17, 0x06, 0x1a, 0x26, 0x79, 0x6c, 0x33, 0x44, 0xf4, 0x0c, 0x0b, 0x54, 0x21, 0x11, 0x0f,
+    0x00, 0x01, 0x35, 0x44, 0x20, 0x11, 0x02, 0xef, 0x4a, 0x1b, 0x0e, 0x02, 0x0a, 0x54, 0xf5, 0x0c, 0x06, 0x0d, 0x0f, 0x81, 0x74, 0x13, 0x48, 0xd5,
+    0x28, 0xed, 0x4e, 0x41, 0x2f, 0x0f, 0x00, 0x01, 0x15, 0x48, 0x40, 0x2f, 0x02, 0xa0, 0x4b, 0x2b, 0x2b, 0x02, 0xeb, 0x4e, 0xd6, 0x28, 0x06, 0x19,
+    0x04, 0x7f, 0x83, 0xb3, 0x04, 0xf3, 0x0f, 0xeb, 0x11, 0xa1, 0x14, 0x0f, 0x00, 0x01, 0xb5, 0x04, 0xa0, 0x14, 0x02, 0x2f, 0x0b, 0x7a, 0x12, 0x02,
+    0xe9, 0x11, 0xf5, 0x0f, 0x06, 0x13, 0x76, 0x81, 0x9e, 0x93, 0x38, 0xe7, 0x17, 0x26, 0x3f, 0xc1, 0x1d, 0x0f, 0x00, 0x01, 0x95, 0x38, 0xc0, 0x1d,
+    0x02, 0xfc, 0x3b, 0xe8, 0x17, 0x02, 0x24, 0x3f, 0xf0, 0x1c, 0x06, 0x19, 0x25, 0x73, 0x8c, 0xab, 0x4b, 0xd6, 0x41, 0x36, 0x50, 0x41, 0x46, 0x0f,
+    0x00, 0x01, 0x35, 0x50, 0x40, 0x46, 0x02, 0x41, 0x4d, 0xac, 0x44, 0x02, 0xac, 0x4b, 0xd8, 0x41, 0x06, 0x1a, 0x6d, 0x7c, 0x70, 0x33, 0x21, 0xff,
+    0x11, 0xb0, 0x24, 0xb5, 0x1a, 0x0f, 0x00, 0x01, 0x35, 0x21, 0x00, 0x12, 0x02, 0xae, 0x24, 0xba, 0x14, 0x02, 0xc8, 0x22, 0xb3, 0x1a, 0x06, 0x0a,
+    0x5b, 0x91, 0x87, 0xad, 0x26, 0xbb, 0x01, 0x56, 0x35, 0xfb, 0x05, 0x0f, 0x00, 0x01, 0x55, 0x35, 0x40, 0x04, 0x02, 0xf2, 0x30, 0xbd, 0x01, 0x02,
+    0xae, 0x26, 0xfa, 0x05, 0x06, 0x1d, 0x49, 0x71, 0x8b, 0x65, 0x54, 0x5f, 0x4b, 0x76, 0x58, 0x05, 0x50, 0x0f, 0x00, 0x01, 0x75, 0x58, 0x60, 0x4b,
+    0x02, 0x67, 0x54, 0x52, 0x4e, 0x02, 0xb9, 0x55, 0x04, 0x50, 0x06, 0x1d, 0x0b, 0x75, 0x82, 0x93, 0x3a, 0xf6, 0xf8, 0x8d, 0x46, 0x61, 0x07, 0x0f,
+    0x00, 0x01, 0x95, 0x3a, 0x60, 0x07, 0x02, 0x20, 0x3f, 0xac, 0x00, 0x02, 0x8c, 0x46, 0xf7, 0xf8, 0x06, 0x1d, 0x1b, 0x7e, 0x90, 0x14, 0x45, 0x5f,
+    0x44, 0xf6, 0x47, 0x02, 0x46, 0x0f, 0x00, 0x01, 0x75, 0x46, 0x80, 0x45, 0x02, 0xf5, 0x47, 0x00, 0x46, 0x02, 0x15, 0x45, 0x60, 0x44, 0x06, 0x16,
+    0x06, 0x83, 0x7f, 0x53, 0x07, 0x7f, 0x30, 0xc9, 0x1b, 0x14, 0x36, 0x0f, 0x00, 0x01, 0x55, 0x07, 0x80, 0x30, 0x02, 0x7e, 0x12, 0x4a, 0x33, 0x02,
+    0xc7, 0x1b, 0x13, 0x36, 0x06, 0x09, 0x0a, 0xa3, 0x62, 0xeb, 0x5e, 0x1f, 0x37, 0xd6, 0x5f, 0xb9, 0x3a, 0x0f, 0x00, 0x01, 0xd5, 0x5f, 0x20, 0x37,
+    0x02, 0xec, 0x5e, 0xb7, 0x3a, 0x02, 0xc3, 0x5f, 0xaf, 0x37, 0x06, 0x1b, 0x35, 0xa7, 0x7b, 0xed, 0x0e, 0xf8, 0x42, 0x36, 0x17, 0x15, 0x4a, 0x0f,
+    0x00, 0x01, 0xf5, 0x16, 0x20, 0x46, 0x02, 0x35, 0x17, 0xfa, 0x42, 0x02, 0xee, 0x0e, 0x13, 0x4a, 0x06, 0x13, 0x70, 0x7f, 0x6a, 0x5f, 0x21, 0x4a,
+    0xff, 0xd6, 0x27, 0x39, 0x08, 0x0f, 0x00, 0x01, 0xd5, 0x27, 0x80, 0x01, 0x02, 0x60, 0x21, 0x4c, 0xff, 0x02, 0x8c, 0x24, 0x37, 0x08, 0x06, 0x27,
+    0x5e, 0x84, 0x87, 0x62, 0x4d, 0xc6, 0x19, 0xfe, 0x51, 0xa1, 0x1d, 0x0f, 0x00, 0x01, 0xf5, 0x4f, 0xa0, 0x1d, 0x02, 0xfc, 0x51, 0xc8, 0x19, 0x02,
+    0x64, 0x4d, 0x0f, 0x1c, 0x06, 0x13, 0x55, 0x93, 0x5a, 0x10, 0x33, 0x1b, 0x4f, 0x56, 0x36, 0x81, 0x53, 0x0f, 0x00, 0x01, 0x55, 0x36, 0x80, 0x53,
+    0x02, 0x12, 0x33, 0x1d, 0x4f, 0x02, 0x6e, 0x35, 0x5d, 0x4f, 0x06, 0x15, 0x03, 0xa5, 0x58, 0xf3, 0x25, 0xe7, 0x2d, 0x1e, 0x2a, 0xc1, 0x34, 0x0f,
+    0x00, 0x01, 0xf5, 0x25, 0xc0, 0x34, 0x02, 0x1d, 0x2a, 0xe8, 0x2d, 0x02, 0xdd, 0x29, 0x28, 0x2e, 0x06, 0x2b, 0x6d, 0x98, 0x70, 0xb3, 0x4c, 0x9e,
+    0x11, 0x34, 0x58, 0xc0, 0x16, 0x0f, 0x00, 0x01, 0xb5, 0x4c, 0x40, 0x13, 0x02, 0xd4, 0x55, 0x9f, 0x11, 0x02, 0x33, 0x58, 0xbe, 0x16, 0x06, 0x16,
+    0x69, 0x96, 0x6c, 0xab, 0x52, 0xba, 0x47, 0x76, 0x56, 0x01, 0x4a, 0x0f, 0x00, 0x01, 0x75, 0x56, 0x00, 0x4a, 0x02, 0x90, 0x55, 0xbc, 0x47, 0x02,
+    0xac, 0x52, 0x57, 0x48, 0x06, 0x28, 0x79, 0x5a, 0x60, 0xee, 0x24, 0x7f, 0x22, 0xcc, 0x2b, 0xfc, 0x26, 0x0f, 0x00, 0x01, 0x55, 0x25, 0x80, 0x22,
+    0x02, 0xf0, 0x24, 0xfb, 0x26, 0x02, 0xcb, 0x2b, 0x16, 0x23, 0x06, 0x14, 0x24, 0x9a, 0x5e, 0x9d, 0x01, 0xff, 0x3a, 0x69, 0x0c, 0xab, 0x43, 0x0f,
+    0x00, 0x01, 0x55, 0x0a, 0x00, 0x3b, 0x02, 0x9e, 0x01, 0xaa, 0x43, 0x02, 0x68, 0x0c, 0xf3, 0x3b, 0x06, 0x16, 0x4d, 0x80, 0x97, 0xae, 0x00, 0x59,
+    0x27, 0xb3, 0x04, 0x01, 0x31, 0x0f, 0x00, 0x01, 0xb5, 0x02, 0x00, 0x31, 0x02, 0xb2, 0x04, 0xdd, 0x2e, 0x02, 0xaf, 0x00, 0x5a, 0x27, 0x06, 0x1a,
+    0x7d, 0x6f, 0xa4, 0xf3, 0x2c, 0xcf, 0x08, 0x18, 0x35, 0x61, 0x12, 0x0f, 0x00, 0x01, 0xf5, 0x2c, 0x60, 0x12, 0x02, 0x65, 0x2f, 0xd1, 0x08, 0x02,
+    0x16, 0x35, 0xc1, 0x11, 0x06, 0x1d, 0x69, 0x87, 0x7a, 0xb8, 0x02, 0xa8, 0x35, 0x80, 0x0c, 0x81, 0x3f, 0x0f, 0x00, 0x01, 0x75, 0x08, 0x80, 0x3f,
+    0x02, 0xba, 0x02, 0xe5, 0x39, 0x02, 0x7f, 0x0c, 0xaa, 0x35, 0x06, 0x14, 0x7a, 0xa6, 0x7f, 0xf1, 0x03, 0x1d, 0x0e, 0xd2, 0x08, 0xa1, 0x0e, 0x0f,
+    0x00, 0x01, 0x95, 0x08, 0xa0, 0x0e, 0x02, 0xf3, 0x03, 0x5e, 0x0e, 0x02, 0xd1, 0x08, 0x1e, 0x0e, 0x06, 0x13, 0x34, 0xa3, 0x8c, 0x70, 0x51, 0xd7,
+    0x24, 0x56, 0x54, 0x61, 0x28, 0x0f, 0x00, 0x01, 0x15, 0x54, 0x60, 0x28, 0x02, 0x55, 0x54, 0x1c, 0x27, 0x02, 0x71, 0x51, 0xd9, 0x24, 0x06, 0x07,
+    0x4b, 0x57, 0x75, 0x45, 0x0d, 0xbf, 0x4c, 0xf6, 0x15, 0x04, 0x5b, 0x0f, 0x00, 0x01, 0xf5, 0x15, 0xc0, 0x4c, 0x02, 0x86, 0x0d, 0x31, 0x52, 0x02,
+    0x46, 0x0d, 0x03, 0x5b, 0x06, 0x14, 0x79, 0x6f, 0x62, 0x5d, 0x22, 0x68, 0x1b, 0x76, 0x2c, 0x17, 0x24, 0x0f, 0x00, 0x01, 0x75, 0x2c, 0xc0, 0x1c,
+    0x02, 0x6a, 0x25, 0x15, 0x24, 0x02, 0x5e, 0x22, 0x6a, 0x1b, 0x06, 0x13, 0x7e, 0x57, 0x77, 0xe9, 0x34, 0xf4, 0xfa, 0x81, 0x3c, 0xc1, 0x07, 0x0f,
+    0x00, 0x01, 0x15, 0x35, 0xc0, 0x07, 0x02, 0x7f, 0x3c, 0x0b, 0x00, 0x02, 0xea, 0x34, 0xf5, 0xfa, 0x06, 0x24, 0x25, 0x6b, 0x7c, 0xc1, 0x38, 0x66,
+    0x2f, 0x7d, 0x3d, 0x70, 0x33, 0x0f, 0x00, 0x01, 0xf5, 0x39, 0x40, 0x31, 0x02, 0x7c, 0x3d, 0x67, 0x2f, 0x02, 0xc3, 0x38, 0x6e, 0x33, 0x06, 0x11,
+    0x7e, 0x9b, 0xa9, 0x2b, 0x49, 0x8a, 0x49, 0x16, 0x4b, 0x61, 0x4c, 0x0f, 0x00, 0x01, 0x15, 0x4b, 0x60, 0x4c, 0x02, 0xc1, 0x4a, 0x8c, 0x49, 0x02,
+    0x2c, 0x49, 0x58, 0x4c, 0x06, 0x1d, 0x5a, 0x7b, 0x72, 0xf3, 0x07, 0xb1, 0x46, 0x90, 0x10, 0x21, 0x55, 0x0f, 0x00, 0x01, 0xf5, 0x07, 0x20, 0x55,
+    0x02, 0x8e, 0x10, 0x9a, 0x4b, 0x02, 0xc7, 0x0b, 0xb3, 0x46, 0x06, 0x28, 0x6a, 0x91, 0x96, 0x93, 0x1a, 0x0d, 0x31, 0x93, 0x1e, 0x01, 0x37, 0x0f,
+    0x00, 0x01, 0x95, 0x1a, 0x00, 0x37, 0x02, 0x63, 0x1d, 0x0e, 0x31, 0x02, 0x92, 0x1e, 0x9d, 0x35, 0x06, 0x2f, 0x74, 0xa2, 0x59, 0x53, 0x3a, 0xec,
+    0x0c, 0xb0, 0x3d, 0xdb, 0x15, 0x0f, 0x00, 0x01, 0x55, 0x3a, 0x60, 0x0d, 0x02, 0x62, 0x3d, 0xed, 0x0c, 0x02, 0xae, 0x3d, 0xda, 0x15, 0x06, 0x06,
+    0x76, 0xa2, 0x6d, 0x51, 0x35, 0xfc, 0x37, 0x16, 0x38, 0x81, 0x3b, 0x0f, 0x00, 0x01, 0x15, 0x38, 0x80, 0x3b, 0x02, 0xd5, 0x37, 0xfe, 0x37, 0x02,
+    0x53, 0x35, 0xfc, 0x38, 0x06, 0x19, 0x61, 0x5b, 0x63, 0x32, 0x41, 0x9e, 0x5e, 0xb6, 0x46, 0xe0, 0x60, 0x0f, 0x00, 0x01, 0x95, 0x41, 0x00, 0x5f,
+    0x02, 0xb4, 0x46, 0x9f, 0x5e, 0x02, 0x34, 0x41, 0xdf, 0x60, 0x06, 0x13, 0x17, 0x59, 0x69, 0x73, 0x4c, 0xff, 0x16, 0x93, 0x51, 0x3a, 0x21, 0x0f,
+    0x00, 0x01, 0x75, 0x4c, 0x00, 0x17, 0x02, 0xb5, 0x4c, 0x5c, 0x19, 0x02, 0x91, 0x51, 0x39, 0x21, 0x06, 0x19, 0x1e, 0x7d, 0x69, 0xcb, 0x22, 0xf7,
+    0x33, 0x36, 0x27, 0x81, 0x37, 0x0f, 0x00, 0x01, 0x35, 0x27, 0x80, 0x37, 0x02, 0xcc, 0x22, 0xf8, 0x33, 0x02, 0xe4, 0x24, 0xd0, 0x34, 0x06, 0x1b,
+    0x7a, 0x60, 0x95, 0xf3, 0x5f, 0x47, 0x2e, 0xdf, 0x61, 0x01, 0x32, 0x0f, 0x00, 0x01, 0xf5, 0x5f, 0x00, 0x32, 0x02, 0x35, 0x60, 0x49, 0x2e, 0x02,
+    0xdd, 0x61, 0x11, 0x31, 0x06, 0x27, 0x78, 0x63, 0x8d, 0x79, 0x5e, 0x3f, 0x09, 0xc2, 0x67, 0x08, 0x0e, 0x0f, 0x00, 0x01, 0xf5, 0x5f, 0x40, 0x09,
+    0x02, 0x7b, 0x5e, 0x06, 0x0e, 0x02, 0xc1, 0x67, 0x6c, 0x0c, 0x06, 0x2c, 0x7f, 0xa9, 0x8b, 0xcb, 0xfe, 0x9f, 0x2a, 0x26, 0x07, 0x72, 0x38, 0x0f,
+    0x00, 0x01, 0x15, 0x07, 0xa0, 0x2a, 0x02, 0xcd, 0xfe, 0x78, 0x33, 0x02, 0x25, 0x07, 0x70, 0x38, 0x06, 0x16, 0x0b, 0x89, 0x7d, 0xf2, 0x2a, 0xff,
+    0x19, 0x96, 0x35, 0xa0, 0x29, 0x0f, 0x00, 0x01, 0x95, 0x35, 0x00, 0x1a, 0x02, 0x84, 0x31, 0x4f, 0x21, 0x02, 0xf3, 0x2a, 0x9e, 0x29, 0x06, 0x00,
+    0x57, 0x7e, 0x72, 0xed, 0x38, 0xac, 0x16, 0x36, 0x42, 0x5b, 0x1c, 0x0f, 0x00, 0x01, 0x35, 0x42, 0xa0, 0x18, 0x02, 0x62, 0x3d, 0xad, 0x16, 0x02,
+    0xef, 0x38, 0x5a, 0x1c, 0x06, 0x12, 0x51, 0xa7, 0x75, 0x54, 0x11, 0x40, 0x22, 0xf6, 0x18, 0xa1, 0x30, 0x0f, 0x00, 0x01, 0xb5, 0x18, 0xa0, 0x30,
+    0x02, 0xf5, 0x18, 0xa1, 0x27, 0x02, 0x56, 0x11, 0x42, 0x22, 0x06, 0x09, 0x29, 0x76, 0x5b, 0x73, 0x24, 0x5f, 0x28, 0xb4, 0x32, 0xdf, 0x30, 0x0f,
+    0x00, 0x01, 0x75, 0x24, 0x60, 0x28, 0x02, 0x04, 0x2a, 0xef, 0x28, 0x02, 0xb3, 0x32, 0xde, 0x30, 0x06, 0x1d, 0x7f, 0xa9, 0x89, 0x22, 0xfb, 0xff,
+    0x11, 0x73, 0x06, 0xff, 0x24, 0x0f, 0x00, 0x01, 0x55, 0x06, 0x00, 0x12, 0x02, 0x24, 0xfb, 0x8f, 0x1d, 0x02, 0x72, 0x06, 0xfd, 0x24, 0x06, 0x11,
+    0x76, 0x69, 0x92, 0xb3, 0x1b, 0x40, 0x22, 0x7a, 0x21, 0xa1, 0x29, 0x0f, 0x00, 0x01, 0xb5, 0x1b, 0xa0, 0x29, 0x02, 0x17, 0x1d, 0x42, 0x22, 0x02,
+    0x79, 0x21, 0x84, 0x27, 0x06, 0x0a, 0x79, 0x79, 0xa0, 0x10, 0x2a, 0x3f, 0x5f, 0x90, 0x2e, 0xdf, 0x63, 0x0f, 0x00, 0x01, 0xf5, 0x2b, 0x40, 0x5f,
+    0x02, 0x12, 0x2a, 0xdd, 0x63, 0x02, 0x8f, 0x2e, 0x5a, 0x63, 0x06, 0x16, 0x3d, 0x7c, 0xa4, 0x2e, 0x01, 0x99, 0x40, 0x13, 0x05, 0xff, 0x4b, 0x0f,
+    0x00, 0x01, 0xf5, 0x02, 0x40, 0x4b, 0x02, 0x12, 0x05, 0xfd, 0x4b, 0x02, 0x2f, 0x01, 0x9a, 0x40, 0x06, 0x0c, 0x4f, 0x62, 0x7b, 0x73, 0x23, 0x65,
+    0x4c, 0x1c, 0x2a, 0xad, 0x51, 0x0f, 0x00, 0x01, 0x75, 0x23, 0xc0, 0x4e, 0x02, 0x1b, 0x2a, 0x66, 0x4c, 0x02, 0x81, 0x24, 0xac, 0x51, 0x06, 0x11,
+    0x75, 0x8e, 0x5f, 0xb1, 0xff, 0x9d, 0xf5, 0xb5, 0x02, 0x61, 0x02, 0x0f, 0x00, 0x01, 0xb5, 0x01, 0x60, 0x02, 0x02, 0xb4, 0x02, 0x1f, 0xf7, 0x02,
+    0xb3, 0xff, 0x9e, 0xf5, 0x06, 0x21, 0x51, 0x78, 0xa0, 0x4b, 0x4f, 0x97, 0x51, 0xd6, 0x53, 0x51, 0x55, 0x0f, 0x00, 0x01, 0xd5, 0x53, 0xe0, 0x54,
+    0x02, 0x4d, 0x4f, 0x98, 0x51, 0x02, 0x24, 0x51, 0x50, 0x55, 0x06, 0x12, 0x74, 0xa0, 0x91, 0x33, 0x1e, 0xc8, 0x20, 0x20, 0x27, 0xd5, 0x24, 0x0f,
+    0x00, 0x01, 0x35, 0x1e, 0xa0, 0x23, 0x02, 0x1f, 0x27, 0xca, 0x20, 0x02, 0x08, 0x26, 0xd4, 0x24, 0x06, 0x14, 0x49, 0x69, 0x7a, 0x85, 0x0e, 0x01,
+    0x34, 0x16, 0x15, 0x61, 0x3c, 0x0f, 0x00, 0x01, 0x15, 0x15, 0x60, 0x3c, 0x02, 0x86, 0x0e, 0xb2, 0x37, 0x02, 0x17, 0x10, 0x03, 0x34, 0x06, 0x0f,
+    0x5c, 0x7e, 0x79, 0xbf, 0x00, 0x55, 0x21, 0x76, 0x12, 0x2e, 0x23, 0x0f, 0x00, 0x01, 0x75, 0x12, 0x20, 0x22, 0x02, 0x4b, 0x09, 0x56, 0x21, 0x02,
+    0xc1, 0x00, 0x2c, 0x23, 0x06, 0x1d, 0x6e, 0x87, 0x70, 0x14, 0x51, 0x1f, 0x2a, 0x56, 0x5c, 0xb2, 0x2d, 0x0f, 0x00, 0x01, 0x55, 0x5c, 0x20, 0x2a,
+    0x02, 0xa5, 0x57, 0xb1, 0x2d, 0x02, 0x16, 0x51, 0x41, 0x2b, 0x06, 0x27, 0x4e, 0x80, 0x69, 0x93, 0x12, 0x25, 0xfd, 0x04, 0x2b, 0x01, 0x08, 0x0f,
+    0x00, 0x01, 0x95, 0x12, 0x00, 0x08, 0x02, 0xfc, 0x1e, 0x27, 0xfd, 0x02, 0x02, 0x2b, 0xad, 0xff, 0x06, 0x13, 0x2c, 0x57, 0x8e, 0x13, 0x22, 0x13,
+    0x1b, 0x6a, 0x29, 0x69, 0x22, 0x0f, 0x00, 0x01, 0x15, 0x22, 0x00, 0x20, 0x02, 0x69, 0x29, 0x14, 0x1b, 0x02, 0x3d, 0x22, 0x68, 0x22, 0x06, 0x27,
+    0x77, 0x5c, 0x69, 0x73, 0x56, 0x77, 0x02, 0x66, 0x60, 0x01, 0x05, 0x0f, 0x00, 0x01, 0x75, 0x56, 0x00, 0x05, 0x02, 0x4d, 0x57, 0x78, 0x02, 0x02,
+    0x65, 0x60, 0x10, 0x03, 0x06, 0x1a, 0x66, 0x88, 0x80, 0x15, 0xfe, 0x5f, 0x22, 0xd7, 0x09, 0x82, 0x29, 0x0f, 0x00, 0x01, 0x15, 0x05, 0x60, 0x22,
+    0x02, 0xd5, 0x09, 0x81, 0x29, 0x02, 0x16, 0xfe, 0x01, 0x26, 0x06, 0x0b, 0x45, 0x8f, 0x9e, 0xbb, 0xfd, 0x5f, 0x07, 0x16, 0x07, 0xa9, 0x11, 0x0f,
+    0x00, 0x01, 0x15, 0x07, 0x60, 0x07, 0x02, 0x28, 0x04, 0x34, 0x10, 0x02, 0xbc, 0xfd, 0xa7, 0x11, 0x06, 0x19, 0x74, 0x78, 0x99, 0x13, 0x3d, 0x6e,
+    0x48, 0xf4, 0x3f, 0x21, 0x49, 0x0f, 0x00, 0x01, 0x15, 0x3d, 0x20, 0x49, 0x02, 0x44, 0x3e, 0x6f, 0x48, 0x02, 0xf3, 0x3f, 0xfe, 0x48, 0x06, 0x00,
+    0x71, 0x78, 0x9a, 0x61, 0x25, 0xdf, 0x2b, 0xed, 0x2b, 0x38, 0x2d, 0x0f, 0x00, 0x01, 0x15, 0x28, 0xe0, 0x2b, 0x02, 0xec, 0x2b, 0x37, 0x2d, 0x02,
+    0x62, 0x25, 0xf7, 0x2c, 0x06, 0x27, 0x49, 0x69, 0x83, 0xa9, 0x25, 0x7f, 0x3a, 0x56, 0x2d, 0x7d, 0x3c, 0x0f, 0x00, 0x01, 0x55, 0x2d, 0x80, 0x3a,
+    0x02, 0x70, 0x27, 0x7b, 0x3c, 0x02, 0xab, 0x25, 0x96, 0x3b, 0x06, 0x21, 0x7b, 0x5e, 0x8e, 0xb7, 0x2f, 0x9f, 0x34, 0x98, 0x34, 0xe5, 0x3b, 0x0f,
+    0x00, 0x01, 0x35, 0x30, 0xa0, 0x34, 0x02, 0x96, 0x34, 0x82, 0x39, 0x02, 0xb8, 0x2f, 0xe4, 0x3b, 0x06, 0x05, 0x4d, 0x89, 0x8c, 0x8f, 0xf0, 0x1a,
+    0xfd, 0x76, 0x06, 0x4f, 0x05, 0x0f, 0x00, 0x01, 0x75, 0x06, 0x60, 0x02, 0x02, 0x03, 0xfe, 0x4e, 0x05, 0x02, 0x90, 0xf0, 0x1c, 0xfd, 0x06, 0x07,
+    0x3c, 0x8a, 0x9d, 0x33, 0x55, 0xdf, 0x50, 0xb1, 0x57, 0x6f, 0x55, 0x0f, 0x00, 0x01, 0x35, 0x55, 0xe0, 0x50, 0x02, 0xc2, 0x56, 0x6e, 0x55, 0x02,
+    0xb0, 0x57, 0xbb, 0x54, 0x06, 0x1d, 0x21, 0x6e, 0xa8, 0xce, 0x0d, 0xda, 0xf9, 0xcc, 0x17, 0x21, 0x03, 0x0f, 0x00, 0x01, 0xb5, 0x10, 0xe0, 0x02,
+    0x02, 0xd0, 0x0d, 0x20, 0x03, 0x02, 0xcb, 0x17, 0xdb, 0xf9, 0x06, 0x13, 0x07, 0x62, 0x67, 0x7d, 0x33, 0xa8, 0x0e, 0x16, 0x3e, 0xa1, 0x16, 0x0f,
+    0x00, 0x01, 0x15, 0x3e, 0xa0, 0x16, 0x02, 0x2a, 0x35, 0x55, 0x10, 0x02, 0x7e, 0x33, 0xaa, 0x0e, 0x06, 0x16, 0x0f, 0x8a, 0x7e, 0x80, 0x11, 0xbf,
+    0x45, 0x36, 0x1b, 0x4f, 0x4e, 0x0f, 0x00, 0x01, 0x35, 0x1b, 0xc0, 0x45, 0x02, 0x9b, 0x17, 0xe7, 0x49, 0x02, 0x82, 0x11, 0x4d, 0x4e, 0x06, 0x2c,
+    0x78, 0x9f, 0x85, 0xf3, 0x0a, 0xb1, 0x25, 0xcf, 0x12, 0xfb, 0x2b, 0x0f, 0x00, 0x01, 0xf5, 0x0a, 0x40, 0x29, 0x02, 0xce, 0x12, 0xf9, 0x2b, 0x02,
+    0xc7, 0x11, 0xb2, 0x25, 0x06, 0x1a, 0x12, 0xa3, 0x97, 0x13, 0x00, 0xff, 0x5b, 0x9e, 0x0a, 0x49, 0x68, 0x0f, 0x00, 0x01, 0x15, 0x00, 0x00, 0x5c,
+    0x02, 0xb9, 0x09, 0x84, 0x65, 0x02, 0x9d, 0x0a, 0x48, 0x68, 0x06, 0x27, 0x4b, 0x76, 0x71, 0x73, 0x3d, 0x97, 0x1d, 0x07, 0x49, 0x12, 0x21, 0x0f,
+    0x00, 0x01, 0x75, 0x3d, 0xc0, 0x1e, 0x02, 0xed, 0x41, 0x98, 0x1d, 0x02, 0x05, 0x49, 0x10, 0x21, 0x06, 0x15, 0x78, 0x74, 0x61, 0xfa, 0x44, 0x86,
+    0x2a, 0xa4, 0x47, 0x41, 0x2e, 0x0f, 0x00, 0x01, 0xf5, 0x45, 0x40, 0x2e, 0x02, 0xfc, 0x44, 0x87, 0x2a, 0x02, 0xa3, 0x47, 0x0e, 0x2b, 0x06, 0x1a,
+    0x15, 0x8b, 0x99, 0x13, 0x4e, 0x24, 0x47, 0x7b, 0x4e, 0x8c, 0x4a, 0x0f, 0x00, 0x01, 0x55, 0x4e, 0xe0, 0x49, 0x02, 0x15, 0x4e, 0x25, 0x47, 0x02,
+    0x7a, 0x4e, 0x8b, 0x4a, 0x06, 0x1d, 0x23, 0x6d, 0x7b, 0x81, 0xfa, 0x3f, 0x33, 0x56, 0x06, 0xf0, 0x3c, 0x0f, 0x00, 0x01, 0x55, 0x06, 0x40, 0x33,
+    0x02, 0xdc, 0xfd, 0x87, 0x37, 0x02, 0x83, 0xfa, 0xee, 0x3c, 0x06, 0x1a, 0x09, 0x75, 0x7b, 0xe8, 0x10, 0x73, 0x47, 0x56, 0x1d, 0xa1, 0x53, 0x0f,
+    0x00, 0x01, 0x55, 0x1d, 0xa0, 0x53, 0x02, 0x8f, 0x15, 0xda, 0x4c, 0x02, 0xe9, 0x10, 0x74, 0x47, 0x06, 0x12, 0x3e, 0x86, 0x5f, 0x73, 0x1f, 0x3b,
+    0x15, 0xee, 0x2d, 0xe1, 0x1e, 0x0f, 0x00, 0x01, 0x75, 0x1f, 0xe0, 0x1e, 0x02, 0xd1, 0x27, 0x3c, 0x15, 0x02, 0xed, 0x2d, 0x58, 0x16, 0x06, 0x0b,
+    0x36, 0x73, 0x5f, 0x3b, 0x52, 0xdf, 0x37, 0x26, 0x57, 0x51, 0x3c, 0x0f, 0x00, 0x01, 0xf5, 0x53, 0xe0, 0x37, 0x02, 0x3d, 0x52, 0x68, 0x38, 0x02,
+    0x24, 0x57, 0x50, 0x3c, 0x06, 0x1d, 0x63, 0x91, 0x90, 0x25, 0x4d, 0x42, 0x37, 0xd6, 0x51, 0x93, 0x3b, 0x0f, 0x00, 0x01, 0xd5, 0x51, 0x40, 0x3a,
+    0x02, 0x26, 0x4d, 0x92, 0x3b, 0x02, 0x78, 0x50, 0x43, 0x37, 0x06, 0x0e, 0x55, 0x5b, 0x6b, 0xdb, 0x54, 0x92, 0x23, 0xea, 0x57, 0xa9, 0x26, 0x0f,
+    0x00, 0x01, 0x15, 0x55, 0x60, 0x24, 0x02, 0xe9, 0x57, 0x94, 0x23, 0x02, 0xdc, 0x54, 0xa8, 0x26, 0x06, 0x31, 0x69, 0x69, 0x93, 0x70, 0x2e, 0x1b,
+    0x29, 0xe5, 0x33, 0x61, 0x31, 0x0f, 0x00, 0x01, 0xb5, 0x2f, 0x60, 0x31, 0x02, 0xe3, 0x33, 0x2e, 0x2f, 0x02, 0x71, 0x2e, 0x1d, 0x29, 0x06, 0x1e,
+    0x13, 0x6c, 0xa0, 0xd3, 0x2d, 0x8d, 0xfe, 0xe5, 0x3c, 0x41, 0x0a, 0x0f, 0x00, 0x01, 0xd5, 0x2d, 0x40, 0x0a, 0x02, 0xdc, 0x31, 0xe7, 0x08, 0x02,
+    0xe3, 0x3c, 0x8f, 0xfe, 0x06, 0x1c, 0x69, 0x7d, 0x8d, 0xcc, 0x33, 0xd0, 0x36, 0x56, 0x34, 0xfa, 0x38, 0x0f, 0x00, 0x01, 0x55, 0x34, 0x40, 0x38,
+    0x02, 0xcd, 0x33, 0xf9, 0x38, 0x02, 0x0d, 0x34, 0xd1, 0x36, 0x06, 0x1f, 0x24, 0x84, 0x93, 0x7c, 0x00, 0x9f, 0x18, 0x36, 0x13, 0xaa, 0x25, 0x0f,
+    0x00, 0x01, 0x35, 0x13, 0xa0, 0x18, 0x02, 0xd9, 0x0a, 0x24, 0x22, 0x02, 0x7d, 0x00, 0xa9, 0x25, 0x06, 0x05, 0x7a, 0x9e, 0x6e, 0x33, 0x09, 0xcf,
+    0x29, 0x86, 0x12, 0x4a, 0x30, 0x0f, 0x00, 0x01, 0x35, 0x09, 0xc0, 0x2b, 0x02, 0x3d, 0x11, 0x48, 0x30, 0x02, 0x85, 0x12, 0xd0, 0x29, 0x06, 0x1d,
+    0x2a, 0x5b, 0x6d, 0x41, 0x4e, 0xfb, 0x29, 0x16, 0x53, 0xe1, 0x30, 0x0f, 0x00, 0x01, 0x15, 0x53, 0xe0, 0x30, 0x02, 0x43, 0x4e, 0xee, 0x2b, 0x02,
+    0x91, 0x4e, 0xfc, 0x29, 0x06, 0x27, 0x2b, 0x9f, 0x96, 0x33, 0x21, 0xbf, 0x55, 0x97, 0x29, 0x02, 0x5c, 0x0f, 0x00, 0x01, 0x35, 0x21, 0xc0, 0x55,
+    0x02, 0x75, 0x28, 0x00, 0x5c, 0x02, 0x95, 0x29, 0x80, 0x5a, 0x06, 0x1b, 0x6b, 0x8f, 0x80, 0x2c, 0x46, 0xff, 0x00, 0x96, 0x4f, 0x52, 0x16, 0x0f,
+    0x00, 0x01, 0x95, 0x4f, 0x00, 0x01, 0x02, 0x2d, 0x46, 0xd8, 0x0b, 0x02, 0xa5, 0x4c, 0x51, 0x16, 0x06, 0x18, 0x50, 0x59, 0x8e, 0x0b, 0x17, 0xcf,
+    0x3c, 0xf6, 0x1c, 0xa1, 0x42, 0x0f, 0x00, 0x01, 0xf5, 0x1c, 0xa0, 0x42, 0x02, 0x4d, 0x17, 0xb8, 0x40, 0x02, 0x0d, 0x17, 0xd0, 0x3c, 0x06, 0x28,
+    0x52, 0x71, 0x57, 0x13, 0x11, 0xf5, 0x3d, 0x83, 0x17, 0x81, 0x47, 0x0f, 0x00, 0x01, 0x15, 0x11, 0x80, 0x47, 0x02, 0x2c, 0x13, 0x37, 0x3e, 0x02,
+    0x82, 0x17, 0xf7, 0x3d, 0x06, 0x23, 0x7c, 0x7b, 0xa7, 0xb3, 0x49, 0xa0, 0x31, 0xf9, 0x4b, 0xe4, 0x35, 0x0f, 0x00, 0x01, 0xb5, 0x49, 0xc0, 0x35,
+    0x02, 0xb6, 0x4a, 0xa2, 0x31, 0x02, 0xf8, 0x4b, 0xe3, 0x35, 0x06, 0x31, 0x40, 0x9f, 0x74, 0x73, 0x1b, 0x7f, 0x4d, 0x60, 0x22, 0x0b, 0x55, 0x0f,
+    0x00, 0x01, 0x75, 0x1b, 0x80, 0x4d, 0x02, 0x7a, 0x21, 0x45, 0x50, 0x02, 0x5e, 0x22, 0x0a, 0x55, 0x06, 0x31, 0x7a, 0xa1, 0x72, 0x9c, 0x05, 0x33,
+    0x2e, 0x2b, 0x0c, 0x61, 0x31, 0x0f, 0x00, 0x01, 0x75, 0x0b, 0x60, 0x31, 0x02, 0x29, 0x0c, 0x34, 0x2e, 0x02, 0x9e, 0x05, 0x49, 0x2f, 0x06, 0x2a,
+    0x02, 0x71, 0x8d, 0x84, 0x32, 0x47, 0x33, 0xdf, 0x33, 0x92, 0x37, 0x0f, 0x00, 0x01, 0xf5, 0x32, 0x20, 0x36, 0x02, 0xdd, 0x33, 0x48, 0x33, 0x02,
+    0x85, 0x32, 0x91, 0x37, 0x06, 0x12, 0x77, 0x85, 0x9d, 0x33, 0x21, 0xcf, 0x0a, 0xb6, 0x2e, 0xa1, 0x13, 0x0f, 0x00, 0x01, 0xb5, 0x2e, 0xa0, 0x13,
+    0x02, 0xe4, 0x28, 0xd0, 0x0a, 0x02, 0x34, 0x21, 0x40, 0x12, 0x06, 0x1d, 0x4e, 0xa1, 0x6d, 0x30, 0x57, 0xbc, 0x39, 0xd6, 0x59, 0x21, 0x3e, 0x0f,
+    0x00, 0x01, 0xd5, 0x59, 0x20, 0x3e, 0x02, 0x32, 0x57, 0xbd, 0x39, 0x02, 0x8f, 0x59, 0xfa, 0x3a, 0x06, 0x19, 0x7c, 0x97, 0x5e, 0x33, 0x35, 0x57,
+    0x43, 0xee, 0x37, 0x3e, 0x47, 0x0f, 0x00, 0x01, 0x35, 0x35, 0xc0, 0x43, 0x02, 0x51, 0x37, 0x3c, 0x47, 0x02, 0xed, 0x37, 0x58, 0x43, 0x06, 0x13,
+    0x4f, 0x58, 0x89, 0x13, 0x31, 0x5f, 0x21, 0x44, 0x39, 0xbc, 0x2e, 0x0f, 0x00, 0x01, 0x55, 0x31, 0x60, 0x21, 0x02, 0x15, 0x31, 0x8d, 0x29, 0x02,
+    0x42, 0x39, 0xbb, 0x2e, 0x06, 0x17, 0x50, 0x81, 0x95, 0x1f, 0x3b, 0xff, 0x37, 0xd6, 0x3f, 0xb9, 0x39, 0x0f, 0x00, 0x01, 0xd5, 0x3f, 0x00, 0x38,
+    0x02, 0x20, 0x3b, 0x4c, 0x39, 0x02, 0x8c, 0x3d, 0xb7, 0x39, 0x06, 0x0a, 0x05, 0x95, 0x67, 0x53, 0x58, 0xcf, 0x23, 0xc6, 0x5e, 0xc1, 0x27, 0x0f,
+    0x00, 0x01, 0x55, 0x58, 0xc0, 0x27, 0x02, 0xc5, 0x5e, 0xd0, 0x23, 0x02, 0x35, 0x5d, 0xa0, 0x24, 0x06, 0x2e, 0x66, 0x7e, 0x89, 0xd3, 0x23, 0x78,
+    0x58, 0x6a, 0x2e, 0x36, 0x5e, 0x0f, 0x00, 0x01, 0xd5, 0x23, 0x00, 0x5c, 0x02, 0xef, 0x28, 0x7a, 0x58, 0x02, 0x69, 0x2e, 0x34, 0x5e, 0x06, 0x1d,
+    0x6e, 0x7b, 0x6f, 0xd3, 0x45, 0xff, 0x0d, 0x41, 0x56, 0x57, 0x16, 0x0f, 0x00, 0x01, 0xd5, 0x45, 0x00, 0x0e, 0x02, 0x2a, 0x4d, 0x55, 0x16, 0x02,
+    0x40, 0x56, 0x8b, 0x10, 0x06, 0x22, 0x61, 0x86, 0x7c, 0x53, 0x53, 0x85, 0x47, 0xe4, 0x59, 0x0f, 0x4b, 0x0f, 0x00, 0x01, 0x55, 0x53, 0x20, 0x49,
+    0x02, 0x1c, 0x57, 0x87, 0x47, 0x02, 0xe2, 0x59, 0x0d, 0x4b, 0x06, 0x0e, 0x5a, 0x5d, 0x66, 0x53, 0x38, 0x31, 0x20, 0x1f, 0x3b, 0xab, 0x23, 0x0f,
+    0x00, 0x01, 0x95, 0x38, 0xe0, 0x20, 0x02, 0x55, 0x38, 0xa9, 0x23, 0x02, 0x1e, 0x3b, 0x32, 0x20, 0x06, 0x1c, 0x0c, 0x86, 0x7e, 0x20, 0x05, 0xcc,
+    0x01, 0x96, 0x0c, 0x81, 0x0b, 0x0f, 0x00, 0x01, 0x95, 0x0c, 0x80, 0x0b, 0x02, 0x6b, 0x09, 0x77, 0x06, 0x02, 0x22, 0x05, 0xcd, 0x01, 0x06, 0x1d,
+    0x41, 0x95, 0x6a, 0xb0, 0x0b, 0x5c, 0x52, 0x56, 0x0f, 0x81, 0x56, 0x0f, 0x00, 0x01, 0x55, 0x0f, 0x80, 0x56, 0x02, 0x73, 0x0e, 0x5f, 0x53, 0x02,
+    0xb2, 0x0b, 0x5d, 0x52, 0x06, 0x2a, 0x6e, 0x9b, 0x98, 0xb3, 0x4c, 0xee, 0xfb, 0x46, 0x5a, 0xb9, 0x05, 0x0f, 0x00, 0x01, 0xb5, 0x4c, 0xa0, 0x03,
+    0x02, 0xec, 0x57, 0xb8, 0x05, 0x02, 0x44, 0x5a, 0xf0, 0xfb, 0x06, 0x1d, 0x2f, 0x97, 0x78, 0x6b, 0x50, 0x36, 0x06, 0x56, 0x58, 0x81, 0x15, 0x0f,
+    0x00, 0x01, 0x55, 0x58, 0x80, 0x15, 0x02, 0x90, 0x56, 0x7c, 0x0c, 0x02, 0x6c, 0x50, 0x37, 0x06, 0x06, 0x0e, 0x04, 0x81, 0x84, 0xa6, 0x09, 0x71,
+    0xff, 0xd6, 0x16, 0x21, 0x11, 0x0f, 0x00, 0x01, 0xd5, 0x16, 0x20, 0x11, 0x02, 0x7e, 0x10, 0x29, 0x09, 0x02, 0xa7, 0x09, 0x73, 0xff, 0x06, 0x1c,
+    0x28, 0x61, 0x67, 0x13, 0x4e, 0x75, 0x46, 0x63, 0x51, 0xaf, 0x49, 0x0f, 0x00, 0x01, 0x15, 0x4e, 0x20, 0x47, 0x02, 0x8b, 0x4e, 0x77, 0x46, 0x02,
+    0x62, 0x51, 0xad, 0x49, 0x06, 0x11, 0x41, 0xa7, 0x7c, 0x14, 0x11, 0x3f, 0xf3, 0xd6, 0x18, 0x21, 0x0a, 0x0f, 0x00, 0x01, 0xd5, 0x18, 0x20, 0x0a,
+    0x02, 0x95, 0x18, 0xa0, 0xfd, 0x02, 0x15, 0x11, 0x41, 0xf3, 0x06, 0x1d, 0x5c, 0x7e, 0x85, 0x98, 0x16, 0xa4, 0xeb, 0xc9, 0x1e, 0x81, 0x02, 0x0f,
+    0x00, 0x01, 0x95, 0x1a, 0x80, 0x02, 0x02, 0xc7, 0x1e, 0x93, 0xf8, 0x02, 0x9a, 0x16, 0xa5, 0xeb, 0x06, 0x09, 0x68, 0x7d, 0x76, 0x73, 0x22, 0xdf,
+    0x17, 0x65, 0x25, 0xe0, 0x28, 0x0f, 0x00, 0x01, 0x75, 0x22, 0xe0, 0x17, 0x02, 0x64, 0x25, 0x6f, 0x1e, 0x02, 0xd3, 0x23, 0xde, 0x28, 0x06, 0x31,
+    0x74, 0xa3, 0x5d, 0x53, 0x42, 0x7f, 0x5b, 0xc3, 0x47, 0xd8, 0x5f, 0x0f, 0x00, 0x01, 0x55, 0x42, 0x80, 0x5b, 0x02, 0x4b, 0x47, 0xd6, 0x5f, 0x02,
+    0xc2, 0x47, 0xed, 0x5b, 0x06, 0x29, 0x58, 0x65, 0x60, 0xcd, 0x38, 0x93, 0x3f, 0x0a, 0x3d, 0xfc, 0x42, 0x0f, 0x00, 0x01, 0x95, 0x39, 0x00, 0x40,
+    0x02, 0xcf, 0x38, 0xfa, 0x42, 0x02, 0x09, 0x3d, 0x94, 0x3f, 0x06, 0x26, 0x69, 0x83, 0x8f, 0x3a, 0x11, 0xc2, 0x46, 0x36, 0x18, 0x69, 0x4a, 0x0f,
+    0x00, 0x01, 0x35, 0x18, 0x40, 0x49, 0x02, 0xf8, 0x14, 0xc4, 0x46, 0x02, 0x3c, 0x11, 0x67, 0x4a, 0x06, 0x13, 0x7b, 0xa2, 0x6f, 0x5b, 0x48, 0x0d,
+    0x38, 0xe5, 0x4b, 0x21, 0x3c, 0x0f, 0x00, 0x01, 0x95, 0x4b, 0x20, 0x3c, 0x02, 0x5c, 0x48, 0x47, 0x39, 0x02, 0xe4, 0x4b, 0x0f, 0x38, 0x06, 0x13,
+    0x72, 0x81, 0x98, 0x9b, 0x41, 0xdf, 0x05, 0x1a, 0x46, 0xa5, 0x0b, 0x0f, 0x00, 0x01, 0xf5, 0x43, 0xe0, 0x05, 0x02, 0x19, 0x46, 0xa4, 0x0b, 0x02,
+    0x9c, 0x41, 0x68, 0x0a, 0x06, 0x27, 0x55, 0x92, 0x83, 0xd3, 0x20, 0x90, 0xfb, 0x4f, 0x2a, 0x81, 0x04, 0x0f, 0x00, 0x01, 0xd5, 0x20, 0x80, 0x04,
+    0x02, 0x4e, 0x2a, 0x59, 0x00, 0x02, 0xa6, 0x27, 0x92, 0xfb, 0x06, 0x2a, 0x78, 0x5d, 0x76, 0x90, 0x3c, 0x3f, 0x38, 0x54, 0x3f, 0x3e, 0x40, 0x0f,
+    0x00, 0x01, 0xd5, 0x3c, 0x40, 0x38, 0x02, 0x53, 0x3f, 0x5e, 0x3b, 0x02, 0x91, 0x3c, 0x3c, 0x40, 0x06, 0x12, 0x4d, 0xa6, 0x79, 0x65, 0x52, 0x50,
+    0xff, 0x1f, 0x58, 0xc1, 0x0e, 0x0f, 0x00, 0x01, 0xd5, 0x57, 0xc0, 0x0e, 0x02, 0x1e, 0x58, 0xc9, 0x05, 0x02, 0x66, 0x52, 0x52, 0xff, 0x06, 0x15,
+    0x7e, 0x80, 0xa9, 0xf3, 0x35, 0xd2, 0x23, 0x3d, 0x42, 0x01, 0x2a, 0x0f, 0x00, 0x01, 0xf5, 0x35, 0x00, 0x2a, 0x02, 0x28, 0x3c, 0xd3, 0x23, 0x02,
+    0x3b, 0x42, 0xe7, 0x29, 0x06, 0x11, 0x14, 0x86, 0x93, 0x13, 0x40, 0xff, 0x5a, 0xa3, 0x44, 0xef, 0x5e, 0x0f, 0x00, 0x01, 0x15, 0x40, 0x00, 0x5b,
+    0x02, 0xa2, 0x44, 0xed, 0x5e, 0x02, 0xaf, 0x42, 0xda, 0x5d, 0x06, 0x1d, 0x7f, 0xaa, 0x84, 0x22, 0x48, 0x5f, 0x3e, 0x96, 0x4b, 0x1f, 0x44, 0x0f,
+    0x00, 0x01, 0x95, 0x4b, 0x60, 0x3e, 0x02, 0x23, 0x48, 0x8f, 0x41, 0x02, 0x92, 0x4b, 0x1d, 0x44, 0x06, 0x0f, 0x7a, 0x59, 0x71, 0x53, 0x29, 0xae,
+    0x26, 0x1e, 0x2d, 0x81, 0x28, 0x0f, 0x00, 0x01, 0x55, 0x29, 0x80, 0x28, 0x02, 0x1c, 0x2d, 0x48, 0x27, 0x02, 0x84, 0x29, 0xaf, 0x26, 0x06, 0x09,
+    0x70, 0x96, 0x7e, 0x67, 0x21, 0xbf, 0x1f, 0x5e, 0x26, 0xe9, 0x31, 0x0f, 0x00, 0x01, 0x35, 0x25, 0xc0, 0x1f, 0x02, 0x69, 0x21, 0x94, 0x28, 0x02,
+    0x5c, 0x26, 0xe8, 0x31, 0x06, 0x14, 0x03, 0x62, 0x60, 0xa4, 0x14, 0x6f, 0x36, 0x56, 0x1d, 0xc1, 0x38, 0x0f, 0x00, 0x01, 0x55, 0x1d, 0xc0, 0x38,
+    0x02, 0xed, 0x15, 0xb9, 0x36, 0x02, 0xa6, 0x14, 0x71, 0x36, 0x06, 0x00, 0x7e, 0x5d, 0x5a, 0xb9, 0x15, 0x85, 0x21, 0xc9, 0x19, 0x81, 0x2a, 0x0f,
+    0x00, 0x01, 0x15, 0x16, 0x80, 0x2a, 0x02, 0xc8, 0x19, 0x13, 0x22, 0x02, 0xbb, 0x15, 0x86, 0x21, 0x06, 0x23, 0x23, 0x81, 0x6a, 0x24, 0x50, 0xaf,
+    0x3f, 0xb6, 0x51, 0x81, 0x42, 0x0f, 0x00, 0x01, 0xb5, 0x51, 0x80, 0x42, 0x02, 0x25, 0x50, 0xb1, 0x3f, 0x02, 0xf6, 0x50, 0x61, 0x40, 0x06, 0x09,
+    0x6c, 0x77, 0x76, 0x73, 0x0c, 0xff, 0x14, 0x0d, 0x21, 0x0d, 0x1a, 0x0f, 0x00, 0x01, 0x75, 0x0c, 0x00, 0x15, 0x02, 0xa0, 0x14, 0x0c, 0x1a, 0x02,
+    0x0c, 0x21, 0xf7, 0x16, 0x06, 0x09, 0x51, 0x97, 0x60, 0xd3, 0x39, 0x3f, 0x05, 0x98, 0x47, 0x43, 0x12, 0x0f, 0x00, 0x01, 0xd5, 0x39, 0x40, 0x05,
+    0x02, 0x76, 0x44, 0x01, 0x07, 0x02, 0x97, 0x47, 0x42, 0x12, 0x06, 0x2b, 0x09, 0x8b, 0x85, 0x73, 0x58, 0x5f, 0x0d, 0x84, 0x67, 0x30, 0x1a, 0x0f,
+    0x00, 0x01, 0x75, 0x58, 0x60, 0x0d, 0x02, 0x0c, 0x62, 0x97, 0x14, 0x02, 0x83, 0x67, 0x2e, 0x1a, 0x06, 0x22, 0x74, 0x87, 0x62, 0x33, 0x07, 0xff,
+    0x26, 0xa6, 0x12, 0x49, 0x2c, 0x0f, 0x00, 0x01, 0x35, 0x07, 0x00, 0x27, 0x02, 0xfc, 0x0d, 0x48, 0x2c, 0x02, 0xa4, 0x12, 0xcf, 0x27, 0x06, 0x27,
+    0x68, 0x91, 0x88, 0x00, 0x35, 0xf7, 0x24, 0x0f, 0x37, 0x01, 0x2e, 0x0f, 0x00, 0x01, 0x75, 0x36, 0x00, 0x2e, 0x02, 0x01, 0x35, 0x6c, 0x2a, 0x02,
+    0x0e, 0x37, 0xf9, 0x24, 0x06, 0x1d, 0x77, 0x68, 0xa3, 0xbe, 0x4a, 0x9f, 0x28, 0x3c, 0x51, 0x87, 0x2e, 0x0f, 0x00, 0x01, 0x35, 0x4c, 0xa0, 0x28,
+    0x02, 0x3a, 0x51, 0x85, 0x2e, 0x02, 0xbf, 0x4a, 0x0b, 0x2e, 0x06, 0x18, 0x4e, 0x9c, 0x7c, 0xb3, 0x31, 0xfe, 0xf8, 0xf6, 0x3c, 0x01, 0x03, 0x0f,
+    0x00, 0x01, 0x15, 0x3b, 0x00, 0x03, 0x02, 0xf4, 0x3c, 0xa0, 0xfd, 0x02, 0xb4, 0x31, 0xff, 0xf8, 0x06, 0x0e, 0x36, 0x74, 0xa1, 0x6b, 0x50, 0x3f,
+    0x5c, 0xb6, 0x56, 0xfe, 0x5f, 0x0f, 0x00, 0x01, 0xb5, 0x56, 0x40, 0x5c, 0x02, 0xb1, 0x52, 0xfc, 0x5f, 0x02, 0x6d, 0x50, 0x98, 0x5f, 0x06, 0x31,
+    0x5a, 0x90, 0x78, 0x73, 0x16, 0xbf, 0x59, 0x78, 0x1d, 0x05, 0x61, 0x0f, 0x00, 0x01, 0x75, 0x16, 0xc0, 0x59, 0x02, 0x77, 0x1d, 0xc2, 0x5c, 0x02,
+    0x58, 0x1b, 0x04, 0x61, 0x06, 0x20, 0x7b, 0x83, 0x5b, 0x53, 0x26, 0xb1, 0x23, 0x49, 0x2c, 0xbb, 0x29, 0x0f, 0x00, 0x01, 0x55, 0x26, 0x20, 0x24,
+    0x02, 0x8e, 0x29, 0xb9, 0x29, 0x02, 0x47, 0x2c, 0xb3, 0x23, 0x06, 0x09, 0x66, 0x89, 0x8f, 0xb8, 0x5e, 0x3f, 0x58, 0x21, 0x60, 0x27, 0x5e, 0x0f,
+    0x00, 0x01, 0x95, 0x5f, 0x40, 0x58, 0x02, 0xba, 0x5e, 0x25, 0x5e, 0x02, 0x1f, 0x60, 0x4b, 0x5c, 0x06, 0x1b, 0x7b, 0x75, 0x5a, 0xd3, 0x3e, 0x57,
+    0x14, 0xae, 0x43, 0x72, 0x19, 0x0f, 0x00, 0x01, 0xd5, 0x3e, 0xa0, 0x14, 0x02, 0xad, 0x43, 0x58, 0x14, 0x02, 0xa5, 0x40, 0x70, 0x19, 0x06, 0x17,
+    0x03, 0x81, 0x7c, 0xb3, 0x45, 0x92, 0x4a, 0x09, 0x4a, 0x61, 0x51, 0x0f, 0x00, 0x01, 0xb5, 0x45, 0x60, 0x51, 0x02, 0xee, 0x47, 0xba, 0x4d, 0x02,
+    0x08, 0x4a, 0x93, 0x4a, 0x06, 0x2e, 0x69, 0x7d, 0x75, 0x93, 0x41, 0x1f, 0x01, 0x56, 0x53, 0x01, 0x0b, 0x0f, 0x00, 0x01, 0x95, 0x41, 0x20, 0x01,
+    0x02, 0xd4, 0x49, 0x00, 0x0b, 0x02, 0x54, 0x53, 0xe0, 0x04, 0x06, 0x17, 0x20, 0x75, 0x75, 0x13, 0x3c, 0x18, 0x50, 0x90, 0x3e, 0x61, 0x56, 0x0f,
+    0x00, 0x01, 0x15, 0x3c, 0x60, 0x56, 0x02, 0x01, 0x3d, 0x6d, 0x52, 0x02, 0x8e, 0x3e, 0x19, 0x50, 0x06, 0x13, 0x76, 0xa0, 0x89, 0xe0, 0x55, 0x98,
+    0x18, 0x0f, 0x5c, 0xe1, 0x24, 0x0f, 0x00, 0x01, 0x55, 0x5b, 0xe0, 0x24, 0x02, 0xe1, 0x55, 0x2d, 0x20, 0x02, 0x0e, 0x5c, 0x99, 0x18, 0x06, 0x23,
+    0x67, 0x7e, 0x76, 0x53, 0x4b, 0x9f, 0x1b, 0x48, 0x57, 0x3b, 0x21, 0x0f, 0x00, 0x01, 0x55, 0x4b, 0xa0, 0x1b, 0x02, 0x0e, 0x51, 0x39, 0x21, 0x02,
+    0x47, 0x57, 0xd2, 0x1d, 0x06, 0x11, 0x6f, 0x99, 0x75, 0x33, 0x0c, 0x0e, 0x01, 0x94, 0x1c, 0xff, 0x0e, 0x0f, 0x00, 0x01, 0x35, 0x0c, 0x40, 0x06,
+    0x02, 0x44, 0x19, 0x0f, 0x01, 0x02, 0x93, 0x1c, 0xfe, 0x0e, 0x06, 0x10, 0x43, 0xa7, 0x84, 0x73, 0x06, 0x68, 0x37, 0x0b, 0x0e, 0xe1, 0x47, 0x0f,
+    0x00, 0x01, 0x75, 0x06, 0xe0, 0x47, 0x02, 0xc9, 0x0d, 0x94, 0x40, 0x02, 0x09, 0x0e, 0x69, 0x37, 0x06, 0x2d, 0x6a, 0x86, 0x77, 0xb3, 0x4b, 0x9f,
+    0x42, 0xf6, 0x4e, 0x61, 0x47, 0x0f, 0x00, 0x01, 0xf5, 0x4e, 0xa0, 0x42, 0x02, 0xb4, 0x4b, 0x80, 0x44, 0x02, 0x94, 0x4d, 0x5f, 0x47, 0x06, 0x22,
+    0x66, 0x78, 0x8e, 0xd3, 0x48, 0xf7, 0x49, 0x68, 0x4c, 0x53, 0x4b, 0x0f, 0x00, 0x01, 0xd5, 0x48, 0xe0, 0x4a, 0x02, 0x4e, 0x4a, 0xf9, 0x49, 0x02,
+    0x67, 0x4c, 0x52, 0x4b, 0x06, 0x16, 0x57, 0x73, 0x7e, 0x61, 0x4f, 0xff, 0x2d, 0x56, 0x57, 0x19, 0x34, 0x0f, 0x00, 0x01, 0x55, 0x57, 0x00, 0x2e,
+    0x02, 0x2c, 0x52, 0x17, 0x34, 0x02, 0x63, 0x4f, 0xee, 0x30, 0x06, 0x30, 0x6a, 0x94, 0x8c, 0xd3, 0x45, 0xde, 0x1d, 0xf6, 0x4c, 0xd1, 0x1f, 0x0f,
+    0x00, 0x01, 0xd5, 0x45, 0x20, 0x1f, 0x02, 0x24, 0x4b, 0xd0, 0x1f, 0x02, 0xf4, 0x4c, 0xdf, 0x1d, 0x06, 0x1d, 0x60, 0x8c, 0x90, 0x93, 0x0e, 0x3f,
+    0x30, 0x57, 0x17, 0x92, 0x39, 0x0f, 0x00, 0x01, 0x95, 0x0e, 0xc0, 0x36, 0x02, 0x45, 0x14, 0x90, 0x39, 0x02, 0x55, 0x17, 0x40, 0x30, 0x06, 0x0c,
+    0x68, 0x96, 0x96, 0xd1, 0x58, 0xbf, 0x0f, 0x25, 0x62, 0x00, 0x1b, 0x0f, 0x00, 0x01, 0xf5, 0x5f, 0xc0, 0x0f, 0x02, 0x24, 0x62, 0x4f, 0x18, 0x02,
+    0xd3, 0x58, 0xfe, 0x1a, 0x06, 0x26, 0x60, 0x5a, 0x94, 0xf3, 0x15, 0x2f, 0x59, 0x46, 0x1a, 0x01, 0x61, 0x0f, 0x00, 0x01, 0xf5, 0x15, 0x00, 0x5f,
+    0x02, 0x35, 0x16, 0x30, 0x59, 0x02, 0x45, 0x1a, 0x00, 0x61, 0x06, 0x07, 0x4f, 0x96, 0x80, 0x62, 0x0b, 0x7f, 0x3c, 0xce, 0x11, 0xd1, 0x4d, 0x0f,
+    0x00, 0x01, 0x55, 0x10, 0x80, 0x3c, 0x02, 0xcc, 0x11, 0x57, 0x45, 0x02, 0x64, 0x0b, 0xcf, 0x4d, 0x06, 0x1d, 0x4c, 0x94, 0x83, 0x09, 0x2a, 0xd5,
+    0x20, 0xb6, 0x2e, 0x8e, 0x25, 0x0f, 0x00, 0x01, 0xb5, 0x2e, 0x60, 0x23, 0x02, 0x0b, 0x2a, 0xd6, 0x20, 0x02, 0x81, 0x2d, 0x8c, 0x25, 0x06, 0x22,
+    0x67, 0x81, 0x77, 0x0d, 0x30, 0xdf, 0x10, 0x56, 0x38, 0xaf, 0x1a, 0x0f, 0x00, 0x01, 0x55, 0x38, 0xe0, 0x10, 0x02, 0x62, 0x34, 0xad, 0x1a, 0x02,
+    0x0f, 0x30, 0xda, 0x14, 0x06, 0x13, 0x4b, 0x84, 0x94, 0x93, 0x3e, 0x1f, 0x3f, 0xd9, 0x44, 0xd3, 0x42, 0x0f, 0x00, 0x01, 0x95, 0x3e, 0x20, 0x3f,
+    0x02, 0x06, 0x42, 0xd2, 0x42, 0x02, 0xd8, 0x44, 0xe3, 0x41, 0x06, 0x31, 0x38, 0x66, 0x90, 0x2d, 0x25, 0x1b, 0x11, 0x33, 0x2a, 0x81, 0x14, 0x0f,
+    0x00, 0x01, 0x35, 0x26, 0x80, 0x14, 0x02, 0x32, 0x2a, 0x1d, 0x11, 0x02, 0x2e, 0x25, 0x7a, 0x13, 0x06, 0x31, 0x15, 0x7e, 0x8c, 0x26, 0x2a, 0x11,
+    0xf8, 0x96, 0x35, 0xe1, 0x01, 0x0f, 0x00, 0x01, 0x95, 0x35, 0xe0, 0x01, 0x02, 0x27, 0x2a, 0x13, 0xf8, 0x02, 0x9a, 0x2f, 0x65, 0xfe, 0x06, 0x28,
+    0x76, 0xa2, 0x92, 0x87, 0x31, 0xdf, 0x08, 0xb6, 0x3c, 0x8c, 0x11, 0x0f, 0x00, 0x01, 0xb5, 0x3c, 0xe0, 0x08, 0x02, 0x9f, 0x3b, 0x8a, 0x11, 0x02,
+    0x89, 0x31, 0x14, 0x0f, 0x06, 0x2d, 0x02, 0x6a, 0x96, 0xf3, 0x47, 0x16, 0x45, 0x6e, 0x49, 0xe1, 0x47, 0x0f, 0x00, 0x01, 0xf5, 0x47, 0xe0, 0x47,
+    0x02, 0x51, 0x48, 0x3c, 0x47, 0x02, 0x6c, 0x49, 0x18, 0x45, 0x06, 0x1d, 0x7b, 0x65, 0x9b, 0x05, 0x10, 0xff, 0x38, 0xdf, 0x18, 0x93, 0x41, 0x0f,
+    0x00, 0x01, 0xb5, 0x11, 0x00, 0x39, 0x02, 0xde, 0x18, 0x09, 0x40, 0x02, 0x07, 0x10, 0x92, 0x41, 0x06, 0x1b, 0x03, 0x89, 0x87, 0x02, 0xfc, 0xad,
+    0x48, 0x36, 0x06, 0x01, 0x51, 0x0f, 0x00, 0x01, 0x35, 0x06, 0x00, 0x51, 0x02, 0x4c, 0x02, 0x97, 0x4d, 0x02, 0x03, 0xfc, 0xae, 0x48, 0x06, 0x1d,
+    0x75, 0xa2, 0x61, 0xd3, 0x57, 0xa1, 0x2f, 0xe7, 0x5d, 0xb3, 0x34, 0x0f, 0x00, 0x01, 0xd5, 0x57, 0x60, 0x30, 0x02, 0xe6, 0x5d, 0xb1, 0x34, 0x02,
+    0x57, 0x5d, 0xa2, 0x2f, 0x06, 0x26, 0x1e, 0x63, 0x77, 0xd8, 0x53, 0xc3, 0xf6, 0xb6, 0x57, 0xc1, 0x00, 0x0f, 0x00, 0x01, 0xb5, 0x57, 0xc0, 0x00,
+    0x02, 0xda, 0x53, 0xc5, 0xf6, 0x02, 0x7e, 0x54, 0xc9, 0xfa, 0x06, 0x26, 0x2a, 0x6a, 0x5f, 0xff, 0x4b, 0xa5, 0x49, 0xf6, 0x50, 0x41, 0x4d, 0x0f,
+    0x00, 0x01, 0xf5, 0x50, 0x40, 0x4d, 0x02, 0x3b, 0x4d, 0xa6, 0x49, 0x02, 0x01, 0x4c, 0x0c, 0x4a, 0x06, 0x27, 0x03, 0x64, 0x9d, 0xf8, 0x08, 0xbf,
+    0x16, 0x36, 0x16, 0xe7, 0x22, 0x0f, 0x00, 0x01, 0x35, 0x16, 0xc0, 0x16, 0x02, 0x57, 0x0b, 0x03, 0x21, 0x02, 0xfa, 0x08, 0xe5, 0x22, 0x06, 0x1d,
+    0x01, 0x90, 0x8f, 0x29, 0x25, 0xb5, 0x52, 0x56, 0x29, 0x81, 0x5d, 0x0f, 0x00, 0x01, 0x55, 0x29, 0x80, 0x5d, 0x02, 0x10, 0x28, 0x1b, 0x5a, 0x02,
+    0x2b, 0x25, 0xb6, 0x52, 0x06, 0x1b, 0x73, 0x6c, 0x8c, 0xf3, 0x08, 0x3e, 0x22, 0x46, 0x13, 0x41, 0x32, 0x0f, 0x00, 0x01, 0xf5, 0x08, 0x40, 0x32,
+    0x02, 0x44, 0x13, 0x90, 0x2c, 0x02, 0xb4, 0x0b, 0x40, 0x22, 0x06, 0x1c, 0x5b, 0x87, 0x80, 0xb0, 0x4f, 0x1f, 0x01, 0xf5, 0x59, 0x5e, 0x0f, 0x0f,
+    0x00, 0x01, 0xb5, 0x55, 0x20, 0x01, 0x02, 0xf3, 0x59, 0x5e, 0x08, 0x02, 0xb2, 0x4f, 0x5d, 0x0f, 0x06, 0x0c, 0x7e, 0x88, 0x56, 0xf3, 0x32, 0xf1,
+    0x33, 0xe9, 0x36, 0x9b, 0x37, 0x0f, 0x00, 0x01, 0xf5, 0x32, 0x00, 0x34, 0x02, 0x4e, 0x35, 0x99, 0x37, 0x02, 0xe7, 0x36, 0xf3, 0x33, 0x06, 0x00,
+    0x63, 0x6f, 0x92, 0x26, 0x2d, 0x71, 0x33, 0xe0, 0x31, 0x41, 0x37, 0x0f, 0x00, 0x01, 0x95, 0x2e, 0x40, 0x37, 0x02, 0xde, 0x31, 0x29, 0x36, 0x02,
+    0x27, 0x2d, 0x73, 0x33, 0x06, 0x19, 0x6b, 0x66, 0x69, 0xfc, 0x04, 0x33, 0x10, 0xf6, 0x13, 0x4a, 0x16, 0x0f, 0x00, 0x01, 0xf5, 0x13, 0xa0, 0x11,
+    0x02, 0x09, 0x08, 0x34, 0x10, 0x02, 0xfd, 0x04, 0x49, 0x16, 0x06, 0x1d, 0x3e, 0x7d, 0x5a, 0xc7, 0x4a, 0xff, 0x43, 0xb1, 0x4b, 0x3c, 0x45, 0x0f,
+    0x00, 0x01, 0x35, 0x4b, 0x00, 0x44, 0x02, 0xaf, 0x4b, 0x3a, 0x45, 0x02, 0xc9, 0x4a, 0x14, 0x44, 0x06, 0x1d, 0x20, 0x78, 0x8d, 0x0f, 0x21, 0xfb,
+    0x4f, 0x2f, 0x28, 0x3a, 0x53, 0x0f, 0x00, 0x01, 0xf5, 0x23, 0x20, 0x52, 0x02, 0x11, 0x21, 0xfc, 0x4f, 0x02, 0x2d, 0x28, 0x39, 0x53, 0x06, 0x27,
+    0x1c, 0x6d, 0x7f, 0xd3, 0x15, 0x7f, 0x30, 0xbf, 0x1d, 0x6a, 0x34, 0x0f, 0x00, 0x01, 0xd5, 0x15, 0x80, 0x30, 0x02, 0xbd, 0x1d, 0x69, 0x34, 0x02,
+    0x06, 0x18, 0x71, 0x32, 0x06, 0x1d, 0x7d, 0x82, 0xa6, 0xc9, 0x21, 0x1f, 0x39, 0xd1, 0x26, 0xfc, 0x3e, 0x0f, 0x00, 0x01, 0x75, 0x24, 0x20, 0x39,
+    0x02, 0xd0, 0x26, 0xfb, 0x3e, 0x02, 0xca, 0x21, 0xbb, 0x3e, 0x06, 0x29, 0x78, 0x82, 0xa1, 0xc4, 0x49, 0x77, 0x14, 0x76, 0x54, 0xf2, 0x1a, 0x0f,
+    0x00, 0x01, 0x75, 0x54, 0x40, 0x1a, 0x02, 0x6d, 0x4f, 0x78, 0x14, 0x02, 0xc5, 0x49, 0xf1, 0x1a, 0x06, 0x1d, 0x0b, 0x5b, 0xa8, 0x9e, 0x11, 0x94,
+    0xf9, 0x4c, 0x1f, 0xa1, 0x03, 0x0f, 0x00, 0x01, 0x95, 0x12, 0xa0, 0x03, 0x02, 0x4a, 0x1f, 0x95, 0xf9, 0x02, 0x9f, 0x11, 0x6b, 0x03, 0x06, 0x1a,
+    0x71, 0x9e, 0x6d, 0x73, 0x3d, 0x8d, 0x34, 0xde, 0x3f, 0x29, 0x39, 0x0f, 0x00, 0x01, 0x75, 0x3d, 0xe0, 0x35, 0x02, 0xdc, 0x3f, 0x27, 0x39, 0x02,
+    0x83, 0x3f, 0x8f, 0x34, 0x06, 0x31, 0x5c, 0x7a, 0x8b, 0xd3, 0x53, 0x7f, 0x11, 0x99, 0x5e, 0x63, 0x19, 0x0f, 0x00, 0x01, 0xd5, 0x53, 0x80, 0x11,
+    0x02, 0x76, 0x58, 0x62, 0x19, 0x02, 0x98, 0x5e, 0x84, 0x16, 0x06, 0x30, 0x69, 0x7b, 0x70, 0xd3, 0x2c, 0x59, 0x27, 0x71, 0x39, 0xbf, 0x2b, 0x0f,
+    0x00, 0x01, 0xd5, 0x2c, 0xc0, 0x28, 0x02, 0x72, 0x32, 0xbd, 0x2b, 0x02, 0x6f, 0x39, 0x5a, 0x27, 0x06, 0x00, 0x7b, 0x6d, 0xa6, 0x13, 0x57, 0xdf,
+    0x35, 0xd6, 0x5d, 0xa1, 0x3b, 0x0f, 0x00, 0x01, 0xd5, 0x5d, 0xa0, 0x3b, 0x02, 0xf5, 0x58, 0xe0, 0x35, 0x02, 0x15, 0x57, 0x60, 0x3b, 0x06, 0x24,
+    0x7b, 0x5b, 0x73, 0x40, 0x57, 0x2c, 0x44, 0xb6, 0x5a, 0x3c, 0x47, 0x0f, 0x00, 0x01, 0xb5, 0x5a, 0x40, 0x45, 0x02, 0x42, 0x57, 0x2d, 0x44, 0x02,
+    0x82, 0x57, 0x3a, 0x47, 0x06, 0x10, 0x7d, 0x60, 0x5c, 0x33, 0x54, 0xbf, 0x2f, 0xf2, 0x55, 0xde, 0x32, 0x0f, 0x00, 0x01, 0x35, 0x54, 0xc0, 0x2f,
+    0x02, 0xf1, 0x55, 0x00, 0x30, 0x02, 0x6d, 0x54, 0xdc, 0x32, 0x06, 0x22, 0x34, 0x94, 0x67, 0x72, 0xf5, 0xff, 0xff, 0x86, 0x04, 0x41, 0x0d, 0x0f,
+    0x00, 0x01, 0xb5, 0x00, 0x00, 0x00, 0x02, 0x84, 0x04, 0xd0, 0x02, 0x02, 0x74, 0xf5, 0x3f, 0x0d, 0x06, 0x31, 0x0d, 0x8a, 0x82, 0xf0, 0x2e, 0x9c,
+    0x15, 0xd6, 0x33, 0x21, 0x21, 0x0f, 0x00, 0x01, 0xd5, 0x33, 0x20, 0x21, 0x02, 0x04, 0x32, 0xaf, 0x1b, 0x02, 0xf2, 0x2e, 0x9d, 0x15, 0x06, 0x1a,
+    0x7c, 0xa6, 0x79, 0xdf, 0x56, 0x6b, 0x3d, 0xd6, 0x5b, 0xc1, 0x40, 0x0f, 0x00, 0x01, 0x95, 0x5b, 0xc0, 0x40, 0x02, 0xd5, 0x5b, 0x6c, 0x3d, 0x02,
+    0xe1, 0x56, 0xd8, 0x3e, 0x06, 0x0b, 0x7a, 0x5c, 0x80, 0x53, 0x06, 0x2e, 0x52, 0xee, 0x10, 0x01, 0x5e, 0x0f, 0x00, 0x01, 0x55, 0x06, 0x00, 0x5e,
+    0x02, 0xec, 0x10, 0x18, 0x58, 0x02, 0x24, 0x07, 0x2f, 0x52, 0x06, 0x1d, 0x30, 0x68, 0x67, 0x48, 0x47, 0x5f, 0x5c, 0x60, 0x4a, 0x2b, 0x5f, 0x0f,
+    0x00, 0x01, 0xf5, 0x47, 0x60, 0x5c, 0x02, 0x4a, 0x47, 0xf5, 0x5c, 0x02, 0x5e, 0x4a, 0x29, 0x5f, 0x06, 0x14, 0x6a, 0x7b, 0x8a, 0x06, 0xfd, 0xdf,
+    0x19, 0xc0, 0x09, 0x94, 0x26, 0x0f, 0x00, 0x01, 0xb5, 0x02, 0xe0, 0x19, 0x02, 0xbe, 0x09, 0xca, 0x21, 0x02, 0x07, 0xfd, 0x93, 0x26, 0x06, 0x21,
+    0x0e, 0x62, 0xa7, 0x53, 0x5e, 0x4f, 0x27, 0x66, 0x66, 0x61, 0x2e, 0x0f, 0x00, 0x01, 0x55, 0x5e, 0x60, 0x2e, 0x02, 0x8d, 0x5f, 0x18, 0x2e, 0x02,
+    0x65, 0x66, 0x50, 0x27, 0x06, 0x2e, 0x4f, 0x95, 0x80, 0xd6, 0x46, 0x21, 0x38, 0x78, 0x49, 0x61, 0x3d, 0x0f, 0x00, 0x01, 0xd5, 0x48, 0x60, 0x3d,
+    0x02, 0x76, 0x49, 0xc1, 0x3a, 0x02, 0xd7, 0x46, 0x22, 0x38, 0x06, 0x09, 0x4d, 0x85, 0x91, 0x33, 0x0f, 0x7f, 0x06, 0x8e, 0x1b, 0x91, 0x11, 0x0f,
+    0x00, 0x01, 0x35, 0x0f, 0x80, 0x06, 0x02, 0x8c, 0x1b, 0x58, 0x0e, 0x02, 0x24, 0x16, 0x8f, 0x11, 0x06, 0x0e, 0x16, 0x92, 0x83, 0xd8, 0x23, 0x84,
+    0xfa, 0x96, 0x25, 0x81, 0x05, 0x0f, 0x00, 0x01, 0x95, 0x25, 0x80, 0x05, 0x02, 0x17, 0x25, 0x83, 0x00, 0x02, 0xda, 0x23, 0x85, 0xfa, 0x06, 0x16,
+    0x25, 0x86, 0x92, 0xf3, 0x09, 0xff, 0x3e, 0x57, 0x13, 0x21, 0x42, 0x0f, 0x00, 0x01, 0xf5, 0x09, 0x20, 0x42, 0x02, 0x55, 0x13, 0x00, 0x3f, 0x02,
+    0x55, 0x0f, 0x41, 0x41, 0x06, 0x28, 0x36, 0x5d, 0x74, 0x32, 0x59, 0xbc, 0x4b, 0x76, 0x5d, 0xe1, 0x52, 0x0f, 0x00, 0x01, 0x75, 0x5d, 0xe0, 0x52,
+    0x02, 0x34, 0x59, 0x5f, 0x4e, 0x02, 0x92, 0x59, 0xbd, 0x4b, 0x06, 0x17, 0x4f, 0x80, 0x96, 0x4c, 0xed, 0x1f, 0x29, 0x96, 0x01, 0x5e, 0x35, 0x0f,
+    0x00, 0x01, 0x95, 0x01, 0x20, 0x29, 0x02, 0x91, 0xf7, 0x5c, 0x35, 0x02, 0x4d, 0xed, 0x79, 0x32, 0x06, 0x1d, 0x1a, 0x6b, 0x7d, 0x93, 0x20, 0x9f,
+    0x29, 0xc1, 0x28, 0x4d, 0x34, 0x0f, 0x00, 0x01, 0x95, 0x20, 0xa0, 0x29, 0x02, 0xbb, 0x22, 0xa6, 0x2e, 0x02, 0xc0, 0x28, 0x4b, 0x34, 0x06, 0x24,
+    0x56, 0x93, 0x7b, 0x68, 0x49, 0x13, 0xf9, 0x11, 0x51, 0xc1, 0x07, 0x0f, 0x00, 0x01, 0xf5, 0x4e, 0xc0, 0x07, 0x02, 0x0f, 0x51, 0x9a, 0xff, 0x02,
+    0x69, 0x49, 0x14, 0xf9, 0x06, 0x1d, 0x46, 0xa4, 0x7e, 0xce, 0x5b, 0xfa, 0x20, 0xe4, 0x5f, 0x41, 0x2b, 0x0f, 0x00, 0x01, 0x95, 0x5f, 0x40, 0x2b,
+    0x02, 0xe2, 0x5f, 0xee, 0x25, 0x02, 0xd0, 0x5b, 0xfb, 0x20, 0x06, 0x27, 0x63, 0x78, 0x75, 0x53, 0x53, 0x26, 0x01, 0x7e, 0x65, 0xf5, 0x0b, 0x0f,
+    0x00, 0x01, 0x55, 0x53, 0x40, 0x05, 0x02, 0xc9, 0x5a, 0xf4, 0x0b, 0x02, 0x7c, 0x65, 0x28, 0x01, 0x06, 0x2a, 0x15, 0x82, 0x8b, 0x5f, 0xec, 0x1f,
+    0x1c, 0xd6, 0x02, 0xad, 0x2c, 0x0f, 0x00, 0x01, 0xd5, 0x02, 0x20, 0x1c, 0x02, 0x2b, 0xf8, 0xb6, 0x26, 0x02, 0x60, 0xec, 0xab, 0x2c, 0x06, 0x15,
+    0x6c, 0x67, 0x8f, 0xd0, 0x35, 0xdb, 0x55, 0xd6, 0x3a, 0x70, 0x5a, 0x0f, 0x00, 0x01, 0xd5, 0x3a, 0x00, 0x59, 0x02, 0xe3, 0x36, 0x6e, 0x5a, 0x02,
+    0xd1, 0x35, 0xdc, 0x55, 0x06, 0x27, 0x38, 0x8f, 0x9b, 0xd3, 0x11, 0xdf, 0x34, 0xba, 0x17, 0x69, 0x3f, 0x0f, 0x00, 0x01, 0xd5, 0x11, 0xe0, 0x34,
+    0x02, 0xb9, 0x17, 0x84, 0x3d, 0x02, 0xdd, 0x15, 0x68, 0x3f, 0x06, 0x1a, 0x44, 0x85, 0x57, 0x88, 0x08, 0x19, 0x2c, 0x76, 0x18, 0x81, 0x35, 0x0f,
+    0x00, 0x01, 0x75, 0x18, 0x80, 0x35, 0x02, 0x6f, 0x11, 0x5b, 0x2c, 0x02, 0x8a, 0x08, 0x1b, 0x2c, 0x06, 0x03, 0x5b, 0x87, 0x81, 0x73, 0x12, 0xbd,
+    0x3c, 0x36, 0x15, 0x01, 0x4c, 0x0f, 0x00, 0x01, 0x75, 0x12, 0x00, 0x4c, 0x02, 0x34, 0x15, 0x9f, 0x44, 0x02, 0x13, 0x14, 0xbf, 0x3c, 0x06, 0x05,
+    0x6a, 0x72, 0x7f, 0x46, 0x26, 0xf1, 0xf2, 0xb0, 0x30, 0x61, 0x07, 0x0f, 0x00, 0x01, 0xd5, 0x29, 0x60, 0x07, 0x02, 0xae, 0x30, 0x19, 0xfd, 0x02,
+    0x47, 0x26, 0xf3, 0xf2, 0x06, 0x21, 0x72, 0x60, 0x9b, 0x20, 0x3b, 0x8c, 0x0c, 0x91, 0x42, 0xe1, 0x13, 0x0f, 0x00, 0x01, 0x15, 0x3c, 0xe0, 0x13,
+    0x02, 0x22, 0x3b, 0x8d, 0x0c, 0x02, 0x8f, 0x42, 0x9a, 0x12, 0x06, 0x17, 0x0c, 0x64, 0xa3, 0x83, 0x22, 0x3f, 0x19, 0xd6, 0x2c, 0x91, 0x1d, 0x0f,
+    0x00, 0x01, 0xd5, 0x2c, 0x40, 0x19, 0x02, 0x4d, 0x24, 0x38, 0x1d, 0x02, 0x84, 0x22, 0x90, 0x1d, 0x06, 0x13, 0x78, 0x77, 0x61, 0x29, 0x16, 0x35,
+    0x59, 0xb6, 0x22, 0x1d, 0x5d, 0x0f, 0x00, 0x01, 0xb5, 0x22, 0xc0, 0x59, 0x02, 0x30, 0x1b, 0x1b, 0x5d, 0x02, 0x2b, 0x16, 0x36, 0x59, 0x06, 0x08,
+    0x58, 0x98, 0x76, 0x55, 0x28, 0xa0, 0x3e, 0x87, 0x2b, 0x81, 0x47, 0x0f, 0x00, 0x01, 0xd5, 0x2a, 0x80, 0x47, 0x02, 0x86, 0x2b, 0x11, 0x42, 0x02,
+    0x57, 0x28, 0xa2, 0x3e, 0x06, 0x0c, 0x57, 0x7f, 0x76, 0x5b, 0x32, 0x4e, 0x43, 0x36, 0x34, 0x61, 0x49, 0x0f, 0x00, 0x01, 0x35, 0x34, 0x60, 0x49,
+    0x02, 0x5c, 0x32, 0xa8, 0x45, 0x02, 0x44, 0x33, 0x4f, 0x43, 0x06, 0x31, 0x55, 0x59, 0x8c, 0xa8, 0x31, 0x9f, 0x1d, 0xc1, 0x38, 0xcc, 0x25, 0x0f,
+    0x00, 0x01, 0xf5, 0x31, 0xa0, 0x1d, 0x02, 0xbf, 0x38, 0xca, 0x25, 0x02, 0xa9, 0x31, 0xf4, 0x22, 0x06, 0x1d, 0x77, 0x71, 0x9b, 0xdc, 0x33, 0x9f,
+    0x1e, 0x2b, 0x37, 0xca, 0x24, 0x0f, 0x00, 0x01, 0xf5, 0x34, 0xa0, 0x1e, 0x02, 0x29, 0x37, 0xb4, 0x23, 0x02, 0xde, 0x33, 0xc9, 0x24, 0x06, 0x08,
+    0x70, 0x7b, 0x68, 0x2f, 0x1c, 0x77, 0x0f, 0x0f, 0x22, 0x61, 0x16, 0x0f, 0x00, 0x01, 0xd5, 0x1e, 0x60, 0x16, 0x02, 0x31, 0x1c, 0xfc, 0x10, 0x02,
+    0x0d, 0x22, 0x79, 0x0f, 0x06, 0x18, 0x0b, 0x74, 0x83, 0x85, 0x2c, 0x9f, 0x5f, 0x96, 0x36, 0x73, 0x62, 0x0f, 0x00, 0x01, 0x95, 0x36, 0xa0, 0x5f,
+    0x02, 0x3d, 0x30, 0x29, 0x61, 0x02, 0x86, 0x2c, 0x71, 0x62, 0x06, 0x19, 0x6b, 0x99, 0x98, 0x1e, 0x52, 0x5f, 0x5f, 0x76, 0x58, 0xc7, 0x64, 0x0f,
+    0x00, 0x01, 0x75, 0x58, 0x60, 0x5f, 0x02, 0x3a, 0x57, 0xc5, 0x64, 0x02, 0x1f, 0x52, 0xab, 0x63, 0x06, 0x1d, 0x67, 0x75, 0x80, 0xe3, 0x41, 0xff,
+    0x38, 0xb5, 0x43, 0x71, 0x3c, 0x0f, 0x00, 0x01, 0x95, 0x42, 0x00, 0x39, 0x02, 0xe4, 0x41, 0x6f, 0x3c, 0x02, 0xb4, 0x43, 0xbf, 0x3a, 0x06, 0x1a,
+    0x2e, 0x9e, 0x6b, 0x08, 0x40, 0x49, 0x4e, 0x36, 0x43, 0x97, 0x4f, 0x0f, 0x00, 0x01, 0x35, 0x43, 0xa0, 0x4e, 0x02, 0xbf, 0x42, 0x4b, 0x4e, 0x02,
+    0x0a, 0x40, 0x95, 0x4f, 0x06, 0x2c, 0x71, 0x89, 0x92, 0xa0, 0x34, 0xd7, 0x4c, 0x36, 0x38, 0x01, 0x52, 0x0f, 0x00, 0x01, 0x35, 0x38, 0x00, 0x52,
+    0x02, 0xa1, 0x34, 0x8c, 0x50, 0x02, 0xcd, 0x36, 0xd9, 0x4c, 0x06, 0x27, 0x78, 0x6a, 0x68, 0xcb, 0x4e, 0x77, 0x3c, 0x76, 0x53, 0x9e, 0x40, 0x0f,
+    0x00, 0x01, 0x75, 0x53, 0x60, 0x3d, 0x02, 0xf1, 0x4f, 0x9c, 0x40, 0x02, 0xcd, 0x4e, 0x78, 0x3c, 0x06, 0x1d, 0x61, 0x5b, 0x95, 0x29, 0x0a, 0x9f,
+    0x11, 0x21, 0x12, 0xcd, 0x22, 0x0f, 0x00, 0x01, 0xb5, 0x0a, 0xa0, 0x11, 0x02, 0x2a, 0x0a, 0x76, 0x1e, 0x02, 0x20, 0x12, 0xcb, 0x22, 0x06, 0x31,
+    0x1c, 0xa7, 0x6b, 0x93, 0x03, 0x2f, 0x1e, 0x27, 0x0e, 0xc1, 0x2c, 0x0f, 0x00, 0x01, 0x95, 0x03, 0xc0, 0x2c, 0x02, 0xbd, 0x0d, 0xe8, 0x21, 0x02,
+    0x25, 0x0e, 0x30, 0x1e, 0x06, 0x31, 0x03, 0x94, 0x69, 0x47, 0x4d, 0xf8, 0x55, 0x10, 0x52, 0x55, 0x5a, 0x0f, 0x00, 0x01, 0xd5, 0x50, 0x00, 0x57,
+    0x02, 0x0e, 0x52, 0xfa, 0x55, 0x02, 0x48, 0x4d, 0x53, 0x5a, 0x06, 0x17, 0x76, 0x5a, 0xa3, 0xbe, 0x2a, 0xb3, 0x24, 0x36, 0x31, 0xa1, 0x2a, 0x0f,
+    0x00, 0x01, 0x35, 0x31, 0xa0, 0x2a, 0x02, 0xbf, 0x2a, 0x2a, 0x2a, 0x02, 0x29, 0x2b, 0xb4, 0x24, 0x06, 0x18, 0x3e, 0x5f, 0x79, 0x33, 0x2c, 0x59,
+    0x4d, 0x4b, 0x30, 0x17, 0x53, 0x0f, 0x00, 0x01, 0x35, 0x2c, 0xc0, 0x4f, 0x02, 0xaf, 0x2c, 0x5b, 0x4d, 0x02, 0x4a, 0x30, 0x15, 0x53, 0x06, 0x25,
+    0x73, 0x88, 0x96, 0x73, 0x5e, 0xca, 0x43, 0xec, 0x62, 0xf7, 0x47, 0x0f, 0x00, 0x01, 0x75, 0x5e, 0x00, 0x47, 0x02, 0xeb, 0x62, 0xf6, 0x47, 0x02,
+    0x20, 0x61, 0xcb, 0x43, 0x06, 0x15, 0x79, 0x8f, 0x9d, 0x53, 0x26, 0xa8, 0x10, 0x0a, 0x2f, 0xd5, 0x19, 0x0f, 0x00, 0x01, 0x55, 0x26, 0x60, 0x18,
+    0x02, 0x3e, 0x2c, 0xaa, 0x10, 0x02, 0x08, 0x2f, 0xd4, 0x19, 0x06, 0x1b, 0x13, 0xa0, 0x93, 0xa8, 0x3a, 0x48, 0x3f, 0xd6, 0x3c, 0x21, 0x44, 0x0f,
+    0x00, 0x01, 0xd5, 0x3c, 0x20, 0x44, 0x02, 0x95, 0x3c, 0xd5, 0x42, 0x02, 0xaa, 0x3a, 0x4a, 0x3f, 0x06, 0x1f, 0x55, 0x71, 0x7f, 0x53, 0x39, 0x7f,
+    0x04, 0x96, 0x41, 0x51, 0x0c, 0x0f, 0x00, 0x01, 0x95, 0x41, 0x80, 0x04, 0x02, 0x04, 0x3c, 0x50, 0x0c, 0x02, 0x54, 0x39, 0x60, 0x08, 0x06, 0x1d,
+    0x27, 0x5e, 0x96, 0x2d, 0x0e, 0x1f, 0x33, 0x36, 0x14, 0xb5, 0x3b, 0x0f, 0x00, 0x01, 0x35, 0x14, 0x20, 0x33, 0x02, 0x2e, 0x0e, 0xba, 0x39, 0x02,
+    0xc8, 0x0e, 0xb4, 0x3b, 0x06, 0x1d, 0x61, 0x86, 0x7b, 0x32, 0x09, 0x5f, 0x11, 0xb3, 0x13, 0x1e, 0x18, 0x0f, 0x00, 0x01, 0x35, 0x0f, 0x60, 0x11,
+    0x02, 0x33, 0x09, 0x5e, 0x14, 0x02, 0xb1, 0x13, 0x1d, 0x18, 0x06, 0x02, 0x5e, 0x7e, 0x7c, 0xf3, 0x59, 0x59, 0x09, 0x13, 0x63, 0x21, 0x17, 0x0f,
+    0x00, 0x01, 0xf5, 0x59, 0x20, 0x17, 0x02, 0x12, 0x63, 0x9d, 0x0f, 0x02, 0x4f, 0x5e, 0x5b, 0x09, 0x06, 0x14, 0x17, 0x7b, 0x93, 0x93, 0x1a, 0xd9,
+    0x0a, 0x51, 0x29, 0xa1, 0x17, 0x0f, 0x00, 0x01, 0x95, 0x1a, 0xa0, 0x17, 0x02, 0x32, 0x21, 0x3d, 0x14, 0x02, 0x4f, 0x29, 0xdb, 0x0a, 0x06, 0x31,
+    0x26, 0x8d, 0x8b, 0x53, 0x0f, 0x51, 0x03, 0xc9, 0x21, 0x21, 0x13, 0x0f, 0x00, 0x01, 0x55, 0x0f, 0x20, 0x13, 0x02, 0x7e, 0x1b, 0x6a, 0x0d, 0x02,
+    0xc7, 0x21, 0x53, 0x03, 0x06, 0x10, 0x53, 0x6f, 0x59, 0x34, 0x22, 0x1f, 0x14, 0xd6, 0x28, 0x82, 0x1c, 0x0f, 0x00, 0x01, 0xd5, 0x28, 0x20, 0x14,
+    0x02, 0x36, 0x22, 0x81, 0x1c, 0x02, 0x37, 0x24, 0x82, 0x14, 0x06, 0x1d, 0x2f, 0x86, 0x99, 0x35, 0x5d, 0xbf, 0x18, 0xd6, 0x5f, 0xe3, 0x20, 0x0f,
+    0x00, 0x01, 0xd5, 0x5f, 0xc0, 0x18, 0x02, 0xb6, 0x5e, 0x41, 0x1f, 0x02, 0x37, 0x5d, 0xe2, 0x20, 0x06, 0x25, 0x7a, 0xa4, 0x77, 0x5b, 0x32, 0xbf,
+    0x12, 0x45, 0x35, 0x30, 0x1b, 0x0f, 0x00, 0x01, 0x15, 0x35, 0xc0, 0x12, 0x02, 0x5c, 0x32, 0x27, 0x16, 0x02, 0x44, 0x35, 0x2f, 0x1b, 0x06, 0x1a,
+    0x7a, 0x61, 0x98, 0x73, 0x49, 0xb8, 0x2a, 0x30, 0x4f, 0xe1, 0x2b, 0x0f, 0x00, 0x01, 0x75, 0x49, 0xe0, 0x2b, 0x02, 0x2e, 0x4f, 0xa0, 0x2b, 0x02,
+    0x48, 0x4a, 0xba, 0x2a, 0x06, 0x0e, 0x7f, 0x61, 0x58, 0x87, 0x21, 0x72, 0x24, 0xf6, 0x29, 0xdb, 0x2c, 0x0f, 0x00, 0x01, 0xf5, 0x29, 0xc0, 0x24,
+    0x02, 0xae, 0x22, 0xda, 0x2c, 0x02, 0x88, 0x21, 0x73, 0x24, 0x06, 0x17, 0x2c, 0xa0, 0x7c, 0xb9, 0xf9, 0xdf, 0x54, 0x56, 0x02, 0x88, 0x64, 0x0f,
+    0x00, 0x01, 0x55, 0x02, 0xe0, 0x54, 0x02, 0x58, 0x01, 0x23, 0x5c, 0x02, 0xbb, 0xf9, 0x86, 0x64, 0x06, 0x0b, 0x31, 0xa5, 0x84, 0x33, 0x29, 0xdf,
+    0x4b, 0x89, 0x2d, 0xa6, 0x51, 0x0f, 0x00, 0x01, 0x35, 0x29, 0xe0, 0x4b, 0x02, 0x47, 0x2d, 0x12, 0x4f, 0x02, 0x87, 0x2d, 0xa4, 0x51, 0x06, 0x1d,
+    0x5a, 0x80, 0x78, 0x6b, 0x2a, 0x2d, 0x24, 0x96, 0x2b, 0xc1, 0x2d, 0x0f, 0x00, 0x01, 0x95, 0x2b, 0xc0, 0x2d, 0x02, 0x6c, 0x2a, 0x17, 0x28, 0x02,
+    0x03, 0x2b, 0x2f, 0x24, 0x06, 0x09, 0x7c, 0x90, 0xa3, 0xed, 0x0e, 0xb1, 0x53, 0xd6, 0x14, 0xa1, 0x5b, 0x0f, 0x00, 0x01, 0xd5, 0x14, 0xa0, 0x5b,
+    0x02, 0xee, 0x0e, 0xf9, 0x5a, 0x02, 0x07, 0x13, 0xb3, 0x53, 0x06, 0x14, 0x0f, 0x81, 0x78, 0x93, 0x1a, 0x9f, 0x0c, 0x82, 0x1d, 0xad, 0x1c, 0x0f,
+    0x00, 0x01, 0x95, 0x1a, 0xa0, 0x0c, 0x02, 0x1b, 0x1c, 0x26, 0x13, 0x02, 0x81, 0x1d, 0xac, 0x1c, 0x06, 0x31, 0x35, 0x98, 0x6c, 0xc5, 0x4e, 0x02,
+    0x59, 0x76, 0x50, 0x53, 0x5b, 0x0f, 0x00, 0x01, 0x75, 0x50, 0xa0, 0x59, 0x02, 0xc7, 0x4e, 0x52, 0x5b, 0x02, 0x18, 0x50, 0x04, 0x59, 0x06, 0x1f,
+    0x78, 0xa0, 0x7c, 0x5e, 0x3d, 0x54, 0x17, 0x8c, 0x42, 0x61, 0x1f, 0x0f, 0x00, 0x01, 0xf5, 0x41, 0x60, 0x1f, 0x02, 0x5f, 0x3d, 0x0b, 0x1b, 0x02,
+    0x8a, 0x42, 0x55, 0x17, 0x06, 0x1b, 0x0d, 0x64, 0x5b, 0x73, 0x57, 0xc7, 0x3c, 0xde, 0x58, 0x71, 0x41, 0x0f, 0x00, 0x01, 0xb5, 0x57, 0x20, 0x3d,
+    0x02, 0x75, 0x57, 0xc8, 0x3c, 0x02, 0xdc, 0x58, 0x70, 0x41, 0x06, 0x1d, 0x77, 0xa4, 0x5f, 0x93, 0x32, 0xd0, 0x2c, 0xda, 0x38, 0x65, 0x32, 0x0f,
+    0x00, 0x01, 0x95, 0x32, 0x80, 0x2d, 0x02, 0x67, 0x38, 0xd2, 0x2c, 0x02, 0xd8, 0x38, 0x64, 0x32, 0x06, 0x1d, 0x22, 0x5c, 0x8c, 0x53, 0x56, 0xe8,
+    0x4a, 0x8b, 0x59, 0x77, 0x4f, 0x0f, 0x00, 0x01, 0x95, 0x56, 0xe0, 0x4d, 0x02, 0x55, 0x56, 0x75, 0x4f, 0x02, 0x8a, 0x59, 0xea, 0x4a, 0x06, 0x1d,
+    0x78, 0x6f, 0x65, 0xe2, 0x05, 0x0d, 0x47, 0x16, 0x0b, 0x9f, 0x4f, 0x0f, 0x00, 0x01, 0x15, 0x0b, 0xa0, 0x48, 0x02, 0xe3, 0x05, 0x0f, 0x47, 0x02,
+    0x72, 0x07, 0x9d, 0x4f, 0x06, 0x23, 0x3e, 0x8b, 0x66, 0x0a, 0x20, 0x2d, 0x3a, 0xd6, 0x26, 0x59, 0x3c, 0x0f, 0x00, 0x01, 0xd5, 0x26, 0xa0, 0x3a,
+    0x02, 0x0c, 0x20, 0x57, 0x3c, 0x02, 0x63, 0x24, 0x2e, 0x3a, 0x06, 0x11, 0x59, 0x8a, 0x99, 0x66, 0x04, 0x03, 0x34, 0xbb, 0x0e, 0x21, 0x36, 0x0f,
+    0x00, 0x01, 0xd5, 0x0a, 0x20, 0x36, 0x02, 0x67, 0x04, 0xb3, 0x35, 0x02, 0xba, 0x0e, 0x05, 0x34, 0x06, 0x12, 0x28, 0xa8, 0x6e, 0x53, 0x38, 0x4f,
+    0xfd, 0x0f, 0x42, 0x41, 0x0c, 0x0f, 0x00, 0x01, 0x55, 0x38, 0x40, 0x0c, 0x02, 0x0d, 0x42, 0xb8, 0x01, 0x02, 0xcd, 0x41, 0x51, 0xfd, 0x06, 0x1d,
+    0x71, 0x8c, 0x64, 0xf3, 0x0f, 0x3f, 0x24, 0xee, 0x18, 0xb2, 0x30, 0x0f, 0x00, 0x01, 0xf5, 0x0f, 0x40, 0x24, 0x02, 0xed, 0x18, 0x78, 0x26, 0x02,
+    0xc5, 0x15, 0xb0, 0x30, 0x06, 0x1e, 0x4b, 0x72, 0x5b, 0x44, 0x39, 0xff, 0x2a, 0xf6, 0x3f, 0xda, 0x2e, 0x0f, 0x00, 0x01, 0xf5, 0x3f, 0x00, 0x2b,
+    0x02, 0x8d, 0x3b, 0x40, 0x2b, 0x02, 0x45, 0x39, 0xd8, 0x2e, 0x06, 0x09, 0x62, 0x77, 0x7a, 0xe6, 0x1b, 0x1f, 0x50, 0x00, 0x21, 0xf4, 0x5c, 0x0f,
+    0x00, 0x01, 0xf5, 0x1d, 0x20, 0x50, 0x02, 0xfe, 0x20, 0xa9, 0x55, 0x02, 0xe7, 0x1b, 0xf3, 0x5c, 0x06, 0x1b, 0x62, 0x84, 0x7e, 0xd5, 0x17, 0x62,
+    0xfc, 0xd6, 0x22, 0x01, 0x10, 0x0f, 0x00, 0x01, 0xd5, 0x22, 0x00, 0x10, 0x02, 0xd6, 0x17, 0xc2, 0x05, 0x02, 0xf8, 0x1d, 0x63, 0xfc, 0x06, 0x1d,
+    0x76, 0xa1, 0x88, 0x18, 0x42, 0x48, 0x2f, 0xc0, 0x44, 0x21, 0x37, 0x0f, 0x00, 0x01, 0x75, 0x44, 0x20, 0x37, 0x02, 0x1a, 0x42, 0x05, 0x34, 0x02,
+    0xbe, 0x44, 0x4a, 0x2f, 0x06, 0x17, 0x72, 0x6a, 0x78, 0x42, 0x3f, 0xae, 0x47, 0x94, 0x42, 0xa1, 0x49, 0x0f, 0x00, 0x01, 0x15, 0x40, 0xa0, 0x49,
+    0x02, 0x44, 0x3f, 0xaf, 0x47, 0x02, 0x93, 0x42, 0x7e, 0x48, 0x06, 0x18, 0x60, 0x78, 0x78, 0x63, 0xf8, 0x1f, 0x0a, 0x56, 0x03, 0xd9, 0x11, 0x0f,
+    0x00, 0x01, 0x55, 0x03, 0x20, 0x0a, 0x02, 0xec, 0xfc, 0xd8, 0x11, 0x02, 0x64, 0xf8, 0x4f, 0x0d, 0x06, 0x24, 0x2e, 0x86, 0x68, 0xf0, 0x18, 0xfc,
+    0xfa, 0xb6, 0x27, 0x61, 0x05, 0x0f, 0x00, 0x01, 0xb5, 0x27, 0x60, 0x05, 0x02, 0x74, 0x21, 0x3f, 0xfd, 0x02, 0xf2, 0x18, 0xfd, 0xfa, 0x06, 0x10,
+    0x0d, 0x98, 0x6f, 0x82, 0x05, 0xff, 0x1b, 0x96, 0x13, 0xf0, 0x28, 0x0f, 0x00, 0x01, 0x95, 0x13, 0x00, 0x1c, 0x02, 0xac, 0x10, 0xf7, 0x1f, 0x02,
+    0x84, 0x05, 0xef, 0x28, 0x06, 0x25, 0x68, 0x94, 0x8f, 0xf3, 0x59, 0x7d, 0x16, 0x55, 0x5e, 0xff, 0x1b, 0x0f, 0x00, 0x01, 0xf5, 0x59, 0x40, 0x1a,
+    0x02, 0x54, 0x5e, 0x7f, 0x16, 0x02, 0x32, 0x5d, 0xfd, 0x1b, 0x06, 0x1a, 0x66, 0x91, 0x8d, 0xdd, 0x50, 0x91, 0xfb, 0xc9, 0x5a, 0xe1, 0x03, 0x0f,
+    0x00, 0x01, 0xd5, 0x57, 0xe0, 0x03, 0x02, 0xde, 0x50, 0x0a, 0x01, 0x02, 0xc7, 0x5a, 0x93, 0xfb, 0x06, 0x12, 0x5e, 0x95, 0x72, 0xf3, 0x56, 0xbf,
+    0x45, 0x41, 0x59, 0xb8, 0x4b, 0x0f, 0x00, 0x01, 0xf5, 0x56, 0xc0, 0x45, 0x02, 0x40, 0x59, 0xcb, 0x47, 0x02, 0xab, 0x58, 0xb6, 0x4b, 0x06, 0x04,
+    0x0f, 0x5b, 0x59, 0x60, 0x05, 0x75, 0x17, 0xf6, 0x0c, 0xa1, 0x1c, 0x0f, 0x00, 0x01, 0xf5, 0x0c, 0xa0, 0x1c, 0x02, 0xeb, 0x05, 0x76, 0x17, 0x02,
+    0x61, 0x05, 0xb6, 0x17, 0x06, 0x1d, 0x21, 0x58, 0x96, 0x53, 0x0f, 0xb4, 0x46, 0x31, 0x16, 0xc1, 0x4d, 0x0f, 0x00, 0x01, 0x95, 0x0f, 0xc0, 0x4d,
+    0x02, 0x55, 0x0f, 0x1b, 0x4c, 0x02, 0x2f, 0x16, 0xb5, 0x46, 0x06, 0x1d, 0x6b, 0x8a, 0x79, 0xa9, 0x3f, 0x7f, 0x19, 0xd6, 0x46, 0xed, 0x23, 0x0f,
+    0x00, 0x01, 0xd5, 0x46, 0x80, 0x19, 0x02, 0xab, 0x3f, 0xf6, 0x1d, 0x02, 0x20, 0x44, 0xeb, 0x23, 0x06, 0x27, 0x71, 0x5f, 0x5a, 0x93, 0x1c, 0xac,
+    0x02, 0xd1, 0x26, 0xc1, 0x06, 0x0f, 0x00, 0x01, 0x95, 0x1c, 0xc0, 0x06, 0x02, 0xc2, 0x1d, 0xad, 0x02, 0x02, 0xd0, 0x26, 0xed, 0x02, 0x06, 0x1d,
+    0x78, 0xa5, 0x61, 0x13, 0x3e, 0x20, 0x5b, 0x7a, 0x42, 0xc5, 0x5d, 0x0f, 0x00, 0x01, 0x15, 0x3e, 0x80, 0x5b, 0x02, 0x37, 0x42, 0x22, 0x5b, 0x02,
+    0x78, 0x42, 0xc4, 0x5d, 0x06, 0x00, 0x5b, 0xa3, 0x90, 0x33, 0x23, 0xd1, 0x1c, 0x1b, 0x2c, 0xa1, 0x25, 0x0f, 0x00, 0x01, 0x35, 0x23, 0xa0, 0x25,
+    0x02, 0x67, 0x2b, 0xd3, 0x1c, 0x02, 0x1a, 0x2c, 0xe5, 0x22, 0x06, 0x18, 0x78, 0x64, 0x8f, 0x07, 0x37, 0x1f, 0x17, 0x5f, 0x3e, 0x16, 0x1a, 0x0f,
+    0x00, 0x01, 0x55, 0x38, 0x20, 0x17, 0x02, 0x09, 0x37, 0x14, 0x1a, 0x02, 0x5d, 0x3e, 0x29, 0x19, 0x06, 0x20, 0x1e, 0x62, 0x89, 0x94, 0x2b, 0xc1,
+    0x21, 0x78, 0x30, 0x02, 0x24, 0x0f, 0x00, 0x01, 0x55, 0x2c, 0x20, 0x23, 0x02, 0x96, 0x2b, 0x01, 0x24, 0x02, 0x77, 0x30, 0xc2, 0x21, 0x06, 0x31,
+    0x3a, 0x60, 0x75, 0x53, 0x56, 0x11, 0x54, 0xbf, 0x5a, 0x8b, 0x58, 0x0f, 0x00, 0x01, 0x55, 0x56, 0xc0, 0x55, 0x02, 0xbe, 0x5a, 0x89, 0x58, 0x02,
+    0xe7, 0x56, 0x12, 0x54, 0x06, 0x31, 0x0e, 0x8b, 0x7e, 0x73, 0x40, 0xec, 0x16, 0x04, 0x43, 0xe1, 0x19, 0x0f, 0x00, 0x01, 0x75, 0x40, 0xe0, 0x19,
+    0x02, 0x03, 0x43, 0xee, 0x16, 0x02, 0x10, 0x42, 0x5c, 0x18, 0x06, 0x08, 0x2a, 0x72, 0xaa, 0xec, 0x2f, 0xeb, 0x3c, 0xc3, 0x30, 0x01, 0x42, 0x0f,
+    0x00, 0x01, 0x35, 0x30, 0x00, 0x42, 0x02, 0xc1, 0x30, 0xec, 0x3c, 0x02, 0xee, 0x2f, 0xf9, 0x41, 0x06, 0x13, 0x7b, 0x9e, 0x96, 0x83, 0x1f, 0x77,
+    0xfc, 0x16, 0x2a, 0xe1, 0xff, 0x0f, 0x00, 0x01, 0x15, 0x2a, 0xe0, 0xff, 0x02, 0x8d, 0x28, 0x78, 0xfc, 0x02, 0x85, 0x1f, 0x10, 0xff, 0x06, 0x01,
+    0x74, 0xa2, 0x5d, 0xb5, 0x26, 0xbf, 0x15, 0x16, 0x31, 0x61, 0x18, 0x0f, 0x00, 0x01, 0x15, 0x31, 0x60, 0x18, 0x02, 0x16, 0x30, 0xc1, 0x15, 0x02,
+    0xb6, 0x26, 0x01, 0x16, 0x06, 0x1c, 0x12, 0x88, 0x83, 0xb5, 0x44, 0x5f, 0x1e, 0x96, 0x4c, 0x23, 0x25, 0x0f, 0x00, 0x01, 0x95, 0x4c, 0x60, 0x1e,
+    0x02, 0x65, 0x49, 0x11, 0x22, 0x02, 0xb6, 0x44, 0x21, 0x25, 0x06, 0x1d, 0x63, 0x7b, 0x77, 0x45, 0x1f, 0xbf, 0x1b, 0xd6, 0x29, 0x2a, 0x21, 0x0f,
+    0x00, 0x01, 0xd5, 0x29, 0xc0, 0x1b, 0x02, 0xfd, 0x23, 0x29, 0x21, 0x02, 0x46, 0x1f, 0xf2, 0x1d, 0x06, 0x16, 0x1e, 0x92, 0x7e, 0x6d, 0x34, 0xf8,
+    0x52, 0x56, 0x3b, 0x01, 0x5e, 0x0f, 0x00, 0x01, 0x55, 0x3b, 0x00, 0x5e, 0x02, 0x62, 0x39, 0x4d, 0x58, 0x02, 0x6e, 0x34, 0xfa, 0x52, 0x06, 0x1c,
+    0x2a, 0x6d, 0x76, 0xd3, 0x58, 0x99, 0x51, 0x91, 0x60, 0x81, 0x58, 0x0f, 0x00, 0x01, 0xd5, 0x58, 0x80, 0x58, 0x02, 0x02, 0x5b, 0x4d, 0x54, 0x02,
+    0x8f, 0x60, 0x9b, 0x51, 0x06, 0x1d, 0x68, 0x97, 0x69, 0x97, 0x3c, 0xe2, 0x16, 0x7d, 0x43, 0x41, 0x1c, 0x0f, 0x00, 0x01, 0xf5, 0x41, 0x40, 0x1c,
+    0x02, 0x98, 0x3c, 0xe4, 0x16, 0x02, 0x7c, 0x43, 0x27, 0x18, 0x06, 0x1d, 0x59, 0x7a, 0x90, 0x3f, 0x2e, 0x4a, 0x0d, 0x96, 0x3d, 0x77, 0x12, 0x0f,
+    0x00, 0x01, 0x95, 0x3d, 0xe0, 0x10, 0x02, 0xea, 0x34, 0x76, 0x12, 0x02, 0x40, 0x2e, 0x4b, 0x0d, 0x06, 0x27, 0x29, 0x5b, 0x6c, 0xb8, 0x3b, 0xff,
+    0x1a, 0xe9, 0x3e, 0x54, 0x23, 0x0f, 0x00, 0x01, 0xf5, 0x3b, 0x00, 0x1b, 0x02, 0xe7, 0x3e, 0x53, 0x23, 0x02, 0xba, 0x3b, 0x45, 0x1d, 0x06, 0x14,
+    0x70, 0x67, 0x7d, 0xe5, 0x36, 0x1f, 0x37, 0xcf, 0x3b, 0xb4, 0x40, 0x0f, 0x00, 0x01, 0xf5, 0x37, 0x20, 0x37, 0x02, 0xce, 0x3b, 0x99, 0x3b, 0x02,
+    0xe7, 0x36, 0xb2, 0x40, 0x06, 0x1d, 0x1c, 0x67, 0x7a, 0x98, 0x57, 0x43, 0x14, 0x96, 0x5f, 0xe1, 0x20, 0x0f, 0x00, 0x01, 0x95, 0x5f, 0xe0, 0x20,
+    0x02, 0x47, 0x59, 0xb2, 0x19, 0x02, 0x99, 0x57, 0x44, 0x14, 0x06, 0x2e, 0x37, 0xa4, 0x7f, 0x33, 0x5d, 0x1f, 0x5c, 0xe7, 0x60, 0xc3, 0x61, 0x0f,
+    0x00, 0x01, 0x35, 0x5d, 0x20, 0x5c, 0x02, 0xa5, 0x60, 0xf1, 0x5e, 0x02, 0xe5, 0x60, 0xc1, 0x61, 0x06, 0x20, 0x5f, 0x73, 0x6c, 0x63, 0x03, 0xdf,
+    0x40, 0xf5, 0x09, 0xb1, 0x47, 0x0f, 0x00, 0x01, 0xb5, 0x05, 0xe0, 0x40, 0x02, 0x64, 0x03, 0xaf, 0x47, 0x02, 0xf3, 0x09, 0xbf, 0x42, 0x06, 0x09,
+    0x02, 0x84, 0x82, 0x18, 0x3b, 0x24, 0x51, 0x36, 0x43, 0x61, 0x58, 0x0f, 0x00, 0x01, 0x35, 0x43, 0x60, 0x58, 0x02, 0x97, 0x3f, 0x03, 0x55, 0x02,
+    0x1a, 0x3b, 0x25, 0x51, 0x06, 0x27, 0x4f, 0xa4, 0x87, 0x63, 0x0d, 0x5f, 0x5e, 0xb6, 0x10, 0xe1, 0x69, 0x0f, 0x00, 0x01, 0x75, 0x10, 0x60, 0x5e,
+    0x02, 0xb5, 0x10, 0x30, 0x65, 0x02, 0x65, 0x0d, 0xe0, 0x69, 0x06, 0x1b, 0x6a, 0x5c, 0xa3, 0x33, 0x05, 0xdf, 0x17, 0x7e, 0x0d, 0xea, 0x20, 0x0f,
+    0x00, 0x01, 0x35, 0x05, 0xe0, 0x17, 0x02, 0x7d, 0x0d, 0xe8, 0x20, 0x02, 0xe5, 0x05, 0x30, 0x20, 0x06, 0x1d, 0x11, 0x68, 0xa3, 0x52, 0x40, 0x7f,
+    0x52, 0x76, 0x41, 0x80, 0x55, 0x0f, 0x00, 0x01, 0x75, 0x41, 0x80, 0x52, 0x02, 0x94, 0x40, 0x3f, 0x55, 0x02, 0x54, 0x40, 0x7f, 0x55, 0x06, 0x31,
+    0x7a, 0xa3, 0x83, 0x36, 0x34, 0x3f, 0x4c, 0xbc, 0x37, 0x48, 0x4f, 0x0f, 0x00, 0x01, 0x75, 0x37, 0x40, 0x4c, 0x02, 0x38, 0x34, 0xe3, 0x4d, 0x02,
+    0xbb, 0x37, 0x46, 0x4f, 0x06, 0x17, 0x48, 0x68, 0x98, 0x53, 0x5c, 0x7f, 0x00, 0x84, 0x67, 0x50, 0x0a, 0x0f, 0x00, 0x01, 0x55, 0x5c, 0x80, 0x00,
+    0x02, 0xcc, 0x5e, 0x37, 0x08, 0x02, 0x83, 0x67, 0x4e, 0x0a, 0x06, 0x31, 0x2e, 0x6b, 0x76, 0x8d, 0x1f, 0xff, 0x00, 0x36, 0x2e, 0xdc, 0x13, 0x0f,
+    0x00, 0x01, 0x35, 0x2e, 0x00, 0x01, 0x02, 0x42, 0x23, 0x4d, 0x08, 0x02, 0x8f, 0x1f, 0xda, 0x13, 0x06, 0x09, 0x4a, 0x6a, 0x7c, 0xf3, 0x3b, 0x3f,
+    0x3e, 0xf9, 0x3c, 0xe7, 0x42, 0x0f, 0x00, 0x01, 0x35, 0x3c, 0x40, 0x3e, 0x02, 0xf5, 0x3b, 0x63, 0x40, 0x02, 0xf7, 0x3c, 0xe5, 0x42, 0x06, 0x1d,
+    0x63, 0x72, 0x75, 0xf3, 0x0e, 0x75, 0x32, 0xe2, 0x17, 0x21, 0x33, 0x0f, 0x00, 0x01, 0xf5, 0x0e, 0x20, 0x33, 0x02, 0x0b, 0x12, 0x76, 0x32, 0x02,
+    0xe1, 0x17, 0xb6, 0x32, 0x06, 0x16, 0x6d, 0x73, 0x76, 0x9f, 0x3e, 0xea, 0x40, 0x9c, 0x40, 0x61, 0x44, 0x0f, 0x00, 0x01, 0x55, 0x3f, 0x60, 0x44,
+    0x02, 0x9b, 0x40, 0x46, 0x42, 0x02, 0xa1, 0x3e, 0xec, 0x40, 0x06, 0x11, 0x75, 0x63, 0x85, 0x73, 0x52, 0x33, 0xfe, 0xa0, 0x56, 0x41, 0x01, 0x0f,
+    0x00, 0x01, 0x75, 0x52, 0x40, 0x01, 0x02, 0x29, 0x53, 0x35, 0xfe, 0x02, 0x9e, 0x56, 0xe9, 0xff, 0x06, 0x09, 0x7e, 0xa8, 0x80, 0x35, 0x3f, 0xa2,
+    0x0f, 0x56, 0x45, 0x21, 0x15, 0x0f, 0x00, 0x01, 0x55, 0x45, 0x20, 0x15, 0x02, 0x37, 0x3f, 0x62, 0x12, 0x02, 0x39, 0x45, 0xa4, 0x0f, 0x06, 0x04,
+    0x5a, 0x78, 0x6e, 0xb3, 0x51, 0xc3, 0x04, 0x69, 0x59, 0xc1, 0x0b, 0x0f, 0x00, 0x01, 0xb5, 0x51, 0xc0, 0x0b, 0x02, 0x67, 0x59, 0xd3, 0x06, 0x02,
+    0xda, 0x54, 0xc5, 0x04, 0x06, 0x0b, 0x1b, 0x65, 0xa7, 0xb2, 0x52, 0xbf, 0x1d, 0xf6, 0x5b, 0x51, 0x25, 0x0f, 0x00, 0x01, 0xf5, 0x5b, 0xc0, 0x1d,
+    0x02, 0x64, 0x54, 0x4f, 0x25, 0x02, 0xb4, 0x52, 0x0f, 0x25, 0x06, 0x27, 0x35, 0x70, 0x6c, 0xf8, 0x42, 0xff, 0x22, 0x16, 0x49, 0xc6, 0x2b, 0x0f,
+    0x00, 0x01, 0x15, 0x49, 0x00, 0x23, 0x02, 0xe7, 0x44, 0x53, 0x25, 0x02, 0xfa, 0x42, 0xc5, 0x2b, 0x06, 0x13, 0x43, 0xa3, 0x76, 0xd3, 0x57, 0x1f,
+    0x1b, 0x5c, 0x61, 0x87, 0x1f, 0x0f, 0x00, 0x01, 0xd5, 0x57, 0x20, 0x1b, 0x02, 0x87, 0x60, 0xd3, 0x1c, 0x02, 0x5a, 0x61, 0x85, 0x1f, 0x06, 0x19,
+    0x5f, 0x86, 0x78, 0x53, 0x2c, 0xdb, 0x48, 0x4f, 0x33, 0xba, 0x4e, 0x0f, 0x00, 0x01, 0x55, 0x2c, 0x40, 0x4b, 0x02, 0x51, 0x30, 0xdc, 0x48, 0x02,
+    0x4d, 0x33, 0xb9, 0x4e, 0x06, 0x14, 0x61, 0x8e, 0x8c, 0x82, 0x48, 0xdf, 0x56, 0xde, 0x4a, 0xf1, 0x5c, 0x0f, 0x00, 0x01, 0x15, 0x4a, 0xe0, 0x56,
+    0x02, 0xdc, 0x4a, 0xc8, 0x5a, 0x02, 0x84, 0x48, 0xef, 0x5c, 0x06, 0x15, 0x1f, 0x64, 0xa2, 0x84, 0x30, 0xdf, 0x2b, 0x16, 0x35, 0xba, 0x2e, 0x0f,
+    0x00, 0x01, 0x15, 0x35, 0xe0, 0x2b, 0x02, 0x4d, 0x31, 0xb8, 0x2e, 0x02, 0x85, 0x30, 0x78, 0x2e, 0x06, 0x2e, 0x66, 0x72, 0x79, 0x9d, 0x39, 0x9f,
+    0x51, 0x6b, 0x3c, 0x8b, 0x56, 0x0f, 0x00, 0x01, 0x95, 0x3a, 0xa0, 0x51, 0x02, 0x6a, 0x3c, 0xb5, 0x53, 0x02, 0x9f, 0x39, 0x8a, 0x56, 0x06, 0x0a,
+    0x70, 0x62, 0x9a, 0x02, 0xff, 0xad, 0x40, 0x73, 0x09, 0xe1, 0x4a, 0x0f, 0x00, 0x01, 0x95, 0x00, 0xe0, 0x4a, 0x02, 0x04, 0xff, 0xaf, 0x40, 0x02,
+    0x72, 0x09, 0xfd, 0x48, 0x06, 0x27, 0x70, 0x7c, 0x6b, 0xd3, 0x1e, 0x1f, 0x1a, 0x2c, 0x2d, 0x5c, 0x1d, 0x0f, 0x00, 0x01, 0xd5, 0x1e, 0x20, 0x1a,
+    0x02, 0x6f, 0x25, 0x5b, 0x1d, 0x02, 0x2a, 0x2d, 0xf5, 0x1a, 0x06, 0x1a, 0x04, 0x7f, 0x81, 0xb5, 0x16, 0x01, 0x2d, 0x1a, 0x1e, 0x06, 0x32, 0x0f,
+    0x00, 0x01, 0x55, 0x1a, 0xa0, 0x2f, 0x02, 0xb7, 0x16, 0x02, 0x2d, 0x02, 0x19, 0x1e, 0x04, 0x32, 0x06, 0x16, 0x36, 0x60, 0x7b, 0x33, 0x45, 0x3f,
+    0x20, 0x77, 0x4b, 0xc1, 0x2a, 0x0f, 0x00, 0x01, 0x35, 0x45, 0xc0, 0x2a, 0x02, 0x05, 0x46, 0xf1, 0x24, 0x02, 0x76, 0x4b, 0x41, 0x20, 0x06, 0x05,
+    0x2f, 0x74, 0x6c, 0xcb, 0x03, 0x1f, 0x50, 0xf6, 0x0a, 0xd9, 0x58, 0x0f, 0x00, 0x01, 0xf5, 0x0a, 0x20, 0x50, 0x02, 0xcd, 0x03, 0xd8, 0x58, 0x02,
+    0x65, 0x06, 0x70, 0x52, 0x06, 0x16, 0x6d, 0x9c, 0x62, 0x73, 0x27, 0x89, 0x0b, 0x0a, 0x2a, 0x16, 0x11, 0x0f, 0x00, 0x01, 0x75, 0x27, 0x60, 0x0c,
+    0x02, 0x9f, 0x29, 0x8a, 0x0b, 0x02, 0x09, 0x2a, 0x14, 0x11, 0x06, 0x18, 0x72, 0x77, 0x94, 0x13, 0x1e, 0x92, 0x45, 0xd0, 0x20, 0xe1, 0x4d, 0x0f,
+    0x00, 0x01, 0x15, 0x1e, 0xe0, 0x4d, 0x02, 0xcf, 0x20, 0xba, 0x4b, 0x02, 0x28, 0x1f, 0x94, 0x45, 0x06, 0x10, 0x6b, 0x8c, 0x6a, 0x66, 0x16, 0x51,
+    0x23, 0x40, 0x1f, 0x01, 0x2d, 0x0f, 0x00, 0x01, 0x15, 0x1c, 0x00, 0x2d, 0x02, 0x3e, 0x1f, 0xaa, 0x25, 0x02, 0x68, 0x16, 0x53, 0x23, 0x06, 0x2b,
+    0x7c, 0x5f, 0xa8, 0x33, 0x08, 0x56, 0xfe, 0x22, 0x0b, 0x4d, 0x0a, 0x0f, 0x00, 0x01, 0x35, 0x08, 0x00, 0x0a, 0x02, 0x21, 0x0b, 0x4c, 0x0a, 0x02,
+    0x8c, 0x08, 0x57, 0xfe, 0x06, 0x1f, 0x03, 0x80, 0x7d, 0xba, 0x42, 0xa6, 0x3c, 0xb6, 0x44, 0x01, 0x3f, 0x0f, 0x00, 0x01, 0xb5, 0x44, 0x00, 0x3f,
+    0x02, 0xb8, 0x43, 0xc4, 0x3d, 0x02, 0xbc, 0x42, 0xa7, 0x3c, 0x06, 0x26, 0x34, 0x58, 0x85, 0xb3, 0x4f, 0xde, 0x19, 0x56, 0x53, 0x41, 0x21, 0x0f,
+    0x00, 0x01, 0xb5, 0x4f, 0x40, 0x21, 0x02, 0x54, 0x53, 0xe0, 0x19, 0x02, 0xd4, 0x4f, 0xff, 0x1d, 0x06, 0x1c, 0x44, 0x63, 0x91, 0x93, 0x3e, 0x7f,
+    0x3b, 0x46, 0x42, 0x59, 0x3c, 0x0f, 0x00, 0x01, 0x95, 0x3e, 0x80, 0x3b, 0x02, 0x2d, 0x3f, 0x18, 0x3c, 0x02, 0x45, 0x42, 0x58, 0x3c, 0x06, 0x1a,
+    0x26, 0x7d, 0x9b, 0x69, 0x3d, 0xbf, 0x4d, 0xb6, 0x3f, 0x78, 0x4f, 0x0f, 0x00, 0x01, 0xb5, 0x3f, 0xc0, 0x4d, 0x02, 0x80, 0x3e, 0x2b, 0x4f, 0x02,
+    0x6b, 0x3d, 0x76, 0x4f, 0x06, 0x13, 0x7c, 0x82, 0x59, 0x33, 0x52, 0x52, 0x33, 0x09, 0x5b, 0x4b, 0x37, 0x0f, 0x00, 0x01, 0x35, 0x52, 0x80, 0x33,
+    0x02, 0xde, 0x56, 0x4a, 0x37, 0x02, 0x08, 0x5b, 0x53, 0x33, 0x06, 0x27, 0x0c, 0x7d, 0x86, 0xe3, 0x1f, 0x6e, 0x45, 0x16, 0x25, 0xe1, 0x45, 0x0f,
+    0x00, 0x01, 0x15, 0x25, 0xe0, 0x45, 0x02, 0xe4, 0x1f, 0x70, 0x45, 0x02, 0x54, 0x22, 0xb0, 0x45, 0x06, 0x15, 0x2c, 0x79, 0xa4, 0x48, 0x3c, 0xdf,
+    0x07, 0xf6, 0x46, 0x76, 0x0d, 0x0f, 0x00, 0x01, 0xf5, 0x46, 0xe0, 0x07, 0x02, 0xbf, 0x40, 0x0b, 0x0d, 0x02, 0x4a, 0x3c, 0x75, 0x0d, 0x06, 0x22,
+    0x65, 0x74, 0x70, 0xf3, 0x2a, 0x62, 0x0f, 0x9a, 0x35, 0xa3, 0x13, 0x0f, 0x00, 0x01, 0xf5, 0x2a, 0xc0, 0x10, 0x02, 0xd7, 0x2e, 0xa2, 0x13, 0x02,
+    0x98, 0x35, 0x64, 0x0f, 0x06, 0x15, 0x73, 0x7d, 0x66, 0x13, 0x0f, 0xff, 0x0b, 0x8f, 0x19, 0x3e, 0x17, 0x0f, 0x00, 0x01, 0x15, 0x0f, 0x00, 0x0c,
+    0x02, 0x11, 0x14, 0x3c, 0x17, 0x02, 0x8e, 0x19, 0x39, 0x0e, 0x06, 0x1c, 0x50, 0x92, 0x7e, 0x8e, 0x14, 0xff, 0x14, 0x03, 0x1a, 0xdc, 0x23, 0x0f,
+    0x00, 0x01, 0x75, 0x18, 0x00, 0x15, 0x02, 0x02, 0x1a, 0x2d, 0x1c, 0x02, 0x8f, 0x14, 0xda, 0x23, 0x06, 0x1d, 0x31, 0x69, 0x99, 0x73, 0x58, 0xff,
+    0x33, 0x96, 0x5d, 0x31, 0x39, 0x0f, 0x00, 0x01, 0x95, 0x5d, 0x00, 0x34, 0x02, 0xa5, 0x59, 0x30, 0x39, 0x02, 0x75, 0x58, 0x20, 0x38, 0x06, 0x15,
+    0x73, 0x8c, 0x9d, 0x2f, 0x4b, 0xfd, 0x12, 0x96, 0x55, 0x9d, 0x18, 0x0f, 0x00, 0x01, 0x95, 0x55, 0xc0, 0x17, 0x02, 0xf3, 0x51, 0xfe, 0x12, 0x02,
+    0x31, 0x4b, 0x9c, 0x18, 0x06, 0x09, 0x63, 0x7c, 0x87, 0x74, 0xfc, 0x9f, 0x5f, 0x97, 0x06, 0x62, 0x6a, 0x0f, 0x00, 0x01, 0x15, 0x01, 0xa0, 0x5f,
+    0x02, 0x95, 0x06, 0x61, 0x6a, 0x02, 0x76, 0xfc, 0x01, 0x66, 0x06, 0x0f, 0x75, 0x7d, 0x9d, 0xfb, 0x46, 0xd2, 0x19, 0x36, 0x49, 0x21, 0x21, 0x0f,
+    0x00, 0x01, 0x35, 0x49, 0x20, 0x21, 0x02, 0x09, 0x48, 0xd4, 0x19, 0x02, 0xfc, 0x46, 0x08, 0x20, 0x06, 0x0f, 0x46, 0x61, 0x7d, 0x7d, 0x33, 0x51,
+    0x1c, 0xb6, 0x39, 0xc1, 0x28, 0x0f, 0x00, 0x01, 0xb5, 0x39, 0xc0, 0x28, 0x02, 0x7e, 0x33, 0x29, 0x22, 0x02, 0x67, 0x34, 0x53, 0x1c, 0x06, 0x15,
+    0x79, 0x8f, 0x63, 0x9c, 0x0f, 0x1f, 0x27, 0xd6, 0x17, 0x72, 0x32, 0x0f, 0x00, 0x01, 0xd5, 0x17, 0x20, 0x27, 0x02, 0x9d, 0x0f, 0x08, 0x29, 0x02,
+    0x45, 0x15, 0x70, 0x32, 0x06, 0x1d, 0x31, 0x8f, 0xa0, 0x41, 0x39, 0xc6, 0x1a, 0x96, 0x3f, 0x01, 0x1d, 0x0f, 0x00, 0x01, 0x95, 0x3f, 0xc0, 0x1c,
+    0x02, 0x9c, 0x3d, 0x00, 0x1d, 0x02, 0x43, 0x39, 0xc7, 0x1a, 0x06, 0x1d, 0x03, 0x61, 0x5f, 0x4d, 0x35, 0xd8, 0x1d, 0x36, 0x3b, 0x21, 0x25, 0x0f,
+    0x00, 0x01, 0x35, 0x3b, 0x20, 0x25, 0x02, 0x22, 0x36, 0xad, 0x1e, 0x02, 0x4e, 0x35, 0xda, 0x1d, 0x06, 0x1b, 0x75, 0x68, 0x8d, 0x72, 0x49, 0x3f,
+    0x0f, 0x93, 0x4f, 0xa0, 0x13, 0x0f, 0x00, 0x01, 0xd5, 0x4a, 0x40, 0x0f, 0x02, 0x73, 0x49, 0x9e, 0x13, 0x02, 0x91, 0x4f, 0x1d, 0x12, 0x06, 0x1d,
+    0x53, 0x98, 0x60, 0x3b, 0x13, 0xc7, 0x0f, 0xa6, 0x1b, 0x11, 0x19, 0x0f, 0x00, 0x01, 0xd5, 0x19, 0x00, 0x11, 0x02, 0x3c, 0x13, 0xc8, 0x0f, 0x02,
+    0xa4, 0x1b, 0x10, 0x19, 0x06, 0x30, 0x7b, 0x80, 0x5a, 0x2f, 0x05, 0x5c, 0x13, 0xf4, 0x0d, 0x21, 0x1b, 0x0f, 0x00, 0x01, 0x95, 0x09, 0x20, 0x1b,
+    0x02, 0xf3, 0x0d, 0x5e, 0x13, 0x02, 0x30, 0x05, 0xdc, 0x13, 0x06, 0x31, 0x03, 0x62, 0x63, 0xdb, 0x3b, 0xa6, 0x12, 0xd6, 0x43, 0xa1, 0x19, 0x0f,
+    0x00, 0x01, 0xd5, 0x43, 0xa0, 0x19, 0x02, 0x09, 0x3d, 0xd4, 0x13, 0x02, 0xdc, 0x3b, 0xa8, 0x12, 0x06, 0x11, 0x74, 0x80, 0x64, 0xb8, 0x04, 0x23,
+    0x13, 0xb6, 0x0f, 0x64, 0x1f, 0x0f, 0x00, 0x01, 0xb5, 0x0f, 0x40, 0x15, 0x02, 0x37, 0x0a, 0x63, 0x1f, 0x02, 0xba, 0x04, 0x25, 0x13, 0x06, 0x19,
+    0x3b, 0x8f, 0x67, 0x73, 0x55, 0x0a, 0x18, 0x8c, 0x5c, 0x81, 0x20, 0x0f, 0x00, 0x01, 0x75, 0x55, 0x80, 0x20, 0x02, 0x8b, 0x5c, 0xd6, 0x19, 0x02,
+    0x41, 0x5a, 0x0c, 0x18, 0x06, 0x17, 0x5d, 0x6e, 0x89, 0xf3, 0x26, 0x8a, 0x53, 0xcc, 0x2d, 0x97, 0x5a, 0x0f, 0x00, 0x01, 0xf5, 0x26, 0xe0, 0x57,
+    0x02, 0xcb, 0x2d, 0x96, 0x5a, 0x02, 0x00, 0x29, 0x8c, 0x53, 0x06, 0x1c, 0x6b, 0x7d, 0x91, 0x20, 0x3c, 0xf5, 0x30, 0x96, 0x41, 0x81, 0x35, 0x0f,
+    0x00, 0x01, 0x95, 0x41, 0x80, 0x35, 0x02, 0xab, 0x3e, 0xf6, 0x30, 0x02, 0x21, 0x3c, 0x2d, 0x34, 0x06, 0x09, 0x45, 0x6f, 0x8d, 0xcb, 0x18, 0xae,
+    0x33, 0xa6, 0x1e, 0x01, 0x3b, 0x0f, 0x00, 0x01, 0x95, 0x1a, 0x00, 0x3b, 0x02, 0xcc, 0x18, 0x78, 0x38, 0x02, 0xa4, 0x1e, 0xb0, 0x33, 0x06, 0x13,
+    0x01, 0x8e, 0x70, 0xab, 0x5a, 0x5f, 0x45, 0x16, 0x60, 0x79, 0x4c, 0x0f, 0x00, 0x01, 0x15, 0x60, 0x60, 0x45, 0x02, 0x51, 0x5e, 0x9c, 0x47, 0x02,
+    0xac, 0x5a, 0x77, 0x4c, 0x06, 0x1d, 0x03, 0x7b, 0x82, 0x16, 0x1b, 0x3f, 0x37, 0x56, 0x22, 0x44, 0x40, 0x0f, 0x00, 0x01, 0x55, 0x22, 0x40, 0x37,
+    0x02, 0x56, 0x1e, 0x01, 0x3c, 0x02, 0x17, 0x1b, 0x42, 0x40, 0x06, 0x25, 0x00, 0x87, 0x78, 0x36, 0xfb, 0xbf, 0x43, 0x76, 0x07, 0xa4, 0x50, 0x0f,
+    0x00, 0x01, 0x75, 0x07, 0xc0, 0x43, 0x02, 0x66, 0x02, 0x12, 0x49, 0x02, 0x38, 0xfb, 0xa3, 0x50, 0x06, 0x13, 0x3b, 0x85, 0xa6, 0x93, 0x1d, 0x7f,
+    0x58, 0xe5, 0x20, 0x1f, 0x61, 0x0f, 0x00, 0x01, 0x95, 0x1d, 0x80, 0x58, 0x02, 0xe4, 0x20, 0xaf, 0x60, 0x02, 0x73, 0x1f, 0x1e, 0x61, 0x06, 0x17,
+    0x13, 0x89, 0x7d, 0x93, 0x1e, 0x7f, 0x4b, 0xdd, 0x29, 0xe9, 0x53, 0x0f, 0x00, 0x01, 0x95, 0x1e, 0x80, 0x4b, 0x02, 0x88, 0x25, 0x74, 0x4f, 0x02,
+    0xdc, 0x29, 0xe7, 0x53, 0x06, 0x16, 0x17, 0x6f, 0x5f, 0xf3, 0x1f, 0x7f, 0x5b, 0x14, 0x27, 0x20, 0x62, 0x0f, 0x00, 0x01, 0xf5, 0x1f, 0x80, 0x5b,
+    0x02, 0x24, 0x22, 0x4f, 0x5c, 0x02, 0x13, 0x27, 0x1e, 0x62, 0x06, 0x09, 0x41, 0x61, 0x84, 0x52, 0x38, 0xdf, 0x43, 0x36, 0x3a, 0x00, 0x47, 0x0f,
+    0x00, 0x01, 0x35, 0x3a, 0xe0, 0x43, 0x02, 0x94, 0x38, 0xff, 0x46, 0x02, 0x54, 0x38, 0x9d, 0x45, 0x06, 0x1d, 0x4d, 0x5e, 0x85, 0xb7, 0x09, 0x3f,
+    0x17, 0x7f, 0x0f, 0xea, 0x2a, 0x0f, 0x00, 0x01, 0x55, 0x0a, 0x40, 0x17, 0x02, 0xb9, 0x09, 0x44, 0x22, 0x02, 0x7d, 0x0f, 0xe8, 0x2a, 0x06, 0x03,
+    0x0a, 0x83, 0x75, 0xf3, 0x33, 0x98, 0x47, 0xd0, 0x3d, 0x01, 0x50, 0x0f, 0x00, 0x01, 0xf5, 0x33, 0x00, 0x50, 0x02, 0x41, 0x39, 0xcd, 0x4a, 0x02,
+    0xce, 0x3d, 0x99, 0x47, 0x06, 0x31, 0x57, 0x76, 0x7f, 0x53, 0x2d, 0x65, 0x4f, 0x1d, 0x2e, 0xaf, 0x54, 0x0f, 0x00, 0x01, 0x55, 0x2d, 0x00, 0x52,
+    0x02, 0x1c, 0x2e, 0x67, 0x4f, 0x02, 0xa2, 0x2d, 0xad, 0x54, 0x06, 0x21, 0x73, 0x93, 0x8d, 0xd3, 0x5d, 0xef, 0x0a, 0x76, 0x6a, 0xe1, 0x0d, 0x0f,
+    0x00, 0x01, 0xd5, 0x5d, 0xe0, 0x0c, 0x02, 0x05, 0x67, 0xf0, 0x0a, 0x02, 0x75, 0x6a, 0xe0, 0x0d, 0x06, 0x1d, 0x77, 0x63, 0x89, 0xc1, 0x4b, 0xdf,
+    0x5a, 0x4d, 0x4f, 0xb0, 0x5d, 0x0f, 0x00, 0x01, 0x55, 0x4c, 0xe0, 0x5a, 0x02, 0x4c, 0x4f, 0x97, 0x5c, 0x02, 0xc3, 0x4b, 0xae, 0x5d, 0x06, 0x23,
+    0x07, 0x6d, 0x68, 0x53, 0x1e, 0x9f, 0x3b, 0x4c, 0x24, 0xb7, 0x43, 0x0f, 0x00, 0x01, 0x55, 0x1e, 0xa0, 0x3b, 0x02, 0x4b, 0x24, 0xb6, 0x43, 0x02,
+    0x00, 0x20, 0x6c, 0x3d, 0x06, 0x15, 0x4f, 0xa7, 0x89, 0x68, 0x01, 0x3f, 0x3f, 0x71, 0x0b, 0xd7, 0x48, 0x0f, 0x00, 0x01, 0x15, 0x0b, 0x40, 0x3f,
+    0x02, 0x6f, 0x0b, 0x1b, 0x45, 0x02, 0x6a, 0x01, 0xd5, 0x48, 0x06, 0x2c, 0x01, 0x7f, 0x7f, 0xb3, 0x0f, 0xd5, 0x1c, 0xac, 0x1e, 0xa1, 0x27, 0x0f,
+    0x00, 0x01, 0xb5, 0x0f, 0xa0, 0x27, 0x02, 0x20, 0x17, 0x2b, 0x22, 0x02, 0xab, 0x1e, 0xd6, 0x1c, 0x06, 0x26, 0x38, 0xa2, 0x82, 0xb4, 0x0a, 0x1f,
+    0x58, 0xd6, 0x12, 0xe2, 0x60, 0x0f, 0x00, 0x01, 0xd5, 0x12, 0x20, 0x58, 0x02, 0x15, 0x12, 0xc0, 0x5c, 0x02, 0xb5, 0x0a, 0xe1, 0x60, 0x06, 0x0c,
+    0x57, 0x7c, 0x71, 0x93, 0x3f, 0xd2, 0x2d, 0x7d, 0x48, 0x01, 0x30, 0x0f, 0x00, 0x01, 0x95, 0x3f, 0x00, 0x30, 0x02, 0xa8, 0x43, 0xd4, 0x2d, 0x02,
+    0x7b, 0x48, 0x87, 0x2e, 0x06, 0x18, 0x21, 0x8a, 0x74, 0xa0, 0x5b, 0xac, 0x40, 0x8d, 0x5d, 0xf8, 0x45, 0x0f, 0x00, 0x01, 0xd5, 0x5c, 0xa0, 0x42,
+    0x02, 0x8b, 0x5d, 0xf7, 0x45, 0x02, 0xa2, 0x5b, 0xad, 0x40, 0x06, 0x1d, 0x70, 0x68, 0x82, 0x55, 0x1b, 0xa0, 0x05, 0x56, 0x26, 0xc4, 0x0e, 0x0f,
+    0x00, 0x01, 0x55, 0x26, 0x80, 0x0a, 0x02, 0x56, 0x1b, 0xa1, 0x05, 0x02, 0xd7, 0x1d, 0xc3, 0x0e, 0x06, 0x1c, 0x7c, 0x89, 0x58, 0x33, 0x07, 0x1f,
+    0x37, 0x9d, 0x0f, 0x8f, 0x3e, 0x0f, 0x00, 0x01, 0x35, 0x07, 0x20, 0x37, 0x02, 0x9c, 0x0f, 0x67, 0x37, 0x02, 0x62, 0x0c, 0x8d, 0x3e, 0x06, 0x15,
+    0x3e, 0x7d, 0xa7, 0x73, 0x0d, 0x13, 0x24, 0x5f, 0x1f, 0xa1, 0x2a, 0x0f, 0x00, 0x01, 0x75, 0x0d, 0x60, 0x2a, 0x02, 0xc9, 0x15, 0xa0, 0x2a, 0x02,
+    0x5d, 0x1f, 0x14, 0x24, 0x06, 0x17, 0x67, 0x57, 0x99, 0x16, 0x08, 0x84, 0x11, 0x36, 0x12, 0x41, 0x1e, 0x0f, 0x00, 0x01, 0x35, 0x12, 0x40, 0x1e,
+    0x02, 0x17, 0x08, 0xc3, 0x1b, 0x02, 0x5a, 0x08, 0x85, 0x11, 0x06, 0x0a, 0x73, 0xa0, 0x9d, 0x13, 0x06, 0x1d, 0x13, 0xd5, 0x10, 0x61, 0x1e, 0x0f,
+    0x00, 0x01, 0x95, 0x0f, 0x60, 0x1e, 0x02, 0x14, 0x06, 0x9f, 0x1c, 0x02, 0xd3, 0x10, 0x1f, 0x13, 0x06, 0x1c, 0x11, 0x56, 0x62, 0xf3, 0x26, 0x5f,
+    0x2e, 0xa5, 0x2e, 0xd0, 0x30, 0x0f, 0x00, 0x01, 0xf5, 0x26, 0x60, 0x2e, 0x02, 0xa4, 0x2e, 0xcf, 0x30, 0x02, 0x12, 0x27, 0xbd, 0x2e, 0x06, 0x13,
+    0x7a, 0x83, 0x5b, 0xe0, 0x25, 0xeb, 0x39, 0x2f, 0x2a, 0x81, 0x3e, 0x0f, 0x00, 0x01, 0x35, 0x28, 0x80, 0x3e, 0x02, 0xe1, 0x25, 0xec, 0x39, 0x02,
+    0x2e, 0x2a, 0x39, 0x3a, 0x06, 0x1b, 0x15, 0x81, 0x73, 0xf3, 0x3d, 0xff, 0x51, 0x5c, 0x41, 0xe7, 0x55, 0x0f, 0x00, 0x01, 0xf5, 0x3d, 0x00, 0x52,
+    0x02, 0xb8, 0x3f, 0x63, 0x53, 0x02, 0x5a, 0x41, 0xe5, 0x55, 0x06, 0x27, 0x5c, 0xa3, 0x9a, 0x8e, 0x5b, 0x0c, 0x4a, 0x83, 0x60, 0xdc, 0x4d, 0x0f,
+    0x00, 0x01, 0x15, 0x60, 0x20, 0x4d, 0x02, 0x82, 0x60, 0x0d, 0x4a, 0x02, 0x8f, 0x5b, 0xda, 0x4d, 0x06, 0x1d, 0x79, 0x96, 0x99, 0xaf, 0x2f, 0x7f,
+    0x03, 0xcf, 0x3a, 0x7a, 0x0b, 0x0f, 0x00, 0x01, 0x35, 0x38, 0x80, 0x03, 0x02, 0xb1, 0x2f, 0xdc, 0x09, 0x02, 0xcd, 0x3a, 0x79, 0x0b, 0x06, 0x12,
+    0x72, 0x97, 0x84, 0x4a, 0x40, 0x1f, 0x13, 0xc4, 0x42, 0x6f, 0x1d, 0x0f, 0x00, 0x01, 0x35, 0x42, 0x20, 0x13, 0x02, 0x4c, 0x40, 0xd7, 0x18, 0x02,
+    0xc3, 0x42, 0x6e, 0x1d, 0x06, 0x14, 0x2f, 0x67, 0x86, 0x33, 0x4f, 0x1f, 0x36, 0x7b, 0x53, 0x87, 0x38, 0x0f, 0x00, 0x01, 0x35, 0x4f, 0x20, 0x36,
+    0x02, 0x17, 0x50, 0x83, 0x37, 0x02, 0x7a, 0x53, 0x85, 0x38, 0x06, 0x09, 0x75, 0x66, 0x5e, 0x3c, 0x5a, 0x9f, 0x4a, 0xb6, 0x5e, 0x72, 0x4d, 0x0f,
+    0x00, 0x01, 0xb5, 0x5e, 0xa0, 0x4a, 0x02, 0x3d, 0x5a, 0xe8, 0x4a, 0x02, 0x25, 0x5b, 0x71, 0x4d, 0x06, 0x1d, 0x18, 0x55, 0x65, 0x71, 0x31, 0x9c,
+    0x3c, 0xb5, 0x36, 0x01, 0x40, 0x0f, 0x00, 0x01, 0x75, 0x31, 0x40, 0x3d, 0x02, 0xb4, 0x36, 0xff, 0x3f, 0x02, 0x73, 0x31, 0x9e, 0x3c, 0x06, 0x31,
+    0x1f, 0x8a, 0x8a, 0x0f, 0x30, 0x3f, 0x5a, 0xb6, 0x35, 0xdd, 0x5d, 0x0f, 0x00, 0x01, 0xb5, 0x35, 0x40, 0x5a, 0x02, 0x93, 0x33, 0x7e, 0x5c, 0x02,
+    0x10, 0x30, 0xdc, 0x5d, 0x06, 0x1d, 0x67, 0x6d, 0x71, 0x53, 0x2f, 0x4d, 0x1c, 0x4d, 0x35, 0x81, 0x26, 0x0f, 0x00, 0x01, 0x55, 0x2f, 0x80, 0x26,
+    0x02, 0x4c, 0x35, 0xb7, 0x1f, 0x02, 0x03, 0x31, 0x4e, 0x1c, 0x06, 0x1d, 0x10, 0x7b, 0x86, 0x93, 0x5c, 0xdf, 0x3d, 0xbe, 0x61, 0x29, 0x40, 0x0f,
+    0x00, 0x01, 0x95, 0x5c, 0xe0, 0x3d, 0x02, 0xbc, 0x61, 0x28, 0x40, 0x02, 0xe4, 0x5e, 0x30, 0x3f, 0x06, 0x09, 0x29, 0x8f, 0x74, 0x73, 0x2d, 0xff,
+    0x59, 0x73, 0x32, 0x5e, 0x61, 0x0f, 0x00, 0x01, 0x75, 0x2d, 0x00, 0x5a, 0x02, 0xe3, 0x30, 0xae, 0x5c, 0x02, 0x72, 0x32, 0x5d, 0x61, 0x06, 0x12,
+    0x75, 0x64, 0x84, 0xff, 0x3a, 0xff, 0x27, 0xef, 0x3e, 0x4e, 0x2b, 0x0f, 0x00, 0x01, 0xb5, 0x3b, 0x00, 0x28, 0x02, 0x01, 0x3b, 0x4c, 0x2b, 0x02,
+    0xed, 0x3e, 0xd9, 0x29, 0x06, 0x25, 0x61, 0x70, 0x69, 0xc8, 0x10, 0x29, 0x41, 0x96, 0x1a, 0x56, 0x48, 0x0f, 0x00, 0x01, 0x95, 0x1a, 0xe0, 0x42,
+    0x02, 0xdf, 0x13, 0x2a, 0x41, 0x02, 0xc9, 0x10, 0x54, 0x48, 0x06, 0x1d, 0x51, 0x77, 0x88, 0xe5, 0x2c, 0x22, 0xf5, 0xd9, 0x30, 0x21, 0x04, 0x0f,
+    0x00, 0x01, 0x75, 0x2e, 0x20, 0x04, 0x02, 0xe6, 0x2c, 0x12, 0xfe, 0x02, 0xd8, 0x30, 0x23, 0xf5, 0x06, 0x31, 0x7d, 0xa6, 0x78, 0x70, 0xff, 0xfd,
+    0x28, 0x55, 0x07, 0xe1, 0x2d, 0x0f, 0x00, 0x01, 0xf5, 0x06, 0xe0, 0x2d, 0x02, 0x54, 0x07, 0xff, 0x28, 0x02, 0x72, 0xff, 0xfd, 0x2a, 0x06, 0x1d,
+    0x66, 0x8c, 0x6f, 0xec, 0x02, 0xd7, 0xfe, 0x36, 0x0b, 0x32, 0x0a, 0x0f, 0x00, 0x01, 0x35, 0x0b, 0x60, 0x02, 0x02, 0xed, 0x02, 0xd8, 0xfe, 0x02,
+    0x45, 0x08, 0x31, 0x0a, 0x06, 0x13, 0x7a, 0x97, 0x9a, 0x05, 0x54, 0x1f, 0x03, 0xba, 0x5d, 0xc5, 0x0e, 0x0f, 0x00, 0x01, 0x95, 0x5b, 0x20, 0x03,
+    0x02, 0x07, 0x54, 0x92, 0x0c, 0x02, 0xb9, 0x5d, 0xc4, 0x0e, 0x06, 0x03, 0x61, 0x79, 0x84, 0x2a, 0x0f, 0x35, 0x3f, 0x56, 0x12, 0xaf, 0x44, 0x0f,
+    0x00, 0x01, 0x55, 0x12, 0x40, 0x42, 0x02, 0x2c, 0x0f, 0x37, 0x3f, 0x02, 0x82, 0x10, 0xad, 0x44, 0x06, 0x13, 0x6f, 0x6a, 0x7e, 0x43, 0x1b, 0x9f,
+    0x17, 0xb7, 0x21, 0x32, 0x20, 0x0f, 0x00, 0x01, 0xd5, 0x1c, 0xa0, 0x17, 0x02, 0x45, 0x1b, 0x30, 0x20, 0x02, 0xb5, 0x21, 0xc0, 0x1b, 0x06, 0x26,
+    0x5f, 0x91, 0x9d, 0x93, 0x47, 0x2d, 0x3f, 0x45, 0x4b, 0x59, 0x42, 0x0f, 0x00, 0x01, 0x95, 0x47, 0xe0, 0x41, 0x02, 0x2c, 0x4a, 0x57, 0x42, 0x02,
+    0x44, 0x4b, 0x2f, 0x3f, 0x06, 0x1d, 0x7d, 0x58, 0x86, 0xde, 0x52, 0x9f, 0x5d, 0xac, 0x55, 0x0c, 0x67, 0x0f, 0x00, 0x01, 0xf5, 0x52, 0xa0, 0x5d,
+    0x02, 0xaa, 0x55, 0x15, 0x63, 0x02, 0xe0, 0x52, 0x0b, 0x67, 0x06, 0x09, 0x34, 0x8f, 0x60, 0x6d, 0x2c, 0xdf, 0x58, 0x89, 0x32, 0x5b, 0x5a, 0x0f,
+    0x00, 0x01, 0x95, 0x30, 0xe0, 0x58, 0x02, 0x6e, 0x2c, 0x59, 0x5a, 0x02, 0x87, 0x32, 0x13, 0x59, 0x06, 0x1a, 0x5a, 0x72, 0x61, 0xd3, 0x42, 0x5f,
+    0x41, 0xc6, 0x45, 0x81, 0x44, 0x0f, 0x00, 0x01, 0xd5, 0x42, 0x80, 0x44, 0x02, 0xc5, 0x45, 0xd0, 0x41, 0x02, 0xd5, 0x43, 0x60, 0x41, 0x06, 0x00,
+    0x74, 0x9d, 0xa1, 0xf2, 0x2d, 0x7f, 0x0f, 0x05, 0x38, 0xa0, 0x1a, 0x0f, 0x00, 0x01, 0x75, 0x36, 0x80, 0x0f, 0x02, 0x04, 0x38, 0x6f, 0x19, 0x02,
+    0xf3, 0x2d, 0x9e, 0x1a, 0x06, 0x13, 0x47, 0x5b, 0x7d, 0x93, 0x4f, 0xaf, 0xff, 0x27, 0x55, 0x22, 0x0a, 0x0f, 0x00, 0x01, 0x95, 0x4f, 0xa0, 0x04,
+    0x02, 0x25, 0x55, 0xb1, 0xff, 0x02, 0xf6, 0x4f, 0x21, 0x0a, 0x06, 0x25, 0x65, 0x88, 0x8d, 0x44, 0x50, 0xe7, 0x3f, 0x96, 0x54, 0xf2, 0x41, 0x0f,
+    0x00, 0x01, 0x95, 0x54, 0x40, 0x41, 0x02, 0xdd, 0x52, 0xe9, 0x3f, 0x02, 0x46, 0x50, 0xf1, 0x41, 0x06, 0x1d, 0x7b, 0x64, 0x65, 0x93, 0x0b, 0x1f,
+    0x39, 0xff, 0x11, 0xc6, 0x41, 0x0f, 0x00, 0x01, 0x95, 0x0b, 0x20, 0x39, 0x02, 0xb9, 0x0c, 0xc4, 0x41, 0x02, 0xfd, 0x11, 0xc9, 0x3a, 0x06, 0x0e,
+    0x7f, 0xa8, 0x9d, 0x30, 0x04, 0xdf, 0x22, 0xb0, 0x0c, 0x1b, 0x2a, 0x0f, 0x00, 0x01, 0x75, 0x0c, 0xe0, 0x22, 0x02, 0x32, 0x04, 0xfd, 0x28, 0x02,
+    0xaf, 0x0c, 0x1a, 0x2a, 0x06, 0x2b, 0x03, 0x7b, 0x7d, 0x71, 0x19, 0x3c, 0x1a, 0x16, 0x29, 0xe1, 0x1e, 0x0f, 0x00, 0x01, 0x15, 0x29, 0xe0, 0x1e,
+    0x02, 0x84, 0x20, 0x6f, 0x1c, 0x02, 0x72, 0x19, 0x3d, 0x1a, 0x06, 0x31, 0x69, 0x94, 0x70, 0xb7, 0xfe, 0x40, 0x19, 0x96, 0x02, 0x21, 0x25, 0x0f,
+    0x00, 0x01, 0x95, 0x02, 0x20, 0x25, 0x02, 0x97, 0x01, 0x42, 0x19, 0x02, 0xb9, 0xfe, 0x04, 0x1d, 0x06, 0x1d, 0x03, 0x7d, 0x83, 0xd0, 0x08, 0x7f,
+    0x1f, 0x56, 0x15, 0x7e, 0x2e, 0x0f, 0x00, 0x01, 0x55, 0x15, 0x80, 0x1f, 0x02, 0xc3, 0x0e, 0xae, 0x27, 0x02, 0xd1, 0x08, 0x7d, 0x2e, 0x06, 0x0f,
+    0x0a, 0x8f, 0x96, 0x33, 0x20, 0x7f, 0x0f, 0x5b, 0x2d, 0xc6, 0x1a, 0x0f, 0x00, 0x01, 0x35, 0x20, 0x80, 0x0f, 0x02, 0x37, 0x29, 0x22, 0x18, 0x02,
+    0x59, 0x2d, 0xc5, 0x1a, 0x06, 0x24, 0x34, 0x66, 0x6b, 0x20, 0x56, 0x15, 0x34, 0xd6, 0x5b, 0xc1, 0x39, 0x0f, 0x00, 0x01, 0xd5, 0x5b, 0xc0, 0x39,
+    0x02, 0x4c, 0x57, 0x17, 0x34, 0x02, 0x22, 0x56, 0x8d, 0x35, 0x06, 0x25, 0x6f, 0x88, 0x6f, 0xbf, 0x2b, 0x36, 0x43, 0xce, 0x2e, 0x21, 0x49, 0x0f,
+    0x00, 0x01, 0x95, 0x2d, 0x20, 0x49, 0x02, 0xc1, 0x2b, 0x0c, 0x45, 0x02, 0xcc, 0x2e, 0x37, 0x43, 0x06, 0x0d, 0x76, 0x9f, 0x79, 0x90, 0x2b, 0x0d,
+    0x05, 0x36, 0x37, 0x41, 0x0a, 0x0f, 0x00, 0x01, 0x35, 0x37, 0x40, 0x0a, 0x02, 0xc3, 0x35, 0x0e, 0x05, 0x02, 0x91, 0x2b, 0x3c, 0x07, 0x06, 0x1d,
+    0x55, 0x87, 0x99, 0x33, 0x32, 0x00, 0x42, 0x17, 0x37, 0xe4, 0x45, 0x0f, 0x00, 0x01, 0x35, 0x32, 0x20, 0x45, 0x02, 0x16, 0x37, 0x01, 0x42, 0x02,
+    0x17, 0x35, 0xe2, 0x45, 0x06, 0x18, 0x4a, 0x7f, 0x64, 0x4f, 0x33, 0xac, 0x0d, 0x56, 0x3b, 0x21, 0x10, 0x0f, 0x00, 0x01, 0x55, 0x3b, 0x20, 0x10,
+    0x02, 0x43, 0x37, 0xae, 0x0d, 0x02, 0x50, 0x33, 0x1c, 0x0e, 0x06, 0x31, 0x06, 0xa7, 0xa3, 0xba, 0x28, 0x0c, 0x10, 0x16, 0x2f, 0x81, 0x18, 0x0f,
+    0x00, 0x01, 0x15, 0x2f, 0x80, 0x18, 0x02, 0xd5, 0x2e, 0xc7, 0x17, 0x02, 0xbb, 0x28, 0x0d, 0x10, 0x06, 0x1d, 0x7c, 0x58, 0x82, 0x84, 0x4e, 0xa0,
+    0x27, 0xd6, 0x54, 0xd2, 0x2c, 0x0f, 0x00, 0x01, 0xd5, 0x54, 0x60, 0x2a, 0x02, 0xc5, 0x4e, 0xd1, 0x2c, 0x02, 0x85, 0x4e, 0xa2, 0x27, 0x06, 0x1d,
+    0x19, 0x83, 0x8d, 0x93, 0x49, 0x6d, 0x09, 0x45, 0x4f, 0xe1, 0x11, 0x0f, 0x00, 0x01, 0x95, 0x49, 0xe0, 0x11, 0x02, 0xac, 0x4c, 0xf7, 0x0e, 0x02,
+    0x44, 0x4f, 0x6f, 0x09, 0x06, 0x1d, 0x77, 0x95, 0x6a, 0xb2, 0x5a, 0x9f, 0x4f, 0xd6, 0x5f, 0x21, 0x52, 0x0f, 0x00, 0x01, 0xd5, 0x5f, 0xa0, 0x4f,
+    0x02, 0x94, 0x5e, 0x1f, 0x52, 0x02, 0xb3, 0x5a, 0x3f, 0x50, 0x06, 0x1d, 0x79, 0x73, 0xa4, 0xf9, 0x28, 0x5f, 0x17, 0x29, 0x2c, 0x35, 0x1b, 0x0f,
+    0x00, 0x01, 0x15, 0x2a, 0x60, 0x17, 0x02, 0x28, 0x2c, 0x33, 0x1b, 0x02, 0xfb, 0x28, 0xf3, 0x1a, 0x06, 0x1d, 0x79, 0x81, 0x5d, 0x13, 0x26, 0x1f,
+    0x5d, 0xb7, 0x2b, 0x63, 0x61, 0x0f, 0x00, 0x01, 0x15, 0x26, 0x80, 0x5d, 0x02, 0xb6, 0x2b, 0x21, 0x5d, 0x02, 0xf6, 0x28, 0x62, 0x61, 0x06, 0x14,
+    0x7a, 0x7f, 0x5c, 0x33, 0x04, 0xdf, 0x03, 0x14, 0x0b, 0x9c, 0x10, 0x0f, 0x00, 0x01, 0x35, 0x04, 0xe0, 0x03, 0x02, 0x12, 0x0b, 0xdd, 0x04, 0x02,
+    0x90, 0x07, 0x9b, 0x10, 0x06, 0x1d, 0x27, 0xa6, 0x8c, 0xd3, 0x2c, 0x5f, 0x44, 0x62, 0x32, 0xba, 0x48, 0x0f, 0x00, 0x01, 0xd5, 0x2c, 0x60, 0x44,
+    0x02, 0x21, 0x32, 0x2c, 0x47, 0x02, 0x61, 0x32, 0xb9, 0x48, 0x06, 0x28, 0x42, 0x70, 0x63, 0xf3, 0x26, 0xbe, 0x40, 0x76, 0x2d, 0x41, 0x47, 0x0f,
+    0x00, 0x01, 0xf5, 0x26, 0x40, 0x47, 0x02, 0x04, 0x29, 0xd0, 0x41, 0x02, 0x74, 0x2d, 0xbf, 0x40, 0x06, 0x11, 0x03, 0x98, 0x65, 0x44, 0x49, 0xff,
+    0x51, 0xd6, 0x4b, 0x32, 0x55, 0x0f, 0x00, 0x01, 0xd5, 0x4b, 0x00, 0x52, 0x02, 0x4d, 0x4b, 0x98, 0x52, 0x02, 0x45, 0x49, 0x30, 0x55, 0x06, 0x18,
+    0x11, 0x57, 0x62, 0x53, 0x17, 0x9f, 0x02, 0xef, 0x22, 0xf4, 0x0b, 0x0f, 0x00, 0x01, 0x55, 0x17, 0xa0, 0x02, 0x02, 0x95, 0x17, 0x19, 0x04, 0x02,
+    0xee, 0x22, 0xf2, 0x0b, 0x06, 0x27, 0x5e, 0x69, 0x72, 0x45, 0x30, 0x22, 0x31, 0x3a, 0x33, 0xa1, 0x37, 0x0f, 0x00, 0x01, 0xf5, 0x30, 0xa0, 0x37,
+    0x02, 0x47, 0x30, 0x52, 0x33, 0x02, 0x39, 0x33, 0x24, 0x31, 0x06, 0x1d, 0x3a, 0x58, 0x85, 0x0c, 0x01, 0x6f, 0x18, 0x67, 0x0d, 0xa1, 0x2b, 0x0f,
+    0x00, 0x01, 0x75, 0x01, 0xa0, 0x2b, 0x02, 0x0d, 0x01, 0x39, 0x23, 0x02, 0x66, 0x0d, 0x71, 0x18, 0x06, 0x09, 0x5e, 0x68, 0xa6, 0x9d, 0x34, 0xe8,
+    0x1b, 0x36, 0x3c, 0x01, 0x23, 0x0f, 0x00, 0x01, 0x35, 0x3c, 0x00, 0x23, 0x02, 0x4a, 0x36, 0xb5, 0x22, 0x02, 0x9e, 0x34, 0xea, 0x1b, 0x06, 0x15,
+    0x6f, 0x79, 0x92, 0x73, 0x35, 0xf8, 0x3b, 0x69, 0x3a, 0x81, 0x3d, 0x0f, 0x00, 0x01, 0x75, 0x35, 0x80, 0x3d, 0x02, 0x8e, 0x37, 0xfa, 0x3b, 0x02,
+    0x67, 0x3a, 0x13, 0x3d, 0x06, 0x29, 0x07, 0x63, 0x98, 0xff, 0x28, 0x75, 0x4a, 0x2c, 0x2e, 0xee, 0x4f, 0x0f, 0x00, 0x01, 0xd5, 0x29, 0xc0, 0x4e,
+    0x02, 0x2b, 0x2e, 0x76, 0x4a, 0x02, 0x01, 0x29, 0xec, 0x4f, 0x06, 0x1d, 0x22, 0x77, 0x8d, 0xb3, 0x3c, 0x3f, 0x46, 0x58, 0x43, 0xa4, 0x49, 0x0f,
+    0x00, 0x01, 0xb5, 0x3c, 0x40, 0x46, 0x02, 0x56, 0x3f, 0x81, 0x48, 0x02, 0x57, 0x43, 0xa2, 0x49, 0x06, 0x1d, 0x78, 0x66, 0x6d, 0xf9, 0x14, 0x44,
+    0xf8, 0x19, 0x1b, 0x41, 0x00, 0x0f, 0x00, 0x01, 0x35, 0x16, 0x40, 0x00, 0x02, 0x17, 0x1b, 0x83, 0xfa, 0x02, 0xfa, 0x14, 0x45, 0xf8, 0x06, 0x1f,
+    0x61, 0x5c, 0x9d, 0x62, 0x5a, 0xae, 0x59, 0xb6, 0x5f, 0xc1, 0x5d, 0x0f, 0x00, 0x01, 0xb5, 0x5f, 0xc0, 0x5d, 0x02, 0x64, 0x5a, 0xaf, 0x59, 0x02,
+    0xd2, 0x5a, 0x1e, 0x5d, 0x06, 0x08, 0x77, 0x81, 0x9e, 0xd3, 0x09, 0x3f, 0x35, 0x76, 0x17, 0xe1, 0x38, 0x0f, 0x00, 0x01, 0x75, 0x17, 0xe0, 0x38,
+    0x02, 0xd4, 0x10, 0x40, 0x35, 0x02, 0xd4, 0x09, 0x60, 0x38, 0x06, 0x13, 0x49, 0x90, 0xa1, 0x53, 0x18, 0x66, 0x23, 0x3e, 0x25, 0x61, 0x2d, 0x0f,
+    0x00, 0x01, 0x55, 0x18, 0x60, 0x2d, 0x02, 0x38, 0x21, 0x44, 0x2c, 0x02, 0x3c, 0x25, 0x67, 0x23, 0x06, 0x09, 0x35, 0x71, 0x60, 0x17, 0x47, 0xff,
+    0x17, 0x1e, 0x4d, 0x29, 0x1f, 0x0f, 0x00, 0x01, 0x15, 0x49, 0x00, 0x18, 0x02, 0x19, 0x47, 0xe4, 0x18, 0x02, 0x1c, 0x4d, 0x28, 0x1f, 0x06, 0x10,
+    0x79, 0x9f, 0x73, 0xcc, 0x04, 0xdb, 0x0c, 0x53, 0x0e, 0xc1, 0x10, 0x0f, 0x00, 0x01, 0x15, 0x0d, 0xc0, 0x10, 0x02, 0x51, 0x0e, 0xdc, 0x0c, 0x02,
+    0xce, 0x04, 0x39, 0x0e, 0x06, 0x27, 0x3c, 0x59, 0x84, 0x13, 0x3a, 0x37, 0x51, 0x02, 0x3f, 0xc1, 0x54, 0x0f, 0x00, 0x01, 0x55, 0x3a, 0xc0, 0x54,
+    0x02, 0x15, 0x3a, 0x2c, 0x53, 0x02, 0x01, 0x3f, 0x38, 0x51, 0x06, 0x2d, 0x1f, 0x68, 0xa8, 0x08, 0x08, 0xa9, 0x52, 0x81, 0x0a, 0xe1, 0x5c, 0x0f,
+    0x00, 0x01, 0x95, 0x08, 0xe0, 0x5c, 0x02, 0x7f, 0x0a, 0xab, 0x52, 0x02, 0x0a, 0x08, 0x95, 0x5c, 0x06, 0x1d, 0x7c, 0x65, 0x58, 0x7c, 0x32, 0x5f,
+    0x1f, 0xd6, 0x39, 0xaa, 0x26, 0x0f, 0x00, 0x01, 0xd5, 0x39, 0x60, 0x1f, 0x02, 0x7e, 0x32, 0xa0, 0x1f, 0x02, 0xe7, 0x33, 0xa9, 0x26, 0x06, 0x1d,
+    0x58, 0x70, 0xa6, 0x7a, 0x05, 0xb2, 0x00, 0x8a, 0x11, 0x81, 0x06, 0x0f, 0x00, 0x01, 0x55, 0x09, 0x80, 0x06, 0x02, 0x88, 0x11, 0x40, 0x06, 0x02,
+    0x7c, 0x05, 0xb4, 0x00, 0x06, 0x04, 0x56, 0x6e, 0x83, 0x13, 0x31, 0x24, 0x0b, 0xa2, 0x3a, 0x4d, 0x14, 0x0f, 0x00, 0x01, 0x15, 0x31, 0x20, 0x10,
+    0x02, 0xdb, 0x33, 0x26, 0x0b, 0x02, 0xa0, 0x3a, 0x4c, 0x14, 0x06, 0x07, 0x31, 0x84, 0x9c, 0x33, 0x1b, 0x21, 0x4d, 0xb9, 0x28, 0xc1, 0x4f, 0x0f,
+    0x00, 0x01, 0x35, 0x1b, 0xc0, 0x4f, 0x02, 0xa6, 0x22, 0x51, 0x4f, 0x02, 0xb7, 0x28, 0x23, 0x4d, 0x06, 0x1d, 0x46, 0x6b, 0x64, 0x61, 0x49, 0x3f,
+    0x30, 0x76, 0x4f, 0xa9, 0x31, 0x0f, 0x00, 0x01, 0x75, 0x4f, 0x40, 0x30, 0x02, 0xfc, 0x4a, 0x80, 0x30, 0x02, 0x63, 0x49, 0xa7, 0x31, 0x06, 0x31,
+    0x7b, 0x6c, 0xa0, 0x93, 0x35, 0x3e, 0x0d, 0x66, 0x3e, 0xe1, 0x14, 0x0f, 0x00, 0x01, 0x95, 0x35, 0xe0, 0x14, 0x02, 0x64, 0x3e, 0xf0, 0x13, 0x02,
+    0xf4, 0x37, 0x3f, 0x0d, 0x06, 0x08, 0x1d, 0x6a, 0xa8, 0x89, 0x33, 0x1a, 0x59, 0xb1, 0x38, 0x98, 0x5d, 0x0f, 0x00, 0x01, 0xd5, 0x34, 0x80, 0x5d,
+    0x02, 0xb0, 0x38, 0x1b, 0x59, 0x02, 0x8b, 0x33, 0x96, 0x5d, 0x06, 0x0a, 0x06, 0x99, 0x9d, 0x02, 0x55, 0x6d, 0x59, 0xd6, 0x5b, 0x21, 0x5f, 0x0f,
+    0x00, 0x01, 0xd5, 0x5b, 0x20, 0x5f, 0x02, 0x7c, 0x5a, 0x47, 0x5e, 0x02, 0x03, 0x55, 0x6e, 0x59, 0x06, 0x13, 0x0e, 0x9f, 0x57, 0xfd, 0x57, 0x31,
+    0x14, 0xa9, 0x5f, 0x6b, 0x17, 0x0f, 0x00, 0x01, 0xb5, 0x5e, 0x40, 0x14, 0x02, 0xfe, 0x57, 0x69, 0x17, 0x02, 0xa7, 0x5f, 0x33, 0x14, 0x06, 0x1d,
+    0x69, 0x89, 0x86, 0x1c, 0x24, 0xd3, 0x5b, 0x36, 0x2d, 0xa1, 0x5c, 0x0f, 0x00, 0x01, 0x35, 0x2d, 0xa0, 0x5c, 0x02, 0xa9, 0x29, 0xd4, 0x5b, 0x02,
+    0x1d, 0x24, 0x49, 0x5c, 0x06, 0x2b, 0x7b, 0x72, 0x5c, 0x39, 0x25, 0xdf, 0x0d, 0x76, 0x2e, 0xc8, 0x10, 0x0f, 0x00, 0x01, 0x75, 0x2e, 0x20, 0x0e,
+    0x02, 0x3b, 0x25, 0xe0, 0x0d, 0x02, 0x61, 0x28, 0xc6, 0x10, 0x06, 0x14, 0x1c, 0x90, 0x7e, 0x96, 0x1b, 0xc1, 0x34, 0x56, 0x21, 0xe1, 0x3c, 0x0f,
+    0x00, 0x01, 0x55, 0x21, 0xe0, 0x3c, 0x02, 0x96, 0x1f, 0xa1, 0x38, 0x02, 0x97, 0x1b, 0xc3, 0x34, 0x06, 0x1d, 0x63, 0x59, 0x68, 0x36, 0xfc, 0x5f,
+    0x42, 0x56, 0x01, 0x27, 0x51, 0x0f, 0x00, 0x01, 0x55, 0x01, 0x60, 0x42, 0x02, 0x37, 0xfc, 0xc3, 0x45, 0x02, 0x77, 0xfc, 0x25, 0x51, 0x06, 0x1d,
+    0x6e, 0x8b, 0x8b, 0x86, 0x18, 0x04, 0x31, 0x96, 0x20, 0x41, 0x33, 0x0f, 0x00, 0x01, 0x95, 0x20, 0x40, 0x33, 0x02, 0x87, 0x18, 0x73, 0x32, 0x02,
+    0x9a, 0x1d, 0x05, 0x31, 0x06, 0x1d, 0x0d, 0x91, 0x88, 0x13, 0x48, 0xdf, 0x13, 0xf1, 0x48, 0x57, 0x21, 0x0f, 0x00, 0x01, 0x15, 0x48, 0xe0, 0x13,
+    0x02, 0xaf, 0x48, 0xfb, 0x1b, 0x02, 0xef, 0x48, 0x55, 0x21, 0x06, 0x19, 0x49, 0x6a, 0x7a, 0xbf, 0x10, 0x3f, 0x3f, 0x8c, 0x18, 0x17, 0x43, 0x0f,
+    0x00, 0x01, 0xb5, 0x12, 0x40, 0x3f, 0x02, 0x8b, 0x18, 0x16, 0x43, 0x02, 0xc0, 0x10, 0xec, 0x40, 0x06, 0x17, 0x63, 0x6d, 0x96, 0x13, 0x5f, 0x3f,
+    0x55, 0x09, 0x67, 0x8b, 0x5a, 0x0f, 0x00, 0x01, 0x15, 0x5f, 0x40, 0x55, 0x02, 0x5e, 0x61, 0x89, 0x5a, 0x02, 0x07, 0x67, 0x52, 0x59, 0x06, 0x1d,
+    0x16, 0x98, 0x89, 0x19, 0xef, 0xa5, 0x04, 0x96, 0x00, 0x01, 0x15, 0x0f, 0x00, 0x01, 0x95, 0x00, 0x00, 0x15, 0x02, 0xe8, 0xfc, 0xb3, 0x0e, 0x02,
+    0x1b, 0xef, 0xa6, 0x04, 0x06, 0x26, 0x12, 0x7e, 0x75, 0x33, 0x4c, 0x1f, 0xfb, 0xd7, 0x50, 0xa1, 0x09, 0x0f, 0x00, 0x01, 0x35, 0x4c, 0xa0, 0x09,
+    0x02, 0x75, 0x4e, 0x81, 0x00, 0x02, 0xd6, 0x50, 0x21, 0xfb, 0x06, 0x1d, 0x78, 0x74, 0xa4, 0x5c, 0x50, 0x23, 0x3d, 0xb6, 0x51, 0x21, 0x40, 0x0f,
+    0x00, 0x01, 0xb5, 0x51, 0x20, 0x40, 0x02, 0xd9, 0x50, 0x24, 0x3d, 0x02, 0x5d, 0x50, 0xe8, 0x3f, 0x06, 0x16, 0x4d, 0x74, 0x75, 0x56, 0x42, 0xa0,
+    0x46, 0xb6, 0x44, 0xa1, 0x49, 0x0f, 0x00, 0x01, 0xb5, 0x44, 0xa0, 0x49, 0x02, 0x36, 0x43, 0xa1, 0x46, 0x02, 0x57, 0x42, 0xc3, 0x47, 0x06, 0x30,
+    0x13, 0x72, 0x9a, 0x8b, 0x51, 0xba, 0x02, 0x32, 0x5a, 0xf9, 0x09, 0x0f, 0x00, 0x01, 0x75, 0x54, 0xa0, 0x08, 0x02, 0x31, 0x5a, 0xbc, 0x02, 0x02,
+    0x8c, 0x51, 0xf7, 0x09, 0x06, 0x09, 0x1d, 0x8c, 0x86, 0x56, 0xf5, 0x1f, 0x1f, 0x36, 0x04, 0x84, 0x27, 0x0f, 0x00, 0x01, 0x35, 0x04, 0x20, 0x1f,
+    0x02, 0x06, 0xff, 0xf1, 0x23, 0x02, 0x57, 0xf5, 0x82, 0x27, 0x06, 0x2d, 0x4a, 0x7c, 0x96, 0x53, 0x4d, 0xe9, 0x55, 0x21, 0x4f, 0x56, 0x57, 0x0f,
+    0x00, 0x01, 0x55, 0x4d, 0x00, 0x57, 0x02, 0x1f, 0x4f, 0xeb, 0x55, 0x02, 0x2a, 0x4e, 0x55, 0x57, 0x06, 0x1d, 0x3e, 0x7d, 0x58, 0x74, 0x14, 0x7f,
+    0x22, 0x97, 0x1a, 0x82, 0x26, 0x0f, 0x00, 0x01, 0x55, 0x17, 0x80, 0x22, 0x02, 0x95, 0x1a, 0x81, 0x26, 0x02, 0x75, 0x14, 0xa1, 0x22, 0x06, 0x09,
+    0x74, 0x82, 0x63, 0x88, 0x54, 0x13, 0x1b, 0xd6, 0x59, 0x5c, 0x21, 0x0f, 0x00, 0x01, 0xd5, 0x59, 0x20, 0x1c, 0x02, 0x4f, 0x57, 0x5a, 0x21, 0x02,
+    0x89, 0x54, 0x14, 0x1b, 0x06, 0x13, 0x37, 0x88, 0x64, 0x83, 0x18, 0xcf, 0x16, 0xf6, 0x24, 0xc1, 0x1b, 0x0f, 0x00, 0x01, 0xf5, 0x24, 0xc0, 0x1b,
+    0x02, 0xfd, 0x1f, 0xa8, 0x17, 0x02, 0x85, 0x18, 0xd0, 0x16, 0x06, 0x15, 0x62, 0x85, 0x7f, 0x93, 0x20, 0x4c, 0x4f, 0xcd, 0x21, 0x39, 0x53, 0x0f,
+    0x00, 0x01, 0x95, 0x20, 0x40, 0x51, 0x02, 0xcc, 0x21, 0x37, 0x53, 0x02, 0x42, 0x21, 0x4e, 0x4f, 0x06, 0x31, 0x44, 0x76, 0x6b, 0x13, 0x4f, 0xd3,
+    0x31, 0xf1, 0x4f, 0x5c, 0x35, 0x0f, 0x00, 0x01, 0x15, 0x4f, 0xc0, 0x32, 0x02, 0xef, 0x4f, 0x5a, 0x35, 0x02, 0x69, 0x4f, 0xd4, 0x31, 0x06, 0x18,
+    0x55, 0x92, 0x7c, 0x93, 0x3a, 0xdf, 0x48, 0x50, 0x40, 0x9e, 0x4c, 0x0f, 0x00, 0x01, 0x95, 0x3a, 0xe0, 0x48, 0x02, 0xb2, 0x3e, 0x9d, 0x4c, 0x02,
+    0x4e, 0x40, 0x9a, 0x4a, 0x06, 0x1d, 0x67, 0x94, 0x70, 0x33, 0x4a, 0xb5, 0x37, 0x2d, 0x4b, 0xcf, 0x39, 0x0f, 0x00, 0x01, 0x35, 0x4a, 0x60, 0x38,
+    0x02, 0xeb, 0x4a, 0xb7, 0x37, 0x02, 0x2b, 0x4b, 0xcd, 0x39, 0x06, 0x1d, 0x49, 0x80, 0x9f, 0x02, 0xf5, 0xdf, 0x10, 0x56, 0x02, 0x20, 0x19, 0x0f,
+    0x00, 0x01, 0x55, 0x02, 0xe0, 0x10, 0x02, 0x04, 0xf5, 0x0f, 0x18, 0x02, 0xd3, 0xfb, 0x1e, 0x19, 0x06, 0x07, 0x10, 0x77, 0x92, 0x54, 0x45, 0x3f,
+    0x28, 0xb6, 0x49, 0xc2, 0x2c, 0x0f, 0x00, 0x01, 0xb5, 0x49, 0x40, 0x28, 0x02, 0x55, 0x45, 0xc1, 0x2c, 0x02, 0x16, 0x47, 0x81, 0x2b, 0x06, 0x27,
+    0x13, 0x9f, 0x6d, 0x6d, 0x11, 0xbf, 0x08, 0x56, 0x1b, 0x7b, 0x16, 0x0f, 0x00, 0x01, 0x55, 0x1b, 0xc0, 0x08, 0x02, 0x02, 0x1a, 0xad, 0x0c, 0x02,
+    0x6e, 0x11, 0x7a, 0x16, 0x06, 0x15, 0x68, 0x66, 0xa4, 0x6d, 0x2d, 0x18, 0x2e, 0xb3, 0x32, 0x81, 0x33, 0x0f, 0x00, 0x01, 0x75, 0x2e, 0x80, 0x33,
+    0x02, 0xb2, 0x32, 0x1d, 0x33, 0x02, 0x6e, 0x2d, 0x1a, 0x2e, 0x06, 0x09, 0x73, 0x9b, 0x7f, 0x28, 0x55, 0x5f, 0x1d, 0xe0, 0x58, 0x4b, 0x22, 0x0f,
+    0x00, 0x01, 0x35, 0x58, 0x60, 0x1d, 0x02, 0x2a, 0x55, 0xd5, 0x1f, 0x02, 0xde, 0x58, 0x4a, 0x22, 0x06, 0x00, 0x52, 0x7d, 0x72, 0xb3, 0x30, 0xca,
+    0x4e, 0x3c, 0x33, 0xa7, 0x52, 0x0f, 0x00, 0x01, 0xb5, 0x30, 0x20, 0x50, 0x02, 0x3b, 0x33, 0xa6, 0x52, 0x02, 0xe0, 0x31, 0xcc, 0x4e, 0x06, 0x19,
+    0x5e, 0x81, 0x82, 0xf7, 0x07, 0x80, 0x4e, 0xb8, 0x11, 0x61, 0x58, 0x0f, 0x00, 0x01, 0xf5, 0x0c, 0x60, 0x58, 0x02, 0xb7, 0x11, 0x82, 0x4e, 0x02,
+    0xf9, 0x07, 0xc4, 0x53, 0x06, 0x31, 0x13, 0x7e, 0x74, 0xea, 0x10, 0x5f, 0x38, 0xf6, 0x13, 0x18, 0x47, 0x0f, 0x00, 0x01, 0xf5, 0x13, 0x60, 0x38,
+    0x02, 0x60, 0x12, 0xcc, 0x3d, 0x02, 0xec, 0x10, 0x17, 0x47, 0x06, 0x09, 0x7c, 0xa4, 0x72, 0x50, 0x06, 0x5b, 0x40, 0xd6, 0x09, 0xe1, 0x46, 0x0f,
+    0x00, 0x01, 0x95, 0x09, 0xe0, 0x46, 0x02, 0xd5, 0x09, 0x5c, 0x40, 0x02, 0x51, 0x06, 0x99, 0x42, 0x06, 0x09, 0x69, 0x97, 0x99, 0x44, 0xfc, 0xdf,
+    0x51, 0x36, 0x04, 0x24, 0x5c, 0x0f, 0x00, 0x01, 0x35, 0x04, 0xe0, 0x51, 0x02, 0x46, 0xfc, 0x11, 0x5a, 0x02, 0x77, 0x02, 0x22, 0x5c, 0x06, 0x09,
+    0x7a, 0x61, 0x91, 0xd3, 0x0b, 0x05, 0x50, 0xe3, 0x17, 0xe1, 0x52, 0x0f, 0x00, 0x01, 0xd5, 0x0b, 0xe0, 0x52, 0x02, 0x7b, 0x0d, 0x07, 0x50, 0x02,
+    0xe2, 0x17, 0x0d, 0x52, 0x06, 0x1e, 0x7d, 0x5f, 0x5d, 0xca, 0x3b, 0x76, 0x4b, 0x96, 0x3e, 0x4d, 0x4d, 0x0f, 0x00, 0x01, 0x95, 0x3e, 0xa0, 0x4b,
+    0x02, 0x20, 0x3c, 0x4c, 0x4d, 0x02, 0xcc, 0x3b, 0x77, 0x4b, 0x06, 0x0a, 0x7c, 0x71, 0xa8, 0x53, 0x28, 0x95, 0x41, 0x23, 0x2a, 0x2e, 0x44, 0x0f,
+    0x00, 0x01, 0x55, 0x28, 0x20, 0x44, 0x02, 0xeb, 0x28, 0x96, 0x41, 0x02, 0x22, 0x2a, 0x2d, 0x44, 0x06, 0x18, 0x32, 0x5e, 0x71, 0x73, 0x2e, 0x03,
+    0x0f, 0xa0, 0x34, 0xeb, 0x15, 0x0f, 0x00, 0x01, 0x75, 0x2e, 0x40, 0x11, 0x02, 0x1a, 0x2f, 0x05, 0x0f, 0x02, 0x9e, 0x34, 0xea, 0x15, 0x06, 0x14,
+    0x7a, 0x82, 0x5d, 0x13, 0x05, 0xb2, 0x39, 0x4a, 0x0c, 0x1b, 0x41, 0x0f, 0x00, 0x01, 0x15, 0x05, 0x60, 0x3a, 0x02, 0xef, 0x08, 0x1a, 0x41, 0x02,
+    0x48, 0x0c, 0xb4, 0x39, 0x06, 0x23, 0x64, 0x7b, 0x82, 0xb3, 0x37, 0xb4, 0x13, 0x61, 0x3c, 0x21, 0x1c, 0x0f, 0x00, 0x01, 0xb5, 0x37, 0x20, 0x1c,
+    0x02, 0x60, 0x3c, 0x2b, 0x18, 0x02, 0xcb, 0x39, 0xb6, 0x13, 0x06, 0x06, 0x6c, 0x9b, 0x64, 0x33, 0x33, 0x25, 0x1a, 0xa4, 0x37, 0x8f, 0x1d, 0x0f,
+    0x00, 0x01, 0x35, 0x33, 0xc0, 0x1a, 0x02, 0xdc, 0x36, 0x27, 0x1a, 0x02, 0xa2, 0x37, 0x8d, 0x1d, 0x06, 0x27, 0x5b, 0x6f, 0x5b, 0xf3, 0x4f, 0x8d,
+    0x14, 0x54, 0x56, 0x01, 0x18, 0x0f, 0x00, 0x01, 0xf5, 0x4f, 0x00, 0x18, 0x02, 0xe4, 0x51, 0x8f, 0x14, 0x02, 0x52, 0x56, 0xcf, 0x14, 0x06, 0x09,
+    0x77, 0x61, 0x83, 0xf3, 0x55, 0xc3, 0x27, 0xc9, 0x58, 0x81, 0x31, 0x0f, 0x00, 0x01, 0xf5, 0x55, 0x80, 0x31, 0x02, 0xc7, 0x58, 0x13, 0x2d, 0x02,
+    0x5a, 0x56, 0xc5, 0x27, 0x06, 0x31, 0x00, 0xa0, 0x5f, 0xfe, 0x54, 0x93, 0x11, 0x2b, 0x5b, 0xcc, 0x1a, 0x0f, 0x00, 0x01, 0x75, 0x5a, 0xa0, 0x12,
+    0x02, 0xff, 0x54, 0xcb, 0x1a, 0x02, 0x29, 0x5b, 0x95, 0x11, 0x06, 0x13, 0x79, 0x5e, 0x85, 0x33, 0x08, 0x3f, 0x4a, 0x47, 0x0e, 0xc1, 0x52, 0x0f,
+    0x00, 0x01, 0x35, 0x08, 0xc0, 0x52, 0x02, 0x45, 0x0e, 0x10, 0x4f, 0x02, 0xd5, 0x08, 0x41, 0x4a, 0x06, 0x09, 0x59, 0x78, 0x7f, 0x15, 0x2c, 0x1f,
+    0x1f, 0xda, 0x32, 0x26, 0x24, 0x0f, 0x00, 0x01, 0xd5, 0x2e, 0x20, 0x1f, 0x02, 0x17, 0x2c, 0xa2, 0x21, 0x02, 0xd9, 0x32, 0x24, 0x24, 0x06, 0x2f,
+    0x44, 0x8e, 0x6f, 0x73, 0x45, 0x59, 0x53, 0xe3, 0x49, 0x81, 0x5a, 0x0f, 0x00, 0x01, 0x75, 0x45, 0x80, 0x5a, 0x02, 0xe2, 0x49, 0x8d, 0x55, 0x02,
+    0x6f, 0x48, 0x5a, 0x53, 0x06, 0x27, 0x39, 0xa7, 0x79, 0x9a, 0x3a, 0xbf, 0x0d, 0x19, 0x42, 0x48, 0x18, 0x0f, 0x00, 0x01, 0xd5, 0x41, 0xc0, 0x0d,
+    0x02, 0x18, 0x42, 0x44, 0x12, 0x02, 0x9c, 0x3a, 0x47, 0x18, 0x06, 0x31, 0x55, 0x60, 0x75, 0x02, 0x0e, 0x56, 0x25, 0x4e, 0x15, 0x21, 0x2e, 0x0f,
+    0x00, 0x01, 0xf5, 0x0e, 0x20, 0x2e, 0x02, 0x4c, 0x15, 0x57, 0x25, 0x02, 0x04, 0x0e, 0xaf, 0x28, 0x06, 0x20, 0x21, 0x8a, 0x74, 0xec, 0x20, 0x97,
+    0x58, 0x68, 0x27, 0xd3, 0x5c, 0x0f, 0x00, 0x01, 0xf5, 0x24, 0x20, 0x5a, 0x02, 0xed, 0x20, 0x99, 0x58, 0x02, 0x66, 0x27, 0xd1, 0x5c, 0x06, 0x1d,
+    0x59, 0x79, 0x90, 0x34, 0x18, 0x60, 0xf7, 0x07, 0x1c, 0x41, 0x05, 0x0f, 0x00, 0x01, 0xd5, 0x19, 0x40, 0x05, 0x02, 0x05, 0x1c, 0x11, 0x01, 0x02,
+    0x36, 0x18, 0x61, 0xf7, 0x06, 0x13, 0x7a, 0x58, 0x5b, 0x15, 0x02, 0x5f, 0x05, 0x47, 0x05, 0xa3, 0x0f, 0x0f, 0x00, 0x01, 0x35, 0x02, 0x60, 0x05,
+    0x02, 0x45, 0x05, 0x11, 0x06, 0x02, 0x16, 0x02, 0xa1, 0x0f, 0x06, 0x0e, 0x78, 0x6a, 0x98, 0x13, 0x43, 0xe7, 0x2f, 0xe8, 0x48, 0xa1, 0x33, 0x0f,
+    0x00, 0x01, 0x15, 0x43, 0xa0, 0x33, 0x02, 0x7d, 0x44, 0xe9, 0x2f, 0x02, 0xe6, 0x48, 0xd2, 0x32, 0x06, 0x1d, 0x0e, 0x5c, 0x9a, 0xb3, 0x46, 0x14,
+    0x25, 0x8c, 0x4a, 0xe1, 0x28, 0x0f, 0x00, 0x01, 0xb5, 0x46, 0xe0, 0x28, 0x02, 0x8b, 0x4a, 0x16, 0x25, 0x02, 0x00, 0x47, 0x2c, 0x28, 0x06, 0x13,
+    0x6d, 0xa3, 0x9d, 0x71, 0x49, 0x1e, 0x25, 0xd6, 0x4f, 0xe0, 0x29, 0x0f, 0x00, 0x01, 0xd5, 0x4f, 0x20, 0x29, 0x02, 0x54, 0x4f, 0x1f, 0x25, 0x02,
+    0x73, 0x49, 0xde, 0x29, 0x06, 0x2c, 0x3f, 0x7b, 0x5a, 0xaf, 0x04, 0x9f, 0x25, 0xb6, 0x12, 0x1e, 0x2e, 0x0f, 0x00, 0x01, 0xb5, 0x12, 0xa0, 0x25,
+    0x02, 0xf3, 0x0a, 0x1e, 0x26, 0x02, 0xb1, 0x04, 0x1c, 0x2e, 0x06, 0x15, 0x31, 0x73, 0x94, 0x41, 0x04, 0x8d, 0xf9, 0xf3, 0x0e, 0xfe, 0x06, 0x0f,
+    0x00, 0x01, 0x15, 0x08, 0x80, 0x03, 0x02, 0x43, 0x04, 0x8e, 0xf9, 0x02, 0xf1, 0x0e, 0xfc, 0x06, 0x06, 0x09, 0x78, 0x85, 0x60, 0x1a, 0x19, 0xdf,
+    0x31, 0x16, 0x1e, 0xb5, 0x38, 0x0f, 0x00, 0x01, 0x15, 0x1e, 0xe0, 0x31, 0x02, 0xe8, 0x1b, 0xb4, 0x38, 0x02, 0x1c, 0x19, 0xc7, 0x32, 0x06, 0x1d,
+    0x2a, 0x60, 0x83, 0x98, 0x0d, 0x7f, 0x5c, 0x16, 0x18, 0xe7, 0x69, 0x0f, 0x00, 0x01, 0x15, 0x18, 0x80, 0x5c, 0x02, 0xe7, 0x0e, 0xd3, 0x63, 0x02,
+    0x9a, 0x0d, 0xe5, 0x69, 0x06, 0x14, 0x6d, 0x68, 0x9a, 0x75, 0x35, 0xdf, 0xff, 0xba, 0x3e, 0x45, 0x09, 0x0f, 0x00, 0x01, 0x95, 0x37, 0xe0, 0xff,
+    0x02, 0x77, 0x35, 0x82, 0x07, 0x02, 0xb8, 0x3e, 0x44, 0x09, 0x06, 0x30, 0x2a, 0x5f, 0x95, 0x92, 0x49, 0x9f, 0x4e, 0xd6, 0x4b, 0x1f, 0x51, 0x0f,
+    0x00, 0x01, 0xd5, 0x4b, 0xa0, 0x4e, 0x02, 0x94, 0x49, 0x7f, 0x50, 0x02, 0xd4, 0x49, 0x1d, 0x51, 0x06, 0x15, 0x75, 0x7b, 0x62, 0x08, 0x03, 0x9f,
+    0x5a, 0x36, 0x0c, 0x6b, 0x5f, 0x0f, 0x00, 0x01, 0x35, 0x0c, 0xa0, 0x5a, 0x02, 0x09, 0x03, 0x55, 0x5b, 0x02, 0x1e, 0x07, 0x69, 0x5f, 0x06, 0x19,
+    0x22, 0x7e, 0x95, 0x13, 0x0e, 0xdf, 0x48, 0xdb, 0x19, 0xa6, 0x4e, 0x0f, 0x00, 0x01, 0x15, 0x0e, 0xe0, 0x48, 0x02, 0xc7, 0x13, 0x33, 0x4d, 0x02,
+    0xda, 0x19, 0xa5, 0x4e, 0x06, 0x28, 0x6a, 0x5c, 0x5c, 0x13, 0x40, 0x43, 0x3a, 0xdb, 0x43, 0x41, 0x3d, 0x0f, 0x00, 0x01, 0x15, 0x40, 0x40, 0x3d,
+    0x02, 0xda, 0x43, 0x45, 0x3a, 0x02, 0x5e, 0x40, 0x85, 0x3a, 0x06, 0x03, 0x35, 0x67, 0x94, 0xac, 0x36, 0x3f, 0x5b, 0x36, 0x3b, 0x13, 0x5d, 0x0f,
+    0x00, 0x01, 0x35, 0x3b, 0x40, 0x5b, 0x02, 0xad, 0x36, 0x99, 0x5c, 0x02, 0xa6, 0x37, 0x11, 0x5d, 0x06, 0x30, 0x39, 0x5a, 0x87, 0xed, 0x2f, 0x52,
+    0x06, 0xca, 0x38, 0x41, 0x15, 0x0f, 0x00, 0x01, 0x75, 0x30, 0x40, 0x15, 0x02, 0xef, 0x2f, 0x1a, 0x0f, 0x02, 0xc8, 0x38, 0x54, 0x06, 0x06, 0x2a,
+    0x6a, 0x5a, 0xa1, 0xd3, 0x17, 0x1f, 0x1e, 0x08, 0x1c, 0xc4, 0x29, 0x0f, 0x00, 0x01, 0xd5, 0x17, 0x20, 0x1e, 0x02, 0x15, 0x18, 0x91, 0x28, 0x02,
+    0x06, 0x1c, 0xc3, 0x29, 0x06, 0x1d, 0x27, 0x76, 0x90, 0x53, 0x48, 0xdf, 0x53, 0x56, 0x4c, 0x01, 0x57, 0x0f, 0x00, 0x01, 0x55, 0x48, 0xe0, 0x53,
+    0x02, 0xe5, 0x49, 0x10, 0x56, 0x02, 0x55, 0x4c, 0x00, 0x57, 0x06, 0x13, 0x53, 0x5c, 0x93, 0x53, 0x03, 0x9f, 0x37, 0x23, 0x06, 0xaf, 0x3b, 0x0f,
+    0x00, 0x01, 0x55, 0x03, 0xa0, 0x37, 0x02, 0x22, 0x06, 0xad, 0x3b, 0x02, 0x8f, 0x03, 0x9b, 0x3a, 0x06, 0x1b, 0x3b, 0x78, 0x5e, 0x21, 0x2b, 0x56,
+    0x3b, 0x36, 0x33, 0xe1, 0x3f, 0x0f, 0x00, 0x01, 0x35, 0x33, 0xe0, 0x3f, 0x02, 0x6c, 0x2e, 0x57, 0x3b, 0x02, 0x23, 0x2b, 0xce, 0x3b, 0x06, 0x27,
+    0x66, 0x91, 0x73, 0xf3, 0x27, 0xdc, 0x2e, 0x91, 0x2c, 0xfc, 0x34, 0x0f, 0x00, 0x01, 0xf5, 0x27, 0x00, 0x31, 0x02, 0x32, 0x2b, 0xdd, 0x2e, 0x02,
+    0x90, 0x2c, 0xfb, 0x34, 0x06, 0x18, 0x0c, 0xa1, 0x67, 0x6f, 0x4c, 0x3b, 0x4d, 0xb6, 0x4e, 0x5a, 0x50, 0x0f, 0x00, 0x01, 0x75, 0x4e, 0xe0, 0x4d,
+    0x02, 0xb5, 0x4e, 0x3c, 0x4d, 0x02, 0x71, 0x4c, 0x59, 0x50, 0x06, 0x13, 0x6d, 0x8b, 0x76, 0xd3, 0x51, 0x4d, 0x4f, 0x24, 0x55, 0x5e, 0x52, 0x0f,
+    0x00, 0x01, 0xd5, 0x51, 0x80, 0x50, 0x02, 0x23, 0x55, 0x4e, 0x4f, 0x02, 0xf1, 0x53, 0x5c, 0x52, 0x06, 0x27, 0x30, 0x7a, 0x66, 0xb3, 0x5c, 0x8e,
+    0x58, 0x55, 0x67, 0xe1, 0x59, 0x0f, 0x00, 0x01, 0xb5, 0x5c, 0xe0, 0x59, 0x02, 0x44, 0x61, 0xd0, 0x58, 0x02, 0x54, 0x67, 0x90, 0x58, 0x06, 0x13,
+    0x32, 0x6a, 0x99, 0x97, 0x4d, 0x1f, 0x1d, 0x56, 0x56, 0x63, 0x1e, 0x0f, 0x00, 0x01, 0x55, 0x56, 0x20, 0x1d, 0x02, 0xb7, 0x4f, 0x62, 0x1e, 0x02,
+    0x99, 0x4d, 0x22, 0x1e, 0x06, 0x15, 0x47, 0x7c, 0x9a, 0x77, 0x27, 0xd1, 0x1c, 0x28, 0x2f, 0x01, 0x20, 0x0f, 0x00, 0x01, 0xf5, 0x2a, 0x00, 0x20,
+    0x02, 0x27, 0x2f, 0xd2, 0x1c, 0x02, 0x79, 0x27, 0x64, 0x1f, 0x06, 0x1d, 0x07, 0x98, 0x93, 0xc6, 0x54, 0x71, 0x19, 0x56, 0x5c, 0x41, 0x21, 0x0f,
+    0x00, 0x01, 0x55, 0x5c, 0x40, 0x21, 0x02, 0xc7, 0x54, 0x73, 0x19, 0x02, 0xb9, 0x5a, 0x25, 0x1f, 0x06, 0x15, 0x32, 0x9b, 0x7a, 0xb9, 0xfb, 0x25,
+    0x20, 0x59, 0x04, 0xe4, 0x25, 0x0f, 0x00, 0x01, 0xd5, 0x02, 0xa0, 0x22, 0x02, 0x58, 0x04, 0xe3, 0x25, 0x02, 0xbb, 0xfb, 0x26, 0x20, 0x06, 0x0e,
+    0x1a, 0x7b, 0x8d, 0x6d, 0x05, 0x78, 0xfe, 0x36, 0x11, 0xa1, 0x0e, 0x0f, 0x00, 0x01, 0x35, 0x11, 0xa0, 0x0e, 0x02, 0xc1, 0x0a, 0x0d, 0x09, 0x02,
+    0x6e, 0x05, 0x79, 0xfe, 0x06, 0x17, 0x43, 0x65, 0x6d, 0x0b, 0x16, 0x3f, 0x36, 0x76, 0x1f, 0xb9, 0x3d, 0x0f, 0x00, 0x01, 0x75, 0x1f, 0x40, 0x36,
+    0x02, 0xd1, 0x17, 0x5c, 0x38, 0x02, 0x0c, 0x16, 0xb8, 0x3d, 0x06, 0x18, 0x10, 0x85, 0x6f, 0xf8, 0x17, 0xa8, 0x1e, 0xa0, 0x1c, 0xc6, 0x23, 0x0f,
+    0x00, 0x01, 0x95, 0x1a, 0x40, 0x20, 0x02, 0xfa, 0x17, 0xc5, 0x23, 0x02, 0x9e, 0x1c, 0xaa, 0x1e, 0x06, 0x30, 0x5e, 0x8c, 0x6b, 0x00, 0x0a, 0x19,
+    0xfa, 0xd6, 0x14, 0x61, 0x0b, 0x0f, 0x00, 0x01, 0xd5, 0x14, 0x60, 0x0b, 0x02, 0x02, 0x0a, 0x8d, 0xfe, 0x02, 0x0f, 0x11, 0x1a, 0xfa, 0x06, 0x1d,
+    0x40, 0x59, 0x83, 0x73, 0x58, 0xbf, 0x22, 0x6e, 0x5e, 0xf1, 0x2d, 0x0f, 0x00, 0x01, 0x75, 0x58, 0xc0, 0x22, 0x02, 0xb5, 0x58, 0xd8, 0x28, 0x02,
+    0x6c, 0x5e, 0xef, 0x2d, 0x06, 0x0d, 0x52, 0x70, 0x7e, 0x1c, 0x4e, 0x7f, 0x5c, 0x88, 0x51, 0x53, 0x64, 0x0f, 0x00, 0x01, 0x35, 0x4f, 0x80, 0x5c,
+    0x02, 0x1d, 0x4e, 0x49, 0x60, 0x02, 0x86, 0x51, 0x51, 0x64, 0x06, 0x1d, 0x7e, 0xaa, 0x76, 0xf2, 0x21, 0x7d, 0x52, 0xf6, 0x23, 0xa1, 0x5f, 0x0f,
+    0x00, 0x01, 0xf5, 0x23, 0xa0, 0x5f, 0x02, 0xf4, 0x21, 0x9f, 0x57, 0x02, 0xf3, 0x23, 0x7e, 0x52, 0x06, 0x13, 0x7f, 0x63, 0xa7, 0x33, 0x07, 0x2b,
+    0x1b, 0x03, 0x11, 0x41, 0x23, 0x0f, 0x00, 0x01, 0x35, 0x07, 0x40, 0x23, 0x02, 0x02, 0x11, 0x00, 0x23, 0x02, 0xce, 0x08, 0x2d, 0x1b, 0x06, 0x1d,
+    0x77, 0xa2, 0xa5, 0xf3, 0x46, 0xe2, 0x2e, 0xb9, 0x49, 0xe1, 0x32, 0x0f, 0x00, 0x01, 0xf5, 0x46, 0xe0, 0x32, 0x02, 0xb8, 0x49, 0xa0, 0x32, 0x02,
+    0x78, 0x49, 0xe3, 0x2e, 0x06, 0x0a, 0x4c, 0x81, 0x69, 0xb3, 0x17, 0xcb, 0x35, 0xad, 0x20, 0xa1, 0x3e, 0x0f, 0x00, 0x01, 0xb5, 0x17, 0xa0, 0x3e,
+    0x02, 0xab, 0x20, 0xd6, 0x37, 0x02, 0x61, 0x1c, 0xcd, 0x35, 0x06, 0x31, 0x2e, 0x69, 0x65, 0xd3, 0x32, 0xff, 0x57, 0x9a, 0x35, 0x63, 0x59, 0x0f,
+    0x00, 0x01, 0xd5, 0x32, 0x40, 0x58, 0x02, 0x77, 0x33, 0x00, 0x58, 0x02, 0x98, 0x35, 0x62, 0x59, 0x06, 0x18, 0x72, 0x9b, 0x81, 0x73, 0x51, 0x06,
+    0x54, 0x2a, 0x55, 0xf5, 0x54, 0x0f, 0x00, 0x01, 0x75, 0x51, 0x80, 0x54, 0x02, 0x29, 0x55, 0xf4, 0x54, 0x02, 0x7c, 0x54, 0x08, 0x54, 0x06, 0x1d,
+    0x53, 0x7e, 0x72, 0x97, 0x07, 0xc1, 0x54, 0xd6, 0x12, 0x01, 0x5b, 0x0f, 0x00, 0x01, 0xd5, 0x12, 0x00, 0x5b, 0x02, 0xf7, 0x0c, 0xc2, 0x54, 0x02,
+    0x99, 0x07, 0xe4, 0x56, 0x06, 0x26, 0x6a, 0x6b, 0x68, 0x87, 0x34, 0xff, 0x04, 0x56, 0x3e, 0x08, 0x10, 0x0f, 0x00, 0x01, 0x55, 0x3e, 0x00, 0x05,
+    0x02, 0x88, 0x34, 0x74, 0x07, 0x02, 0x1b, 0x37, 0x07, 0x10, 0x06, 0x1d, 0x21, 0x61, 0x87, 0xd7, 0x36, 0x5f, 0x2c, 0x36, 0x3e, 0x66, 0x2e, 0x0f,
+    0x00, 0x01, 0x35, 0x3e, 0x60, 0x2c, 0x02, 0xe7, 0x37, 0x92, 0x2d, 0x02, 0xd9, 0x36, 0x64, 0x2e, 0x06, 0x15, 0x08, 0x99, 0x60, 0xdd, 0x11, 0xbf,
+    0x0e, 0xf6, 0x14, 0xab, 0x14, 0x0f, 0x00, 0x01, 0xf5, 0x14, 0xc0, 0x0e, 0x02, 0x59, 0x14, 0x85, 0x0f, 0x02, 0xde, 0x11, 0xa9, 0x14, 0x06, 0x31,
+    0x0f, 0x74, 0x95, 0x24, 0x0a, 0x60, 0x11, 0xf8, 0x13, 0x72, 0x1a, 0x0f, 0x00, 0x01, 0xb5, 0x0d, 0x40, 0x18, 0x02, 0x25, 0x0a, 0x71, 0x1a, 0x02,
+    0xf6, 0x13, 0x62, 0x11, 0x06, 0x27, 0x56, 0xa7, 0x8e, 0xb3, 0x47, 0x8e, 0xf7, 0x4e, 0x53, 0x81, 0x02, 0x0f, 0x00, 0x01, 0xb5, 0x47, 0x80, 0x02,
+    0x02, 0x4c, 0x53, 0xd8, 0xfe, 0x02, 0xe4, 0x52, 0x8f, 0xf7, 0x06, 0x17, 0x4d, 0x7a, 0x5c, 0x2a, 0x25, 0x1a, 0x2c, 0x36, 0x2e, 0xd9, 0x32, 0x0f,
+    0x00, 0x01, 0x35, 0x2e, 0xa0, 0x2c, 0x02, 0x10, 0x29, 0x1c, 0x2c, 0x02, 0x2c, 0x25, 0xd7, 0x32, 0x06, 0x1e, 0x6f, 0x63, 0x97, 0x53, 0x04, 0x3f,
+    0x5d, 0xf6, 0x0b, 0x21, 0x6c, 0x0f, 0x00, 0x01, 0x55, 0x04, 0x40, 0x5d, 0x02, 0xf5, 0x0b, 0xc0, 0x68, 0x02, 0x95, 0x05, 0x20, 0x6c, 0x06, 0x13,
+    0x75, 0x77, 0x67, 0x90, 0x09, 0x9c, 0x02, 0x71, 0x16, 0xc1, 0x09, 0x0f, 0x00, 0x01, 0xb5, 0x0e, 0xc0, 0x09, 0x02, 0x92, 0x09, 0x9d, 0x02, 0x02,
+    0x6f, 0x16, 0x1a, 0x04, 0x06, 0x13, 0x3f, 0x8b, 0x98, 0x0b, 0x06, 0xf6, 0x16, 0x76, 0x0f, 0x11, 0x1c, 0x0f, 0x00, 0x01, 0x75, 0x0f, 0x00, 0x1b,
+    0x02, 0x0c, 0x06, 0xf8, 0x16, 0x02, 0x04, 0x0c, 0x0f, 0x1c, 0x06, 0x1c, 0x53, 0x6c, 0x7d, 0x73, 0x50, 0x37, 0x14, 0x6f, 0x58, 0xd3, 0x14, 0x0f,
+    0x00, 0x01, 0x75, 0x50, 0x80, 0x14, 0x02, 0x6e, 0x58, 0x39, 0x14, 0x02, 0xa7, 0x52, 0xd2, 0x14, 0x06, 0x17, 0x45, 0x8e, 0x70, 0x33, 0x2a, 0xb7,
+    0x00, 0xa8, 0x3a, 0x61, 0x0a, 0x0f, 0x00, 0x01, 0x35, 0x2a, 0x60, 0x0a, 0x02, 0x4e, 0x35, 0xb9, 0x00, 0x02, 0xa7, 0x3a, 0xd2, 0x03, 0x06, 0x05,
+    0x12, 0x9d, 0x6e, 0x93, 0x11, 0x67, 0x39, 0x9f, 0x1a, 0xa1, 0x44, 0x0f, 0x00, 0x01, 0x95, 0x11, 0xa0, 0x44, 0x02, 0x39, 0x19, 0xc4, 0x3c, 0x02,
+    0x9d, 0x1a, 0x68, 0x39, 0x06, 0x15, 0x0a, 0x7f, 0x79, 0xbd, 0x35, 0x68, 0x30, 0x76, 0x36, 0x41, 0x39, 0x0f, 0x00, 0x01, 0x75, 0x36, 0x40, 0x39,
+    0x02, 0x19, 0x36, 0x25, 0x34, 0x02, 0xbe, 0x35, 0x69, 0x30, 0x06, 0x03, 0x7f, 0xa4, 0x59, 0x53, 0x0f, 0x31, 0x44, 0x89, 0x14, 0xfb, 0x4d, 0x0f,
+    0x00, 0x01, 0x55, 0x0f, 0xa0, 0x44, 0x02, 0x2e, 0x14, 0xf9, 0x4d, 0x02, 0x87, 0x14, 0x33, 0x44, 0x06, 0x09, 0x5b, 0x7f, 0x79, 0xd3, 0x4a, 0x47,
+    0xfc, 0x88, 0x52, 0x01, 0x05, 0x0f, 0x00, 0x01, 0xd5, 0x4a, 0x00, 0x05, 0x02, 0x9e, 0x4e, 0x49, 0xfc, 0x02, 0x87, 0x52, 0xf2, 0xff, 0x06, 0x04,
+    0x62, 0x86, 0x77, 0x29, 0x13, 0x54, 0x3c, 0x82, 0x16, 0x81, 0x43, 0x0f, 0x00, 0x01, 0x15, 0x15, 0x80, 0x43, 0x02, 0x2b, 0x13, 0x56, 0x3c, 0x02,
+    0x80, 0x16, 0x2c, 0x3f, 0x06, 0x31, 0x64, 0x62, 0xa5, 0x73, 0x46, 0x7f, 0x26, 0x63, 0x4c, 0xce, 0x2c, 0x0f, 0x00, 0x01, 0x75, 0x46, 0x80, 0x26,
+    0x02, 0x5b, 0x47, 0x66, 0x2c, 0x02, 0x61, 0x4c, 0xcc, 0x2c, 0x06, 0x2e, 0x54, 0x64, 0x63, 0xfc, 0x28, 0x7f, 0x0e, 0xd6, 0x32, 0x4a, 0x11, 0x0f,
+    0x00, 0x01, 0xd5, 0x32, 0x80, 0x0e, 0x02, 0xfd, 0x28, 0x49, 0x11, 0x02, 0xc6, 0x2a, 0xf1, 0x0e, 0x06, 0x10, 0x04, 0x7e, 0x7f, 0x93, 0x1e, 0xd1,
+    0x50, 0x09, 0x2d, 0x21, 0x56, 0x0f, 0x00, 0x01, 0x95, 0x1e, 0x20, 0x56, 0x02, 0x7e, 0x25, 0x6a, 0x53, 0x02, 0x08, 0x2d, 0xd3, 0x50, 0x06, 0x01,
+    0x71, 0x89, 0x9b, 0xd0, 0x17, 0x2d, 0x28, 0xf6, 0x22, 0x7e, 0x30, 0x0f, 0x00, 0x01, 0xf5, 0x22, 0x00, 0x2f, 0x02, 0xa3, 0x1e, 0x2e, 0x28, 0x02,
+    0xd2, 0x17, 0x7d, 0x30, 0x06, 0x1a, 0x72, 0x8f, 0x90, 0x19, 0x4a, 0xbf, 0x23, 0xa1, 0x4c, 0x0c, 0x27, 0x0f, 0x00, 0x01, 0xd5, 0x4b, 0xc0, 0x23,
+    0x02, 0x1a, 0x4a, 0x05, 0x26, 0x02, 0xa0, 0x4c, 0x0b, 0x27, 0x06, 0x1d, 0x23, 0xa8, 0x6e, 0xb3, 0x13, 0xd3, 0x55, 0x51, 0x1d, 0xe1, 0x5d, 0x0f,
+    0x00, 0x01, 0xb5, 0x13, 0xe0, 0x5d, 0x02, 0x0f, 0x1d, 0x3b, 0x58, 0x02, 0x4f, 0x1d, 0xd5, 0x55, 0x06, 0x00, 0x17, 0x89, 0x67, 0x73, 0x45, 0x36,
+    0xf8, 0x0d, 0x58, 0xc1, 0x00, 0x0f, 0x00, 0x01, 0x75, 0x45, 0xc0, 0x00, 0x02, 0xd0, 0x50, 0xfc, 0xf9, 0x02, 0x0c, 0x58, 0x37, 0xf8, 0x06, 0x0b,
+    0x54, 0x94, 0x84, 0x06, 0x1c, 0xa3, 0x19, 0xf6, 0x1c, 0xf4, 0x21, 0x0f, 0x00, 0x01, 0xf5, 0x1c, 0x40, 0x1e, 0x02, 0x07, 0x1c, 0xf2, 0x21, 0x02,
+    0xb9, 0x1c, 0xa4, 0x19, 0x06, 0x18, 0x43, 0x69, 0x69, 0xea, 0x14, 0xdf, 0x19, 0x56, 0x21, 0xd8, 0x26, 0x0f, 0x00, 0x01, 0x55, 0x21, 0xe0, 0x19,
+    0x02, 0xe0, 0x17, 0xeb, 0x1c, 0x02, 0xeb, 0x14, 0xd6, 0x26, 0x06, 0x17, 0x5f, 0x82, 0x82, 0x33, 0x40, 0x50, 0x46, 0x88, 0x46, 0x1a, 0x48, 0x0f,
+    0x00, 0x01, 0x35, 0x40, 0x40, 0x47, 0x02, 0x8d, 0x43, 0x19, 0x48, 0x02, 0x86, 0x46, 0x52, 0x46, 0x06, 0x1a, 0x01, 0x73, 0x73, 0x17, 0x3e, 0x83,
+    0x59, 0x36, 0x44, 0x81, 0x5f, 0x0f, 0x00, 0x01, 0x35, 0x44, 0x80, 0x5f, 0x02, 0x37, 0x40, 0xa2, 0x5b, 0x02, 0x19, 0x3e, 0x84, 0x59, 0x06, 0x1d,
+    0x79, 0xa5, 0xa1, 0x13, 0x08, 0x6b, 0x16, 0xbc, 0x0c, 0xa8, 0x1e, 0x0f, 0x00, 0x01, 0x15, 0x08, 0xc0, 0x1d, 0x02, 0x7b, 0x0c, 0xa6, 0x1e, 0x02,
+    0xbb, 0x0c, 0x6c, 0x16, 0x06, 0x10, 0x7d, 0xa5, 0xa9, 0x4b, 0x39, 0x97, 0x51, 0xb6, 0x3d, 0x11, 0x56, 0x0f, 0x00, 0x01, 0xb5, 0x3d, 0x00, 0x56,
+    0x02, 0x75, 0x3d, 0x98, 0x51, 0x02, 0x4c, 0x39, 0x10, 0x56, 0x06, 0x15, 0x75, 0x82, 0x61, 0x13, 0x5a, 0xff, 0x36, 0xc0, 0x5d, 0xd5, 0x3b, 0x0f,
+    0x00, 0x01, 0x15, 0x5a, 0x00, 0x37, 0x02, 0xbe, 0x5d, 0xaa, 0x37, 0x02, 0x08, 0x5c, 0xd3, 0x3b, 0x06, 0x14, 0x2e, 0x96, 0x63, 0xb3, 0x46, 0x41,
+    0x4b, 0xdb, 0x48, 0x61, 0x4e, 0x0f, 0x00, 0x01, 0xb5, 0x46, 0x60, 0x4e, 0x02, 0x57, 0x48, 0x43, 0x4b, 0x02, 0xda, 0x48, 0xc5, 0x4b, 0x06, 0x2c,
+    0x38, 0x91, 0x99, 0xb3, 0x26, 0x3f, 0x4c, 0x32, 0x29, 0x80, 0x52, 0x0f, 0x00, 0x01, 0xb5, 0x26, 0x40, 0x4c, 0x02, 0x73, 0x28, 0x7e, 0x52, 0x02,
+    0x31, 0x29, 0x3c, 0x51, 0x06, 0x03, 0x64, 0x6e, 0x6d, 0x09, 0x59, 0x2a, 0x1c, 0xd6, 0x5e, 0xf7, 0x1f, 0x0f, 0x00, 0x01, 0xd5, 0x5e, 0x40, 0x1d,
+    0x02, 0x0a, 0x59, 0xf5, 0x1f, 0x02, 0xc0, 0x5a, 0x2b, 0x1c, 0x06, 0x09, 0x10, 0x8d, 0x7d, 0xd3, 0x2d, 0xcd, 0xf5, 0x84, 0x3e, 0x21, 0x07, 0x0f,
+    0x00, 0x01, 0xd5, 0x2d, 0x20, 0x07, 0x02, 0xdc, 0x38, 0xe7, 0xfd, 0x02, 0x83, 0x3e, 0xce, 0xf5, 0x06, 0x28, 0x46, 0xa4, 0x75, 0xbf, 0x56, 0x56,
+    0xff, 0x36, 0x5a, 0x0d, 0x05, 0x0f, 0x00, 0x01, 0xf5, 0x59, 0x80, 0x01, 0x02, 0x35, 0x5a, 0x0c, 0x05, 0x02, 0xc1, 0x56, 0x57, 0xff, 0x06, 0x1d,
+    0x51, 0x5c, 0x88, 0x95, 0x30, 0x9f, 0x07, 0x99, 0x3a, 0x24, 0x13, 0x0f, 0x00, 0x01, 0x75, 0x31, 0xa0, 0x07, 0x02, 0x96, 0x30, 0x82, 0x0e, 0x02,
+    0x98, 0x3a, 0x23, 0x13, 0x06, 0x1c, 0x29, 0x79, 0x94, 0xb3, 0x40, 0x9f, 0x57, 0xd2, 0x44, 0x9e, 0x59, 0x0f, 0x00, 0x01, 0xb5, 0x40, 0xa0, 0x57,
+    0x02, 0xd1, 0x44, 0x9c, 0x59, 0x02, 0x6d, 0x42, 0x19, 0x59, 0x06, 0x1c, 0x0b, 0x80, 0x87, 0x48, 0x51, 0xe7, 0x19, 0x9f, 0x57, 0x16, 0x21, 0x0f,
+    0x00, 0x01, 0x75, 0x54, 0x20, 0x1e, 0x02, 0x49, 0x51, 0x14, 0x21, 0x02, 0x9e, 0x57, 0xe9, 0x19, 0x06, 0x19, 0x44, 0x99, 0x94, 0xf3, 0x46, 0xbe,
+    0x5c, 0xf6, 0x4d, 0x61, 0x5f, 0x0f, 0x00, 0x01, 0xf5, 0x46, 0x60, 0x5f, 0x02, 0x84, 0x4c, 0xb0, 0x5e, 0x02, 0xf4, 0x4d, 0xc0, 0x5c, 0x06, 0x1d,
+    0x46, 0x80, 0xa0, 0x87, 0x06, 0xf2, 0x44, 0x56, 0x0c, 0xe9, 0x4c, 0x0f, 0x00, 0x01, 0x55, 0x0c, 0x00, 0x4c, 0x02, 0x88, 0x06, 0xf4, 0x44, 0x02,
+    0x7c, 0x09, 0xe7, 0x4c, 0x06, 0x16, 0x51, 0x95, 0x7e, 0xb4, 0x49, 0xff, 0x4d, 0x07, 0x4c, 0x61, 0x54, 0x0f, 0x00, 0x01, 0x75, 0x4b, 0x60, 0x54,
+    0x02, 0x05, 0x4c, 0x11, 0x51, 0x02, 0xb6, 0x49, 0x01, 0x4e, 0x06, 0x1d, 0x67, 0x84, 0x8e, 0x93, 0x53, 0x98, 0x43, 0x29, 0x5a, 0xa1, 0x45, 0x0f,
+    0x00, 0x01, 0x95, 0x53, 0xa0, 0x45, 0x02, 0x2e, 0x57, 0x9a, 0x43, 0x02, 0x28, 0x5a, 0xf3, 0x44, 0x06, 0x1d, 0x0e, 0x9c, 0x6d, 0x36, 0x1f, 0x1f,
+    0x51, 0xd6, 0x25, 0x44, 0x54, 0x0f, 0x00, 0x01, 0xd5, 0x25, 0x20, 0x51, 0x02, 0xb6, 0x24, 0x02, 0x52, 0x02, 0x38, 0x1f, 0x43, 0x54, 0x06, 0x31,
+    0x7b, 0xa6, 0x6f, 0x13, 0x17, 0xa4, 0x2f, 0x80, 0x1d, 0xcc, 0x37, 0x0f, 0x00, 0x01, 0x15, 0x17, 0x20, 0x32, 0x02, 0x3a, 0x1d, 0xa5, 0x2f, 0x02,
+    0x7f, 0x1d, 0xca, 0x37, 0x06, 0x1d, 0x31, 0x64, 0x85, 0xc8, 0x46, 0x14, 0x08, 0x36, 0x4c, 0x21, 0x0d, 0x0f, 0x00, 0x01, 0x35, 0x4c, 0x20, 0x0d,
+    0x02, 0xca, 0x46, 0x15, 0x08, 0x02, 0xbe, 0x47, 0xea, 0x0a, 0x06, 0x09, 0x08, 0x6e, 0x73, 0xbf, 0x1c, 0x2b, 0x4e, 0x56, 0x26, 0xe1, 0x53, 0x0f,
+    0x00, 0x01, 0x55, 0x26, 0xe0, 0x53, 0x02, 0x8b, 0x1f, 0x36, 0x50, 0x02, 0xc1, 0x1c, 0x2c, 0x4e, 0x06, 0x13, 0x7e, 0xa8, 0x7c, 0xf3, 0x18, 0x60,
+    0x15, 0x58, 0x23, 0x24, 0x1e, 0x0f, 0x00, 0x01, 0xf5, 0x18, 0x60, 0x19, 0x02, 0x56, 0x23, 0x61, 0x15, 0x02, 0x16, 0x23, 0x23, 0x1e, 0x06, 0x13,
+    0x48, 0x7c, 0x66, 0x1f, 0x06, 0x1f, 0x4d, 0xbc, 0x0e, 0xe8, 0x4f, 0x0f, 0x00, 0x01, 0x15, 0x0a, 0x20, 0x4d, 0x02, 0xbb, 0x0e, 0xe6, 0x4f, 0x02,
+    0x21, 0x06, 0xac, 0x4d, 0x06, 0x19, 0x7a, 0x9f, 0x6f, 0x2a, 0x29, 0xac, 0x2b, 0x83, 0x2b, 0x61, 0x34, 0x0f, 0x00, 0x01, 0x35, 0x2b, 0x60, 0x34,
+    0x02, 0x2c, 0x29, 0x57, 0x2e, 0x02, 0x82, 0x2b, 0xad, 0x2b, 0x06, 0x27, 0x1d, 0x7e, 0x94, 0x73, 0x2a, 0xfc, 0x39, 0x14, 0x36, 0xa1, 0x41, 0x0f,
+    0x00, 0x01, 0x75, 0x2a, 0xa0, 0x41, 0x02, 0x04, 0x30, 0xaf, 0x3f, 0x02, 0x12, 0x36, 0xfe, 0x39, 0x06, 0x27, 0x22, 0x97, 0x7f, 0xff, 0x08, 0x9f,
+    0x26, 0x96, 0x0a, 0x8d, 0x39, 0x0f, 0x00, 0x01, 0x95, 0x0a, 0xa0, 0x26, 0x02, 0x3a, 0x0a, 0xe6, 0x2f, 0x02, 0x00, 0x09, 0x8b, 0x39, 0x06, 0x1d,
+    0x41, 0x8f, 0x92, 0xee, 0x39, 0xf9, 0x59, 0xaa, 0x3f, 0xe1, 0x5f, 0x0f, 0x00, 0x01, 0xd5, 0x3d, 0xe0, 0x5f, 0x02, 0xef, 0x39, 0xfa, 0x59, 0x02,
+    0xa9, 0x3f, 0x34, 0x5e, 0x06, 0x0c, 0x0c, 0x89, 0x7e, 0xf8, 0x0e, 0xa1, 0x00, 0xf9, 0x18, 0xe7, 0x08, 0x0f, 0x00, 0x01, 0x15, 0x15, 0xa0, 0x04,
+    0x02, 0xf7, 0x18, 0xa3, 0x00, 0x02, 0xfa, 0x0e, 0xe5, 0x08, 0x06, 0x0b, 0x16, 0x72, 0x7f, 0x33, 0x0d, 0xcf, 0x1a, 0xa7, 0x18, 0x01, 0x27, 0x0f,
+    0x00, 0x01, 0x35, 0x0d, 0x00, 0x27, 0x02, 0x0d, 0x11, 0xd8, 0x20, 0x02, 0xa5, 0x18, 0xd1, 0x1a, 0x06, 0x15, 0x7d, 0x58, 0x7d, 0x0f, 0x31, 0x1f,
+    0x4b, 0xb4, 0x35, 0x5d, 0x52, 0x0f, 0x00, 0x01, 0x35, 0x31, 0x20, 0x4b, 0x02, 0xb3, 0x35, 0x7e, 0x4e, 0x02, 0x11, 0x31, 0x5c, 0x52, 0x06, 0x1d,
+    0x6e, 0x82, 0x92, 0xe3, 0x28, 0xdf, 0x45, 0x76, 0x2e, 0x81, 0x4d, 0x0f, 0x00, 0x01, 0xd5, 0x2b, 0xe0, 0x45, 0x02, 0xe5, 0x28, 0x50, 0x4b, 0x02,
+    0x75, 0x2e, 0x80, 0x4d, 0x06, 0x11, 0x79, 0x70, 0x61, 0x8f, 0x2e, 0x3b, 0x4c, 0x76, 0x34, 0x00, 0x50, 0x0f, 0x00, 0x01, 0x75, 0x34, 0xc0, 0x4c,
+    0x02, 0x73, 0x30, 0xfe, 0x4f, 0x02, 0x91, 0x2e, 0x3c, 0x4c, 0x06, 0x1a, 0x57, 0x7c, 0x78, 0x26, 0x01, 0x63, 0x48, 0x96, 0x0a, 0xc1, 0x58, 0x0f,
+    0x00, 0x01, 0x95, 0x0a, 0xc0, 0x58, 0x02, 0x27, 0x01, 0x32, 0x4f, 0x02, 0x79, 0x05, 0x64, 0x48, 0x06, 0x30, 0x01, 0x85, 0x86, 0x5c, 0x2a, 0xc7,
+    0x1d, 0xf6, 0x2e, 0xc1, 0x29, 0x0f, 0x00, 0x01, 0xf5, 0x2e, 0xc0, 0x29, 0x02, 0xf9, 0x2c, 0xa4, 0x24, 0x02, 0x5e, 0x2a, 0xc9, 0x1d, 0x06, 0x1d,
+    0x61, 0x73, 0x8e, 0x9d, 0x22, 0xa8, 0x0b, 0xb6, 0x26, 0xd6, 0x12, 0x0f, 0x00, 0x01, 0xb5, 0x26, 0x80, 0x10, 0x02, 0x0a, 0x24, 0xd5, 0x12, 0x02,
+    0x9e, 0x22, 0xaa, 0x0b, 0x06, 0x19, 0x09, 0x7b, 0x81, 0x9b, 0x24, 0xe6, 0x14, 0xd6, 0x26, 0x41, 0x20, 0x0f, 0x00, 0x01, 0xd5, 0x26, 0x40, 0x20,
+    0x02, 0x99, 0x25, 0xc4, 0x1a, 0x02, 0x9c, 0x24, 0xe8, 0x14, 0x06, 0x19, 0x46, 0x8e, 0x8e, 0x33, 0x35, 0xff, 0x47, 0x8c, 0x3c, 0xac, 0x4b, 0x0f,
+    0x00, 0x01, 0x35, 0x35, 0x00, 0x48, 0x02, 0x20, 0x3a, 0xab, 0x4b, 0x02, 0x8b, 0x3c, 0x76, 0x4a, 0x06, 0x1d, 0x63, 0x75, 0x73, 0x21, 0x04, 0x5f,
+    0x26, 0xd6, 0x14, 0x09, 0x2e, 0x0f, 0x00, 0x01, 0xd5, 0x14, 0x60, 0x26, 0x02, 0x5c, 0x0a, 0x07, 0x2e, 0x02, 0x23, 0x04, 0x0e, 0x29, 0x06, 0x17,
+    0x4c, 0x7f, 0x9a, 0x53, 0x00, 0xff, 0x57, 0x90, 0x11, 0x8e, 0x60, 0x0f, 0x00, 0x01, 0x55, 0x00, 0x00, 0x58, 0x02, 0xe2, 0x08, 0x8d, 0x60, 0x02,
+    0x8e, 0x11, 0xfa, 0x5e, 0x06, 0x17, 0x1c, 0x9e, 0xa1, 0x33, 0x37, 0x1f, 0x26, 0x43, 0x3e, 0x58, 0x2a, 0x0f, 0x00, 0x01, 0x35, 0x37, 0x20, 0x26,
+    0x02, 0x4b, 0x3d, 0x56, 0x2a, 0x02, 0x41, 0x3e, 0xec, 0x29, 0x06, 0x07, 0x7b, 0x6e, 0xa2, 0xb3, 0x33, 0x5f, 0x23, 0x18, 0x3a, 0x81, 0x28, 0x0f,
+    0x00, 0x01, 0xb5, 0x33, 0x80, 0x28, 0x02, 0x96, 0x35, 0x61, 0x23, 0x02, 0x17, 0x3a, 0x02, 0x28, 0x06, 0x09, 0x34, 0x8f, 0x92, 0x93, 0x0d, 0xf4,
+    0x5b, 0xab, 0x15, 0x81, 0x5e, 0x0f, 0x00, 0x01, 0x95, 0x0d, 0x80, 0x5e, 0x02, 0xaa, 0x15, 0xf5, 0x5b, 0x02, 0x1f, 0x13, 0xcb, 0x5d, 0x06, 0x15,
+    0x52, 0x68, 0x9f, 0xd3, 0x52, 0x7f, 0x1c, 0xc5, 0x57, 0xd0, 0x20, 0x0f, 0x00, 0x01, 0xd5, 0x52, 0x80, 0x1c, 0x02, 0xc3, 0x57, 0xce, 0x20, 0x02,
+    0xf2, 0x53, 0x3d, 0x20, 0x06, 0x18, 0x2c, 0x9b, 0x7d, 0xfb, 0x35, 0xa7, 0x48, 0xb6, 0x3a, 0xe1, 0x4c, 0x0f, 0x00, 0x01, 0xb5, 0x3a, 0xe0, 0x4c,
+    0x02, 0xd9, 0x39, 0xa4, 0x4a, 0x02, 0xfd, 0x35, 0xa8, 0x48, 0x06, 0x2c, 0x3c, 0x72, 0x99, 0xd3, 0x12, 0x8f, 0x44, 0xe6, 0x16, 0xe2, 0x4a, 0x0f,
+    0x00, 0x01, 0xd5, 0x12, 0xa0, 0x49, 0x02, 0xe5, 0x16, 0x90, 0x44, 0x02, 0x35, 0x14, 0xe0, 0x4a, 0x06, 0x19, 0x12, 0x90, 0x63, 0xda, 0x4f, 0x3f,
+    0x3f, 0x16, 0x54, 0x29, 0x44, 0x0f, 0x00, 0x01, 0x15, 0x54, 0x40, 0x3f, 0x02, 0xc8, 0x52, 0x14, 0x40, 0x02, 0xdc, 0x4f, 0x27, 0x44, 0x06, 0x06,
+    0x18, 0x9d, 0x59, 0x53, 0x32, 0xe8, 0x4d, 0xaa, 0x36, 0x81, 0x53, 0x0f, 0x00, 0x01, 0x55, 0x32, 0x80, 0x53, 0x02, 0xff, 0x35, 0xea, 0x4d, 0x02,
+    0xa9, 0x36, 0x2a, 0x4e, 0x06, 0x21, 0x2f, 0x86, 0x5a, 0x73, 0x51, 0x35, 0x1b, 0x0d, 0x55, 0x61, 0x1f, 0x0f, 0x00, 0x01, 0x75, 0x51, 0x60, 0x1f,
+    0x02, 0x0b, 0x55, 0x36, 0x1b, 0x02, 0x81, 0x53, 0x76, 0x1b, 0x06, 0x1d, 0x29, 0x6c, 0x78, 0x93, 0x1a, 0x6d, 0x4e, 0x04, 0x1d, 0x61, 0x59, 0x0f,
+    0x00, 0x01, 0x95, 0x1a, 0x60, 0x59, 0x02, 0x3c, 0x1b, 0xe7, 0x52, 0x02, 0x03, 0x1d, 0x6e, 0x4e, 0x06, 0x0e, 0x54, 0x69, 0x85, 0x60, 0x01, 0x7f,
+    0x57, 0x9c, 0x0c, 0xe8, 0x5e, 0x0f, 0x00, 0x01, 0xf5, 0x03, 0x80, 0x57, 0x02, 0x9b, 0x0c, 0xe6, 0x5e, 0x02, 0x61, 0x01, 0xac, 0x5b, 0x06, 0x17,
+    0x58, 0x8a, 0x67, 0xf3, 0x29, 0xd1, 0x58, 0xbb, 0x2e, 0xa7, 0x5c, 0x0f, 0x00, 0x01, 0xf5, 0x29, 0xa0, 0x59, 0x02, 0xe7, 0x2c, 0xd3, 0x58, 0x02,
+    0xba, 0x2e, 0xa5, 0x5c, 0x06, 0x13, 0x52, 0x7a, 0x8b, 0x89, 0x59, 0xdf, 0x30, 0x56, 0x5e, 0xec, 0x3a, 0x0f, 0x00, 0x01, 0x55, 0x5e, 0xe0, 0x30,
+    0x02, 0x8a, 0x59, 0x35, 0x37, 0x02, 0x9f, 0x5b, 0xeb, 0x3a, 0x06, 0x09, 0x7e, 0x5a, 0xa0, 0x3c, 0x41, 0xa7, 0x39, 0x36, 0x45, 0x53, 0x3c, 0x0f,
+    0x00, 0x01, 0x35, 0x45, 0x00, 0x3c, 0x02, 0x7d, 0x41, 0xa9, 0x39, 0x02, 0x3d, 0x41, 0x52, 0x3c, 0x06, 0x08, 0x77, 0xa0, 0x80, 0x8d, 0x2a, 0x5f,
+    0x5b, 0x16, 0x30, 0xf4, 0x60, 0x0f, 0x00, 0x01, 0x15, 0x30, 0x60, 0x5b, 0x02, 0x8e, 0x2a, 0x39, 0x5e, 0x02, 0x67, 0x2f, 0xf3, 0x60, 0x06, 0x1d,
+    0x02, 0x5c, 0x5a, 0x0c, 0x14, 0xd8, 0xf4, 0x76, 0x20, 0xe1, 0xff, 0x0f, 0x00, 0x01, 0x75, 0x20, 0xe0, 0xff, 0x02, 0x01, 0x15, 0x8d, 0xf5, 0x02,
+    0x0e, 0x14, 0xd9, 0xf4, 0x06, 0x16, 0x6f, 0x70, 0x76, 0x5f, 0x41, 0x6b, 0x2a, 0x1c, 0x47, 0xa1, 0x2d, 0x0f, 0x00, 0x01, 0x35, 0x43, 0xa0, 0x2d,
+    0x02, 0x1b, 0x47, 0xa6, 0x2b, 0x02, 0x61, 0x41, 0x6c, 0x2a, 0x06, 0x1d, 0x24, 0x8a, 0x72, 0x93, 0x58, 0x3f, 0x51, 0xa5, 0x5f, 0x31, 0x57, 0x0f,
+    0x00, 0x01, 0x95, 0x58, 0x40, 0x51, 0x02, 0xfc, 0x5c, 0x48, 0x53, 0x02, 0xa4, 0x5f, 0x2f, 0x57, 0x06, 0x1d, 0x6f, 0x5e, 0x57, 0x53, 0x05, 0x2b,
+    0x40, 0x82, 0x0d, 0x61, 0x4b, 0x0f, 0x00, 0x01, 0x55, 0x05, 0x60, 0x4b, 0x02, 0x81, 0x0d, 0x2c, 0x40, 0x02, 0x2d, 0x06, 0x78, 0x40, 0x06, 0x31,
+    0x6b, 0x64, 0xa1, 0xb0, 0x3e, 0x5b, 0x1b, 0xd5, 0x43, 0x61, 0x22, 0x0f, 0x00, 0x01, 0x95, 0x3f, 0x60, 0x22, 0x02, 0xd3, 0x43, 0x9e, 0x21, 0x02,
+    0xb1, 0x3e, 0x5d, 0x1b, 0x06, 0x15, 0x18, 0x82, 0x91, 0xc7, 0x08, 0x32, 0x0d, 0xb6, 0x12, 0x21, 0x10, 0x0f, 0x00, 0x01, 0xb5, 0x12, 0x20, 0x10,
+    0x02, 0xc8, 0x08, 0x34, 0x0d, 0x02, 0xfc, 0x0d, 0x47, 0x0f, 0x06, 0x13, 0x21, 0x5d, 0x65, 0x50, 0x4c, 0x9c, 0x52, 0xf6, 0x4e, 0xa1, 0x54, 0x0f,
+    0x00, 0x01, 0xf5, 0x4e, 0xa0, 0x54, 0x02, 0x92, 0x4c, 0x9d, 0x52, 0x02, 0x52, 0x4c, 0xfb, 0x52, 0x06, 0x2a, 0x72, 0xa0, 0x5d, 0xd3, 0x02, 0xc8,
+    0x59, 0xc9, 0x0c, 0x55, 0x61, 0x0f, 0x00, 0x01, 0xd5, 0x02, 0x80, 0x5a, 0x02, 0x9e, 0x0b, 0xca, 0x59, 0x02, 0xc8, 0x0c, 0x54, 0x61, 0x06, 0x18,
+    0x78, 0x8e, 0xa2, 0x33, 0x48, 0xa2, 0x14, 0xe8, 0x4f, 0x41, 0x1c, 0x0f, 0x00, 0x01, 0x35, 0x48, 0x40, 0x1c, 0x02, 0xe7, 0x4f, 0x92, 0x1b, 0x02,
+    0x58, 0x4d, 0xa4, 0x14, 0x06, 0x27, 0x7e, 0x8d, 0x56, 0x98, 0x53, 0xe3, 0x2b, 0x36, 0x5d, 0x74, 0x32, 0x0f, 0x00, 0x01, 0x35, 0x5d, 0x00, 0x2c,
+    0x02, 0xe7, 0x59, 0x72, 0x32, 0x02, 0x99, 0x53, 0xe4, 0x2b, 0x06, 0x09, 0x4f, 0x7f, 0x94, 0xf7, 0x38, 0x3f, 0x24, 0x56, 0x43, 0x34, 0x2a, 0x0f,
+    0x00, 0x01, 0x55, 0x43, 0x40, 0x24, 0x02, 0x07, 0x3e, 0x32, 0x2a, 0x02, 0xf9, 0x38, 0xa4, 0x28, 0x06, 0x0d, 0x4f, 0x6d, 0xa2, 0x14, 0xf4, 0x20,
+    0x16, 0x76, 0x00, 0xe1, 0x1e, 0x0f, 0x00, 0x01, 0x75, 0x00, 0xe0, 0x1e, 0x02, 0x16, 0xf4, 0x21, 0x16, 0x02, 0x97, 0xf7, 0x02, 0x1e, 0x06, 0x09,
+    0x4d, 0x5c, 0x86, 0xfe, 0xfc, 0xe9, 0x1e, 0x36, 0x00, 0x01, 0x24, 0x0f, 0x00, 0x01, 0x35, 0x00, 0x00, 0x24, 0x02, 0x3f, 0xfd, 0xeb, 0x1e, 0x02,
+    0xff, 0xfc, 0xd5, 0x21, 0x06, 0x15, 0x06, 0x7c, 0x80, 0x33, 0x5c, 0x07, 0x42, 0x7e, 0x60, 0xe1, 0x4b, 0x0f, 0x00, 0x01, 0x35, 0x5c, 0xe0, 0x4b,
+    0x02, 0x29, 0x5e, 0xf4, 0x46, 0x02, 0x7d, 0x60, 0x08, 0x42, 0x06, 0x13, 0x4d, 0x58, 0x87, 0x23, 0x25, 0xdf, 0x49, 0x6e, 0x2b, 0x19, 0x50, 0x0f,
+    0x00, 0x01, 0x55, 0x25, 0xe0, 0x49, 0x02, 0x6c, 0x2b, 0x18, 0x50, 0x02, 0x24, 0x25, 0x90, 0x4d, 0x06, 0x27, 0x76, 0x9e, 0x84, 0xbd, 0xf6, 0xb3,
+    0x3e, 0x4b, 0x02, 0x81, 0x48, 0x0f, 0x00, 0x01, 0xb5, 0x00, 0x80, 0x48, 0x02, 0x4a, 0x02, 0xb5, 0x3e, 0x02, 0xbe, 0xf6, 0x2a, 0x44, 0x06, 0x1d,
+    0x12, 0x7b, 0x87, 0x2b, 0x00, 0xb6, 0x2f, 0x96, 0x0f, 0xa1, 0x3e, 0x0f, 0x00, 0x01, 0x95, 0x0f, 0xa0, 0x3e, 0x02, 0x00, 0x07, 0x6c, 0x38, 0x02,
+    0x2c, 0x00, 0xb7, 0x2f, 0x06, 0x19, 0x00, 0x7c, 0x84, 0xd3, 0x5b, 0x16, 0xfd, 0xcd, 0x6f, 0x01, 0x07, 0x0f, 0x00, 0x01, 0xd5, 0x5b, 0x00, 0x07,
+    0x02, 0xe0, 0x64, 0x8c, 0x02, 0x02, 0xcc, 0x6f, 0x17, 0xfd, 0x06, 0x29, 0x75, 0x7e, 0x63, 0x53, 0x08, 0x5f, 0x39, 0xb0, 0x16, 0x5e, 0x3f, 0x0f,
+    0x00, 0x01, 0x55, 0x08, 0x60, 0x39, 0x02, 0x32, 0x0f, 0x5d, 0x3f, 0x02, 0xae, 0x16, 0x5a, 0x3a, 0x06, 0x1d, 0x40, 0x8e, 0x63, 0xd3, 0x1f, 0xdf,
+    0x5d, 0xa4, 0x28, 0x10, 0x61, 0x0f, 0x00, 0x01, 0xd5, 0x1f, 0xe0, 0x5d, 0x02, 0xbc, 0x25, 0x67, 0x5e, 0x02, 0xa3, 0x28, 0x0e, 0x61, 0x06, 0x1d,
+    0x48, 0x74, 0xa4, 0x13, 0x00, 0xdf, 0x54, 0xd0, 0x05, 0x1b, 0x60, 0x0f, 0x00, 0x01, 0x15, 0x00, 0xe0, 0x54, 0x02, 0xce, 0x05, 0x19, 0x60, 0x02,
+    0x27, 0x02, 0x53, 0x5f, 0x06, 0x1d, 0x75, 0x78, 0x60, 0x33, 0x1c, 0x3c, 0x2f, 0xb3, 0x1d, 0x3c, 0x34, 0x0f, 0x00, 0x01, 0x35, 0x1c, 0xe0, 0x2f,
+    0x02, 0xb2, 0x1d, 0x3d, 0x2f, 0x02, 0xcf, 0x1c, 0x3a, 0x34, 0x06, 0x0f, 0x18, 0x9a, 0x8a, 0x33, 0x38, 0x1f, 0x59, 0x49, 0x3d, 0x54, 0x5d, 0x0f,
+    0x00, 0x01, 0x35, 0x38, 0x20, 0x59, 0x02, 0x47, 0x3d, 0x53, 0x5d, 0x02, 0x5a, 0x3c, 0xc5, 0x5b, 0x06, 0x07, 0x30, 0x5e, 0x7e, 0x3e, 0x0a, 0x09,
+    0x05, 0x16, 0x15, 0x41, 0x13, 0x0f, 0x00, 0x01, 0x15, 0x15, 0x40, 0x13, 0x02, 0x6a, 0x0b, 0xf5, 0x0b, 0x02, 0x3f, 0x0a, 0x0b, 0x05, 0x06, 0x01,
+    0x55, 0x8f, 0x81, 0xd6, 0x1b, 0x90, 0x2f, 0x76, 0x25, 0x04, 0x35, 0x0f, 0x00, 0x01, 0x75, 0x25, 0x60, 0x32, 0x02, 0x66, 0x22, 0x92, 0x2f, 0x02,
+    0xd8, 0x1b, 0x03, 0x35, 0x06, 0x0b, 0x0b, 0x71, 0x86, 0xb3, 0x00, 0xb1, 0xf7, 0x49, 0x0f, 0xc1, 0x0b, 0x0f, 0x00, 0x01, 0xb5, 0x00, 0xc0, 0x0b,
+    0x02, 0x8e, 0x05, 0x59, 0x03, 0x02, 0x47, 0x0f, 0xb3, 0xf7, 0x06, 0x17, 0x08, 0x7d, 0x77, 0x93, 0x35, 0xdf, 0x0c, 0x1c, 0x3c, 0x68, 0x1d, 0x0f,
+    0x00, 0x01, 0x95, 0x35, 0xe0, 0x0c, 0x02, 0xa8, 0x38, 0x93, 0x13, 0x02, 0x1b, 0x3c, 0x66, 0x1d, 0x06, 0x11, 0x6d, 0x71, 0x86, 0x60, 0x5c, 0x9f,
+    0x4f, 0xfc, 0x5f, 0x8e, 0x56, 0x0f, 0x00, 0x01, 0x95, 0x5d, 0xa0, 0x4f, 0x02, 0xfb, 0x5f, 0xa6, 0x53, 0x02, 0x61, 0x5c, 0x8c, 0x56, 0x06, 0x31,
+    0x37, 0x9f, 0x7a, 0xd3, 0x3f, 0x9f, 0x25, 0xea, 0x47, 0x75, 0x2f, 0x0f, 0x00, 0x01, 0xd5, 0x3f, 0xa0, 0x25, 0x02, 0xde, 0x46, 0xea, 0x29, 0x02,
+    0xe8, 0x47, 0x74, 0x2f, 0x06, 0x1b, 0x7d, 0x9b, 0xa8, 0x53, 0x0d, 0xdc, 0x14, 0xf5, 0x10, 0xe1, 0x1f, 0x0f, 0x00, 0x01, 0x55, 0x0d, 0xe0, 0x1f,
+    0x02, 0xf4, 0x10, 0x9f, 0x1f, 0x02, 0x53, 0x10, 0xde, 0x14, 0x06, 0x18, 0x34, 0x76, 0xa7, 0x13, 0x08, 0x15, 0x0c, 0xad, 0x14, 0x8d, 0x14, 0x0f,
+    0x00, 0x01, 0x15, 0x08, 0x40, 0x14, 0x02, 0x00, 0x0d, 0x8b, 0x14, 0x02, 0xab, 0x14, 0x16, 0x0c, 0x06, 0x06, 0x3f, 0xa6, 0x82, 0x93, 0x53, 0x9f,
+    0x15, 0x60, 0x5a, 0x95, 0x17, 0x0f, 0x00, 0x01, 0x95, 0x53, 0xa0, 0x15, 0x02, 0x5e, 0x5a, 0xaa, 0x16, 0x02, 0x08, 0x5a, 0x94, 0x17, 0x06, 0x1d,
+    0x51, 0x7a, 0x9b, 0xf3, 0x56, 0x9f, 0x29, 0xcf, 0x5b, 0x3e, 0x2d, 0x0f, 0x00, 0x01, 0xf5, 0x56, 0xa0, 0x29, 0x02, 0x11, 0x59, 0x3c, 0x2d, 0x02,
+    0xcd, 0x5b, 0x99, 0x2c, 0x06, 0x1d, 0x4b, 0x98, 0x99, 0xe3, 0x0c, 0x5f, 0x35, 0xd6, 0x14, 0xf1, 0x3b, 0x0f, 0x00, 0x01, 0xd5, 0x14, 0x60, 0x35,
+    0x02, 0x1c, 0x13, 0xa8, 0x3a, 0x02, 0xe4, 0x0c, 0xf0, 0x3b, 0x06, 0x15, 0x19, 0x8b, 0x7b, 0xd3, 0x06, 0x5f, 0x1a, 0xdf, 0x17, 0xea, 0x20, 0x0f,
+    0x00, 0x01, 0xd5, 0x06, 0x60, 0x1a, 0x02, 0xb9, 0x11, 0x44, 0x1d, 0x02, 0xde, 0x17, 0xe9, 0x20, 0x06, 0x1d, 0x4b, 0xa3, 0x85, 0xd3, 0x46, 0x1c,
+    0x35, 0x05, 0x4a, 0x21, 0x36, 0x0f, 0x00, 0x01, 0xd5, 0x46, 0x20, 0x36, 0x02, 0x04, 0x4a, 0xaf, 0x35, 0x02, 0xc4, 0x49, 0x1e, 0x35, 0x06, 0x1d,
+    0x08, 0x81, 0x78, 0x8a, 0x1c, 0x1f, 0x43, 0xb6, 0x25, 0xb8, 0x46, 0x0f, 0x00, 0x01, 0xb5, 0x25, 0x20, 0x43, 0x02, 0x50, 0x21, 0x9c, 0x44, 0x02,
+    0x8c, 0x1c, 0xb7, 0x46, 0x06, 0x09, 0x0c, 0xa3, 0x9b, 0x1f, 0x1d, 0x6b, 0x25, 0xf6, 0x24, 0xa1, 0x2c, 0x0f, 0x00, 0x01, 0xf5, 0x24, 0xa0, 0x2c,
+    0x02, 0x4b, 0x24, 0x56, 0x2b, 0x02, 0x21, 0x1d, 0x6c, 0x25, 0x06, 0x09, 0x6f, 0x97, 0x87, 0xf3, 0x22, 0x21, 0x49, 0x39, 0x29, 0x07, 0x4e, 0x0f,
+    0x00, 0x01, 0xf5, 0x22, 0x00, 0x4c, 0x02, 0x38, 0x29, 0x23, 0x49, 0x02, 0xdb, 0x27, 0x06, 0x4e, 0x06, 0x0b, 0x6d, 0x86, 0x71, 0x76, 0x02, 0x5f,
+    0x21, 0x56, 0x0b, 0x47, 0x23, 0x0f, 0x00, 0x01, 0x55, 0x0b, 0x60, 0x21, 0x02, 0x77, 0x02, 0x03, 0x22, 0x02, 0x9a, 0x07, 0x45, 0x23, 0x06, 0x1d,
+    0x45, 0x6e, 0x73, 0x21, 0x46, 0x1b, 0xfb, 0xf6, 0x4e, 0x41, 0x0b, 0x0f, 0x00, 0x01, 0xf5, 0x4e, 0x40, 0x0b, 0x02, 0x23, 0x46, 0xce, 0x00, 0x02,
+    0xb1, 0x48, 0x1c, 0xfb, 0x06, 0x12, 0x65, 0xaa, 0x99, 0x2f, 0x38, 0x5f, 0x1f, 0x76, 0x3f, 0x7d, 0x24, 0x0f, 0x00, 0x01, 0x75, 0x3f, 0x60, 0x1f,
+    0x02, 0x31, 0x38, 0x7c, 0x24, 0x02, 0x6c, 0x3f, 0x78, 0x23, 0x06, 0x11, 0x50, 0x85, 0x72, 0x93, 0x14, 0x86, 0x4b, 0x4a, 0x1d, 0x81, 0x50, 0x0f,
+    0x00, 0x01, 0x95, 0x14, 0x80, 0x50, 0x02, 0x48, 0x1d, 0x34, 0x4d, 0x02, 0x7c, 0x19, 0x87, 0x4b, 0x06, 0x0e, 0x44, 0x99, 0x87, 0x73, 0x07, 0xbf,
+    0x16, 0x44, 0x0a, 0x1e, 0x2a, 0x0f, 0x00, 0x01, 0x75, 0x07, 0xc0, 0x16, 0x02, 0x43, 0x0a, 0x0e, 0x22, 0x02, 0xb1, 0x09, 0x1c, 0x2a, 0x06, 0x14,
+    0x35, 0x5f, 0x82, 0x3b, 0x24, 0x67, 0x4b, 0x76, 0x28, 0xe1, 0x52, 0x0f, 0x00, 0x01, 0x75, 0x28, 0xe0, 0x52, 0x02, 0xb9, 0x24, 0x64, 0x4f, 0x02,
+    0x3c, 0x24, 0x68, 0x4b, 0x06, 0x0b, 0x54, 0x71, 0x7f, 0x8e, 0x2b, 0xdc, 0x05, 0x96, 0x38, 0x61, 0x08, 0x0f, 0x00, 0x01, 0x95, 0x38, 0x60, 0x08,
+    0x02, 0xd2, 0x2f, 0xdd, 0x05, 0x02, 0x8f, 0x2b, 0x1b, 0x07, 0x06, 0x27, 0x64, 0x8d, 0x75, 0x62, 0x1d, 0x26, 0x3a, 0xf6, 0x24, 0xe1, 0x3e, 0x0f,
+    0x00, 0x01, 0xf5, 0x24, 0xe0, 0x3e, 0x02, 0x5c, 0x22, 0x27, 0x3a, 0x02, 0x64, 0x1d, 0xef, 0x3b, 0x06, 0x1d, 0x65, 0x98, 0x59, 0xd3, 0x4e, 0xdf,
+    0x0f, 0xd7, 0x56, 0x12, 0x15, 0x0f, 0x00, 0x01, 0xd5, 0x4e, 0x20, 0x10, 0x02, 0x25, 0x55, 0xe0, 0x0f, 0x02, 0xd5, 0x56, 0x10, 0x15, 0x06, 0x1d,
+    0x14, 0xa7, 0x9f, 0x05, 0x55, 0xd0, 0x0c, 0x59, 0x5c, 0x81, 0x15, 0x0f, 0x00, 0x01, 0x15, 0x5c, 0x80, 0x15, 0x02, 0x06, 0x55, 0xd2, 0x0c, 0x02,
+    0x57, 0x5c, 0x63, 0x14, 0x06, 0x04, 0x08, 0x88, 0x7d, 0x50, 0x23, 0x7f, 0x03, 0xf6, 0x32, 0x9f, 0x13, 0x0f, 0x00, 0x01, 0xf5, 0x32, 0x80, 0x03,
+    0x02, 0xa3, 0x2c, 0x0f, 0x0b, 0x02, 0x52, 0x23, 0x9d, 0x13, 0x06, 0x1d, 0x20, 0x75, 0x75, 0xd3, 0x15, 0xa5, 0x48, 0xfc, 0x1d, 0x21, 0x56, 0x0f,
+    0x00, 0x01, 0xd5, 0x15, 0x20, 0x56, 0x02, 0xe8, 0x18, 0xb3, 0x4d, 0x02, 0xfb, 0x1d, 0xa6, 0x48, 0x06, 0x1d, 0x5f, 0x78, 0x8a, 0x37, 0x2f, 0xc2,
+    0x21, 0xd6, 0x33, 0x28, 0x27, 0x0f, 0x00, 0x01, 0xd5, 0x33, 0x20, 0x25, 0x02, 0x38, 0x2f, 0xc4, 0x21, 0x02, 0x1c, 0x31, 0x27, 0x27, 0x06, 0x1d,
+    0x5b, 0x7f, 0x7b, 0x99, 0x3f, 0xe1, 0x0c, 0x56, 0x4a, 0x21, 0x15, 0x0f, 0x00, 0x01, 0x55, 0x4a, 0x20, 0x15, 0x02, 0xd7, 0x44, 0xe3, 0x0c, 0x02,
+    0x9a, 0x3f, 0x85, 0x10, 0x06, 0x31, 0x7a, 0x9e, 0x6e, 0xf3, 0x22, 0x5a, 0x40, 0xd2, 0x25, 0x59, 0x46, 0x0f, 0x00, 0x01, 0xf5, 0x22, 0x20, 0x42,
+    0x02, 0xd1, 0x25, 0x5c, 0x40, 0x02, 0x6c, 0x25, 0x58, 0x46, 0x06, 0x26, 0x74, 0x6e, 0x91, 0xdc, 0x1b, 0xff, 0x5e, 0xfb, 0x1f, 0xab, 0x61, 0x0f,
+    0x00, 0x01, 0x15, 0x1d, 0x00, 0x5f, 0x02, 0xf9, 0x1f, 0xe5, 0x60, 0x02, 0xde, 0x1b, 0xa9, 0x61, 0x06, 0x2e, 0x2f, 0x7a, 0x5b, 0x53, 0x37, 0x9f,
+    0x34, 0xb1, 0x41, 0xfc, 0x38, 0x0f, 0x00, 0x01, 0x55, 0x37, 0xa0, 0x34, 0x02, 0xe2, 0x3b, 0xed, 0x34, 0x02, 0xb0, 0x41, 0xfb, 0x38, 0x06, 0x1c,
+    0x78, 0x68, 0x6b, 0xdd, 0x3b, 0x48, 0x28, 0x56, 0x3e, 0x96, 0x2c, 0x0f, 0x00, 0x01, 0x55, 0x3e, 0x60, 0x29, 0x02, 0x6a, 0x3c, 0x95, 0x2c, 0x02,
+    0xde, 0x3b, 0x49, 0x28, 0x06, 0x19, 0x7b, 0x91, 0xa3, 0x1b, 0x1c, 0x06, 0x0e, 0xf6, 0x1c, 0x61, 0x13, 0x0f, 0x00, 0x01, 0xf5, 0x1c, 0x60, 0x13,
+    0x02, 0xb5, 0x1c, 0x07, 0x0e, 0x02, 0x1c, 0x1c, 0xef, 0x12, 0x06, 0x1a, 0x03, 0x79, 0x87, 0x73, 0x5f, 0x65, 0xfa, 0x9c, 0x6b, 0x61, 0x04, 0x0f,
+    0x00, 0x01, 0x75, 0x5f, 0x60, 0x04, 0x02, 0xa8, 0x64, 0x53, 0x00, 0x02, 0x9b, 0x6b, 0x66, 0xfa, 0x06, 0x29, 0x7d, 0x59, 0x57, 0x73, 0x1d, 0xfe,
+    0x20, 0x76, 0x22, 0x01, 0x28, 0x0f, 0x00, 0x01, 0x75, 0x1d, 0x20, 0x21, 0x02, 0xb5, 0x1d, 0x00, 0x28, 0x02, 0x74, 0x22, 0x00, 0x21, 0x06, 0x30,
+    0x78, 0xa0, 0x7f, 0xd7, 0x23, 0x5f, 0x30, 0x16, 0x2b, 0xe9, 0x39, 0x0f, 0x00, 0x01, 0x15, 0x2b, 0x60, 0x30, 0x02, 0xd9, 0x23, 0x24, 0x35, 0x02,
+    0x3c, 0x2a, 0xe8, 0x39, 0x06, 0x18, 0x4e, 0x5d, 0x91, 0x2d, 0x0b, 0xb9, 0x48, 0xd6, 0x13, 0xc1, 0x52, 0x0f, 0x00, 0x01, 0xd5, 0x13, 0xc0, 0x52,
+    0x02, 0x02, 0x0c, 0xcd, 0x4f, 0x02, 0x2f, 0x0b, 0xba, 0x48, 0x06, 0x04, 0x79, 0x62, 0x8e, 0xa0, 0x32, 0x85, 0x18, 0x56, 0x3c, 0xee, 0x1f, 0x0f,
+    0x00, 0x01, 0x55, 0x3c, 0x80, 0x1d, 0x02, 0x1b, 0x34, 0x86, 0x18, 0x02, 0xa1, 0x32, 0xec, 0x1f, 0x06, 0x20, 0x51, 0x95, 0x81, 0x93, 0x04, 0xa0,
+    0xf9, 0x57, 0x11, 0xc1, 0x07, 0x0f, 0x00, 0x01, 0x95, 0x04, 0xc0, 0x07, 0x02, 0x55, 0x11, 0x01, 0x01, 0x02, 0x36, 0x0e, 0xa1, 0xf9, 0x06, 0x1d,
+    0x24, 0x83, 0x6b, 0x53, 0x2e, 0x5f, 0x2f, 0x75, 0x39, 0xc0, 0x35, 0x0f, 0x00, 0x01, 0x55, 0x2e, 0x60, 0x2f, 0x02, 0x54, 0x34, 0xff, 0x30, 0x02,
+    0x73, 0x39, 0xbf, 0x35, 0x06, 0x0a, 0x63, 0x96, 0xa5, 0xbe, 0x03, 0x94, 0x57, 0x8b, 0x0e, 0xe1, 0x5c, 0x0f, 0x00, 0x01, 0xf5, 0x0b, 0xe0, 0x5c,
+    0x02, 0x8a, 0x0e, 0x95, 0x57, 0x02, 0xbf, 0x03, 0x8a, 0x5c, 0x06, 0x12, 0x6d, 0x96, 0x88, 0x5d, 0x3e, 0x53, 0x2b, 0xca, 0x3f, 0xe1, 0x33, 0x0f,
+    0x00, 0x01, 0x75, 0x3f, 0xe0, 0x33, 0x02, 0x5f, 0x3e, 0x6a, 0x30, 0x02, 0xc9, 0x3f, 0x54, 0x2b, 0x06, 0x27, 0x05, 0x80, 0x7c, 0xb3, 0x31, 0x9f,
+    0x5a, 0x36, 0x32, 0xa1, 0x61, 0x0f, 0x00, 0x01, 0x35, 0x32, 0xa0, 0x5a, 0x02, 0xf4, 0x31, 0xe0, 0x5d, 0x02, 0xb4, 0x31, 0x9f, 0x61, 0x06, 0x16,
+    0x39, 0xa0, 0x85, 0xbf, 0x05, 0x55, 0x45, 0xcd, 0x0c, 0x2d, 0x47, 0x0f, 0x00, 0x01, 0xf5, 0x0b, 0x60, 0x46, 0x02, 0xc0, 0x05, 0x2b, 0x47, 0x02,
+    0xcb, 0x0c, 0x56, 0x45, 0x06, 0x1d, 0x13, 0xa0, 0x6c, 0xe2, 0x4e, 0xee, 0x2c, 0xf6, 0x50, 0x5f, 0x30, 0x0f, 0x00, 0x01, 0xb5, 0x50, 0xe0, 0x2d,
+    0x02, 0xf5, 0x50, 0xef, 0x2c, 0x02, 0xe4, 0x4e, 0x5e, 0x30, 0x06, 0x1d, 0x11, 0x7f, 0x8a, 0x53, 0x1d, 0xff, 0x0d, 0x79, 0x23, 0xc5, 0x1b, 0x0f,
+    0x00, 0x01, 0x55, 0x1d, 0x00, 0x0e, 0x02, 0x56, 0x20, 0xa2, 0x16, 0x02, 0x78, 0x23, 0xc3, 0x1b, 0x06, 0x1d, 0x46, 0xa7, 0x7c, 0x5c, 0x3b, 0x47,
+    0x57, 0x56, 0x3d, 0x33, 0x5a, 0x0f, 0x00, 0x01, 0x55, 0x3d, 0xa0, 0x58, 0x02, 0x5d, 0x3b, 0x49, 0x57, 0x02, 0x46, 0x3d, 0x31, 0x5a, 0x06, 0x27,
+    0x2b, 0x7a, 0x69, 0x33, 0x22, 0x23, 0x14, 0x1f, 0x2e, 0x41, 0x15, 0x0f, 0x00, 0x01, 0x35, 0x22, 0x40, 0x15, 0x02, 0x59, 0x27, 0x64, 0x14, 0x02,
+    0x1e, 0x2e, 0x24, 0x14, 0x06, 0x12, 0x35, 0x91, 0x9b, 0x73, 0x2b, 0xff, 0x3c, 0x5d, 0x32, 0x65, 0x43, 0x0f, 0x00, 0x01, 0x75, 0x2b, 0x00, 0x3d,
+    0x02, 0x58, 0x30, 0x64, 0x43, 0x02, 0x5c, 0x32, 0x47, 0x42, 0x06, 0x09, 0x09, 0x7a, 0x7f, 0x73, 0x1b, 0x01, 0x0b, 0x39, 0x2e, 0xa1, 0x1b, 0x0f,
+    0x00, 0x01, 0x75, 0x1b, 0xa0, 0x1b, 0x02, 0xa6, 0x23, 0x31, 0x13, 0x02, 0x37, 0x2e, 0x03, 0x0b, 0x06, 0x05, 0x15, 0x92, 0x83, 0xeb, 0xf7, 0x17,
+    0x13, 0x36, 0x05, 0xe1, 0x24, 0x0f, 0x00, 0x01, 0x35, 0x05, 0xe0, 0x24, 0x02, 0x61, 0x01, 0xcc, 0x1c, 0x02, 0xed, 0xf7, 0x18, 0x13, 0x06, 0x18,
+    0x55, 0x8a, 0x9f, 0x92, 0xfe, 0x7c, 0x4a, 0x73, 0x07, 0x81, 0x54, 0x0f, 0x00, 0x01, 0x15, 0x04, 0x80, 0x54, 0x02, 0x94, 0xfe, 0x3f, 0x53, 0x02,
+    0x72, 0x07, 0x7d, 0x4a, 0x06, 0x19, 0x29, 0x72, 0x8d, 0x27, 0x49, 0xd3, 0x2f, 0x7f, 0x4e, 0x8a, 0x32, 0x0f, 0x00, 0x01, 0xf5, 0x4a, 0xa0, 0x31,
+    0x02, 0x29, 0x49, 0xd4, 0x2f, 0x02, 0x7d, 0x4e, 0x88, 0x32, 0x06, 0x09, 0x05, 0x87, 0x7c, 0xe0, 0x53, 0x9f, 0x27, 0xb6, 0x5a, 0x4f, 0x2c, 0x0f,
+    0x00, 0x01, 0xb5, 0x5a, 0xa0, 0x27, 0x02, 0xdc, 0x57, 0xc7, 0x29, 0x02, 0xe2, 0x53, 0x4d, 0x2c, 0x06, 0x31, 0x2e, 0xa6, 0x8e, 0x2a, 0x4e, 0x6c,
+    0x2a, 0xf6, 0x52, 0x98, 0x2c, 0x0f, 0x00, 0x01, 0xf5, 0x52, 0xe0, 0x2b, 0x02, 0xb5, 0x52, 0x97, 0x2c, 0x02, 0x2c, 0x4e, 0x6e, 0x2a, 0x06, 0x16,
+    0x7d, 0xa0, 0xa1, 0x7d, 0x42, 0x12, 0x4e, 0x16, 0x44, 0x61, 0x52, 0x0f, 0x00, 0x01, 0x15, 0x44, 0x60, 0x52, 0x02, 0x7e, 0x42, 0xea, 0x51, 0x02,
+    0xe8, 0x43, 0x13, 0x4e, 0x06, 0x30, 0x03, 0x7d, 0x7b, 0x93, 0x52, 0x7f, 0x57, 0xef, 0x59, 0x5a, 0x5e, 0x0f, 0x00, 0x01, 0x95, 0x52, 0x80, 0x57,
+    0x02, 0x01, 0x56, 0x8c, 0x5a, 0x02, 0xee, 0x59, 0x59, 0x5e, 0x06, 0x13, 0x72, 0x76, 0x9c, 0x06, 0x23, 0x38, 0x51, 0x96, 0x2c, 0x01, 0x56, 0x0f,
+    0x00, 0x01, 0x95, 0x2c, 0x00, 0x56, 0x02, 0xae, 0x26, 0x3a, 0x51, 0x02, 0x08, 0x23, 0x33, 0x55, 0x06, 0x1a, 0x67, 0x7e, 0x77, 0xb3, 0x1f, 0x9f,
+    0x0c, 0x40, 0x2b, 0xb6, 0x17, 0x0f, 0x00, 0x01, 0xb5, 0x1f, 0xa0, 0x0c, 0x02, 0x3f, 0x2b, 0x0a, 0x11, 0x02, 0x49, 0x25, 0xb4, 0x17, 0x06, 0x01,
+    0x4b, 0x96, 0x63, 0x33, 0x4b, 0xbf, 0x5e, 0xd3, 0x4e, 0x1f, 0x63, 0x0f, 0x00, 0x01, 0x35, 0x4b, 0xc0, 0x5e, 0x02, 0xf3, 0x4d, 0x7e, 0x5f, 0x02,
+    0xd2, 0x4e, 0x1d, 0x63, 0x06, 0x14, 0x31, 0x85, 0x59, 0xa0, 0x28, 0x5f, 0x0a, 0x56, 0x33, 0xae, 0x11, 0x0f, 0x00, 0x01, 0x55, 0x33, 0x60, 0x0a,
+    0x02, 0xa1, 0x28, 0xac, 0x11, 0x02, 0xae, 0x2e, 0xb9, 0x0a, 0x06, 0x11, 0x0e, 0x81, 0x8a, 0x73, 0x17, 0x5f, 0x41, 0x70, 0x25, 0x5b, 0x4c, 0x0f,
+    0x00, 0x01, 0x75, 0x17, 0x60, 0x41, 0x02, 0xb2, 0x1e, 0x3d, 0x48, 0x02, 0x6e, 0x25, 0x5a, 0x4c, 0x06, 0x00, 0x54, 0x82, 0x92, 0xd3, 0x44, 0x79,
+    0x2d, 0x11, 0x4f, 0xaf, 0x31, 0x0f, 0x00, 0x01, 0xd5, 0x44, 0x80, 0x30, 0x02, 0x42, 0x4a, 0xad, 0x31, 0x02, 0x0f, 0x4f, 0x7b, 0x2d, 0x06, 0x13,
+    0x05, 0x76, 0x8d, 0x33, 0x55, 0x7b, 0x03, 0x73, 0x62, 0xc1, 0x0e, 0x0f, 0x00, 0x01, 0x35, 0x55, 0xc0, 0x0e, 0x02, 0x53, 0x5a, 0xde, 0x0a, 0x02,
+    0x71, 0x62, 0x7c, 0x03, 0x06, 0x1d, 0x68, 0x7a, 0x78, 0xfb, 0x0c, 0xc7, 0x03, 0xaa, 0x18, 0x81, 0x0b, 0x0f, 0x00, 0x01, 0x15, 0x12, 0x80, 0x0b,
+    0x02, 0xa9, 0x18, 0xf4, 0x06, 0x02, 0xfd, 0x0c, 0xc8, 0x03, 0x06, 0x1d, 0x6d, 0x6c, 0x83, 0x04, 0x1e, 0x4f, 0x35, 0xde, 0x24, 0xe1, 0x3f, 0x0f,
+    0x00, 0x01, 0xd5, 0x1f, 0xe0, 0x3f, 0x02, 0xdd, 0x24, 0x08, 0x3b, 0x02, 0x05, 0x1e, 0x50, 0x35, 0x06, 0x27, 0x61, 0x84, 0x7e, 0xb3, 0x3c, 0x3c,
+    0x2d, 0x51, 0x40, 0x9c, 0x2f, 0x0f, 0x00, 0x01, 0xb5, 0x3c, 0x60, 0x2e, 0x02, 0xb2, 0x3e, 0x3d, 0x2d, 0x02, 0x4f, 0x40, 0x9b, 0x2f, 0x06, 0x1d,
+    0x61, 0x73, 0x8f, 0xb3, 0x16, 0xff, 0x52, 0x5f, 0x1f, 0xf3, 0x58, 0x0f, 0x00, 0x01, 0xb5, 0x16, 0x00, 0x53, 0x02, 0x5e, 0x1f, 0x09, 0x57, 0x02,
+    0xc7, 0x19, 0xf2, 0x58, 0x06, 0x0d, 0x15, 0x8e, 0x63, 0x73, 0x3a, 0x1c, 0x26, 0x93, 0x3d, 0x41, 0x2c, 0x0f, 0x00, 0x01, 0x75, 0x3a, 0x40, 0x2c,
+    0x02, 0x92, 0x3d, 0x1d, 0x26, 0x02, 0x8f, 0x3c, 0x1b, 0x27, 0x06, 0x0c, 0x3d, 0x5b, 0x84, 0xa5, 0x50, 0xbf, 0x35, 0x76, 0x55, 0x64, 0x3e, 0x0f,
+    0x00, 0x01, 0x75, 0x55, 0xc0, 0x35, 0x02, 0xa6, 0x50, 0x91, 0x3a, 0x02, 0xf7, 0x50, 0x63, 0x3e, 0x06, 0x30, 0x6e, 0x81, 0x93, 0x53, 0x55, 0x2d,
+    0x55, 0xb3, 0x5c, 0x01, 0x59, 0x0f, 0x00, 0x01, 0x55, 0x55, 0x00, 0x59, 0x02, 0x23, 0x59, 0x2e, 0x55, 0x02, 0xb1, 0x5c, 0xfc, 0x57, 0x06, 0x2f,
+    0x1b, 0x9a, 0x57, 0xcc, 0xfb, 0x9f, 0x34, 0x32, 0x04, 0xfe, 0x3f, 0x0f, 0x00, 0x01, 0x95, 0x02, 0xa0, 0x34, 0x02, 0x31, 0x04, 0xe0, 0x34, 0x02,
+    0xcd, 0xfb, 0xfc, 0x3f, 0x06, 0x1d, 0x46, 0x9c, 0x83, 0x20, 0x55, 0xcc, 0x4c, 0x16, 0x5b, 0x08, 0x4f, 0x0f, 0x00, 0x01, 0x15, 0x5b, 0x00, 0x4e,
+    0x02, 0x1c, 0x5a, 0x07, 0x4f, 0x02, 0x22, 0x55, 0xcd, 0x4c, 0x06, 0x18, 0x10, 0x8b, 0x80, 0x07, 0x57, 0xf2, 0x33, 0xd6, 0x5c, 0x81, 0x36, 0x0f,
+    0x00, 0x01, 0xd5, 0x5c, 0x80, 0x36, 0x02, 0xaf, 0x5a, 0x3a, 0x35, 0x02, 0x09, 0x57, 0xf4, 0x33, 0x06, 0x17, 0x7d, 0xa2, 0x60, 0xe2, 0x3f, 0x5f,
+    0x3f, 0x96, 0x42, 0xbf, 0x41, 0x0f, 0x00, 0x01, 0x95, 0x42, 0x60, 0x3f, 0x02, 0xe3, 0x3f, 0xaf, 0x3f, 0x02, 0x52, 0x42, 0xbd, 0x41, 0x06, 0x18,
+    0x3e, 0x71, 0x69, 0xa5, 0x52, 0xd7, 0x44, 0x96, 0x59, 0xe1, 0x47, 0x0f, 0x00, 0x01, 0x95, 0x59, 0xe0, 0x47, 0x02, 0xed, 0x54, 0xd9, 0x44, 0x02,
+    0xa6, 0x52, 0x92, 0x45, 0x06, 0x1d, 0x06, 0x7b, 0x80, 0x2a, 0x09, 0xff, 0x10, 0xd6, 0x1d, 0x99, 0x21, 0x0f, 0x00, 0x01, 0xd5, 0x1d, 0x00, 0x11,
+    0x02, 0x50, 0x12, 0x7c, 0x19, 0x02, 0x2c, 0x09, 0x97, 0x21, 0x06, 0x0e, 0x24, 0x6d, 0xaa, 0x53, 0x42, 0x8f, 0x47, 0x07, 0x45, 0x43, 0x4a, 0x0f,
+    0x00, 0x01, 0x55, 0x42, 0x40, 0x4a, 0x02, 0x05, 0x45, 0x91, 0x47, 0x02, 0x16, 0x43, 0x41, 0x4a, 0x06, 0x17, 0x28, 0x8f, 0x74, 0xd3, 0x3a, 0x7f,
+    0x0a, 0xbc, 0x3f, 0xa8, 0x14, 0x0f, 0x00, 0x01, 0xd5, 0x3a, 0x80, 0x0a, 0x02, 0x28, 0x3e, 0x33, 0x0e, 0x02, 0xbb, 0x3f, 0xa6, 0x14, 0x06, 0x27,
+    0x79, 0x7b, 0xa0, 0x9e, 0x27, 0x04, 0x2e, 0x16, 0x33, 0xad, 0x30, 0x0f, 0x00, 0x01, 0x15, 0x33, 0x60, 0x30, 0x02, 0xba, 0x2c, 0x05, 0x2e, 0x02,
+    0xa0, 0x27, 0xab, 0x30, 0x06, 0x02, 0x13, 0x7c, 0x76, 0xb3, 0x21, 0x4e, 0x1b, 0xe5, 0x2a, 0xe1, 0x22, 0x0f, 0x00, 0x01, 0xb5, 0x21, 0xe0, 0x22,
+    0x02, 0xe4, 0x2a, 0x4f, 0x1b, 0x02, 0xf3, 0x25, 0x3e, 0x1e, 0x06, 0x14, 0x6d, 0x73, 0x68, 0xa8, 0x08, 0x88, 0xf7, 0x20, 0x10, 0xa1, 0x08, 0x0f,
+    0x00, 0x01, 0x55, 0x0b, 0xa0, 0x08, 0x02, 0xaa, 0x08, 0x55, 0xfb, 0x02, 0x1e, 0x10, 0x8a, 0xf7, 0x06, 0x1b, 0x25, 0x94, 0x7c, 0x1e, 0x48, 0x69,
+    0x29, 0x6c, 0x4d, 0x17, 0x2f, 0x0f, 0x00, 0x01, 0x15, 0x4c, 0x00, 0x2c, 0x02, 0x6a, 0x4d, 0x15, 0x2f, 0x02, 0x1f, 0x48, 0x6b, 0x29, 0x06, 0x03,
+    0x70, 0xa3, 0xa7, 0x73, 0x24, 0x42, 0xf5, 0x3a, 0x30, 0x21, 0x00, 0x0f, 0x00, 0x01, 0x75, 0x24, 0x20, 0x00, 0x02, 0x47, 0x2f, 0xb2, 0xff, 0x02,
+    0x38, 0x30, 0x44, 0xf5, 0x06, 0x10, 0x07, 0x7f, 0x84, 0xb3, 0x42, 0x7f, 0x08, 0x86, 0x51, 0x51, 0x18, 0x0f, 0x00, 0x01, 0xb5, 0x42, 0x80, 0x08,
+    0x02, 0x0d, 0x4a, 0x38, 0x11, 0x02, 0x85, 0x51, 0x50, 0x18, 0x06, 0x19, 0x1f, 0x59, 0x6e, 0xb3, 0x40, 0xbf, 0x5c, 0x14, 0x43, 0x20, 0x60, 0x0f,
+    0x00, 0x01, 0xb5, 0x40, 0xc0, 0x5c, 0x02, 0x13, 0x43, 0x1e, 0x60, 0x02, 0xd1, 0x40, 0xbc, 0x5d, 0x06, 0x1d, 0x29, 0x6d, 0xa6, 0x33, 0x28, 0x80,
+    0x35, 0xb8, 0x30, 0x32, 0x3c, 0x0f, 0x00, 0x01, 0x35, 0x28, 0xe0, 0x3b, 0x02, 0xa5, 0x2a, 0x31, 0x3c, 0x02, 0xb6, 0x30, 0x82, 0x35, 0x06, 0x0c,
+    0x79, 0x86, 0xa0, 0xd8, 0x05, 0x81, 0x06, 0x16, 0x0c, 0xe1, 0x0d, 0x0f, 0x00, 0x01, 0x15, 0x0c, 0xe0, 0x0d, 0x02, 0x77, 0x09, 0x83, 0x06, 0x02,
+    0xda, 0x05, 0x05, 0x0d, 0x06, 0x0b, 0x6e, 0x83, 0x6f, 0xd3, 0x28, 0xb1, 0x17, 0xc9, 0x35, 0xcb, 0x1f, 0x0f, 0x00, 0x01, 0xd5, 0x28, 0x20, 0x1a,
+    0x02, 0xde, 0x2f, 0xc9, 0x1f, 0x02, 0xc7, 0x35, 0xb3, 0x17, 0x06, 0x14, 0x00, 0x7c, 0x7c, 0xe7, 0x43, 0x92, 0x19, 0xb6, 0x51, 0x01, 0x23, 0x0f,
+    0x00, 0x01, 0xb5, 0x51, 0x00, 0x23, 0x02, 0x3e, 0x4a, 0xea, 0x1d, 0x02, 0xe8, 0x43, 0x94, 0x19, 0x06, 0x00, 0x5c, 0x59, 0x6e, 0x53, 0x13, 0x73,
+    0x2d, 0x8a, 0x1b, 0xaa, 0x35, 0x0f, 0x00, 0x01, 0x55, 0x13, 0xe0, 0x2f, 0x02, 0x89, 0x1b, 0x74, 0x2d, 0x02, 0xbd, 0x13, 0xa9, 0x35, 0x06, 0x27,
+    0x7a, 0x5c, 0x79, 0x1a, 0x0f, 0xbf, 0x21, 0xfa, 0x16, 0x09, 0x2b, 0x0f, 0x00, 0x01, 0xb5, 0x0f, 0xc0, 0x21, 0x02, 0xf8, 0x16, 0xa4, 0x25, 0x02,
+    0x1c, 0x0f, 0x07, 0x2b, 0x06, 0x1d, 0x75, 0x84, 0x64, 0x96, 0xf5, 0xbf, 0x1b, 0x16, 0x00, 0x43, 0x1f, 0x0f, 0x00, 0x01, 0x15, 0x00, 0xc0, 0x1b,
+    0x02, 0x56, 0xfb, 0x41, 0x1f, 0x02, 0x97, 0xf5, 0x63, 0x1c, 0x06, 0x2f, 0x64, 0xa6, 0x97, 0xd3, 0x05, 0xa7, 0x37, 0x3e, 0x0b, 0x21, 0x3e, 0x0f,
+    0x00, 0x01, 0xd5, 0x05, 0x20, 0x3e, 0x02, 0xfd, 0x0a, 0xa8, 0x37, 0x02, 0x3d, 0x0b, 0xb0, 0x3c, 0x06, 0x09, 0x6e, 0x68, 0x88, 0x93, 0x1e, 0x1f,
+    0x52, 0x16, 0x24, 0x61, 0x57, 0x0f, 0x00, 0x01, 0x15, 0x24, 0x40, 0x55, 0x02, 0x95, 0x1e, 0x20, 0x52, 0x02, 0xd4, 0x1f, 0x60, 0x57, 0x06, 0x2e,
+    0x1e, 0x6a, 0x7e, 0xc5, 0x36, 0xd0, 0x46, 0x76, 0x38, 0xc1, 0x4f, 0x0f, 0x00, 0x01, 0x75, 0x38, 0xc0, 0x4f, 0x02, 0x2d, 0x37, 0x19, 0x4b, 0x02,
+    0xc6, 0x36, 0xd2, 0x46, 0x06, 0x1d, 0x3a, 0xa7, 0x7f, 0xe4, 0x19, 0xdf, 0x05, 0x77, 0x24, 0xf2, 0x09, 0x0f, 0x00, 0x01, 0x15, 0x24, 0xe0, 0x07,
+    0x02, 0xe5, 0x19, 0xf0, 0x09, 0x02, 0x75, 0x24, 0xe1, 0x05, 0x06, 0x27, 0x72, 0x68, 0x82, 0x93, 0x20, 0x77, 0x2f, 0xa3, 0x25, 0x01, 0x3a, 0x0f,
+    0x00, 0x01, 0x95, 0x20, 0x00, 0x3a, 0x02, 0xa1, 0x25, 0x0c, 0x35, 0x02, 0xae, 0x21, 0x79, 0x2f, 0x06, 0x1d, 0x2c, 0x5d, 0x85, 0x93, 0x38, 0x51,
+    0x55, 0x60, 0x3b, 0x81, 0x5d, 0x0f, 0x00, 0x01, 0x95, 0x38, 0x80, 0x5d, 0x02, 0xd5, 0x38, 0xe9, 0x59, 0x02, 0x5e, 0x3b, 0x52, 0x55, 0x06, 0x31,
+    0x4c, 0x73, 0x76, 0x10, 0x1c, 0x17, 0x42, 0xb6, 0x20, 0xa1, 0x4a, 0x0f, 0x00, 0x01, 0xb5, 0x20, 0xa0, 0x4a, 0x02, 0x11, 0x1c, 0x5c, 0x45, 0x02,
+    0xad, 0x1d, 0x19, 0x42, 0x06, 0x27, 0x44, 0x61, 0x70, 0x13, 0x37, 0x44, 0x1d, 0xbc, 0x3d, 0xe1, 0x22, 0x0f, 0x00, 0x01, 0x15, 0x37, 0xe0, 0x22,
+    0x02, 0x08, 0x38, 0x13, 0x1f, 0x02, 0xba, 0x3d, 0x45, 0x1d, 0x06, 0x1a, 0x79, 0x88, 0xa3, 0xa4, 0x02, 0xe7, 0xf9, 0xf6, 0x0c, 0xd2, 0x00, 0x0f,
+    0x00, 0x01, 0xf5, 0x0c, 0x40, 0x00, 0x02, 0xdd, 0x08, 0xe8, 0xf9, 0x02, 0xa5, 0x02, 0xd0, 0x00, 0x06, 0x17, 0x1c, 0xa6, 0x65, 0x64, 0x1b, 0xdf,
+    0x2e, 0x16, 0x21, 0xe3, 0x31, 0x0f, 0x00, 0x01, 0xd5, 0x20, 0xe0, 0x2e, 0x02, 0x15, 0x21, 0x71, 0x2f, 0x02, 0x66, 0x1b, 0xe2, 0x31, 0x06, 0x01,
+    0x62, 0x89, 0x87, 0x13, 0x24, 0x15, 0x37, 0xac, 0x28, 0x8d, 0x3e, 0x0f, 0x00, 0x01, 0x15, 0x24, 0x80, 0x3b, 0x02, 0xe0, 0x26, 0x8b, 0x3e, 0x02,
+    0xab, 0x28, 0x16, 0x37, 0x06, 0x27, 0x45, 0x5a, 0x7e, 0x96, 0x31, 0xa0, 0x5b, 0xf8, 0x37, 0x81, 0x5e, 0x0f, 0x00, 0x01, 0xf5, 0x31, 0x80, 0x5e,
+    0x02, 0xf6, 0x37, 0xa1, 0x5b, 0x02, 0x97, 0x31, 0x03, 0x5d, 0x06, 0x16, 0x6e, 0x71, 0x99, 0x7f, 0x2b, 0x7f, 0x3f, 0xac, 0x30, 0x97, 0x41, 0x0f,
+    0x00, 0x01, 0x35, 0x2d, 0x80, 0x3f, 0x02, 0xab, 0x30, 0x96, 0x41, 0x02, 0x80, 0x2b, 0x2c, 0x41, 0x06, 0x2f, 0x6d, 0x66, 0x6d, 0x00, 0xff, 0xff,
+    0x32, 0xd1, 0x06, 0x4f, 0x3c, 0x0f, 0x00, 0x01, 0x95, 0x00, 0x00, 0x33, 0x02, 0x02, 0xff, 0x4d, 0x3c, 0x02, 0xcf, 0x06, 0x9b, 0x35, 0x06, 0x31,
+    0x66, 0x7f, 0x76, 0x50, 0xfc, 0x3f, 0x3a, 0x16, 0x0f, 0x40, 0x42, 0x0f, 0x00, 0x01, 0x15, 0x0f, 0x40, 0x3a, 0x02, 0x93, 0x05, 0x3f, 0x42, 0x02,
+    0x52, 0xfc, 0x5d, 0x3d, 0x06, 0x14, 0x0b, 0x84, 0x74, 0x8c, 0x0f, 0xdf, 0x3d, 0x76, 0x1c, 0x1a, 0x42, 0x0f, 0x00, 0x01, 0x75, 0x1c, 0xe0, 0x3d,
+    0x02, 0xa1, 0x16, 0x6c, 0x3f, 0x02, 0x8d, 0x0f, 0x18, 0x42, 0x06, 0x17, 0x0a, 0x8d, 0x87, 0x2c, 0x2f, 0x38, 0x3d, 0x96, 0x36, 0x61, 0x42, 0x0f,
+    0x00, 0x01, 0x95, 0x36, 0x60, 0x42, 0x02, 0x11, 0x34, 0x3d, 0x40, 0x02, 0x2e, 0x2f, 0x39, 0x3d, 0x06, 0x1c, 0x1c, 0x69, 0x83, 0xeb, 0x59, 0xaa,
+    0x0d, 0x82, 0x62, 0x59, 0x10, 0x0f, 0x00, 0x01, 0xf5, 0x5b, 0x20, 0x0f, 0x02, 0x81, 0x62, 0xac, 0x0d, 0x02, 0xec, 0x59, 0x57, 0x10, 0x06, 0x1b,
+    0x58, 0x6e, 0x79, 0x7f, 0x3e, 0x1f, 0x42, 0xd6, 0x40, 0x39, 0x47, 0x0f, 0x00, 0x01, 0xd5, 0x40, 0x20, 0x42, 0x02, 0x80, 0x3e, 0x4c, 0x44, 0x02,
+    0x2c, 0x3f, 0x37, 0x47, 0x06, 0x1f, 0x7e, 0x6c, 0x56, 0xd9, 0x2f, 0xdf, 0x56, 0xb6, 0x36, 0x84, 0x59, 0x0f, 0x00, 0x01, 0xb5, 0x36, 0xe0, 0x56,
+    0x02, 0xb8, 0x31, 0x83, 0x59, 0x02, 0xdb, 0x2f, 0xe6, 0x56, 0x06, 0x24, 0x3f, 0x6b, 0x6a, 0x80, 0x02, 0x9f, 0x17, 0x56, 0x10, 0x6e, 0x26, 0x0f,
+    0x00, 0x01, 0x55, 0x10, 0xa0, 0x17, 0x02, 0x1b, 0x06, 0x46, 0x1b, 0x02, 0x82, 0x02, 0x6d, 0x26, 0x06, 0x02, 0x60, 0xa8, 0x6b, 0x3a, 0x4c, 0xe5,
+    0x38, 0x23, 0x4e, 0x01, 0x3b, 0x0f, 0x00, 0x01, 0x15, 0x4e, 0x00, 0x3b, 0x02, 0x3b, 0x4c, 0xe7, 0x38, 0x02, 0x22, 0x4e, 0x6d, 0x39, 0x06, 0x13,
+    0x7c, 0x58, 0x92, 0xee, 0x01, 0x79, 0x47, 0xb6, 0x08, 0xf7, 0x4d, 0x0f, 0x00, 0x01, 0xb5, 0x08, 0x20, 0x4c, 0x02, 0xf0, 0x01, 0x7b, 0x47, 0x02,
+    0x30, 0x02, 0xf6, 0x4d, 0x06, 0x09, 0x6b, 0x72, 0x7c, 0x2f, 0x01, 0x7a, 0x05, 0x84, 0x04, 0x41, 0x17, 0x0f, 0x00, 0x01, 0x55, 0x02, 0x40, 0x17,
+    0x02, 0x83, 0x04, 0xae, 0x0d, 0x02, 0x30, 0x01, 0x7c, 0x05, 0x06, 0x1d, 0x2d, 0x65, 0x67, 0x67, 0xfb, 0x06, 0xfb, 0x16, 0x06, 0xa1, 0x0c, 0x0f,
+    0x00, 0x01, 0x15, 0x06, 0xa0, 0x0c, 0x02, 0x68, 0xfb, 0xb4, 0xfe, 0x02, 0x5c, 0xfd, 0x07, 0xfb, 0x06, 0x12, 0x61, 0x6c, 0x8f, 0x73, 0x1b, 0xff,
+    0x43, 0xc7, 0x1e, 0x12, 0x4a, 0x0f, 0x00, 0x01, 0x75, 0x1b, 0x20, 0x48, 0x02, 0xc5, 0x1e, 0x11, 0x4a, 0x02, 0x56, 0x1c, 0x01, 0x44, 0x06, 0x18,
+    0x60, 0x81, 0x7d, 0x13, 0x15, 0xdf, 0x07, 0x27, 0x2e, 0xda, 0x0d, 0x0f, 0x00, 0x01, 0x15, 0x15, 0xe0, 0x07, 0x02, 0x0d, 0x22, 0xd8, 0x0d, 0x02,
+    0x25, 0x2e, 0xb0, 0x0a, 0x06, 0x01, 0x5f, 0x8a, 0x90, 0xf3, 0x5e, 0xd4, 0xf7, 0xcc, 0x67, 0x0d, 0x04, 0x0f, 0x00, 0x01, 0xf5, 0x5e, 0x40, 0x00,
+    0x02, 0xcb, 0x67, 0xd6, 0xf7, 0x02, 0x80, 0x64, 0x0c, 0x04, 0x06, 0x26, 0x13, 0x77, 0x7b, 0x59, 0x29, 0x1f, 0x5b, 0x96, 0x2b, 0x67, 0x5f, 0x0f,
+    0x00, 0x01, 0x95, 0x2b, 0x20, 0x5b, 0x02, 0x5b, 0x29, 0x66, 0x5f, 0x02, 0x40, 0x2a, 0x0b, 0x5d, 0x06, 0x2e, 0x1a, 0x5d, 0x6e, 0xff, 0x47, 0x2b,
+    0x27, 0x16, 0x4d, 0xa1, 0x2e, 0x0f, 0x00, 0x01, 0x15, 0x4d, 0xa0, 0x2e, 0x02, 0x7b, 0x48, 0x66, 0x29, 0x02, 0x01, 0x48, 0x2c, 0x27, 0x06, 0x1d,
+    0x6e, 0x9c, 0x65, 0xd1, 0x33, 0x3c, 0x17, 0xf6, 0x3a, 0xa1, 0x18, 0x0f, 0x00, 0x01, 0xf5, 0x3a, 0xa0, 0x18, 0x02, 0xd2, 0x33, 0x7d, 0x17, 0x02,
+    0xd0, 0x39, 0x3d, 0x17, 0x06, 0x1c, 0x79, 0x79, 0xa1, 0x28, 0x29, 0x69, 0x0f, 0xb6, 0x2b, 0x17, 0x16, 0x0f, 0x00, 0x01, 0xb5, 0x2b, 0x60, 0x15,
+    0x02, 0x2a, 0x29, 0x15, 0x16, 0x02, 0x3f, 0x2a, 0x6b, 0x0f, 0x06, 0x24, 0x37, 0x6e, 0x6c, 0xa0, 0x54, 0xbf, 0x51, 0x16, 0x5b, 0xae, 0x57, 0x0f,
+    0x00, 0x01, 0x15, 0x5b, 0xc0, 0x51, 0x02, 0x8b, 0x56, 0x56, 0x53, 0x02, 0xa1, 0x54, 0xac, 0x57, 0x06, 0x12, 0xff, 0x80, 0x80, 0x5f, 0x17, 0x1f,
+    0x28, 0x61, 0x62, 0xe1, 0x44, 0x0b, 0x00, 0x06, 0x60, 0x17, 0x20, 0x28, 0x00, 0x4b, 0xc0, 0x1c, 0xe0, 0x01, 0x01, 0x08, 0x00, 0x01, 0x40, 0x32,
+    0x60, 0x1c, 0x20, 0x2d, 0xa0, 0x42, 0xa0, 0x07, 0x02, 0x01, 0x08, 0x02, 0x00, 0x18, 0x32, 0x60, 0x1c, 0xc0, 0x37, 0xa0, 0x42, 0xe0, 0x03, 0x02,
+    0x01, 0x08, 0x01, 0x02, 0x18, 0x32, 0x60, 0x1c, 0x00, 0x3c, 0xa0, 0x42, 0xe0, 0x03, 0x02, 0x08, 0x00, 0xff, 0x01, 0xe6, 0x01, 0xff, 0x02, 0xff,
+    0x03, 0xff, 0x04, 0x71, 0x04, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0x02, 0x04, 0x00, 0x00, 0x05, 0xff, 0xff, 0x62, 0x9d, 0x00, 0x00, 0x01,
+    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x60, 0x06, 0x07, 0xff, 0x80, 0x80, 0xff, 0xff, 0xff, 0xff, 0x01, 0x60, 0x01, 0x60, 0x09, 0x00,
+    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x60, 0x07, 0x00, 0x18, 0x21, 0x65, 0x62, 0x18, 0x36, 0x65, 0x1b, 0x03, 0x02, 0x06, 0x02, 0xc7,
+    0x80, 0x80, 0x9f, 0x18, 0xbf, 0x26, 0x21, 0x1b, 0x41, 0x29, 0x09, 0x00, 0x07, 0xa0, 0x18, 0xc0, 0x26, 0x80, 0x02, 0x80, 0x02, 0x06, 0x02, 0xc6,
+    0x7f, 0x80, 0x12, 0x17, 0xf8, 0x29, 0x95, 0x19, 0x7b, 0x2c, 0x09, 0x00, 0x07, 0x13, 0x17, 0xfa, 0x29, 0x80, 0x02, 0x80, 0x02, 0x06, 0x02, 0xc5,
+    0x80, 0x80, 0x95, 0x13, 0xc2, 0x2a, 0x18, 0x16, 0x48, 0x2d, 0x3a, 0x00, 0x01, 0x16, 0x16, 0x06, 0x2c, 0x03, 0x16, 0x16, 0xb6, 0x2c, 0x86, 0x15,
+    0x46, 0x2d, 0xd6, 0x14, 0x46, 0x2d, 0x03, 0x26, 0x14, 0x46, 0x2d, 0x96, 0x13, 0xb6, 0x2c, 0x96, 0x13, 0x06, 0x2c, 0x03, 0x96, 0x13, 0x56, 0x2b,
+    0x26, 0x14, 0xc6, 0x2a, 0xd6, 0x14, 0xc6, 0x2a, 0x03, 0x86, 0x15, 0xc3, 0x2a, 0x16, 0x16, 0x53, 0x2b, 0x16, 0x16, 0x06, 0x2c, 0x04, 0x06, 0x02,
+    0xc6, 0x80, 0x80, 0xc8, 0x10, 0x88, 0x28, 0x4b, 0x13, 0x0b, 0x2b, 0x09, 0x00, 0x07, 0xca, 0x10, 0x8a, 0x28, 0x80, 0x02, 0x80, 0x02, 0x06, 0x02,
+    0xc6, 0x80, 0x7f, 0xc8, 0x10, 0xf5, 0x24, 0x4b, 0x13, 0x78, 0x27, 0x09, 0x00, 0x07, 0xca, 0x10, 0xf6, 0x24, 0x80, 0x02, 0x80, 0x02, 0x06, 0x02,
+    0xc6, 0x7f, 0x80, 0x95, 0x13, 0xb8, 0x22, 0x18, 0x16, 0x3b, 0x25, 0x09, 0x00, 0x07, 0x96, 0x13, 0xba, 0x22, 0x80, 0x02, 0x80, 0x02, 0x06, 0x02,
+    0xc6, 0x7f, 0x7f, 0x12, 0x17, 0x85, 0x23, 0x95, 0x19, 0x08, 0x26, 0x09, 0x00, 0x07, 0x13, 0x17, 0x86, 0x23, 0x80, 0x02, 0x80, 0x02, 0x06, 0x03,
+    0xc7, 0x7f, 0x80, 0xd8, 0x12, 0x1b, 0x25, 0xa5, 0x18, 0xe1, 0x2a, 0x09, 0x00, 0x07, 0xda, 0x12, 0x1d, 0x25, 0xca, 0x05, 0xc3, 0x05, 0x01, 0x03,
+    0x82, 0x63, 0xe2, 0x10, 0x04, 0xe5, 0x06, 0x06, 0x03, 0xc5, 0x80, 0x80, 0x33, 0xff, 0x30, 0xff, 0xcd, 0x00, 0xd0, 0x00, 0x09, 0x00, 0x07, 0x35,
+    0xff, 0x32, 0xff, 0x96, 0x01, 0x9d, 0x01, 0x02, 0x01, 0x03, 0xf8, 0x62, 0xe2, 0x12, 0x04, 0xe5, 0x06, 0x06, 0x03, 0xc5, 0x80, 0x80, 0x33, 0xff,
+    0x30, 0xff, 0xcd, 0x00, 0xd0, 0x00, 0x09, 0x00, 0x07, 0x35, 0xff, 0x32, 0xff, 0x96, 0x01, 0x9d, 0x01, 0x02, 0x01, 0x03, 0x82, 0x61, 0x58, 0x14,
+    0x04, 0xe5, 0x06, 0x06, 0x03, 0xc5, 0x80, 0x80, 0x33, 0xff, 0x30, 0xff, 0xcd, 0x00, 0xd0, 0x00, 0x09, 0x00, 0x07, 0x35, 0xff, 0x32, 0xff, 0x96,
+    0x01, 0x9d, 0x01, 0x02, 0x01, 0x03, 0x82, 0x5f, 0xe2, 0x14, 0x04, 0xe5, 0x06, 0x06, 0x03, 0xc5, 0x80, 0x80, 0x33, 0xff, 0x30, 0xff, 0xcd, 0x00,
+    0xd0, 0x00, 0x09, 0x00, 0x07, 0x35, 0xff, 0x32, 0xff, 0x96, 0x01, 0x9d, 0x01, 0x02, 0x01, 0x03, 0x82, 0x5d, 0x58, 0x14, 0x04, 0xe5, 0x06, 0x06,
+    0x03, 0xc5, 0x80, 0x80, 0x33, 0xff, 0x30, 0xff, 0xcd, 0x00, 0xd0, 0x00, 0x09, 0x00, 0x07, 0x35, 0xff, 0x32, 0xff, 0x96, 0x01, 0x9d, 0x01, 0x02,
+    0x01, 0x03, 0x0b, 0x5c, 0xe2, 0x12, 0x04, 0xe5, 0x06, 0x06, 0x03, 0xc5, 0x80, 0x80, 0x33, 0xff, 0x30, 0xff, 0xcd, 0x00, 0xd0, 0x00, 0x09, 0x00,
+    0x07, 0x35, 0xff, 0x32, 0xff, 0x96, 0x01, 0x9d, 0x01, 0x02, 0x01, 0x03, 0x82, 0x5b, 0xe2, 0x10, 0x04, 0xe5, 0x06, 0x06, 0x03, 0xc5, 0x80, 0x80,
+    0x33, 0xff, 0x30, 0xff, 0xcd, 0x00, 0xd0, 0x00, 0x09, 0x00, 0x07, 0x35, 0xff, 0x32, 0xff, 0x96, 0x01, 0x9d, 0x01, 0x02, 0x01, 0x03, 0x0b, 0x5c,
+    0xe2, 0x0e, 0x04, 0xe5, 0x06, 0x06, 0x03, 0xc5, 0x80, 0x80, 0x33, 0xff, 0x30, 0xff, 0xcd, 0x00, 0xd0, 0x00, 0x09, 0x00, 0x07, 0x35, 0xff, 0x32,
+    0xff, 0x96, 0x01, 0x9d, 0x01, 0x02, 0x01, 0x03, 0x82, 0x5d, 0x6b, 0x0d, 0x04, 0xe5, 0x06, 0x06, 0x03, 0xc5, 0x80, 0x80, 0x33, 0xff, 0x30, 0xff,
+    0xcd, 0x00, 0xd0, 0x00, 0x09, 0x00, 0x07, 0x35, 0xff, 0x32, 0xff, 0x96, 0x01, 0x9d, 0x01, 0x02, 0x01, 0x03, 0x82, 0x5f, 0xe2, 0x0c, 0x04, 0xe5,
+    0x06, 0x06, 0x03, 0xc5, 0x80, 0x80, 0x33, 0xff, 0x30, 0xff, 0xcd, 0x00, 0xd0, 0x00, 0x09, 0x00, 0x07, 0x35, 0xff, 0x32, 0xff, 0x96, 0x01, 0x9d,
+    0x01, 0x02, 0x01, 0x03, 0x82, 0x61, 0x6b, 0x0d, 0x04, 0xe5, 0x06, 0x06, 0x03, 0xc5, 0x80, 0x80, 0x33, 0xff, 0x30, 0xff, 0xcd, 0x00, 0xd0, 0x00,
+    0x09, 0x00, 0x07, 0x35, 0xff, 0x32, 0xff, 0x96, 0x01, 0x9d, 0x01, 0x02, 0x01, 0x03, 0xf8, 0x62, 0xe2, 0x0e, 0x04, 0xe5, 0x06, 0x06, 0x03, 0xc5,
+    0x80, 0x80, 0x33, 0xff, 0x30, 0xff, 0xcd, 0x00, 0xd0, 0x00, 0x09, 0x00, 0x07, 0x35, 0xff, 0x32, 0xff, 0x96, 0x01, 0x9d, 0x01, 0x02, 0x06, 0x00,
+    0xc8, 0x7f, 0x80, 0x65, 0x5c, 0xc8, 0x0d, 0x95, 0x62, 0xf1, 0x13, 0x09, 0x00, 0x07, 0x66, 0x5c, 0xca, 0x0d, 0x2d, 0x06, 0x26, 0x06, 0x06, 0x03,
+    0xc6, 0x7f, 0x80, 0x55, 0x26, 0x12, 0x3d, 0xee, 0x28, 0xab, 0x3f, 0x3a, 0x00, 0x01, 0xed, 0x28, 0x60, 0x3e, 0x03, 0xed, 0x28, 0x16, 0x3f, 0x5a,
+    0x28, 0xaa, 0x3f, 0xa0, 0x27, 0xaa, 0x3f, 0x03, 0xea, 0x26, 0xaa, 0x3f, 0x56, 0x26, 0x16, 0x3f, 0x56, 0x26, 0x5d, 0x3e, 0x03, 0x56, 0x26, 0xa6,
+    0x3d, 0xea, 0x26, 0x13, 0x3d, 0xa3, 0x27, 0x13, 0x3d, 0x03, 0x56, 0x28, 0x13, 0x3d, 0xea, 0x28, 0xaa, 0x3d, 0xed, 0x28, 0x60, 0x3e, 0x04, 0x06,
+    0x03, 0xc6, 0x7f, 0x80, 0x75, 0x24, 0x52, 0x40, 0x0e, 0x27, 0xeb, 0x42, 0x3a, 0x00, 0x01, 0x0d, 0x27, 0xa0, 0x41, 0x03, 0x0d, 0x27, 0x56, 0x42,
+    0x7a, 0x26, 0xea, 0x42, 0xc0, 0x25, 0xea, 0x42, 0x03, 0x0a, 0x25, 0xea, 0x42, 0x76, 0x24, 0x56, 0x42, 0x76, 0x24, 0x9d, 0x41, 0x03, 0x76, 0x24,
+    0xe6, 0x40, 0x0a, 0x25, 0x53, 0x40, 0xc3, 0x25, 0x53, 0x40, 0x03, 0x76, 0x26, 0x53, 0x40, 0x0a, 0x27, 0xea, 0x40, 0x0d, 0x27, 0xa0, 0x41, 0x04,
+    0x06, 0x03, 0xc6, 0x7f, 0x80, 0xb5, 0x20, 0x52, 0x40, 0x4e, 0x23, 0xeb, 0x42, 0x3a, 0x00, 0x01, 0x4d, 0x23, 0xa0, 0x41, 0x03, 0x4d, 0x23, 0x56,
+    0x42, 0xba, 0x22, 0xea, 0x42, 0x00, 0x22, 0xea, 0x42, 0x03, 0x4a, 0x21, 0xea, 0x42, 0xb6, 0x20, 0x56, 0x42, 0xb6, 0x20, 0x9d, 0x41, 0x03, 0xb6,
+    0x20, 0xe6, 0x40, 0x4a, 0x21, 0x53, 0x40, 0x03, 0x22, 0x53, 0x40, 0x03, 0xb6, 0x22, 0x53, 0x40, 0x4a, 0x23, 0xea, 0x40, 0x4d, 0x23, 0xa0, 0x41,
+    0x04, 0x06, 0x03, 0xc6, 0x7f, 0x80, 0xd5, 0x1e, 0x12, 0x3d, 0x6e, 0x21, 0xab, 0x3f, 0x3a, 0x00, 0x01, 0x6d, 0x21, 0x60, 0x3e, 0x03, 0x6d, 0x21,
+    0x16, 0x3f, 0xda, 0x20, 0xaa, 0x3f, 0x20, 0x20, 0xaa, 0x3f, 0x03, 0x6a, 0x1f, 0xaa, 0x3f, 0xd6, 0x1e, 0x16, 0x3f, 0xd6, 0x1e, 0x5d, 0x3e, 0x03,
+    0xd6, 0x1e, 0xa6, 0x3d, 0x6a, 0x1f, 0x13, 0x3d, 0x23, 0x20, 0x13, 0x3d, 0x03, 0xd6, 0x20, 0x13, 0x3d, 0x6a, 0x21, 0xaa, 0x3d, 0x6d, 0x21, 0x60,
+    0x3e, 0x04, 0x06, 0x03, 0xc6, 0x7f, 0x80, 0xb5, 0x20, 0xd2, 0x39, 0x4e, 0x23, 0x6b, 0x3c, 0x3a, 0x00, 0x01, 0x4d, 0x23, 0x20, 0x3b, 0x03, 0x4d,
+    0x23, 0xd6, 0x3b, 0xba, 0x22, 0x6a, 0x3c, 0x00, 0x22, 0x6a, 0x3c, 0x03, 0x4a, 0x21, 0x6a, 0x3c, 0xb6, 0x20, 0xd6, 0x3b, 0xb6, 0x20, 0x1d, 0x3b,
+    0x03, 0xb6, 0x20, 0x66, 0x3a, 0x4a, 0x21, 0xd3, 0x39, 0x03, 0x22, 0xd3, 0x39, 0x03, 0xb6, 0x22, 0xd6, 0x39, 0x4a, 0x23, 0x6a, 0x3a, 0x4d, 0x23,
+    0x20, 0x3b, 0x04, 0x06, 0x03, 0xc6, 0x7f, 0x80, 0x75, 0x24, 0xd2, 0x39, 0x0e, 0x27, 0x6b, 0x3c, 0x3a, 0x00, 0x01, 0x0d, 0x27, 0x20, 0x3b, 0x03,
+    0x0d, 0x27, 0xd6, 0x3b, 0x7a, 0x26, 0x6a, 0x3c, 0xc0, 0x25, 0x6a, 0x3c, 0x03, 0x0a, 0x25, 0x6a, 0x3c, 0x76, 0x24, 0xd6, 0x3b, 0x76, 0x24, 0x1d,
+    0x3b, 0x03, 0x76, 0x24, 0x66, 0x3a, 0x0a, 0x25, 0xd3, 0x39, 0xc3, 0x25, 0xd3, 0x39, 0x03, 0x76, 0x26, 0xd6, 0x39, 0x0a, 0x27, 0x6a, 0x3a, 0x0d,
+    0x27, 0x20, 0x3b, 0x04, 0x06, 0x06, 0xc7, 0x80, 0x7f, 0x48, 0x21, 0xc8, 0x3b, 0x78, 0x26, 0xf8, 0x40, 0x09, 0x00, 0x07, 0x4a, 0x21, 0xca, 0x3b,
+    0x2d, 0x05, 0x2d, 0x05, 0x06, 0x03, 0xc6, 0x80, 0x80, 0x02, 0x50, 0x82, 0x12, 0xbe, 0x51, 0x3e, 0x14, 0x09, 0x00, 0x07, 0x03, 0x50, 0x83, 0x12,
+    0xba, 0x01, 0xba, 0x01, 0x06, 0x03, 0xc6, 0x80, 0x80, 0x85, 0x4f, 0x52, 0x14, 0x41, 0x51, 0x0e, 0x16, 0x09, 0x00, 0x07, 0x86, 0x4f, 0x53, 0x14,
+    0xba, 0x01, 0xba, 0x01, 0x06, 0x03, 0xc6, 0x80, 0x80, 0x32, 0x4e, 0xa5, 0x15, 0xee, 0x4f, 0x61, 0x17, 0x09, 0x00, 0x07, 0x33, 0x4e, 0xa6, 0x15,
+    0xba, 0x01, 0xba, 0x01, 0x06, 0x03, 0xc6, 0x80, 0x80, 0x62, 0x4c, 0x22, 0x16, 0x1e, 0x4e, 0xde, 0x17, 0x09, 0x00, 0x07, 0x63, 0x4c, 0x23, 0x16,
+    0xba, 0x01, 0xba, 0x01, 0x06, 0x03, 0xc6, 0x80, 0x80, 0x92, 0x4a, 0xa5, 0x15, 0x4e, 0x4c, 0x61, 0x17, 0x09, 0x00, 0x07, 0x93, 0x4a, 0xa6, 0x15,
+    0xba, 0x01, 0xba, 0x01, 0x06, 0x03, 0xc6, 0x7f, 0x80, 0x3f, 0x49, 0x52, 0x14, 0xfb, 0x4a, 0x0e, 0x16, 0x09, 0x00, 0x07, 0x40, 0x49, 0x53, 0x14,
+    0xba, 0x01, 0xba, 0x01, 0x06, 0x03, 0xc6, 0x80, 0x80, 0xc2, 0x48, 0x82, 0x12, 0x7e, 0x4a, 0x3e, 0x14, 0x09, 0x00, 0x07, 0xc3, 0x48, 0x83, 0x12,
+    0xba, 0x01, 0xba, 0x01, 0x06, 0x03, 0xc6, 0x7f, 0x80, 0x3f, 0x49, 0xb2, 0x10, 0xfb, 0x4a, 0x6e, 0x12, 0x09, 0x00, 0x07, 0x40, 0x49, 0xb3, 0x10,
+    0xba, 0x01, 0xba, 0x01, 0x06, 0x03, 0xc6, 0x80, 0x7f, 0x92, 0x4a, 0x5f, 0x0f, 0x4e, 0x4c, 0x1b, 0x11, 0x09, 0x00, 0x07, 0x93, 0x4a, 0x60, 0x0f,
+    0xba, 0x01, 0xba, 0x01, 0x06, 0x03, 0xc6, 0x80, 0x7f, 0x62, 0x4c, 0xe2, 0x0e, 0x1e, 0x4e, 0x9e, 0x10, 0x09, 0x00, 0x07, 0x63, 0x4c, 0xe3, 0x0e,
+    0xba, 0x01, 0xba, 0x01, 0x06, 0x03, 0xc6, 0x80, 0x7f, 0x32, 0x4e, 0x5f, 0x0f, 0xee, 0x4f, 0x1b, 0x11, 0x09, 0x00, 0x07, 0x33, 0x4e, 0x60, 0x0f,
+    0xba, 0x01, 0xba, 0x01, 0x06, 0x03, 0xc6, 0x80, 0x80, 0x85, 0x4f, 0xb2, 0x10, 0x41, 0x51, 0x6e, 0x12, 0x09, 0x00, 0x07, 0x86, 0x4f, 0xb3, 0x10,
+    0xba, 0x01, 0xba, 0x01, 0x06, 0x04, 0xc8, 0x80, 0x80, 0xe8, 0x49, 0x0b, 0x10, 0x9b, 0x50, 0xb8, 0x16, 0x09, 0x00, 0x07, 0xea, 0x49, 0x0d, 0x10,
+    0xb0, 0x06, 0xaa, 0x06, 0x06, 0x02, 0xc7, 0x7f, 0x80, 0x8f, 0x56, 0x72, 0x22, 0xee, 0x58, 0xd1, 0x24, 0x09, 0x00, 0x07, 0x90, 0x56, 0x73, 0x22,
+    0x5d, 0x02, 0x5d, 0x02, 0x06, 0x02, 0xc7, 0x80, 0x80, 0xf2, 0x55, 0x8b, 0x24, 0x51, 0x58, 0xeb, 0x26, 0x09, 0x00, 0x07, 0xf3, 0x55, 0x8d, 0x24,
+    0x5d, 0x02, 0x5d, 0x02, 0x06, 0x02, 0xc6, 0x7f, 0x7f, 0x4f, 0x54, 0xf8, 0x25, 0xab, 0x56, 0x55, 0x28, 0x09, 0x00, 0x07, 0x50, 0x54, 0xfa, 0x25,
+    0x5a, 0x02, 0x5a, 0x02, 0x06, 0x02, 0xc5, 0x80, 0x80, 0x25, 0x52, 0x45, 0x26, 0x81, 0x54, 0xa5, 0x28, 0x3a, 0x00, 0x01, 0x80, 0x54, 0x76, 0x27,
+    0x03, 0x80, 0x54, 0x1d, 0x28, 0xfa, 0x53, 0xa3, 0x28, 0x53, 0x53, 0xa3, 0x28, 0x03, 0xad, 0x52, 0xa3, 0x28, 0x26, 0x52, 0x1d, 0x28, 0x26, 0x52,
+    0x76, 0x27, 0x03, 0x26, 0x52, 0xd0, 0x26, 0xad, 0x52, 0x4a, 0x26, 0x53, 0x53, 0x4a, 0x26, 0x03, 0xfa, 0x53, 0x46, 0x26, 0x80, 0x54, 0xd0, 0x26,
+    0x80, 0x54, 0x76, 0x27, 0x04, 0x06, 0x02, 0xc6, 0x7f, 0x7f, 0x28, 0x50, 0x5f, 0x25, 0x85, 0x52, 0xbb, 0x27, 0x09, 0x00, 0x07, 0x2a, 0x50, 0x60,
+    0x25, 0x5a, 0x02, 0x5a, 0x02, 0x06, 0x02, 0xc6, 0x80, 0x7f, 0xfb, 0x4e, 0x88, 0x23, 0x58, 0x51, 0xe5, 0x25, 0x09, 0x00, 0x07, 0xfd, 0x4e, 0x8a,
+    0x23, 0x5a, 0x02, 0x5a, 0x02, 0x06, 0x02, 0xc5, 0x80, 0x80, 0xfb, 0x4e, 0x58, 0x21, 0x58, 0x51, 0xb8, 0x23, 0x3a, 0x00, 0x01, 0x56, 0x51, 0x8a,
+    0x22, 0x03, 0x56, 0x51, 0x30, 0x23, 0xd0, 0x50, 0xb6, 0x23, 0x2a, 0x50, 0xb6, 0x23, 0x03, 0x83, 0x4f, 0xb6, 0x23, 0xfd, 0x4e, 0x30, 0x23, 0xfd,
+    0x4e, 0x8a, 0x22, 0x03, 0xfd, 0x4e, 0xe3, 0x21, 0x83, 0x4f, 0x5d, 0x21, 0x2a, 0x50, 0x5d, 0x21, 0x03, 0xd0, 0x50, 0x5a, 0x21, 0x56, 0x51, 0xe3,
+    0x21, 0x56, 0x51, 0x8a, 0x22, 0x04, 0x06, 0x02, 0xc5, 0x80, 0x80, 0x28, 0x50, 0x82, 0x1f, 0x85, 0x52, 0xe1, 0x21, 0x3a, 0x00, 0x01, 0x83, 0x52,
+    0xb3, 0x20, 0x03, 0x83, 0x52, 0x5a, 0x21, 0xfd, 0x51, 0xe0, 0x21, 0x56, 0x51, 0xe0, 0x21, 0x03, 0xb0, 0x50, 0xe0, 0x21, 0x2a, 0x50, 0x5a, 0x21,
+    0x2a, 0x50, 0xb3, 0x20, 0x03, 0x2a, 0x50, 0x0d, 0x20, 0xb0, 0x50, 0x86, 0x1f, 0x56, 0x51, 0x86, 0x1f, 0x03, 0xfd, 0x51, 0x83, 0x1f, 0x83, 0x52,
+    0x0d, 0x20, 0x83, 0x52, 0xb3, 0x20, 0x04, 0x06, 0x02, 0xc6, 0x80, 0x80, 0x25, 0x52, 0x9b, 0x1e, 0x81, 0x54, 0xf8, 0x20, 0x09, 0x00, 0x07, 0x26,
+    0x52, 0x9d, 0x1e, 0x5a, 0x02, 0x5a, 0x02, 0x06, 0x02, 0xc6, 0x7f, 0x80, 0x4f, 0x54, 0xeb, 0x1e, 0xab, 0x56, 0x48, 0x21, 0x09, 0x00, 0x07, 0x50,
+    0x54, 0xed, 0x1e, 0x5a, 0x02, 0x5a, 0x02, 0x06, 0x02, 0xc7, 0x80, 0x80, 0xf2, 0x55, 0x58, 0x20, 0x51, 0x58, 0xb8, 0x22, 0x09, 0x00, 0x07, 0xf3,
+    0x55, 0x5a, 0x20, 0x5d, 0x02, 0x5d, 0x02, 0x06, 0x03, 0xc8, 0x80, 0x80, 0xaf, 0x4f, 0x6f, 0x1f, 0x11, 0x58, 0xd1, 0x27, 0x09, 0x00, 0x07, 0xb0,
+    0x4f, 0x70, 0x1f, 0x60, 0x08, 0x60, 0x08, 0x06, 0x00, 0xc5, 0x80, 0x80, 0x3b, 0x5c, 0x3b, 0x21, 0x05, 0x5e, 0x05, 0x23, 0x09, 0x00, 0x07, 0x3d,
+    0x5c, 0x3d, 0x21, 0xc6, 0x01, 0xc6, 0x01, 0x06, 0x00, 0xc6, 0x80, 0x7f, 0x85, 0x5b, 0xb2, 0x22, 0x4e, 0x5d, 0x7b, 0x24, 0x09, 0x00, 0x07, 0x86,
+    0x5b, 0xb3, 0x22, 0xc6, 0x01, 0xc6, 0x01, 0x06, 0x00, 0xc6, 0x7f, 0x7f, 0xf2, 0x59, 0x0f, 0x23, 0xbb, 0x5b, 0xd8, 0x24, 0x09, 0x00, 0x07, 0xf3,
+    0x59, 0x10, 0x23, 0xc6, 0x01, 0xc6, 0x01, 0x06, 0x00, 0xc5, 0x80, 0x80, 0xab, 0x58, 0x0b, 0x22, 0x75, 0x5a, 0xd5, 0x23, 0x09, 0x00, 0x07, 0xad,
+    0x58, 0x0d, 0x22, 0xc6, 0x01, 0xc6, 0x01, 0x06, 0x00, 0xc5, 0x80, 0x80, 0xab, 0x58, 0x6b, 0x20, 0x75, 0x5a, 0x35, 0x22, 0x09, 0x00, 0x07, 0xad,
+    0x58, 0x6d, 0x20, 0xc6, 0x01, 0xc6, 0x01, 0x06, 0x00, 0xc6, 0x7f, 0x80, 0xf2, 0x59, 0x68, 0x1f, 0xbb, 0x5b, 0x31, 0x21, 0x09, 0x00, 0x07, 0xf3,
+    0x59, 0x6a, 0x1f, 0xc6, 0x01, 0xc6, 0x01, 0x06, 0x00, 0xc6, 0x80, 0x80, 0x85, 0x5b, 0xc5, 0x1f, 0x4e, 0x5d, 0x8e, 0x21, 0x09, 0x00, 0x07, 0x86,
+    0x5b, 0xc6, 0x1f, 0xc6, 0x01, 0xc6, 0x01, 0x06, 0x03, 0xc7, 0x7f, 0x7f, 0x30, 0x59, 0x12, 0x20, 0x4d, 0x5d, 0x2b, 0x24, 0x09, 0x00, 0x07, 0x32,
+    0x59, 0x13, 0x20, 0x1a, 0x04, 0x16, 0x04, 0x06, 0x04, 0xc5, 0x80, 0x80, 0x68, 0x1f, 0xa8, 0x3b, 0x18, 0x21, 0x58, 0x3d, 0x09, 0x00, 0x07, 0x6a,
+    0x1f, 0xaa, 0x3b, 0xad, 0x01, 0xad, 0x01, 0x06, 0x04, 0xc5, 0x80, 0x80, 0xdb, 0x1e, 0x58, 0x3d, 0x8b, 0x20, 0x08, 0x3f, 0x09, 0x00, 0x07, 0xdd,
+    0x1e, 0x5a, 0x3d, 0xad, 0x01, 0xad, 0x01, 0x06, 0x04, 0xc5, 0x80, 0x7f, 0x6b, 0x1d, 0x65, 0x3e, 0x1b, 0x1f, 0x15, 0x40, 0x09, 0x00, 0x07, 0x6d,
+    0x1d, 0x66, 0x3e, 0xad, 0x01, 0xad, 0x01, 0x06, 0x04, 0xc5, 0x7f, 0x7f, 0xa5, 0x1b, 0x65, 0x3e, 0x55, 0x1d, 0x15, 0x40, 0x09, 0x00, 0x07, 0xa6,
+    0x1b, 0x66, 0x3e, 0xad, 0x01, 0xad, 0x01, 0x06, 0x04, 0xc5, 0x7f, 0x80, 0x35, 0x1a, 0x58, 0x3d, 0xe5, 0x1b, 0x08, 0x3f, 0x09, 0x00, 0x07, 0x36,
+    0x1a, 0x5a, 0x3d, 0xad, 0x01, 0xad, 0x01, 0x06, 0x04, 0xc5, 0x80, 0x80, 0xa8, 0x19, 0xa8, 0x3b, 0x58, 0x1b, 0x58, 0x3d, 0x09, 0x00, 0x07, 0xaa,
+    0x19, 0xaa, 0x3b, 0xad, 0x01, 0xad, 0x01, 0x06, 0x04, 0xc5, 0x7f, 0x7f, 0x35, 0x1a, 0xf8, 0x39, 0xe5, 0x1b, 0xa8, 0x3b, 0x09, 0x00, 0x07, 0x36,
+    0x1a, 0xfa, 0x39, 0xad, 0x01, 0xad, 0x01, 0x06, 0x04, 0xc5, 0x7f, 0x80, 0xa5, 0x1b, 0xeb, 0x38, 0x55, 0x1d, 0x9b, 0x3a, 0x3a, 0x00, 0x01, 0x53,
+    0x1d, 0xc3, 0x39, 0x03, 0x53, 0x1d, 0x3a, 0x3a, 0xf3, 0x1c, 0x9a, 0x3a, 0x7d, 0x1c, 0x9a, 0x3a, 0x03, 0x06, 0x1c, 0x9a, 0x3a, 0xa6, 0x1b, 0x3a,
+    0x3a, 0xa6, 0x1b, 0xc3, 0x39, 0x03, 0xa6, 0x1b, 0x4d, 0x39, 0x06, 0x1c, 0xed, 0x38, 0x7d, 0x1c, 0xed, 0x38, 0x03, 0xf3, 0x1c, 0xf0, 0x38, 0x53,
+    0x1d, 0x4d, 0x39, 0x53, 0x1d, 0xc3, 0x39, 0x04, 0x06, 0x04, 0xc5, 0x80, 0x80, 0x6b, 0x1d, 0xeb, 0x38, 0x1b, 0x1f, 0x9b, 0x3a, 0x3a, 0x00, 0x01,
+    0x1a, 0x1f, 0xc3, 0x39, 0x03, 0x1a, 0x1f, 0x3a, 0x3a, 0xba, 0x1e, 0x9a, 0x3a, 0x43, 0x1e, 0x9a, 0x3a, 0x03, 0xcd, 0x1d, 0x9a, 0x3a, 0x6d, 0x1d,
+    0x3a, 0x3a, 0x6d, 0x1d, 0xc3, 0x39, 0x03, 0x6d, 0x1d, 0x4d, 0x39, 0xcd, 0x1d, 0xed, 0x38, 0x43, 0x1e, 0xed, 0x38, 0x03, 0xba, 0x1e, 0xf0, 0x38,
+    0x1a, 0x1f, 0x4d, 0x39, 0x1a, 0x1f, 0xc3, 0x39, 0x04, 0x06, 0x04, 0xc5, 0x80, 0x7f, 0xdb, 0x1e, 0xf8, 0x39, 0x8b, 0x20, 0xa8, 0x3b, 0x09, 0x00,
+    0x07, 0xdd, 0x1e, 0xfa, 0x39, 0xad, 0x01, 0xad, 0x01, 0x06, 0x02, 0xc8, 0x7f, 0x80, 0xaa, 0x1a, 0xcd, 0x39, 0x16, 0x20, 0x33, 0x3f, 0x09, 0x00,
+    0x07, 0xab, 0x1a, 0xce, 0x39, 0x6a, 0x05, 0x63, 0x05, 0x06, 0x02, 0xc7, 0x80, 0x80, 0x92, 0x21, 0xf2, 0x28, 0xae, 0x23, 0x0e, 0x2b, 0x09, 0x00,
+    0x07, 0x93, 0x21, 0xf3, 0x28, 0x1a, 0x02, 0x1a, 0x02, 0x06, 0x02, 0xc5, 0x80, 0x80, 0x35, 0x20, 0xc5, 0x2b, 0x51, 0x22, 0xe5, 0x2d, 0x3a, 0x00,
+    0x01, 0x50, 0x22, 0xd6, 0x2c, 0x03, 0x50, 0x22, 0x6d, 0x2d, 0xd6, 0x21, 0xe3, 0x2d, 0x43, 0x21, 0xe3, 0x2d, 0x03, 0xad, 0x20, 0xe3, 0x2d, 0x36,
+    0x20, 0x6a, 0x2d, 0x36, 0x20, 0xd6, 0x2c, 0x03, 0x36, 0x20, 0x40, 0x2c, 0xb0, 0x20, 0xca, 0x2b, 0x43, 0x21, 0xca, 0x2b, 0x03, 0xd6, 0x21, 0xc6,
+    0x2b, 0x50, 0x22, 0x40, 0x2c, 0x50, 0x22, 0xd6, 0x2c, 0x04, 0x06, 0x02, 0xc5, 0x80, 0x80, 0x25, 0x1d, 0x78, 0x2c, 0x41, 0x1f, 0x98, 0x2e, 0x3a,
+    0x00, 0x01, 0x40, 0x1f, 0x8a, 0x2d, 0x03, 0x40, 0x1f, 0x20, 0x2e, 0xc6, 0x1e, 0x96, 0x2e, 0x33, 0x1e, 0x96, 0x2e, 0x03, 0x9d, 0x1d, 0x96, 0x2e,
+    0x26, 0x1d, 0x1d, 0x2e, 0x26, 0x1d, 0x8a, 0x2d, 0x03, 0x26, 0x1d, 0xf3, 0x2c, 0xa0, 0x1d, 0x7d, 0x2c, 0x33, 0x1e, 0x7d, 0x2c, 0x03, 0xc6, 0x1e,
+    0x7a, 0x2c, 0x40, 0x1f, 0xf3, 0x2c, 0x40, 0x1f, 0x8a, 0x2d, 0x04, 0x06, 0x02, 0xc7, 0x7f, 0x80, 0xaf, 0x1a, 0x85, 0x2a, 0xcb, 0x1c, 0xa1, 0x2c,
+    0x09, 0x00, 0x07, 0xb0, 0x1a, 0x86, 0x2a, 0x1a, 0x02, 0x1a, 0x02, 0x06, 0x02, 0xc7, 0x7f, 0x7f, 0xaf, 0x1a, 0x5f, 0x27, 0xcb, 0x1c, 0x7b, 0x29,
+    0x09, 0x00, 0x07, 0xb0, 0x1a, 0x60, 0x27, 0x1a, 0x02, 0x1a, 0x02, 0x06, 0x02, 0xc6, 0x80, 0x7f, 0x25, 0x1d, 0x68, 0x25, 0x41, 0x1f, 0x85, 0x27,
+    0x09, 0x00, 0x07, 0x26, 0x1d, 0x6a, 0x25, 0x1a, 0x02, 0x1a, 0x02, 0x06, 0x02, 0xc6, 0x80, 0x80, 0x35, 0x20, 0x1b, 0x26, 0x51, 0x22, 0x38, 0x28,
+    0x09, 0x00, 0x07, 0x36, 0x20, 0x1d, 0x26, 0x1a, 0x02, 0x1a, 0x02, 0x06, 0x00, 0xc8, 0x80, 0x80, 0x92, 0x1c, 0x92, 0x27, 0x6e, 0x21, 0x6e, 0x2c,
+    0x09, 0x00, 0x07, 0x93, 0x1c, 0x93, 0x27, 0xda, 0x04, 0xda, 0x04, 0x06, 0x02, 0xc7, 0x80, 0x80, 0x9b, 0x1d, 0x1b, 0x4b, 0x28, 0x21, 0xa8, 0x4e,
+    0x09, 0x00, 0x07, 0x9d, 0x1d, 0x1d, 0x4b, 0x8a, 0x03, 0x8a, 0x03, 0x06, 0x02, 0xc7, 0x80, 0x80, 0xf8, 0x1b, 0xeb, 0x4d, 0x8b, 0x1f, 0x78, 0x51,
+    0x09, 0x00, 0x07, 0xfa, 0x1b, 0xed, 0x4d, 0x90, 0x03, 0x8a, 0x03, 0x06, 0x02, 0xc7, 0x80, 0x80, 0xb8, 0x18, 0xeb, 0x4d, 0x4b, 0x1c, 0x78, 0x51,
+    0x09, 0x00, 0x07, 0xba, 0x18, 0xed, 0x4d, 0x90, 0x03, 0x8a, 0x03, 0x06, 0x02, 0xc7, 0x80, 0x80, 0x18, 0x17, 0x1b, 0x4b, 0xab, 0x1a, 0xa8, 0x4e,
+    0x09, 0x00, 0x07, 0x1a, 0x17, 0x1d, 0x4b, 0x90, 0x03, 0x8a, 0x03, 0x06, 0x02, 0xc7, 0x80, 0x80, 0xb8, 0x18, 0x4b, 0x48, 0x4b, 0x1c, 0xd8, 0x4b,
+    0x09, 0x00, 0x07, 0xba, 0x18, 0x4d, 0x48, 0x90, 0x03, 0x8a, 0x03, 0x06, 0x02, 0xc7, 0x80, 0x80, 0xf8, 0x1b, 0x4b, 0x48, 0x8b, 0x1f, 0xd8, 0x4b,
+    0x09, 0x00, 0x07, 0xfa, 0x1b, 0x4d, 0x48, 0x90, 0x03, 0x8a, 0x03, 0x06, 0x00, 0xc8, 0x80, 0x80, 0x95, 0x18, 0x55, 0x49, 0xab, 0x1f, 0x6b, 0x50,
+    0x09, 0x00, 0x07, 0x96, 0x18, 0x56, 0x49, 0x13, 0x07, 0x13, 0x07, 0x01, 0x03, 0x42, 0x10, 0xc2, 0x22, 0x04, 0xe5, 0x06, 0x06, 0x00, 0xc5, 0x80,
+    0x80, 0x33, 0xff, 0x30, 0xff, 0xcd, 0x00, 0xd0, 0x00, 0x09, 0x00, 0x07, 0x35, 0xff, 0x32, 0xff, 0x96, 0x01, 0x9d, 0x01, 0x02, 0x01, 0x03, 0x38,
+    0x0f, 0xe8, 0x24, 0x04, 0xe5, 0x06, 0x06, 0x00, 0xc5, 0x80, 0x80, 0x33, 0xff, 0x30, 0xff, 0xcd, 0x00, 0xd0, 0x00, 0x09, 0x00, 0x07, 0x35, 0xff,
+    0x32, 0xff, 0x96, 0x01, 0x9d, 0x01, 0x02, 0x06, 0x00, 0xc5, 0x80, 0x80, 0x15, 0x0c, 0x9f, 0x24, 0xb1, 0x0d, 0x3b, 0x26, 0x3a, 0x00, 0x01, 0xb0,
+    0x0d, 0x6d, 0x25, 0x03, 0xb0, 0x0d, 0xdd, 0x25, 0x53, 0x0d, 0x3a, 0x26, 0xe3, 0x0c, 0x3a, 0x26, 0x03, 0x73, 0x0c, 0x3a, 0x26, 0x16, 0x0c, 0xdd,
+    0x25, 0x16, 0x0c, 0x6d, 0x25, 0x03, 0x16, 0x0c, 0xfd, 0x24, 0x73, 0x0c, 0xa0, 0x24, 0xe3, 0x0c, 0xa0, 0x24, 0x03, 0x53, 0x0d, 0xa3, 0x24, 0xb0,
+    0x0d, 0xfd, 0x24, 0xb0, 0x0d, 0x6d, 0x25, 0x04, 0x06, 0x00, 0xc4, 0x7f, 0x80, 0x38, 0x0a, 0x22, 0x23, 0xd5, 0x0b, 0xbe, 0x24, 0x3a, 0x00, 0x01,
+    0xd3, 0x0b, 0xf0, 0x23, 0x03, 0xd3, 0x0b, 0x60, 0x24, 0x76, 0x0b, 0xbd, 0x24, 0x06, 0x0b, 0xbd, 0x24, 0x03, 0x96, 0x0a, 0xbd, 0x24, 0x3a, 0x0a,
+    0x60, 0x24, 0x3a, 0x0a, 0xf0, 0x23, 0x03, 0x3a, 0x0a, 0x80, 0x23, 0x96, 0x0a, 0x23, 0x23, 0x06, 0x0b, 0x23, 0x23, 0x03, 0x76, 0x0b, 0x26, 0x23,
+    0xd3, 0x0b, 0x80, 0x23, 0xd3, 0x0b, 0xf0, 0x23, 0x04, 0x01, 0x03, 0x08, 0x0b, 0x92, 0x21, 0x04, 0xe5, 0x06, 0x06, 0x00, 0xc5, 0x80, 0x80, 0x33,
+    0xff, 0x30, 0xff, 0xcd, 0x00, 0xd0, 0x00, 0x09, 0x00, 0x07, 0x35, 0xff, 0x32, 0xff, 0x96, 0x01, 0x9d, 0x01, 0x02, 0x01, 0x03, 0xe5, 0x0c, 0x15,
+    0x20, 0x04, 0xe5, 0x06, 0x06, 0x00, 0xc5, 0x80, 0x80, 0x33, 0xff, 0x30, 0xff, 0xcd, 0x00, 0xd0, 0x00, 0x09, 0x00, 0x07, 0x35, 0xff, 0x32, 0xff,
+    0x96, 0x01, 0x9d, 0x01, 0x02, 0x01, 0x03, 0x38, 0x0f, 0x9b, 0x20, 0x04, 0xe5, 0x06, 0x06, 0x00, 0xc5, 0x80, 0x80, 0x33, 0xff, 0x30, 0xff, 0xcd,
+    0x00, 0xd0, 0x00, 0x09, 0x00, 0x07, 0x35, 0xff, 0x32, 0xff, 0x96, 0x01, 0x9d, 0x01, 0x02, 0x06, 0x03, 0xc7, 0x80, 0x80, 0xa8, 0x0b, 0xe8, 0x20,
+    0x58, 0x0f, 0x98, 0x24, 0x09, 0x00, 0x07, 0xaa, 0x0b, 0xea, 0x20, 0xad, 0x03, 0xad, 0x03, 0x06, 0x06, 0xc2, 0x80, 0x80, 0x18, 0x26, 0xf8, 0x26,
+    0xe8, 0x26, 0xc8, 0x27, 0x09, 0x00, 0x07, 0x1a, 0x26, 0xfa, 0x26, 0xcd, 0x00, 0xcd, 0x00, 0x06, 0x06, 0xc3, 0x7f, 0x80, 0xdf, 0x25, 0xb5, 0x27,
+    0xae, 0x26, 0x85, 0x28, 0x3a, 0x00, 0x01, 0xad, 0x26, 0x1d, 0x28, 0x03, 0xad, 0x26, 0x53, 0x28, 0x80, 0x26, 0x83, 0x28, 0x46, 0x26, 0x83, 0x28,
+    0x03, 0x0d, 0x26, 0x83, 0x28, 0xe0, 0x25, 0x56, 0x28, 0xe0, 0x25, 0x1d, 0x28, 0x03, 0xe0, 0x25, 0xe3, 0x27, 0x0d, 0x26, 0xb6, 0x27, 0x46, 0x26,
+    0xb6, 0x27, 0x03, 0x80, 0x26, 0xba, 0x27, 0xad, 0x26, 0xe6, 0x27, 0xad, 0x26, 0x1d, 0x28, 0x04, 0x06, 0x06, 0xc2, 0x80, 0x80, 0x48, 0x25, 0x38,
+    0x28, 0x18, 0x26, 0x08, 0x29, 0x09, 0x00, 0x07, 0x4a, 0x25, 0x3a, 0x28, 0xcd, 0x00, 0xcd, 0x00, 0x01, 0x03, 0xed, 0x24, 0xbd, 0x28, 0x04, 0xc7,
+    0x06, 0x06, 0x06, 0xc2, 0x80, 0x80, 0x98, 0xff, 0x98, 0xff, 0x68, 0x00, 0x68, 0x00, 0x09, 0x00, 0x07, 0x9a, 0xff, 0x9a, 0xff, 0xcd, 0x00, 0xcd,
+    0x00, 0x02, 0x06, 0x06, 0xc2, 0x7f, 0x80, 0xd2, 0x23, 0x02, 0x28, 0xa1, 0x24, 0xd1, 0x28, 0x3a, 0x00, 0x01, 0xa0, 0x24, 0x6a, 0x28, 0x03, 0xa0,
+    0x24, 0xa0, 0x28, 0x73, 0x24, 0xd0, 0x28, 0x3a, 0x24, 0xd0, 0x28, 0x03, 0x03, 0x24, 0xd0, 0x28, 0xd3, 0x23, 0xa3, 0x28, 0xd3, 0x23, 0x6a, 0x28,
+    0x03, 0xd3, 0x23, 0x33, 0x28, 0x00, 0x24, 0x03, 0x28, 0x3a, 0x24, 0x03, 0x28, 0x03, 0x70, 0x24, 0x06, 0x28, 0xa0, 0x24, 0x33, 0x28, 0xa0, 0x24,
+    0x6a, 0x28, 0x04, 0x06, 0x06, 0xc2, 0x7f, 0x80, 0x65, 0x23, 0x5b, 0x27, 0x35, 0x24, 0x2b, 0x28, 0x09, 0x00, 0x07, 0x66, 0x23, 0x5d, 0x27, 0xcd,
+    0x00, 0xcd, 0x00, 0x06, 0x06, 0xc2, 0x7f, 0x7f, 0x65, 0x23, 0x95, 0x26, 0x35, 0x24, 0x65, 0x27, 0x09, 0x00, 0x07, 0x66, 0x23, 0x96, 0x26, 0xcd,
+    0x00, 0xcd, 0x00, 0x06, 0x06, 0xc4, 0x80, 0x7f, 0xd2, 0x23, 0xef, 0x25, 0xa1, 0x24, 0xbe, 0x26, 0x09, 0x00, 0x07, 0xd3, 0x23, 0xf0, 0x25, 0xcd,
+    0x00, 0xcd, 0x00, 0x06, 0x06, 0xc2, 0x7f, 0x80, 0x85, 0x24, 0x9b, 0x25, 0x55, 0x25, 0x6b, 0x26, 0x3a, 0x00, 0x01, 0x53, 0x25, 0x03, 0x26, 0x03,
+    0x53, 0x25, 0x3a, 0x26, 0x26, 0x25, 0x6a, 0x26, 0xed, 0x24, 0x6a, 0x26, 0x03, 0xb3, 0x24, 0x6a, 0x26, 0x86, 0x24, 0x3d, 0x26, 0x86, 0x24, 0x03,
+    0x26, 0x03, 0x86, 0x24, 0xca, 0x25, 0xb3, 0x24, 0x9d, 0x25, 0xed, 0x24, 0x9d, 0x25, 0x03, 0x26, 0x25, 0xa0, 0x25, 0x53, 0x25, 0xcd, 0x25, 0x53,
+    0x25, 0x03, 0x26, 0x04, 0x06, 0x06, 0xc2, 0x80, 0x80, 0x48, 0x25, 0xb8, 0x25, 0x18, 0x26, 0x88, 0x26, 0x09, 0x00, 0x07, 0x4a, 0x25, 0xba, 0x25,
+    0xcd, 0x00, 0xcd, 0x00, 0x01, 0x03, 0x46, 0x26, 0xa3, 0x26, 0x04, 0xc7, 0x06, 0x06, 0x06, 0xc2, 0x80, 0x80, 0x98, 0xff, 0x98, 0xff, 0x68, 0x00,
+    0x68, 0x00, 0x09, 0x00, 0x07, 0x9a, 0xff, 0x9a, 0xff, 0xcd, 0x00, 0xcd, 0x00, 0x02, 0x06, 0x03, 0xc7, 0x80, 0x80, 0xb8, 0x23, 0xf8, 0x25, 0x88,
+    0x26, 0xc8, 0x28, 0x09, 0x00, 0x07, 0xba, 0x23, 0xfa, 0x25, 0xcd, 0x02, 0xcd, 0x02, 0x06, 0x02, 0xc7, 0x80, 0x80, 0xbf, 0x19, 0x5f, 0x1f, 0x01,
+    0x1c, 0xa1, 0x21, 0x09, 0x00, 0x07, 0xc0, 0x19, 0x60, 0x1f, 0x40, 0x02, 0x40, 0x02, 0x06, 0x02, 0xc6, 0x80, 0x80, 0x0b, 0x19, 0x7f, 0x21, 0x4e,
+    0x1b, 0xc1, 0x23, 0x3a, 0x00, 0x01, 0x4d, 0x1b, 0xa0, 0x22, 0x03, 0x4d, 0x1b, 0x3d, 0x23, 0xcd, 0x1a, 0xc0, 0x23, 0x2d, 0x1a, 0xc0, 0x23, 0x03,
+    0x90, 0x19, 0xc0, 0x23, 0x0d, 0x19, 0x40, 0x23, 0x0d, 0x19, 0xa0, 0x22, 0x03, 0x0d, 0x19, 0x03, 0x22, 0x8d, 0x19, 0x80, 0x21, 0x2d, 0x1a, 0x80,
+    0x21, 0x03, 0xcd, 0x1a, 0x83, 0x21, 0x4d, 0x1b, 0x03, 0x22, 0x4d, 0x1b, 0xa0, 0x22, 0x04, 0x06, 0x02, 0xc6, 0x80, 0x7f, 0x3b, 0x17, 0xd2, 0x22,
+    0x7e, 0x19, 0x15, 0x25, 0x09, 0x00, 0x07, 0x3d, 0x17, 0xd3, 0x22, 0x40, 0x02, 0x40, 0x02, 0x06, 0x02, 0xc7, 0x80, 0x7f, 0xff, 0x14, 0xd2, 0x22,
+    0x41, 0x17, 0x15, 0x25, 0x09, 0x00, 0x07, 0x00, 0x15, 0xd3, 0x22, 0x40, 0x02, 0x40, 0x02, 0x06, 0x02, 0xc6, 0x7f, 0x80, 0x2f, 0x13, 0x7f, 0x21,
+    0x71, 0x15, 0xc1, 0x23, 0x3a, 0x00, 0x01, 0x70, 0x15, 0xa0, 0x22, 0x03, 0x70, 0x15, 0x3d, 0x23, 0xf0, 0x14, 0xc0, 0x23, 0x50, 0x14, 0xc0, 0x23,
+    0x03, 0xb0, 0x13, 0xc0, 0x23, 0x30, 0x13, 0x40, 0x23, 0x30, 0x13, 0xa0, 0x22, 0x03, 0x30, 0x13, 0x03, 0x22, 0xb0, 0x13, 0x80, 0x21, 0x50, 0x14,
+    0x80, 0x21, 0x03, 0xf0, 0x14, 0x83, 0x21, 0x70, 0x15, 0x03, 0x22, 0x70, 0x15, 0xa0, 0x22, 0x04, 0x06, 0x02, 0xc7, 0x80, 0x80, 0x7f, 0x12, 0x5f,
+    0x1f, 0xc1, 0x14, 0xa1, 0x21, 0x09, 0x00, 0x07, 0x80, 0x12, 0x60, 0x1f, 0x40, 0x02, 0x40, 0x02, 0x06, 0x02, 0xc7, 0x80, 0x80, 0x2f, 0x13, 0x3f,
+    0x1d, 0x71, 0x15, 0x81, 0x1f, 0x09, 0x00, 0x07, 0x30, 0x13, 0x40, 0x1d, 0x40, 0x02, 0x40, 0x02, 0x06, 0x02, 0xc6, 0x7f, 0x80, 0xff, 0x14, 0xeb,
+    0x1b, 0x41, 0x17, 0x2e, 0x1e, 0x3a, 0x00, 0x01, 0x40, 0x17, 0x0d, 0x1d, 0x03, 0x40, 0x17, 0xaa, 0x1d, 0xc0, 0x16, 0x2d, 0x1e, 0x20, 0x16, 0x2d,
+    0x1e, 0x03, 0x83, 0x15, 0x2d, 0x1e, 0x00, 0x15, 0xad, 0x1d, 0x00, 0x15, 0x0d, 0x1d, 0x03, 0x00, 0x15, 0x6d, 0x1c, 0x80, 0x15, 0xed, 0x1b, 0x20,
+    0x16, 0xed, 0x1b, 0x03, 0xc0, 0x16, 0xf0, 0x1b, 0x40, 0x17, 0x70, 0x1c, 0x40, 0x17, 0x0d, 0x1d, 0x04, 0x06, 0x02, 0xc5, 0x80, 0x80, 0x3b, 0x17,
+    0xeb, 0x1b, 0x7e, 0x19, 0x2e, 0x1e, 0x3a, 0x00, 0x01, 0x7d, 0x19, 0x0d, 0x1d, 0x03, 0x7d, 0x19, 0xaa, 0x1d, 0xfd, 0x18, 0x2d, 0x1e, 0x5d, 0x18,
+    0x2d, 0x1e, 0x03, 0xc0, 0x17, 0x2d, 0x1e, 0x3d, 0x17, 0xad, 0x1d, 0x3d, 0x17, 0x0d, 0x1d, 0x03, 0x3d, 0x17, 0x70, 0x1c, 0xbd, 0x17, 0xed, 0x1b,
+    0x5d, 0x18, 0xed, 0x1b, 0x03, 0xfd, 0x18, 0xf0, 0x1b, 0x7d, 0x19, 0x70, 0x1c, 0x7d, 0x19, 0x0d, 0x1d, 0x04, 0x06, 0x02, 0xc7, 0x80, 0x80, 0x0b,
+    0x19, 0x3f, 0x1d, 0x4e, 0x1b, 0x81, 0x1f, 0x09, 0x00, 0x07, 0x0d, 0x19, 0x40, 0x1d, 0x40, 0x02, 0x40, 0x02, 0x06, 0x03, 0xc8, 0x80, 0x80, 0x9f,
+    0x13, 0xdf, 0x1c, 0xe1, 0x1a, 0x21, 0x24, 0x09, 0x00, 0x07, 0xa0, 0x13, 0xe0, 0x1c, 0x40, 0x07, 0x40, 0x07, 0x06, 0x03, 0xc6, 0x80, 0x80, 0x75,
+    0x2f, 0x55, 0x5e, 0x0b, 0x31, 0xeb, 0x5f, 0x09, 0x00, 0x07, 0x76, 0x2f, 0x56, 0x5e, 0x93, 0x01, 0x93, 0x01, 0x06, 0x03, 0xc6, 0x7f, 0x80, 0xc2,
+    0x2e, 0xcb, 0x5f, 0x58, 0x30, 0x61, 0x61, 0x09, 0x00, 0x07, 0xc3, 0x2e, 0xcd, 0x5f, 0x93, 0x01, 0x93, 0x01, 0x06, 0x03, 0xc6, 0x80, 0x80, 0x2b,
+    0x2d, 0x28, 0x60, 0xc1, 0x2e, 0xbe, 0x61, 0x09, 0x00, 0x07, 0x2d, 0x2d, 0x2a, 0x60, 0x93, 0x01, 0x93, 0x01, 0x06, 0x03, 0xc6, 0x80, 0x80, 0xe5,
+    0x2b, 0x25, 0x5f, 0x7b, 0x2d, 0xbb, 0x60, 0x09, 0x00, 0x07, 0xe6, 0x2b, 0x26, 0x5f, 0x93, 0x01, 0x93, 0x01, 0x06, 0x03, 0xc6, 0x80, 0x80, 0xe5,
+    0x2b, 0x85, 0x5d, 0x7b, 0x2d, 0x1b, 0x5f, 0x09, 0x00, 0x07, 0xe6, 0x2b, 0x86, 0x5d, 0x93, 0x01, 0x93, 0x01, 0x06, 0x03, 0xc6, 0x80, 0x7f, 0x2b,
+    0x2d, 0x82, 0x5c, 0xc1, 0x2e, 0x18, 0x5e, 0x09, 0x00, 0x07, 0x2d, 0x2d, 0x83, 0x5c, 0x93, 0x01, 0x93, 0x01, 0x06, 0x03, 0xc6, 0x7f, 0x7f, 0xc2,
+    0x2e, 0xdf, 0x5c, 0x58, 0x30, 0x75, 0x5e, 0x09, 0x00, 0x07, 0xc3, 0x2e, 0xe0, 0x5c, 0x93, 0x01, 0x93, 0x01, 0x06, 0x06, 0xc7, 0x80, 0x80, 0x8b,
+    0x2c, 0x4b, 0x5d, 0x31, 0x30, 0xf1, 0x60, 0x09, 0x00, 0x07, 0x8d, 0x2c, 0x4d, 0x5d, 0xa3, 0x03, 0xa3, 0x03, 0x06, 0x03, 0xc7, 0x80, 0x80, 0x8b,
+    0x1b, 0x8b, 0x2e, 0x35, 0x21, 0x35, 0x34, 0x09, 0x00, 0x07, 0x8d, 0x1b, 0x8d, 0x2e, 0xa6, 0x05, 0xa6, 0x05, 0x06, 0x03, 0xc8, 0x80, 0x80, 0x85,
+    0x18, 0xb5, 0x32, 0x2e, 0x1e, 0x5e, 0x38, 0x09, 0x00, 0x07, 0x86, 0x18, 0xb6, 0x32, 0xa6, 0x05, 0xa6, 0x05, 0x06, 0x03, 0xc8, 0x7f, 0x7f, 0xa2,
+    0x13, 0x1f, 0x31, 0x4b, 0x19, 0xc8, 0x36, 0x09, 0x00, 0x07, 0xa3, 0x13, 0x20, 0x31, 0xa6, 0x05, 0xa6, 0x05, 0x06, 0x03, 0xc8, 0x7f, 0x80, 0xa2,
+    0x13, 0xf8, 0x2b, 0x4b, 0x19, 0xa1, 0x31, 0x09, 0x00, 0x07, 0xa3, 0x13, 0xfa, 0x2b, 0xa6, 0x05, 0xa6, 0x05, 0x06, 0x03, 0xc8, 0x80, 0x7f, 0x85,
+    0x18, 0x62, 0x2a, 0x2e, 0x1e, 0x0b, 0x30, 0x09, 0x00, 0x07, 0x86, 0x18, 0x63, 0x2a, 0xa6, 0x05, 0xa6, 0x05, 0x06, 0x04, 0xc8, 0x80, 0x7f, 0x2b,
+    0x15, 0x8f, 0x2c, 0xd1, 0x1e, 0x2e, 0x36, 0x09, 0x00, 0x07, 0x2d, 0x15, 0x90, 0x2c, 0xa3, 0x09, 0x9d, 0x09, 0x06, 0x06, 0xc5, 0x80, 0x80, 0x5f,
+    0x05, 0xdf, 0x42, 0x61, 0x06, 0xe1, 0x43, 0x09, 0x00, 0x07, 0x60, 0x05, 0xe0, 0x42, 0x00, 0x01, 0x00, 0x01, 0x06, 0x06, 0xc4, 0x7f, 0x80, 0x15,
+    0x05, 0xef, 0x43, 0x18, 0x06, 0xf1, 0x44, 0x09, 0x00, 0x07, 0x16, 0x05, 0xf0, 0x43, 0x00, 0x01, 0x00, 0x01, 0x06, 0x06, 0xc3, 0x7f, 0x80, 0x4f,
+    0x04, 0xb5, 0x44, 0x51, 0x05, 0xb8, 0x45, 0x3a, 0x00, 0x01, 0x50, 0x05, 0x36, 0x45, 0x03, 0x50, 0x05, 0x7d, 0x45, 0x16, 0x05, 0xb6, 0x45, 0xd0,
+    0x04, 0xb6, 0x45, 0x03, 0x8a, 0x04, 0xb6, 0x45, 0x50, 0x04, 0x7d, 0x45, 0x50, 0x04, 0x36, 0x45, 0x03, 0x50, 0x04, 0xf0, 0x44, 0x8a, 0x04, 0xb6,
+    0x44, 0xd0, 0x04, 0xb6, 0x44, 0x03, 0x16, 0x05, 0xba, 0x44, 0x50, 0x05, 0xf0, 0x44, 0x50, 0x05, 0x36, 0x45, 0x04, 0x06, 0x06, 0xc5, 0x7f, 0x80,
+    0x3f, 0x03, 0xff, 0x44, 0x41, 0x04, 0x01, 0x46, 0x09, 0x00, 0x07, 0x40, 0x03, 0x00, 0x45, 0x00, 0x01, 0x00, 0x01, 0x06, 0x06, 0xc3, 0x7f, 0x80,
+    0x2f, 0x02, 0xb5, 0x44, 0x31, 0x03, 0xb8, 0x45, 0x3a, 0x00, 0x01, 0x30, 0x03, 0x36, 0x45, 0x03, 0x30, 0x03, 0x7d, 0x45, 0xf6, 0x02, 0xb6, 0x45,
+    0xb0, 0x02, 0xb6, 0x45, 0x03, 0x6a, 0x02, 0xb6, 0x45, 0x30, 0x02, 0x7d, 0x45, 0x30, 0x02, 0x36, 0x45, 0x03, 0x30, 0x02, 0xf0, 0x44, 0x6a, 0x02,
+    0xb6, 0x44, 0xb0, 0x02, 0xb6, 0x44, 0x03, 0xf6, 0x02, 0xba, 0x44, 0x30, 0x03, 0xf0, 0x44, 0x30, 0x03, 0x36, 0x45, 0x04, 0x06, 0x06, 0xc4, 0x7f,
+    0x80, 0x65, 0x01, 0xef, 0x43, 0x68, 0x02, 0xf1, 0x44, 0x09, 0x00, 0x07, 0x66, 0x01, 0xf0, 0x43, 0x00, 0x01, 0x00, 0x01, 0x06, 0x06, 0xc5, 0x80,
+    0x80, 0x1f, 0x01, 0xdf, 0x42, 0x21, 0x02, 0xe1, 0x43, 0x09, 0x00, 0x07, 0x20, 0x01, 0xe0, 0x42, 0x00, 0x01, 0x00, 0x01, 0x06, 0x06, 0xc4, 0x7f,
+    0x80, 0x65, 0x01, 0xcf, 0x41, 0x68, 0x02, 0xd1, 0x42, 0x09, 0x00, 0x07, 0x66, 0x01, 0xd0, 0x41, 0x00, 0x01, 0x00, 0x01, 0x06, 0x06, 0xc4, 0x80,
+    0x80, 0x2f, 0x02, 0x08, 0x41, 0x31, 0x03, 0x0b, 0x42, 0x09, 0x00, 0x07, 0x30, 0x02, 0x0a, 0x41, 0x00, 0x01, 0x00, 0x01, 0x06, 0x06, 0xc5, 0x7f,
+    0x80, 0x3f, 0x03, 0xbf, 0x40, 0x41, 0x04, 0xc1, 0x41, 0x09, 0x00, 0x07, 0x40, 0x03, 0xc0, 0x40, 0x00, 0x01, 0x00, 0x01, 0x06, 0x06, 0xc4, 0x80,
+    0x80, 0x4f, 0x04, 0x08, 0x41, 0x51, 0x05, 0x0b, 0x42, 0x09, 0x00, 0x07, 0x50, 0x04, 0x0a, 0x41, 0x00, 0x01, 0x00, 0x01, 0x06, 0x06, 0xc4, 0x7f,
+    0x80, 0x15, 0x05, 0xcf, 0x41, 0x18, 0x06, 0xd1, 0x42, 0x09, 0x00, 0x07, 0x16, 0x05, 0xd0, 0x41, 0x00, 0x01, 0x00, 0x01, 0x06, 0x03, 0xc7, 0x80,
+    0x80, 0xd5, 0x01, 0x78, 0x41, 0xae, 0x05, 0x4b, 0x45, 0x09, 0x00, 0x07, 0xd6, 0x01, 0x7a, 0x41, 0xd6, 0x03, 0xd0, 0x03, 0x06, 0x00, 0xc6, 0x80,
+    0x80, 0x3b, 0x23, 0xbb, 0x0f, 0x45, 0x25, 0xc5, 0x11, 0x09, 0x00, 0x07, 0x3d, 0x23, 0xbd, 0x0f, 0x06, 0x02, 0x06, 0x02, 0x06, 0x00, 0xc6, 0x80,
+    0x80, 0x95, 0x22, 0xb8, 0x11, 0x9e, 0x24, 0xc1, 0x13, 0x09, 0x00, 0x07, 0x96, 0x22, 0xba, 0x11, 0x06, 0x02, 0x06, 0x02, 0x06, 0x00, 0xc6, 0x80,
+    0x7f, 0xe5, 0x20, 0xf2, 0x12, 0xee, 0x22, 0xfb, 0x14, 0x09, 0x00, 0x07, 0xe6, 0x20, 0xf3, 0x12, 0x06, 0x02, 0x06, 0x02, 0x06, 0x00, 0xc6, 0x7f,
+    0x7f, 0xcf, 0x1e, 0xf2, 0x12, 0xd8, 0x20, 0xfb, 0x14, 0x09, 0x00, 0x07, 0xd0, 0x1e, 0xf3, 0x12, 0x06, 0x02, 0x06, 0x02, 0x06, 0x00, 0xc6, 0x7f,
+    0x80, 0x1f, 0x1d, 0xb8, 0x11, 0x28, 0x1f, 0xc1, 0x13, 0x09, 0x00, 0x07, 0x20, 0x1d, 0xba, 0x11, 0x06, 0x02, 0x06, 0x02, 0x06, 0x00, 0xc6, 0x80,
+    0x80, 0x7b, 0x1c, 0xbb, 0x0f, 0x85, 0x1e, 0xc5, 0x11, 0x09, 0x00, 0x07, 0x7d, 0x1c, 0xbd, 0x0f, 0x06, 0x02, 0x06, 0x02, 0x06, 0x00, 0xc6, 0x7f,
+    0x7f, 0x1f, 0x1d, 0xbf, 0x0d, 0x28, 0x1f, 0xc8, 0x0f, 0x09, 0x00, 0x07, 0x20, 0x1d, 0xc0, 0x0d, 0x06, 0x02, 0x06, 0x02, 0x06, 0x00, 0xc6, 0x7f,
+    0x80, 0xcf, 0x1e, 0x85, 0x0c, 0xd8, 0x20, 0x8e, 0x0e, 0x09, 0x00, 0x07, 0xd0, 0x1e, 0x86, 0x0c, 0x06, 0x02, 0x06, 0x02, 0x06, 0x00, 0xc6, 0x80,
+    0x80, 0xe5, 0x20, 0x85, 0x0c, 0xee, 0x22, 0x8e, 0x0e, 0x09, 0x00, 0x07, 0xe6, 0x20, 0x86, 0x0c, 0x06, 0x02, 0x06, 0x02, 0x06, 0x00, 0xc6, 0x80,
+    0x7f, 0x95, 0x22, 0xbf, 0x0d, 0x9e, 0x24, 0xc8, 0x0f, 0x09, 0x00, 0x07, 0x96, 0x22, 0xc0, 0x0d, 0x06, 0x02, 0x06, 0x02, 0x06, 0x03, 0xc8, 0x80,
+    0x80, 0x97, 0x1d, 0x7a, 0x0d, 0x29, 0x24, 0x06, 0x14, 0x09, 0x00, 0x07, 0x98, 0x1d, 0x7b, 0x0d, 0x90, 0x06, 0x8a, 0x06, 0x06, 0x04, 0xc6, 0x80,
+    0x80, 0xe8, 0x50, 0xe8, 0x04, 0x58, 0x53, 0x58, 0x07, 0x09, 0x00, 0x07, 0xea, 0x50, 0xea, 0x04, 0x6d, 0x02, 0x6d, 0x02, 0x06, 0x04, 0xc7, 0x7f,
+    0x80, 0x47, 0x4f, 0x2d, 0x07, 0xb6, 0x51, 0x99, 0x09, 0x09, 0x00, 0x07, 0x48, 0x4f, 0x2e, 0x07, 0x6d, 0x02, 0x6a, 0x02, 0x06, 0x04, 0xc5, 0x80,
+    0x80, 0x9b, 0x4c, 0x4b, 0x06, 0x0b, 0x4f, 0xbe, 0x08, 0x3a, 0x00, 0x01, 0x0a, 0x4f, 0x86, 0x07, 0x03, 0x0a, 0x4f, 0x33, 0x08, 0x7d, 0x4e, 0xbd,
+    0x08, 0xd3, 0x4d, 0xbd, 0x08, 0x03, 0x2a, 0x4d, 0xbd, 0x08, 0x9d, 0x4c, 0x30, 0x08, 0x9d, 0x4c, 0x86, 0x07, 0x03, 0x9d, 0x4c, 0xda, 0x06, 0x2a,
+    0x4d, 0x50, 0x06, 0xd3, 0x4d, 0x50, 0x06, 0x03, 0x80, 0x4e, 0x4d, 0x06, 0x0a, 0x4f, 0xda, 0x06, 0x0a, 0x4f, 0x86, 0x07, 0x04, 0x06, 0x04, 0xc6,
+    0x7f, 0x80, 0x9d, 0x4c, 0x83, 0x03, 0x0d, 0x4f, 0xf0, 0x05, 0x09, 0x00, 0x07, 0x9e, 0x4c, 0x85, 0x03, 0x6d, 0x02, 0x6a, 0x02, 0x06, 0x04, 0xc6,
+    0x7f, 0x7f, 0x45, 0x4f, 0xa5, 0x02, 0xb5, 0x51, 0x15, 0x05, 0x09, 0x00, 0x07, 0x46, 0x4f, 0xa6, 0x02, 0x6d, 0x02, 0x6d, 0x02, 0x06, 0x06, 0xc7,
+    0x80, 0x7f, 0xab, 0x4d, 0x0f, 0x04, 0xd1, 0x51, 0x35, 0x08, 0x09, 0x00, 0x07, 0xad, 0x4d, 0x10, 0x04, 0x23, 0x04, 0x23, 0x04, 0x06, 0x03, 0xc4,
+    0x7f, 0x7f, 0x95, 0x32, 0xf5, 0x31, 0xa8, 0x33, 0x08, 0x33, 0x09, 0x00, 0x07, 0x96, 0x32, 0xf6, 0x31, 0x10, 0x01, 0x10, 0x01, 0x06, 0x03, 0xc4,
+    0x7f, 0x80, 0xf5, 0x31, 0x0b, 0x33, 0x08, 0x33, 0x1e, 0x34, 0x09, 0x00, 0x07, 0xf6, 0x31, 0x0d, 0x33, 0x10, 0x01, 0x10, 0x01, 0x06, 0x03, 0xc4,
+    0x7f, 0x80, 0xb5, 0x30, 0x0b, 0x33, 0xc8, 0x31, 0x1e, 0x34, 0x09, 0x00, 0x07, 0xb6, 0x30, 0x0d, 0x33, 0x10, 0x01, 0x10, 0x01, 0x06, 0x03, 0xc4,
+    0x7f, 0x7f, 0x15, 0x30, 0xf5, 0x31, 0x28, 0x31, 0x08, 0x33, 0x09, 0x00, 0x07, 0x16, 0x30, 0xf6, 0x31, 0x10, 0x01, 0x10, 0x01, 0x06, 0x03, 0xc4,
+    0x7f, 0x80, 0xb5, 0x30, 0xdf, 0x30, 0xc8, 0x31, 0xf1, 0x31, 0x3a, 0x00, 0x01, 0xc6, 0x31, 0x6a, 0x31, 0x03, 0xc6, 0x31, 0xb3, 0x31, 0x8a, 0x31,
+    0xf0, 0x31, 0x3d, 0x31, 0xf0, 0x31, 0x03, 0xf3, 0x30, 0xf0, 0x31, 0xb6, 0x30, 0xb3, 0x31, 0xb6, 0x30, 0x66, 0x31, 0x03, 0xb6, 0x30, 0x1a, 0x31,
+    0xf3, 0x30, 0xe0, 0x30, 0x40, 0x31, 0xe0, 0x30, 0x03, 0x8a, 0x31, 0xe3, 0x30, 0xc6, 0x31, 0x20, 0x31, 0xc6, 0x31, 0x6a, 0x31, 0x04, 0x06, 0x03,
+    0xc4, 0x7f, 0x80, 0xf5, 0x31, 0xdf, 0x30, 0x08, 0x33, 0xf1, 0x31, 0x3a, 0x00, 0x01, 0x06, 0x33, 0x6a, 0x31, 0x03, 0x06, 0x33, 0xb3, 0x31, 0xca,
+    0x32, 0xf0, 0x31, 0x7d, 0x32, 0xf0, 0x31, 0x03, 0x33, 0x32, 0xf0, 0x31, 0xf6, 0x31, 0xb3, 0x31, 0xf6, 0x31, 0x66, 0x31, 0x03, 0xf6, 0x31, 0x1a,
+    0x31, 0x33, 0x32, 0xe0, 0x30, 0x80, 0x32, 0xe0, 0x30, 0x03, 0xca, 0x32, 0xe3, 0x30, 0x06, 0x33, 0x20, 0x31, 0x06, 0x33, 0x6a, 0x31, 0x04, 0x06,
+    0x06, 0xc7, 0x80, 0x80, 0xcf, 0x30, 0x6f, 0x31, 0xf1, 0x32, 0x91, 0x33, 0x09, 0x00, 0x07, 0xd0, 0x30, 0x70, 0x31, 0x20, 0x02, 0x20, 0x02, 0x06,
+    0x03, 0xc7, 0x80, 0x80, 0xe3, 0x0b, 0xc7, 0x54, 0x1d, 0x0f, 0xf9, 0x57, 0x09, 0x00, 0x07, 0xe5, 0x0b, 0xc8, 0x54, 0x36, 0x03, 0x30, 0x03, 0x06,
+    0x03, 0xc7, 0x80, 0x80, 0xc0, 0x0a, 0x83, 0x57, 0xf9, 0x0d, 0xb6, 0x5a, 0x09, 0x00, 0x07, 0xc2, 0x0a, 0x85, 0x57, 0x36, 0x03, 0x30, 0x03, 0x06,
+    0x03, 0xc7, 0x80, 0x80, 0x03, 0x08, 0xa7, 0x58, 0x3d, 0x0b, 0xd9, 0x5b, 0x09, 0x00, 0x07, 0x05, 0x08, 0xa8, 0x58, 0x36, 0x03, 0x30, 0x03, 0x06,
+    0x03, 0xc7, 0x7f, 0x80, 0x47, 0x05, 0x83, 0x57, 0x80, 0x08, 0xb6, 0x5a, 0x09, 0x00, 0x07, 0x48, 0x05, 0x85, 0x57, 0x36, 0x03, 0x30, 0x03, 0x06,
+    0x03, 0xc7, 0x80, 0x80, 0x23, 0x04, 0xc7, 0x54, 0x5d, 0x07, 0xf9, 0x57, 0x09, 0x00, 0x07, 0x25, 0x04, 0xc8, 0x54, 0x36, 0x03, 0x30, 0x03, 0x06,
+    0x03, 0xc7, 0x7f, 0x7f, 0x47, 0x05, 0x0a, 0x52, 0x80, 0x08, 0x3d, 0x55, 0x09, 0x00, 0x07, 0x48, 0x05, 0x0b, 0x52, 0x36, 0x03, 0x30, 0x03, 0x06,
+    0x03, 0xc7, 0x80, 0x80, 0x03, 0x08, 0xe7, 0x50, 0x3d, 0x0b, 0x19, 0x54, 0x09, 0x00, 0x07, 0x05, 0x08, 0xe8, 0x50, 0x36, 0x03, 0x30, 0x03, 0x06,
+    0x03, 0xc7, 0x80, 0x7f, 0xc0, 0x0a, 0x0a, 0x52, 0xf9, 0x0d, 0x3d, 0x55, 0x09, 0x00, 0x07, 0xc2, 0x0a, 0x0b, 0x52, 0x36, 0x03, 0x30, 0x03, 0x06,
+    0x02, 0xc8, 0x80, 0x80, 0x6f, 0x05, 0x2f, 0x52, 0xd1, 0x0d, 0x91, 0x5a, 0x09, 0x00, 0x07, 0x70, 0x05, 0x30, 0x52, 0x60, 0x08, 0x60, 0x08, 0x06,
+    0x03, 0xc7, 0x80, 0x80, 0xe8, 0x5a, 0xab, 0xfe, 0xdb, 0x5d, 0x98, 0x01, 0x09, 0x00, 0x07, 0xea, 0x5a, 0xad, 0xfe, 0xf0, 0x02, 0xea, 0x02, 0x06,
+    0x03, 0xc7, 0x7f, 0x80, 0x15, 0x59, 0x28, 0x01, 0x08, 0x5c, 0x1b, 0x04, 0x09, 0x00, 0x07, 0x16, 0x59, 0x2a, 0x01, 0xf0, 0x02, 0xf0, 0x02, 0x06,
+    0x03, 0xc7, 0x80, 0x80, 0x28, 0x56, 0x32, 0x00, 0x18, 0x59, 0x21, 0x03, 0x09, 0x00, 0x07, 0x2a, 0x56, 0x33, 0x00, 0xed, 0x02, 0xed, 0x02, 0x06,
+    0x03, 0xc7, 0x80, 0x7f, 0x27, 0x56, 0x1d, 0xfd, 0x19, 0x59, 0x0d, 0x00, 0x09, 0x00, 0x07, 0x28, 0x56, 0x1e, 0xfd, 0xf0, 0x02, 0xed, 0x02, 0x06,
+    0x03, 0xc7, 0x7f, 0x80, 0x15, 0x59, 0x28, 0xfc, 0x08, 0x5c, 0x1b, 0xff, 0x09, 0x00, 0x07, 0x16, 0x59, 0x2a, 0xfc, 0xf0, 0x02, 0xf0, 0x02, 0x01,
+    0x03, 0xc0, 0x59, 0x1b, 0x00, 0x04, 0x17, 0x02, 0x06, 0x02, 0xc7, 0x80, 0x80, 0x7f, 0xfd, 0x83, 0xfd, 0x81, 0x02, 0x7d, 0x02, 0x09, 0x00, 0x07,
+    0x80, 0xfd, 0x85, 0xfd, 0x00, 0x05, 0xf6, 0x04, 0x02, 0x06, 0x03, 0xc7, 0x80, 0x80, 0x4f, 0x2b, 0x0f, 0x33, 0x31, 0x2d, 0xf1, 0x34, 0x09, 0x00,
+    0x07, 0x50, 0x2b, 0x10, 0x33, 0xe0, 0x01, 0xe0, 0x01, 0x06, 0x03, 0xc6, 0x80, 0x80, 0x8b, 0x2a, 0x68, 0x35, 0x6e, 0x2c, 0x4b, 0x37, 0x09, 0x00,
+    0x07, 0x8d, 0x2a, 0x6a, 0x35, 0xe0, 0x01, 0xe0, 0x01, 0x06, 0x03, 0xc6, 0x80, 0x80, 0x8b, 0x28, 0xdb, 0x36, 0x6e, 0x2a, 0xbe, 0x38, 0x09, 0x00,
+    0x07, 0x8d, 0x28, 0xdd, 0x36, 0xe0, 0x01, 0xe0, 0x01, 0x06, 0x03, 0xc6, 0x7f, 0x80, 0x12, 0x26, 0xdb, 0x36, 0xf5, 0x27, 0xbe, 0x38, 0x09, 0x00,
+    0x07, 0x13, 0x26, 0xdd, 0x36, 0xe0, 0x01, 0xe0, 0x01, 0x06, 0x03, 0xc6, 0x7f, 0x80, 0x12, 0x24, 0x68, 0x35, 0xf5, 0x25, 0x4b, 0x37, 0x09, 0x00,
+    0x07, 0x13, 0x24, 0x6a, 0x35, 0xe0, 0x01, 0xe0, 0x01, 0x06, 0x03, 0xc7, 0x80, 0x80, 0x4f, 0x23, 0x0f, 0x33, 0x31, 0x25, 0xf1, 0x34, 0x09, 0x00,
+    0x07, 0x50, 0x23, 0x10, 0x33, 0xe0, 0x01, 0xe0, 0x01, 0x06, 0x03, 0xc6, 0x7f, 0x7f, 0x12, 0x24, 0xb5, 0x30, 0xf5, 0x25, 0x98, 0x32, 0x09, 0x00,
+    0x07, 0x13, 0x24, 0xb6, 0x30, 0xe0, 0x01, 0xe0, 0x01, 0x06, 0x03, 0xc4, 0x80, 0x80, 0x12, 0x26, 0x3f, 0x2f, 0xf5, 0x27, 0x25, 0x31, 0x3a, 0x00,
+    0x01, 0xf3, 0x27, 0x33, 0x30, 0x03, 0xf3, 0x27, 0xba, 0x30, 0x86, 0x27, 0x23, 0x31, 0x03, 0x27, 0x23, 0x31, 0x03, 0x80, 0x26, 0x23, 0x31, 0x13,
+    0x26, 0xb6, 0x30, 0x13, 0x26, 0x33, 0x30, 0x03, 0x13, 0x26, 0xb0, 0x2f, 0x80, 0x26, 0x43, 0x2f, 0x03, 0x27, 0x43, 0x2f, 0x03, 0x8a, 0x27, 0x40,
+    0x2f, 0xf3, 0x27, 0xad, 0x2f, 0xf3, 0x27, 0x33, 0x30, 0x04, 0x06, 0x03, 0xc4, 0x80, 0x80, 0x8b, 0x28, 0x3f, 0x2f, 0x6e, 0x2a, 0x25, 0x31, 0x3a,
+    0x00, 0x01, 0x6d, 0x2a, 0x33, 0x30, 0x03, 0x6d, 0x2a, 0xba, 0x30, 0x00, 0x2a, 0x23, 0x31, 0x7d, 0x29, 0x23, 0x31, 0x03, 0xfa, 0x28, 0x23, 0x31,
+    0x8d, 0x28, 0xb6, 0x30, 0x8d, 0x28, 0x33, 0x30, 0x03, 0x8d, 0x28, 0xb0, 0x2f, 0xfa, 0x28, 0x43, 0x2f, 0x7d, 0x29, 0x43, 0x2f, 0x03, 0x00, 0x2a,
+    0x40, 0x2f, 0x6d, 0x2a, 0xad, 0x2f, 0x6d, 0x2a, 0x33, 0x30, 0x04, 0x06, 0x03, 0xc6, 0x80, 0x7f, 0x8b, 0x2a, 0xb5, 0x30, 0x6e, 0x2c, 0x98, 0x32,
+    0x09, 0x00, 0x07, 0x8d, 0x2a, 0xb6, 0x30, 0xe0, 0x01, 0xe0, 0x01, 0x06, 0x00, 0xc8, 0x80, 0x80, 0x35, 0x25, 0xf5, 0x30, 0x4b, 0x2b, 0x0b, 0x37,
+    0x09, 0x00, 0x07, 0x36, 0x25, 0xf6, 0x30, 0x13, 0x06, 0x13, 0x06, 0x06, 0x06, 0xc6, 0x80, 0x80, 0xb5, 0x61, 0x58, 0x5e, 0x0e, 0x64, 0xab, 0x60,
+    0x09, 0x00, 0x07, 0xb6, 0x61, 0x5a, 0x5e, 0x56, 0x02, 0x50, 0x02, 0x06, 0x06, 0xc6, 0x80, 0x80, 0xdb, 0x60, 0xab, 0x60, 0x35, 0x63, 0xfe, 0x62,
+    0x09, 0x00, 0x07, 0xdd, 0x60, 0xad, 0x60, 0x56, 0x02, 0x50, 0x02, 0x06, 0x06, 0xc5, 0x80, 0x80, 0xb8, 0x5e, 0xe5, 0x61, 0x0e, 0x61, 0x3e, 0x64,
+    0x3a, 0x00, 0x01, 0x0d, 0x61, 0x13, 0x63, 0x03, 0x0d, 0x61, 0xb6, 0x63, 0x86, 0x60, 0x3d, 0x64, 0xe3, 0x5f, 0x3d, 0x64, 0x03, 0x40, 0x5f, 0x3d,
+    0x64, 0xba, 0x5e, 0xb6, 0x63, 0xba, 0x5e, 0x13, 0x63, 0x03, 0xba, 0x5e, 0x70, 0x62, 0x40, 0x5f, 0xea, 0x61, 0xe3, 0x5f, 0xea, 0x61, 0x03, 0x86,
+    0x60, 0xe6, 0x61, 0x0d, 0x61, 0x6d, 0x62, 0x0d, 0x61, 0x13, 0x63, 0x04, 0x06, 0x06, 0xc6, 0x80, 0x80, 0x45, 0x5c, 0x7b, 0x61, 0x9e, 0x5e, 0xce,
+    0x63, 0x09, 0x00, 0x07, 0x46, 0x5c, 0x7d, 0x61, 0x56, 0x02, 0x50, 0x02, 0x06, 0x06, 0xc6, 0x7f, 0x7f, 0xaf, 0x5a, 0x95, 0x5f, 0x08, 0x5d, 0xe8,
+    0x61, 0x09, 0x00, 0x07, 0xb0, 0x5a, 0x96, 0x5f, 0x56, 0x02, 0x50, 0x02, 0x06, 0x06, 0xc6, 0x7f, 0x80, 0xaf, 0x5a, 0x1b, 0x5d, 0x08, 0x5d, 0x6e,
+    0x5f, 0x09, 0x00, 0x07, 0xb0, 0x5a, 0x1d, 0x5d, 0x56, 0x02, 0x50, 0x02, 0x06, 0x06, 0xc6, 0x80, 0x7f, 0x45, 0x5c, 0x35, 0x5b, 0x9e, 0x5e, 0x88,
+    0x5d, 0x09, 0x00, 0x07, 0x46, 0x5c, 0x36, 0x5b, 0x56, 0x02, 0x50, 0x02, 0x06, 0x06, 0xc6, 0x80, 0x7f, 0xb8, 0x5e, 0xc5, 0x5a, 0x11, 0x61, 0x18,
+    0x5d, 0x09, 0x00, 0x07, 0xba, 0x5e, 0xc6, 0x5a, 0x56, 0x02, 0x50, 0x02, 0x06, 0x06, 0xc5, 0x80, 0x80, 0xdb, 0x60, 0xff, 0x5b, 0x31, 0x63, 0x58,
+    0x5e, 0x3a, 0x00, 0x01, 0x30, 0x63, 0x2d, 0x5d, 0x03, 0x30, 0x63, 0xd0, 0x5d, 0xaa, 0x62, 0x56, 0x5e, 0x06, 0x62, 0x56, 0x5e, 0x03, 0x63, 0x61,
+    0x56, 0x5e, 0xdd, 0x60, 0xd0, 0x5d, 0xdd, 0x60, 0x2d, 0x5d, 0x03, 0xdd, 0x60, 0x8a, 0x5c, 0x63, 0x61, 0x03, 0x5c, 0x06, 0x62, 0x03, 0x5c, 0x03,
+    0xad, 0x62, 0x00, 0x5c, 0x30, 0x63, 0x86, 0x5c, 0x30, 0x63, 0x2d, 0x5d, 0x04, 0x06, 0x03, 0xc8, 0x7f, 0x7f, 0xd2, 0x5b, 0x17, 0x5c, 0xab, 0x62,
+    0xe3, 0x62, 0x09, 0x00, 0x07, 0xd3, 0x5b, 0x18, 0x5c, 0xd6, 0x06, 0xca, 0x06, 0x06, 0x06, 0xc5, 0x7f, 0x7f, 0x1f, 0x56, 0x7f, 0x4f, 0xe1, 0x56,
+    0x41, 0x50, 0x3a, 0x00, 0x01, 0xe0, 0x56, 0xe0, 0x4f, 0x03, 0xe0, 0x56, 0x16, 0x50, 0xb6, 0x56, 0x40, 0x50, 0x80, 0x56, 0x40, 0x50, 0x03, 0x4a,
+    0x56, 0x40, 0x50, 0x20, 0x56, 0x16, 0x50, 0x20, 0x56, 0xe0, 0x4f, 0x03, 0x20, 0x56, 0xaa, 0x4f, 0x4a, 0x56, 0x80, 0x4f, 0x80, 0x56, 0x80, 0x4f,
+    0x03, 0xb6, 0x56, 0x80, 0x4f, 0xe0, 0x56, 0xaa, 0x4f, 0xe0, 0x56, 0xe0, 0x4f, 0x04, 0x06, 0x06, 0xc4, 0x80, 0x7f, 0xdb, 0x55, 0x4f, 0x50, 0x9e,
+    0x56, 0x11, 0x51, 0x3a, 0x00, 0x01, 0x9d, 0x56, 0xb0, 0x50, 0x03, 0x9d, 0x56, 0xe6, 0x50, 0x73, 0x56, 0x10, 0x51, 0x3d, 0x56, 0x10, 0x51, 0x03,
+    0x06, 0x56, 0x10, 0x51, 0xdd, 0x55, 0xe6, 0x50, 0xdd, 0x55, 0xb0, 0x50, 0x03, 0xdd, 0x55, 0x7a, 0x50, 0x06, 0x56, 0x50, 0x50, 0x3d, 0x56, 0x50,
+    0x50, 0x03, 0x73, 0x56, 0x50, 0x50, 0x9d, 0x56, 0x7a, 0x50, 0x9d, 0x56, 0xb0, 0x50, 0x04, 0x06, 0x06, 0xc4, 0x80, 0x7f, 0x2b, 0x55, 0xcf, 0x50,
+    0xee, 0x55, 0x91, 0x51, 0x3a, 0x00, 0x01, 0xed, 0x55, 0x30, 0x51, 0x03, 0xed, 0x55, 0x66, 0x51, 0xc3, 0x55, 0x90, 0x51, 0x8d, 0x55, 0x90, 0x51,
+    0x03, 0x56, 0x55, 0x90, 0x51, 0x2d, 0x55, 0x66, 0x51, 0x2d, 0x55, 0x30, 0x51, 0x03, 0x2d, 0x55, 0xfa, 0x50, 0x56, 0x55, 0xd0, 0x50, 0x8d, 0x55,
+    0xd0, 0x50, 0x03, 0xc3, 0x55, 0xd0, 0x50, 0xed, 0x55, 0xfa, 0x50, 0xed, 0x55, 0x30, 0x51, 0x04, 0x06, 0x06, 0xc4, 0x7f, 0x80, 0x52, 0x54, 0xcf,
+    0x50, 0x15, 0x55, 0x91, 0x51, 0x3a, 0x00, 0x01, 0x13, 0x55, 0x30, 0x51, 0x03, 0x13, 0x55, 0x66, 0x51, 0xea, 0x54, 0x90, 0x51, 0xb3, 0x54, 0x90,
+    0x51, 0x03, 0x7d, 0x54, 0x90, 0x51, 0x53, 0x54, 0x66, 0x51, 0x53, 0x54, 0x30, 0x51, 0x03, 0x53, 0x54, 0xfa, 0x50, 0x7d, 0x54, 0xd0, 0x50, 0xb3,
+    0x54, 0xd0, 0x50, 0x03, 0xea, 0x54, 0xd0, 0x50, 0x13, 0x55, 0xfa, 0x50, 0x13, 0x55, 0x30, 0x51, 0x04, 0x06, 0x06, 0xc4, 0x7f, 0x7f, 0xa2, 0x53,
+    0x4f, 0x50, 0x65, 0x54, 0x11, 0x51, 0x3a, 0x00, 0x01, 0x63, 0x54, 0xb0, 0x50, 0x03, 0x63, 0x54, 0xe6, 0x50, 0x3a, 0x54, 0x10, 0x51, 0x03, 0x54,
+    0x10, 0x51, 0x03, 0xcd, 0x53, 0x10, 0x51, 0xa3, 0x53, 0xe6, 0x50, 0xa3, 0x53, 0xb0, 0x50, 0x03, 0xa3, 0x53, 0x7a, 0x50, 0xcd, 0x53, 0x50, 0x50,
+    0x03, 0x54, 0x50, 0x50, 0x03, 0x3a, 0x54, 0x50, 0x50, 0x63, 0x54, 0x7a, 0x50, 0x63, 0x54, 0xb0, 0x50, 0x04, 0x06, 0x06, 0xc5, 0x7f, 0x7f, 0x5f,
+    0x53, 0x7f, 0x4f, 0x21, 0x54, 0x41, 0x50, 0x3a, 0x00, 0x01, 0x20, 0x54, 0xe0, 0x4f, 0x03, 0x20, 0x54, 0x16, 0x50, 0xf6, 0x53, 0x40, 0x50, 0xc0,
+    0x53, 0x40, 0x50, 0x03, 0x8a, 0x53, 0x40, 0x50, 0x60, 0x53, 0x16, 0x50, 0x60, 0x53, 0xe0, 0x4f, 0x03, 0x60, 0x53, 0xaa, 0x4f, 0x8a, 0x53, 0x80,
+    0x4f, 0xc0, 0x53, 0x80, 0x4f, 0x03, 0xf6, 0x53, 0x80, 0x4f, 0x20, 0x54, 0xaa, 0x4f, 0x20, 0x54, 0xe0, 0x4f, 0x04, 0x06, 0x06, 0xc4, 0x7f, 0x80,
+    0xa2, 0x53, 0xaf, 0x4e, 0x65, 0x54, 0x71, 0x4f, 0x3a, 0x00, 0x01, 0x63, 0x54, 0x10, 0x4f, 0x03, 0x63, 0x54, 0x46, 0x4f, 0x3a, 0x54, 0x70, 0x4f,
+    0x03, 0x54, 0x70, 0x4f, 0x03, 0xcd, 0x53, 0x70, 0x4f, 0xa3, 0x53, 0x46, 0x4f, 0xa3, 0x53, 0x10, 0x4f, 0x03, 0xa3, 0x53, 0xda, 0x4e, 0xcd, 0x53,
+    0xb0, 0x4e, 0x03, 0x54, 0xb0, 0x4e, 0x03, 0x3a, 0x54, 0xb0, 0x4e, 0x63, 0x54, 0xdd, 0x4e, 0x63, 0x54, 0x10, 0x4f, 0x04, 0x06, 0x06, 0xc4, 0x7f,
+    0x80, 0x52, 0x54, 0x2f, 0x4e, 0x15, 0x55, 0xf1, 0x4e, 0x3a, 0x00, 0x01, 0x13, 0x55, 0x90, 0x4e, 0x03, 0x13, 0x55, 0xc6, 0x4e, 0xea, 0x54, 0xf0,
+    0x4e, 0xb3, 0x54, 0xf0, 0x4e, 0x03, 0x7d, 0x54, 0xf0, 0x4e, 0x53, 0x54, 0xc6, 0x4e, 0x53, 0x54, 0x90, 0x4e, 0x03, 0x53, 0x54, 0x5a, 0x4e, 0x7d,
+    0x54, 0x30, 0x4e, 0xb3, 0x54, 0x30, 0x4e, 0x03, 0xea, 0x54, 0x30, 0x4e, 0x13, 0x55, 0x5d, 0x4e, 0x13, 0x55, 0x90, 0x4e, 0x04, 0x06, 0x06, 0xc4,
+    0x80, 0x80, 0x2b, 0x55, 0x2f, 0x4e, 0xee, 0x55, 0xf1, 0x4e, 0x3a, 0x00, 0x01, 0xed, 0x55, 0x90, 0x4e, 0x03, 0xed, 0x55, 0xc6, 0x4e, 0xc3, 0x55,
+    0xf0, 0x4e, 0x8d, 0x55, 0xf0, 0x4e, 0x03, 0x56, 0x55, 0xf0, 0x4e, 0x2d, 0x55, 0xc6, 0x4e, 0x2d, 0x55, 0x90, 0x4e, 0x03, 0x2d, 0x55, 0x5a, 0x4e,
+    0x56, 0x55, 0x30, 0x4e, 0x8d, 0x55, 0x30, 0x4e, 0x03, 0xc3, 0x55, 0x30, 0x4e, 0xed, 0x55, 0x5d, 0x4e, 0xed, 0x55, 0x90, 0x4e, 0x04, 0x06, 0x06,
+    0xc4, 0x80, 0x80, 0xdb, 0x55, 0xaf, 0x4e, 0x9e, 0x56, 0x71, 0x4f, 0x3a, 0x00, 0x01, 0x9d, 0x56, 0x10, 0x4f, 0x03, 0x9d, 0x56, 0x46, 0x4f, 0x73,
+    0x56, 0x70, 0x4f, 0x3d, 0x56, 0x70, 0x4f, 0x03, 0x06, 0x56, 0x70, 0x4f, 0xdd, 0x55, 0x46, 0x4f, 0xdd, 0x55, 0x10, 0x4f, 0x03, 0xdd, 0x55, 0xda,
+    0x4e, 0x06, 0x56, 0xb0, 0x4e, 0x3d, 0x56, 0xb0, 0x4e, 0x03, 0x73, 0x56, 0xb0, 0x4e, 0x9d, 0x56, 0xdd, 0x4e, 0x9d, 0x56, 0x10, 0x4f, 0x04, 0x06,
+    0x03, 0xc6, 0x80, 0x80, 0xe8, 0x53, 0xa8, 0x4e, 0x58, 0x56, 0x18, 0x51, 0x09, 0x00, 0x07, 0xea, 0x53, 0xaa, 0x4e, 0x6d, 0x02, 0x6d, 0x02, 0x06,
+    0x06, 0xc2, 0x7f, 0x7f, 0x7f, 0x0b, 0x3f, 0x47, 0x85, 0x0c, 0x45, 0x48, 0x3a, 0x00, 0x01, 0x83, 0x0c, 0xc0, 0x47, 0x03, 0x83, 0x0c, 0x06, 0x48,
+    0x4a, 0x0c, 0x43, 0x48, 0x03, 0x0c, 0x43, 0x48, 0x03, 0xbd, 0x0b, 0x43, 0x48, 0x80, 0x0b, 0x0a, 0x48, 0x80, 0x0b, 0xc3, 0x47, 0x03, 0x80, 0x0b,
+    0x7d, 0x47, 0xba, 0x0b, 0x40, 0x47, 0x00, 0x0c, 0x40, 0x47, 0x03, 0x46, 0x0c, 0x40, 0x47, 0x80, 0x0c, 0x7a, 0x47, 0x83, 0x0c, 0xc0, 0x47, 0x04,
+    0x06, 0x06, 0xc1, 0x7f, 0x81, 0xdf, 0x0a, 0x52, 0x48, 0xe5, 0x0b, 0x5b, 0x49, 0x3a, 0x00, 0x01, 0xe3, 0x0b, 0xd6, 0x48, 0x03, 0xe3, 0x0b, 0x1d,
+    0x49, 0xaa, 0x0b, 0x5a, 0x49, 0x63, 0x0b, 0x5a, 0x49, 0x03, 0x1d, 0x0b, 0x5a, 0x49, 0xe0, 0x0a, 0x20, 0x49, 0xe0, 0x0a, 0xda, 0x48, 0x03, 0xe0,
+    0x0a, 0x93, 0x48, 0x1a, 0x0b, 0x56, 0x48, 0x60, 0x0b, 0x56, 0x48, 0x03, 0xa6, 0x0b, 0x53, 0x48, 0xe0, 0x0b, 0x8d, 0x48, 0xe3, 0x0b, 0xd6, 0x48,
+    0x04, 0x06, 0x06, 0xc1, 0x7f, 0x81, 0x9f, 0x09, 0x52, 0x48, 0xa5, 0x0a, 0x5b, 0x49, 0x3a, 0x00, 0x01, 0xa3, 0x0a, 0xd6, 0x48, 0x03, 0xa3, 0x0a,
+    0x1d, 0x49, 0x6a, 0x0a, 0x5a, 0x49, 0x23, 0x0a, 0x5a, 0x49, 0x03, 0xdd, 0x09, 0x5a, 0x49, 0xa0, 0x09, 0x20, 0x49, 0xa0, 0x09, 0xda, 0x48, 0x03,
+    0xa0, 0x09, 0x93, 0x48, 0xda, 0x09, 0x56, 0x48, 0x20, 0x0a, 0x56, 0x48, 0x03, 0x66, 0x0a, 0x53, 0x48, 0xa0, 0x0a, 0x8d, 0x48, 0xa3, 0x0a, 0xd6,
+    0x48, 0x04, 0x06, 0x06, 0xc2, 0x7f, 0x7f, 0xff, 0x08, 0x3f, 0x47, 0x05, 0x0a, 0x45, 0x48, 0x3a, 0x00, 0x01, 0x03, 0x0a, 0xc0, 0x47, 0x03, 0x03,
+    0x0a, 0x06, 0x48, 0xca, 0x09, 0x43, 0x48, 0x83, 0x09, 0x43, 0x48, 0x03, 0x3d, 0x09, 0x43, 0x48, 0x00, 0x09, 0x0a, 0x48, 0x00, 0x09, 0xc3, 0x47,
+    0x03, 0x00, 0x09, 0x7d, 0x47, 0x3a, 0x09, 0x40, 0x47, 0x80, 0x09, 0x40, 0x47, 0x03, 0xc6, 0x09, 0x40, 0x47, 0x00, 0x0a, 0x7a, 0x47, 0x03, 0x0a,
+    0xc0, 0x47, 0x04, 0x06, 0x06, 0xc2, 0x7f, 0x80, 0x9f, 0x09, 0x28, 0x46, 0xa5, 0x0a, 0x2e, 0x47, 0x3a, 0x00, 0x01, 0xa3, 0x0a, 0xaa, 0x46, 0x03,
+    0xa3, 0x0a, 0xf0, 0x46, 0x6a, 0x0a, 0x2d, 0x47, 0x23, 0x0a, 0x2d, 0x47, 0x03, 0xdd, 0x09, 0x2d, 0x47, 0xa0, 0x09, 0xf3, 0x46, 0xa0, 0x09, 0xad,
+    0x46, 0x03, 0xa0, 0x09, 0x66, 0x46, 0xda, 0x09, 0x2a, 0x46, 0x20, 0x0a, 0x2a, 0x46, 0x03, 0x66, 0x0a, 0x2a, 0x46, 0xa0, 0x0a, 0x63, 0x46, 0xa3,
+    0x0a, 0xaa, 0x46, 0x04, 0x06, 0x06, 0xc2, 0x7f, 0x80, 0xdf, 0x0a, 0x28, 0x46, 0xe5, 0x0b, 0x2e, 0x47, 0x3a, 0x00, 0x01, 0xe3, 0x0b, 0xaa, 0x46,
+    0x03, 0xe3, 0x0b, 0xf0, 0x46, 0xaa, 0x0b, 0x2d, 0x47, 0x63, 0x0b, 0x2d, 0x47, 0x03, 0x1d, 0x0b, 0x2d, 0x47, 0xe0, 0x0a, 0xf3, 0x46, 0xe0, 0x0a,
+    0xad, 0x46, 0x03, 0xe0, 0x0a, 0x66, 0x46, 0x1a, 0x0b, 0x2a, 0x46, 0x60, 0x0b, 0x2a, 0x46, 0x03, 0xa6, 0x0b, 0x2a, 0x46, 0xe0, 0x0b, 0x63, 0x46,
+    0xe3, 0x0b, 0xaa, 0x46, 0x04, 0x06, 0x00, 0xc6, 0x7f, 0x80, 0xbb, 0x09, 0xbb, 0x46, 0xc5, 0x0b, 0xc5, 0x48, 0x09, 0x00, 0x07, 0xbd, 0x09, 0xbd,
+    0x46, 0x06, 0x02, 0x06, 0x02, 0x06, 0x06, 0xc7, 0x80, 0x80, 0x02, 0x27, 0x42, 0x2c, 0x3e, 0x2a, 0x7e, 0x2f, 0x09, 0x00, 0x07, 0x03, 0x27, 0x43,
+    0x2c, 0x3a, 0x03, 0x3a, 0x03, 0x06, 0x06, 0xc7, 0x80, 0x7f, 0x1b, 0x25, 0xdf, 0x2e, 0x58, 0x28, 0x1b, 0x32, 0x09, 0x00, 0x07, 0x1d, 0x25, 0xe0,
+    0x2e, 0x3a, 0x03, 0x3a, 0x03, 0x06, 0x06, 0xc7, 0x7f, 0x7f, 0x08, 0x22, 0xdf, 0x2d, 0x45, 0x25, 0x1b, 0x31, 0x09, 0x00, 0x07, 0x0a, 0x22, 0xe0,
+    0x2d, 0x3a, 0x03, 0x3a, 0x03, 0x06, 0x06, 0xc7, 0x7f, 0x80, 0x08, 0x22, 0xa5, 0x2a, 0x45, 0x25, 0xe1, 0x2d, 0x09, 0x00, 0x07, 0x0a, 0x22, 0xa6,
+    0x2a, 0x3a, 0x03, 0x3a, 0x03, 0x06, 0x06, 0xc7, 0x80, 0x80, 0x1b, 0x25, 0xa5, 0x29, 0x58, 0x28, 0xe1, 0x2c, 0x09, 0x00, 0x07, 0x1d, 0x25, 0xa6,
+    0x29, 0x3a, 0x03, 0x3a, 0x03, 0x06, 0x03, 0xc8, 0x80, 0x80, 0x1f, 0x23, 0x1f, 0x2b, 0xa1, 0x28, 0xa1, 0x30, 0x09, 0x00, 0x07, 0x20, 0x23, 0x20,
+    0x2b, 0x80, 0x05, 0x80, 0x05, 0x06, 0x02, 0xc4, 0x80, 0x7f, 0x85, 0x57, 0x85, 0x5c, 0x7b, 0x58, 0x7b, 0x5d, 0x09, 0x00, 0x07, 0x86, 0x57, 0x86,
+    0x5c, 0xf3, 0x00, 0xf3, 0x00, 0x06, 0x02, 0xc4, 0x80, 0x80, 0x28, 0x57, 0xe5, 0x5d, 0x1e, 0x58, 0xdb, 0x5e, 0x09, 0x00, 0x07, 0x2a, 0x57, 0xe6,
+    0x5d, 0xf3, 0x00, 0xf3, 0x00, 0x06, 0x02, 0xc2, 0x80, 0x81, 0x25, 0x56, 0xe5, 0x5e, 0x1b, 0x57, 0xde, 0x5f, 0x3a, 0x00, 0x01, 0x1a, 0x57, 0x63,
+    0x5f, 0x03, 0x1a, 0x57, 0xa6, 0x5f, 0xe3, 0x56, 0xdd, 0x5f, 0xa0, 0x56, 0xdd, 0x5f, 0x03, 0x5d, 0x56, 0xdd, 0x5f, 0x26, 0x56, 0xa6, 0x5f, 0x26,
+    0x56, 0x63, 0x5f, 0x03, 0x26, 0x56, 0x20, 0x5f, 0x5d, 0x56, 0xea, 0x5e, 0xa0, 0x56, 0xea, 0x5e, 0x03, 0xe3, 0x56, 0xe6, 0x5e, 0x1a, 0x57, 0x1d,
+    0x5f, 0x1a, 0x57, 0x63, 0x5f, 0x04, 0x06, 0x02, 0xc4, 0x80, 0x80, 0xc5, 0x54, 0x45, 0x5f, 0xbb, 0x55, 0x3b, 0x60, 0x09, 0x00, 0x07, 0xc6, 0x54,
+    0x46, 0x5f, 0xf3, 0x00, 0xf3, 0x00, 0x06, 0x02, 0xc2, 0x80, 0x81, 0x65, 0x53, 0xe5, 0x5e, 0x5b, 0x54, 0xde, 0x5f, 0x3a, 0x00, 0x01, 0x5a, 0x54,
+    0x63, 0x5f, 0x03, 0x5a, 0x54, 0xa6, 0x5f, 0x23, 0x54, 0xdd, 0x5f, 0xe0, 0x53, 0xdd, 0x5f, 0x03, 0x9d, 0x53, 0xdd, 0x5f, 0x66, 0x53, 0xa6, 0x5f,
+    0x66, 0x53, 0x63, 0x5f, 0x03, 0x66, 0x53, 0x20, 0x5f, 0x9d, 0x53, 0xea, 0x5e, 0xe0, 0x53, 0xea, 0x5e, 0x03, 0x23, 0x54, 0xe6, 0x5e, 0x5a, 0x54,
+    0x1d, 0x5f, 0x5a, 0x54, 0x63, 0x5f, 0x04, 0x06, 0x02, 0xc4, 0x80, 0x80, 0x65, 0x52, 0xe5, 0x5d, 0x5b, 0x53, 0xdb, 0x5e, 0x09, 0x00, 0x07, 0x66,
+    0x52, 0xe6, 0x5d, 0xf3, 0x00, 0xf3, 0x00, 0x06, 0x02, 0xc4, 0x80, 0x7f, 0x05, 0x52, 0x85, 0x5c, 0xfb, 0x52, 0x7b, 0x5d, 0x09, 0x00, 0x07, 0x06,
+    0x52, 0x86, 0x5c, 0xf3, 0x00, 0xf3, 0x00, 0x06, 0x02, 0xc4, 0x80, 0x80, 0x65, 0x52, 0x25, 0x5b, 0x5b, 0x53, 0x1b, 0x5c, 0x09, 0x00, 0x07, 0x66,
+    0x52, 0x26, 0x5b, 0xf3, 0x00, 0xf3, 0x00, 0x06, 0x02, 0xc4, 0x80, 0x7f, 0x65, 0x53, 0x22, 0x5a, 0x5b, 0x54, 0x18, 0x5b, 0x09, 0x00, 0x07, 0x66,
+    0x53, 0x23, 0x5a, 0xf3, 0x00, 0xf3, 0x00, 0x06, 0x02, 0xc4, 0x80, 0x80, 0xc5, 0x54, 0xc5, 0x59, 0xbb, 0x55, 0xbb, 0x5a, 0x09, 0x00, 0x07, 0xc6,
+    0x54, 0xc6, 0x59, 0xf3, 0x00, 0xf3, 0x00, 0x06, 0x02, 0xc4, 0x80, 0x7f, 0x25, 0x56, 0x22, 0x5a, 0x1b, 0x57, 0x18, 0x5b, 0x09, 0x00, 0x07, 0x26,
+    0x56, 0x23, 0x5a, 0xf3, 0x00, 0xf3, 0x00, 0x06, 0x02, 0xc4, 0x80, 0x80, 0x28, 0x57, 0x25, 0x5b, 0x1e, 0x58, 0x1b, 0x5c, 0x09, 0x00, 0x07, 0x2a,
+    0x57, 0x26, 0x5b, 0xf3, 0x00, 0xf3, 0x00, 0x06, 0x03, 0xc7, 0x80, 0x80, 0x68, 0x53, 0x28, 0x5b, 0x18, 0x57, 0xd8, 0x5e, 0x09, 0x00, 0x07, 0x6a,
+    0x53, 0x2a, 0x5b, 0xad, 0x03, 0xad, 0x03, 0x06, 0x06, 0xc7, 0x80, 0x80, 0x5f, 0x23, 0xbf, 0x53, 0xe1, 0x25, 0x41, 0x56, 0x09, 0x00, 0x07, 0x60,
+    0x23, 0xc0, 0x53, 0x80, 0x02, 0x80, 0x02, 0x06, 0x06, 0xc6, 0x7f, 0x7f, 0x62, 0x22, 0x22, 0x56, 0xe5, 0x24, 0xa5, 0x58, 0x09, 0x00, 0x07, 0x63,
+    0x22, 0x23, 0x56, 0x80, 0x02, 0x80, 0x02, 0x06, 0x06, 0xc7, 0x80, 0x80, 0xff, 0x1f, 0x1f, 0x57, 0x81, 0x22, 0xa1, 0x59, 0x09, 0x00, 0x07, 0x00,
+    0x20, 0x20, 0x57, 0x80, 0x02, 0x80, 0x02, 0x06, 0x06, 0xc6, 0x80, 0x7f, 0x9b, 0x1d, 0x22, 0x56, 0x1e, 0x20, 0xa5, 0x58, 0x09, 0x00, 0x07, 0x9d,
+    0x1d, 0x23, 0x56, 0x80, 0x02, 0x80, 0x02, 0x06, 0x06, 0xc7, 0x80, 0x80, 0x9f, 0x1c, 0xbf, 0x53, 0x21, 0x1f, 0x41, 0x56, 0x09, 0x00, 0x07, 0xa0,
+    0x1c, 0xc0, 0x53, 0x80, 0x02, 0x80, 0x02, 0x06, 0x06, 0xc6, 0x80, 0x80, 0x9b, 0x1d, 0x5b, 0x51, 0x1e, 0x20, 0xde, 0x53, 0x09, 0x00, 0x07, 0x9d,
+    0x1d, 0x5d, 0x51, 0x80, 0x02, 0x80, 0x02, 0x06, 0x06, 0xc7, 0x80, 0x80, 0xff, 0x1f, 0x5f, 0x50, 0x81, 0x22, 0xe1, 0x52, 0x09, 0x00, 0x07, 0x00,
+    0x20, 0x60, 0x50, 0x80, 0x02, 0x80, 0x02, 0x06, 0x06, 0xc6, 0x7f, 0x80, 0x62, 0x22, 0x5b, 0x51, 0xe5, 0x24, 0xde, 0x53, 0x09, 0x00, 0x07, 0x63,
+    0x22, 0x5d, 0x51, 0x80, 0x02, 0x80, 0x02, 0x06, 0x03, 0xc8, 0x80, 0x80, 0xf7, 0x1d, 0xba, 0x51, 0x89, 0x24, 0x46, 0x58, 0x09, 0x00, 0x07, 0xf8,
+    0x1d, 0xbb, 0x51, 0x90, 0x06, 0x8a, 0x06, 0x06, 0x06, 0xc3, 0x80, 0x80, 0xcb, 0x2f, 0x0b, 0x0e, 0xf5, 0x30, 0x35, 0x0f, 0x09, 0x00, 0x07, 0xcd,
+    0x2f, 0x0d, 0x0e, 0x26, 0x01, 0x26, 0x01, 0x06, 0x06, 0xc4, 0x80, 0x80, 0x0b, 0x2f, 0x58, 0x0f, 0x35, 0x30, 0x81, 0x10, 0x09, 0x00, 0x07, 0x0d,
+    0x2f, 0x5a, 0x0f, 0x26, 0x01, 0x26, 0x01, 0x06, 0x06, 0xc4, 0x80, 0x80, 0x8b, 0x2d, 0x58, 0x0f, 0xb5, 0x2e, 0x81, 0x10, 0x09, 0x00, 0x07, 0x8d,
+    0x2d, 0x5a, 0x0f, 0x26, 0x01, 0x26, 0x01, 0x06, 0x06, 0xc3, 0x80, 0x80, 0xcb, 0x2c, 0x0b, 0x0e, 0xf5, 0x2d, 0x35, 0x0f, 0x09, 0x00, 0x07, 0xcd,
+    0x2c, 0x0d, 0x0e, 0x26, 0x01, 0x26, 0x01, 0x06, 0x06, 0xc4, 0x80, 0x7f, 0x8b, 0x2d, 0xbf, 0x0c, 0xb5, 0x2e, 0xe8, 0x0d, 0x09, 0x00, 0x07, 0x8d,
+    0x2d, 0xc0, 0x0c, 0x26, 0x01, 0x26, 0x01, 0x06, 0x06, 0xc4, 0x80, 0x7f, 0x0b, 0x2f, 0xbf, 0x0c, 0x35, 0x30, 0xe8, 0x0d, 0x09, 0x00, 0x07, 0x0d,
+    0x2f, 0xc0, 0x0c, 0x26, 0x01, 0x26, 0x01, 0x06, 0x04, 0xc6, 0x80, 0x80, 0xb8, 0x2d, 0x78, 0x0d, 0x08, 0x30, 0xc8, 0x0f, 0x09, 0x00, 0x07, 0xba,
+    0x2d, 0x7a, 0x0d, 0x4d, 0x02, 0x4d, 0x02, 0x06, 0x00, 0xc6, 0x80, 0x7f, 0x4b, 0x0d, 0x2b, 0x5e, 0xf5, 0x0f, 0xd5, 0x60, 0x09, 0x00, 0x07, 0x4d,
+    0x0d, 0x2d, 0x5e, 0xa6, 0x02, 0xa6, 0x02, 0x06, 0x00, 0xc6, 0x80, 0x80, 0x58, 0x0c, 0x75, 0x60, 0x01, 0x0f, 0x21, 0x63, 0x3a, 0x00, 0x01, 0x00,
+    0x0f, 0xcd, 0x61, 0x03, 0x00, 0x0f, 0x8a, 0x62, 0x66, 0x0e, 0x20, 0x63, 0xad, 0x0d, 0x20, 0x63, 0x03, 0xf0, 0x0c, 0x20, 0x63, 0x5a, 0x0c, 0x86,
+    0x62, 0x5a, 0x0c, 0xcd, 0x61, 0x03, 0x5a, 0x0c, 0x13, 0x61, 0xf3, 0x0c, 0x7a, 0x60, 0xad, 0x0d, 0x7a, 0x60, 0x03, 0x6a, 0x0e, 0x76, 0x60, 0x00,
+    0x0f, 0x10, 0x61, 0x00, 0x0f, 0xcd, 0x61, 0x04, 0x06, 0x00, 0xc6, 0x80, 0x80, 0x0b, 0x0a, 0x6b, 0x61, 0xb5, 0x0c, 0x15, 0x64, 0x09, 0x00, 0x07,
+    0x0d, 0x0a, 0x6d, 0x61, 0xa6, 0x02, 0xa6, 0x02, 0x06, 0x00, 0xc7, 0x7f, 0x80, 0xbf, 0x07, 0x75, 0x60, 0x6b, 0x0a, 0x21, 0x63, 0x09, 0x00, 0x07,
+    0xc0, 0x07, 0x76, 0x60, 0xaa, 0x02, 0xaa, 0x02, 0x06, 0x00, 0xc6, 0x80, 0x7f, 0xcb, 0x06, 0x2b, 0x5e, 0x75, 0x09, 0xd5, 0x60, 0x09, 0x00, 0x07,
+    0xcd, 0x06, 0x2d, 0x5e, 0xa6, 0x02, 0xa6, 0x02, 0x06, 0x00, 0xc6, 0x7f, 0x80, 0xbf, 0x07, 0xdb, 0x5b, 0x6b, 0x0a, 0x88, 0x5e, 0x3a, 0x00, 0x01,
+    0x6a, 0x0a, 0x33, 0x5d, 0x03, 0x6a, 0x0a, 0xf0, 0x5d, 0xd0, 0x09, 0x86, 0x5e, 0x13, 0x09, 0x86, 0x5e, 0x03, 0x56, 0x08, 0x86, 0x5e, 0xc0, 0x07,
+    0xed, 0x5d, 0xc0, 0x07, 0x30, 0x5d, 0x03, 0xc0, 0x07, 0x73, 0x5c, 0x5a, 0x08, 0xdd, 0x5b, 0x16, 0x09, 0xdd, 0x5b, 0x03, 0xd0, 0x09, 0xe0, 0x5b,
+    0x6a, 0x0a, 0x76, 0x5c, 0x6a, 0x0a, 0x33, 0x5d, 0x04, 0x06, 0x00, 0xc6, 0x80, 0x80, 0x0b, 0x0a, 0xeb, 0x5a, 0xb5, 0x0c, 0x95, 0x5d, 0x09, 0x00,
+    0x07, 0x0d, 0x0a, 0xed, 0x5a, 0xa6, 0x02, 0xa6, 0x02, 0x06, 0x00, 0xc7, 0x80, 0x7f, 0x58, 0x0c, 0xdf, 0x5b, 0x01, 0x0f, 0x88, 0x5e, 0x09, 0x00,
+    0x07, 0x5a, 0x0c, 0xe0, 0x5b, 0xa6, 0x02, 0xa6, 0x02, 0x06, 0x02, 0xc8, 0x80, 0x80, 0xe5, 0x07, 0x05, 0x5c, 0xdb, 0x0e, 0xfb, 0x62, 0x09, 0x00,
+    0x07, 0xe6, 0x07, 0x06, 0x5c, 0xf3, 0x06, 0xf3, 0x06, 0x06, 0x03, 0xc7, 0x80, 0x80, 0x62, 0x4a, 0xa2, 0x07, 0x1e, 0x4d, 0x5e, 0x0a, 0x09, 0x00,
+    0x07, 0x63, 0x4a, 0xa3, 0x07, 0xba, 0x02, 0xba, 0x02, 0x06, 0x03, 0xc7, 0x80, 0x80, 0xc2, 0x48, 0x72, 0x0a, 0x7e, 0x4b, 0x2e, 0x0d, 0x09, 0x00,
+    0x07, 0xc3, 0x48, 0x73, 0x0a, 0xba, 0x02, 0xba, 0x02, 0x06, 0x03, 0xc7, 0x80, 0x80, 0x82, 0x45, 0x72, 0x0a, 0x3e, 0x48, 0x2e, 0x0d, 0x09, 0x00,
+    0x07, 0x83, 0x45, 0x73, 0x0a, 0xba, 0x02, 0xba, 0x02, 0x06, 0x03, 0xc7, 0x80, 0x80, 0xe2, 0x43, 0xa2, 0x07, 0x9e, 0x46, 0x5e, 0x0a, 0x09, 0x00,
+    0x07, 0xe3, 0x43, 0xa3, 0x07, 0xba, 0x02, 0xba, 0x02, 0x06, 0x03, 0xc7, 0x80, 0x80, 0x82, 0x45, 0xd2, 0x04, 0x3e, 0x48, 0x8e, 0x07, 0x09, 0x00,
+    0x07, 0x83, 0x45, 0xd3, 0x04, 0xba, 0x02, 0xba, 0x02, 0x06, 0x03, 0xc7, 0x80, 0x80, 0xc2, 0x48, 0xd2, 0x04, 0x7e, 0x4b, 0x8e, 0x07, 0x09, 0x00,
+    0x07, 0xc3, 0x48, 0xd3, 0x04, 0xba, 0x02, 0xba, 0x02, 0x06, 0x06, 0xc7, 0x7f, 0x7f, 0xc0, 0x45, 0x47, 0x06, 0x3d, 0x4b, 0xbd, 0x0b, 0x09, 0x00,
+    0x07, 0xc2, 0x45, 0x48, 0x06, 0x7a, 0x05, 0x73, 0x05, 0x06, 0x04, 0xbf, 0x80, 0x7f, 0x0b, 0x18, 0xcb, 0x47, 0xb5, 0x18, 0x75, 0x48, 0x3a, 0x00,
+    0x01, 0xb3, 0x18, 0x20, 0x48, 0x03, 0xb3, 0x18, 0x4d, 0x48, 0x8d, 0x18, 0x73, 0x48, 0x60, 0x18, 0x73, 0x48, 0x03, 0x33, 0x18, 0x73, 0x48, 0x0d,
+    0x18, 0x4d, 0x48, 0x0d, 0x18, 0x20, 0x48, 0x03, 0x0d, 0x18, 0xf3, 0x47, 0x33, 0x18, 0xcd, 0x47, 0x60, 0x18, 0xcd, 0x47, 0x03, 0x8d, 0x18, 0xcd,
+    0x47, 0xb3, 0x18, 0xf0, 0x47, 0xb3, 0x18, 0x20, 0x48, 0x04, 0x06, 0x04, 0xc0, 0x80, 0x7f, 0xd5, 0x17, 0x9b, 0x48, 0x7e, 0x18, 0x45, 0x49, 0x3a,
+    0x00, 0x01, 0x7d, 0x18, 0xf0, 0x48, 0x03, 0x7d, 0x18, 0x1d, 0x49, 0x56, 0x18, 0x43, 0x49, 0x2a, 0x18, 0x43, 0x49, 0x03, 0xfd, 0x17, 0x43, 0x49,
+    0xd6, 0x17, 0x1d, 0x49, 0xd6, 0x17, 0xf0, 0x48, 0x03, 0xd6, 0x17, 0xc3, 0x48, 0xfd, 0x17, 0x9d, 0x48, 0x2a, 0x18, 0x9d, 0x48, 0x03, 0x56, 0x18,
+    0x9d, 0x48, 0x7d, 0x18, 0xc0, 0x48, 0x7d, 0x18, 0xf0, 0x48, 0x04, 0x06, 0x04, 0xbd, 0x80, 0x81, 0x3b, 0x17, 0x32, 0x49, 0xe5, 0x17, 0xde, 0x49,
+    0x3a, 0x00, 0x01, 0xe3, 0x17, 0x8a, 0x49, 0x03, 0xe3, 0x17, 0xb6, 0x49, 0xbd, 0x17, 0xdd, 0x49, 0x90, 0x17, 0xdd, 0x49, 0x03, 0x63, 0x17, 0xdd,
+    0x49, 0x3d, 0x17, 0xb6, 0x49, 0x3d, 0x17, 0x8a, 0x49, 0x03, 0x3d, 0x17, 0x5d, 0x49, 0x63, 0x17, 0x36, 0x49, 0x90, 0x17, 0x36, 0x49, 0x03, 0xbd,
+    0x17, 0x33, 0x49, 0xe3, 0x17, 0x5a, 0x49, 0xe3, 0x17, 0x8a, 0x49, 0x04, 0x06, 0x04, 0xbf, 0x80, 0x7f, 0x6b, 0x16, 0x6b, 0x49, 0x15, 0x17, 0x15,
+    0x4a, 0x3a, 0x00, 0x01, 0x13, 0x17, 0xc0, 0x49, 0x03, 0x13, 0x17, 0xed, 0x49, 0xed, 0x16, 0x13, 0x4a, 0xc0, 0x16, 0x13, 0x4a, 0x03, 0x93, 0x16,
+    0x13, 0x4a, 0x6d, 0x16, 0xed, 0x49, 0x6d, 0x16, 0xc0, 0x49, 0x03, 0x6d, 0x16, 0x93, 0x49, 0x93, 0x16, 0x6d, 0x49, 0xc0, 0x16, 0x6d, 0x49, 0x03,
+    0xed, 0x16, 0x6d, 0x49, 0x13, 0x17, 0x90, 0x49, 0x13, 0x17, 0xc0, 0x49, 0x04, 0x06, 0x04, 0xbd, 0x80, 0x81, 0x9b, 0x15, 0x32, 0x49, 0x45, 0x16,
+    0xde, 0x49, 0x3a, 0x00, 0x01, 0x43, 0x16, 0x8a, 0x49, 0x03, 0x43, 0x16, 0xb6, 0x49, 0x1d, 0x16, 0xdd, 0x49, 0xf0, 0x15, 0xdd, 0x49, 0x03, 0xc3,
+    0x15, 0xdd, 0x49, 0x9d, 0x15, 0xb6, 0x49, 0x9d, 0x15, 0x8a, 0x49, 0x03, 0x9d, 0x15, 0x5d, 0x49, 0xc3, 0x15, 0x36, 0x49, 0xf0, 0x15, 0x36, 0x49,
+    0x03, 0x1d, 0x16, 0x33, 0x49, 0x43, 0x16, 0x5a, 0x49, 0x43, 0x16, 0x8a, 0x49, 0x04, 0x06, 0x04, 0xc0, 0x80, 0x7f, 0x05, 0x15, 0x9b, 0x48, 0xae,
+    0x15, 0x45, 0x49, 0x3a, 0x00, 0x01, 0xad, 0x15, 0xf0, 0x48, 0x03, 0xad, 0x15, 0x1d, 0x49, 0x86, 0x15, 0x43, 0x49, 0x5a, 0x15, 0x43, 0x49, 0x03,
+    0x2d, 0x15, 0x43, 0x49, 0x06, 0x15, 0x1d, 0x49, 0x06, 0x15, 0xf0, 0x48, 0x03, 0x06, 0x15, 0xc3, 0x48, 0x2d, 0x15, 0x9d, 0x48, 0x5a, 0x15, 0x9d,
+    0x48, 0x03, 0x86, 0x15, 0x9d, 0x48, 0xad, 0x15, 0xc0, 0x48, 0xad, 0x15, 0xf0, 0x48, 0x04, 0x06, 0x04, 0xbf, 0x80, 0x7f, 0xcb, 0x14, 0xcb, 0x47,
+    0x75, 0x15, 0x75, 0x48, 0x3a, 0x00, 0x01, 0x73, 0x15, 0x20, 0x48, 0x03, 0x73, 0x15, 0x4d, 0x48, 0x4d, 0x15, 0x73, 0x48, 0x20, 0x15, 0x73, 0x48,
+    0x03, 0xf3, 0x14, 0x73, 0x48, 0xcd, 0x14, 0x4d, 0x48, 0xcd, 0x14, 0x20, 0x48, 0x03, 0xcd, 0x14, 0xf3, 0x47, 0xf3, 0x14, 0xcd, 0x47, 0x20, 0x15,
+    0xcd, 0x47, 0x03, 0x4d, 0x15, 0xcd, 0x47, 0x73, 0x15, 0xf0, 0x47, 0x73, 0x15, 0x20, 0x48, 0x04, 0x06, 0x04, 0xc0, 0x80, 0x7f, 0x05, 0x15, 0xfb,
+    0x46, 0xae, 0x15, 0xa5, 0x47, 0x3a, 0x00, 0x01, 0xad, 0x15, 0x50, 0x47, 0x03, 0xad, 0x15, 0x7d, 0x47, 0x86, 0x15, 0xa3, 0x47, 0x5a, 0x15, 0xa3,
+    0x47, 0x03, 0x2d, 0x15, 0xa3, 0x47, 0x06, 0x15, 0x7d, 0x47, 0x06, 0x15, 0x50, 0x47, 0x03, 0x06, 0x15, 0x23, 0x47, 0x2d, 0x15, 0xfd, 0x46, 0x5a,
+    0x15, 0xfd, 0x46, 0x03, 0x86, 0x15, 0xfd, 0x46, 0xad, 0x15, 0x20, 0x47, 0xad, 0x15, 0x50, 0x47, 0x04, 0x06, 0x04, 0xbf, 0x7f, 0x7f, 0x9b, 0x15,
+    0x62, 0x46, 0x45, 0x16, 0x0b, 0x47, 0x3a, 0x00, 0x01, 0x43, 0x16, 0xb6, 0x46, 0x03, 0x43, 0x16, 0xe3, 0x46, 0x1d, 0x16, 0x0a, 0x47, 0xf0, 0x15,
+    0x0a, 0x47, 0x03, 0xc3, 0x15, 0x0a, 0x47, 0x9d, 0x15, 0xe3, 0x46, 0x9d, 0x15, 0xb6, 0x46, 0x03, 0x9d, 0x15, 0x8a, 0x46, 0xc3, 0x15, 0x63, 0x46,
+    0xf0, 0x15, 0x63, 0x46, 0x03, 0x1d, 0x16, 0x63, 0x46, 0x43, 0x16, 0x8a, 0x46, 0x43, 0x16, 0xb6, 0x46, 0x04, 0x06, 0x04, 0xbf, 0x80, 0x7f, 0x6b,
+    0x16, 0x2b, 0x46, 0x15, 0x17, 0xd5, 0x46, 0x3a, 0x00, 0x01, 0x13, 0x17, 0x80, 0x46, 0x03, 0x13, 0x17, 0xad, 0x46, 0xed, 0x16, 0xd3, 0x46, 0xc0,
+    0x16, 0xd3, 0x46, 0x03, 0x93, 0x16, 0xd3, 0x46, 0x6d, 0x16, 0xad, 0x46, 0x6d, 0x16, 0x80, 0x46, 0x03, 0x6d, 0x16, 0x53, 0x46, 0x93, 0x16, 0x2d,
+    0x46, 0xc0, 0x16, 0x2d, 0x46, 0x03, 0xed, 0x16, 0x2d, 0x46, 0x13, 0x17, 0x50, 0x46, 0x13, 0x17, 0x80, 0x46, 0x04, 0x06, 0x04, 0xbf, 0x7f, 0x7f,
+    0x3b, 0x17, 0x62, 0x46, 0xe5, 0x17, 0x0b, 0x47, 0x3a, 0x00, 0x01, 0xe3, 0x17, 0xb6, 0x46, 0x03, 0xe3, 0x17, 0xe3, 0x46, 0xbd, 0x17, 0x0a, 0x47,
+    0x90, 0x17, 0x0a, 0x47, 0x03, 0x63, 0x17, 0x0a, 0x47, 0x3d, 0x17, 0xe3, 0x46, 0x3d, 0x17, 0xb6, 0x46, 0x03, 0x3d, 0x17, 0x8a, 0x46, 0x63, 0x17,
+    0x63, 0x46, 0x90, 0x17, 0x63, 0x46, 0x03, 0xbd, 0x17, 0x63, 0x46, 0xe3, 0x17, 0x8a, 0x46, 0xe3, 0x17, 0xb6, 0x46, 0x04, 0x06, 0x04, 0xc0, 0x80,
+    0x7f, 0xd5, 0x17, 0xfb, 0x46, 0x7e, 0x18, 0xa5, 0x47, 0x3a, 0x00, 0x01, 0x7d, 0x18, 0x50, 0x47, 0x03, 0x7d, 0x18, 0x7d, 0x47, 0x56, 0x18, 0xa3,
+    0x47, 0x2a, 0x18, 0xa3, 0x47, 0x03, 0xfd, 0x17, 0xa3, 0x47, 0xd6, 0x17, 0x7d, 0x47, 0xd6, 0x17, 0x50, 0x47, 0x03, 0xd6, 0x17, 0x23, 0x47, 0xfd,
+    0x17, 0xfd, 0x46, 0x2a, 0x18, 0xfd, 0x46, 0x03, 0x56, 0x18, 0xfd, 0x46, 0x7d, 0x18, 0x20, 0x47, 0x7d, 0x18, 0x50, 0x47, 0x04, 0x06, 0x03, 0xc6,
+    0x80, 0x80, 0x7b, 0x15, 0xdb, 0x46, 0x05, 0x18, 0x65, 0x49, 0x09, 0x00, 0x07, 0x7d, 0x15, 0xdd, 0x46, 0x86, 0x02, 0x86, 0x02, 0x06, 0x00, 0xc5,
+    0x7f, 0x80, 0x5f, 0x19, 0x3f, 0x51, 0x61, 0x1a, 0x41, 0x52, 0x09, 0x00, 0x07, 0x60, 0x19, 0x40, 0x51, 0x00, 0x01, 0x00, 0x01, 0x06, 0x00, 0xc4,
+    0x7f, 0x80, 0x12, 0x19, 0x5f, 0x52, 0x15, 0x1a, 0x61, 0x53, 0x09, 0x00, 0x07, 0x13, 0x19, 0x60, 0x52, 0x00, 0x01, 0x00, 0x01, 0x06, 0x00, 0xc4,
+    0x80, 0x7f, 0x3f, 0x18, 0x32, 0x53, 0x41, 0x19, 0x35, 0x54, 0x09, 0x00, 0x07, 0x40, 0x18, 0x33, 0x53, 0x00, 0x01, 0x00, 0x01, 0x06, 0x00, 0xc5,
+    0x80, 0x80, 0x1f, 0x17, 0x7f, 0x53, 0x21, 0x18, 0x81, 0x54, 0x09, 0x00, 0x07, 0x20, 0x17, 0x80, 0x53, 0x00, 0x01, 0x00, 0x01, 0x06, 0x00, 0xc4,
+    0x80, 0x7f, 0xff, 0x15, 0x32, 0x53, 0x01, 0x17, 0x35, 0x54, 0x09, 0x00, 0x07, 0x00, 0x16, 0x33, 0x53, 0x00, 0x01, 0x00, 0x01, 0x06, 0x00, 0xc4,
+    0x80, 0x80, 0x2b, 0x15, 0x5f, 0x52, 0x2e, 0x16, 0x61, 0x53, 0x09, 0x00, 0x07, 0x2d, 0x15, 0x60, 0x52, 0x00, 0x01, 0x00, 0x01, 0x06, 0x00, 0xc5,
+    0x80, 0x80, 0xdf, 0x14, 0x3f, 0x51, 0xe1, 0x15, 0x41, 0x52, 0x09, 0x00, 0x07, 0xe0, 0x14, 0x40, 0x51, 0x00, 0x01, 0x00, 0x01, 0x06, 0x00, 0xc4,
+    0x80, 0x80, 0x2b, 0x15, 0x1f, 0x50, 0x2e, 0x16, 0x21, 0x51, 0x09, 0x00, 0x07, 0x2d, 0x15, 0x20, 0x50, 0x00, 0x01, 0x00, 0x01, 0x06, 0x00, 0xc4,
+    0x80, 0x80, 0xff, 0x15, 0x4b, 0x4f, 0x01, 0x17, 0x4e, 0x50, 0x09, 0x00, 0x07, 0x00, 0x16, 0x4d, 0x4f, 0x00, 0x01, 0x00, 0x01, 0x06, 0x00, 0xc5,
+    0x80, 0x80, 0x1f, 0x17, 0xff, 0x4e, 0x21, 0x18, 0x01, 0x50, 0x09, 0x00, 0x07, 0x20, 0x17, 0x00, 0x4f, 0x00, 0x01, 0x00, 0x01, 0x06, 0x00, 0xc4,
+    0x80, 0x80, 0x3f, 0x18, 0x4b, 0x4f, 0x41, 0x19, 0x4e, 0x50, 0x09, 0x00, 0x07, 0x40, 0x18, 0x4d, 0x4f, 0x00, 0x01, 0x00, 0x01, 0x06, 0x00, 0xc4,
+    0x7f, 0x80, 0x12, 0x19, 0x1f, 0x50, 0x15, 0x1a, 0x21, 0x51, 0x09, 0x00, 0x07, 0x13, 0x19, 0x20, 0x50, 0x00, 0x01, 0x00, 0x01, 0x06, 0x03, 0xc7,
+    0x80, 0x80, 0xaf, 0x15, 0xcf, 0x4f, 0x91, 0x19, 0xb1, 0x53, 0x09, 0x00, 0x07, 0xb0, 0x15, 0xd0, 0x4f, 0xe0, 0x03, 0xe0, 0x03, 0x01, 0x03, 0x1e,
+    0x2a, 0x5e, 0x08, 0x04, 0xe0, 0x06, 0x06, 0x04, 0xc5, 0x80, 0x80, 0x5d, 0xff, 0x60, 0xff, 0xa3, 0x00, 0xa0, 0x00, 0x09, 0x00, 0x07, 0x5e, 0xff,
+    0x62, 0xff, 0x43, 0x01, 0x3d, 0x01, 0x02, 0x01, 0x03, 0x8e, 0x29, 0x8b, 0x09, 0x04, 0xe0, 0x06, 0x06, 0x04, 0xc5, 0x80, 0x80, 0x5d, 0xff, 0x60,
+    0xff, 0xa3, 0x00, 0xa0, 0x00, 0x09, 0x00, 0x07, 0x5e, 0xff, 0x62, 0xff, 0x43, 0x01, 0x3d, 0x01, 0x02, 0x01, 0x03, 0x48, 0x28, 0xd5, 0x09, 0x04,
+    0xe0, 0x06, 0x06, 0x04, 0xc5, 0x80, 0x80, 0x5d, 0xff, 0x60, 0xff, 0xa3, 0x00, 0xa0, 0x00, 0x09, 0x00, 0x07, 0x5e, 0xff, 0x62, 0xff, 0x43, 0x01,
+    0x3d, 0x01, 0x02, 0x01, 0x03, 0x45, 0x27, 0x05, 0x09, 0x04, 0xe0, 0x06, 0x06, 0x04, 0xc5, 0x80, 0x80, 0x5d, 0xff, 0x60, 0xff, 0xa3, 0x00, 0xa0,
+    0x00, 0x09, 0x00, 0x07, 0x5e, 0xff, 0x62, 0xff, 0x43, 0x01, 0x3d, 0x01, 0x02, 0x01, 0x03, 0x45, 0x27, 0xb8, 0x07, 0x04, 0xe0, 0x06, 0x06, 0x04,
+    0xc5, 0x80, 0x80, 0x5d, 0xff, 0x60, 0xff, 0xa3, 0x00, 0xa0, 0x00, 0x09, 0x00, 0x07, 0x5e, 0xff, 0x62, 0xff, 0x43, 0x01, 0x3d, 0x01, 0x02, 0x01,
+    0x03, 0x48, 0x28, 0xe8, 0x06, 0x04, 0xe0, 0x06, 0x06, 0x04, 0xc5, 0x80, 0x80, 0x5d, 0xff, 0x60, 0xff, 0xa3, 0x00, 0xa0, 0x00, 0x09, 0x00, 0x07,
+    0x5e, 0xff, 0x62, 0xff, 0x43, 0x01, 0x3d, 0x01, 0x02, 0x01, 0x03, 0x8e, 0x29, 0x32, 0x07, 0x04, 0xe0, 0x06, 0x06, 0x04, 0xc5, 0x80, 0x80, 0x5d,
+    0xff, 0x60, 0xff, 0xa3, 0x00, 0xa0, 0x00, 0x09, 0x00, 0x07, 0x5e, 0xff, 0x62, 0xff, 0x43, 0x01, 0x3d, 0x01, 0x02, 0x06, 0x03, 0xc7, 0x80, 0x80,
+    0x2f, 0x27, 0xef, 0x06, 0x11, 0x2a, 0xd1, 0x09, 0x09, 0x00, 0x07, 0x30, 0x27, 0xf0, 0x06, 0xe0, 0x02, 0xe0, 0x02, 0x01, 0x03, 0x5e, 0x06, 0xbe,
+    0x27, 0x04, 0xdb, 0x06, 0x06, 0x03, 0xc4, 0x80, 0x80, 0x7a, 0xff, 0x7d, 0xff, 0x86, 0x00, 0x83, 0x00, 0x09, 0x00, 0x07, 0x7b, 0xff, 0x7e, 0xff,
+    0x0a, 0x01, 0x03, 0x01, 0x02, 0x01, 0x03, 0xe8, 0x05, 0x08, 0x29, 0x04, 0xdb, 0x06, 0x06, 0x03, 0xc4, 0x80, 0x80, 0x7a, 0xff, 0x7d, 0xff, 0x86,
+    0x00, 0x83, 0x00, 0x09, 0x00, 0x07, 0x7b, 0xff, 0x7e, 0xff, 0x0a, 0x01, 0x03, 0x01, 0x02, 0x01, 0x03, 0xb8, 0x04, 0xb8, 0x29, 0x04, 0xdb, 0x06,
+    0x06, 0x03, 0xc4, 0x80, 0x80, 0x7a, 0xff, 0x7d, 0xff, 0x86, 0x00, 0x83, 0x00, 0x09, 0x00, 0x07, 0x7b, 0xff, 0x7e, 0xff, 0x0a, 0x01, 0x03, 0x01,
+    0x02, 0x01, 0x03, 0x5e, 0x03, 0x7b, 0x29, 0x04, 0xdb, 0x06, 0x06, 0x03, 0xc4, 0x80, 0x80, 0x7a, 0xff, 0x7d, 0xff, 0x86, 0x00, 0x83, 0x00, 0x09,
+    0x00, 0x07, 0x7b, 0xff, 0x7e, 0xff, 0x0a, 0x01, 0x03, 0x01, 0x02, 0x01, 0x03, 0x7e, 0x02, 0x6e, 0x28, 0x04, 0xdb, 0x06, 0x06, 0x03, 0xc4, 0x80,
+    0x80, 0x7a, 0xff, 0x7d, 0xff, 0x86, 0x00, 0x83, 0x00, 0x09, 0x00, 0x07, 0x7b, 0xff, 0x7e, 0xff, 0x0a, 0x01, 0x03, 0x01, 0x02, 0x01, 0x03, 0x7e,
+    0x02, 0x0e, 0x27, 0x04, 0xdb, 0x06, 0x06, 0x03, 0xc4, 0x80, 0x80, 0x7a, 0xff, 0x7d, 0xff, 0x86, 0x00, 0x83, 0x00, 0x09, 0x00, 0x07, 0x7b, 0xff,
+    0x7e, 0xff, 0x0a, 0x01, 0x03, 0x01, 0x02, 0x01, 0x03, 0x5e, 0x03, 0x02, 0x26, 0x04, 0xdb, 0x06, 0x06, 0x03, 0xc4, 0x80, 0x80, 0x7a, 0xff, 0x7d,
+    0xff, 0x86, 0x00, 0x83, 0x00, 0x09, 0x00, 0x07, 0x7b, 0xff, 0x7e, 0xff, 0x0a, 0x01, 0x03, 0x01, 0x02, 0x01, 0x03, 0xb8, 0x04, 0xc5, 0x25, 0x04,
+    0xdb, 0x06, 0x06, 0x03, 0xc4, 0x80, 0x80, 0x7a, 0xff, 0x7d, 0xff, 0x86, 0x00, 0x83, 0x00, 0x09, 0x00, 0x07, 0x7b, 0xff, 0x7e, 0xff, 0x0a, 0x01,
+    0x03, 0x01, 0x02, 0x01, 0x03, 0xe8, 0x05, 0x75, 0x26, 0x04, 0xdb, 0x06, 0x06, 0x03, 0xc4, 0x80, 0x80, 0x7a, 0xff, 0x7d, 0xff, 0x86, 0x00, 0x83,
+    0x00, 0x09, 0x00, 0x07, 0x7b, 0xff, 0x7e, 0xff, 0x0a, 0x01, 0x03, 0x01, 0x02, 0x06, 0x00, 0xc7, 0x80, 0x80, 0xdd, 0x02, 0x40, 0x26, 0xe3, 0x05,
+    0x40, 0x29, 0x09, 0x00, 0x07, 0xde, 0x02, 0x42, 0x26, 0x03, 0x03, 0xfd, 0x02, 0x06, 0x00, 0xc5, 0x80, 0x80, 0x85, 0x3f, 0xc5, 0x36, 0xbb, 0x40,
+    0xfb, 0x37, 0x09, 0x00, 0x07, 0x86, 0x3f, 0xc6, 0x36, 0x33, 0x01, 0x33, 0x01, 0x06, 0x00, 0xc3, 0x80, 0x80, 0xf5, 0x3e, 0xef, 0x37, 0x2b, 0x40,
+    0x28, 0x39, 0x3a, 0x00, 0x01, 0x2a, 0x40, 0x8d, 0x38, 0x03, 0x2a, 0x40, 0xe3, 0x38, 0xe3, 0x3f, 0x26, 0x39, 0x90, 0x3f, 0x26, 0x39, 0x03, 0x3a,
+    0x3f, 0x26, 0x39, 0xf6, 0x3e, 0xe0, 0x38, 0xf6, 0x3e, 0x8d, 0x38, 0x03, 0xf6, 0x3e, 0x3a, 0x38, 0x3d, 0x3f, 0xf3, 0x37, 0x90, 0x3f, 0xf3, 0x37,
+    0x03, 0xe6, 0x3f, 0xf0, 0x37, 0x2a, 0x40, 0x36, 0x38, 0x2a, 0x40, 0x8d, 0x38, 0x04, 0x06, 0x00, 0xc4, 0x7f, 0x80, 0xaf, 0x3d, 0x3b, 0x38, 0xe8,
+    0x3e, 0x75, 0x39, 0x09, 0x00, 0x07, 0xb0, 0x3d, 0x3d, 0x38, 0x36, 0x01, 0x36, 0x01, 0x06, 0x00, 0xc5, 0x80, 0x80, 0xab, 0x3c, 0x6b, 0x37, 0xe1,
+    0x3d, 0xa1, 0x38, 0x09, 0x00, 0x07, 0xad, 0x3c, 0x6d, 0x37, 0x33, 0x01, 0x33, 0x01, 0x06, 0x00, 0xc5, 0x80, 0x7f, 0xab, 0x3c, 0x1f, 0x36, 0xe1,
+    0x3d, 0x55, 0x37, 0x09, 0x00, 0x07, 0xad, 0x3c, 0x20, 0x36, 0x33, 0x01, 0x33, 0x01, 0x06, 0x00, 0xc5, 0x7f, 0x7f, 0xaf, 0x3d, 0x4f, 0x35, 0xe8,
+    0x3e, 0x88, 0x36, 0x09, 0x00, 0x07, 0xb0, 0x3d, 0x50, 0x35, 0x36, 0x01, 0x36, 0x01, 0x06, 0x00, 0xc5, 0x80, 0x80, 0xf5, 0x3e, 0x98, 0x35, 0x2b,
+    0x40, 0xce, 0x36, 0x09, 0x00, 0x07, 0xf6, 0x3e, 0x9a, 0x35, 0x33, 0x01, 0x33, 0x01, 0x06, 0x06, 0xc7, 0x80, 0x7f, 0x38, 0x3d, 0xf8, 0x35, 0x08,
+    0x40, 0xc8, 0x38, 0x09, 0x00, 0x07, 0x3a, 0x3d, 0xfa, 0x35, 0xcd, 0x02, 0xcd, 0x02, 0x06, 0x02, 0xc7, 0x80, 0x80, 0xd8, 0x04, 0x78, 0x06, 0x28,
+    0x08, 0xc8, 0x09, 0x09, 0x00, 0x07, 0xda, 0x04, 0x7a, 0x06, 0x4d, 0x03, 0x4d, 0x03, 0x06, 0x02, 0xc7, 0x7f, 0x7f, 0x15, 0x02, 0x45, 0x0a, 0x65,
+    0x05, 0x95, 0x0d, 0x09, 0x00, 0x07, 0x16, 0x02, 0x46, 0x0a, 0x4d, 0x03, 0x4d, 0x03, 0x06, 0x02, 0xc7, 0x80, 0x80, 0x9b, 0xfd, 0xd2, 0x08, 0xeb,
+    0x00, 0x21, 0x0c, 0x09, 0x00, 0x07, 0x9d, 0xfd, 0xd3, 0x08, 0x4d, 0x03, 0x4d, 0x03, 0x06, 0x02, 0xc7, 0x80, 0x7f, 0x9b, 0xfd, 0x1f, 0x04, 0xeb,
+    0x00, 0x6e, 0x07, 0x09, 0x00, 0x07, 0x9d, 0xfd, 0x20, 0x04, 0x4d, 0x03, 0x4d, 0x03, 0x06, 0x02, 0xc7, 0x7f, 0x80, 0x15, 0x02, 0xab, 0x02, 0x65,
+    0x05, 0xfb, 0x05, 0x09, 0x00, 0x07, 0x16, 0x02, 0xad, 0x02, 0x4d, 0x03, 0x4d, 0x03, 0x06, 0x06, 0xc7, 0x80, 0x80, 0xb0, 0xff, 0x53, 0x05, 0x50,
+    0x05, 0xed, 0x0a, 0x09, 0x00, 0x07, 0xb2, 0xff, 0x55, 0x05, 0x9d, 0x05, 0x96, 0x05, 0x06, 0x04, 0xc4, 0x80, 0x80, 0x98, 0x4c, 0xb8, 0x35, 0xa8,
+    0x4d, 0xc8, 0x36, 0x09, 0x00, 0x07, 0x9a, 0x4c, 0xba, 0x35, 0x0d, 0x01, 0x0d, 0x01, 0x06, 0x04, 0xc4, 0x80, 0x80, 0x3b, 0x4c, 0xd2, 0x36, 0x4b,
+    0x4d, 0xe1, 0x37, 0x09, 0x00, 0x07, 0x3d, 0x4c, 0xd3, 0x36, 0x0d, 0x01, 0x0d, 0x01, 0x06, 0x04, 0xc4, 0x80, 0x80, 0x4b, 0x4b, 0x82, 0x37, 0x5b,
+    0x4c, 0x91, 0x38, 0x09, 0x00, 0x07, 0x4d, 0x4b, 0x83, 0x37, 0x0d, 0x01, 0x0d, 0x01, 0x06, 0x04, 0xc5, 0x80, 0x80, 0x22, 0x4a, 0x82, 0x37, 0x31,
+    0x4b, 0x91, 0x38, 0x09, 0x00, 0x07, 0x23, 0x4a, 0x83, 0x37, 0x0d, 0x01, 0x0d, 0x01, 0x06, 0x04, 0xc5, 0x80, 0x80, 0x32, 0x49, 0xd2, 0x36, 0x41,
+    0x4a, 0xe1, 0x37, 0x09, 0x00, 0x07, 0x33, 0x49, 0xd3, 0x36, 0x0d, 0x01, 0x0d, 0x01, 0x06, 0x04, 0xc4, 0x80, 0x80, 0xd8, 0x48, 0xb8, 0x35, 0xe8,
+    0x49, 0xc8, 0x36, 0x09, 0x00, 0x07, 0xda, 0x48, 0xba, 0x35, 0x0d, 0x01, 0x0d, 0x01, 0x06, 0x04, 0xc5, 0x80, 0x7f, 0x32, 0x49, 0x9f, 0x34, 0x41,
+    0x4a, 0xae, 0x35, 0x09, 0x00, 0x07, 0x33, 0x49, 0xa0, 0x34, 0x0d, 0x01, 0x0d, 0x01, 0x06, 0x04, 0xc4, 0x80, 0x7f, 0x22, 0x4a, 0xef, 0x33, 0x31,
+    0x4b, 0xfe, 0x34, 0x3a, 0x00, 0x01, 0x30, 0x4b, 0x76, 0x34, 0x03, 0x30, 0x4b, 0xc0, 0x34, 0xf3, 0x4a, 0xfd, 0x34, 0xaa, 0x4a, 0xfd, 0x34, 0x03,
+    0x60, 0x4a, 0xfd, 0x34, 0x23, 0x4a, 0xc0, 0x34, 0x23, 0x4a, 0x76, 0x34, 0x03, 0x23, 0x4a, 0x2d, 0x34, 0x60, 0x4a, 0xf0, 0x33, 0xaa, 0x4a, 0xf0,
+    0x33, 0x03, 0xf6, 0x4a, 0xf3, 0x33, 0x30, 0x4b, 0x2d, 0x34, 0x30, 0x4b, 0x76, 0x34, 0x04, 0x06, 0x04, 0xc3, 0x80, 0x80, 0x4b, 0x4b, 0xef, 0x33,
+    0x5b, 0x4c, 0xfe, 0x34, 0x3a, 0x00, 0x01, 0x5a, 0x4c, 0x76, 0x34, 0x03, 0x5a, 0x4c, 0xc0, 0x34, 0x1d, 0x4c, 0xfd, 0x34, 0xd3, 0x4b, 0xfd, 0x34,
+    0x03, 0x8a, 0x4b, 0xfd, 0x34, 0x4d, 0x4b, 0xc0, 0x34, 0x4d, 0x4b, 0x76, 0x34, 0x03, 0x4d, 0x4b, 0x2d, 0x34, 0x8a, 0x4b, 0xf0, 0x33, 0xd3, 0x4b,
+    0xf0, 0x33, 0x03, 0x1d, 0x4c, 0xf3, 0x33, 0x5a, 0x4c, 0x2d, 0x34, 0x5a, 0x4c, 0x76, 0x34, 0x04, 0x06, 0x04, 0xc4, 0x80, 0x7f, 0x3b, 0x4c, 0x9f,
+    0x34, 0x4b, 0x4d, 0xae, 0x35, 0x09, 0x00, 0x07, 0x3d, 0x4c, 0xa0, 0x34, 0x0d, 0x01, 0x0d, 0x01, 0x06, 0x03, 0xc7, 0x80, 0x80, 0x8f, 0x49, 0x8f,
+    0x34, 0xf1, 0x4c, 0xf1, 0x37, 0x09, 0x00, 0x07, 0x90, 0x49, 0x90, 0x34, 0x60, 0x03, 0x60, 0x03, 0x01, 0x03, 0x5e, 0x25, 0x3e, 0x00, 0x04, 0xe0,
+    0x06, 0x06, 0x03, 0xc5, 0x80, 0x80, 0x40, 0xff, 0x43, 0xff, 0xc0, 0x00, 0xbd, 0x00, 0x09, 0x00, 0x07, 0x42, 0xff, 0x45, 0xff, 0x7d, 0x01, 0x76,
+    0x01, 0x02, 0x01, 0x03, 0xa2, 0x24, 0x02, 0x02, 0x04, 0xe0, 0x06, 0x06, 0x03, 0xc5, 0x80, 0x80, 0x40, 0xff, 0x43, 0xff, 0xc0, 0x00, 0xbd, 0x00,
+    0x09, 0x00, 0x07, 0x42, 0xff, 0x45, 0xff, 0x7d, 0x01, 0x76, 0x01, 0x02, 0x01, 0x03, 0xde, 0x22, 0xbe, 0x02, 0x04, 0xe0, 0x06, 0x06, 0x03, 0xc5,
+    0x80, 0x80, 0x40, 0xff, 0x43, 0xff, 0xc0, 0x00, 0xbd, 0x00, 0x09, 0x00, 0x07, 0x42, 0xff, 0x45, 0xff, 0x7d, 0x01, 0x76, 0x01, 0x02, 0x06, 0x03,
+    0xc5, 0x7f, 0x80, 0x5f, 0x20, 0x45, 0x01, 0xdb, 0x21, 0xc1, 0x02, 0x3a, 0x00, 0x01, 0xda, 0x21, 0x03, 0x02, 0x03, 0xda, 0x21, 0x6d, 0x02, 0x86,
+    0x21, 0xc0, 0x02, 0x1d, 0x21, 0xc0, 0x02, 0x03, 0xb3, 0x20, 0xc0, 0x02, 0x60, 0x20, 0x6d, 0x02, 0x60, 0x20, 0x03, 0x02, 0x03, 0x60, 0x20, 0x9a,
+    0x01, 0xb3, 0x20, 0x46, 0x01, 0x1d, 0x21, 0x46, 0x01, 0x03, 0x83, 0x21, 0x46, 0x01, 0xd6, 0x21, 0x9d, 0x01, 0xda, 0x21, 0x03, 0x02, 0x04, 0x01,
+    0x03, 0x5e, 0x20, 0x3e, 0x00, 0x04, 0xe0, 0x06, 0x06, 0x03, 0xc5, 0x80, 0x80, 0x40, 0xff, 0x43, 0xff, 0xc0, 0x00, 0xbd, 0x00, 0x09, 0x00, 0x07,
+    0x42, 0xff, 0x45, 0xff, 0x7d, 0x01, 0x76, 0x01, 0x02, 0x06, 0x03, 0xc6, 0x7f, 0x80, 0x5f, 0x20, 0xbf, 0xfd, 0xdb, 0x21, 0x3b, 0xff, 0x3a, 0x00,
+    0x01, 0xda, 0x21, 0x7d, 0xfe, 0x03, 0xda, 0x21, 0xe6, 0xfe, 0x86, 0x21, 0x3a, 0xff, 0x1d, 0x21, 0x3a, 0xff, 0x03, 0xb3, 0x20, 0x3a, 0xff, 0x60,
+    0x20, 0xe6, 0xfe, 0x60, 0x20, 0x7d, 0xfe, 0x03, 0x60, 0x20, 0x13, 0xfe, 0xb3, 0x20, 0xc0, 0xfd, 0x1d, 0x21, 0xc0, 0xfd, 0x03, 0x83, 0x21, 0xc0,
+    0xfd, 0xd6, 0x21, 0x13, 0xfe, 0xda, 0x21, 0x7d, 0xfe, 0x04, 0x01, 0x03, 0xde, 0x22, 0xbe, 0xfd, 0x04, 0xe0, 0x06, 0x06, 0x03, 0xc5, 0x80, 0x80,
+    0x40, 0xff, 0x43, 0xff, 0xc0, 0x00, 0xbd, 0x00, 0x09, 0x00, 0x07, 0x42, 0xff, 0x45, 0xff, 0x7d, 0x01, 0x76, 0x01, 0x02, 0x01, 0x03, 0xa2, 0x24,
+    0x7b, 0xfe, 0x04, 0xe0, 0x06, 0x06, 0x03, 0xc5, 0x80, 0x80, 0x40, 0xff, 0x43, 0xff, 0xc0, 0x00, 0xbd, 0x00, 0x09, 0x00, 0x07, 0x42, 0xff, 0x45,
+    0xff, 0x7d, 0x01, 0x76, 0x01, 0x02, 0x06, 0x04, 0xc7, 0x80, 0x80, 0xf2, 0x20, 0x52, 0xfe, 0xce, 0x24, 0x2e, 0x02, 0x09, 0x00, 0x07, 0xf3, 0x20,
+    0x53, 0xfe, 0xda, 0x03, 0xda, 0x03, 0x01, 0x03, 0x02, 0x12, 0x22, 0x09, 0x04, 0xe5, 0x06, 0x06, 0x03, 0xc5, 0x80, 0x80, 0x33, 0xff, 0x30, 0xff,
+    0xcd, 0x00, 0xd0, 0x00, 0x09, 0x00, 0x07, 0x35, 0xff, 0x32, 0xff, 0x96, 0x01, 0x9d, 0x01, 0x02, 0x06, 0x03, 0xc5, 0x7f, 0x80, 0xaf, 0x10, 0xdb,
+    0x09, 0x4b, 0x12, 0x78, 0x0b, 0x3a, 0x00, 0x01, 0x4a, 0x12, 0xaa, 0x0a, 0x03, 0x4a, 0x12, 0x1a, 0x0b, 0xed, 0x11, 0x76, 0x0b, 0x7d, 0x11, 0x76,
+    0x0b, 0x03, 0x0d, 0x11, 0x76, 0x0b, 0xb0, 0x10, 0x1a, 0x0b, 0xb0, 0x10, 0xaa, 0x0a, 0x03, 0xb0, 0x10, 0x3a, 0x0a, 0x0d, 0x11, 0xdd, 0x09, 0x7d,
+    0x11, 0xdd, 0x09, 0x03, 0xf0, 0x11, 0xe0, 0x09, 0x4a, 0x12, 0x3a, 0x0a, 0x4a, 0x12, 0xaa, 0x0a, 0x04, 0x01, 0x03, 0x2e, 0x10, 0xa2, 0x0b, 0x04,
+    0xe5, 0x06, 0x06, 0x03, 0xc5, 0x80, 0x80, 0x33, 0xff, 0x30, 0xff, 0xcd, 0x00, 0xd0, 0x00, 0x09, 0x00, 0x07, 0x35, 0xff, 0x32, 0xff, 0x96, 0x01,
+    0x9d, 0x01, 0x02, 0x06, 0x03, 0xc6, 0x80, 0x80, 0xc2, 0x0d, 0xd2, 0x0a, 0x5e, 0x0f, 0x6e, 0x0c, 0x09, 0x00, 0x07, 0xc3, 0x0d, 0xd3, 0x0a, 0x9a,
+    0x01, 0x9a, 0x01, 0x06, 0x03, 0xc5, 0x7f, 0x80, 0x72, 0x0c, 0xdb, 0x09, 0x0e, 0x0e, 0x78, 0x0b, 0x3a, 0x00, 0x01, 0x0d, 0x0e, 0xaa, 0x0a, 0x03,
+    0x0d, 0x0e, 0x1a, 0x0b, 0xb3, 0x0d, 0x76, 0x0b, 0x40, 0x0d, 0x76, 0x0b, 0x03, 0xd0, 0x0c, 0x76, 0x0b, 0x73, 0x0c, 0x1d, 0x0b, 0x73, 0x0c, 0xaa,
+    0x0a, 0x03, 0x73, 0x0c, 0x36, 0x0a, 0xcd, 0x0c, 0xdd, 0x09, 0x40, 0x0d, 0xdd, 0x09, 0x03, 0xb0, 0x0d, 0xe0, 0x09, 0x0d, 0x0e, 0x3a, 0x0a, 0x0d,
+    0x0e, 0xaa, 0x0a, 0x04, 0x06, 0x03, 0xc6, 0x80, 0x80, 0xf2, 0x0b, 0x52, 0x08, 0x8e, 0x0d, 0xee, 0x09, 0x09, 0x00, 0x07, 0xf3, 0x0b, 0x53, 0x08,
+    0x9a, 0x01, 0x9a, 0x01, 0x06, 0x03, 0xc5, 0x80, 0x7f, 0x72, 0x0c, 0xc8, 0x06, 0x0e, 0x0e, 0x65, 0x08, 0x09, 0x00, 0x07, 0x73, 0x0c, 0xca, 0x06,
+    0x9a, 0x01, 0x9a, 0x01, 0x06, 0x03, 0xc5, 0x7f, 0x80, 0xc2, 0x0d, 0xd2, 0x05, 0x5e, 0x0f, 0x6e, 0x07, 0x3a, 0x00, 0x01, 0x5d, 0x0f, 0xa0, 0x06,
+    0x03, 0x5d, 0x0f, 0x10, 0x07, 0x03, 0x0f, 0x6d, 0x07, 0x90, 0x0e, 0x6d, 0x07, 0x03, 0x20, 0x0e, 0x6d, 0x07, 0xc3, 0x0d, 0x13, 0x07, 0xc3, 0x0d,
+    0xa0, 0x06, 0x03, 0xc3, 0x0d, 0x30, 0x06, 0x1d, 0x0e, 0xd3, 0x05, 0x90, 0x0e, 0xd3, 0x05, 0x03, 0x00, 0x0f, 0xd6, 0x05, 0x5d, 0x0f, 0x30, 0x06,
+    0x5d, 0x0f, 0xa0, 0x06, 0x04, 0x06, 0x03, 0xc5, 0x7f, 0x80, 0x5f, 0x0f, 0xd2, 0x05, 0xfb, 0x10, 0x6e, 0x07, 0x3a, 0x00, 0x01, 0xfa, 0x10, 0xa0,
+    0x06, 0x03, 0xfa, 0x10, 0x10, 0x07, 0x9d, 0x10, 0x6d, 0x07, 0x2d, 0x10, 0x6d, 0x07, 0x03, 0xbd, 0x0f, 0x6d, 0x07, 0x60, 0x0f, 0x10, 0x07, 0x60,
+    0x0f, 0xa0, 0x06, 0x03, 0x60, 0x0f, 0x30, 0x06, 0xbd, 0x0f, 0xd3, 0x05, 0x2d, 0x10, 0xd3, 0x05, 0x03, 0xa0, 0x10, 0xd6, 0x05, 0xfa, 0x10, 0x30,
+    0x06, 0xfa, 0x10, 0xa0, 0x06, 0x04, 0x01, 0x03, 0x7e, 0x11, 0x98, 0x07, 0x04, 0xe5, 0x06, 0x06, 0x03, 0xc5, 0x80, 0x80, 0x33, 0xff, 0x30, 0xff,
+    0xcd, 0x00, 0xd0, 0x00, 0x09, 0x00, 0x07, 0x35, 0xff, 0x32, 0xff, 0x96, 0x01, 0x9d, 0x01, 0x02, 0x06, 0x00, 0xc7, 0x7f, 0x80, 0xcb, 0x0c, 0x8b,
+    0x06, 0xf5, 0x11, 0xb5, 0x0b, 0x09, 0x00, 0x07, 0xcd, 0x0c, 0x8d, 0x06, 0x26, 0x05, 0x26, 0x05, 0x06, 0x02, 0xc4, 0x80, 0x80, 0xb8, 0x4d, 0x18,
+    0x22, 0xc8, 0x4e, 0x28, 0x23, 0x09, 0x00, 0x07, 0xba, 0x4d, 0x1a, 0x22, 0x0d, 0x01, 0x0d, 0x01, 0x06, 0x02, 0xc2, 0x80, 0x81, 0x72, 0x4d, 0x08,
+    0x23, 0x81, 0x4e, 0x1b, 0x24, 0x3a, 0x00, 0x01, 0x80, 0x4e, 0x93, 0x23, 0x03, 0x80, 0x4e, 0xdd, 0x23, 0x43, 0x4e, 0x1a, 0x24, 0xfa, 0x4d, 0x1a,
+    0x24, 0x03, 0xb0, 0x4d, 0x1a, 0x24, 0x73, 0x4d, 0xdd, 0x23, 0x73, 0x4d, 0x93, 0x23, 0x03, 0x73, 0x4d, 0x4a, 0x23, 0xb0, 0x4d, 0x0d, 0x23, 0xfa,
+    0x4d, 0x0d, 0x23, 0x03, 0x43, 0x4e, 0x0a, 0x23, 0x80, 0x4e, 0x46, 0x23, 0x80, 0x4e, 0x93, 0x23, 0x04, 0x06, 0x02, 0xc0, 0x81, 0x7e, 0xab, 0x4c,
+    0xaf, 0x23, 0xc1, 0x4d, 0xc5, 0x24, 0x3a, 0x00, 0x01, 0xc0, 0x4d, 0x36, 0x24, 0x03, 0xc0, 0x4d, 0x80, 0x24, 0x86, 0x4d, 0xbd, 0x24, 0x3a, 0x4d,
+    0xc0, 0x24, 0x03, 0xed, 0x4c, 0xc3, 0x24, 0xb3, 0x4c, 0x86, 0x24, 0xb0, 0x4c, 0x3a, 0x24, 0x03, 0xad, 0x4c, 0xed, 0x23, 0xea, 0x4c, 0xb3, 0x23,
+    0x36, 0x4d, 0xb0, 0x23, 0x03, 0x83, 0x4d, 0xb0, 0x23, 0xc0, 0x4d, 0xed, 0x23, 0xc0, 0x4d, 0x36, 0x24, 0x04, 0x06, 0x02, 0xc1, 0x80, 0x80, 0xb8,
+    0x4b, 0xd2, 0x23, 0xc8, 0x4c, 0xe5, 0x24, 0x3a, 0x00, 0x01, 0xc6, 0x4c, 0x5d, 0x24, 0x03, 0xc6, 0x4c, 0xa6, 0x24, 0x8a, 0x4c, 0xe3, 0x24, 0x40,
+    0x4c, 0xe3, 0x24, 0x03, 0xf6, 0x4b, 0xe3, 0x24, 0xba, 0x4b, 0xa6, 0x24, 0xba, 0x4b, 0x5d, 0x24, 0x03, 0xba, 0x4b, 0x13, 0x24, 0xf6, 0x4b, 0xd6,
+    0x23, 0x40, 0x4c, 0xd6, 0x23, 0x03, 0x8a, 0x4c, 0xd3, 0x23, 0xc6, 0x4c, 0x10, 0x24, 0xc6, 0x4c, 0x5d, 0x24, 0x04, 0x06, 0x02, 0xc4, 0x7f, 0x80,
+    0xd5, 0x4a, 0x6b, 0x23, 0xe5, 0x4b, 0x7b, 0x24, 0x09, 0x00, 0x07, 0xd6, 0x4a, 0x6d, 0x23, 0x0d, 0x01, 0x0d, 0x01, 0x06, 0x02, 0xc4, 0x80, 0x7f,
+    0x4b, 0x4a, 0x95, 0x22, 0x5b, 0x4b, 0xa5, 0x23, 0x09, 0x00, 0x07, 0x4d, 0x4a, 0x96, 0x22, 0x0d, 0x01, 0x0d, 0x01, 0x06, 0x02, 0xc1, 0x80, 0x81,
+    0x4b, 0x4a, 0x98, 0x21, 0x5b, 0x4b, 0xab, 0x22, 0x3a, 0x00, 0x01, 0x5a, 0x4b, 0x23, 0x22, 0x03, 0x5a, 0x4b, 0x6d, 0x22, 0x1d, 0x4b, 0xaa, 0x22,
+    0xd3, 0x4a, 0xaa, 0x22, 0x03, 0x8a, 0x4a, 0xaa, 0x22, 0x4d, 0x4a, 0x6d, 0x22, 0x4d, 0x4a, 0x23, 0x22, 0x03, 0x4d, 0x4a, 0xda, 0x21, 0x8a, 0x4a,
+    0x9d, 0x21, 0xd3, 0x4a, 0x9d, 0x21, 0x03, 0x1d, 0x4b, 0x9a, 0x21, 0x5a, 0x4b, 0xd6, 0x21, 0x5a, 0x4b, 0x23, 0x22, 0x04, 0x06, 0x02, 0xc4, 0x7f,
+    0x7f, 0xd5, 0x4a, 0xc5, 0x20, 0xe5, 0x4b, 0xd5, 0x21, 0x09, 0x00, 0x07, 0xd6, 0x4a, 0xc6, 0x20, 0x0d, 0x01, 0x0d, 0x01, 0x06, 0x02, 0xc4, 0x80,
+    0x80, 0xb8, 0x4b, 0x5b, 0x20, 0xc8, 0x4c, 0x6b, 0x21, 0x09, 0x00, 0x07, 0xba, 0x4b, 0x5d, 0x20, 0x0d, 0x01, 0x0d, 0x01, 0x06, 0x02, 0xc4, 0x80,
+    0x7f, 0xaf, 0x4c, 0x82, 0x20, 0xc1, 0x4d, 0x95, 0x21, 0x3a, 0x00, 0x01, 0xc0, 0x4d, 0x0a, 0x21, 0x03, 0xc0, 0x4d, 0x53, 0x21, 0x86, 0x4d, 0x90,
+    0x21, 0x3a, 0x4d, 0x93, 0x21, 0x03, 0xf0, 0x4c, 0x93, 0x21, 0xb3, 0x4c, 0x5a, 0x21, 0xb0, 0x4c, 0x0d, 0x21, 0x03, 0xb0, 0x4c, 0xc3, 0x20, 0xea,
+    0x4c, 0x86, 0x20, 0x36, 0x4d, 0x83, 0x20, 0x03, 0x83, 0x4d, 0x83, 0x20, 0xc0, 0x4d, 0xbd, 0x20, 0xc0, 0x4d, 0x0a, 0x21, 0x04, 0x06, 0x02, 0xc4,
+    0x80, 0x7f, 0x72, 0x4d, 0x25, 0x21, 0x81, 0x4e, 0x35, 0x22, 0x09, 0x00, 0x07, 0x73, 0x4d, 0x26, 0x21, 0x0d, 0x01, 0x0d, 0x01, 0x06, 0x06, 0xc7,
+    0x80, 0x80, 0x9f, 0x4a, 0xbf, 0x20, 0x61, 0x4e, 0x81, 0x24, 0x09, 0x00, 0x07, 0xa0, 0x4a, 0xc0, 0x20, 0xc0, 0x03, 0xc0, 0x03, 0x06, 0x06, 0xc7,
+    0x7f, 0x80, 0x1d, 0x38, 0x00, 0x3a, 0xa3, 0x3b, 0x80, 0x3d, 0x09, 0x00, 0x07, 0x1e, 0x38, 0x02, 0x3a, 0x83, 0x03, 0x7d, 0x03, 0x06, 0x06, 0xc7,
+    0x7f, 0x80, 0x17, 0x35, 0x2a, 0x3e, 0x9d, 0x38, 0xa9, 0x41, 0x09, 0x00, 0x07, 0x18, 0x35, 0x2b, 0x3e, 0x83, 0x03, 0x7d, 0x03, 0x06, 0x06, 0xc7,
+    0x7f, 0x7f, 0x35, 0x30, 0x92, 0x3c, 0xb8, 0x33, 0x15, 0x40, 0x09, 0x00, 0x07, 0x36, 0x30, 0x93, 0x3c, 0x80, 0x03, 0x80, 0x03, 0x06, 0x06, 0xc7,
+    0x7f, 0x80, 0x35, 0x30, 0x6b, 0x37, 0xb8, 0x33, 0xee, 0x3a, 0x09, 0x00, 0x07, 0x36, 0x30, 0x6d, 0x37, 0x80, 0x03, 0x80, 0x03, 0x06, 0x06, 0xc7,
+    0x7f, 0x7f, 0x17, 0x35, 0xd7, 0x35, 0x9d, 0x38, 0x56, 0x39, 0x09, 0x00, 0x07, 0x18, 0x35, 0xd8, 0x35, 0x83, 0x03, 0x7d, 0x03, 0x06, 0x03, 0xc8,
+    0x80, 0x80, 0x85, 0x32, 0xc8, 0x38, 0x7e, 0x38, 0xbb, 0x3e, 0x09, 0x00, 0x07, 0x86, 0x32, 0xca, 0x38, 0xf6, 0x05, 0xf0, 0x05, 0x06, 0x03, 0xc5,
+    0x80, 0x80, 0x42, 0x14, 0x02, 0x3a, 0x7e, 0x15, 0x3e, 0x3b, 0x09, 0x00, 0x07, 0x43, 0x14, 0x03, 0x3a, 0x3a, 0x01, 0x3a, 0x01, 0x06, 0x03, 0xc5,
+    0x7f, 0x80, 0xd8, 0x13, 0x22, 0x3b, 0x15, 0x15, 0x5e, 0x3c, 0x09, 0x00, 0x07, 0xda, 0x13, 0x23, 0x3b, 0x3a, 0x01, 0x3a, 0x01, 0x06, 0x03, 0xc5,
+    0x7f, 0x80, 0xcf, 0x12, 0xbb, 0x3b, 0x0b, 0x14, 0xf8, 0x3c, 0x09, 0x00, 0x07, 0xd0, 0x12, 0xbd, 0x3b, 0x3a, 0x01, 0x3a, 0x01, 0x06, 0x03, 0xc5,
+    0x80, 0x80, 0xa2, 0x11, 0x85, 0x3b, 0xde, 0x12, 0xc1, 0x3c, 0x09, 0x00, 0x07, 0xa3, 0x11, 0x86, 0x3b, 0x3a, 0x01, 0x3a, 0x01, 0x06, 0x03, 0xc4,
+    0x80, 0x80, 0xdb, 0x10, 0x9b, 0x3a, 0x18, 0x12, 0xd8, 0x3b, 0x09, 0x00, 0x07, 0xdd, 0x10, 0x9d, 0x3a, 0x3a, 0x01, 0x3a, 0x01, 0x06, 0x03, 0xc4,
+    0x80, 0x7f, 0xdb, 0x10, 0x68, 0x39, 0x18, 0x12, 0xa5, 0x3a, 0x09, 0x00, 0x07, 0xdd, 0x10, 0x6a, 0x39, 0x3a, 0x01, 0x3a, 0x01, 0x06, 0x03, 0xc5,
+    0x80, 0x7f, 0xa2, 0x11, 0x7f, 0x38, 0xde, 0x12, 0xbb, 0x39, 0x09, 0x00, 0x07, 0xa3, 0x11, 0x80, 0x38, 0x3a, 0x01, 0x3a, 0x01, 0x06, 0x03, 0xc5,
+    0x7f, 0x7f, 0xcf, 0x12, 0x48, 0x38, 0x0b, 0x14, 0x85, 0x39, 0x09, 0x00, 0x07, 0xd0, 0x12, 0x4a, 0x38, 0x3a, 0x01, 0x3a, 0x01, 0x06, 0x03, 0xc5,
+    0x7f, 0x7f, 0xd8, 0x13, 0xe2, 0x38, 0x15, 0x15, 0x1e, 0x3a, 0x09, 0x00, 0x07, 0xda, 0x13, 0xe3, 0x38, 0x3a, 0x01, 0x3a, 0x01, 0x06, 0x00, 0xc7,
+    0x80, 0x80, 0x55, 0x11, 0xd5, 0x38, 0xeb, 0x14, 0x6b, 0x3c, 0x09, 0x00, 0x07, 0x56, 0x11, 0xd6, 0x38, 0x93, 0x03, 0x93, 0x03, 0x06, 0x06, 0xc7,
+    0x80, 0x80, 0xff, 0x15, 0x1f, 0x5a, 0xc1, 0x19, 0xe1, 0x5d, 0x09, 0x00, 0x07, 0x00, 0x16, 0x20, 0x5a, 0xc0, 0x03, 0xc0, 0x03, 0x06, 0x06, 0xc7,
+    0x7f, 0x80, 0x72, 0x14, 0x58, 0x5d, 0x35, 0x18, 0x1b, 0x61, 0x09, 0x00, 0x07, 0x73, 0x14, 0x5a, 0x5d, 0xc0, 0x03, 0xc0, 0x03, 0x06, 0x06, 0xc7,
+    0x7f, 0x7f, 0xf5, 0x10, 0x25, 0x5e, 0xb8, 0x14, 0xe8, 0x61, 0x09, 0x00, 0x07, 0xf6, 0x10, 0x26, 0x5e, 0xc0, 0x03, 0xc0, 0x03, 0x06, 0x06, 0xc7,
+    0x80, 0x80, 0x28, 0x0e, 0xe8, 0x5b, 0xeb, 0x11, 0xab, 0x5f, 0x09, 0x00, 0x07, 0x2a, 0x0e, 0xea, 0x5b, 0xc0, 0x03, 0xc0, 0x03, 0x06, 0x06, 0xc7,
+    0x80, 0x7f, 0x28, 0x0e, 0x55, 0x58, 0xeb, 0x11, 0x18, 0x5c, 0x09, 0x00, 0x07, 0x2a, 0x0e, 0x56, 0x58, 0xc0, 0x03, 0xc0, 0x03, 0x06, 0x06, 0xc7,
+    0x7f, 0x80, 0xf5, 0x10, 0x18, 0x56, 0xb8, 0x14, 0xdb, 0x59, 0x09, 0x00, 0x07, 0xf6, 0x10, 0x1a, 0x56, 0xc0, 0x03, 0xc0, 0x03, 0x06, 0x06, 0xc7,
+    0x7f, 0x7f, 0x72, 0x14, 0xe5, 0x56, 0x35, 0x18, 0xa8, 0x5a, 0x09, 0x00, 0x07, 0x73, 0x14, 0xe6, 0x56, 0xc0, 0x03, 0xc0, 0x03, 0x06, 0x03, 0xc8,
+    0x7f, 0x7f, 0x68, 0x0f, 0xa8, 0x57, 0x15, 0x18, 0x55, 0x60, 0x09, 0x00, 0x07, 0x6a, 0x0f, 0xaa, 0x57, 0xaa, 0x08, 0xaa, 0x08, 0x01, 0x03, 0xc0,
+    0x50, 0x80, 0x55, 0x04, 0xe5, 0x06, 0x06, 0x06, 0xc5, 0x80, 0x80, 0x55, 0xff, 0x53, 0xff, 0xab, 0x00, 0xad, 0x00, 0x09, 0x00, 0x07, 0x56, 0xff,
+    0x55, 0xff, 0x53, 0x01, 0x56, 0x01, 0x02, 0x01, 0x03, 0x50, 0x50, 0xfd, 0x56, 0x04, 0xe5, 0x06, 0x06, 0x06, 0xc5, 0x80, 0x80, 0x55, 0xff, 0x53,
+    0xff, 0xab, 0x00, 0xad, 0x00, 0x09, 0x00, 0x07, 0x56, 0xff, 0x55, 0xff, 0x53, 0x01, 0x56, 0x01, 0x02, 0x01, 0x03, 0x26, 0x4f, 0x00, 0x58, 0x04,
+    0xe5, 0x06, 0x06, 0x06, 0xc5, 0x80, 0x80, 0x55, 0xff, 0x53, 0xff, 0xab, 0x00, 0xad, 0x00, 0x09, 0x00, 0x07, 0x56, 0xff, 0x55, 0xff, 0x53, 0x01,
+    0x56, 0x01, 0x02, 0x06, 0x06, 0xc3, 0x80, 0x80, 0xf2, 0x4c, 0x8b, 0x57, 0x48, 0x4e, 0xe5, 0x58, 0x3a, 0x00, 0x01, 0x46, 0x4e, 0x3a, 0x58, 0x03,
+    0x46, 0x4e, 0x96, 0x58, 0xfa, 0x4d, 0xe3, 0x58, 0x9d, 0x4d, 0xe3, 0x58, 0x03, 0x40, 0x4d, 0xe3, 0x58, 0xf3, 0x4c, 0x96, 0x58, 0xf3, 0x4c, 0x3a,
+    0x58, 0x03, 0xf3, 0x4c, 0xdd, 0x57, 0x40, 0x4d, 0x90, 0x57, 0x9d, 0x4d, 0x90, 0x57, 0x03, 0xfa, 0x4d, 0x8d, 0x57, 0x46, 0x4e, 0xda, 0x57, 0x46,
+    0x4e, 0x3a, 0x58, 0x04, 0x01, 0x03, 0x33, 0x4c, 0x93, 0x57, 0x04, 0xe5, 0x06, 0x06, 0x06, 0xc5, 0x80, 0x80, 0x55, 0xff, 0x53, 0xff, 0xab, 0x00,
+    0xad, 0x00, 0x09, 0x00, 0x07, 0x56, 0xff, 0x55, 0xff, 0x53, 0x01, 0x56, 0x01, 0x02, 0x01, 0x03, 0x5d, 0x4b, 0x46, 0x56, 0x04, 0xe5, 0x06, 0x06,
+    0x06, 0xc5, 0x80, 0x80, 0x55, 0xff, 0x53, 0xff, 0xab, 0x00, 0xad, 0x00, 0x09, 0x00, 0x07, 0x56, 0xff, 0x55, 0xff, 0x53, 0x01, 0x56, 0x01, 0x02,
+    0x01, 0x03, 0x5d, 0x4b, 0xba, 0x54, 0x04, 0xe5, 0x06, 0x06, 0x06, 0xc5, 0x80, 0x80, 0x55, 0xff, 0x53, 0xff, 0xab, 0x00, 0xad, 0x00, 0x09, 0x00,
+    0x07, 0x56, 0xff, 0x55, 0xff, 0x53, 0x01, 0x56, 0x01, 0x02, 0x06, 0x06, 0xc3, 0x80, 0x80, 0x88, 0x4b, 0xbf, 0x52, 0xde, 0x4c, 0x18, 0x54, 0x3a,
+    0x00, 0x01, 0xdd, 0x4c, 0x6d, 0x53, 0x03, 0xdd, 0x4c, 0xca, 0x53, 0x90, 0x4c, 0x16, 0x54, 0x33, 0x4c, 0x16, 0x54, 0x03, 0xd6, 0x4b, 0x16, 0x54,
+    0x8a, 0x4b, 0xca, 0x53, 0x8a, 0x4b, 0x6d, 0x53, 0x03, 0x8a, 0x4b, 0x10, 0x53, 0xd6, 0x4b, 0xc3, 0x52, 0x33, 0x4c, 0xc3, 0x52, 0x03, 0x90, 0x4c,
+    0xc0, 0x52, 0xdd, 0x4c, 0x0d, 0x53, 0xdd, 0x4c, 0x6d, 0x53, 0x04, 0x01, 0x03, 0x9d, 0x4d, 0xc6, 0x52, 0x04, 0xe5, 0x06, 0x06, 0x06, 0xc5, 0x80,
+    0x80, 0x55, 0xff, 0x53, 0xff, 0xab, 0x00, 0xad, 0x00, 0x09, 0x00, 0x07, 0x56, 0xff, 0x55, 0xff, 0x53, 0x01, 0x56, 0x01, 0x02, 0x01, 0x03, 0x26,
+    0x4f, 0x00, 0x53, 0x04, 0xe5, 0x06, 0x06, 0x06, 0xc5, 0x80, 0x80, 0x55, 0xff, 0x53, 0xff, 0xab, 0x00, 0xad, 0x00, 0x09, 0x00, 0x07, 0x56, 0xff,
+    0x55, 0xff, 0x53, 0x01, 0x56, 0x01, 0x02, 0x01, 0x03, 0x50, 0x50, 0x03, 0x54, 0x04, 0xe5, 0x06, 0x06, 0x06, 0xc5, 0x80, 0x80, 0x55, 0xff, 0x53,
+    0xff, 0xab, 0x00, 0xad, 0x00, 0x09, 0x00, 0x07, 0x56, 0xff, 0x55, 0xff, 0x53, 0x01, 0x56, 0x01, 0x02, 0x06, 0x03, 0xc7, 0x80, 0x80, 0xa2, 0x4b,
+    0x25, 0x53, 0x61, 0x50, 0xde, 0x57, 0x09, 0x00, 0x07, 0xa3, 0x4b, 0x26, 0x53, 0xbd, 0x04, 0xb6, 0x04, 0x06, 0x00, 0xc5, 0x80, 0x80, 0xc5, 0x5b,
+    0x05, 0x14, 0xfb, 0x5c, 0x3b, 0x15, 0x09, 0x00, 0x07, 0xc6, 0x5b, 0x06, 0x14, 0x33, 0x01, 0x33, 0x01, 0x06, 0x00, 0xc5, 0x80, 0x80, 0x6b, 0x5b,
+    0x55, 0x15, 0xa1, 0x5c, 0x8b, 0x16, 0x09, 0x00, 0x07, 0x6d, 0x5b, 0x56, 0x15, 0x33, 0x01, 0x33, 0x01, 0x06, 0x00, 0xc3, 0x80, 0x81, 0x75, 0x5a,
+    0x48, 0x16, 0xab, 0x5b, 0x81, 0x17, 0x3a, 0x00, 0x01, 0xaa, 0x5b, 0xe6, 0x16, 0x03, 0xaa, 0x5b, 0x3d, 0x17, 0x63, 0x5b, 0x80, 0x17, 0x10, 0x5b,
+    0x80, 0x17, 0x03, 0xba, 0x5a, 0x80, 0x17, 0x76, 0x5a, 0x3a, 0x17, 0x76, 0x5a, 0xe6, 0x16, 0x03, 0x76, 0x5a, 0x90, 0x16, 0xbd, 0x5a, 0x4d, 0x16,
+    0x10, 0x5b, 0x4d, 0x16, 0x03, 0x66, 0x5b, 0x4a, 0x16, 0xaa, 0x5b, 0x90, 0x16, 0xaa, 0x5b, 0xe6, 0x16, 0x04, 0x06, 0x00, 0xc5, 0x80, 0x80, 0x25,
+    0x59, 0xa5, 0x16, 0x5b, 0x5a, 0xdb, 0x17, 0x09, 0x00, 0x07, 0x26, 0x59, 0xa6, 0x16, 0x33, 0x01, 0x33, 0x01, 0x06, 0x00, 0xc3, 0x80, 0x81, 0xd5,
+    0x57, 0x48, 0x16, 0x0b, 0x59, 0x81, 0x17, 0x3a, 0x00, 0x01, 0x0a, 0x59, 0xe6, 0x16, 0x03, 0x0a, 0x59, 0x3d, 0x17, 0xc3, 0x58, 0x80, 0x17, 0x70,
+    0x58, 0x80, 0x17, 0x03, 0x1a, 0x58, 0x80, 0x17, 0xd6, 0x57, 0x3a, 0x17, 0xd6, 0x57, 0xe6, 0x16, 0x03, 0xd6, 0x57, 0x90, 0x16, 0x1d, 0x58, 0x4d,
+    0x16, 0x70, 0x58, 0x4d, 0x16, 0x03, 0xc6, 0x58, 0x4a, 0x16, 0x0a, 0x59, 0x90, 0x16, 0x0a, 0x59, 0xe6, 0x16, 0x04, 0x06, 0x00, 0xc4, 0x7f, 0x80,
+    0xe2, 0x56, 0x55, 0x15, 0x18, 0x58, 0x8b, 0x16, 0x3a, 0x00, 0x01, 0x16, 0x58, 0xf0, 0x15, 0x03, 0x16, 0x58, 0x46, 0x16, 0xd0, 0x57, 0x8a, 0x16,
+    0x7d, 0x57, 0x8a, 0x16, 0x03, 0x26, 0x57, 0x8a, 0x16, 0xe3, 0x56, 0x43, 0x16, 0xe3, 0x56, 0xf0, 0x15, 0x03, 0xe3, 0x56, 0x9a, 0x15, 0x2a, 0x57,
+    0x56, 0x15, 0x7d, 0x57, 0x56, 0x15, 0x03, 0xd0, 0x57, 0x56, 0x15, 0x13, 0x58, 0x9a, 0x15, 0x16, 0x58, 0xf0, 0x15, 0x04, 0x06, 0x00, 0xc5, 0x80,
+    0x80, 0x85, 0x56, 0x05, 0x14, 0xbb, 0x57, 0x3b, 0x15, 0x09, 0x00, 0x07, 0x86, 0x56, 0x06, 0x14, 0x33, 0x01, 0x33, 0x01, 0x06, 0x00, 0xc4, 0x7f,
+    0x80, 0xe2, 0x56, 0xb5, 0x12, 0x18, 0x58, 0xeb, 0x13, 0x3a, 0x00, 0x01, 0x16, 0x58, 0x50, 0x13, 0x03, 0x16, 0x58, 0xa6, 0x13, 0xd0, 0x57, 0xea,
+    0x13, 0x7d, 0x57, 0xea, 0x13, 0x03, 0x26, 0x57, 0xea, 0x13, 0xe3, 0x56, 0xa3, 0x13, 0xe3, 0x56, 0x50, 0x13, 0x03, 0xe3, 0x56, 0xfa, 0x12, 0x2a,
+    0x57, 0xb6, 0x12, 0x7d, 0x57, 0xb6, 0x12, 0x03, 0xd0, 0x57, 0xb6, 0x12, 0x13, 0x58, 0xfa, 0x12, 0x16, 0x58, 0x50, 0x13, 0x04, 0x06, 0x00, 0xc5,
+    0x80, 0x7f, 0xd5, 0x57, 0xbf, 0x11, 0x0b, 0x59, 0xf5, 0x12, 0x09, 0x00, 0x07, 0xd6, 0x57, 0xc0, 0x11, 0x33, 0x01, 0x33, 0x01, 0x06, 0x00, 0xc5,
+    0x80, 0x80, 0x25, 0x59, 0x65, 0x11, 0x5b, 0x5a, 0x9b, 0x12, 0x09, 0x00, 0x07, 0x26, 0x59, 0x66, 0x11, 0x33, 0x01, 0x33, 0x01, 0x06, 0x00, 0xc5,
+    0x80, 0x7f, 0x75, 0x5a, 0xbf, 0x11, 0xab, 0x5b, 0xf5, 0x12, 0x09, 0x00, 0x07, 0x76, 0x5a, 0xc0, 0x11, 0x33, 0x01, 0x33, 0x01, 0x06, 0x00, 0xc5,
+    0x80, 0x80, 0x6b, 0x5b, 0xb5, 0x12, 0xa1, 0x5c, 0xeb, 0x13, 0x09, 0x00, 0x07, 0x6d, 0x5b, 0xb6, 0x12, 0x33, 0x01, 0x33, 0x01, 0x06, 0x03, 0xc8,
+    0x80, 0x80, 0x67, 0x57, 0x4a, 0x12, 0x19, 0x5c, 0xf6, 0x16, 0x09, 0x00, 0x07, 0x68, 0x57, 0x4b, 0x12, 0xb0, 0x04, 0xaa, 0x04, 0x06, 0x00, 0xc5,
+    0x80, 0x80, 0x25, 0x14, 0xa5, 0x41, 0x9b, 0x15, 0x1b, 0x43, 0x09, 0x00, 0x07, 0x26, 0x14, 0xa6, 0x41, 0x73, 0x01, 0x73, 0x01, 0x06, 0x00, 0xc5,
+    0x80, 0x7f, 0x85, 0x13, 0xbf, 0x43, 0xfb, 0x14, 0x35, 0x45, 0x09, 0x00, 0x07, 0x86, 0x13, 0xc0, 0x43, 0x73, 0x01, 0x73, 0x01, 0x06, 0x00, 0xc5,
+    0x7f, 0x80, 0xdf, 0x11, 0x2b, 0x45, 0x55, 0x13, 0xa1, 0x46, 0x09, 0x00, 0x07, 0xe0, 0x11, 0x2d, 0x45, 0x73, 0x01, 0x73, 0x01, 0x06, 0x00, 0xc5,
+    0x7f, 0x80, 0xb8, 0x0f, 0x7b, 0x45, 0x2e, 0x11, 0xf1, 0x46, 0x3a, 0x00, 0x01, 0x2d, 0x11, 0x36, 0x46, 0x03, 0x2d, 0x11, 0x9d, 0x46, 0xda, 0x10,
+    0xf0, 0x46, 0x73, 0x10, 0xf0, 0x46, 0x03, 0x0d, 0x10, 0xf0, 0x46, 0xba, 0x0f, 0x9d, 0x46, 0xba, 0x0f, 0x36, 0x46, 0x03, 0xba, 0x0f, 0xd0, 0x45,
+    0x0d, 0x10, 0x7d, 0x45, 0x73, 0x10, 0x7d, 0x45, 0x03, 0xda, 0x10, 0x7d, 0x45, 0x2a, 0x11, 0xd0, 0x45, 0x2d, 0x11, 0x36, 0x46, 0x04, 0x06, 0x00,
+    0xc5, 0x80, 0x80, 0xbb, 0x0d, 0x92, 0x44, 0x31, 0x0f, 0x08, 0x46, 0x3a, 0x00, 0x01, 0x30, 0x0f, 0x4d, 0x45, 0x03, 0x30, 0x0f, 0xb3, 0x45, 0xdd,
+    0x0e, 0x06, 0x46, 0x76, 0x0e, 0x06, 0x46, 0x03, 0x10, 0x0e, 0x06, 0x46, 0xbd, 0x0d, 0xb3, 0x45, 0xbd, 0x0d, 0x4d, 0x45, 0x03, 0xbd, 0x0d, 0xe6,
+    0x44, 0x10, 0x0e, 0x93, 0x44, 0x76, 0x0e, 0x93, 0x44, 0x03, 0xdd, 0x0e, 0x96, 0x44, 0x30, 0x0f, 0xe6, 0x44, 0x30, 0x0f, 0x4d, 0x45, 0x04, 0x06,
+    0x00, 0xc5, 0x80, 0x80, 0x8b, 0x0c, 0xbb, 0x42, 0x01, 0x0e, 0x31, 0x44, 0x3a, 0x00, 0x01, 0x00, 0x0e, 0x76, 0x43, 0x03, 0x00, 0x0e, 0xdd, 0x43,
+    0xad, 0x0d, 0x30, 0x44, 0x46, 0x0d, 0x30, 0x44, 0x03, 0xe0, 0x0c, 0x30, 0x44, 0x8d, 0x0c, 0xdd, 0x43, 0x8d, 0x0c, 0x76, 0x43, 0x03, 0x8d, 0x0c,
+    0x10, 0x43, 0xe0, 0x0c, 0xbd, 0x42, 0x46, 0x0d, 0xbd, 0x42, 0x03, 0xad, 0x0d, 0xc0, 0x42, 0x00, 0x0e, 0x10, 0x43, 0x00, 0x0e, 0x76, 0x43, 0x04,
+    0x06, 0x00, 0xc5, 0x80, 0x7f, 0x8b, 0x0c, 0x8f, 0x40, 0x01, 0x0e, 0x05, 0x42, 0x09, 0x00, 0x07, 0x8d, 0x0c, 0x90, 0x40, 0x73, 0x01, 0x73, 0x01,
+    0x06, 0x00, 0xc5, 0x80, 0x80, 0xbb, 0x0d, 0xb8, 0x3e, 0x31, 0x0f, 0x2e, 0x40, 0x09, 0x00, 0x07, 0xbd, 0x0d, 0xba, 0x3e, 0x73, 0x01, 0x73, 0x01,
+    0x06, 0x00, 0xc4, 0x7f, 0x7f, 0xb8, 0x0f, 0xcf, 0x3d, 0x2e, 0x11, 0x45, 0x3f, 0x3a, 0x00, 0x01, 0x2d, 0x11, 0x8a, 0x3e, 0x03, 0x2d, 0x11, 0xf0,
+    0x3e, 0xda, 0x10, 0x43, 0x3f, 0x73, 0x10, 0x43, 0x3f, 0x03, 0x0d, 0x10, 0x43, 0x3f, 0xba, 0x0f, 0xf0, 0x3e, 0xba, 0x0f, 0x8a, 0x3e, 0x03, 0xba,
+    0x0f, 0x23, 0x3e, 0x0d, 0x10, 0xd0, 0x3d, 0x73, 0x10, 0xd0, 0x3d, 0x03, 0xda, 0x10, 0xd3, 0x3d, 0x2a, 0x11, 0x23, 0x3e, 0x2d, 0x11, 0x8a, 0x3e,
+    0x04, 0x06, 0x00, 0xc5, 0x7f, 0x7f, 0xdf, 0x11, 0x1f, 0x3e, 0x55, 0x13, 0x95, 0x3f, 0x09, 0x00, 0x07, 0xe0, 0x11, 0x20, 0x3e, 0x73, 0x01, 0x73,
+    0x01, 0x06, 0x00, 0xc5, 0x7f, 0x80, 0x85, 0x13, 0x8b, 0x3f, 0xfb, 0x14, 0x01, 0x41, 0x3a, 0x00, 0x01, 0xfa, 0x14, 0x46, 0x40, 0x03, 0xfa, 0x14,
+    0xad, 0x40, 0xa6, 0x14, 0x00, 0x41, 0x40, 0x14, 0x00, 0x41, 0x03, 0xda, 0x13, 0x00, 0x41, 0x86, 0x13, 0xad, 0x40, 0x86, 0x13, 0x46, 0x40, 0x03,
+    0x86, 0x13, 0xe0, 0x3f, 0xda, 0x13, 0x8d, 0x3f, 0x40, 0x14, 0x8d, 0x3f, 0x03, 0xaa, 0x14, 0x90, 0x3f, 0xfa, 0x14, 0xe3, 0x3f, 0xfa, 0x14, 0x46,
+    0x40, 0x04, 0x06, 0x03, 0xc8, 0x80, 0x80, 0x6f, 0x0e, 0xcf, 0x3f, 0x91, 0x13, 0xf1, 0x44, 0x09, 0x00, 0x07, 0x70, 0x0e, 0xd0, 0x3f, 0x20, 0x05,
+    0x20, 0x05, 0x01, 0x03, 0x20, 0x04, 0x40, 0x3a, 0x04, 0xe0, 0x06, 0x06, 0x03, 0xc4, 0x80, 0x80, 0x75, 0xff, 0x75, 0xff, 0x8b, 0x00, 0x8b, 0x00,
+    0x09, 0x00, 0x07, 0x76, 0xff, 0x76, 0xff, 0x13, 0x01, 0x13, 0x01, 0x02, 0x01, 0x03, 0x9a, 0x03, 0xb3, 0x3b, 0x04, 0xe0, 0x06, 0x06, 0x03, 0xc4,
+    0x80, 0x80, 0x75, 0xff, 0x75, 0xff, 0x8b, 0x00, 0x8b, 0x00, 0x09, 0x00, 0x07, 0x76, 0xff, 0x76, 0xff, 0x13, 0x01, 0x13, 0x01, 0x02, 0x01, 0x03,
+    0x43, 0x02, 0x76, 0x3c, 0x04, 0xe0, 0x06, 0x06, 0x03, 0xc4, 0x80, 0x80, 0x75, 0xff, 0x75, 0xff, 0x8b, 0x00, 0x8b, 0x00, 0x09, 0x00, 0x07, 0x76,
+    0xff, 0x76, 0xff, 0x13, 0x01, 0x13, 0x01, 0x02, 0x01, 0x03, 0xc0, 0x00, 0x33, 0x3c, 0x04, 0xe0, 0x06, 0x06, 0x03, 0xc4, 0x80, 0x80, 0x75, 0xff,
+    0x75, 0xff, 0x8b, 0x00, 0x8b, 0x00, 0x09, 0x00, 0x07, 0x76, 0xff, 0x76, 0xff, 0x13, 0x01, 0x13, 0x01, 0x02, 0x06, 0x03, 0xc3, 0x80, 0x81, 0x38,
+    0xff, 0x78, 0x3a, 0x4e, 0x00, 0x91, 0x3b, 0x3a, 0x00, 0x01, 0x4d, 0x00, 0x06, 0x3b, 0x03, 0x4d, 0x00, 0x53, 0x3b, 0x10, 0x00, 0x90, 0x3b, 0xc3,
+    0xff, 0x90, 0x3b, 0x03, 0x76, 0xff, 0x90, 0x3b, 0x3a, 0xff, 0x53, 0x3b, 0x3a, 0xff, 0x06, 0x3b, 0x03, 0x3a, 0xff, 0xba, 0x3a, 0x76, 0xff, 0x7d,
+    0x3a, 0xc3, 0xff, 0x7d, 0x3a, 0x03, 0x10, 0x00, 0x7a, 0x3a, 0x4d, 0x00, 0xba, 0x3a, 0x4d, 0x00, 0x06, 0x3b, 0x04, 0x01, 0x03, 0xc3, 0xff, 0x7a,
+    0x39, 0x04, 0xe0, 0x06, 0x06, 0x03, 0xc4, 0x80, 0x80, 0x75, 0xff, 0x75, 0xff, 0x8b, 0x00, 0x8b, 0x00, 0x09, 0x00, 0x07, 0x76, 0xff, 0x76, 0xff,
+    0x13, 0x01, 0x13, 0x01, 0x02, 0x01, 0x03, 0xc0, 0x00, 0x4d, 0x38, 0x04, 0xe0, 0x06, 0x06, 0x03, 0xc4, 0x80, 0x80, 0x75, 0xff, 0x75, 0xff, 0x8b,
+    0x00, 0x8b, 0x00, 0x09, 0x00, 0x07, 0x76, 0xff, 0x76, 0xff, 0x13, 0x01, 0x13, 0x01, 0x02, 0x01, 0x03, 0x43, 0x02, 0x0a, 0x38, 0x04, 0xe0, 0x06,
+    0x06, 0x03, 0xc4, 0x80, 0x80, 0x75, 0xff, 0x75, 0xff, 0x8b, 0x00, 0x8b, 0x00, 0x09, 0x00, 0x07, 0x76, 0xff, 0x76, 0xff, 0x13, 0x01, 0x13, 0x01,
+    0x02, 0x01, 0x03, 0x9a, 0x03, 0xcd, 0x38, 0x04, 0xe0, 0x06, 0x06, 0x03, 0xc4, 0x80, 0x80, 0x75, 0xff, 0x75, 0xff, 0x8b, 0x00, 0x8b, 0x00, 0x09,
+    0x00, 0x07, 0x76, 0xff, 0x76, 0xff, 0x13, 0x01, 0x13, 0x01, 0x02, 0x06, 0x02, 0xc7, 0x7f, 0x80, 0x48, 0x00, 0xab, 0x38, 0x75, 0x03, 0xd1, 0x3b,
+    0x09, 0x00, 0x07, 0x4a, 0x00, 0xad, 0x38, 0x2a, 0x03, 0x23, 0x03, 0x06, 0x00, 0xc6, 0x80, 0x80, 0xa5, 0x4f, 0x25, 0x19, 0x5b, 0x51, 0xdb, 0x1a,
+    0x09, 0x00, 0x07, 0xa6, 0x4f, 0x26, 0x19, 0xb3, 0x01, 0xb3, 0x01, 0x06, 0x00, 0xc4, 0x80, 0x80, 0x15, 0x4f, 0xab, 0x1a, 0xce, 0x50, 0x65, 0x1c,
+    0x3a, 0x00, 0x01, 0xcd, 0x50, 0x86, 0x1b, 0x03, 0xcd, 0x50, 0x00, 0x1c, 0x6d, 0x50, 0x60, 0x1c, 0xf3, 0x4f, 0x63, 0x1c, 0x03, 0x7a, 0x4f, 0x63,
+    0x1c, 0x1a, 0x4f, 0x03, 0x1c, 0x16, 0x4f, 0x8a, 0x1b, 0x03, 0x16, 0x4f, 0x10, 0x1b, 0x76, 0x4f, 0xb0, 0x1a, 0xf0, 0x4f, 0xad, 0x1a, 0x03, 0x6a,
+    0x50, 0xad, 0x1a, 0xca, 0x50, 0x0d, 0x1b, 0xcd, 0x50, 0x86, 0x1b, 0x04, 0x06, 0x00, 0xc6, 0x7f, 0x80, 0xaf, 0x4d, 0x7b, 0x1b, 0x65, 0x4f, 0x31,
+    0x1d, 0x09, 0x00, 0x07, 0xb0, 0x4d, 0x7d, 0x1b, 0xb3, 0x01, 0xb3, 0x01, 0x06, 0x00, 0xc4, 0x80, 0x80, 0x15, 0x4c, 0x32, 0x1b, 0xcb, 0x4d, 0xeb,
+    0x1c, 0x3a, 0x00, 0x01, 0xca, 0x4d, 0x10, 0x1c, 0x03, 0xca, 0x4d, 0x8a, 0x1c, 0x66, 0x4d, 0xea, 0x1c, 0xf0, 0x4c, 0xea, 0x1c, 0x03, 0x76, 0x4c,
+    0xea, 0x1c, 0x16, 0x4c, 0x86, 0x1c, 0x16, 0x4c, 0x10, 0x1c, 0x03, 0x16, 0x4c, 0x9a, 0x1b, 0x7a, 0x4c, 0x36, 0x1b, 0xf0, 0x4c, 0x36, 0x1b, 0x03,
+    0x6a, 0x4d, 0x33, 0x1b, 0xca, 0x4d, 0x96, 0x1b, 0xca, 0x4d, 0x10, 0x1c, 0x04, 0x06, 0x00, 0xc6, 0x80, 0x80, 0x0b, 0x4b, 0xf5, 0x19, 0xc1, 0x4c,
+    0xab, 0x1b, 0x09, 0x00, 0x07, 0x0d, 0x4b, 0xf6, 0x19, 0xb3, 0x01, 0xb3, 0x01, 0x06, 0x00, 0xc6, 0x80, 0x80, 0x0b, 0x4b, 0x55, 0x18, 0xc1, 0x4c,
+    0x0b, 0x1a, 0x09, 0x00, 0x07, 0x0d, 0x4b, 0x56, 0x18, 0xb3, 0x01, 0xb3, 0x01, 0x06, 0x00, 0xc6, 0x80, 0x80, 0x15, 0x4c, 0x15, 0x17, 0xcb, 0x4d,
+    0xcb, 0x18, 0x09, 0x00, 0x07, 0x16, 0x4c, 0x16, 0x17, 0xb3, 0x01, 0xb3, 0x01, 0x06, 0x00, 0xc6, 0x7f, 0x7f, 0xaf, 0x4d, 0xcf, 0x16, 0x65, 0x4f,
+    0x85, 0x18, 0x09, 0x00, 0x07, 0xb0, 0x4d, 0xd0, 0x16, 0xb3, 0x01, 0xb3, 0x01, 0x06, 0x00, 0xc5, 0x80, 0x7f, 0x15, 0x4f, 0x9f, 0x17, 0xce, 0x50,
+    0x58, 0x19, 0x3a, 0x00, 0x01, 0xcd, 0x50, 0x7a, 0x18, 0x03, 0xcd, 0x50, 0xf3, 0x18, 0x6d, 0x50, 0x53, 0x19, 0xf3, 0x4f, 0x56, 0x19, 0x03, 0x7a,
+    0x4f, 0x56, 0x19, 0x1a, 0x4f, 0xf6, 0x18, 0x16, 0x4f, 0x7d, 0x18, 0x03, 0x16, 0x4f, 0x03, 0x18, 0x76, 0x4f, 0xa3, 0x17, 0xf0, 0x4f, 0xa0, 0x17,
+    0x03, 0x6a, 0x50, 0xa0, 0x17, 0xca, 0x50, 0x00, 0x18, 0xcd, 0x50, 0x7a, 0x18, 0x04, 0x06, 0x06, 0xc7, 0x80, 0x80, 0x9d, 0x4b, 0x83, 0x17, 0xa3,
+    0x50, 0x7d, 0x1c, 0x09, 0x00, 0x07, 0x9e, 0x4b, 0x85, 0x17, 0x03, 0x05, 0xf6, 0x04, 0x06, 0x00, 0xc7, 0x80, 0x80, 0x0f, 0x17, 0xef, 0x0d, 0xb1,
+    0x19, 0x91, 0x10, 0x09, 0x00, 0x07, 0x10, 0x17, 0xf0, 0x0d, 0xa0, 0x02, 0xa0, 0x02, 0x06, 0x00, 0xc7, 0x80, 0x80, 0x3f, 0x16, 0x6f, 0x10, 0xe1,
+    0x18, 0x11, 0x13, 0x09, 0x00, 0x07, 0x40, 0x16, 0x70, 0x10, 0xa0, 0x02, 0xa0, 0x02, 0x06, 0x00, 0xc7, 0x80, 0x80, 0x1f, 0x14, 0xf8, 0x11, 0xc1,
+    0x16, 0x9b, 0x14, 0x09, 0x00, 0x07, 0x20, 0x14, 0xfa, 0x11, 0xa0, 0x02, 0xa0, 0x02, 0x06, 0x00, 0xc7, 0x80, 0x80, 0x7f, 0x11, 0xf8, 0x11, 0x21,
+    0x14, 0x9b, 0x14, 0x09, 0x00, 0x07, 0x80, 0x11, 0xfa, 0x11, 0xa0, 0x02, 0xa0, 0x02, 0x06, 0x00, 0xc7, 0x80, 0x80, 0x5f, 0x0f, 0x6f, 0x10, 0x01,
+    0x12, 0x11, 0x13, 0x09, 0x00, 0x07, 0x60, 0x0f, 0x70, 0x10, 0xa0, 0x02, 0xa0, 0x02, 0x06, 0x00, 0xc7, 0x80, 0x80, 0x8f, 0x0e, 0xef, 0x0d, 0x31,
+    0x11, 0x91, 0x10, 0x09, 0x00, 0x07, 0x90, 0x0e, 0xf0, 0x0d, 0xa0, 0x02, 0xa0, 0x02, 0x06, 0x00, 0xc7, 0x80, 0x80, 0x5f, 0x0f, 0x6f, 0x0b, 0x01,
+    0x12, 0x11, 0x0e, 0x09, 0x00, 0x07, 0x60, 0x0f, 0x70, 0x0b, 0xa0, 0x02, 0xa0, 0x02, 0x06, 0x00, 0xc7, 0x80, 0x7f, 0x7f, 0x11, 0xe5, 0x09, 0x21,
+    0x14, 0x88, 0x0c, 0x09, 0x00, 0x07, 0x80, 0x11, 0xe6, 0x09, 0xa0, 0x02, 0xa0, 0x02, 0x06, 0x00, 0xc7, 0x80, 0x7f, 0x1f, 0x14, 0xe5, 0x09, 0xc1,
+    0x16, 0x88, 0x0c, 0x09, 0x00, 0x07, 0x20, 0x14, 0xe6, 0x09, 0xa0, 0x02, 0xa0, 0x02, 0x06, 0x00, 0xc7, 0x80, 0x80, 0x3f, 0x16, 0x6f, 0x0b, 0xe1,
+    0x18, 0x11, 0x0e, 0x09, 0x00, 0x07, 0x40, 0x16, 0x70, 0x0b, 0xa0, 0x02, 0xa0, 0x02, 0x06, 0x03, 0xc8, 0x80, 0x80, 0xdf, 0x0f, 0xff, 0x0a, 0x61,
+    0x18, 0x81, 0x13, 0x09, 0x00, 0x07, 0xe0, 0x0f, 0x00, 0x0b, 0x80, 0x08, 0x80, 0x08, 0x06, 0x06, 0xc6, 0x80, 0x80, 0x7b, 0x37, 0xbb, 0x11, 0x85,
+    0x39, 0xc5, 0x13, 0x09, 0x00, 0x07, 0x7d, 0x37, 0xbd, 0x11, 0x06, 0x02, 0x06, 0x02, 0x06, 0x06, 0xc6, 0x80, 0x80, 0xd5, 0x36, 0xb8, 0x13, 0xde,
+    0x38, 0xc1, 0x15, 0x09, 0x00, 0x07, 0xd6, 0x36, 0xba, 0x13, 0x06, 0x02, 0x06, 0x02, 0x06, 0x06, 0xc6, 0x80, 0x7f, 0x25, 0x35, 0xf2, 0x14, 0x2e,
+    0x37, 0xfb, 0x16, 0x09, 0x00, 0x07, 0x26, 0x35, 0xf3, 0x14, 0x06, 0x02, 0x06, 0x02, 0x06, 0x06, 0xc6, 0x7f, 0x7f, 0x0f, 0x33, 0xf2, 0x14, 0x18,
+    0x35, 0xfb, 0x16, 0x09, 0x00, 0x07, 0x10, 0x33, 0xf3, 0x14, 0x06, 0x02, 0x06, 0x02, 0x06, 0x06, 0xc6, 0x7f, 0x80, 0x5f, 0x31, 0xb8, 0x13, 0x68,
+    0x33, 0xc1, 0x15, 0x09, 0x00, 0x07, 0x60, 0x31, 0xba, 0x13, 0x06, 0x02, 0x06, 0x02, 0x06, 0x06, 0xc6, 0x80, 0x80, 0xbb, 0x30, 0xbb, 0x11, 0xc5,
+    0x32, 0xc5, 0x13, 0x09, 0x00, 0x07, 0xbd, 0x30, 0xbd, 0x11, 0x06, 0x02, 0x06, 0x02, 0x06, 0x06, 0xc6, 0x7f, 0x7f, 0x5f, 0x31, 0xbf, 0x0f, 0x68,
+    0x33, 0xc8, 0x11, 0x09, 0x00, 0x07, 0x60, 0x31, 0xc0, 0x0f, 0x06, 0x02, 0x06, 0x02, 0x06, 0x06, 0xc6, 0x7f, 0x80, 0x0f, 0x33, 0x85, 0x0e, 0x18,
+    0x35, 0x8e, 0x10, 0x09, 0x00, 0x07, 0x10, 0x33, 0x86, 0x0e, 0x06, 0x02, 0x06, 0x02, 0x06, 0x06, 0xc6, 0x80, 0x80, 0x25, 0x35, 0x85, 0x0e, 0x2e,
+    0x37, 0x8e, 0x10, 0x09, 0x00, 0x07, 0x26, 0x35, 0x86, 0x0e, 0x06, 0x02, 0x06, 0x02, 0x06, 0x06, 0xc6, 0x80, 0x7f, 0xd5, 0x36, 0xbf, 0x0f, 0xde,
+    0x38, 0xc8, 0x11, 0x09, 0x00, 0x07, 0xd6, 0x36, 0xc0, 0x0f, 0x06, 0x02, 0x06, 0x02, 0x06, 0x03, 0xc8, 0x80, 0x80, 0xd7, 0x31, 0x7a, 0x0f, 0x69,
+    0x38, 0x06, 0x16, 0x09, 0x00, 0x07, 0xd8, 0x31, 0x7b, 0x0f, 0x90, 0x06, 0x8a, 0x06, 0x01, 0x03, 0x00, 0x47, 0x20, 0x3e, 0x04, 0xe5, 0x06, 0x06,
+    0x03, 0xc5, 0x80, 0x80, 0x55, 0xff, 0x53, 0xff, 0xab, 0x00, 0xad, 0x00, 0x09, 0x00, 0x07, 0x56, 0xff, 0x55, 0xff, 0x53, 0x01, 0x56, 0x01, 0x02,
+    0x06, 0x03, 0xc4, 0x80, 0x80, 0x98, 0x45, 0x38, 0x3f, 0xee, 0x46, 0x8e, 0x40, 0x3a, 0x00, 0x01, 0xed, 0x46, 0xe3, 0x3f, 0x03, 0xed, 0x46, 0x40,
+    0x40, 0xa0, 0x46, 0x8d, 0x40, 0x43, 0x46, 0x8d, 0x40, 0x03, 0xe6, 0x45, 0x8d, 0x40, 0x9a, 0x45, 0x40, 0x40, 0x9a, 0x45, 0xe3, 0x3f, 0x03, 0x9a,
+    0x45, 0x86, 0x3f, 0xe6, 0x45, 0x3a, 0x3f, 0x43, 0x46, 0x3a, 0x3f, 0x03, 0xa3, 0x46, 0x3d, 0x3f, 0xed, 0x46, 0x86, 0x3f, 0xed, 0x46, 0xe3, 0x3f,
+    0x04, 0x01, 0x03, 0x80, 0x44, 0xa0, 0x40, 0x04, 0xe5, 0x06, 0x06, 0x03, 0xc5, 0x80, 0x80, 0x55, 0xff, 0x53, 0xff, 0xab, 0x00, 0xad, 0x00, 0x09,
+    0x00, 0x07, 0x56, 0xff, 0x55, 0xff, 0x53, 0x01, 0x56, 0x01, 0x02, 0x06, 0x03, 0xc4, 0x7f, 0x80, 0x0f, 0x42, 0x38, 0x3f, 0x65, 0x43, 0x8e, 0x40,
+    0x3a, 0x00, 0x01, 0x63, 0x43, 0xe3, 0x3f, 0x03, 0x63, 0x43, 0x40, 0x40, 0x16, 0x43, 0x8d, 0x40, 0xba, 0x42, 0x8d, 0x40, 0x03, 0x5d, 0x42, 0x8d,
+    0x40, 0x10, 0x42, 0x40, 0x40, 0x10, 0x42, 0xe3, 0x3f, 0x03, 0x10, 0x42, 0x86, 0x3f, 0x5d, 0x42, 0x3a, 0x3f, 0xba, 0x42, 0x3a, 0x3f, 0x03, 0x1a,
+    0x43, 0x3d, 0x3f, 0x63, 0x43, 0x86, 0x3f, 0x63, 0x43, 0xe3, 0x3f, 0x04, 0x01, 0x03, 0x00, 0x42, 0x20, 0x3e, 0x04, 0xe5, 0x06, 0x06, 0x03, 0xc5,
+    0x80, 0x80, 0x55, 0xff, 0x53, 0xff, 0xab, 0x00, 0xad, 0x00, 0x09, 0x00, 0x07, 0x56, 0xff, 0x55, 0xff, 0x53, 0x01, 0x56, 0x01, 0x02, 0x01, 0x03,
+    0xba, 0x42, 0x5d, 0x3c, 0x04, 0xe5, 0x06, 0x06, 0x03, 0xc5, 0x80, 0x80, 0x55, 0xff, 0x53, 0xff, 0xab, 0x00, 0xad, 0x00, 0x09, 0x00, 0x07, 0x56,
+    0xff, 0x55, 0xff, 0x53, 0x01, 0x56, 0x01, 0x02, 0x01, 0x03, 0x80, 0x44, 0xa0, 0x3b, 0x04, 0xe5, 0x06, 0x06, 0x03, 0xc5, 0x80, 0x80, 0x55, 0xff,
+    0x53, 0xff, 0xab, 0x00, 0xad, 0x00, 0x09, 0x00, 0x07, 0x56, 0xff, 0x55, 0xff, 0x53, 0x01, 0x56, 0x01, 0x02, 0x01, 0x03, 0x43, 0x46, 0x5d, 0x3c,
+    0x04, 0xe5, 0x06, 0x06, 0x03, 0xc5, 0x80, 0x80, 0x55, 0xff, 0x53, 0xff, 0xab, 0x00, 0xad, 0x00, 0x09, 0x00, 0x07, 0x56, 0xff, 0x55, 0xff, 0x53,
+    0x01, 0x56, 0x01, 0x02, 0x06, 0x00, 0xc7, 0x80, 0x80, 0xc5, 0x42, 0x65, 0x3c, 0x3b, 0x46, 0xdb, 0x3f, 0x09, 0x00, 0x07, 0xc6, 0x42, 0x66, 0x3c,
+    0x73, 0x03, 0x73, 0x03, 0x06, 0x03, 0xc1, 0x80, 0x80, 0x9b, 0x42, 0x5b, 0x0e, 0x65, 0x43, 0x25, 0x0f, 0x09, 0x00, 0x07, 0x9d, 0x42, 0x5d, 0x0e,
+    0xc6, 0x00, 0xc6, 0x00, 0x06, 0x03, 0xc2, 0x7f, 0x80, 0x5f, 0x42, 0x3b, 0x0f, 0x28, 0x43, 0x05, 0x10, 0x09, 0x00, 0x07, 0x60, 0x42, 0x3d, 0x0f,
+    0xc6, 0x00, 0xc6, 0x00, 0x06, 0x03, 0xc2, 0x80, 0x7f, 0xbb, 0x41, 0xdf, 0x0f, 0x85, 0x42, 0xa8, 0x10, 0x09, 0x00, 0x07, 0xbd, 0x41, 0xe0, 0x0f,
+    0xc6, 0x00, 0xc6, 0x00, 0x06, 0x03, 0xc1, 0x80, 0x80, 0xdb, 0x40, 0x1b, 0x10, 0xa5, 0x41, 0xe5, 0x10, 0x09, 0x00, 0x07, 0xdd, 0x40, 0x1d, 0x10,
+    0xc6, 0x00, 0xc6, 0x00, 0x06, 0x03, 0xc2, 0x80, 0x7f, 0xfb, 0x3f, 0xdf, 0x0f, 0xc5, 0x40, 0xa8, 0x10, 0x09, 0x00, 0x07, 0xfd, 0x3f, 0xe0, 0x0f,
+    0xc6, 0x00, 0xc6, 0x00, 0x06, 0x03, 0xc2, 0x80, 0x80, 0x58, 0x3f, 0x3b, 0x0f, 0x21, 0x40, 0x05, 0x10, 0x09, 0x00, 0x07, 0x5a, 0x3f, 0x3d, 0x0f,
+    0xc6, 0x00, 0xc6, 0x00, 0x06, 0x03, 0xc1, 0x80, 0x80, 0x1b, 0x3f, 0x5b, 0x0e, 0xe5, 0x3f, 0x25, 0x0f, 0x09, 0x00, 0x07, 0x1d, 0x3f, 0x5d, 0x0e,
+    0xc6, 0x00, 0xc6, 0x00, 0x06, 0x03, 0xc2, 0x80, 0x80, 0x58, 0x3f, 0x7b, 0x0d, 0x21, 0x40, 0x45, 0x0e, 0x09, 0x00, 0x07, 0x5a, 0x3f, 0x7d, 0x0d,
+    0xc6, 0x00, 0xc6, 0x00, 0x06, 0x03, 0xc2, 0x80, 0x80, 0xfb, 0x3f, 0xd8, 0x0c, 0xc5, 0x40, 0xa1, 0x0d, 0x09, 0x00, 0x07, 0xfd, 0x3f, 0xda, 0x0c,
+    0xc6, 0x00, 0xc6, 0x00, 0x06, 0x03, 0xc1, 0x80, 0x80, 0xdb, 0x40, 0x9b, 0x0c, 0xa5, 0x41, 0x65, 0x0d, 0x09, 0x00, 0x07, 0xdd, 0x40, 0x9d, 0x0c,
+    0xc6, 0x00, 0xc6, 0x00, 0x06, 0x03, 0xc2, 0x80, 0x80, 0xbb, 0x41, 0xd8, 0x0c, 0x85, 0x42, 0xa1, 0x0d, 0x09, 0x00, 0x07, 0xbd, 0x41, 0xda, 0x0c,
+    0xc6, 0x00, 0xc6, 0x00, 0x06, 0x03, 0xc2, 0x7f, 0x80, 0x5f, 0x42, 0x7b, 0x0d, 0x28, 0x43, 0x45, 0x0e, 0x09, 0x00, 0x07, 0x60, 0x42, 0x7d, 0x0d,
+    0xc6, 0x00, 0xc6, 0x00, 0x06, 0x02, 0xc6, 0x80, 0x80, 0xc0, 0x3f, 0x43, 0x0d, 0xc0, 0x42, 0x3d, 0x10, 0x09, 0x00, 0x07, 0xc2, 0x3f, 0x45, 0x0d,
+    0xfd, 0x02, 0xf6, 0x02, 0x06, 0x02, 0xc5, 0x80, 0x80, 0xeb, 0x53, 0x0b, 0x0e, 0xd5, 0x55, 0xf5, 0x0f, 0x09, 0x00, 0x07, 0xed, 0x53, 0x0d, 0x0e,
+    0xe6, 0x01, 0xe6, 0x01, 0x06, 0x02, 0xc6, 0x7f, 0x80, 0x3f, 0x53, 0xe5, 0x0f, 0x28, 0x55, 0xce, 0x11, 0x09, 0x00, 0x07, 0x40, 0x53, 0xe6, 0x0f,
+    0xe6, 0x01, 0xe6, 0x01, 0x06, 0x02, 0xc5, 0x80, 0x80, 0x8b, 0x51, 0xdf, 0x10, 0x75, 0x53, 0xcb, 0x12, 0x3a, 0x00, 0x01, 0x73, 0x53, 0xd6, 0x11,
+    0x03, 0x73, 0x53, 0x5d, 0x12, 0x06, 0x53, 0xca, 0x12, 0x80, 0x52, 0xca, 0x12, 0x03, 0xfa, 0x51, 0xca, 0x12, 0x8d, 0x51, 0x5d, 0x12, 0x8d, 0x51,
+    0xd6, 0x11, 0x03, 0x8d, 0x51, 0x50, 0x11, 0xfa, 0x51, 0xe3, 0x10, 0x80, 0x52, 0xe3, 0x10, 0x03, 0x06, 0x53, 0xe0, 0x10, 0x73, 0x53, 0x4d, 0x11,
+    0x73, 0x53, 0xd6, 0x11, 0x04, 0x06, 0x02, 0xc6, 0x80, 0x80, 0x9b, 0x4f, 0x88, 0x10, 0x85, 0x51, 0x71, 0x12, 0x09, 0x00, 0x07, 0x9d, 0x4f, 0x8a,
+    0x10, 0xe6, 0x01, 0xe6, 0x01, 0x06, 0x02, 0xc5, 0x80, 0x80, 0x58, 0x4e, 0x05, 0x0f, 0x41, 0x50, 0xf1, 0x10, 0x3a, 0x00, 0x01, 0x40, 0x50, 0xfd,
+    0x0f, 0x03, 0x40, 0x50, 0x83, 0x10, 0xd3, 0x4f, 0xf0, 0x10, 0x4d, 0x4f, 0xf0, 0x10, 0x03, 0xc6, 0x4e, 0xf0, 0x10, 0x5a, 0x4e, 0x83, 0x10, 0x5a,
+    0x4e, 0xfd, 0x0f, 0x03, 0x5a, 0x4e, 0x76, 0x0f, 0xc6, 0x4e, 0x0a, 0x0f, 0x4d, 0x4f, 0x0a, 0x0f, 0x03, 0xd3, 0x4f, 0x06, 0x0f, 0x40, 0x50, 0x73,
+    0x0f, 0x40, 0x50, 0xfd, 0x0f, 0x04, 0x06, 0x02, 0xc6, 0x80, 0x7f, 0x58, 0x4e, 0x0f, 0x0d, 0x41, 0x50, 0xf8, 0x0e, 0x09, 0x00, 0x07, 0x5a, 0x4e,
+    0x10, 0x0d, 0xe6, 0x01, 0xe6, 0x01, 0x06, 0x02, 0xc4, 0x80, 0x80, 0x9b, 0x4f, 0x8b, 0x0b, 0x85, 0x51, 0x78, 0x0d, 0x3a, 0x00, 0x01, 0x83, 0x51,
+    0x83, 0x0c, 0x03, 0x83, 0x51, 0x0a, 0x0d, 0x16, 0x51, 0x76, 0x0d, 0x90, 0x50, 0x76, 0x0d, 0x03, 0x0a, 0x50, 0x76, 0x0d, 0x9d, 0x4f, 0x0a, 0x0d,
+    0x9d, 0x4f, 0x83, 0x0c, 0x03, 0x9d, 0x4f, 0xfd, 0x0b, 0x0a, 0x50, 0x90, 0x0b, 0x90, 0x50, 0x90, 0x0b, 0x03, 0x16, 0x51, 0x8d, 0x0b, 0x83, 0x51,
+    0xfd, 0x0b, 0x83, 0x51, 0x83, 0x0c, 0x04, 0x06, 0x02, 0xc6, 0x80, 0x80, 0x8b, 0x51, 0x35, 0x0b, 0x75, 0x53, 0x1e, 0x0d, 0x09, 0x00, 0x07, 0x8d,
+    0x51, 0x36, 0x0b, 0xe6, 0x01, 0xe6, 0x01, 0x06, 0x02, 0xc6, 0x7f, 0x7f, 0x3f, 0x53, 0x32, 0x0c, 0x28, 0x55, 0x1b, 0x0e, 0x09, 0x00, 0x07, 0x40,
+    0x53, 0x33, 0x0c, 0xe6, 0x01, 0xe6, 0x01, 0x06, 0x03, 0xc7, 0x80, 0x80, 0x35, 0x4f, 0x35, 0x0c, 0xcb, 0x54, 0xcb, 0x11, 0x09, 0x00, 0x07, 0x36,
+    0x4f, 0x36, 0x0c, 0x93, 0x05, 0x93, 0x05, 0x06, 0x06, 0xc6, 0x80, 0x7f, 0xef, 0x59, 0x0f, 0x33, 0x51, 0x5b, 0x71, 0x34, 0x09, 0x00, 0x07, 0xf0,
+    0x59, 0x10, 0x33, 0x60, 0x01, 0x60, 0x01, 0x06, 0x06, 0xc6, 0x7f, 0x80, 0x4f, 0x59, 0xbf, 0x34, 0xb1, 0x5a, 0x21, 0x36, 0x09, 0x00, 0x07, 0x50,
+    0x59, 0xc0, 0x34, 0x60, 0x01, 0x60, 0x01, 0x06, 0x06, 0xc5, 0x7f, 0x7f, 0xc2, 0x57, 0xa5, 0x35, 0x25, 0x59, 0x08, 0x37, 0x09, 0x00, 0x07, 0xc3,
+    0x57, 0xa6, 0x35, 0x60, 0x01, 0x60, 0x01, 0x06, 0x06, 0xc5, 0x80, 0x7f, 0xff, 0x55, 0x55, 0x35, 0x61, 0x57, 0xb8, 0x36, 0x09, 0x00, 0x07, 0x00,
+    0x56, 0x56, 0x35, 0x60, 0x01, 0x60, 0x01, 0x06, 0x06, 0xc5, 0x7f, 0x7f, 0xd5, 0x54, 0xf5, 0x33, 0x38, 0x56, 0x58, 0x35, 0x09, 0x00, 0x07, 0xd6,
+    0x54, 0xf6, 0x33, 0x60, 0x01, 0x60, 0x01, 0x06, 0x06, 0xc5, 0x7f, 0x80, 0xd5, 0x54, 0x28, 0x32, 0x38, 0x56, 0x8b, 0x33, 0x3a, 0x00, 0x01, 0x36,
+    0x56, 0xda, 0x32, 0x03, 0x36, 0x56, 0x3a, 0x33, 0xea, 0x55, 0x8a, 0x33, 0x86, 0x55, 0x8a, 0x33, 0x03, 0x26, 0x55, 0x8a, 0x33, 0xd6, 0x54, 0x3d,
+    0x33, 0xd6, 0x54, 0xda, 0x32, 0x03, 0xd6, 0x54, 0x7a, 0x32, 0x23, 0x55, 0x2a, 0x32, 0x86, 0x55, 0x2a, 0x32, 0x03, 0xea, 0x55, 0x2d, 0x32, 0x36,
+    0x56, 0x7a, 0x32, 0x36, 0x56, 0xda, 0x32, 0x04, 0x06, 0x06, 0xc5, 0x7f, 0x80, 0xff, 0x55, 0xc8, 0x30, 0x61, 0x57, 0x2b, 0x32, 0x3a, 0x00, 0x01,
+    0x60, 0x57, 0x7a, 0x31, 0x03, 0x60, 0x57, 0xda, 0x31, 0x13, 0x57, 0x2a, 0x32, 0xb0, 0x56, 0x2a, 0x32, 0x03, 0x50, 0x56, 0x2a, 0x32, 0x00, 0x56,
+    0xdd, 0x31, 0x00, 0x56, 0x7a, 0x31, 0x03, 0x00, 0x56, 0x1a, 0x31, 0x4d, 0x56, 0xca, 0x30, 0xb0, 0x56, 0xca, 0x30, 0x03, 0x10, 0x57, 0xcd, 0x30,
+    0x60, 0x57, 0x1a, 0x31, 0x60, 0x57, 0x7a, 0x31, 0x04, 0x06, 0x06, 0xc5, 0x7f, 0x80, 0xc2, 0x57, 0x78, 0x30, 0x25, 0x59, 0xdb, 0x31, 0x3a, 0x00,
+    0x01, 0x23, 0x59, 0x2a, 0x31, 0x03, 0x23, 0x59, 0x8a, 0x31, 0xd6, 0x58, 0xda, 0x31, 0x73, 0x58, 0xda, 0x31, 0x03, 0x13, 0x58, 0xda, 0x31, 0xc3,
+    0x57, 0x8d, 0x31, 0xc3, 0x57, 0x2a, 0x31, 0x03, 0xc3, 0x57, 0xca, 0x30, 0x10, 0x58, 0x7a, 0x30, 0x73, 0x58, 0x7a, 0x30, 0x03, 0xd6, 0x58, 0x7d,
+    0x30, 0x23, 0x59, 0xca, 0x30, 0x23, 0x59, 0x2a, 0x31, 0x04, 0x06, 0x06, 0xc6, 0x7f, 0x80, 0x4f, 0x59, 0x5f, 0x31, 0xb1, 0x5a, 0xc1, 0x32, 0x09,
+    0x00, 0x07, 0x50, 0x59, 0x60, 0x31, 0x60, 0x01, 0x60, 0x01, 0x06, 0x03, 0xc7, 0x7f, 0x80, 0xff, 0x55, 0xc2, 0x31, 0x05, 0x5a, 0xc1, 0x35, 0x09,
+    0x00, 0x07, 0x00, 0x56, 0xc3, 0x31, 0x03, 0x04, 0xfd, 0x03, 0x06, 0x06, 0xc4, 0x80, 0x80, 0xb8, 0x0f, 0x58, 0x12, 0xc8, 0x10, 0x68, 0x13, 0x09,
+    0x00, 0x07, 0xba, 0x0f, 0x5a, 0x12, 0x0d, 0x01, 0x0d, 0x01, 0x06, 0x06, 0xc4, 0x80, 0x80, 0x32, 0x0f, 0xcb, 0x13, 0x41, 0x10, 0xdb, 0x14, 0x09,
+    0x00, 0x07, 0x33, 0x0f, 0xcd, 0x13, 0x0d, 0x01, 0x0d, 0x01, 0x06, 0x06, 0xc4, 0x80, 0x7f, 0xdb, 0x0d, 0x8f, 0x14, 0xeb, 0x0e, 0x9e, 0x15, 0x09,
+    0x00, 0x07, 0xdd, 0x0d, 0x90, 0x14, 0x0d, 0x01, 0x0d, 0x01, 0x06, 0x06, 0xc4, 0x80, 0x80, 0x58, 0x0c, 0x4b, 0x14, 0x68, 0x0d, 0x5b, 0x15, 0x09,
+    0x00, 0x07, 0x5a, 0x0c, 0x4d, 0x14, 0x0d, 0x01, 0x0d, 0x01, 0x06, 0x06, 0xc4, 0x80, 0x7f, 0x5b, 0x0b, 0x1f, 0x13, 0x6b, 0x0c, 0x2e, 0x14, 0x09,
+    0x00, 0x07, 0x5d, 0x0b, 0x20, 0x13, 0x0d, 0x01, 0x0d, 0x01, 0x06, 0x06, 0xc3, 0x80, 0x80, 0x5b, 0x0b, 0x92, 0x11, 0x6b, 0x0c, 0xa1, 0x12, 0x3a,
+    0x00, 0x01, 0x6a, 0x0c, 0x1a, 0x12, 0x03, 0x6a, 0x0c, 0x63, 0x12, 0x2d, 0x0c, 0xa0, 0x12, 0xe3, 0x0b, 0xa0, 0x12, 0x03, 0x9a, 0x0b, 0xa0, 0x12,
+    0x5d, 0x0b, 0x63, 0x12, 0x5d, 0x0b, 0x1a, 0x12, 0x03, 0x5d, 0x0b, 0xd0, 0x11, 0x9a, 0x0b, 0x93, 0x11, 0xe3, 0x0b, 0x93, 0x11, 0x03, 0x2d, 0x0c,
+    0x96, 0x11, 0x6a, 0x0c, 0xd0, 0x11, 0x6a, 0x0c, 0x1a, 0x12, 0x04, 0x06, 0x06, 0xc4, 0x80, 0x7f, 0x58, 0x0c, 0x65, 0x10, 0x68, 0x0d, 0x75, 0x11,
+    0x09, 0x00, 0x07, 0x5a, 0x0c, 0x66, 0x10, 0x0d, 0x01, 0x0d, 0x01, 0x06, 0x06, 0xc4, 0x80, 0x80, 0xdb, 0x0d, 0x22, 0x10, 0xeb, 0x0e, 0x31, 0x11,
+    0x09, 0x00, 0x07, 0xdd, 0x0d, 0x23, 0x10, 0x0d, 0x01, 0x0d, 0x01, 0x06, 0x06, 0xc4, 0x80, 0x7f, 0x32, 0x0f, 0xe5, 0x10, 0x41, 0x10, 0xf5, 0x11,
+    0x09, 0x00, 0x07, 0x33, 0x0f, 0xe6, 0x10, 0x0d, 0x01, 0x0d, 0x01, 0x06, 0x03, 0xc7, 0x80, 0x80, 0x78, 0x0c, 0x58, 0x11, 0x88, 0x0f, 0x68, 0x14,
+    0x09, 0x00, 0x07, 0x7a, 0x0c, 0x5a, 0x11, 0x0d, 0x03, 0x0d, 0x03, 0x06, 0x03, 0xc5, 0x80, 0x80, 0x68, 0x48, 0x28, 0xff, 0x18, 0x4a, 0xd8, 0x00,
+    0x09, 0x00, 0x07, 0x6a, 0x48, 0x2a, 0xff, 0xad, 0x01, 0xad, 0x01, 0x06, 0x03, 0xc6, 0x7f, 0x7f, 0xcf, 0x47, 0x2f, 0x01, 0x7e, 0x49, 0xde, 0x02,
+    0x09, 0x00, 0x07, 0xd0, 0x47, 0x30, 0x01, 0xad, 0x01, 0xad, 0x01, 0x06, 0x03, 0xc6, 0x7f, 0x80, 0x35, 0x46, 0x92, 0x02, 0xe5, 0x47, 0x41, 0x04,
+    0x09, 0x00, 0x07, 0x36, 0x46, 0x93, 0x02, 0xad, 0x01, 0xad, 0x01, 0x06, 0x03, 0xc6, 0x7f, 0x7f, 0x1f, 0x44, 0xdf, 0x02, 0xce, 0x45, 0x8e, 0x04,
+    0x09, 0x00, 0x07, 0x20, 0x44, 0xe0, 0x02, 0xad, 0x01, 0xad, 0x01, 0x06, 0x03, 0xc6, 0x80, 0x7f, 0x32, 0x42, 0xff, 0x01, 0xe1, 0x43, 0xae, 0x03,
+    0x09, 0x00, 0x07, 0x33, 0x42, 0x00, 0x02, 0xad, 0x01, 0xad, 0x01, 0x06, 0x03, 0xc6, 0x7f, 0x80, 0x0f, 0x41, 0x38, 0x00, 0xbe, 0x42, 0xe8, 0x01,
+    0x09, 0x00, 0x07, 0x10, 0x41, 0x3a, 0x00, 0xad, 0x01, 0xad, 0x01, 0x06, 0x03, 0xc5, 0x7f, 0x80, 0x0f, 0x41, 0x18, 0xfe, 0xbe, 0x42, 0xc8, 0xff,
+    0x3a, 0x00, 0x01, 0xbd, 0x42, 0xf0, 0xfe, 0x03, 0xbd, 0x42, 0x66, 0xff, 0x5d, 0x42, 0xc6, 0xff, 0xe6, 0x41, 0xc6, 0xff, 0x03, 0x70, 0x41, 0xc6,
+    0xff, 0x10, 0x41, 0x66, 0xff, 0x10, 0x41, 0xf0, 0xfe, 0x03, 0x10, 0x41, 0x7a, 0xfe, 0x70, 0x41, 0x1a, 0xfe, 0xe6, 0x41, 0x1a, 0xfe, 0x03, 0x5d,
+    0x42, 0x1d, 0xfe, 0xbd, 0x42, 0x7d, 0xfe, 0xbd, 0x42, 0xf0, 0xfe, 0x04, 0x06, 0x03, 0xc6, 0x80, 0x7f, 0x32, 0x42, 0x52, 0xfc, 0xe1, 0x43, 0x02,
+    0xfe, 0x09, 0x00, 0x07, 0x33, 0x42, 0x53, 0xfc, 0xad, 0x01, 0xad, 0x01, 0x06, 0x03, 0xc6, 0x7f, 0x80, 0x1f, 0x44, 0x72, 0xfb, 0xce, 0x45, 0x21,
+    0xfd, 0x09, 0x00, 0x07, 0x20, 0x44, 0x73, 0xfb, 0xad, 0x01, 0xad, 0x01, 0x06, 0x03, 0xc6, 0x7f, 0x7f, 0x35, 0x46, 0xbf, 0xfb, 0xe5, 0x47, 0x6e,
+    0xfd, 0x09, 0x00, 0x07, 0x36, 0x46, 0xc0, 0xfb, 0xad, 0x01, 0xad, 0x01, 0x06, 0x03, 0xc6, 0x7f, 0x7f, 0xcf, 0x47, 0x22, 0xfd, 0x7e, 0x49, 0xd2,
+    0xfe, 0x09, 0x00, 0x07, 0xd0, 0x47, 0x23, 0xfd, 0xad, 0x01, 0xad, 0x01, 0x06, 0x04, 0xc7, 0x80, 0x80, 0x88, 0x42, 0x08, 0xfd, 0x78, 0x48, 0xf8,
+    0x02, 0x09, 0x00, 0x07, 0x8a, 0x42, 0x0a, 0xfd, 0xed, 0x05, 0xed, 0x05, 0x06, 0x00, 0xc6, 0x80, 0x80, 0x08, 0x61, 0x88, 0x41, 0xf8, 0x62, 0x78,
+    0x43, 0x09, 0x00, 0x07, 0x0a, 0x61, 0x8a, 0x41, 0xed, 0x01, 0xed, 0x01, 0x06, 0x00, 0xc6, 0x80, 0x80, 0xea, 0x5f, 0xe3, 0x43, 0xd9, 0x61, 0xd0,
+    0x45, 0x09, 0x00, 0x07, 0xeb, 0x5f, 0xe5, 0x43, 0xed, 0x01, 0xea, 0x01, 0x06, 0x00, 0xc6, 0x7f, 0x7f, 0x5f, 0x5d, 0x75, 0x44, 0x4e, 0x5f, 0x65,
+    0x46, 0x09, 0x00, 0x07, 0x60, 0x5d, 0x76, 0x44, 0xed, 0x01, 0xed, 0x01, 0x06, 0x00, 0xc6, 0x7f, 0x7f, 0x55, 0x5b, 0xd5, 0x42, 0x45, 0x5d, 0xc5,
+    0x44, 0x09, 0x00, 0x07, 0x56, 0x5b, 0xd6, 0x42, 0xed, 0x01, 0xed, 0x01, 0x06, 0x00, 0xc6, 0x7f, 0x80, 0x55, 0x5b, 0x3b, 0x40, 0x45, 0x5d, 0x2b,
+    0x42, 0x09, 0x00, 0x07, 0x56, 0x5b, 0x3d, 0x40, 0xed, 0x01, 0xed, 0x01, 0x06, 0x00, 0xc6, 0x7f, 0x80, 0x5f, 0x5d, 0x9b, 0x3e, 0x4e, 0x5f, 0x8b,
+    0x40, 0x09, 0x00, 0x07, 0x60, 0x5d, 0x9d, 0x3e, 0xed, 0x01, 0xed, 0x01, 0x06, 0x00, 0xc6, 0x80, 0x7f, 0xe8, 0x5f, 0x2f, 0x3f, 0xd8, 0x61, 0x1e,
+    0x41, 0x09, 0x00, 0x07, 0xea, 0x5f, 0x30, 0x3f, 0xed, 0x01, 0xed, 0x01, 0x06, 0x04, 0xc7, 0x80, 0x80, 0xc3, 0x5c, 0x47, 0x40, 0x3d, 0x61, 0xb9,
+    0x44, 0x09, 0x00, 0x07, 0xc5, 0x5c, 0x48, 0x40, 0x76, 0x04, 0x70, 0x04, 0x06, 0x03, 0xc7, 0x80, 0x80, 0xfd, 0x49, 0x60, 0x1c, 0x03, 0x4d, 0x60,
+    0x1f, 0x09, 0x00, 0x07, 0xfe, 0x49, 0x62, 0x1c, 0x03, 0x03, 0xfd, 0x02, 0x06, 0x03, 0xc7, 0x80, 0x80, 0x1d, 0x48, 0xa0, 0x1f, 0x23, 0x4b, 0xa0,
+    0x22, 0x09, 0x00, 0x07, 0x1e, 0x48, 0xa2, 0x1f, 0x03, 0x03, 0xfd, 0x02, 0x06, 0x03, 0xc7, 0x80, 0x80, 0x5d, 0x44, 0xa0, 0x1f, 0x63, 0x47, 0xa0,
+    0x22, 0x09, 0x00, 0x07, 0x5e, 0x44, 0xa2, 0x1f, 0x03, 0x03, 0xfd, 0x02, 0x06, 0x03, 0xc7, 0x80, 0x80, 0x7d, 0x42, 0x60, 0x1c, 0x83, 0x45, 0x60,
+    0x1f, 0x09, 0x00, 0x07, 0x7e, 0x42, 0x62, 0x1c, 0x03, 0x03, 0xfd, 0x02, 0x06, 0x03, 0xc7, 0x80, 0x7f, 0x5d, 0x44, 0x20, 0x19, 0x63, 0x47, 0x20,
+    0x1c, 0x09, 0x00, 0x07, 0x5e, 0x44, 0x22, 0x19, 0x03, 0x03, 0xfd, 0x02, 0x06, 0x03, 0xc7, 0x80, 0x7f, 0x1d, 0x48, 0x20, 0x19, 0x23, 0x4b, 0x20,
+    0x1c, 0x09, 0x00, 0x07, 0x1e, 0x48, 0x22, 0x19, 0x03, 0x03, 0xfd, 0x02, 0x06, 0x06, 0xc8, 0x80, 0x80, 0xbf, 0x44, 0xdf, 0x1a, 0xc1, 0x4a, 0xe1,
+    0x20, 0x09, 0x00, 0x07, 0xc0, 0x44, 0xe0, 0x1a, 0x00, 0x06, 0x00, 0x06, 0x06, 0x02, 0xc6, 0x7f, 0x80, 0x5f, 0x04, 0x9f, 0xff, 0x21, 0x06, 0x61,
+    0x01, 0x3a, 0x00, 0x01, 0x20, 0x06, 0x80, 0x00, 0x03, 0x20, 0x06, 0xfa, 0x00, 0xbd, 0x05, 0x60, 0x01, 0x40, 0x05, 0x60, 0x01, 0x03, 0xc6, 0x04,
+    0x60, 0x01, 0x60, 0x04, 0xfd, 0x00, 0x60, 0x04, 0x80, 0x00, 0x03, 0x60, 0x04, 0x06, 0x00, 0xc3, 0x04, 0xa0, 0xff, 0x40, 0x05, 0xa0, 0xff, 0x03,
+    0xba, 0x05, 0xa0, 0xff, 0x1d, 0x06, 0x06, 0x00, 0x20, 0x06, 0x80, 0x00, 0x04, 0x06, 0x02, 0xc2, 0x80, 0x80, 0x85, 0x03, 0xa5, 0x01, 0x48, 0x05,
+    0x6b, 0x03, 0x3a, 0x00, 0x01, 0x46, 0x05, 0x8a, 0x02, 0x03, 0x46, 0x05, 0x03, 0x03, 0xe3, 0x04, 0x6a, 0x03, 0x66, 0x04, 0x66, 0x03, 0x03, 0xea,
+    0x03, 0x63, 0x03, 0x86, 0x03, 0x03, 0x03, 0x8a, 0x03, 0x86, 0x02, 0x03, 0x8a, 0x03, 0x0d, 0x02, 0xed, 0x03, 0xa6, 0x01, 0x6a, 0x04, 0xaa, 0x01,
+    0x03, 0xe3, 0x04, 0xaa, 0x01, 0x46, 0x05, 0x0d, 0x02, 0x46, 0x05, 0x8a, 0x02, 0x04, 0x06, 0x02, 0xc6, 0x7f, 0x80, 0x7f, 0x01, 0x7f, 0x02, 0x41,
+    0x03, 0x41, 0x04, 0x3a, 0x00, 0x01, 0x40, 0x03, 0x60, 0x03, 0x03, 0x40, 0x03, 0xda, 0x03, 0xdd, 0x02, 0x40, 0x04, 0x60, 0x02, 0x40, 0x04, 0x03,
+    0xe6, 0x01, 0x40, 0x04, 0x80, 0x01, 0xdd, 0x03, 0x80, 0x01, 0x60, 0x03, 0x03, 0x80, 0x01, 0xe6, 0x02, 0xe3, 0x01, 0x80, 0x02, 0x60, 0x02, 0x80,
+    0x02, 0x03, 0xda, 0x02, 0x80, 0x02, 0x3d, 0x03, 0xe6, 0x02, 0x40, 0x03, 0x60, 0x03, 0x04, 0x06, 0x02, 0xc6, 0x7f, 0x80, 0x75, 0xff, 0xa8, 0x01,
+    0x38, 0x01, 0x6b, 0x03, 0x09, 0x00, 0x07, 0x76, 0xff, 0xaa, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0x06, 0x02, 0xc6, 0x7f, 0x80, 0x9f, 0xfe, 0x9f, 0xff,
+    0x61, 0x00, 0x61, 0x01, 0x3a, 0x00, 0x01, 0x60, 0x00, 0x80, 0x00, 0x03, 0x60, 0x00, 0xfa, 0x00, 0xfd, 0xff, 0x60, 0x01, 0x80, 0xff, 0x60, 0x01,
+    0x03, 0x06, 0xff, 0x60, 0x01, 0xa0, 0xfe, 0xfd, 0x00, 0xa0, 0xfe, 0x80, 0x00, 0x03, 0xa0, 0xfe, 0x06, 0x00, 0x03, 0xff, 0xa0, 0xff, 0x80, 0xff,
+    0xa0, 0xff, 0x03, 0xfa, 0xff, 0xa0, 0xff, 0x5d, 0x00, 0x06, 0x00, 0x60, 0x00, 0x80, 0x00, 0x04, 0x06, 0x02, 0xc5, 0x7f, 0x80, 0x75, 0xff, 0x95,
+    0xfd, 0x38, 0x01, 0x58, 0xff, 0x3a, 0x00, 0x01, 0x36, 0x01, 0x76, 0xfe, 0x03, 0x36, 0x01, 0xf0, 0xfe, 0xd3, 0x00, 0x56, 0xff, 0x56, 0x00, 0x56,
+    0xff, 0x03, 0xda, 0xff, 0x56, 0xff, 0x76, 0xff, 0xf3, 0xfe, 0x76, 0xff, 0x76, 0xfe, 0x03, 0x76, 0xff, 0xfd, 0xfd, 0xda, 0xff, 0x96, 0xfd, 0x56,
+    0x00, 0x96, 0xfd, 0x03, 0xd3, 0x00, 0x9a, 0xfd, 0x36, 0x01, 0xfd, 0xfd, 0x36, 0x01, 0x76, 0xfe, 0x04, 0x06, 0x02, 0xc6, 0x7f, 0x80, 0x7f, 0x01,
+    0xbf, 0xfc, 0x41, 0x03, 0x81, 0xfe, 0x3a, 0x00, 0x01, 0x40, 0x03, 0xa0, 0xfd, 0x03, 0x40, 0x03, 0x1a, 0xfe, 0xdd, 0x02, 0x80, 0xfe, 0x60, 0x02,
+    0x80, 0xfe, 0x03, 0xe3, 0x01, 0x80, 0xfe, 0x80, 0x01, 0x1d, 0xfe, 0x80, 0x01, 0xa0, 0xfd, 0x03, 0x80, 0x01, 0x26, 0xfd, 0xe3, 0x01, 0xc0, 0xfc,
+    0x60, 0x02, 0xc0, 0xfc, 0x03, 0xda, 0x02, 0xc0, 0xfc, 0x3d, 0x03, 0x26, 0xfd, 0x40, 0x03, 0xa0, 0xfd, 0x04, 0x06, 0x02, 0xc2, 0x80, 0x80, 0x85,
+    0x03, 0x92, 0xfd, 0x48, 0x05, 0x58, 0xff, 0x3a, 0x00, 0x01, 0x46, 0x05, 0x76, 0xfe, 0x03, 0x46, 0x05, 0xf0, 0xfe, 0xe3, 0x04, 0x56, 0xff, 0x66,
+    0x04, 0x53, 0xff, 0x03, 0xea, 0x03, 0x50, 0xff, 0x86, 0x03, 0xf0, 0xfe, 0x8a, 0x03, 0x73, 0xfe, 0x03, 0x8a, 0x03, 0xfa, 0xfd, 0xed, 0x03, 0x93,
+    0xfd, 0x6a, 0x04, 0x96, 0xfd, 0x03, 0xe3, 0x04, 0x9a, 0xfd, 0x46, 0x05, 0xfd, 0xfd, 0x46, 0x05, 0x76, 0xfe, 0x04, 0x06, 0x03, 0xc7, 0x80, 0x80,
+    0x18, 0x00, 0x38, 0xfe, 0xa8, 0x04, 0xc8, 0x02, 0x09, 0x00, 0x07, 0x1a, 0x00, 0x3a, 0xfe, 0x8d, 0x04, 0x8d, 0x04, 0x06, 0x00, 0xc6, 0x80, 0x80,
+    0xdb, 0x46, 0xbb, 0x26, 0x65, 0x49, 0x45, 0x29, 0x09, 0x00, 0x07, 0xdd, 0x46, 0xbd, 0x26, 0x86, 0x02, 0x86, 0x02, 0x06, 0x00, 0xc6, 0x80, 0x7f,
+    0xeb, 0x45, 0x4f, 0x29, 0x75, 0x48, 0xd8, 0x2b, 0x09, 0x00, 0x07, 0xed, 0x45, 0x50, 0x29, 0x86, 0x02, 0x86, 0x02, 0x06, 0x00, 0xc6, 0x80, 0x80,
+    0x8b, 0x43, 0xab, 0x2a, 0x15, 0x46, 0x35, 0x2d, 0x09, 0x00, 0x07, 0x8d, 0x43, 0xad, 0x2a, 0x86, 0x02, 0x86, 0x02, 0x06, 0x00, 0xc6, 0x80, 0x7f,
+    0xdb, 0x40, 0x32, 0x2a, 0x65, 0x43, 0xbb, 0x2c, 0x09, 0x00, 0x07, 0xdd, 0x40, 0x33, 0x2a, 0x86, 0x02, 0x86, 0x02, 0x06, 0x00, 0xc6, 0x7f, 0x80,
+    0x18, 0x3f, 0x18, 0x28, 0xa1, 0x41, 0xa1, 0x2a, 0x3a, 0x00, 0x01, 0xa0, 0x41, 0x5d, 0x29, 0x03, 0xa0, 0x41, 0x10, 0x2a, 0x10, 0x41, 0xa0, 0x2a,
+    0x5d, 0x40, 0xa0, 0x2a, 0x03, 0xaa, 0x3f, 0xa0, 0x2a, 0x1a, 0x3f, 0x10, 0x2a, 0x1a, 0x3f, 0x5d, 0x29, 0x03, 0x1a, 0x3f, 0xaa, 0x28, 0xaa, 0x3f,
+    0x1a, 0x28, 0x5d, 0x40, 0x1a, 0x28, 0x03, 0x10, 0x41, 0x1d, 0x28, 0xa0, 0x41, 0xad, 0x28, 0xa0, 0x41, 0x5d, 0x29, 0x04, 0x06, 0x00, 0xc7, 0x80,
+    0x7f, 0x18, 0x3f, 0x5f, 0x25, 0xa1, 0x41, 0xe8, 0x27, 0x09, 0x00, 0x07, 0x1a, 0x3f, 0x60, 0x25, 0x86, 0x02, 0x86, 0x02, 0x06, 0x00, 0xc6, 0x80,
+    0x80, 0xdb, 0x40, 0x45, 0x23, 0x65, 0x43, 0xce, 0x25, 0x09, 0x00, 0x07, 0xdd, 0x40, 0x46, 0x23, 0x86, 0x02, 0x86, 0x02, 0x06, 0x00, 0xc6, 0x80,
+    0x80, 0x8b, 0x43, 0xcb, 0x22, 0x15, 0x46, 0x55, 0x25, 0x09, 0x00, 0x07, 0x8d, 0x43, 0xcd, 0x22, 0x86, 0x02, 0x86, 0x02, 0x06, 0x00, 0xc6, 0x7f,
+    0x80, 0xeb, 0x45, 0x28, 0x24, 0x75, 0x48, 0xb1, 0x26, 0x3a, 0x00, 0x01, 0x73, 0x48, 0x6d, 0x25, 0x03, 0x73, 0x48, 0x20, 0x26, 0xe3, 0x47, 0xb0,
+    0x26, 0x30, 0x47, 0xb0, 0x26, 0x03, 0x7d, 0x46, 0xb0, 0x26, 0xed, 0x45, 0x20, 0x26, 0xed, 0x45, 0x6d, 0x25, 0x03, 0xed, 0x45, 0xba, 0x24, 0x7d,
+    0x46, 0x2a, 0x24, 0x30, 0x47, 0x2a, 0x24, 0x03, 0xe3, 0x47, 0x2d, 0x24, 0x73, 0x48, 0xbd, 0x24, 0x73, 0x48, 0x6d, 0x25, 0x04, 0x06, 0x04, 0xc8,
+    0x80, 0x7f, 0x6b, 0x40, 0x4f, 0x24, 0xce, 0x47, 0xab, 0x2b, 0x09, 0x00, 0x07, 0x6d, 0x40, 0x50, 0x24, 0x60, 0x07, 0x5a, 0x07, 0x06, 0x04, 0xc5,
+    0x80, 0x80, 0x9f, 0x0a, 0x9f, 0x06, 0xa1, 0x0b, 0xa1, 0x07, 0x09, 0x00, 0x07, 0xa0, 0x0a, 0xa0, 0x06, 0x00, 0x01, 0x00, 0x01, 0x06, 0x04, 0xc3,
+    0x7f, 0x7f, 0x42, 0x0a, 0x82, 0x07, 0x45, 0x0b, 0x85, 0x08, 0x3a, 0x00, 0x01, 0x43, 0x0b, 0x03, 0x08, 0x03, 0x43, 0x0b, 0x4a, 0x08, 0x0a, 0x0b,
+    0x83, 0x08, 0xc3, 0x0a, 0x83, 0x08, 0x03, 0x7d, 0x0a, 0x83, 0x08, 0x43, 0x0a, 0x4a, 0x08, 0x43, 0x0a, 0x03, 0x08, 0x03, 0x43, 0x0a, 0xbd, 0x07,
+    0x7d, 0x0a, 0x83, 0x07, 0xc3, 0x0a, 0x83, 0x07, 0x03, 0x0a, 0x0b, 0x83, 0x07, 0x40, 0x0b, 0xbd, 0x07, 0x43, 0x0b, 0x03, 0x08, 0x04, 0x06, 0x04,
+    0xc5, 0x80, 0x80, 0x5f, 0x09, 0xdf, 0x07, 0x61, 0x0a, 0xe1, 0x08, 0x09, 0x00, 0x07, 0x60, 0x09, 0xe0, 0x07, 0x00, 0x01, 0x00, 0x01, 0x06, 0x04,
+    0xc4, 0x80, 0x7f, 0x7b, 0x08, 0x82, 0x07, 0x7e, 0x09, 0x85, 0x08, 0x09, 0x00, 0x07, 0x7d, 0x08, 0x83, 0x07, 0x00, 0x01, 0x00, 0x01, 0x06, 0x04,
+    0xc5, 0x80, 0x80, 0x1f, 0x08, 0x9f, 0x06, 0x21, 0x09, 0xa1, 0x07, 0x09, 0x00, 0x07, 0x20, 0x08, 0xa0, 0x06, 0x00, 0x01, 0x00, 0x01, 0x06, 0x04,
+    0xc4, 0x80, 0x80, 0x7b, 0x08, 0xbb, 0x05, 0x7e, 0x09, 0xbe, 0x06, 0x09, 0x00, 0x07, 0x7d, 0x08, 0xbd, 0x05, 0x00, 0x01, 0x00, 0x01, 0x06, 0x04,
+    0xc5, 0x80, 0x80, 0x5f, 0x09, 0x5f, 0x05, 0x61, 0x0a, 0x61, 0x06, 0x09, 0x00, 0x07, 0x60, 0x09, 0x60, 0x05, 0x00, 0x01, 0x00, 0x01, 0x06, 0x04,
+    0xc3, 0x7f, 0x80, 0x42, 0x0a, 0xbb, 0x05, 0x45, 0x0b, 0xbe, 0x06, 0x3a, 0x00, 0x01, 0x43, 0x0b, 0x3d, 0x06, 0x03, 0x43, 0x0b, 0x83, 0x06, 0x0a,
+    0x0b, 0xbd, 0x06, 0xc3, 0x0a, 0xbd, 0x06, 0x03, 0x7d, 0x0a, 0xbd, 0x06, 0x43, 0x0a, 0x83, 0x06, 0x43, 0x0a, 0x3d, 0x06, 0x03, 0x43, 0x0a, 0xf6,
+    0x05, 0x7d, 0x0a, 0xbd, 0x05, 0xc3, 0x0a, 0xbd, 0x05, 0x03, 0x0a, 0x0b, 0xbd, 0x05, 0x40, 0x0b, 0xf6, 0x05, 0x43, 0x0b, 0x3d, 0x06, 0x04, 0x06,
+    0x00, 0xc7, 0x80, 0x80, 0x92, 0x08, 0xd5, 0x05, 0x31, 0x0b, 0x6e, 0x08, 0x09, 0x00, 0x07, 0x93, 0x08, 0xd6, 0x05, 0x9d, 0x02, 0x96, 0x02, 0x06,
+    0x04, 0xc5, 0x80, 0x80, 0xa2, 0x3f, 0x82, 0x5e, 0xde, 0x40, 0xbe, 0x5f, 0x09, 0x00, 0x07, 0xa3, 0x3f, 0x83, 0x5e, 0x3a, 0x01, 0x3a, 0x01, 0x06,
+    0x04, 0xc4, 0x7f, 0x80, 0x22, 0x3f, 0x0b, 0x60, 0x5e, 0x40, 0x48, 0x61, 0x3a, 0x00, 0x01, 0x5d, 0x40, 0xaa, 0x60, 0x03, 0x5d, 0x40, 0x00, 0x61,
+    0x16, 0x40, 0x46, 0x61, 0xc0, 0x3f, 0x46, 0x61, 0x03, 0x6a, 0x3f, 0x46, 0x61, 0x23, 0x3f, 0x00, 0x61, 0x23, 0x3f, 0xaa, 0x60, 0x03, 0x23, 0x3f,
+    0x53, 0x60, 0x6a, 0x3f, 0x0d, 0x60, 0xc0, 0x3f, 0x0d, 0x60, 0x03, 0x16, 0x40, 0x10, 0x60, 0x5d, 0x40, 0x56, 0x60, 0x5d, 0x40, 0xaa, 0x60, 0x04,
+    0x06, 0x04, 0xc5, 0x80, 0x80, 0xd2, 0x3d, 0x02, 0x61, 0x0e, 0x3f, 0x3e, 0x62, 0x09, 0x00, 0x07, 0xd3, 0x3d, 0x03, 0x61, 0x3a, 0x01, 0x3a, 0x01,
+    0x06, 0x04, 0xc5, 0x80, 0x80, 0x32, 0x3c, 0x02, 0x61, 0x6e, 0x3d, 0x3e, 0x62, 0x09, 0x00, 0x07, 0x33, 0x3c, 0x03, 0x61, 0x3a, 0x01, 0x3a, 0x01,
+    0x06, 0x04, 0xc4, 0x7f, 0x80, 0xe2, 0x3a, 0x0b, 0x60, 0x1e, 0x3c, 0x48, 0x61, 0x3a, 0x00, 0x01, 0x1d, 0x3c, 0xaa, 0x60, 0x03, 0x1d, 0x3c, 0x00,
+    0x61, 0xd6, 0x3b, 0x46, 0x61, 0x80, 0x3b, 0x46, 0x61, 0x03, 0x2a, 0x3b, 0x46, 0x61, 0xe3, 0x3a, 0x00, 0x61, 0xe3, 0x3a, 0xaa, 0x60, 0x03, 0xe3,
+    0x3a, 0x53, 0x60, 0x2a, 0x3b, 0x0d, 0x60, 0x80, 0x3b, 0x0d, 0x60, 0x03, 0xd6, 0x3b, 0x10, 0x60, 0x1d, 0x3c, 0x56, 0x60, 0x1d, 0x3c, 0xaa, 0x60,
+    0x04, 0x06, 0x04, 0xc5, 0x80, 0x80, 0x62, 0x3a, 0x82, 0x5e, 0x9e, 0x3b, 0xbe, 0x5f, 0x09, 0x00, 0x07, 0x63, 0x3a, 0x83, 0x5e, 0x3a, 0x01, 0x3a,
+    0x01, 0x06, 0x04, 0xc5, 0x80, 0x7f, 0xe2, 0x3a, 0xf8, 0x5c, 0x1e, 0x3c, 0x35, 0x5e, 0x09, 0x00, 0x07, 0xe3, 0x3a, 0xfa, 0x5c, 0x3a, 0x01, 0x3a,
+    0x01, 0x06, 0x04, 0xc4, 0x7f, 0x80, 0x32, 0x3c, 0x02, 0x5c, 0x6e, 0x3d, 0x3e, 0x5d, 0x3a, 0x00, 0x01, 0x6d, 0x3d, 0xa0, 0x5c, 0x03, 0x6d, 0x3d,
+    0xf6, 0x5c, 0x26, 0x3d, 0x3d, 0x5d, 0xd0, 0x3c, 0x3d, 0x5d, 0x03, 0x7a, 0x3c, 0x3d, 0x5d, 0x33, 0x3c, 0xf6, 0x5c, 0x33, 0x3c, 0xa0, 0x5c, 0x03,
+    0x33, 0x3c, 0x4a, 0x5c, 0x7a, 0x3c, 0x03, 0x5c, 0xd0, 0x3c, 0x03, 0x5c, 0x03, 0x26, 0x3d, 0x06, 0x5c, 0x6d, 0x3d, 0x4a, 0x5c, 0x6d, 0x3d, 0xa0,
+    0x5c, 0x04, 0x06, 0x04, 0xc4, 0x7f, 0x80, 0xd2, 0x3d, 0x02, 0x5c, 0x0e, 0x3f, 0x3e, 0x5d, 0x3a, 0x00, 0x01, 0x0d, 0x3f, 0xa0, 0x5c, 0x03, 0x0d,
+    0x3f, 0xf6, 0x5c, 0xc6, 0x3e, 0x3d, 0x5d, 0x70, 0x3e, 0x3d, 0x5d, 0x03, 0x1a, 0x3e, 0x3d, 0x5d, 0xd3, 0x3d, 0xf6, 0x5c, 0xd3, 0x3d, 0xa0, 0x5c,
+    0x03, 0xd3, 0x3d, 0x4a, 0x5c, 0x1a, 0x3e, 0x03, 0x5c, 0x70, 0x3e, 0x03, 0x5c, 0x03, 0xc6, 0x3e, 0x06, 0x5c, 0x0d, 0x3f, 0x4a, 0x5c, 0x0d, 0x3f,
+    0xa0, 0x5c, 0x04, 0x06, 0x04, 0xc5, 0x80, 0x7f, 0x22, 0x3f, 0xf8, 0x5c, 0x5e, 0x40, 0x35, 0x5e, 0x09, 0x00, 0x07, 0x23, 0x3f, 0xfa, 0x5c, 0x3a,
+    0x01, 0x3a, 0x01, 0x06, 0x02, 0xc7, 0x80, 0x7f, 0xa8, 0x3b, 0x25, 0x5d, 0x9b, 0x3f, 0x18, 0x61, 0x09, 0x00, 0x07, 0xaa, 0x3b, 0x26, 0x5d, 0xf0,
+    0x03, 0xf0, 0x03, 0x06, 0x00, 0xc7, 0x80, 0x80, 0x9f, 0x43, 0xdf, 0x1f, 0xe1, 0x45, 0x21, 0x22, 0x09, 0x00, 0x07, 0xa0, 0x43, 0xe0, 0x1f, 0x40,
+    0x02, 0x40, 0x02, 0x06, 0x00, 0xc6, 0x80, 0x80, 0xeb, 0x42, 0xff, 0x21, 0x2e, 0x45, 0x41, 0x24, 0x3a, 0x00, 0x01, 0x2d, 0x45, 0x20, 0x23, 0x03,
+    0x2d, 0x45, 0xbd, 0x23, 0xad, 0x44, 0x40, 0x24, 0x0d, 0x44, 0x40, 0x24, 0x03, 0x70, 0x43, 0x40, 0x24, 0xed, 0x42, 0xc0, 0x23, 0xed, 0x42, 0x20,
+    0x23, 0x03, 0xed, 0x42, 0x83, 0x22, 0x6d, 0x43, 0x00, 0x22, 0x0d, 0x44, 0x00, 0x22, 0x03, 0xad, 0x44, 0x03, 0x22, 0x2d, 0x45, 0x83, 0x22, 0x2d,
+    0x45, 0x20, 0x23, 0x04, 0x06, 0x00, 0xc6, 0x80, 0x7f, 0x1b, 0x41, 0x52, 0x23, 0x5e, 0x43, 0x95, 0x25, 0x09, 0x00, 0x07, 0x1d, 0x41, 0x53, 0x23,
+    0x40, 0x02, 0x40, 0x02, 0x06, 0x00, 0xc6, 0x80, 0x80, 0xdd, 0x3e, 0x53, 0x23, 0x23, 0x41, 0x96, 0x25, 0x09, 0x00, 0x07, 0xde, 0x3e, 0x55, 0x23,
+    0x43, 0x02, 0x40, 0x02, 0x06, 0x00, 0xc6, 0x7f, 0x80, 0x0f, 0x3d, 0xff, 0x21, 0x51, 0x3f, 0x41, 0x24, 0x3a, 0x00, 0x01, 0x50, 0x3f, 0x20, 0x23,
+    0x03, 0x50, 0x3f, 0xbd, 0x23, 0xd0, 0x3e, 0x40, 0x24, 0x30, 0x3e, 0x40, 0x24, 0x03, 0x93, 0x3d, 0x40, 0x24, 0x10, 0x3d, 0xc0, 0x23, 0x10, 0x3d,
+    0x20, 0x23, 0x03, 0x10, 0x3d, 0x80, 0x22, 0x90, 0x3d, 0x00, 0x22, 0x30, 0x3e, 0x00, 0x22, 0x03, 0xd0, 0x3e, 0x03, 0x22, 0x50, 0x3f, 0x83, 0x22,
+    0x50, 0x3f, 0x20, 0x23, 0x04, 0x06, 0x00, 0xc6, 0x80, 0x80, 0x5d, 0x3c, 0xe0, 0x1f, 0xa3, 0x3e, 0x23, 0x22, 0x09, 0x00, 0x07, 0x5e, 0x3c, 0xe2,
+    0x1f, 0x43, 0x02, 0x40, 0x02, 0x06, 0x00, 0xc7, 0x80, 0x80, 0x0f, 0x3d, 0xbf, 0x1d, 0x51, 0x3f, 0x01, 0x20, 0x09, 0x00, 0x07, 0x10, 0x3d, 0xc0,
+    0x1d, 0x40, 0x02, 0x40, 0x02, 0x06, 0x00, 0xc6, 0x7f, 0x80, 0xdf, 0x3e, 0x6b, 0x1c, 0x21, 0x41, 0xae, 0x1e, 0x3a, 0x00, 0x01, 0x20, 0x41, 0x8d,
+    0x1d, 0x03, 0x20, 0x41, 0x2a, 0x1e, 0xa0, 0x40, 0xad, 0x1e, 0x00, 0x40, 0xad, 0x1e, 0x03, 0x63, 0x3f, 0xad, 0x1e, 0xe0, 0x3e, 0x2d, 0x1e, 0xe0,
+    0x3e, 0x8d, 0x1d, 0x03, 0xe0, 0x3e, 0xed, 0x1c, 0x60, 0x3f, 0x6d, 0x1c, 0x00, 0x40, 0x6d, 0x1c, 0x03, 0xa0, 0x40, 0x70, 0x1c, 0x20, 0x41, 0xf0,
+    0x1c, 0x20, 0x41, 0x8d, 0x1d, 0x04, 0x06, 0x00, 0xc5, 0x80, 0x80, 0x1b, 0x41, 0x6b, 0x1c, 0x5e, 0x43, 0xae, 0x1e, 0x3a, 0x00, 0x01, 0x5d, 0x43,
+    0x8d, 0x1d, 0x03, 0x5d, 0x43, 0x2a, 0x1e, 0xdd, 0x42, 0xad, 0x1e, 0x3d, 0x42, 0xad, 0x1e, 0x03, 0xa0, 0x41, 0xad, 0x1e, 0x1d, 0x41, 0x2d, 0x1e,
+    0x1d, 0x41, 0x8d, 0x1d, 0x03, 0x1d, 0x41, 0xf0, 0x1c, 0x9d, 0x41, 0x6d, 0x1c, 0x3d, 0x42, 0x6d, 0x1c, 0x03, 0xdd, 0x42, 0x70, 0x1c, 0x5d, 0x43,
+    0xf0, 0x1c, 0x5d, 0x43, 0x8d, 0x1d, 0x04, 0x06, 0x00, 0xc7, 0x80, 0x80, 0xeb, 0x42, 0xbf, 0x1d, 0x2e, 0x45, 0x01, 0x20, 0x09, 0x00, 0x07, 0xed,
+    0x42, 0xc0, 0x1d, 0x40, 0x02, 0x40, 0x02, 0x06, 0x04, 0xc8, 0x80, 0x80, 0x7f, 0x3d, 0x5f, 0x1d, 0xc1, 0x44, 0xa1, 0x24, 0x09, 0x00, 0x07, 0x80,
+    0x3d, 0x60, 0x1d, 0x40, 0x07, 0x40, 0x07, 0x06, 0x03, 0xc6, 0x80, 0x80, 0x7f, 0x1c, 0x5f, 0x59, 0x01, 0x1e, 0xe1, 0x5a, 0x09, 0x00, 0x07, 0x80,
+    0x1c, 0x60, 0x59, 0x80, 0x01, 0x80, 0x01, 0x06, 0x03, 0xc5, 0x80, 0x7f, 0xdb, 0x1b, 0x22, 0x5b, 0x5e, 0x1d, 0xa5, 0x5c, 0x09, 0x00, 0x07, 0xdd,
+    0x1b, 0x23, 0x5b, 0x80, 0x01, 0x80, 0x01, 0x06, 0x03, 0xc4, 0x80, 0x80, 0x38, 0x1a, 0x12, 0x5c, 0xbb, 0x1b, 0x98, 0x5d, 0x3a, 0x00, 0x01, 0xba,
+    0x1b, 0xd6, 0x5c, 0x03, 0xba, 0x1b, 0x40, 0x5d, 0x63, 0x1b, 0x96, 0x5d, 0xfa, 0x1a, 0x96, 0x5d, 0x03, 0x90, 0x1a, 0x96, 0x5d, 0x3a, 0x1a, 0x40,
+    0x5d, 0x3a, 0x1a, 0xd6, 0x5c, 0x03, 0x3a, 0x1a, 0x6d, 0x5c, 0x90, 0x1a, 0x16, 0x5c, 0xfa, 0x1a, 0x16, 0x5c, 0x03, 0x63, 0x1b, 0x13, 0x5c, 0xba,
+    0x1b, 0x6a, 0x5c, 0xba, 0x1b, 0xd6, 0x5c, 0x04, 0x06, 0x03, 0xc4, 0x80, 0x80, 0x5f, 0x18, 0xbf, 0x5b, 0xe1, 0x19, 0x45, 0x5d, 0x3a, 0x00, 0x01,
+    0xe0, 0x19, 0x83, 0x5c, 0x03, 0xe0, 0x19, 0xed, 0x5c, 0x8a, 0x19, 0x43, 0x5d, 0x20, 0x19, 0x43, 0x5d, 0x03, 0xb6, 0x18, 0x43, 0x5d, 0x60, 0x18,
+    0xed, 0x5c, 0x60, 0x18, 0x83, 0x5c, 0x03, 0x60, 0x18, 0x1a, 0x5c, 0xb6, 0x18, 0xc3, 0x5b, 0x20, 0x19, 0xc3, 0x5b, 0x03, 0x8a, 0x19, 0xc0, 0x5b,
+    0xe0, 0x19, 0x16, 0x5c, 0xe0, 0x19, 0x83, 0x5c, 0x04, 0x06, 0x03, 0xc6, 0x80, 0x80, 0x28, 0x17, 0x4f, 0x5a, 0xab, 0x18, 0xd1, 0x5b, 0x09, 0x00,
+    0x07, 0x2a, 0x17, 0x50, 0x5a, 0x80, 0x01, 0x80, 0x01, 0x06, 0x03, 0xc6, 0x80, 0x80, 0x28, 0x17, 0x6f, 0x58, 0xab, 0x18, 0xf1, 0x59, 0x09, 0x00,
+    0x07, 0x2a, 0x17, 0x70, 0x58, 0x80, 0x01, 0x80, 0x01, 0x06, 0x03, 0xc6, 0x80, 0x80, 0x5f, 0x18, 0xfb, 0x56, 0xe1, 0x19, 0x7e, 0x58, 0x09, 0x00,
+    0x07, 0x60, 0x18, 0xfd, 0x56, 0x80, 0x01, 0x80, 0x01, 0x06, 0x03, 0xc5, 0x80, 0x80, 0x38, 0x1a, 0xa8, 0x56, 0xbb, 0x1b, 0x2b, 0x58, 0x09, 0x00,
+    0x07, 0x3a, 0x1a, 0xaa, 0x56, 0x80, 0x01, 0x80, 0x01, 0x06, 0x03, 0xc4, 0x80, 0x80, 0xdb, 0x1b, 0x98, 0x57, 0x5e, 0x1d, 0x1e, 0x59, 0x3a, 0x00,
+    0x01, 0x5d, 0x1d, 0x5d, 0x58, 0x03, 0x5d, 0x1d, 0xc6, 0x58, 0x06, 0x1d, 0x1d, 0x59, 0x9d, 0x1c, 0x1d, 0x59, 0x03, 0x33, 0x1c, 0x1d, 0x59, 0xdd,
+    0x1b, 0xc6, 0x58, 0xdd, 0x1b, 0x5d, 0x58, 0x03, 0xdd, 0x1b, 0xf3, 0x57, 0x33, 0x1c, 0x9d, 0x57, 0x9d, 0x1c, 0x9d, 0x57, 0x03, 0x06, 0x1d, 0x9a,
+    0x57, 0x5d, 0x1d, 0xf0, 0x57, 0x5d, 0x1d, 0x5d, 0x58, 0x04, 0x06, 0x00, 0xc7, 0x80, 0x80, 0x4b, 0x18, 0xeb, 0x57, 0xb5, 0x1c, 0x55, 0x5c, 0x09,
+    0x00, 0x07, 0x4d, 0x18, 0xed, 0x57, 0x66, 0x04, 0x66, 0x04, 0x06, 0x04, 0xc7, 0x80, 0x80, 0xd7, 0x04, 0x7a, 0x5a, 0xe9, 0x06, 0x86, 0x5c, 0x09,
+    0x00, 0x07, 0xd8, 0x04, 0x7b, 0x5a, 0x10, 0x02, 0x0a, 0x02, 0x06, 0x04, 0xc5, 0x7f, 0x80, 0x68, 0x03, 0xf5, 0x5c, 0x78, 0x05, 0x05, 0x5f, 0x3a,
+    0x00, 0x01, 0x76, 0x05, 0xfd, 0x5d, 0x03, 0x76, 0x05, 0x8d, 0x5e, 0x00, 0x05, 0x03, 0x5f, 0x70, 0x04, 0x03, 0x5f, 0x03, 0xe0, 0x03, 0x03, 0x5f,
+    0x6a, 0x03, 0x8d, 0x5e, 0x6a, 0x03, 0xfd, 0x5d, 0x03, 0x6a, 0x03, 0x6d, 0x5d, 0xe0, 0x03, 0xf6, 0x5c, 0x70, 0x04, 0xf6, 0x5c, 0x03, 0x00, 0x05,
+    0xfa, 0x5c, 0x76, 0x05, 0x6d, 0x5d, 0x76, 0x05, 0xfd, 0x5d, 0x04, 0x06, 0x04, 0xc5, 0x7f, 0x80, 0x88, 0x00, 0xf5, 0x5c, 0x98, 0x02, 0x05, 0x5f,
+    0x3a, 0x00, 0x01, 0x96, 0x02, 0xfd, 0x5d, 0x03, 0x96, 0x02, 0x8d, 0x5e, 0x20, 0x02, 0x03, 0x5f, 0x90, 0x01, 0x03, 0x5f, 0x03, 0x00, 0x01, 0x03,
+    0x5f, 0x8a, 0x00, 0x8d, 0x5e, 0x8a, 0x00, 0xfd, 0x5d, 0x03, 0x8a, 0x00, 0x6d, 0x5d, 0x00, 0x01, 0xf6, 0x5c, 0x90, 0x01, 0xf6, 0x5c, 0x03, 0x20,
+    0x02, 0xfa, 0x5c, 0x96, 0x02, 0x6d, 0x5d, 0x96, 0x02, 0xfd, 0x5d, 0x04, 0x06, 0x04, 0xc7, 0x80, 0x80, 0x17, 0xff, 0x7a, 0x5a, 0x29, 0x01, 0x86,
+    0x5c, 0x09, 0x00, 0x07, 0x18, 0xff, 0x7b, 0x5a, 0x10, 0x02, 0x0a, 0x02, 0x06, 0x04, 0xc7, 0x80, 0x80, 0x87, 0x00, 0xfd, 0x57, 0x99, 0x02, 0x09,
+    0x5a, 0x09, 0x00, 0x07, 0x88, 0x00, 0xfe, 0x57, 0x10, 0x02, 0x0a, 0x02, 0x06, 0x04, 0xc7, 0x80, 0x80, 0x67, 0x03, 0xfd, 0x57, 0x79, 0x05, 0x09,
+    0x5a, 0x09, 0x00, 0x07, 0x68, 0x03, 0xfe, 0x57, 0x10, 0x02, 0x0a, 0x02, 0x06, 0x06, 0xc7, 0x80, 0x80, 0xf5, 0x00, 0x75, 0x59, 0x0b, 0x05, 0x8b,
+    0x5d, 0x09, 0x00, 0x07, 0xf6, 0x00, 0x76, 0x59, 0x13, 0x04, 0x13, 0x04, 0x06, 0x02, 0xc5, 0x80, 0x80, 0x45, 0x62, 0x05, 0x2c, 0x7b, 0x63, 0x3b,
+    0x2d, 0x09, 0x00, 0x07, 0x46, 0x62, 0x06, 0x2c, 0x33, 0x01, 0x33, 0x01, 0x06, 0x02, 0xc5, 0x80, 0x80, 0xe5, 0x61, 0x65, 0x2d, 0x1b, 0x63, 0x9b,
+    0x2e, 0x09, 0x00, 0x07, 0xe6, 0x61, 0x66, 0x2d, 0x33, 0x01, 0x33, 0x01, 0x06, 0x02, 0xc5, 0x80, 0x80, 0xe5, 0x60, 0x68, 0x2e, 0x1b, 0x62, 0x9e,
+    0x2f, 0x09, 0x00, 0x07, 0xe6, 0x60, 0x6a, 0x2e, 0x33, 0x01, 0x33, 0x01, 0x06, 0x02, 0xc5, 0x80, 0x80, 0x85, 0x5f, 0xc5, 0x2e, 0xbb, 0x60, 0xfb,
+    0x2f, 0x09, 0x00, 0x07, 0x86, 0x5f, 0xc6, 0x2e, 0x33, 0x01, 0x33, 0x01, 0x06, 0x02, 0xc5, 0x80, 0x80, 0x25, 0x5e, 0x68, 0x2e, 0x5b, 0x5f, 0x9e,
+    0x2f, 0x09, 0x00, 0x07, 0x26, 0x5e, 0x6a, 0x2e, 0x33, 0x01, 0x33, 0x01, 0x06, 0x02, 0xc5, 0x7f, 0x80, 0x22, 0x5d, 0x65, 0x2d, 0x58, 0x5e, 0x9b,
+    0x2e, 0x09, 0x00, 0x07, 0x23, 0x5d, 0x66, 0x2d, 0x33, 0x01, 0x33, 0x01, 0x06, 0x02, 0xc5, 0x80, 0x80, 0xc5, 0x5c, 0x05, 0x2c, 0xfb, 0x5d, 0x3b,
+    0x2d, 0x09, 0x00, 0x07, 0xc6, 0x5c, 0x06, 0x2c, 0x33, 0x01, 0x33, 0x01, 0x06, 0x02, 0xc5, 0x7f, 0x80, 0x22, 0x5d, 0xa5, 0x2a, 0x58, 0x5e, 0xdb,
+    0x2b, 0x09, 0x00, 0x07, 0x23, 0x5d, 0xa6, 0x2a, 0x33, 0x01, 0x33, 0x01, 0x06, 0x02, 0xc4, 0x7f, 0x80, 0x25, 0x5e, 0xa2, 0x29, 0x5b, 0x5f, 0xd8,
+    0x2a, 0x3a, 0x00, 0x01, 0x5a, 0x5f, 0x3d, 0x2a, 0x03, 0x5a, 0x5f, 0x90, 0x2a, 0x16, 0x5f, 0xd6, 0x2a, 0xc0, 0x5e, 0xd6, 0x2a, 0x03, 0x6d, 0x5e,
+    0xd6, 0x2a, 0x26, 0x5e, 0x93, 0x2a, 0x26, 0x5e, 0x3d, 0x2a, 0x03, 0x26, 0x5e, 0xea, 0x29, 0x6a, 0x5e, 0xa3, 0x29, 0xc0, 0x5e, 0xa3, 0x29, 0x03,
+    0x13, 0x5f, 0xa6, 0x29, 0x5a, 0x5f, 0xea, 0x29, 0x5a, 0x5f, 0x3d, 0x2a, 0x04, 0x06, 0x02, 0xc5, 0x80, 0x80, 0x85, 0x5f, 0x45, 0x29, 0xbb, 0x60,
+    0x7b, 0x2a, 0x09, 0x00, 0x07, 0x86, 0x5f, 0x46, 0x29, 0x33, 0x01, 0x33, 0x01, 0x06, 0x02, 0xc4, 0x7f, 0x80, 0xe5, 0x60, 0xa2, 0x29, 0x1b, 0x62,
+    0xd8, 0x2a, 0x3a, 0x00, 0x01, 0x1a, 0x62, 0x3d, 0x2a, 0x03, 0x1a, 0x62, 0x90, 0x2a, 0xd6, 0x61, 0xd6, 0x2a, 0x80, 0x61, 0xd6, 0x2a, 0x03, 0x2d,
+    0x61, 0xd6, 0x2a, 0xe6, 0x60, 0x93, 0x2a, 0xe6, 0x60, 0x3d, 0x2a, 0x03, 0xe6, 0x60, 0xea, 0x29, 0x2a, 0x61, 0xa3, 0x29, 0x80, 0x61, 0xa3, 0x29,
+    0x03, 0xd3, 0x61, 0xa6, 0x29, 0x1a, 0x62, 0xea, 0x29, 0x1a, 0x62, 0x3d, 0x2a, 0x04, 0x06, 0x02, 0xc5, 0x80, 0x80, 0xe5, 0x61, 0xa5, 0x2a, 0x1b,
+    0x63, 0xdb, 0x2b, 0x09, 0x00, 0x07, 0xe6, 0x61, 0xa6, 0x2a, 0x33, 0x01, 0x33, 0x01, 0x06, 0x03, 0xc8, 0x80, 0x80, 0xcf, 0x5d, 0x4f, 0x2a, 0x71,
+    0x62, 0xf1, 0x2e, 0x09, 0x00, 0x07, 0xd0, 0x5d, 0x50, 0x2a, 0xa0, 0x04, 0xa0, 0x04, 0x06, 0x03, 0xc7, 0x80, 0x80, 0x43, 0x0d, 0xc7, 0x38, 0x7d,
+    0x10, 0xf9, 0x3b, 0x09, 0x00, 0x07, 0x45, 0x0d, 0xc8, 0x38, 0x36, 0x03, 0x30, 0x03, 0x06, 0x03, 0xc7, 0x80, 0x80, 0x33, 0x0b, 0xa0, 0x3b, 0x6d,
+    0x0e, 0xd3, 0x3e, 0x09, 0x00, 0x07, 0x35, 0x0b, 0xa2, 0x3b, 0x36, 0x03, 0x30, 0x03, 0x06, 0x03, 0xc7, 0x7f, 0x7f, 0xd7, 0x07, 0x8a, 0x3a, 0x10,
+    0x0b, 0xbd, 0x3d, 0x09, 0x00, 0x07, 0xd8, 0x07, 0x8b, 0x3a, 0x36, 0x03, 0x30, 0x03, 0x06, 0x03, 0xc7, 0x7f, 0x80, 0xd7, 0x07, 0x03, 0x37, 0x10,
+    0x0b, 0x36, 0x3a, 0x09, 0x00, 0x07, 0xd8, 0x07, 0x05, 0x37, 0x36, 0x03, 0x30, 0x03, 0x06, 0x03, 0xc7, 0x80, 0x7f, 0x33, 0x0b, 0xed, 0x35, 0x6d,
+    0x0e, 0x20, 0x39, 0x09, 0x00, 0x07, 0x35, 0x0b, 0xee, 0x35, 0x36, 0x03, 0x30, 0x03, 0x06, 0x00, 0xc7, 0x80, 0x80, 0x25, 0x09, 0xa5, 0x37, 0x9b,
+    0x0e, 0x1b, 0x3d, 0x09, 0x00, 0x07, 0x26, 0x09, 0xa6, 0x37, 0x73, 0x05, 0x73, 0x05, 0x06, 0x02, 0xc6, 0x80, 0x80, 0x3f, 0x3b, 0x3f, 0x43, 0xc1,
+    0x3c, 0xc1, 0x44, 0x09, 0x00, 0x07, 0x40, 0x3b, 0x40, 0x43, 0x80, 0x01, 0x80, 0x01, 0x06, 0x02, 0xc6, 0x80, 0x7f, 0x4f, 0x3a, 0x32, 0x45, 0xd1,
+    0x3b, 0xb5, 0x46, 0x09, 0x00, 0x07, 0x50, 0x3a, 0x33, 0x45, 0x80, 0x01, 0x80, 0x01, 0x06, 0x02, 0xc6, 0x80, 0x80, 0x2f, 0x38, 0xaf, 0x45, 0xb1,
+    0x39, 0x31, 0x47, 0x09, 0x00, 0x07, 0x30, 0x38, 0xb0, 0x45, 0x80, 0x01, 0x80, 0x01, 0x06, 0x02, 0xc5, 0x7f, 0x80, 0x7f, 0x36, 0x55, 0x44, 0x01,
+    0x38, 0xd8, 0x45, 0x3a, 0x00, 0x01, 0x00, 0x38, 0x16, 0x45, 0x03, 0x00, 0x38, 0x80, 0x45, 0xaa, 0x37, 0xd6, 0x45, 0x40, 0x37, 0xd6, 0x45, 0x03,
+    0xd6, 0x36, 0xd6, 0x45, 0x80, 0x36, 0x80, 0x45, 0x80, 0x36, 0x16, 0x45, 0x03, 0x80, 0x36, 0xad, 0x44, 0xd6, 0x36, 0x56, 0x44, 0x40, 0x37, 0x56,
+    0x44, 0x03, 0xaa, 0x37, 0x56, 0x44, 0xfd, 0x37, 0xad, 0x44, 0x00, 0x38, 0x16, 0x45, 0x04, 0x06, 0x02, 0xc5, 0x7f, 0x80, 0x7f, 0x36, 0x28, 0x42,
+    0x01, 0x38, 0xab, 0x43, 0x3a, 0x00, 0x01, 0x00, 0x38, 0xea, 0x42, 0x03, 0x00, 0x38, 0x53, 0x43, 0xaa, 0x37, 0xaa, 0x43, 0x40, 0x37, 0xaa, 0x43,
+    0x03, 0xd6, 0x36, 0xaa, 0x43, 0x80, 0x36, 0x53, 0x43, 0x80, 0x36, 0xea, 0x42, 0x03, 0x80, 0x36, 0x80, 0x42, 0xd6, 0x36, 0x2a, 0x42, 0x40, 0x37,
+    0x2a, 0x42, 0x03, 0xaa, 0x37, 0x2a, 0x42, 0xfd, 0x37, 0x80, 0x42, 0x00, 0x38, 0xea, 0x42, 0x04, 0x06, 0x02, 0xc6, 0x80, 0x7f, 0x2f, 0x38, 0xcf,
+    0x40, 0xb1, 0x39, 0x51, 0x42, 0x3a, 0x00, 0x01, 0xb0, 0x39, 0x90, 0x41, 0x03, 0xb0, 0x39, 0xfa, 0x41, 0x5a, 0x39, 0x50, 0x42, 0xf0, 0x38, 0x50,
+    0x42, 0x03, 0x86, 0x38, 0x50, 0x42, 0x30, 0x38, 0xfa, 0x41, 0x30, 0x38, 0x90, 0x41, 0x03, 0x30, 0x38, 0x26, 0x41, 0x86, 0x38, 0xd0, 0x40, 0xf0,
+    0x38, 0xd0, 0x40, 0x03, 0x5d, 0x39, 0xd0, 0x40, 0xb0, 0x39, 0x26, 0x41, 0xb0, 0x39, 0x90, 0x41, 0x04, 0x06, 0x02, 0xc6, 0x80, 0x80, 0x4f, 0x3a,
+    0x4b, 0x41, 0xd1, 0x3b, 0xce, 0x42, 0x09, 0x00, 0x07, 0x50, 0x3a, 0x4d, 0x41, 0x80, 0x01, 0x80, 0x01, 0x06, 0x06, 0xc7, 0x80, 0x80, 0xc5, 0x37,
+    0x45, 0x42, 0x3b, 0x3b, 0xbb, 0x45, 0x09, 0x00, 0x07, 0xc6, 0x37, 0x46, 0x42, 0x73, 0x03, 0x73, 0x03, 0x01, 0x03, 0x60, 0x04, 0x20, 0x32, 0x04,
+    0xea, 0x06, 0x06, 0x00, 0xc3, 0x80, 0x80, 0x95, 0xff, 0x95, 0xff, 0x6b, 0x00, 0x6b, 0x00, 0x09, 0x00, 0x07, 0x96, 0xff, 0x96, 0xff, 0xd3, 0x00,
+    0xd3, 0x00, 0x02, 0x01, 0x03, 0x0d, 0x04, 0x03, 0x33, 0x04, 0xea, 0x06, 0x06, 0x00, 0xc3, 0x80, 0x80, 0x95, 0xff, 0x95, 0xff, 0x6b, 0x00, 0x6b,
+    0x00, 0x09, 0x00, 0x07, 0x96, 0xff, 0x96, 0xff, 0xd3, 0x00, 0xd3, 0x00, 0x02, 0x01, 0x03, 0x3d, 0x03, 0x7a, 0x33, 0x04, 0xea, 0x06, 0x06, 0x00,
+    0xc3, 0x80, 0x80, 0x95, 0xff, 0x95, 0xff, 0x6b, 0x00, 0x6b, 0x00, 0x09, 0x00, 0x07, 0x96, 0xff, 0x96, 0xff, 0xd3, 0x00, 0xd3, 0x00, 0x02, 0x01,
+    0x03, 0x50, 0x02, 0x50, 0x33, 0x04, 0xea, 0x06, 0x06, 0x00, 0xc3, 0x80, 0x80, 0x95, 0xff, 0x95, 0xff, 0x6b, 0x00, 0x6b, 0x00, 0x09, 0x00, 0x07,
+    0x96, 0xff, 0x96, 0xff, 0xd3, 0x00, 0xd3, 0x00, 0x02, 0x01, 0x03, 0xb6, 0x01, 0x9a, 0x32, 0x04, 0xea, 0x06, 0x06, 0x00, 0xc3, 0x80, 0x80, 0x95,
+    0xff, 0x95, 0xff, 0x6b, 0x00, 0x6b, 0x00, 0x09, 0x00, 0x07, 0x96, 0xff, 0x96, 0xff, 0xd3, 0x00, 0xd3, 0x00, 0x02, 0x01, 0x03, 0xb6, 0x01, 0xa6,
+    0x31, 0x04, 0xea, 0x06, 0x06, 0x00, 0xc3, 0x80, 0x80, 0x95, 0xff, 0x95, 0xff, 0x6b, 0x00, 0x6b, 0x00, 0x09, 0x00, 0x07, 0x96, 0xff, 0x96, 0xff,
+    0xd3, 0x00, 0xd3, 0x00, 0x02, 0x01, 0x03, 0x50, 0x02, 0xf0, 0x30, 0x04, 0xea, 0x06, 0x06, 0x00, 0xc3, 0x80, 0x80, 0x95, 0xff, 0x95, 0xff, 0x6b,
+    0x00, 0x6b, 0x00, 0x09, 0x00, 0x07, 0x96, 0xff, 0x96, 0xff, 0xd3, 0x00, 0xd3, 0x00, 0x02, 0x01, 0x03, 0x3d, 0x03, 0xc6, 0x30, 0x04, 0xea, 0x06,
+    0x06, 0x00, 0xc3, 0x80, 0x80, 0x95, 0xff, 0x95, 0xff, 0x6b, 0x00, 0x6b, 0x00, 0x09, 0x00, 0x07, 0x96, 0xff, 0x96, 0xff, 0xd3, 0x00, 0xd3, 0x00,
+    0x02, 0x01, 0x03, 0x0d, 0x04, 0x3d, 0x31, 0x04, 0xea, 0x06, 0x06, 0x00, 0xc3, 0x80, 0x80, 0x95, 0xff, 0x95, 0xff, 0x6b, 0x00, 0x6b, 0x00, 0x09,
+    0x00, 0x07, 0x96, 0xff, 0x96, 0xff, 0xd3, 0x00, 0xd3, 0x00, 0x02, 0x06, 0x03, 0xc6, 0x80, 0x80, 0xc8, 0x01, 0xe8, 0x30, 0x38, 0x04, 0x58, 0x33,
+    0x09, 0x00, 0x07, 0xca, 0x01, 0xea, 0x30, 0x6d, 0x02, 0x6d, 0x02, 0x06, 0x06, 0xc6, 0x7f, 0x80, 0x47, 0x49, 0x47, 0x5b, 0xfd, 0x4a, 0xf9, 0x5c,
+    0x09, 0x00, 0x07, 0x48, 0x49, 0x48, 0x5b, 0xb3, 0x01, 0xb0, 0x01, 0x06, 0x06, 0xc6, 0x7f, 0x80, 0xba, 0x48, 0x57, 0x5d, 0x70, 0x4a, 0x09, 0x5f,
+    0x09, 0x00, 0x07, 0xbb, 0x48, 0x58, 0x5d, 0xb3, 0x01, 0xb0, 0x01, 0x06, 0x06, 0xc4, 0x80, 0x80, 0x35, 0x47, 0xd5, 0x5e, 0xeb, 0x48, 0x8e, 0x60,
+    0x3a, 0x00, 0x01, 0xea, 0x48, 0xb3, 0x5f, 0x03, 0xea, 0x48, 0x2d, 0x60, 0x86, 0x48, 0x8d, 0x60, 0x10, 0x48, 0x8d, 0x60, 0x03, 0x9a, 0x47, 0x8d,
+    0x60, 0x36, 0x47, 0x2a, 0x60, 0x36, 0x47, 0xb3, 0x5f, 0x03, 0x36, 0x47, 0x3d, 0x5f, 0x9a, 0x47, 0xda, 0x5e, 0x10, 0x48, 0xda, 0x5e, 0x03, 0x8a,
+    0x48, 0xd6, 0x5e, 0xea, 0x48, 0x3a, 0x5f, 0xea, 0x48, 0xb3, 0x5f, 0x04, 0x06, 0x06, 0xc6, 0x7f, 0x80, 0x27, 0x45, 0x67, 0x5f, 0xdd, 0x46, 0x19,
+    0x61, 0x09, 0x00, 0x07, 0x28, 0x45, 0x68, 0x5f, 0xb3, 0x01, 0xb0, 0x01, 0x06, 0x06, 0xc4, 0x80, 0x80, 0x15, 0x43, 0xd5, 0x5e, 0xcb, 0x44, 0x8e,
+    0x60, 0x3a, 0x00, 0x01, 0xca, 0x44, 0xb3, 0x5f, 0x03, 0xca, 0x44, 0x2d, 0x60, 0x66, 0x44, 0x8d, 0x60, 0xf0, 0x43, 0x8d, 0x60, 0x03, 0x7a, 0x43,
+    0x8d, 0x60, 0x16, 0x43, 0x2a, 0x60, 0x16, 0x43, 0xb3, 0x5f, 0x03, 0x16, 0x43, 0x3d, 0x5f, 0x7a, 0x43, 0xda, 0x5e, 0xf0, 0x43, 0xda, 0x5e, 0x03,
+    0x6a, 0x44, 0xd6, 0x5e, 0xca, 0x44, 0x3a, 0x5f, 0xca, 0x44, 0xb3, 0x5f, 0x04, 0x06, 0x06, 0xc6, 0x7f, 0x80, 0x97, 0x41, 0x57, 0x5d, 0x4d, 0x43,
+    0x09, 0x5f, 0x09, 0x00, 0x07, 0x98, 0x41, 0x58, 0x5d, 0xb3, 0x01, 0xb0, 0x01, 0x06, 0x06, 0xc6, 0x7f, 0x80, 0x07, 0x41, 0x47, 0x5b, 0xbd, 0x42,
+    0xf9, 0x5c, 0x09, 0x00, 0x07, 0x08, 0x41, 0x48, 0x5b, 0xb3, 0x01, 0xb0, 0x01, 0x06, 0x06, 0xc6, 0x7f, 0x80, 0x97, 0x41, 0x37, 0x59, 0x4d, 0x43,
+    0xe9, 0x5a, 0x09, 0x00, 0x07, 0x98, 0x41, 0x38, 0x59, 0xb3, 0x01, 0xb0, 0x01, 0x06, 0x06, 0xc6, 0x7f, 0x80, 0x17, 0x43, 0xb3, 0x57, 0xcd, 0x44,
+    0x66, 0x59, 0x09, 0x00, 0x07, 0x18, 0x43, 0xb5, 0x57, 0xb3, 0x01, 0xb0, 0x01, 0x06, 0x06, 0xc6, 0x7f, 0x80, 0x27, 0x45, 0x27, 0x57, 0xdd, 0x46,
+    0xd9, 0x58, 0x09, 0x00, 0x07, 0x28, 0x45, 0x28, 0x57, 0xb3, 0x01, 0xb0, 0x01, 0x06, 0x06, 0xc6, 0x7f, 0x80, 0x37, 0x47, 0xb3, 0x57, 0xed, 0x48,
+    0x66, 0x59, 0x09, 0x00, 0x07, 0x38, 0x47, 0xb5, 0x57, 0xb3, 0x01, 0xb0, 0x01, 0x06, 0x06, 0xc6, 0x7f, 0x80, 0xba, 0x48, 0x37, 0x59, 0x70, 0x4a,
+    0xe9, 0x5a, 0x09, 0x00, 0x07, 0xbb, 0x48, 0x38, 0x59, 0xb3, 0x01, 0xb0, 0x01, 0x06, 0x03, 0xc8, 0x80, 0x80, 0xb2, 0x42, 0xd2, 0x58, 0x4e, 0x49,
+    0x6e, 0x5f, 0x09, 0x00, 0x07, 0xb3, 0x42, 0xd3, 0x58, 0x9a, 0x06, 0x9a, 0x06, 0x01, 0x03, 0xc0, 0x12, 0x60, 0x4d, 0x04, 0xe0, 0x06, 0x06, 0x03,
+    0xc3, 0x80, 0x80, 0xaf, 0xff, 0xaf, 0xff, 0x51, 0x00, 0x51, 0x00, 0x09, 0x00, 0x07, 0xb0, 0xff, 0xb0, 0xff, 0xa0, 0x00, 0xa0, 0x00, 0x02, 0x06,
+    0x03, 0xc0, 0x7f, 0x81, 0x35, 0x12, 0xcb, 0x4d, 0xd8, 0x12, 0x6e, 0x4e, 0x3a, 0x00, 0x01, 0xd6, 0x12, 0x1d, 0x4e, 0x03, 0xd6, 0x12, 0x4a, 0x4e,
+    0xb3, 0x12, 0x6d, 0x4e, 0x86, 0x12, 0x6d, 0x4e, 0x03, 0x5a, 0x12, 0x6d, 0x4e, 0x36, 0x12, 0x4a, 0x4e, 0x36, 0x12, 0x1d, 0x4e, 0x03, 0x36, 0x12,
+    0xf0, 0x4d, 0x5a, 0x12, 0xcd, 0x4d, 0x86, 0x12, 0xcd, 0x4d, 0x03, 0xb3, 0x12, 0xd0, 0x4d, 0xd6, 0x12, 0xf3, 0x4d, 0xd6, 0x12, 0x1d, 0x4e, 0x04,
+    0x01, 0x03, 0xf0, 0x11, 0xa0, 0x4e, 0x04, 0xe0, 0x06, 0x06, 0x03, 0xc3, 0x80, 0x80, 0xaf, 0xff, 0xaf, 0xff, 0x51, 0x00, 0x51, 0x00, 0x09, 0x00,
+    0x07, 0xb0, 0xff, 0xb0, 0xff, 0xa0, 0x00, 0xa0, 0x00, 0x02, 0x01, 0x03, 0x2d, 0x11, 0xbd, 0x4e, 0x04, 0xe0, 0x06, 0x06, 0x03, 0xc3, 0x80, 0x80,
+    0xaf, 0xff, 0xaf, 0xff, 0x51, 0x00, 0x51, 0x00, 0x09, 0x00, 0x07, 0xb0, 0xff, 0xb0, 0xff, 0xa0, 0x00, 0xa0, 0x00, 0x02, 0x01, 0x03, 0x7a, 0x10,
+    0x6a, 0x4e, 0x04, 0xe0, 0x06, 0x06, 0x03, 0xc3, 0x80, 0x80, 0xaf, 0xff, 0xaf, 0xff, 0x51, 0x00, 0x51, 0x00, 0x09, 0x00, 0x07, 0xb0, 0xff, 0xb0,
+    0xff, 0xa0, 0x00, 0xa0, 0x00, 0x02, 0x01, 0x03, 0x0d, 0x10, 0xc3, 0x4d, 0x04, 0xe0, 0x06, 0x06, 0x03, 0xc3, 0x80, 0x80, 0xaf, 0xff, 0xaf, 0xff,
+    0x51, 0x00, 0x51, 0x00, 0x09, 0x00, 0x07, 0xb0, 0xff, 0xb0, 0xff, 0xa0, 0x00, 0xa0, 0x00, 0x02, 0x01, 0x03, 0x0d, 0x10, 0xfd, 0x4c, 0x04, 0xe0,
+    0x06, 0x06, 0x03, 0xc3, 0x80, 0x80, 0xaf, 0xff, 0xaf, 0xff, 0x51, 0x00, 0x51, 0x00, 0x09, 0x00, 0x07, 0xb0, 0xff, 0xb0, 0xff, 0xa0, 0x00, 0xa0,
+    0x00, 0x02, 0x01, 0x03, 0x7a, 0x10, 0x56, 0x4c, 0x04, 0xe0, 0x06, 0x06, 0x03, 0xc3, 0x80, 0x80, 0xaf, 0xff, 0xaf, 0xff, 0x51, 0x00, 0x51, 0x00,
+    0x09, 0x00, 0x07, 0xb0, 0xff, 0xb0, 0xff, 0xa0, 0x00, 0xa0, 0x00, 0x02, 0x01, 0x03, 0x2d, 0x11, 0x03, 0x4c, 0x04, 0xe0, 0x06, 0x06, 0x03, 0xc3,
+    0x80, 0x80, 0xaf, 0xff, 0xaf, 0xff, 0x51, 0x00, 0x51, 0x00, 0x09, 0x00, 0x07, 0xb0, 0xff, 0xb0, 0xff, 0xa0, 0x00, 0xa0, 0x00, 0x02, 0x01, 0x03,
+    0xf0, 0x11, 0x20, 0x4c, 0x04, 0xe0, 0x06, 0x06, 0x03, 0xc3, 0x80, 0x80, 0xaf, 0xff, 0xaf, 0xff, 0x51, 0x00, 0x51, 0x00, 0x09, 0x00, 0x07, 0xb0,
+    0xff, 0xb0, 0xff, 0xa0, 0x00, 0xa0, 0x00, 0x02, 0x01, 0x03, 0x86, 0x12, 0xa3, 0x4c, 0x04, 0xe0, 0x06, 0x06, 0x03, 0xc3, 0x80, 0x80, 0xaf, 0xff,
+    0xaf, 0xff, 0x51, 0x00, 0x51, 0x00, 0x09, 0x00, 0x07, 0xb0, 0xff, 0xb0, 0xff, 0xa0, 0x00, 0xa0, 0x00, 0x02, 0x06, 0x06, 0xc6, 0x7f, 0x7f, 0x42,
+    0x10, 0x45, 0x4c, 0x7b, 0x12, 0x78, 0x4e, 0x09, 0x00, 0x07, 0x43, 0x10, 0x46, 0x4c, 0x36, 0x02, 0x30, 0x02, 0x06, 0x03, 0xc1, 0x80, 0x80, 0x1b,
+    0x03, 0x1b, 0x16, 0xe5, 0x03, 0xe5, 0x16, 0x09, 0x00, 0x07, 0x1d, 0x03, 0x1d, 0x16, 0xc6, 0x00, 0xc6, 0x00, 0x06, 0x03, 0xc2, 0x80, 0x80, 0xe5,
+    0x02, 0xeb, 0x16, 0xae, 0x03, 0xb5, 0x17, 0x09, 0x00, 0x07, 0xe6, 0x02, 0xed, 0x16, 0xc6, 0x00, 0xc6, 0x00, 0x06, 0x03, 0xc0, 0x80, 0x81, 0x4b,
+    0x02, 0x82, 0x17, 0x15, 0x03, 0x4e, 0x18, 0x3a, 0x00, 0x01, 0x13, 0x03, 0xea, 0x17, 0x03, 0x13, 0x03, 0x20, 0x18, 0xe6, 0x02, 0x4d, 0x18, 0xb0,
+    0x02, 0x4d, 0x18, 0x03, 0x7a, 0x02, 0x4d, 0x18, 0x4d, 0x02, 0x20, 0x18, 0x4d, 0x02, 0xea, 0x17, 0x03, 0x4d, 0x02, 0xb3, 0x17, 0x7a, 0x02, 0x86,
+    0x17, 0xb0, 0x02, 0x86, 0x17, 0x03, 0xe6, 0x02, 0x83, 0x17, 0x13, 0x03, 0xb0, 0x17, 0x13, 0x03, 0xea, 0x17, 0x04, 0x06, 0x03, 0xc1, 0x80, 0x80,
+    0x7b, 0x01, 0xbb, 0x17, 0x45, 0x02, 0x85, 0x18, 0x09, 0x00, 0x07, 0x7d, 0x01, 0xbd, 0x17, 0xc6, 0x00, 0xc6, 0x00, 0x06, 0x03, 0xc0, 0x80, 0x81,
+    0xab, 0x00, 0x82, 0x17, 0x75, 0x01, 0x4e, 0x18, 0x3a, 0x00, 0x01, 0x73, 0x01, 0xea, 0x17, 0x03, 0x73, 0x01, 0x20, 0x18, 0x46, 0x01, 0x4d, 0x18,
+    0x10, 0x01, 0x4d, 0x18, 0x03, 0xda, 0x00, 0x4d, 0x18, 0xad, 0x00, 0x20, 0x18, 0xad, 0x00, 0xea, 0x17, 0x03, 0xad, 0x00, 0xb3, 0x17, 0xda, 0x00,
+    0x86, 0x17, 0x10, 0x01, 0x86, 0x17, 0x03, 0x46, 0x01, 0x83, 0x17, 0x73, 0x01, 0xb0, 0x17, 0x73, 0x01, 0xea, 0x17, 0x04, 0x06, 0x03, 0xc2, 0x80,
+    0x80, 0x15, 0x00, 0xeb, 0x16, 0xde, 0x00, 0xb5, 0x17, 0x09, 0x00, 0x07, 0x16, 0x00, 0xed, 0x16, 0xc6, 0x00, 0xc6, 0x00, 0x06, 0x03, 0xc1, 0x80,
+    0x80, 0xdb, 0xff, 0x1b, 0x16, 0xa5, 0x00, 0xe5, 0x16, 0x09, 0x00, 0x07, 0xdd, 0xff, 0x1d, 0x16, 0xc6, 0x00, 0xc6, 0x00, 0x06, 0x03, 0xc2, 0x80,
+    0x80, 0x15, 0x00, 0x4b, 0x15, 0xde, 0x00, 0x15, 0x16, 0x09, 0x00, 0x07, 0x16, 0x00, 0x4d, 0x15, 0xc6, 0x00, 0xc6, 0x00, 0x06, 0x03, 0xc2, 0x80,
+    0x7f, 0xab, 0x00, 0xb2, 0x14, 0x75, 0x01, 0x7b, 0x15, 0x09, 0x00, 0x07, 0xad, 0x00, 0xb3, 0x14, 0xc6, 0x00, 0xc6, 0x00, 0x06, 0x03, 0xc1, 0x80,
+    0x80, 0x7b, 0x01, 0x7b, 0x14, 0x45, 0x02, 0x45, 0x15, 0x09, 0x00, 0x07, 0x7d, 0x01, 0x7d, 0x14, 0xc6, 0x00, 0xc6, 0x00, 0x06, 0x03, 0xc2, 0x80,
+    0x7f, 0x4b, 0x02, 0xb2, 0x14, 0x15, 0x03, 0x7b, 0x15, 0x09, 0x00, 0x07, 0x4d, 0x02, 0xb3, 0x14, 0xc6, 0x00, 0xc6, 0x00, 0x06, 0x03, 0xc2, 0x80,
+    0x80, 0xe5, 0x02, 0x4b, 0x15, 0xae, 0x03, 0x15, 0x16, 0x09, 0x00, 0x07, 0xe6, 0x02, 0x4d, 0x15, 0xc6, 0x00, 0xc6, 0x00, 0x06, 0x06, 0xc6, 0x80,
+    0x80, 0x5b, 0x00, 0xfb, 0x14, 0x65, 0x03, 0x05, 0x18, 0x09, 0x00, 0x07, 0x5d, 0x00, 0xfd, 0x14, 0x06, 0x03, 0x06, 0x03, 0x06, 0x03, 0xc6, 0x80,
+    0x80, 0xcf, 0x47, 0x8f, 0x2d, 0x31, 0x49, 0xf1, 0x2e, 0x09, 0x00, 0x07, 0xd0, 0x47, 0x90, 0x2d, 0x60, 0x01, 0x60, 0x01, 0x06, 0x03, 0xc5, 0x80,
+    0x80, 0x4f, 0x47, 0xeb, 0x2e, 0xb1, 0x48, 0x4e, 0x30, 0x09, 0x00, 0x07, 0x50, 0x47, 0xed, 0x2e, 0x60, 0x01, 0x60, 0x01, 0x06, 0x03, 0xc5, 0x80,
+    0x7f, 0x0f, 0x46, 0xa5, 0x2f, 0x71, 0x47, 0x08, 0x31, 0x09, 0x00, 0x07, 0x10, 0x46, 0xa6, 0x2f, 0x60, 0x01, 0x60, 0x01, 0x06, 0x03, 0xc5, 0x80,
+    0x7f, 0x9f, 0x44, 0x65, 0x2f, 0x01, 0x46, 0xc8, 0x30, 0x09, 0x00, 0x07, 0xa0, 0x44, 0x66, 0x2f, 0x60, 0x01, 0x60, 0x01, 0x06, 0x03, 0xc5, 0x80,
+    0x80, 0xaf, 0x43, 0x48, 0x2e, 0x11, 0x45, 0xab, 0x2f, 0x09, 0x00, 0x07, 0xb0, 0x43, 0x4a, 0x2e, 0x60, 0x01, 0x60, 0x01, 0x06, 0x03, 0xc5, 0x80,
+    0x7f, 0xaf, 0x43, 0xd5, 0x2c, 0x11, 0x45, 0x38, 0x2e, 0x09, 0x00, 0x07, 0xb0, 0x43, 0xd6, 0x2c, 0x60, 0x01, 0x60, 0x01, 0x06, 0x03, 0xc5, 0x80,
+    0x80, 0x9f, 0x44, 0xb8, 0x2b, 0x01, 0x46, 0x1b, 0x2d, 0x09, 0x00, 0x07, 0xa0, 0x44, 0xba, 0x2b, 0x60, 0x01, 0x60, 0x01, 0x06, 0x03, 0xc4, 0x80,
+    0x81, 0x0f, 0x46, 0x75, 0x2b, 0x71, 0x47, 0xdb, 0x2c, 0x3a, 0x00, 0x01, 0x70, 0x47, 0x2a, 0x2c, 0x03, 0x70, 0x47, 0x8d, 0x2c, 0x20, 0x47, 0xda,
+    0x2c, 0xc0, 0x46, 0xda, 0x2c, 0x03, 0x5d, 0x46, 0xda, 0x2c, 0x10, 0x46, 0x8a, 0x2c, 0x10, 0x46, 0x2a, 0x2c, 0x03, 0x10, 0x46, 0xca, 0x2b, 0x60,
+    0x46, 0x7a, 0x2b, 0xc0, 0x46, 0x7a, 0x2b, 0x03, 0x20, 0x47, 0x76, 0x2b, 0x70, 0x47, 0xc6, 0x2b, 0x70, 0x47, 0x2a, 0x2c, 0x04, 0x06, 0x03, 0xc4,
+    0x80, 0x80, 0x4f, 0x47, 0x2f, 0x2c, 0xb1, 0x48, 0x95, 0x2d, 0x3a, 0x00, 0x01, 0xb0, 0x48, 0xe3, 0x2c, 0x03, 0xb0, 0x48, 0x46, 0x2d, 0x60, 0x48,
+    0x93, 0x2d, 0x00, 0x48, 0x93, 0x2d, 0x03, 0x9d, 0x47, 0x93, 0x2d, 0x50, 0x47, 0x43, 0x2d, 0x50, 0x47, 0xe3, 0x2c, 0x03, 0x50, 0x47, 0x83, 0x2c,
+    0xa0, 0x47, 0x33, 0x2c, 0x00, 0x48, 0x33, 0x2c, 0x03, 0x63, 0x48, 0x30, 0x2c, 0xb0, 0x48, 0x80, 0x2c, 0xb0, 0x48, 0xe3, 0x2c, 0x04, 0x06, 0x06,
+    0xc7, 0x80, 0x80, 0x5b, 0x44, 0x3b, 0x2c, 0x68, 0x48, 0x48, 0x30, 0x09, 0x00, 0x07, 0x5d, 0x44, 0x3d, 0x2c, 0x0a, 0x04, 0x0a, 0x04, 0x06, 0x00,
+    0xc6, 0x80, 0x80, 0x2b, 0x22, 0x0b, 0x20, 0x55, 0x24, 0x35, 0x22, 0x09, 0x00, 0x07, 0x2d, 0x22, 0x0d, 0x20, 0x26, 0x02, 0x26, 0x02, 0x06, 0x00,
+    0xc6, 0x80, 0x7f, 0x95, 0x21, 0x12, 0x22, 0xbe, 0x23, 0x3b, 0x24, 0x09, 0x00, 0x07, 0x96, 0x21, 0x13, 0x22, 0x26, 0x02, 0x26, 0x02, 0x06, 0x00,
+    0xc6, 0x80, 0x80, 0xfb, 0x1f, 0x75, 0x23, 0x25, 0x22, 0x9e, 0x25, 0x09, 0x00, 0x07, 0xfd, 0x1f, 0x76, 0x23, 0x26, 0x02, 0x26, 0x02, 0x06, 0x00,
+    0xc6, 0x7f, 0x80, 0xe5, 0x1d, 0xc2, 0x23, 0x0e, 0x20, 0xeb, 0x25, 0x3a, 0x00, 0x01, 0x0d, 0x20, 0xd6, 0x24, 0x03, 0x0d, 0x20, 0x70, 0x25, 0x93,
+    0x1f, 0xea, 0x25, 0xfa, 0x1e, 0xea, 0x25, 0x03, 0x60, 0x1e, 0xea, 0x25, 0xe6, 0x1d, 0x70, 0x25, 0xe6, 0x1d, 0xd6, 0x24, 0x03, 0xe6, 0x1d, 0x3d,
+    0x24, 0x60, 0x1e, 0xc3, 0x23, 0xfa, 0x1e, 0xc3, 0x23, 0x03, 0x90, 0x1f, 0xc3, 0x23, 0x0a, 0x20, 0x3d, 0x24, 0x0d, 0x20, 0xd6, 0x24, 0x04, 0x06,
+    0x00, 0xc5, 0x80, 0x80, 0xf8, 0x1b, 0xdf, 0x22, 0x21, 0x1e, 0x0b, 0x25, 0x3a, 0x00, 0x01, 0x20, 0x1e, 0xf6, 0x23, 0x03, 0x20, 0x1e, 0x90, 0x24,
+    0xa3, 0x1d, 0x0a, 0x25, 0x0d, 0x1d, 0x0a, 0x25, 0x03, 0x73, 0x1c, 0x0a, 0x25, 0xfa, 0x1b, 0x8d, 0x24, 0xfa, 0x1b, 0xf6, 0x23, 0x03, 0xfa, 0x1b,
+    0x60, 0x23, 0x76, 0x1c, 0xe3, 0x22, 0x0d, 0x1d, 0xe3, 0x22, 0x03, 0xa3, 0x1d, 0xe0, 0x22, 0x20, 0x1e, 0x5d, 0x23, 0x20, 0x1e, 0xf6, 0x23, 0x04,
+    0x06, 0x00, 0xc5, 0x80, 0x80, 0xd2, 0x1a, 0x18, 0x21, 0xfb, 0x1c, 0x45, 0x23, 0x3a, 0x00, 0x01, 0xfa, 0x1c, 0x30, 0x22, 0x03, 0xfa, 0x1c, 0xca,
+    0x22, 0x7d, 0x1c, 0x43, 0x23, 0xe6, 0x1b, 0x43, 0x23, 0x03, 0x4d, 0x1b, 0x43, 0x23, 0xd3, 0x1a, 0xc6, 0x22, 0xd3, 0x1a, 0x30, 0x22, 0x03, 0xd3,
+    0x1a, 0x96, 0x21, 0x50, 0x1b, 0x1d, 0x21, 0xe6, 0x1b, 0x1d, 0x21, 0x03, 0x80, 0x1c, 0x1a, 0x21, 0xfa, 0x1c, 0x96, 0x21, 0xfa, 0x1c, 0x30, 0x22,
+    0x04, 0x06, 0x00, 0xc6, 0x7f, 0x80, 0xd2, 0x1a, 0xfb, 0x1e, 0xfb, 0x1c, 0x25, 0x21, 0x09, 0x00, 0x07, 0xd3, 0x1a, 0xfd, 0x1e, 0x26, 0x02, 0x26,
+    0x02, 0x06, 0x00, 0xc6, 0x80, 0x80, 0xf8, 0x1b, 0x35, 0x1d, 0x21, 0x1e, 0x5e, 0x1f, 0x09, 0x00, 0x07, 0xfa, 0x1b, 0x36, 0x1d, 0x26, 0x02, 0x26,
+    0x02, 0x06, 0x00, 0xc6, 0x7f, 0x80, 0xe5, 0x1d, 0x55, 0x1c, 0x0e, 0x20, 0x7e, 0x1e, 0x3a, 0x00, 0x01, 0x0d, 0x20, 0x6a, 0x1d, 0x03, 0x0d, 0x20,
+    0x03, 0x1e, 0x93, 0x1f, 0x7d, 0x1e, 0xfa, 0x1e, 0x7d, 0x1e, 0x03, 0x60, 0x1e, 0x7d, 0x1e, 0xe6, 0x1d, 0x03, 0x1e, 0xe6, 0x1d, 0x6a, 0x1d, 0x03,
+    0xe6, 0x1d, 0xd0, 0x1c, 0x60, 0x1e, 0x56, 0x1c, 0xfa, 0x1e, 0x56, 0x1c, 0x03, 0x90, 0x1f, 0x56, 0x1c, 0x0a, 0x20, 0xd0, 0x1c, 0x0d, 0x20, 0x6a,
+    0x1d, 0x04, 0x06, 0x00, 0xc6, 0x80, 0x7f, 0xfb, 0x1f, 0xa2, 0x1c, 0x25, 0x22, 0xcb, 0x1e, 0x09, 0x00, 0x07, 0xfd, 0x1f, 0xa3, 0x1c, 0x26, 0x02,
+    0x26, 0x02, 0x06, 0x00, 0xc6, 0x80, 0x80, 0x95, 0x21, 0x05, 0x1e, 0xbe, 0x23, 0x2e, 0x20, 0x09, 0x00, 0x07, 0x96, 0x21, 0x06, 0x1e, 0x26, 0x02,
+    0x26, 0x02, 0x06, 0x03, 0xc8, 0x80, 0x80, 0xab, 0x1b, 0x4b, 0x1d, 0x55, 0x23, 0xf5, 0x24, 0x09, 0x00, 0x07, 0xad, 0x1b, 0x4d, 0x1d, 0xa6, 0x07,
+    0xa6, 0x07, 0x06, 0x04, 0xc7, 0x80, 0x80, 0x2f, 0x61, 0x2f, 0x07, 0x51, 0x63, 0x51, 0x09, 0x09, 0x00, 0x07, 0x30, 0x61, 0x30, 0x07, 0x20, 0x02,
+    0x20, 0x02, 0x06, 0x04, 0xc6, 0x7f, 0x7f, 0x15, 0x60, 0xd5, 0x09, 0x38, 0x62, 0xf8, 0x0b, 0x09, 0x00, 0x07, 0x16, 0x60, 0xd6, 0x09, 0x20, 0x02,
+    0x20, 0x02, 0x06, 0x04, 0xc7, 0x80, 0x80, 0x6f, 0x5d, 0xef, 0x0a, 0x91, 0x5f, 0x11, 0x0d, 0x09, 0x00, 0x07, 0x70, 0x5d, 0xf0, 0x0a, 0x20, 0x02,
+    0x20, 0x02, 0x06, 0x04, 0xc6, 0x80, 0x7f, 0xc8, 0x5a, 0xd5, 0x09, 0xeb, 0x5c, 0xf8, 0x0b, 0x09, 0x00, 0x07, 0xca, 0x5a, 0xd6, 0x09, 0x20, 0x02,
+    0x20, 0x02, 0x06, 0x04, 0xc7, 0x80, 0x80, 0xaf, 0x59, 0x2f, 0x07, 0xd1, 0x5b, 0x51, 0x09, 0x09, 0x00, 0x07, 0xb0, 0x59, 0x30, 0x07, 0x20, 0x02,
+    0x20, 0x02, 0x06, 0x04, 0xc6, 0x80, 0x80, 0xc8, 0x5a, 0x88, 0x04, 0xeb, 0x5c, 0xab, 0x06, 0x09, 0x00, 0x07, 0xca, 0x5a, 0x8a, 0x04, 0x20, 0x02,
+    0x20, 0x02, 0x06, 0x04, 0xc7, 0x80, 0x80, 0x6f, 0x5d, 0x6f, 0x03, 0x91, 0x5f, 0x91, 0x05, 0x09, 0x00, 0x07, 0x70, 0x5d, 0x70, 0x03, 0x20, 0x02,
+    0x20, 0x02, 0x06, 0x04, 0xc6, 0x7f, 0x80, 0x15, 0x60, 0x88, 0x04, 0x38, 0x62, 0xab, 0x06, 0x09, 0x00, 0x07, 0x16, 0x60, 0x8a, 0x04, 0x20, 0x02,
+    0x20, 0x02, 0x06, 0x00, 0xc7, 0x80, 0x80, 0xb8, 0x5b, 0x78, 0x05, 0x48, 0x61, 0x08, 0x0b, 0x09, 0x00, 0x07, 0xba, 0x5b, 0x7a, 0x05, 0x8d, 0x05,
+    0x8d, 0x05, 0x06, 0x03, 0xc7, 0x80, 0x80, 0x0f, 0x31, 0x6f, 0x2a, 0xb1, 0x34, 0x11, 0x2e, 0x09, 0x00, 0x07, 0x10, 0x31, 0x70, 0x2a, 0xa0, 0x03,
+    0xa0, 0x03, 0x06, 0x03, 0xc7, 0x80, 0x80, 0xdf, 0x2e, 0x38, 0x2e, 0x81, 0x32, 0xdb, 0x31, 0x09, 0x00, 0x07, 0xe0, 0x2e, 0x3a, 0x2e, 0xa0, 0x03,
+    0xa0, 0x03, 0x06, 0x03, 0xc7, 0x80, 0x80, 0x7f, 0x2a, 0x38, 0x2e, 0x21, 0x2e, 0xdb, 0x31, 0x09, 0x00, 0x07, 0x80, 0x2a, 0x3a, 0x2e, 0xa0, 0x03,
+    0xa0, 0x03, 0x06, 0x03, 0xc7, 0x80, 0x80, 0x4f, 0x28, 0x6f, 0x2a, 0xf1, 0x2b, 0x11, 0x2e, 0x09, 0x00, 0x07, 0x50, 0x28, 0x70, 0x2a, 0xa0, 0x03,
+    0xa0, 0x03, 0x06, 0x03, 0xc7, 0x80, 0x7f, 0x7f, 0x2a, 0xa5, 0x26, 0x21, 0x2e, 0x48, 0x2a, 0x09, 0x00, 0x07, 0x80, 0x2a, 0xa6, 0x26, 0xa0, 0x03,
+    0xa0, 0x03, 0x06, 0x03, 0xc7, 0x80, 0x7f, 0xdf, 0x2e, 0xa5, 0x26, 0x81, 0x32, 0x48, 0x2a, 0x09, 0x00, 0x07, 0xe0, 0x2e, 0xa6, 0x26, 0xa0, 0x03,
+    0xa0, 0x03, 0x06, 0x02, 0xc8, 0x80, 0x80, 0xdb, 0x2a, 0x9b, 0x28, 0x21, 0x32, 0xe1, 0x2f, 0x09, 0x00, 0x07, 0xdd, 0x2a, 0x9d, 0x28, 0x43, 0x07,
+    0x43, 0x07, 0x06, 0x03, 0xc6, 0x80, 0x80, 0x8f, 0x59, 0x6f, 0x1a, 0xb1, 0x5a, 0x91, 0x1b, 0x09, 0x00, 0x07, 0x90, 0x59, 0x70, 0x1a, 0x20, 0x01,
+    0x20, 0x01, 0x06, 0x03, 0xc5, 0x7f, 0x80, 0x35, 0x59, 0xbf, 0x1b, 0x58, 0x5a, 0xe1, 0x1c, 0x09, 0x00, 0x07, 0x36, 0x59, 0xc0, 0x1b, 0x20, 0x01,
+    0x20, 0x01, 0x06, 0x03, 0xc5, 0x80, 0x7f, 0x3f, 0x58, 0xb5, 0x1c, 0x61, 0x59, 0xd8, 0x1d, 0x09, 0x00, 0x07, 0x40, 0x58, 0xb6, 0x1c, 0x20, 0x01,
+    0x20, 0x01, 0x06, 0x03, 0xc6, 0x80, 0x80, 0xef, 0x56, 0x0f, 0x1d, 0x11, 0x58, 0x31, 0x1e, 0x09, 0x00, 0x07, 0xf0, 0x56, 0x10, 0x1d, 0x20, 0x01,
+    0x20, 0x01, 0x06, 0x03, 0xc5, 0x80, 0x7f, 0x9f, 0x55, 0xb5, 0x1c, 0xc1, 0x56, 0xd8, 0x1d, 0x09, 0x00, 0x07, 0xa0, 0x55, 0xb6, 0x1c, 0x20, 0x01,
+    0x20, 0x01, 0x06, 0x03, 0xc5, 0x80, 0x80, 0xa8, 0x54, 0xbf, 0x1b, 0xcb, 0x55, 0xe1, 0x1c, 0x09, 0x00, 0x07, 0xaa, 0x54, 0xc0, 0x1b, 0x20, 0x01,
+    0x20, 0x01, 0x06, 0x03, 0xc6, 0x80, 0x80, 0x4f, 0x54, 0x6f, 0x1a, 0x71, 0x55, 0x91, 0x1b, 0x09, 0x00, 0x07, 0x50, 0x54, 0x70, 0x1a, 0x20, 0x01,
+    0x20, 0x01, 0x06, 0x03, 0xc5, 0x80, 0x80, 0xa8, 0x54, 0x1f, 0x19, 0xcb, 0x55, 0x41, 0x1a, 0x09, 0x00, 0x07, 0xaa, 0x54, 0x20, 0x19, 0x20, 0x01,
+    0x20, 0x01, 0x06, 0x03, 0xc5, 0x80, 0x80, 0x9f, 0x55, 0x28, 0x18, 0xc1, 0x56, 0x4b, 0x19, 0x09, 0x00, 0x07, 0xa0, 0x55, 0x2a, 0x18, 0x20, 0x01,
+    0x20, 0x01, 0x06, 0x03, 0xc6, 0x80, 0x80, 0xef, 0x56, 0xcf, 0x17, 0x11, 0x58, 0xf1, 0x18, 0x09, 0x00, 0x07, 0xf0, 0x56, 0xd0, 0x17, 0x20, 0x01,
+    0x20, 0x01, 0x06, 0x03, 0xc5, 0x80, 0x80, 0x3f, 0x58, 0x28, 0x18, 0x61, 0x59, 0x4b, 0x19, 0x09, 0x00, 0x07, 0x40, 0x58, 0x2a, 0x18, 0x20, 0x01,
+    0x20, 0x01, 0x06, 0x03, 0xc5, 0x7f, 0x80, 0x35, 0x59, 0x1f, 0x19, 0x58, 0x5a, 0x41, 0x1a, 0x09, 0x00, 0x07, 0x36, 0x59, 0x20, 0x19, 0x20, 0x01,
+    0x20, 0x01, 0x06, 0x00, 0xc7, 0x80, 0x7f, 0x52, 0x55, 0xd2, 0x18, 0xae, 0x59, 0x2e, 0x1d, 0x09, 0x00, 0x07, 0x53, 0x55, 0xd3, 0x18, 0x5a, 0x04,
+    0x5a, 0x04, 0x06, 0x04, 0xc5, 0x7f, 0x80, 0xe5, 0x47, 0x68, 0x46, 0x58, 0x49, 0xd8, 0x47, 0x09, 0x00, 0x07, 0xe6, 0x47, 0x6a, 0x46, 0x70, 0x01,
+    0x6d, 0x01, 0x06, 0x04, 0xc4, 0x7f, 0x80, 0x48, 0x47, 0xe8, 0x47, 0xb8, 0x48, 0x58, 0x49, 0x3a, 0x00, 0x01, 0xb6, 0x48, 0xa0, 0x48, 0x03, 0xb6,
+    0x48, 0x03, 0x49, 0x66, 0x48, 0x56, 0x49, 0x00, 0x48, 0x56, 0x49, 0x03, 0x9a, 0x47, 0x56, 0x49, 0x4a, 0x47, 0x06, 0x49, 0x4a, 0x47, 0xa0, 0x48,
+    0x03, 0x4a, 0x47, 0x3a, 0x48, 0x9a, 0x47, 0xea, 0x47, 0x00, 0x48, 0xea, 0x47, 0x03, 0x63, 0x48, 0xed, 0x47, 0xb6, 0x48, 0x3d, 0x48, 0xb6, 0x48,
+    0xa0, 0x48, 0x04, 0x06, 0x04, 0xc5, 0x7f, 0x80, 0xc5, 0x45, 0x88, 0x48, 0x38, 0x47, 0xf8, 0x49, 0x09, 0x00, 0x07, 0xc6, 0x45, 0x8a, 0x48, 0x70,
+    0x01, 0x6d, 0x01, 0x06, 0x04, 0xc5, 0x7f, 0x80, 0x45, 0x44, 0xe8, 0x47, 0xb5, 0x45, 0x58, 0x49, 0x3a, 0x00, 0x01, 0xb3, 0x45, 0xa0, 0x48, 0x03,
+    0xb3, 0x45, 0x03, 0x49, 0x63, 0x45, 0x56, 0x49, 0xfd, 0x44, 0x56, 0x49, 0x03, 0x96, 0x44, 0x56, 0x49, 0x46, 0x44, 0x06, 0x49, 0x46, 0x44, 0xa0,
+    0x48, 0x03, 0x46, 0x44, 0x3a, 0x48, 0x96, 0x44, 0xea, 0x47, 0xfd, 0x44, 0xea, 0x47, 0x03, 0x63, 0x45, 0xed, 0x47, 0xb3, 0x45, 0x3d, 0x48, 0xb3,
+    0x45, 0xa0, 0x48, 0x04, 0x06, 0x04, 0xc5, 0x7f, 0x80, 0xa5, 0x43, 0x68, 0x46, 0x18, 0x45, 0xd8, 0x47, 0x09, 0x00, 0x07, 0xa6, 0x43, 0x6a, 0x46,
+    0x70, 0x01, 0x6d, 0x01, 0x06, 0x04, 0xc5, 0x7f, 0x80, 0x42, 0x44, 0xe8, 0x44, 0xb5, 0x45, 0x58, 0x46, 0x09, 0x00, 0x07, 0x43, 0x44, 0xea, 0x44,
+    0x70, 0x01, 0x6d, 0x01, 0x06, 0x04, 0xc5, 0x7f, 0x80, 0xc5, 0x45, 0x48, 0x44, 0x38, 0x47, 0xb8, 0x45, 0x09, 0x00, 0x07, 0xc6, 0x45, 0x4a, 0x44,
+    0x70, 0x01, 0x6d, 0x01, 0x06, 0x04, 0xc5, 0x7f, 0x80, 0x45, 0x47, 0xe8, 0x44, 0xb8, 0x48, 0x58, 0x46, 0x09, 0x00, 0x07, 0x46, 0x47, 0xea, 0x44,
+    0x70, 0x01, 0x6d, 0x01, 0x06, 0x02, 0xc7, 0x80, 0x80, 0xa5, 0x44, 0x45, 0x45, 0x5b, 0x48, 0xfb, 0x48, 0x09, 0x00, 0x07, 0xa6, 0x44, 0x46, 0x45,
+    0xb3, 0x03, 0xb3, 0x03, 0x06, 0x00, 0xc6, 0x7f, 0x80, 0x55, 0x5f, 0x75, 0x52, 0x28, 0x62, 0x48, 0x55, 0x3a, 0x00, 0x01, 0x26, 0x62, 0xe0, 0x53,
+    0x03, 0x26, 0x62, 0xa6, 0x54, 0x86, 0x61, 0x46, 0x55, 0xbd, 0x60, 0x46, 0x55, 0x03, 0xf6, 0x5f, 0x46, 0x55, 0x56, 0x5f, 0xa6, 0x54, 0x56, 0x5f,
+    0xdd, 0x53, 0x03, 0x56, 0x5f, 0x16, 0x53, 0xf6, 0x5f, 0x76, 0x52, 0xc0, 0x60, 0x76, 0x52, 0x03, 0x86, 0x61, 0x7a, 0x52, 0x26, 0x62, 0x1a, 0x53,
+    0x26, 0x62, 0xe0, 0x53, 0x04, 0x06, 0x00, 0xc7, 0x7f, 0x80, 0x32, 0x5e, 0xcf, 0x54, 0x08, 0x61, 0xa1, 0x57, 0x09, 0x00, 0x07, 0x33, 0x5e, 0xd0,
+    0x54, 0xd3, 0x02, 0xd0, 0x02, 0x06, 0x00, 0xc7, 0x80, 0x80, 0xa8, 0x5b, 0x62, 0x55, 0x7e, 0x5e, 0x31, 0x58, 0x09, 0x00, 0x07, 0xaa, 0x5b, 0x63,
+    0x55, 0xd3, 0x02, 0xcd, 0x02, 0x06, 0x00, 0xc6, 0x7f, 0x80, 0xa2, 0x59, 0xc2, 0x53, 0x75, 0x5c, 0x95, 0x56, 0x3a, 0x00, 0x01, 0x73, 0x5c, 0x2d,
+    0x55, 0x03, 0x73, 0x5c, 0xf3, 0x55, 0xd3, 0x5b, 0x93, 0x56, 0x0a, 0x5b, 0x93, 0x56, 0x03, 0x43, 0x5a, 0x93, 0x56, 0xa3, 0x59, 0xf3, 0x55, 0xa3,
+    0x59, 0x2a, 0x55, 0x03, 0xa3, 0x59, 0x63, 0x54, 0x43, 0x5a, 0xc3, 0x53, 0x0d, 0x5b, 0xc3, 0x53, 0x03, 0xd3, 0x5b, 0xc6, 0x53, 0x73, 0x5c, 0x66,
+    0x54, 0x73, 0x5c, 0x2d, 0x55, 0x04, 0x06, 0x00, 0xc7, 0x7f, 0x80, 0x9f, 0x59, 0x28, 0x51, 0x75, 0x5c, 0xf8, 0x53, 0x09, 0x00, 0x07, 0xa0, 0x59,
+    0x2a, 0x51, 0xd3, 0x02, 0xcd, 0x02, 0x06, 0x00, 0xc7, 0x7f, 0x80, 0xab, 0x5b, 0x88, 0x4f, 0x7e, 0x5e, 0x5b, 0x52, 0x3a, 0x00, 0x01, 0x7d, 0x5e,
+    0xf3, 0x50, 0x03, 0x7d, 0x5e, 0xba, 0x51, 0xdd, 0x5d, 0x5a, 0x52, 0x13, 0x5d, 0x5a, 0x52, 0x03, 0x4d, 0x5c, 0x5a, 0x52, 0xad, 0x5b, 0xba, 0x51,
+    0xad, 0x5b, 0xf0, 0x50, 0x03, 0xad, 0x5b, 0x26, 0x50, 0x4d, 0x5c, 0x8a, 0x4f, 0x16, 0x5d, 0x8a, 0x4f, 0x03, 0xdd, 0x5d, 0x8d, 0x4f, 0x7d, 0x5e,
+    0x2d, 0x50, 0x7d, 0x5e, 0xf3, 0x50, 0x04, 0x06, 0x00, 0xc6, 0x7f, 0x80, 0x35, 0x5e, 0x1b, 0x50, 0x08, 0x61, 0xee, 0x52, 0x3a, 0x00, 0x01, 0x06,
+    0x61, 0x86, 0x51, 0x03, 0x06, 0x61, 0x4d, 0x52, 0x66, 0x60, 0xed, 0x52, 0x9d, 0x5f, 0xed, 0x52, 0x03, 0xd6, 0x5e, 0xed, 0x52, 0x36, 0x5e, 0x4d,
+    0x52, 0x36, 0x5e, 0x83, 0x51, 0x03, 0x36, 0x5e, 0xbd, 0x50, 0xd6, 0x5e, 0x1d, 0x50, 0xa0, 0x5f, 0x1d, 0x50, 0x03, 0x66, 0x60, 0x20, 0x50, 0x06,
+    0x61, 0xc0, 0x50, 0x06, 0x61, 0x86, 0x51, 0x04, 0x06, 0x02, 0xc8, 0x80, 0x80, 0x82, 0x5a, 0xa2, 0x50, 0xfe, 0x60, 0x1e, 0x57, 0x09, 0x00, 0x07,
+    0x83, 0x5a, 0xa3, 0x50, 0x7a, 0x06, 0x7a, 0x06, 0x06, 0x03, 0xc6, 0x80, 0x80, 0xab, 0x35, 0x6b, 0x51, 0x55, 0x38, 0x15, 0x54, 0x09, 0x00, 0x07,
+    0xad, 0x35, 0x6d, 0x51, 0xa6, 0x02, 0xa6, 0x02, 0x06, 0x03, 0xc6, 0x7f, 0x80, 0xab, 0x33, 0xe2, 0x54, 0x55, 0x36, 0x8b, 0x57, 0x3a, 0x00, 0x01,
+    0x53, 0x36, 0x36, 0x56, 0x03, 0x53, 0x36, 0xf0, 0x56, 0xbd, 0x35, 0x8a, 0x57, 0x00, 0x35, 0x8a, 0x57, 0x03, 0x46, 0x34, 0x8a, 0x57, 0xad, 0x33,
+    0xf3, 0x56, 0xad, 0x33, 0x36, 0x56, 0x03, 0xad, 0x33, 0x7d, 0x55, 0x43, 0x34, 0xe3, 0x54, 0x00, 0x35, 0xe3, 0x54, 0x03, 0xba, 0x35, 0xe6, 0x54,
+    0x53, 0x36, 0x7d, 0x55, 0x53, 0x36, 0x36, 0x56, 0x04, 0x06, 0x03, 0xc6, 0x7f, 0x80, 0xab, 0x2f, 0xe2, 0x54, 0x55, 0x32, 0x8b, 0x57, 0x3a, 0x00,
+    0x01, 0x53, 0x32, 0x36, 0x56, 0x03, 0x53, 0x32, 0xf0, 0x56, 0xbd, 0x31, 0x8a, 0x57, 0x00, 0x31, 0x8a, 0x57, 0x03, 0x46, 0x30, 0x8a, 0x57, 0xad,
+    0x2f, 0xf3, 0x56, 0xad, 0x2f, 0x36, 0x56, 0x03, 0xad, 0x2f, 0x7d, 0x55, 0x43, 0x30, 0xe3, 0x54, 0x00, 0x31, 0xe3, 0x54, 0x03, 0xba, 0x31, 0xe6,
+    0x54, 0x53, 0x32, 0x7d, 0x55, 0x53, 0x32, 0x36, 0x56, 0x04, 0x06, 0x03, 0xc6, 0x80, 0x80, 0xab, 0x2d, 0x6b, 0x51, 0x55, 0x30, 0x15, 0x54, 0x09,
+    0x00, 0x07, 0xad, 0x2d, 0x6d, 0x51, 0xa6, 0x02, 0xa6, 0x02, 0x06, 0x03, 0xc6, 0x80, 0x80, 0xab, 0x2f, 0xf5, 0x4d, 0x55, 0x32, 0x9e, 0x50, 0x09,
+    0x00, 0x07, 0xad, 0x2f, 0xf6, 0x4d, 0xa6, 0x02, 0xa6, 0x02, 0x06, 0x03, 0xc6, 0x80, 0x80, 0xab, 0x33, 0xf5, 0x4d, 0x55, 0x36, 0x9e, 0x50, 0x09,
+    0x00, 0x07, 0xad, 0x33, 0xf6, 0x4d, 0xa6, 0x02, 0xa6, 0x02, 0x06, 0x04, 0xc7, 0x80, 0x80, 0x5b, 0x30, 0x1b, 0x50, 0xa5, 0x35, 0x65, 0x55, 0x09,
+    0x00, 0x07, 0x5d, 0x30, 0x1d, 0x50, 0x46, 0x05, 0x46, 0x05, 0x06, 0x03, 0xc7, 0x80, 0x80, 0xb2, 0x2a, 0xb2, 0x51, 0x0e, 0x2d, 0x0e, 0x54, 0x09,
+    0x00, 0x07, 0xb3, 0x2a, 0xb3, 0x51, 0x5a, 0x02, 0x5a, 0x02, 0x06, 0x03, 0xc6, 0x7f, 0x80, 0x68, 0x29, 0xc8, 0x54, 0xc5, 0x2b, 0x25, 0x57, 0x3a,
+    0x00, 0x01, 0xc3, 0x2b, 0xf6, 0x55, 0x03, 0xc3, 0x2b, 0x9d, 0x56, 0x3d, 0x2b, 0x23, 0x57, 0x96, 0x2a, 0x23, 0x57, 0x03, 0xf0, 0x29, 0x23, 0x57,
+    0x6a, 0x29, 0x9d, 0x56, 0x6a, 0x29, 0xf6, 0x55, 0x03, 0x6a, 0x29, 0x50, 0x55, 0xf0, 0x29, 0xca, 0x54, 0x96, 0x2a, 0xca, 0x54, 0x03, 0x3d, 0x2b,
+    0xcd, 0x54, 0xc3, 0x2b, 0x53, 0x55, 0xc3, 0x2b, 0xf6, 0x55, 0x04, 0x06, 0x03, 0xc7, 0x80, 0x80, 0x52, 0x26, 0x12, 0x56, 0xae, 0x28, 0x6e, 0x58,
+    0x09, 0x00, 0x07, 0x53, 0x26, 0x13, 0x56, 0x5a, 0x02, 0x5a, 0x02, 0x06, 0x03, 0xc6, 0x7f, 0x80, 0x38, 0x23, 0xc8, 0x54, 0x95, 0x25, 0x25, 0x57,
+    0x3a, 0x00, 0x01, 0x93, 0x25, 0xf6, 0x55, 0x03, 0x93, 0x25, 0x9d, 0x56, 0x0d, 0x25, 0x23, 0x57, 0x66, 0x24, 0x23, 0x57, 0x03, 0xc0, 0x23, 0x23,
+    0x57, 0x3a, 0x23, 0x9d, 0x56, 0x3a, 0x23, 0xf6, 0x55, 0x03, 0x3a, 0x23, 0x50, 0x55, 0xc0, 0x23, 0xca, 0x54, 0x66, 0x24, 0xca, 0x54, 0x03, 0x0d,
+    0x25, 0xcd, 0x54, 0x93, 0x25, 0x53, 0x55, 0x93, 0x25, 0xf6, 0x55, 0x04, 0x06, 0x03, 0xc7, 0x80, 0x80, 0xf2, 0x21, 0xb2, 0x51, 0x4e, 0x24, 0x0e,
+    0x54, 0x09, 0x00, 0x07, 0xf3, 0x21, 0xb3, 0x51, 0x5a, 0x02, 0x5a, 0x02, 0x06, 0x03, 0xc6, 0x7f, 0x80, 0x38, 0x23, 0x9b, 0x4e, 0x95, 0x25, 0xf8,
+    0x50, 0x09, 0x00, 0x07, 0x3a, 0x23, 0x9d, 0x4e, 0x5a, 0x02, 0x5a, 0x02, 0x06, 0x03, 0xc7, 0x80, 0x80, 0x52, 0x26, 0x52, 0x4d, 0xae, 0x28, 0xae,
+    0x4f, 0x09, 0x00, 0x07, 0x53, 0x26, 0x53, 0x4d, 0x5a, 0x02, 0x5a, 0x02, 0x06, 0x03, 0xc6, 0x7f, 0x80, 0x68, 0x29, 0x9b, 0x4e, 0xc5, 0x2b, 0xf8,
+    0x50, 0x09, 0x00, 0x07, 0x6a, 0x29, 0x9d, 0x4e, 0x5a, 0x02, 0x5a, 0x02, 0x06, 0x04, 0xc8, 0x80, 0x80, 0x6d, 0x24, 0xd0, 0x4f, 0x93, 0x2a, 0xf0,
+    0x55, 0x09, 0x00, 0x07, 0x6e, 0x24, 0xd2, 0x4f, 0x23, 0x06, 0x1d, 0x06, 0x06, 0x03, 0xc6, 0x7f, 0x7f, 0xc2, 0x32, 0x05, 0x00, 0xfb, 0x34, 0x38,
+    0x02, 0x09, 0x00, 0x07, 0xc3, 0x32, 0x06, 0x00, 0x36, 0x02, 0x30, 0x02, 0x06, 0x03, 0xc6, 0x7f, 0x7f, 0xbb, 0x31, 0x7f, 0x02, 0xf5, 0x33, 0xb1,
+    0x04, 0x09, 0x00, 0x07, 0xbd, 0x31, 0x80, 0x02, 0x36, 0x02, 0x30, 0x02, 0x06, 0x03, 0xc6, 0x7f, 0x7f, 0x42, 0x2f, 0x85, 0x03, 0x7b, 0x31, 0xb8,
+    0x05, 0x09, 0x00, 0x07, 0x43, 0x2f, 0x86, 0x03, 0x36, 0x02, 0x30, 0x02, 0x06, 0x03, 0xc7, 0x80, 0x7f, 0xc8, 0x2c, 0x7f, 0x02, 0x01, 0x2f, 0xb1,
+    0x04, 0x09, 0x00, 0x07, 0xca, 0x2c, 0x80, 0x02, 0x36, 0x02, 0x30, 0x02, 0x06, 0x03, 0xc6, 0x7f, 0x7f, 0xc2, 0x2b, 0x05, 0x00, 0xfb, 0x2d, 0x38,
+    0x02, 0x09, 0x00, 0x07, 0xc3, 0x2b, 0x06, 0x00, 0x36, 0x02, 0x30, 0x02, 0x06, 0x03, 0xc6, 0x80, 0x80, 0xc8, 0x2c, 0x8b, 0xfd, 0x01, 0x2f, 0xbe,
+    0xff, 0x09, 0x00, 0x07, 0xca, 0x2c, 0x8d, 0xfd, 0x36, 0x02, 0x30, 0x02, 0x06, 0x03, 0xc6, 0x7f, 0x7f, 0x42, 0x2f, 0x85, 0xfc, 0x7b, 0x31, 0xb8,
+    0xfe, 0x09, 0x00, 0x07, 0x43, 0x2f, 0x86, 0xfc, 0x36, 0x02, 0x30, 0x02, 0x06, 0x03, 0xc6, 0x7f, 0x80, 0xbf, 0x31, 0x8b, 0xfd, 0xf5, 0x33, 0xc1,
+    0xff, 0x09, 0x00, 0x07, 0xc0, 0x31, 0x8d, 0xfd, 0x33, 0x02, 0x33, 0x02, 0x06, 0x02, 0xc6, 0x80, 0x80, 0x7f, 0x2d, 0x3b, 0xfe, 0x41, 0x33, 0x01,
+    0x04, 0x3a, 0x00, 0x01, 0x40, 0x33, 0x20, 0x01, 0x03, 0x40, 0x33, 0xb6, 0x02, 0xf6, 0x31, 0x00, 0x04, 0x60, 0x30, 0xfd, 0x03, 0x03, 0xca, 0x2e,
+    0xfd, 0x03, 0x80, 0x2d, 0xb3, 0x02, 0x83, 0x2d, 0x1d, 0x01, 0x03, 0x83, 0x2d, 0x86, 0xff, 0xcd, 0x2e, 0x3d, 0xfe, 0x63, 0x30, 0x40, 0xfe, 0x03,
+    0xf6, 0x31, 0x40, 0xfe, 0x40, 0x33, 0x8a, 0xff, 0x40, 0x33, 0x20, 0x01, 0x04, 0x06, 0x02, 0xc1, 0x7f, 0x80, 0xd8, 0x37, 0x18, 0x5f, 0xa8, 0x38,
+    0xe8, 0x5f, 0x3a, 0x00, 0x01, 0xa6, 0x38, 0x80, 0x5f, 0x03, 0xa6, 0x38, 0xb6, 0x5f, 0x7a, 0x38, 0xe6, 0x5f, 0x40, 0x38, 0xe6, 0x5f, 0x03, 0x0a,
+    0x38, 0xe6, 0x5f, 0xda, 0x37, 0xba, 0x5f, 0xda, 0x37, 0x80, 0x5f, 0x03, 0xda, 0x37, 0x46, 0x5f, 0x06, 0x38, 0x1a, 0x5f, 0x40, 0x38, 0x1a, 0x5f,
+    0x03, 0x76, 0x38, 0x1a, 0x5f, 0xa6, 0x38, 0x4a, 0x5f, 0xa6, 0x38, 0x80, 0x5f, 0x04, 0x01, 0x03, 0xed, 0x37, 0x96, 0x60, 0x04, 0xc7, 0x06, 0x06,
+    0x02, 0xc2, 0x80, 0x80, 0x98, 0xff, 0x98, 0xff, 0x68, 0x00, 0x68, 0x00, 0x09, 0x00, 0x07, 0x9a, 0xff, 0x9a, 0xff, 0xcd, 0x00, 0xcd, 0x00, 0x02,
+    0x01, 0x03, 0x13, 0x37, 0x55, 0x61, 0x04, 0x57, 0x03, 0x06, 0x02, 0xc3, 0x80, 0x80, 0x98, 0xff, 0x97, 0xff, 0x68, 0x00, 0x69, 0x00, 0x09, 0x00,
+    0x07, 0x9a, 0xff, 0x98, 0xff, 0xcd, 0x00, 0xd0, 0x00, 0x02, 0x06, 0x02, 0xc3, 0x7f, 0x80, 0x8f, 0x35, 0x12, 0x61, 0x5e, 0x36, 0xe1, 0x61, 0x3a,
+    0x00, 0x01, 0x5d, 0x36, 0x7a, 0x61, 0x03, 0x5d, 0x36, 0xb0, 0x61, 0x30, 0x36, 0xe0, 0x61, 0xf6, 0x35, 0xe0, 0x61, 0x03, 0xc0, 0x35, 0xe0, 0x61,
+    0x90, 0x35, 0xb3, 0x61, 0x90, 0x35, 0x7a, 0x61, 0x03, 0x90, 0x35, 0x43, 0x61, 0xbd, 0x35, 0x13, 0x61, 0xf6, 0x35, 0x13, 0x61, 0x03, 0x30, 0x36,
+    0x16, 0x61, 0x5d, 0x36, 0x43, 0x61, 0x5d, 0x36, 0x7a, 0x61, 0x04, 0x06, 0x02, 0xc2, 0x80, 0x80, 0x88, 0x34, 0x9b, 0x60, 0x58, 0x35, 0x6b, 0x61,
+    0x09, 0x00, 0x07, 0x8a, 0x34, 0x9d, 0x60, 0xcd, 0x00, 0xcd, 0x00, 0x06, 0x02, 0xc1, 0x7f, 0x80, 0xeb, 0x33, 0xa8, 0x5f, 0xbb, 0x34, 0x78, 0x60,
+    0x3a, 0x00, 0x01, 0xba, 0x34, 0x10, 0x60, 0x03, 0xba, 0x34, 0x46, 0x60, 0x8d, 0x34, 0x76, 0x60, 0x53, 0x34, 0x76, 0x60, 0x03, 0x1a, 0x34, 0x76,
+    0x60, 0xed, 0x33, 0x4a, 0x60, 0xed, 0x33, 0x10, 0x60, 0x03, 0xed, 0x33, 0xda, 0x5f, 0x1a, 0x34, 0xaa, 0x5f, 0x53, 0x34, 0xaa, 0x5f, 0x03, 0x8d,
+    0x34, 0xad, 0x5f, 0xba, 0x34, 0xda, 0x5f, 0xba, 0x34, 0x10, 0x60, 0x04, 0x01, 0x03, 0x53, 0x34, 0xf0, 0x5e, 0x04, 0xc7, 0x06, 0x06, 0x02, 0xc2,
+    0x80, 0x80, 0x98, 0xff, 0x98, 0xff, 0x68, 0x00, 0x68, 0x00, 0x09, 0x00, 0x07, 0x9a, 0xff, 0x9a, 0xff, 0xcd, 0x00, 0xcd, 0x00, 0x02, 0x06, 0x02,
+    0xc1, 0x7f, 0x80, 0x88, 0x34, 0x95, 0x5d, 0x58, 0x35, 0x65, 0x5e, 0x3a, 0x00, 0x01, 0x56, 0x35, 0xfd, 0x5d, 0x03, 0x56, 0x35, 0x33, 0x5e, 0x2a,
+    0x35, 0x63, 0x5e, 0xf0, 0x34, 0x63, 0x5e, 0x03, 0xba, 0x34, 0x63, 0x5e, 0x8a, 0x34, 0x36, 0x5e, 0x8a, 0x34, 0xfd, 0x5d, 0x03, 0x8a, 0x34, 0xc6,
+    0x5d, 0xb6, 0x34, 0x96, 0x5d, 0xf0, 0x34, 0x96, 0x5d, 0x03, 0x2a, 0x35, 0x9a, 0x5d, 0x56, 0x35, 0xc6, 0x5d, 0x56, 0x35, 0xfd, 0x5d, 0x04, 0x06,
+    0x02, 0xc4, 0x7f, 0x7f, 0x8f, 0x35, 0x1f, 0x5d, 0x5e, 0x36, 0xee, 0x5d, 0x09, 0x00, 0x07, 0x90, 0x35, 0x20, 0x5d, 0xcd, 0x00, 0xcd, 0x00, 0x06,
+    0x02, 0xc2, 0x7f, 0x80, 0xab, 0x36, 0x45, 0x5d, 0x7b, 0x37, 0x15, 0x5e, 0x3a, 0x00, 0x01, 0x7a, 0x37, 0xad, 0x5d, 0x03, 0x7a, 0x37, 0xe3, 0x5d,
+    0x4d, 0x37, 0x13, 0x5e, 0x13, 0x37, 0x13, 0x5e, 0x03, 0xda, 0x36, 0x13, 0x5e, 0xad, 0x36, 0xe6, 0x5d, 0xad, 0x36, 0xad, 0x5d, 0x03, 0xad, 0x36,
+    0x73, 0x5d, 0xda, 0x36, 0x46, 0x5d, 0x13, 0x37, 0x46, 0x5d, 0x03, 0x4d, 0x37, 0x4a, 0x5d, 0x7a, 0x37, 0x76, 0x5d, 0x7a, 0x37, 0xad, 0x5d, 0x04,
+    0x06, 0x02, 0xc2, 0x7f, 0x80, 0x85, 0x37, 0x02, 0x5e, 0x55, 0x38, 0xd1, 0x5e, 0x3a, 0x00, 0x01, 0x53, 0x38, 0x6a, 0x5e, 0x03, 0x53, 0x38, 0xa0,
+    0x5e, 0x26, 0x38, 0xd0, 0x5e, 0xed, 0x37, 0xd0, 0x5e, 0x03, 0xb3, 0x37, 0xd0, 0x5e, 0x86, 0x37, 0xa3, 0x5e, 0x86, 0x37, 0x6a, 0x5e, 0x03, 0x86,
+    0x37, 0x33, 0x5e, 0xb3, 0x37, 0x03, 0x5e, 0xed, 0x37, 0x03, 0x5e, 0x03, 0x26, 0x38, 0x06, 0x5e, 0x53, 0x38, 0x33, 0x5e, 0x53, 0x38, 0x6a, 0x5e,
+    0x04, 0x06, 0x03, 0xc7, 0x80, 0x80, 0xd8, 0x34, 0x18, 0x5e, 0xa8, 0x37, 0xe8, 0x60, 0x09, 0x00, 0x07, 0xda, 0x34, 0x1a, 0x5e, 0xcd, 0x02, 0xcd,
+    0x02, 0x06, 0x03, 0xc3, 0x80, 0x80, 0x6f, 0x4d, 0x0f, 0x42, 0x51, 0x4e, 0xf1, 0x42, 0x3a, 0x00, 0x01, 0x50, 0x4e, 0x80, 0x42, 0x03, 0x50, 0x4e,
+    0xbd, 0x42, 0x1d, 0x4e, 0xf0, 0x42, 0xe0, 0x4d, 0xf0, 0x42, 0x03, 0xa3, 0x4d, 0xf0, 0x42, 0x70, 0x4d, 0xbd, 0x42, 0x70, 0x4d, 0x80, 0x42, 0x03,
+    0x70, 0x4d, 0x43, 0x42, 0xa3, 0x4d, 0x10, 0x42, 0xe0, 0x4d, 0x10, 0x42, 0x03, 0x1d, 0x4e, 0x10, 0x42, 0x50, 0x4e, 0x43, 0x42, 0x50, 0x4e, 0x80,
+    0x42, 0x04, 0x01, 0x03, 0x66, 0x4d, 0x7b, 0x43, 0x04, 0xea, 0x06, 0x06, 0x03, 0xc3, 0x80, 0x80, 0x90, 0xff, 0x8d, 0xff, 0x70, 0x00, 0x73, 0x00,
+    0x09, 0x00, 0x07, 0x92, 0xff, 0x8e, 0xff, 0xdd, 0x00, 0xe3, 0x00, 0x02, 0x06, 0x03, 0xc2, 0x80, 0x7f, 0xe8, 0x4b, 0x45, 0x43, 0xcb, 0x4c, 0x28,
+    0x44, 0x3a, 0x00, 0x01, 0xca, 0x4c, 0xb6, 0x43, 0x03, 0xca, 0x4c, 0xf3, 0x43, 0x96, 0x4c, 0x26, 0x44, 0x5a, 0x4c, 0x26, 0x44, 0x03, 0x1d, 0x4c,
+    0x26, 0x44, 0xea, 0x4b, 0xf3, 0x43, 0xea, 0x4b, 0xb6, 0x43, 0x03, 0xea, 0x4b, 0x7a, 0x43, 0x1d, 0x4c, 0x46, 0x43, 0x5a, 0x4c, 0x46, 0x43, 0x03,
+    0x96, 0x4c, 0x46, 0x43, 0xca, 0x4c, 0x7a, 0x43, 0xca, 0x4c, 0xb6, 0x43, 0x04, 0x06, 0x03, 0xc3, 0x7f, 0x80, 0x0f, 0x4b, 0x98, 0x42, 0xf1, 0x4b,
+    0x7b, 0x43, 0x3a, 0x00, 0x01, 0xf0, 0x4b, 0x0a, 0x43, 0x03, 0xf0, 0x4b, 0x46, 0x43, 0xbd, 0x4b, 0x7a, 0x43, 0x80, 0x4b, 0x7a, 0x43, 0x03, 0x43,
+    0x4b, 0x7a, 0x43, 0x10, 0x4b, 0x46, 0x43, 0x10, 0x4b, 0x0a, 0x43, 0x03, 0x10, 0x4b, 0xcd, 0x42, 0x43, 0x4b, 0x9a, 0x42, 0x80, 0x4b, 0x9a, 0x42,
+    0x03, 0xbd, 0x4b, 0x9a, 0x42, 0xf0, 0x4b, 0xcd, 0x42, 0xf0, 0x4b, 0x0a, 0x43, 0x04, 0x06, 0x03, 0xc1, 0x80, 0x81, 0x0f, 0x4b, 0x82, 0x41, 0xf1,
+    0x4b, 0x68, 0x42, 0x3a, 0x00, 0x01, 0xf0, 0x4b, 0xf6, 0x41, 0x03, 0xf0, 0x4b, 0x33, 0x42, 0xbd, 0x4b, 0x66, 0x42, 0x80, 0x4b, 0x66, 0x42, 0x03,
+    0x43, 0x4b, 0x66, 0x42, 0x10, 0x4b, 0x33, 0x42, 0x10, 0x4b, 0xf6, 0x41, 0x03, 0x10, 0x4b, 0xba, 0x41, 0x43, 0x4b, 0x86, 0x41, 0x80, 0x4b, 0x86,
+    0x41, 0x03, 0xbd, 0x4b, 0x83, 0x41, 0xf0, 0x4b, 0xb6, 0x41, 0xf0, 0x4b, 0xf6, 0x41, 0x04, 0x06, 0x03, 0xc0, 0x80, 0x81, 0xe8, 0x4b, 0xd5, 0x40,
+    0xcb, 0x4c, 0xbb, 0x41, 0x3a, 0x00, 0x01, 0xca, 0x4c, 0x4a, 0x41, 0x03, 0xca, 0x4c, 0x86, 0x41, 0x96, 0x4c, 0xba, 0x41, 0x5a, 0x4c, 0xba, 0x41,
+    0x03, 0x1d, 0x4c, 0xba, 0x41, 0xea, 0x4b, 0x86, 0x41, 0xea, 0x4b, 0x4a, 0x41, 0x03, 0xea, 0x4b, 0x0d, 0x41, 0x1d, 0x4c, 0xda, 0x40, 0x5a, 0x4c,
+    0xda, 0x40, 0x03, 0x96, 0x4c, 0xd6, 0x40, 0xca, 0x4c, 0x0a, 0x41, 0xca, 0x4c, 0x4a, 0x41, 0x04, 0x01, 0x03, 0x66, 0x4d, 0x88, 0x41, 0x04, 0xea,
+    0x06, 0x06, 0x03, 0xc3, 0x80, 0x80, 0x90, 0xff, 0x8d, 0xff, 0x70, 0x00, 0x73, 0x00, 0x09, 0x00, 0x07, 0x92, 0xff, 0x8e, 0xff, 0xdd, 0x00, 0xe3,
+    0x00, 0x02, 0x06, 0x04, 0xc6, 0x80, 0x80, 0x9b, 0x4b, 0x7b, 0x41, 0xa5, 0x4d, 0x85, 0x43, 0x09, 0x00, 0x07, 0x9d, 0x4b, 0x7d, 0x41, 0x06, 0x02,
+    0x06, 0x02, 0x06, 0x03, 0xc1, 0x80, 0x7f, 0x6b, 0x5f, 0x2f, 0x1c, 0x51, 0x60, 0x15, 0x1d, 0x3a, 0x00, 0x01, 0x50, 0x60, 0xa0, 0x1c, 0x03, 0x50,
+    0x60, 0xdd, 0x1c, 0x20, 0x60, 0x10, 0x1d, 0xe0, 0x5f, 0x13, 0x1d, 0x03, 0xa3, 0x5f, 0x13, 0x1d, 0x70, 0x5f, 0xe3, 0x1c, 0x6d, 0x5f, 0xa3, 0x1c,
+    0x03, 0x6d, 0x5f, 0x66, 0x1c, 0x9d, 0x5f, 0x33, 0x1c, 0xdd, 0x5f, 0x30, 0x1c, 0x03, 0x1d, 0x60, 0x30, 0x1c, 0x50, 0x60, 0x63, 0x1c, 0x50, 0x60,
+    0xa0, 0x1c, 0x04, 0x01, 0x03, 0xa3, 0x5f, 0x72, 0x1d, 0x04, 0xea, 0x06, 0x06, 0x03, 0xc3, 0x80, 0x80, 0x90, 0xff, 0x8d, 0xff, 0x70, 0x00, 0x73,
+    0x00, 0x09, 0x00, 0x07, 0x92, 0xff, 0x8e, 0xff, 0xdd, 0x00, 0xe3, 0x00, 0x02, 0x06, 0x03, 0xc3, 0x80, 0x80, 0x8f, 0x5e, 0x8b, 0x1d, 0x71, 0x5f,
+    0x6e, 0x1e, 0x3a, 0x00, 0x01, 0x70, 0x5f, 0xfd, 0x1d, 0x03, 0x70, 0x5f, 0x3a, 0x1e, 0x3d, 0x5f, 0x6d, 0x1e, 0x00, 0x5f, 0x6d, 0x1e, 0x03, 0xc3,
+    0x5e, 0x6d, 0x1e, 0x90, 0x5e, 0x3a, 0x1e, 0x90, 0x5e, 0xfd, 0x1d, 0x03, 0x90, 0x5e, 0xc0, 0x1d, 0xc3, 0x5e, 0x8d, 0x1d, 0x00, 0x5f, 0x8d, 0x1d,
+    0x03, 0x3d, 0x5f, 0x8d, 0x1d, 0x70, 0x5f, 0xc0, 0x1d, 0x70, 0x5f, 0xfd, 0x1d, 0x04, 0x01, 0x03, 0x2a, 0x5e, 0x1e, 0x1e, 0x04, 0xea, 0x06, 0x06,
+    0x03, 0xc3, 0x80, 0x80, 0x90, 0xff, 0x8d, 0xff, 0x70, 0x00, 0x73, 0x00, 0x09, 0x00, 0x07, 0x92, 0xff, 0x8e, 0xff, 0xdd, 0x00, 0xe3, 0x00, 0x02,
+    0x01, 0x03, 0x66, 0x5d, 0xc5, 0x1d, 0x04, 0xea, 0x06, 0x06, 0x03, 0xc3, 0x80, 0x80, 0x90, 0xff, 0x8d, 0xff, 0x70, 0x00, 0x73, 0x00, 0x09, 0x00,
+    0x07, 0x92, 0xff, 0x8e, 0xff, 0xdd, 0x00, 0xe3, 0x00, 0x02, 0x06, 0x03, 0xc2, 0x80, 0x80, 0x7b, 0x5c, 0x9b, 0x1c, 0x61, 0x5d, 0x81, 0x1d, 0x3a,
+    0x00, 0x01, 0x60, 0x5d, 0x0d, 0x1d, 0x03, 0x60, 0x5d, 0x4a, 0x1d, 0x30, 0x5d, 0x7d, 0x1d, 0xf0, 0x5c, 0x80, 0x1d, 0x03, 0xb3, 0x5c, 0x80, 0x1d,
+    0x80, 0x5c, 0x50, 0x1d, 0x7d, 0x5c, 0x10, 0x1d, 0x03, 0x7d, 0x5c, 0xd3, 0x1c, 0xad, 0x5c, 0xa0, 0x1c, 0xed, 0x5c, 0x9d, 0x1c, 0x03, 0x2d, 0x5d,
+    0x9d, 0x1c, 0x60, 0x5d, 0xcd, 0x1c, 0x60, 0x5d, 0x0d, 0x1d, 0x04, 0x06, 0x03, 0xc0, 0x81, 0x7f, 0x78, 0x5c, 0xc2, 0x1b, 0x61, 0x5d, 0xa8, 0x1c,
+    0x3a, 0x00, 0x01, 0x60, 0x5d, 0x33, 0x1c, 0x03, 0x60, 0x5d, 0x70, 0x1c, 0x30, 0x5d, 0xa3, 0x1c, 0xf0, 0x5c, 0xa6, 0x1c, 0x03, 0xb3, 0x5c, 0xa6,
+    0x1c, 0x80, 0x5c, 0x76, 0x1c, 0x7d, 0x5c, 0x36, 0x1c, 0x03, 0x7a, 0x5c, 0xf6, 0x1b, 0xad, 0x5c, 0xc6, 0x1b, 0xed, 0x5c, 0xc3, 0x1b, 0x03, 0x2d,
+    0x5d, 0xc3, 0x1b, 0x60, 0x5d, 0xf6, 0x1b, 0x60, 0x5d, 0x33, 0x1c, 0x04, 0x06, 0x03, 0xc2, 0x7f, 0x80, 0xf5, 0x5c, 0x0b, 0x1b, 0xd8, 0x5d, 0xee,
+    0x1b, 0x3a, 0x00, 0x01, 0xd6, 0x5d, 0x7d, 0x1b, 0x03, 0xd6, 0x5d, 0xba, 0x1b, 0xa3, 0x5d, 0xed, 0x1b, 0x66, 0x5d, 0xed, 0x1b, 0x03, 0x2a, 0x5d,
+    0xed, 0x1b, 0xf6, 0x5c, 0xba, 0x1b, 0xf6, 0x5c, 0x7d, 0x1b, 0x03, 0xf6, 0x5c, 0x40, 0x1b, 0x2a, 0x5d, 0x0d, 0x1b, 0x66, 0x5d, 0x0d, 0x1b, 0x03,
+    0xa3, 0x5d, 0x0d, 0x1b, 0xd6, 0x5d, 0x40, 0x1b, 0xd6, 0x5d, 0x7d, 0x1b, 0x04, 0x06, 0x03, 0xc2, 0x80, 0x7f, 0xb8, 0x5d, 0xb2, 0x1a, 0x9b, 0x5e,
+    0x95, 0x1b, 0x3a, 0x00, 0x01, 0x9a, 0x5e, 0x23, 0x1b, 0x03, 0x9a, 0x5e, 0x60, 0x1b, 0x66, 0x5e, 0x93, 0x1b, 0x2a, 0x5e, 0x93, 0x1b, 0x03, 0xed,
+    0x5d, 0x93, 0x1b, 0xba, 0x5d, 0x60, 0x1b, 0xba, 0x5d, 0x23, 0x1b, 0x03, 0xba, 0x5d, 0xe6, 0x1a, 0xed, 0x5d, 0xb3, 0x1a, 0x2a, 0x5e, 0xb3, 0x1a,
+    0x03, 0x66, 0x5e, 0xb3, 0x1a, 0x9a, 0x5e, 0xe6, 0x1a, 0x9a, 0x5e, 0x23, 0x1b, 0x04, 0x01, 0x03, 0x00, 0x5f, 0x45, 0x1b, 0x04, 0xea, 0x06, 0x06,
+    0x03, 0xc3, 0x80, 0x80, 0x90, 0xff, 0x8d, 0xff, 0x70, 0x00, 0x73, 0x00, 0x09, 0x00, 0x07, 0x92, 0xff, 0x8e, 0xff, 0xdd, 0x00, 0xe3, 0x00, 0x02,
+    0x06, 0x03, 0xc3, 0x7f, 0x80, 0x32, 0x5f, 0x5f, 0x1b, 0x15, 0x60, 0x41, 0x1c, 0x3a, 0x00, 0x01, 0x13, 0x60, 0xd0, 0x1b, 0x03, 0x13, 0x60, 0x0d,
+    0x1c, 0xe0, 0x5f, 0x40, 0x1c, 0xa3, 0x5f, 0x40, 0x1c, 0x03, 0x66, 0x5f, 0x40, 0x1c, 0x33, 0x5f, 0x0d, 0x1c, 0x33, 0x5f, 0xd0, 0x1b, 0x03, 0x33,
+    0x5f, 0x93, 0x1b, 0x66, 0x5f, 0x60, 0x1b, 0xa3, 0x5f, 0x60, 0x1b, 0x03, 0xe0, 0x5f, 0x60, 0x1b, 0x13, 0x60, 0x93, 0x1b, 0x13, 0x60, 0xd0, 0x1b,
+    0x04, 0x06, 0x02, 0xc7, 0x80, 0x80, 0xcf, 0x5c, 0x0f, 0x1b, 0xf1, 0x5f, 0x31, 0x1e, 0x09, 0x00, 0x07, 0xd0, 0x5c, 0x10, 0x1b, 0x20, 0x03, 0x20,
+    0x03, 0x06, 0x03, 0xc6, 0x7f, 0x7f, 0x05, 0x41, 0x48, 0x24, 0x78, 0x43, 0xb5, 0x26, 0x09, 0x00, 0x07, 0x06, 0x41, 0x4a, 0x24, 0x70, 0x02, 0x6a,
+    0x02, 0x06, 0x03, 0xc7, 0x80, 0x7f, 0x6f, 0x40, 0x78, 0x26, 0xe1, 0x42, 0xe5, 0x28, 0x09, 0x00, 0x07, 0x70, 0x40, 0x7a, 0x26, 0x70, 0x02, 0x6a,
+    0x02, 0x06, 0x03, 0xc7, 0x7f, 0x80, 0xd5, 0x3e, 0x12, 0x28, 0x48, 0x41, 0x7e, 0x2a, 0x09, 0x00, 0x07, 0xd6, 0x3e, 0x13, 0x28, 0x70, 0x02, 0x6a,
+    0x02, 0x06, 0x03, 0xc6, 0x7f, 0x7f, 0xa5, 0x3c, 0xa8, 0x28, 0x18, 0x3f, 0x15, 0x2b, 0x09, 0x00, 0x07, 0xa6, 0x3c, 0xaa, 0x28, 0x70, 0x02, 0x6a,
+    0x02, 0x06, 0x03, 0xc7, 0x7f, 0x80, 0x75, 0x3a, 0x12, 0x28, 0xe8, 0x3c, 0x7e, 0x2a, 0x09, 0x00, 0x07, 0x76, 0x3a, 0x13, 0x28, 0x70, 0x02, 0x6a,
+    0x02, 0x06, 0x03, 0xc6, 0x80, 0x7f, 0xdb, 0x38, 0x78, 0x26, 0x4e, 0x3b, 0xe5, 0x28, 0x09, 0x00, 0x07, 0xdd, 0x38, 0x7a, 0x26, 0x70, 0x02, 0x6a,
+    0x02, 0x06, 0x03, 0xc6, 0x7f, 0x7f, 0x45, 0x38, 0x48, 0x24, 0xb8, 0x3a, 0xb5, 0x26, 0x09, 0x00, 0x07, 0x46, 0x38, 0x4a, 0x24, 0x70, 0x02, 0x6a,
+    0x02, 0x06, 0x03, 0xc6, 0x80, 0x7f, 0xdb, 0x38, 0x18, 0x22, 0x4e, 0x3b, 0x85, 0x24, 0x09, 0x00, 0x07, 0xdd, 0x38, 0x1a, 0x22, 0x70, 0x02, 0x6a,
+    0x02, 0x06, 0x03, 0xc7, 0x7f, 0x7f, 0x75, 0x3a, 0x7f, 0x20, 0xe8, 0x3c, 0xeb, 0x22, 0x09, 0x00, 0x07, 0x76, 0x3a, 0x80, 0x20, 0x70, 0x02, 0x6a,
+    0x02, 0x06, 0x03, 0xc6, 0x7f, 0x7f, 0xa5, 0x3c, 0xe8, 0x1f, 0x18, 0x3f, 0x55, 0x22, 0x09, 0x00, 0x07, 0xa6, 0x3c, 0xea, 0x1f, 0x70, 0x02, 0x6a,
+    0x02, 0x06, 0x03, 0xc7, 0x7f, 0x7f, 0xd5, 0x3e, 0x7f, 0x20, 0x48, 0x41, 0xeb, 0x22, 0x09, 0x00, 0x07, 0xd6, 0x3e, 0x80, 0x20, 0x70, 0x02, 0x6a,
+    0x02, 0x06, 0x03, 0xc7, 0x80, 0x7f, 0x6f, 0x40, 0x18, 0x22, 0xe1, 0x42, 0x85, 0x24, 0x09, 0x00, 0x07, 0x70, 0x40, 0x1a, 0x22, 0x70, 0x02, 0x6a,
+    0x02, 0x06, 0x00, 0xc8, 0x80, 0x80, 0x32, 0x39, 0xd2, 0x20, 0x91, 0x42, 0x31, 0x2a, 0x09, 0x00, 0x07, 0x33, 0x39, 0xd3, 0x20, 0x5d, 0x09, 0x5d,
+    0x09, 0x06, 0x03, 0xbe, 0x81, 0x80, 0x7b, 0x4f, 0xf8, 0x4a, 0xc5, 0x50, 0x45, 0x4c, 0x3a, 0x00, 0x01, 0xc3, 0x50, 0xa0, 0x4b, 0x03, 0xc3, 0x50,
+    0xfa, 0x4b, 0x7a, 0x50, 0x43, 0x4c, 0x20, 0x50, 0x40, 0x4c, 0x03, 0xc6, 0x4f, 0x3d, 0x4c, 0x7d, 0x4f, 0xf6, 0x4b, 0x80, 0x4f, 0x9d, 0x4b, 0x03,
+    0x83, 0x4f, 0x43, 0x4b, 0xca, 0x4f, 0xfa, 0x4a, 0x23, 0x50, 0xfd, 0x4a, 0x03, 0x7a, 0x50, 0xfd, 0x4a, 0xc0, 0x50, 0x46, 0x4b, 0xc3, 0x50, 0xa0,
+    0x4b, 0x04, 0x01, 0x03, 0x65, 0x4f, 0x60, 0x4d, 0x04, 0x98, 0x08, 0x06, 0x03, 0xc5, 0x80, 0x80, 0x5b, 0xff, 0x5f, 0xff, 0xa5, 0x00, 0xa1, 0x00,
+    0x09, 0x00, 0x07, 0x5d, 0xff, 0x60, 0xff, 0x46, 0x01, 0x40, 0x01, 0x02, 0x06, 0x03, 0xbe, 0x81, 0x80, 0xfb, 0x4c, 0x78, 0x4d, 0x45, 0x4e, 0xc5,
+    0x4e, 0x3a, 0x00, 0x01, 0x43, 0x4e, 0x20, 0x4e, 0x03, 0x43, 0x4e, 0x7a, 0x4e, 0xfa, 0x4d, 0xc3, 0x4e, 0xa0, 0x4d, 0xc0, 0x4e, 0x03, 0x46, 0x4d,
+    0xbd, 0x4e, 0xfd, 0x4c, 0x76, 0x4e, 0x00, 0x4d, 0x1d, 0x4e, 0x03, 0x03, 0x4d, 0xc3, 0x4d, 0x4a, 0x4d, 0x7a, 0x4d, 0xa3, 0x4d, 0x7d, 0x4d, 0x03,
+    0xfa, 0x4d, 0x7d, 0x4d, 0x40, 0x4e, 0xc6, 0x4d, 0x43, 0x4e, 0x20, 0x4e, 0x04, 0x01, 0x03, 0xdb, 0x4b, 0x60, 0x4d, 0x04, 0x98, 0x08, 0x06, 0x03,
+    0xc5, 0x80, 0x80, 0x5b, 0xff, 0x5f, 0xff, 0xa5, 0x00, 0xa1, 0x00, 0x09, 0x00, 0x07, 0x5d, 0xff, 0x60, 0xff, 0x46, 0x01, 0x40, 0x01, 0x02, 0x06,
+    0x03, 0xbe, 0x81, 0x80, 0x7b, 0x4a, 0xf8, 0x4a, 0xc5, 0x4b, 0x45, 0x4c, 0x3a, 0x00, 0x01, 0xc3, 0x4b, 0xa0, 0x4b, 0x03, 0xc3, 0x4b, 0xfa, 0x4b,
+    0x7a, 0x4b, 0x43, 0x4c, 0x20, 0x4b, 0x40, 0x4c, 0x03, 0xc6, 0x4a, 0x3d, 0x4c, 0x7d, 0x4a, 0xf6, 0x4b, 0x80, 0x4a, 0x9d, 0x4b, 0x03, 0x83, 0x4a,
+    0x43, 0x4b, 0xca, 0x4a, 0xfa, 0x4a, 0x23, 0x4b, 0xfd, 0x4a, 0x03, 0x7a, 0x4b, 0xfd, 0x4a, 0xc0, 0x4b, 0x46, 0x4b, 0xc3, 0x4b, 0xa0, 0x4b, 0x04,
+    0x06, 0x03, 0xc0, 0x81, 0x80, 0x35, 0x4b, 0x35, 0x49, 0x7e, 0x4c, 0x81, 0x4a, 0x3a, 0x00, 0x01, 0x7d, 0x4c, 0xdd, 0x49, 0x03, 0x7d, 0x4c, 0x36,
+    0x4a, 0x33, 0x4c, 0x80, 0x4a, 0xda, 0x4b, 0x7d, 0x4a, 0x03, 0x80, 0x4b, 0x7a, 0x4a, 0x36, 0x4b, 0x33, 0x4a, 0x3a, 0x4b, 0xda, 0x49, 0x03, 0x3d,
+    0x4b, 0x80, 0x49, 0x83, 0x4b, 0x36, 0x49, 0xdd, 0x4b, 0x3a, 0x49, 0x03, 0x33, 0x4c, 0x3a, 0x49, 0x7d, 0x4c, 0x83, 0x49, 0x7d, 0x4c, 0xdd, 0x49,
+    0x04, 0x06, 0x03, 0xbe, 0x81, 0x80, 0xfb, 0x4c, 0x78, 0x48, 0x45, 0x4e, 0xc5, 0x49, 0x3a, 0x00, 0x01, 0x43, 0x4e, 0x20, 0x49, 0x03, 0x43, 0x4e,
+    0x7a, 0x49, 0xfa, 0x4d, 0xc3, 0x49, 0xa0, 0x4d, 0xc0, 0x49, 0x03, 0x46, 0x4d, 0xbd, 0x49, 0xfd, 0x4c, 0x76, 0x49, 0x00, 0x4d, 0x1d, 0x49, 0x03,
+    0x03, 0x4d, 0xc3, 0x48, 0x4a, 0x4d, 0x7a, 0x48, 0xa3, 0x4d, 0x7d, 0x48, 0x03, 0xfa, 0x4d, 0x7d, 0x48, 0x40, 0x4e, 0xc6, 0x48, 0x43, 0x4e, 0x20,
+    0x49, 0x04, 0x06, 0x03, 0xc0, 0x81, 0x80, 0xbf, 0x4e, 0x35, 0x49, 0x08, 0x50, 0x81, 0x4a, 0x3a, 0x00, 0x01, 0x06, 0x50, 0xdd, 0x49, 0x03, 0x06,
+    0x50, 0x36, 0x4a, 0xbd, 0x4f, 0x80, 0x4a, 0x63, 0x4f, 0x7d, 0x4a, 0x03, 0x0a, 0x4f, 0x7a, 0x4a, 0xc0, 0x4e, 0x33, 0x4a, 0xc3, 0x4e, 0xda, 0x49,
+    0x03, 0xc6, 0x4e, 0x80, 0x49, 0x0d, 0x4f, 0x36, 0x49, 0x66, 0x4f, 0x3a, 0x49, 0x03, 0xbd, 0x4f, 0x3a, 0x49, 0x06, 0x50, 0x83, 0x49, 0x06, 0x50,
+    0xdd, 0x49, 0x04, 0x06, 0x02, 0xc7, 0x80, 0x80, 0xf8, 0x4b, 0xf8, 0x49, 0x48, 0x4f, 0x48, 0x4d, 0x09, 0x00, 0x07, 0xfa, 0x4b, 0xfa, 0x49, 0x4d,
+    0x03, 0x4d, 0x03, 0x06, 0x03, 0xc7, 0x7f, 0x7f, 0x25, 0x14, 0x68, 0x18, 0x18, 0x17, 0x55, 0x1b, 0x09, 0x00, 0x07, 0x26, 0x14, 0x6a, 0x18, 0xf0,
+    0x02, 0xea, 0x02, 0x06, 0x03, 0xc7, 0x7f, 0x80, 0x12, 0x12, 0x42, 0x1b, 0x05, 0x15, 0x2e, 0x1e, 0x09, 0x00, 0x07, 0x13, 0x12, 0x43, 0x1b, 0xf0,
+    0x02, 0xea, 0x02, 0x06, 0x03, 0xc7, 0x80, 0x80, 0xb8, 0x0e, 0x2b, 0x1a, 0xab, 0x11, 0x18, 0x1d, 0x09, 0x00, 0x07, 0xba, 0x0e, 0x2d, 0x1a, 0xf0,
+    0x02, 0xea, 0x02, 0x06, 0x03, 0xc7, 0x80, 0x80, 0xb8, 0x0e, 0xa5, 0x16, 0xab, 0x11, 0x91, 0x19, 0x09, 0x00, 0x07, 0xba, 0x0e, 0xa6, 0x16, 0xf0,
+    0x02, 0xea, 0x02, 0x06, 0x03, 0xc7, 0x7f, 0x7f, 0x12, 0x12, 0x8f, 0x15, 0x05, 0x15, 0x7b, 0x18, 0x09, 0x00, 0x07, 0x13, 0x12, 0x90, 0x15, 0xf0,
+    0x02, 0xea, 0x02, 0x06, 0x00, 0xc8, 0x80, 0x80, 0x22, 0x10, 0x62, 0x17, 0x1e, 0x15, 0x5e, 0x1c, 0x09, 0x00, 0x07, 0x23, 0x10, 0x63, 0x17, 0xfa,
+    0x04, 0xfa, 0x04, 0x06, 0x02, 0xc6, 0x80, 0x80, 0xc2, 0x5a, 0x42, 0x0c, 0x3e, 0x5c, 0xbe, 0x0d, 0x09, 0x00, 0x07, 0xc3, 0x5a, 0x43, 0x0c, 0x7a,
+    0x01, 0x7a, 0x01, 0x06, 0x02, 0xc5, 0x7f, 0x80, 0x48, 0x5a, 0xe2, 0x0d, 0xc5, 0x5b, 0x5e, 0x0f, 0x09, 0x00, 0x07, 0x4a, 0x5a, 0xe3, 0x0d, 0x7a,
+    0x01, 0x7a, 0x01, 0x06, 0x02, 0xc5, 0x80, 0x80, 0x02, 0x59, 0xfb, 0x0e, 0x7e, 0x5a, 0x78, 0x10, 0x09, 0x00, 0x07, 0x03, 0x59, 0xfd, 0x0e, 0x7a,
+    0x01, 0x7a, 0x01, 0x06, 0x02, 0xc5, 0x80, 0x80, 0x55, 0x57, 0x3b, 0x0f, 0xd1, 0x58, 0xb8, 0x10, 0x09, 0x00, 0x07, 0x56, 0x57, 0x3d, 0x0f, 0x7a,
+    0x01, 0x7a, 0x01, 0x06, 0x02, 0xc4, 0x7f, 0x80, 0xcb, 0x55, 0x85, 0x0e, 0x48, 0x57, 0x01, 0x10, 0x3a, 0x00, 0x01, 0x46, 0x57, 0x43, 0x0f, 0x03,
+    0x46, 0x57, 0xaa, 0x0f, 0xf3, 0x56, 0x00, 0x10, 0x8a, 0x56, 0x00, 0x10, 0x03, 0x23, 0x56, 0x00, 0x10, 0xcd, 0x55, 0xad, 0x0f, 0xcd, 0x55, 0x43,
+    0x0f, 0x03, 0xcd, 0x55, 0xdd, 0x0e, 0x20, 0x56, 0x86, 0x0e, 0x8a, 0x56, 0x86, 0x0e, 0x03, 0xf0, 0x56, 0x8a, 0x0e, 0x46, 0x57, 0xdd, 0x0e, 0x46,
+    0x57, 0x43, 0x0f, 0x04, 0x06, 0x02, 0xc5, 0x80, 0x80, 0xe2, 0x54, 0x1b, 0x0d, 0x5e, 0x56, 0x98, 0x0e, 0x09, 0x00, 0x07, 0xe3, 0x54, 0x1d, 0x0d,
+    0x7a, 0x01, 0x7a, 0x01, 0x06, 0x02, 0xc4, 0x7f, 0x80, 0xe2, 0x54, 0x68, 0x0b, 0x5e, 0x56, 0xe5, 0x0c, 0x3a, 0x00, 0x01, 0x5d, 0x56, 0x26, 0x0c,
+    0x03, 0x5d, 0x56, 0x8d, 0x0c, 0x0a, 0x56, 0xe3, 0x0c, 0xa0, 0x55, 0xe3, 0x0c, 0x03, 0x3a, 0x55, 0xe3, 0x0c, 0xe3, 0x54, 0x90, 0x0c, 0xe3, 0x54,
+    0x26, 0x0c, 0x03, 0xe3, 0x54, 0xc0, 0x0b, 0x36, 0x55, 0x6a, 0x0b, 0xa0, 0x55, 0x6a, 0x0b, 0x03, 0x06, 0x56, 0x6d, 0x0b, 0x5d, 0x56, 0xc0, 0x0b,
+    0x5d, 0x56, 0x26, 0x0c, 0x04, 0x06, 0x02, 0xc5, 0x80, 0x7f, 0xcb, 0x55, 0xff, 0x09, 0x48, 0x57, 0x7b, 0x0b, 0x09, 0x00, 0x07, 0xcd, 0x55, 0x00,
+    0x0a, 0x7a, 0x01, 0x7a, 0x01, 0x06, 0x02, 0xc4, 0x7f, 0x80, 0x55, 0x57, 0x48, 0x09, 0xd1, 0x58, 0xc5, 0x0a, 0x3a, 0x00, 0x01, 0xd0, 0x58, 0x06,
+    0x0a, 0x03, 0xd0, 0x58, 0x6d, 0x0a, 0x7d, 0x58, 0xc3, 0x0a, 0x13, 0x58, 0xc3, 0x0a, 0x03, 0xad, 0x57, 0xc3, 0x0a, 0x56, 0x57, 0x70, 0x0a, 0x56,
+    0x57, 0x06, 0x0a, 0x03, 0x56, 0x57, 0xa0, 0x09, 0xaa, 0x57, 0x4a, 0x09, 0x13, 0x58, 0x4a, 0x09, 0x03, 0x7a, 0x58, 0x4d, 0x09, 0xd0, 0x58, 0xa0,
+    0x09, 0xd0, 0x58, 0x06, 0x0a, 0x04, 0x06, 0x02, 0xc5, 0x80, 0x7f, 0x02, 0x59, 0x88, 0x09, 0x7e, 0x5a, 0x05, 0x0b, 0x09, 0x00, 0x07, 0x03, 0x59,
+    0x8a, 0x09, 0x7a, 0x01, 0x7a, 0x01, 0x06, 0x02, 0xc5, 0x7f, 0x80, 0x48, 0x5a, 0xa2, 0x0a, 0xc5, 0x5b, 0x1e, 0x0c, 0x09, 0x00, 0x07, 0x4a, 0x5a,
+    0xa3, 0x0a, 0x7a, 0x01, 0x7a, 0x01, 0x06, 0x06, 0xc8, 0x80, 0x80, 0xe2, 0x55, 0x65, 0x0a, 0x21, 0x5b, 0x9e, 0x0f, 0x09, 0x00, 0x07, 0xe3, 0x55,
+    0x66, 0x0a, 0x3d, 0x05, 0x36, 0x05, 0x06, 0x03, 0xc6, 0x80, 0x80, 0x28, 0x33, 0x85, 0x20, 0x1b, 0x36, 0x7b, 0x23, 0x3a, 0x00, 0x01, 0x1a, 0x36,
+    0x00, 0x22, 0x03, 0x1a, 0x36, 0xd0, 0x22, 0x73, 0x35, 0x7a, 0x23, 0xa3, 0x34, 0x7a, 0x23, 0x03, 0xd3, 0x33, 0x7a, 0x23, 0x2a, 0x33, 0xd3, 0x22,
+    0x2a, 0x33, 0x03, 0x22, 0x03, 0x2a, 0x33, 0x33, 0x21, 0xd0, 0x33, 0x8a, 0x20, 0xa0, 0x34, 0x8a, 0x20, 0x03, 0x70, 0x35, 0x86, 0x20, 0x16, 0x36,
+    0x30, 0x21, 0x1a, 0x36, 0x00, 0x22, 0x04, 0x06, 0x03, 0xc7, 0x80, 0x80, 0x15, 0x32, 0x15, 0x23, 0x0b, 0x35, 0x0b, 0x26, 0x09, 0x00, 0x07, 0x16,
+    0x32, 0x16, 0x23, 0xf3, 0x02, 0xf3, 0x02, 0x06, 0x03, 0xc6, 0x80, 0x80, 0x88, 0x2f, 0x25, 0x24, 0x7b, 0x32, 0x1b, 0x27, 0x3a, 0x00, 0x01, 0x7a,
+    0x32, 0xa0, 0x25, 0x03, 0x7a, 0x32, 0x70, 0x26, 0xd3, 0x31, 0x1a, 0x27, 0x03, 0x31, 0x1a, 0x27, 0x03, 0x33, 0x30, 0x1a, 0x27, 0x8a, 0x2f, 0x73,
+    0x26, 0x8a, 0x2f, 0xa3, 0x25, 0x03, 0x8a, 0x2f, 0xd3, 0x24, 0x30, 0x30, 0x2a, 0x24, 0x00, 0x31, 0x2a, 0x24, 0x03, 0xd0, 0x31, 0x26, 0x24, 0x76,
+    0x32, 0xd0, 0x24, 0x7a, 0x32, 0xa0, 0x25, 0x04, 0x06, 0x03, 0xc7, 0x80, 0x80, 0xf5, 0x2c, 0x15, 0x23, 0xeb, 0x2f, 0x0b, 0x26, 0x09, 0x00, 0x07,
+    0xf6, 0x2c, 0x16, 0x23, 0xf3, 0x02, 0xf3, 0x02, 0x06, 0x03, 0xc6, 0x80, 0x80, 0xe8, 0x2b, 0x85, 0x20, 0xdb, 0x2e, 0x7b, 0x23, 0x3a, 0x00, 0x01,
+    0xda, 0x2e, 0x00, 0x22, 0x03, 0xda, 0x2e, 0xd0, 0x22, 0x33, 0x2e, 0x7a, 0x23, 0x63, 0x2d, 0x7a, 0x23, 0x03, 0x93, 0x2c, 0x7a, 0x23, 0xea, 0x2b,
+    0xd3, 0x22, 0xea, 0x2b, 0x03, 0x22, 0x03, 0xea, 0x2b, 0x33, 0x21, 0x90, 0x2c, 0x8a, 0x20, 0x60, 0x2d, 0x8a, 0x20, 0x03, 0x30, 0x2e, 0x86, 0x20,
+    0xd6, 0x2e, 0x30, 0x21, 0xda, 0x2e, 0x00, 0x22, 0x04, 0x06, 0x03, 0xc7, 0x80, 0x7f, 0xf5, 0x2c, 0xf5, 0x1d, 0xeb, 0x2f, 0xeb, 0x20, 0x09, 0x00,
+    0x07, 0xf6, 0x2c, 0xf6, 0x1d, 0xf3, 0x02, 0xf3, 0x02, 0x06, 0x03, 0xc6, 0x80, 0x80, 0x88, 0x2f, 0xe5, 0x1c, 0x7b, 0x32, 0xdb, 0x1f, 0x3a, 0x00,
+    0x01, 0x7a, 0x32, 0x60, 0x1e, 0x03, 0x7a, 0x32, 0x30, 0x1f, 0xd3, 0x31, 0xda, 0x1f, 0x03, 0x31, 0xda, 0x1f, 0x03, 0x33, 0x30, 0xda, 0x1f, 0x8a,
+    0x2f, 0x33, 0x1f, 0x8a, 0x2f, 0x63, 0x1e, 0x03, 0x8a, 0x2f, 0x93, 0x1d, 0x30, 0x30, 0xea, 0x1c, 0x00, 0x31, 0xea, 0x1c, 0x03, 0xd0, 0x31, 0xe6,
+    0x1c, 0x76, 0x32, 0x90, 0x1d, 0x7a, 0x32, 0x60, 0x1e, 0x04, 0x06, 0x03, 0xc7, 0x80, 0x7f, 0x15, 0x32, 0xf5, 0x1d, 0x0b, 0x35, 0xeb, 0x20, 0x09,
+    0x00, 0x07, 0x16, 0x32, 0xf6, 0x1d, 0xf3, 0x02, 0xf3, 0x02, 0x06, 0x04, 0xc8, 0x7f, 0x7f, 0x25, 0x2d, 0x25, 0x1e, 0xd8, 0x34, 0xd8, 0x25, 0x09,
+    0x00, 0x07, 0x26, 0x2d, 0x26, 0x1e, 0xb0, 0x07, 0xb0, 0x07, 0x06, 0x06, 0xc7, 0x80, 0x80, 0xc2, 0x4e, 0x62, 0x2e, 0xbe, 0x52, 0x5e, 0x32, 0x09,
+    0x00, 0x07, 0xc3, 0x4e, 0x63, 0x2e, 0xfa, 0x03, 0xfa, 0x03, 0x06, 0x06, 0xc7, 0x7f, 0x7f, 0xe8, 0x4b, 0x4f, 0x32, 0xe5, 0x4f, 0x4b, 0x36, 0x09,
+    0x00, 0x07, 0xea, 0x4b, 0x50, 0x32, 0xfa, 0x03, 0xfa, 0x03, 0x06, 0x06, 0xc7, 0x80, 0x7f, 0x4b, 0x47, 0xcf, 0x30, 0x48, 0x4b, 0xcb, 0x34, 0x09,
+    0x00, 0x07, 0x4d, 0x47, 0xd0, 0x30, 0xfa, 0x03, 0xfa, 0x03, 0x06, 0x06, 0xc7, 0x80, 0x80, 0x4b, 0x47, 0xf5, 0x2b, 0x48, 0x4b, 0xf1, 0x2f, 0x09,
+    0x00, 0x07, 0x4d, 0x47, 0xf6, 0x2b, 0xfa, 0x03, 0xfa, 0x03, 0x06, 0x06, 0xc7, 0x7f, 0x80, 0xe8, 0x4b, 0x75, 0x2a, 0xe5, 0x4f, 0x71, 0x2e, 0x09,
+    0x00, 0x07, 0xea, 0x4b, 0x76, 0x2a, 0xfa, 0x03, 0xfa, 0x03, 0x06, 0x02, 0xc8, 0x80, 0x80, 0x3b, 0x49, 0xfb, 0x2c, 0x05, 0x50, 0xbe, 0x33, 0x09,
+    0x00, 0x07, 0x3d, 0x49, 0xfd, 0x2c, 0xc6, 0x06, 0xc0, 0x06, 0x06, 0x02, 0xc5, 0x80, 0x80, 0x7b, 0x57, 0x9b, 0x2e, 0x45, 0x59, 0x65, 0x30, 0x09,
+    0x00, 0x07, 0x7d, 0x57, 0x9d, 0x2e, 0xc6, 0x01, 0xc6, 0x01, 0x06, 0x02, 0xc5, 0x7f, 0x80, 0x95, 0x56, 0x18, 0x31, 0x5e, 0x58, 0xe1, 0x32, 0x3a,
+    0x00, 0x01, 0x5d, 0x58, 0xfd, 0x31, 0x03, 0x5d, 0x58, 0x7a, 0x32, 0xf6, 0x57, 0xe0, 0x32, 0x7a, 0x57, 0xe0, 0x32, 0x03, 0xfd, 0x56, 0xe0, 0x32,
+    0x96, 0x56, 0x7a, 0x32, 0x96, 0x56, 0xfd, 0x31, 0x03, 0x96, 0x56, 0x80, 0x31, 0xfd, 0x56, 0x1a, 0x31, 0x7a, 0x57, 0x1a, 0x31, 0x03, 0xf6, 0x57,
+    0x1a, 0x31, 0x5a, 0x58, 0x80, 0x31, 0x5d, 0x58, 0xfd, 0x31, 0x04, 0x06, 0x02, 0xc6, 0x80, 0x80, 0x48, 0x54, 0x6b, 0x32, 0x11, 0x56, 0x35, 0x34,
+    0x09, 0x00, 0x07, 0x4a, 0x54, 0x6d, 0x32, 0xc6, 0x01, 0xc6, 0x01, 0x06, 0x02, 0xc6, 0x80, 0x80, 0xab, 0x51, 0xf5, 0x31, 0x75, 0x53, 0xbe, 0x33,
+    0x09, 0x00, 0x07, 0xad, 0x51, 0xf6, 0x31, 0xc6, 0x01, 0xc6, 0x01, 0x06, 0x02, 0xc6, 0x80, 0x7f, 0xf8, 0x4f, 0xef, 0x2f, 0xc1, 0x51, 0xb8, 0x31,
+    0x09, 0x00, 0x07, 0xfa, 0x4f, 0xf0, 0x2f, 0xc6, 0x01, 0xc6, 0x01, 0x06, 0x02, 0xc6, 0x80, 0x80, 0xf8, 0x4f, 0x48, 0x2d, 0xc1, 0x51, 0x11, 0x2f,
+    0x09, 0x00, 0x07, 0xfa, 0x4f, 0x4a, 0x2d, 0xc6, 0x01, 0xc6, 0x01, 0x06, 0x02, 0xc4, 0x80, 0x80, 0xab, 0x51, 0x3f, 0x2b, 0x75, 0x53, 0x0b, 0x2d,
+    0x3a, 0x00, 0x01, 0x73, 0x53, 0x26, 0x2c, 0x03, 0x73, 0x53, 0xa3, 0x2c, 0x0d, 0x53, 0x0a, 0x2d, 0x90, 0x52, 0x0a, 0x2d, 0x03, 0x13, 0x52, 0x0a,
+    0x2d, 0xad, 0x51, 0xa3, 0x2c, 0xad, 0x51, 0x26, 0x2c, 0x03, 0xad, 0x51, 0xaa, 0x2b, 0x13, 0x52, 0x43, 0x2b, 0x90, 0x52, 0x43, 0x2b, 0x03, 0x0d,
+    0x53, 0x40, 0x2b, 0x73, 0x53, 0xa6, 0x2b, 0x73, 0x53, 0x26, 0x2c, 0x04, 0x06, 0x02, 0xc6, 0x80, 0x80, 0x48, 0x54, 0xcb, 0x2a, 0x11, 0x56, 0x95,
+    0x2c, 0x09, 0x00, 0x07, 0x4a, 0x54, 0xcd, 0x2a, 0xc6, 0x01, 0xc6, 0x01, 0x06, 0x02, 0xc5, 0x80, 0x7f, 0x95, 0x56, 0x1f, 0x2c, 0x5e, 0x58, 0xe8,
+    0x2d, 0x3a, 0x00, 0x01, 0x5d, 0x58, 0x03, 0x2d, 0x03, 0x5d, 0x58, 0x80, 0x2d, 0xf6, 0x57, 0xe6, 0x2d, 0x7a, 0x57, 0xe6, 0x2d, 0x03, 0xfd, 0x56,
+    0xe6, 0x2d, 0x96, 0x56, 0x80, 0x2d, 0x96, 0x56, 0x03, 0x2d, 0x03, 0x96, 0x56, 0x86, 0x2c, 0xfd, 0x56, 0x20, 0x2c, 0x7a, 0x57, 0x20, 0x2c, 0x03,
+    0xf6, 0x57, 0x20, 0x2c, 0x5a, 0x58, 0x83, 0x2c, 0x5d, 0x58, 0x03, 0x2d, 0x04, 0x06, 0x03, 0xc7, 0x80, 0x80, 0xe5, 0x51, 0xe5, 0x2c, 0x1b, 0x57,
+    0x1b, 0x32, 0x09, 0x00, 0x07, 0xe6, 0x51, 0xe6, 0x2c, 0x33, 0x05, 0x33, 0x05, 0x01, 0x03, 0xe0, 0x35, 0xc0, 0x28, 0x04, 0xea, 0x06, 0x06, 0x02,
+    0xc3, 0x80, 0x80, 0x95, 0xff, 0x95, 0xff, 0x6b, 0x00, 0x6b, 0x00, 0x09, 0x00, 0x07, 0x96, 0xff, 0x96, 0xff, 0xd3, 0x00, 0xd3, 0x00, 0x02, 0x06,
+    0x02, 0xc0, 0x80, 0x81, 0x15, 0x35, 0x5f, 0x29, 0xeb, 0x35, 0x38, 0x2a, 0x3a, 0x00, 0x01, 0xea, 0x35, 0xcd, 0x29, 0x03, 0xea, 0x35, 0x06, 0x2a,
+    0xba, 0x35, 0x36, 0x2a, 0x80, 0x35, 0x36, 0x2a, 0x03, 0x46, 0x35, 0x36, 0x2a, 0x16, 0x35, 0x06, 0x2a, 0x16, 0x35, 0xcd, 0x29, 0x03, 0x16, 0x35,
+    0x93, 0x29, 0x46, 0x35, 0x63, 0x29, 0x80, 0x35, 0x63, 0x29, 0x03, 0xba, 0x35, 0x60, 0x29, 0xea, 0x35, 0x90, 0x29, 0xea, 0x35, 0xcd, 0x29, 0x04,
+    0x01, 0x03, 0x8a, 0x34, 0x5a, 0x2a, 0x04, 0xea, 0x06, 0x06, 0x02, 0xc3, 0x80, 0x80, 0x95, 0xff, 0x95, 0xff, 0x6b, 0x00, 0x6b, 0x00, 0x09, 0x00,
+    0x07, 0x96, 0xff, 0x96, 0xff, 0xd3, 0x00, 0xd3, 0x00, 0x02, 0x06, 0x02, 0xbf, 0x80, 0x81, 0x05, 0x33, 0xbb, 0x29, 0xdb, 0x33, 0x95, 0x2a, 0x3a,
+    0x00, 0x01, 0xda, 0x33, 0x2a, 0x2a, 0x03, 0xda, 0x33, 0x63, 0x2a, 0xaa, 0x33, 0x93, 0x2a, 0x70, 0x33, 0x93, 0x2a, 0x03, 0x36, 0x33, 0x93, 0x2a,
+    0x06, 0x33, 0x63, 0x2a, 0x06, 0x33, 0x2a, 0x2a, 0x03, 0x06, 0x33, 0xf0, 0x29, 0x36, 0x33, 0xc0, 0x29, 0x70, 0x33, 0xc0, 0x29, 0x03, 0xaa, 0x33,
+    0xbd, 0x29, 0xda, 0x33, 0xed, 0x29, 0xda, 0x33, 0x2a, 0x2a, 0x04, 0x01, 0x03, 0xba, 0x32, 0x4d, 0x29, 0x04, 0xea, 0x06, 0x06, 0x02, 0xc3, 0x80,
+    0x80, 0x95, 0xff, 0x95, 0xff, 0x6b, 0x00, 0x6b, 0x00, 0x09, 0x00, 0x07, 0x96, 0xff, 0x96, 0xff, 0xd3, 0x00, 0xd3, 0x00, 0x02, 0x06, 0x02, 0xc0,
+    0x7f, 0x81, 0x4f, 0x32, 0xc5, 0x27, 0x25, 0x33, 0x9e, 0x28, 0x3a, 0x00, 0x01, 0x23, 0x33, 0x33, 0x28, 0x03, 0x23, 0x33, 0x6d, 0x28, 0xf3, 0x32,
+    0x9d, 0x28, 0xba, 0x32, 0x9d, 0x28, 0x03, 0x80, 0x32, 0x9d, 0x28, 0x50, 0x32, 0x6d, 0x28, 0x50, 0x32, 0x33, 0x28, 0x03, 0x50, 0x32, 0xfa, 0x27,
+    0x80, 0x32, 0xca, 0x27, 0xba, 0x32, 0xca, 0x27, 0x03, 0xf3, 0x32, 0xc6, 0x27, 0x23, 0x33, 0xf6, 0x27, 0x23, 0x33, 0x33, 0x28, 0x04, 0x01, 0x03,
+    0x70, 0x33, 0x56, 0x27, 0x04, 0xea, 0x06, 0x06, 0x02, 0xc3, 0x80, 0x80, 0x95, 0xff, 0x95, 0xff, 0x6b, 0x00, 0x6b, 0x00, 0x09, 0x00, 0x07, 0x96,
+    0xff, 0x96, 0xff, 0xd3, 0x00, 0xd3, 0x00, 0x02, 0x01, 0x03, 0x8a, 0x34, 0x26, 0x27, 0x04, 0xea, 0x06, 0x06, 0x02, 0xc3, 0x80, 0x80, 0x95, 0xff,
+    0x95, 0xff, 0x6b, 0x00, 0x6b, 0x00, 0x09, 0x00, 0x07, 0x96, 0xff, 0x96, 0xff, 0xd3, 0x00, 0xd3, 0x00, 0x02, 0x01, 0x03, 0x80, 0x35, 0xb3, 0x27,
+    0x04, 0xea, 0x06, 0x06, 0x02, 0xc3, 0x80, 0x80, 0x95, 0xff, 0x95, 0xff, 0x6b, 0x00, 0x6b, 0x00, 0x09, 0x00, 0x07, 0x96, 0xff, 0x96, 0xff, 0xd3,
+    0x00, 0xd3, 0x00, 0x02, 0x06, 0x03, 0xc6, 0x7f, 0x80, 0x08, 0x33, 0x85, 0x27, 0x7b, 0x35, 0xf8, 0x29, 0x3a, 0x00, 0x01, 0x7a, 0x35, 0xc0, 0x28,
+    0x03, 0x7a, 0x35, 0x6d, 0x29, 0xed, 0x34, 0xf6, 0x29, 0x40, 0x34, 0xf6, 0x29, 0x03, 0x93, 0x33, 0xf6, 0x29, 0x0a, 0x33, 0x6a, 0x29, 0x0a, 0x33,
+    0xbd, 0x28, 0x03, 0x0a, 0x33, 0x10, 0x28, 0x96, 0x33, 0x86, 0x27, 0x43, 0x34, 0x86, 0x27, 0x03, 0xed, 0x34, 0x86, 0x27, 0x76, 0x35, 0x13, 0x28,
+    0x7a, 0x35, 0xc0, 0x28, 0x04, 0x06, 0x03, 0xc6, 0x80, 0x7f, 0xd2, 0x14, 0xd2, 0xff, 0xae, 0x16, 0xae, 0x01, 0x09, 0x00, 0x07, 0xd3, 0x14, 0xd3,
+    0xff, 0xda, 0x01, 0xda, 0x01, 0x06, 0x03, 0xc5, 0x80, 0x80, 0xcb, 0x13, 0x4b, 0x02, 0xa8, 0x15, 0x28, 0x04, 0x09, 0x00, 0x07, 0xcd, 0x13, 0x4d,
+    0x02, 0xda, 0x01, 0xda, 0x01, 0x06, 0x03, 0xc6, 0x80, 0x80, 0x52, 0x11, 0x52, 0x03, 0x2e, 0x13, 0x2e, 0x05, 0x09, 0x00, 0x07, 0x53, 0x11, 0x53,
+    0x03, 0xda, 0x01, 0xda, 0x01, 0x06, 0x03, 0xc5, 0x7f, 0x80, 0xd8, 0x0e, 0x4b, 0x02, 0xb5, 0x10, 0x28, 0x04, 0x09, 0x00, 0x07, 0xda, 0x0e, 0x4d,
+    0x02, 0xda, 0x01, 0xda, 0x01, 0x06, 0x03, 0xc6, 0x80, 0x7f, 0xd2, 0x0d, 0xd2, 0xff, 0xae, 0x0f, 0xae, 0x01, 0x09, 0x00, 0x07, 0xd3, 0x0d, 0xd3,
+    0xff, 0xda, 0x01, 0xda, 0x01, 0x06, 0x03, 0xc5, 0x7f, 0x7f, 0xd8, 0x0e, 0x58, 0xfd, 0xb5, 0x10, 0x35, 0xff, 0x09, 0x00, 0x07, 0xda, 0x0e, 0x5a,
+    0xfd, 0xda, 0x01, 0xda, 0x01, 0x06, 0x03, 0xc6, 0x80, 0x80, 0x52, 0x11, 0x52, 0xfc, 0x2e, 0x13, 0x2e, 0xfe, 0x09, 0x00, 0x07, 0x53, 0x11, 0x53,
+    0xfc, 0xda, 0x01, 0xda, 0x01, 0x06, 0x03, 0xc5, 0x80, 0x7f, 0xcb, 0x13, 0x58, 0xfd, 0xa8, 0x15, 0x35, 0xff, 0x09, 0x00, 0x07, 0xcd, 0x13, 0x5a,
+    0xfd, 0xda, 0x01, 0xda, 0x01, 0x06, 0x06, 0xc7, 0x7f, 0x7f, 0xd2, 0x0f, 0x55, 0xfe, 0xab, 0x14, 0x28, 0x03, 0x09, 0x00, 0x07, 0xd3, 0x0f, 0x56,
+    0xfe, 0xd6, 0x04, 0xd0, 0x04, 0x06, 0x00, 0xc5, 0x80, 0x80, 0x62, 0x5e, 0xe2, 0x3a, 0x9e, 0x5f, 0x1e, 0x3c, 0x09, 0x00, 0x07, 0x63, 0x5e, 0xe3,
+    0x3a, 0x3a, 0x01, 0x3a, 0x01, 0x06, 0x00, 0xc5, 0x7f, 0x7f, 0x58, 0x5d, 0x4f, 0x3c, 0x95, 0x5e, 0x8b, 0x3d, 0x09, 0x00, 0x07, 0x5a, 0x5d, 0x50,
+    0x3c, 0x3a, 0x01, 0x3a, 0x01, 0x06, 0x00, 0xc5, 0x80, 0x80, 0xab, 0x5b, 0xc5, 0x3b, 0xe8, 0x5c, 0x01, 0x3d, 0x09, 0x00, 0x07, 0xad, 0x5b, 0xc6,
+    0x3b, 0x3a, 0x01, 0x3a, 0x01, 0x06, 0x00, 0xc4, 0x7f, 0x80, 0xab, 0x5b, 0xff, 0x39, 0xe8, 0x5c, 0x3b, 0x3b, 0x3a, 0x00, 0x01, 0xe6, 0x5c, 0x9d,
+    0x3a, 0x03, 0xe6, 0x5c, 0xf3, 0x3a, 0xa0, 0x5c, 0x3a, 0x3b, 0x4a, 0x5c, 0x3a, 0x3b, 0x03, 0xf3, 0x5b, 0x3a, 0x3b, 0xad, 0x5b, 0xf3, 0x3a, 0xad,
+    0x5b, 0x9d, 0x3a, 0x03, 0xad, 0x5b, 0x46, 0x3a, 0xf3, 0x5b, 0x00, 0x3a, 0x4a, 0x5c, 0x00, 0x3a, 0x03, 0xa0, 0x5c, 0x03, 0x3a, 0xe6, 0x5c, 0x4a,
+    0x3a, 0xe6, 0x5c, 0x9d, 0x3a, 0x04, 0x06, 0x00, 0xc5, 0x7f, 0x80, 0x58, 0x5d, 0x75, 0x39, 0x95, 0x5e, 0xb1, 0x3a, 0x09, 0x00, 0x07, 0x5a, 0x5d,
+    0x76, 0x39, 0x3a, 0x01, 0x3a, 0x01, 0x06, 0x03, 0xc4, 0x80, 0x80, 0x78, 0x5c, 0x75, 0x3a, 0x8b, 0x5e, 0x8b, 0x3c, 0x3a, 0x00, 0x01, 0x8a, 0x5e,
+    0x80, 0x3b, 0x03, 0x8a, 0x5e, 0x13, 0x3c, 0x13, 0x5e, 0x8a, 0x3c, 0x83, 0x5d, 0x8a, 0x3c, 0x03, 0xf3, 0x5c, 0x8a, 0x3c, 0x7a, 0x5c, 0x13, 0x3c,
+    0x7a, 0x5c, 0x83, 0x3b, 0x03, 0x7a, 0x5c, 0xf0, 0x3a, 0xf0, 0x5c, 0x7a, 0x3a, 0x80, 0x5d, 0x7a, 0x3a, 0x03, 0x10, 0x5e, 0x76, 0x3a, 0x86, 0x5e,
+    0xed, 0x3a, 0x8a, 0x5e, 0x80, 0x3b, 0x04, 0x06, 0x04, 0xc6, 0x80, 0x80, 0xa2, 0x09, 0xc2, 0x3e, 0x5e, 0x0b, 0x7e, 0x40, 0x09, 0x00, 0x07, 0xa3,
+    0x09, 0xc3, 0x3e, 0xba, 0x01, 0xba, 0x01, 0x06, 0x04, 0xc5, 0x7f, 0x80, 0xc2, 0x08, 0x45, 0x40, 0x7e, 0x0a, 0x01, 0x42, 0x3a, 0x00, 0x01, 0x7d,
+    0x0a, 0x23, 0x41, 0x03, 0x7d, 0x0a, 0x9d, 0x41, 0x1a, 0x0a, 0x00, 0x42, 0xa0, 0x09, 0x00, 0x42, 0x03, 0x26, 0x09, 0x00, 0x42, 0xc3, 0x08, 0x9d,
+    0x41, 0xc3, 0x08, 0x23, 0x41, 0x03, 0xc3, 0x08, 0xaa, 0x40, 0x26, 0x09, 0x46, 0x40, 0xa0, 0x09, 0x46, 0x40, 0x03, 0x1a, 0x0a, 0x4a, 0x40, 0x7d,
+    0x0a, 0xaa, 0x40, 0x7d, 0x0a, 0x23, 0x41, 0x04, 0x06, 0x04, 0xc5, 0x7f, 0x80, 0x02, 0x07, 0x45, 0x40, 0xbe, 0x08, 0x01, 0x42, 0x3a, 0x00, 0x01,
+    0xbd, 0x08, 0x23, 0x41, 0x03, 0xbd, 0x08, 0x9d, 0x41, 0x5a, 0x08, 0x00, 0x42, 0xe0, 0x07, 0x00, 0x42, 0x03, 0x66, 0x07, 0x00, 0x42, 0x03, 0x07,
+    0x9d, 0x41, 0x03, 0x07, 0x23, 0x41, 0x03, 0x03, 0x07, 0xaa, 0x40, 0x66, 0x07, 0x46, 0x40, 0xe0, 0x07, 0x46, 0x40, 0x03, 0x5a, 0x08, 0x4a, 0x40,
+    0xbd, 0x08, 0xaa, 0x40, 0xbd, 0x08, 0x23, 0x41, 0x04, 0x06, 0x04, 0xc6, 0x80, 0x80, 0x22, 0x06, 0xc2, 0x3e, 0xde, 0x07, 0x7e, 0x40, 0x09, 0x00,
+    0x07, 0x23, 0x06, 0xc3, 0x3e, 0xba, 0x01, 0xba, 0x01, 0x06, 0x04, 0xc6, 0x7f, 0x7f, 0x02, 0x07, 0x3f, 0x3d, 0xbe, 0x08, 0xfb, 0x3e, 0x09, 0x00,
+    0x07, 0x03, 0x07, 0x40, 0x3d, 0xba, 0x01, 0xba, 0x01, 0x06, 0x04, 0xc6, 0x80, 0x7f, 0xc2, 0x08, 0x3f, 0x3d, 0x7e, 0x0a, 0xfb, 0x3e, 0x09, 0x00,
+    0x07, 0xc3, 0x08, 0x40, 0x3d, 0xba, 0x01, 0xba, 0x01, 0x06, 0x06, 0xc7, 0x7f, 0x7f, 0x05, 0x07, 0xe8, 0x3d, 0x78, 0x0a, 0x55, 0x41, 0x09, 0x00,
+    0x07, 0x06, 0x07, 0xea, 0x3d, 0x70, 0x03, 0x6a, 0x03, 0x06, 0x00, 0xc3, 0x80, 0x80, 0xef, 0x28, 0xcf, 0x0f, 0xd1, 0x29, 0xb1, 0x10, 0x3a, 0x00,
+    0x01, 0xd0, 0x29, 0x40, 0x10, 0x03, 0xd0, 0x29, 0x7d, 0x10, 0x9d, 0x29, 0xb0, 0x10, 0x60, 0x29, 0xb0, 0x10, 0x03, 0x23, 0x29, 0xb0, 0x10, 0xf0,
+    0x28, 0x7d, 0x10, 0xf0, 0x28, 0x40, 0x10, 0x03, 0xf0, 0x28, 0x03, 0x10, 0x23, 0x29, 0xd0, 0x0f, 0x60, 0x29, 0xd0, 0x0f, 0x03, 0x9d, 0x29, 0xd0,
+    0x0f, 0xd0, 0x29, 0x03, 0x10, 0xd0, 0x29, 0x40, 0x10, 0x04, 0x06, 0x00, 0xc3, 0x80, 0x7f, 0x98, 0x28, 0xd5, 0x10, 0x7b, 0x29, 0xb8, 0x11, 0x09,
+    0x00, 0x07, 0x9a, 0x28, 0xd6, 0x10, 0xe0, 0x00, 0xe0, 0x00, 0x06, 0x00, 0xc3, 0x80, 0x80, 0xb8, 0x27, 0x78, 0x11, 0x9b, 0x28, 0x5b, 0x12, 0x09,
+    0x00, 0x07, 0xba, 0x27, 0x7a, 0x11, 0xe0, 0x00, 0xe0, 0x00, 0x06, 0x00, 0xc2, 0x7f, 0x80, 0xa5, 0x26, 0x78, 0x11, 0x88, 0x27, 0x5b, 0x12, 0x3a,
+    0x00, 0x01, 0x86, 0x27, 0xea, 0x11, 0x03, 0x86, 0x27, 0x26, 0x12, 0x53, 0x27, 0x5a, 0x12, 0x16, 0x27, 0x5a, 0x12, 0x03, 0xda, 0x26, 0x5a, 0x12,
+    0xa6, 0x26, 0x26, 0x12, 0xa6, 0x26, 0xea, 0x11, 0x03, 0xa6, 0x26, 0xad, 0x11, 0xda, 0x26, 0x7a, 0x11, 0x16, 0x27, 0x7a, 0x11, 0x03, 0x53, 0x27,
+    0x7a, 0x11, 0x86, 0x27, 0xad, 0x11, 0x86, 0x27, 0xea, 0x11, 0x04, 0x06, 0x00, 0xc2, 0x7f, 0x7f, 0xc5, 0x25, 0xd5, 0x10, 0xa8, 0x26, 0xb8, 0x11,
+    0x3a, 0x00, 0x01, 0xa6, 0x26, 0x46, 0x11, 0x03, 0xa6, 0x26, 0x83, 0x11, 0x73, 0x26, 0xb6, 0x11, 0x36, 0x26, 0xb6, 0x11, 0x03, 0xfa, 0x25, 0xb6,
+    0x11, 0xc6, 0x25, 0x83, 0x11, 0xc6, 0x25, 0x46, 0x11, 0x03, 0xc6, 0x25, 0x0a, 0x11, 0xfa, 0x25, 0xd6, 0x10, 0x36, 0x26, 0xd6, 0x10, 0x03, 0x73,
+    0x26, 0xd6, 0x10, 0xa6, 0x26, 0x0a, 0x11, 0xa6, 0x26, 0x46, 0x11, 0x04, 0x06, 0x00, 0xc3, 0x80, 0x80, 0x6f, 0x25, 0xcf, 0x0f, 0x51, 0x26, 0xb1,
+    0x10, 0x3a, 0x00, 0x01, 0x50, 0x26, 0x40, 0x10, 0x03, 0x50, 0x26, 0x7d, 0x10, 0x1d, 0x26, 0xb0, 0x10, 0xe0, 0x25, 0xb0, 0x10, 0x03, 0xa3, 0x25,
+    0xb0, 0x10, 0x70, 0x25, 0x7d, 0x10, 0x70, 0x25, 0x40, 0x10, 0x03, 0x70, 0x25, 0x03, 0x10, 0xa3, 0x25, 0xd0, 0x0f, 0xe0, 0x25, 0xd0, 0x0f, 0x03,
+    0x1d, 0x26, 0xd0, 0x0f, 0x50, 0x26, 0x03, 0x10, 0x50, 0x26, 0x40, 0x10, 0x04, 0x01, 0x03, 0x36, 0x26, 0x3b, 0x0f, 0x04, 0xea, 0x06, 0x06, 0x00,
+    0xc3, 0x80, 0x80, 0x90, 0xff, 0x8d, 0xff, 0x70, 0x00, 0x73, 0x00, 0x09, 0x00, 0x07, 0x92, 0xff, 0x8e, 0xff, 0xdd, 0x00, 0xe3, 0x00, 0x02, 0x01,
+    0x03, 0x16, 0x27, 0x98, 0x0e, 0x04, 0xea, 0x06, 0x06, 0x00, 0xc3, 0x80, 0x80, 0x90, 0xff, 0x8d, 0xff, 0x70, 0x00, 0x73, 0x00, 0x09, 0x00, 0x07,
+    0x92, 0xff, 0x8e, 0xff, 0xdd, 0x00, 0xe3, 0x00, 0x02, 0x06, 0x00, 0xc3, 0x7f, 0x7f, 0xb7, 0x27, 0x25, 0x0e, 0x9d, 0x28, 0x08, 0x0f, 0x09, 0x00,
+    0x07, 0xb8, 0x27, 0x26, 0x0e, 0xe3, 0x00, 0xe0, 0x00, 0x01, 0x03, 0x08, 0x29, 0x38, 0x0f, 0x04, 0x11, 0x03, 0x06, 0x00, 0xc3, 0x80, 0x80, 0x8d,
+    0xff, 0x90, 0xff, 0x73, 0x00, 0x70, 0x00, 0x09, 0x00, 0x07, 0x8e, 0xff, 0x92, 0xff, 0xe3, 0x00, 0xdd, 0x00, 0x02, 0x06, 0x03, 0xc7, 0x80, 0x80,
+    0x35, 0x26, 0xd5, 0x0e, 0x0b, 0x29, 0xab, 0x11, 0x09, 0x00, 0x07, 0x36, 0x26, 0xd6, 0x0e, 0xd3, 0x02, 0xd3, 0x02, 0x01, 0x03, 0xa0, 0x3b, 0xe0,
+    0x2c, 0x04, 0xea, 0x06, 0x06, 0x06, 0xbf, 0x80, 0x80, 0xb8, 0xff, 0xb8, 0xff, 0x48, 0x00, 0x48, 0x00, 0x09, 0x00, 0x07, 0xba, 0xff, 0xba, 0xff,
+    0x8d, 0x00, 0x8d, 0x00, 0x02, 0x06, 0x06, 0xc0, 0x7f, 0x7f, 0x1f, 0x3b, 0x55, 0x2d, 0xae, 0x3b, 0xe5, 0x2d, 0x3a, 0x00, 0x01, 0xad, 0x3b, 0x9d,
+    0x2d, 0x03, 0xad, 0x3b, 0xc3, 0x2d, 0x8d, 0x3b, 0xe3, 0x2d, 0x66, 0x3b, 0xe3, 0x2d, 0x03, 0x40, 0x3b, 0xe3, 0x2d, 0x20, 0x3b, 0xc3, 0x2d, 0x20,
+    0x3b, 0x9d, 0x2d, 0x03, 0x20, 0x3b, 0x76, 0x2d, 0x40, 0x3b, 0x56, 0x2d, 0x66, 0x3b, 0x56, 0x2d, 0x03, 0x90, 0x3b, 0x5a, 0x2d, 0xad, 0x3b, 0x76,
+    0x2d, 0xad, 0x3b, 0x9d, 0x2d, 0x04, 0x01, 0x03, 0xd0, 0x3a, 0x20, 0x2e, 0x04, 0xea, 0x06, 0x06, 0x06, 0xbf, 0x80, 0x80, 0xb8, 0xff, 0xb8, 0xff,
+    0x48, 0x00, 0x48, 0x00, 0x09, 0x00, 0x07, 0xba, 0xff, 0xba, 0xff, 0x8d, 0x00, 0x8d, 0x00, 0x02, 0x01, 0x03, 0x0d, 0x3a, 0x3d, 0x2e, 0x04, 0xea,
+    0x06, 0x06, 0x06, 0xbf, 0x80, 0x80, 0xb8, 0xff, 0xb8, 0xff, 0x48, 0x00, 0x48, 0x00, 0x09, 0x00, 0x07, 0xba, 0xff, 0xba, 0xff, 0x8d, 0x00, 0x8d,
+    0x00, 0x02, 0x01, 0x03, 0x5a, 0x39, 0xea, 0x2d, 0x04, 0xea, 0x06, 0x06, 0x06, 0xbf, 0x80, 0x80, 0xb8, 0xff, 0xb8, 0xff, 0x48, 0x00, 0x48, 0x00,
+    0x09, 0x00, 0x07, 0xba, 0xff, 0xba, 0xff, 0x8d, 0x00, 0x8d, 0x00, 0x02, 0x01, 0x03, 0xed, 0x38, 0x43, 0x2d, 0x04, 0xea, 0x06, 0x06, 0x06, 0xbf,
+    0x80, 0x80, 0xb8, 0xff, 0xb8, 0xff, 0x48, 0x00, 0x48, 0x00, 0x09, 0x00, 0x07, 0xba, 0xff, 0xba, 0xff, 0x8d, 0x00, 0x8d, 0x00, 0x02, 0x01, 0x03,
+    0xed, 0x38, 0x7d, 0x2c, 0x04, 0xea, 0x06, 0x06, 0x06, 0xbf, 0x80, 0x80, 0xb8, 0xff, 0xb8, 0xff, 0x48, 0x00, 0x48, 0x00, 0x09, 0x00, 0x07, 0xba,
+    0xff, 0xba, 0xff, 0x8d, 0x00, 0x8d, 0x00, 0x02, 0x01, 0x03, 0x5a, 0x39, 0xd6, 0x2b, 0x04, 0xea, 0x06, 0x06, 0x06, 0xbf, 0x80, 0x80, 0xb8, 0xff,
+    0xb8, 0xff, 0x48, 0x00, 0x48, 0x00, 0x09, 0x00, 0x07, 0xba, 0xff, 0xba, 0xff, 0x8d, 0x00, 0x8d, 0x00, 0x02, 0x01, 0x03, 0x0d, 0x3a, 0x83, 0x2b,
+    0x04, 0xea, 0x06, 0x06, 0x06, 0xbf, 0x80, 0x80, 0xb8, 0xff, 0xb8, 0xff, 0x48, 0x00, 0x48, 0x00, 0x09, 0x00, 0x07, 0xba, 0xff, 0xba, 0xff, 0x8d,
+    0x00, 0x8d, 0x00, 0x02, 0x01, 0x03, 0xd0, 0x3a, 0xa0, 0x2b, 0x04, 0xea, 0x06, 0x06, 0x06, 0xbf, 0x80, 0x80, 0xb8, 0xff, 0xb8, 0xff, 0x48, 0x00,
+    0x48, 0x00, 0x09, 0x00, 0x07, 0xba, 0xff, 0xba, 0xff, 0x8d, 0x00, 0x8d, 0x00, 0x02, 0x01, 0x03, 0x66, 0x3b, 0x23, 0x2c, 0x04, 0xea, 0x06, 0x06,
+    0x06, 0xbf, 0x80, 0x80, 0xb8, 0xff, 0xb8, 0xff, 0x48, 0x00, 0x48, 0x00, 0x09, 0x00, 0x07, 0xba, 0xff, 0xba, 0xff, 0x8d, 0x00, 0x8d, 0x00, 0x02,
+    0x01, 0x03, 0x3e, 0x3a, 0xde, 0x2c, 0x04, 0xe0, 0x06, 0x06, 0x03, 0xc6, 0x80, 0x80, 0x07, 0xff, 0x0a, 0xff, 0xf9, 0x00, 0xf6, 0x00, 0x09, 0x00,
+    0x07, 0x08, 0xff, 0x0b, 0xff, 0xf0, 0x01, 0xea, 0x01, 0x02, 0x06, 0x04, 0xc7, 0x80, 0x7f, 0xdb, 0x10, 0x1f, 0x2d, 0x28, 0x14, 0x65, 0x30, 0x09,
+    0x00, 0x07, 0xdd, 0x10, 0x20, 0x2d, 0x4a, 0x03, 0x43, 0x03, 0x06, 0x04, 0xc7, 0x7f, 0x80, 0xdf, 0x0e, 0xdb, 0x2f, 0x2b, 0x12, 0x21, 0x33, 0x09,
+    0x00, 0x07, 0xe0, 0x0e, 0xdd, 0x2f, 0x4a, 0x03, 0x43, 0x03, 0x06, 0x04, 0xc7, 0x7f, 0x7f, 0xa8, 0x0b, 0xcf, 0x2e, 0xf5, 0x0e, 0x15, 0x32, 0x09,
+    0x00, 0x07, 0xaa, 0x0b, 0xd0, 0x2e, 0x4a, 0x03, 0x43, 0x03, 0x06, 0x04, 0xc7, 0x7f, 0x7f, 0xa8, 0x0b, 0x6f, 0x2b, 0xf5, 0x0e, 0xb5, 0x2e, 0x09,
+    0x00, 0x07, 0xaa, 0x0b, 0x70, 0x2b, 0x4a, 0x03, 0x43, 0x03, 0x06, 0x04, 0xc7, 0x7f, 0x7f, 0xdf, 0x0e, 0x62, 0x2a, 0x2b, 0x12, 0xa8, 0x2d, 0x09,
+    0x00, 0x07, 0xe0, 0x0e, 0x63, 0x2a, 0x4a, 0x03, 0x43, 0x03, 0x06, 0x03, 0xc7, 0x80, 0x80, 0xd5, 0x0c, 0xf5, 0x2b, 0x6b, 0x12, 0x8b, 0x31, 0x09,
+    0x00, 0x07, 0xd6, 0x0c, 0xf6, 0x2b, 0x93, 0x05, 0x93, 0x05, 0x06, 0x04, 0xc6, 0x80, 0x80, 0x40, 0x53, 0xc3, 0x3a, 0xc0, 0x55, 0x3d, 0x3d, 0x09,
+    0x00, 0x07, 0x42, 0x53, 0xc5, 0x3a, 0x7d, 0x02, 0x76, 0x02, 0x06, 0x04, 0xc6, 0x80, 0x80, 0xb3, 0x51, 0xfd, 0x3d, 0x33, 0x54, 0x76, 0x40, 0x09,
+    0x00, 0x07, 0xb5, 0x51, 0xfe, 0x3d, 0x7d, 0x02, 0x76, 0x02, 0x06, 0x04, 0xc6, 0x80, 0x7f, 0x33, 0x4e, 0xca, 0x3e, 0xb3, 0x50, 0x43, 0x41, 0x09,
+    0x00, 0x07, 0x35, 0x4e, 0xcb, 0x3e, 0x7d, 0x02, 0x76, 0x02, 0x06, 0x04, 0xc7, 0x7f, 0x80, 0x67, 0x4b, 0x8d, 0x3c, 0xe6, 0x4d, 0x06, 0x3f, 0x09,
+    0x00, 0x07, 0x68, 0x4b, 0x8e, 0x3c, 0x7d, 0x02, 0x76, 0x02, 0x06, 0x04, 0xc7, 0x7f, 0x7f, 0x67, 0x4b, 0xfa, 0x38, 0xe6, 0x4d, 0x73, 0x3b, 0x09,
+    0x00, 0x07, 0x68, 0x4b, 0xfb, 0x38, 0x7d, 0x02, 0x76, 0x02, 0x06, 0x04, 0xc6, 0x80, 0x80, 0x33, 0x4e, 0xbd, 0x36, 0xb3, 0x50, 0x36, 0x39, 0x09,
+    0x00, 0x07, 0x35, 0x4e, 0xbe, 0x36, 0x7d, 0x02, 0x76, 0x02, 0x06, 0x04, 0xc6, 0x80, 0x7f, 0xb3, 0x51, 0x8a, 0x37, 0x33, 0x54, 0x03, 0x3a, 0x09,
+    0x00, 0x07, 0xb5, 0x51, 0x8b, 0x37, 0x7d, 0x02, 0x76, 0x02, 0x06, 0x03, 0xc7, 0x80, 0x80, 0x85, 0x4d, 0x28, 0x39, 0x3b, 0x53, 0xd8, 0x3e, 0x09,
+    0x00, 0x07, 0x86, 0x4d, 0x2a, 0x39, 0xb3, 0x05, 0xad, 0x05, 0x06, 0x03, 0xc4, 0x80, 0x80, 0x55, 0x20, 0xb2, 0x5c, 0x6b, 0x22, 0xcb, 0x5e, 0x3a,
+    0x00, 0x01, 0x6a, 0x22, 0xc0, 0x5d, 0x03, 0x6a, 0x22, 0x53, 0x5e, 0xf3, 0x21, 0xca, 0x5e, 0x60, 0x21, 0xc6, 0x5e, 0x03, 0xcd, 0x20, 0xc6, 0x5e,
+    0x56, 0x20, 0x50, 0x5e, 0x5a, 0x20, 0xbd, 0x5d, 0x03, 0x5a, 0x20, 0x2a, 0x5d, 0xd0, 0x20, 0xb3, 0x5c, 0x63, 0x21, 0xb6, 0x5c, 0x03, 0xf3, 0x21,
+    0xb6, 0x5c, 0x6a, 0x22, 0x2d, 0x5d, 0x6a, 0x22, 0xc0, 0x5d, 0x04, 0x06, 0x03, 0xc3, 0x80, 0x80, 0xc5, 0x1e, 0xd5, 0x5e, 0xdb, 0x20, 0xee, 0x60,
+    0x3a, 0x00, 0x01, 0xda, 0x20, 0xe3, 0x5f, 0x03, 0xda, 0x20, 0x76, 0x60, 0x63, 0x20, 0xed, 0x60, 0xd0, 0x1f, 0xea, 0x60, 0x03, 0x3d, 0x1f, 0xea,
+    0x60, 0xc6, 0x1e, 0x73, 0x60, 0xca, 0x1e, 0xe0, 0x5f, 0x03, 0xcd, 0x1e, 0x4d, 0x5f, 0x40, 0x1f, 0xd6, 0x5e, 0xd3, 0x1f, 0xda, 0x5e, 0x03, 0x63,
+    0x20, 0xdd, 0x5e, 0xda, 0x20, 0x53, 0x5f, 0xda, 0x20, 0xe3, 0x5f, 0x04, 0x06, 0x03, 0xc4, 0x80, 0x80, 0x42, 0x1c, 0x05, 0x5e, 0x58, 0x1e, 0x1e,
+    0x60, 0x3a, 0x00, 0x01, 0x56, 0x1e, 0x13, 0x5f, 0x03, 0x56, 0x1e, 0xa6, 0x5f, 0xe0, 0x1d, 0x1d, 0x60, 0x4d, 0x1d, 0x1a, 0x60, 0x03, 0xba, 0x1c,
+    0x1a, 0x60, 0x43, 0x1c, 0xa3, 0x5f, 0x46, 0x1c, 0x10, 0x5f, 0x03, 0x46, 0x1c, 0x7d, 0x5e, 0xbd, 0x1c, 0x06, 0x5e, 0x50, 0x1d, 0x0a, 0x5e, 0x03,
+    0xe0, 0x1d, 0x0a, 0x5e, 0x56, 0x1e, 0x80, 0x5e, 0x56, 0x1e, 0x13, 0x5f, 0x04, 0x06, 0x03, 0xc3, 0x80, 0x80, 0x42, 0x1c, 0x5f, 0x5b, 0x58, 0x1e,
+    0x78, 0x5d, 0x3a, 0x00, 0x01, 0x56, 0x1e, 0x6d, 0x5c, 0x03, 0x56, 0x1e, 0x00, 0x5d, 0xe0, 0x1d, 0x76, 0x5d, 0x4d, 0x1d, 0x73, 0x5d, 0x03, 0xba,
+    0x1c, 0x73, 0x5d, 0x43, 0x1c, 0xfd, 0x5c, 0x46, 0x1c, 0x6a, 0x5c, 0x03, 0x46, 0x1c, 0xd6, 0x5b, 0xbd, 0x1c, 0x60, 0x5b, 0x50, 0x1d, 0x63, 0x5b,
+    0x03, 0xe0, 0x1d, 0x66, 0x5b, 0x56, 0x1e, 0xdd, 0x5b, 0x56, 0x1e, 0x6d, 0x5c, 0x04, 0x06, 0x03, 0xc3, 0x80, 0x80, 0xc5, 0x1e, 0x8f, 0x5a, 0xdb,
+    0x20, 0xa8, 0x5c, 0x3a, 0x00, 0x01, 0xda, 0x20, 0x9d, 0x5b, 0x03, 0xda, 0x20, 0x30, 0x5c, 0x63, 0x20, 0xa6, 0x5c, 0xd0, 0x1f, 0xa3, 0x5c, 0x03,
+    0x3d, 0x1f, 0xa3, 0x5c, 0xc6, 0x1e, 0x2d, 0x5c, 0xca, 0x1e, 0x9a, 0x5b, 0x03, 0xcd, 0x1e, 0x06, 0x5b, 0x40, 0x1f, 0x90, 0x5a, 0xd3, 0x1f, 0x93,
+    0x5a, 0x03, 0x63, 0x20, 0x93, 0x5a, 0xda, 0x20, 0x0a, 0x5b, 0xda, 0x20, 0x9d, 0x5b, 0x04, 0x06, 0x04, 0xc7, 0x80, 0x7f, 0x5b, 0x1d, 0x02, 0x5c,
+    0xe5, 0x20, 0x85, 0x5f, 0x09, 0x00, 0x07, 0x5d, 0x1d, 0x03, 0x5c, 0x86, 0x03, 0x80, 0x03, 0x06, 0x03, 0xc5, 0x80, 0x80, 0xeb, 0x1b, 0xab, 0x13,
+    0xd5, 0x1d, 0x95, 0x15, 0x09, 0x00, 0x07, 0xed, 0x1b, 0xad, 0x13, 0xe6, 0x01, 0xe6, 0x01, 0x06, 0x03, 0xc6, 0x7f, 0x7f, 0x52, 0x1b, 0xb2, 0x15,
+    0x3b, 0x1d, 0x9b, 0x17, 0x09, 0x00, 0x07, 0x53, 0x1b, 0xb3, 0x15, 0xe6, 0x01, 0xe6, 0x01, 0x06, 0x03, 0xc6, 0x80, 0x80, 0xbb, 0x19, 0x15, 0x17,
+    0xa5, 0x1b, 0xfe, 0x18, 0x09, 0x00, 0x07, 0xbd, 0x19, 0x16, 0x17, 0xe6, 0x01, 0xe6, 0x01, 0x06, 0x03, 0xc6, 0x7f, 0x7f, 0xa2, 0x17, 0x62, 0x17,
+    0x8b, 0x19, 0x4b, 0x19, 0x09, 0x00, 0x07, 0xa3, 0x17, 0x63, 0x17, 0xe6, 0x01, 0xe6, 0x01, 0x06, 0x03, 0xc6, 0x80, 0x7f, 0xb8, 0x15, 0x82, 0x16,
+    0xa1, 0x17, 0x6b, 0x18, 0x09, 0x00, 0x07, 0xba, 0x15, 0x83, 0x16, 0xe6, 0x01, 0xe6, 0x01, 0x06, 0x03, 0xc5, 0x80, 0x80, 0x92, 0x14, 0xb8, 0x14,
+    0x7b, 0x16, 0xa5, 0x16, 0x3a, 0x00, 0x01, 0x7a, 0x16, 0xb0, 0x15, 0x03, 0x7a, 0x16, 0x36, 0x16, 0x0d, 0x16, 0xa3, 0x16, 0x86, 0x15, 0xa3, 0x16,
+    0x03, 0x00, 0x15, 0xa3, 0x16, 0x93, 0x14, 0x36, 0x16, 0x93, 0x14, 0xb0, 0x15, 0x03, 0x93, 0x14, 0x2a, 0x15, 0x00, 0x15, 0xbd, 0x14, 0x86, 0x15,
+    0xbd, 0x14, 0x03, 0x0d, 0x16, 0xba, 0x14, 0x7a, 0x16, 0x26, 0x15, 0x7a, 0x16, 0xb0, 0x15, 0x04, 0x06, 0x03, 0xc6, 0x7f, 0x80, 0x92, 0x14, 0x9b,
+    0x12, 0x7b, 0x16, 0x85, 0x14, 0x09, 0x00, 0x07, 0x93, 0x14, 0x9d, 0x12, 0xe6, 0x01, 0xe6, 0x01, 0x06, 0x03, 0xc6, 0x80, 0x80, 0xb8, 0x15, 0xd5,
+    0x10, 0xa1, 0x17, 0xbe, 0x12, 0x09, 0x00, 0x07, 0xba, 0x15, 0xd6, 0x10, 0xe6, 0x01, 0xe6, 0x01, 0x06, 0x03, 0xc6, 0x7f, 0x80, 0xa2, 0x17, 0xf5,
+    0x0f, 0x8b, 0x19, 0xde, 0x11, 0x09, 0x00, 0x07, 0xa3, 0x17, 0xf6, 0x0f, 0xe6, 0x01, 0xe6, 0x01, 0x06, 0x03, 0xc6, 0x80, 0x7f, 0xbb, 0x19, 0x42,
+    0x10, 0xa5, 0x1b, 0x2b, 0x12, 0x09, 0x00, 0x07, 0xbd, 0x19, 0x43, 0x10, 0xe6, 0x01, 0xe6, 0x01, 0x06, 0x03, 0xc6, 0x7f, 0x80, 0x52, 0x1b, 0xa5,
+    0x11, 0x3b, 0x1d, 0x8e, 0x13, 0x09, 0x00, 0x07, 0x53, 0x1b, 0xa6, 0x11, 0xe6, 0x01, 0xe6, 0x01, 0x06, 0x06, 0xc8, 0x80, 0x80, 0xbf, 0x15, 0x3f,
+    0x11, 0x81, 0x1c, 0x01, 0x18, 0x09, 0x00, 0x07, 0xc0, 0x15, 0x40, 0x11, 0xc0, 0x06, 0xc0, 0x06, 0x06, 0x03, 0xc7, 0x80, 0x80, 0x30, 0x29, 0x13,
+    0x19, 0x93, 0x2c, 0x70, 0x1c, 0x09, 0x00, 0x07, 0x32, 0x29, 0x15, 0x19, 0x60, 0x03, 0x5a, 0x03, 0x06, 0x03, 0xc7, 0x7f, 0x7f, 0xba, 0x27, 0x1a,
+    0x1c, 0x1d, 0x2b, 0x76, 0x1f, 0x09, 0x00, 0x07, 0xbb, 0x27, 0x1b, 0x1c, 0x60, 0x03, 0x5a, 0x03, 0x06, 0x03, 0xc7, 0x7f, 0x7f, 0x75, 0x24, 0xd5,
+    0x1c, 0xd5, 0x27, 0x35, 0x20, 0x09, 0x00, 0x07, 0x76, 0x24, 0xd6, 0x1c, 0x5d, 0x03, 0x5d, 0x03, 0x06, 0x03, 0xc7, 0x80, 0x7f, 0xd0, 0x21, 0xbf,
+    0x1a, 0x33, 0x25, 0x1e, 0x1e, 0x09, 0x00, 0x07, 0xd2, 0x21, 0xc0, 0x1a, 0x60, 0x03, 0x5d, 0x03, 0x06, 0x03, 0xc7, 0x80, 0x7f, 0xcf, 0x21, 0x60,
+    0x17, 0x31, 0x25, 0xbd, 0x1a, 0x09, 0x00, 0x07, 0xd0, 0x21, 0x62, 0x17, 0x60, 0x03, 0x5a, 0x03, 0x06, 0x03, 0xc7, 0x7f, 0x80, 0x72, 0x24, 0x4a,
+    0x15, 0xd5, 0x27, 0xa6, 0x18, 0x09, 0x00, 0x07, 0x73, 0x24, 0x4b, 0x15, 0x60, 0x03, 0x5a, 0x03, 0x06, 0x03, 0xc7, 0x7f, 0x80, 0xba, 0x27, 0x0d,
+    0x16, 0x1d, 0x2b, 0x69, 0x19, 0x09, 0x00, 0x07, 0xbb, 0x27, 0x0e, 0x16, 0x60, 0x03, 0x5a, 0x03, 0x06, 0x00, 0xc8, 0x80, 0x80, 0x1f, 0x23, 0xdf,
+    0x16, 0xe1, 0x2a, 0xa1, 0x1e, 0x09, 0x00, 0x07, 0x20, 0x23, 0xe0, 0x16, 0xc0, 0x07, 0xc0, 0x07, 0x06, 0x02, 0xc6, 0x80, 0x80, 0x9b, 0x43, 0x1b,
+    0x4d, 0xe5, 0x45, 0x65, 0x4f, 0x09, 0x00, 0x07, 0x9d, 0x43, 0x1d, 0x4d, 0x46, 0x02, 0x46, 0x02, 0x06, 0x02, 0xc6, 0x80, 0x80, 0x8b, 0x42, 0xab,
+    0x4f, 0xd5, 0x44, 0xf5, 0x51, 0x09, 0x00, 0x07, 0x8d, 0x42, 0xad, 0x4f, 0x46, 0x02, 0x46, 0x02, 0x06, 0x02, 0xc6, 0x80, 0x80, 0xfb, 0x3f, 0xbb,
+    0x50, 0x45, 0x42, 0x05, 0x53, 0x09, 0x00, 0x07, 0xfd, 0x3f, 0xbd, 0x50, 0x46, 0x02, 0x46, 0x02, 0x06, 0x02, 0xc6, 0x80, 0x80, 0x6b, 0x3d, 0xab,
+    0x4f, 0xb5, 0x3f, 0xf5, 0x51, 0x09, 0x00, 0x07, 0x6d, 0x3d, 0xad, 0x4f, 0x46, 0x02, 0x46, 0x02, 0x06, 0x02, 0xc6, 0x80, 0x80, 0x5b, 0x3c, 0x1b,
+    0x4d, 0xa5, 0x3e, 0x65, 0x4f, 0x09, 0x00, 0x07, 0x5d, 0x3c, 0x1d, 0x4d, 0x46, 0x02, 0x46, 0x02, 0x06, 0x02, 0xc6, 0x80, 0x80, 0x6b, 0x3d, 0x8b,
+    0x4a, 0xb5, 0x3f, 0xd5, 0x4c, 0x09, 0x00, 0x07, 0x6d, 0x3d, 0x8d, 0x4a, 0x46, 0x02, 0x46, 0x02, 0x06, 0x02, 0xc6, 0x80, 0x80, 0xfb, 0x3f, 0x7b,
+    0x49, 0x45, 0x42, 0xc5, 0x4b, 0x09, 0x00, 0x07, 0xfd, 0x3f, 0x7d, 0x49, 0x46, 0x02, 0x46, 0x02, 0x06, 0x02, 0xc6, 0x80, 0x80, 0x8b, 0x42, 0x8b,
+    0x4a, 0xd5, 0x44, 0xd5, 0x4c, 0x09, 0x00, 0x07, 0x8d, 0x42, 0x8d, 0x4a, 0x46, 0x02, 0x46, 0x02, 0x06, 0x06, 0xc7, 0x80, 0x80, 0x28, 0x3e, 0x48,
+    0x4b, 0x1b, 0x44, 0x3b, 0x51, 0x09, 0x00, 0x07, 0x2a, 0x3e, 0x4a, 0x4b, 0xf0, 0x05, 0xf0, 0x05, 0x06, 0x02, 0xc6, 0x80, 0x80, 0x58, 0x04, 0x58,
+    0x4d, 0xa8, 0x06, 0xa8, 0x4f, 0x09, 0x00, 0x07, 0x5a, 0x04, 0x5a, 0x4d, 0x4d, 0x02, 0x4d, 0x02, 0x06, 0x02, 0xc6, 0x80, 0x80, 0x52, 0x03, 0x28,
+    0x50, 0xa1, 0x05, 0x78, 0x52, 0x09, 0x00, 0x07, 0x53, 0x03, 0x2a, 0x50, 0x4d, 0x02, 0x4d, 0x02, 0x06, 0x02, 0xc6, 0x80, 0x80, 0xbb, 0x00, 0xa8,
+    0x51, 0x0b, 0x03, 0xf8, 0x53, 0x09, 0x00, 0x07, 0xbd, 0x00, 0xaa, 0x51, 0x4d, 0x02, 0x4d, 0x02, 0x06, 0x02, 0xc6, 0x80, 0x80, 0xc8, 0xfd, 0x22,
+    0x51, 0x18, 0x00, 0x71, 0x53, 0x09, 0x00, 0x07, 0xca, 0xfd, 0x23, 0x51, 0x4d, 0x02, 0x4d, 0x02, 0x06, 0x02, 0xc6, 0x80, 0x80, 0xdb, 0xfb, 0xd8,
+    0x4e, 0x2b, 0xfe, 0x28, 0x51, 0x09, 0x00, 0x07, 0xdd, 0xfb, 0xda, 0x4e, 0x4d, 0x02, 0x4d, 0x02, 0x06, 0x02, 0xc6, 0x80, 0x80, 0xdb, 0xfb, 0xd8,
+    0x4b, 0x2b, 0xfe, 0x28, 0x4e, 0x09, 0x00, 0x07, 0xdd, 0xfb, 0xda, 0x4b, 0x4d, 0x02, 0x4d, 0x02, 0x06, 0x02, 0xc6, 0x80, 0x7f, 0xc8, 0xfd, 0x8f,
+    0x49, 0x18, 0x00, 0xde, 0x4b, 0x09, 0x00, 0x07, 0xca, 0xfd, 0x90, 0x49, 0x4d, 0x02, 0x4d, 0x02, 0x06, 0x02, 0xc6, 0x80, 0x80, 0xbb, 0x00, 0x08,
+    0x49, 0x0b, 0x03, 0x58, 0x4b, 0x09, 0x00, 0x07, 0xbd, 0x00, 0x0a, 0x49, 0x4d, 0x02, 0x4d, 0x02, 0x06, 0x02, 0xc6, 0x80, 0x80, 0x52, 0x03, 0x88,
+    0x4a, 0xa1, 0x05, 0xd8, 0x4c, 0x09, 0x00, 0x07, 0x53, 0x03, 0x8a, 0x4a, 0x4d, 0x02, 0x4d, 0x02, 0x06, 0x00, 0xc8, 0x80, 0x80, 0xbf, 0xfd, 0x25,
+    0x4b, 0x81, 0x04, 0xe1, 0x51, 0x09, 0x00, 0x07, 0xc0, 0xfd, 0x26, 0x4b, 0xc0, 0x06, 0xba, 0x06, 0x06, 0x03, 0xc6, 0x80, 0x80, 0x32, 0x05, 0x12,
+    0x1e, 0x8e, 0x06, 0x6e, 0x1f, 0x09, 0x00, 0x07, 0x33, 0x05, 0x13, 0x1e, 0x5a, 0x01, 0x5a, 0x01, 0x06, 0x03, 0xc6, 0x7f, 0x7f, 0x9f, 0x04, 0x3f,
+    0x1f, 0xfb, 0x05, 0x9b, 0x20, 0x09, 0x00, 0x07, 0xa0, 0x04, 0x40, 0x1f, 0x5a, 0x01, 0x5a, 0x01, 0x06, 0x03, 0xc4, 0x80, 0x7f, 0x5b, 0x03, 0x88,
+    0x1f, 0xb8, 0x04, 0xe5, 0x20, 0x09, 0x00, 0x07, 0x5d, 0x03, 0x8a, 0x1f, 0x5a, 0x01, 0x5a, 0x01, 0x06, 0x03, 0xc4, 0x7f, 0x80, 0x58, 0x02, 0xb8,
+    0x1e, 0xb5, 0x03, 0x15, 0x20, 0x3a, 0x00, 0x01, 0xb3, 0x03, 0x66, 0x1f, 0x03, 0xb3, 0x03, 0xc6, 0x1f, 0x66, 0x03, 0x13, 0x20, 0x06, 0x03, 0x13,
+    0x20, 0x03, 0xa6, 0x02, 0x13, 0x20, 0x5a, 0x02, 0xc6, 0x1f, 0x5a, 0x02, 0x66, 0x1f, 0x03, 0x5a, 0x02, 0x06, 0x1f, 0xa6, 0x02, 0xba, 0x1e, 0x06,
+    0x03, 0xba, 0x1e, 0x03, 0x63, 0x03, 0xba, 0x1e, 0xb0, 0x03, 0x06, 0x1f, 0xb3, 0x03, 0x66, 0x1f, 0x04, 0x06, 0x03, 0xc4, 0x7f, 0x80, 0x58, 0x02,
+    0x6b, 0x1d, 0xb5, 0x03, 0xc8, 0x1e, 0x3a, 0x00, 0x01, 0xb3, 0x03, 0x1a, 0x1e, 0x03, 0xb3, 0x03, 0x7a, 0x1e, 0x66, 0x03, 0xc6, 0x1e, 0x06, 0x03,
+    0xc6, 0x1e, 0x03, 0xa6, 0x02, 0xc6, 0x1e, 0x5a, 0x02, 0x7a, 0x1e, 0x5a, 0x02, 0x1a, 0x1e, 0x03, 0x5a, 0x02, 0xba, 0x1d, 0xa6, 0x02, 0x6d, 0x1d,
+    0x06, 0x03, 0x6d, 0x1d, 0x03, 0x63, 0x03, 0x6d, 0x1d, 0xb0, 0x03, 0xba, 0x1d, 0xb3, 0x03, 0x1a, 0x1e, 0x04, 0x06, 0x03, 0xc4, 0x80, 0x80, 0x5b,
+    0x03, 0x9b, 0x1c, 0xb8, 0x04, 0xf8, 0x1d, 0x09, 0x00, 0x07, 0x5d, 0x03, 0x9d, 0x1c, 0x5a, 0x01, 0x5a, 0x01, 0x06, 0x03, 0xc5, 0x7f, 0x80, 0x9f,
+    0x04, 0xe5, 0x1c, 0xfb, 0x05, 0x41, 0x1e, 0x3a, 0x00, 0x01, 0xfa, 0x05, 0x93, 0x1d, 0x03, 0xfa, 0x05, 0xf3, 0x1d, 0xad, 0x05, 0x40, 0x1e, 0x4d,
+    0x05, 0x40, 0x1e, 0x03, 0xed, 0x04, 0x40, 0x1e, 0xa0, 0x04, 0xf3, 0x1d, 0xa0, 0x04, 0x93, 0x1d, 0x03, 0xa0, 0x04, 0x33, 0x1d, 0xed, 0x04, 0xe6,
+    0x1c, 0x4d, 0x05, 0xe6, 0x1c, 0x03, 0xad, 0x05, 0xea, 0x1c, 0xfa, 0x05, 0x36, 0x1d, 0xfa, 0x05, 0x93, 0x1d, 0x04, 0x06, 0x06, 0xc7, 0x7f, 0x7f,
+    0xcf, 0x02, 0x32, 0x1d, 0xee, 0x05, 0x4e, 0x20, 0x09, 0x00, 0x07, 0xd0, 0x02, 0x33, 0x1d, 0x1d, 0x03, 0x1a, 0x03, 0x06, 0x03, 0xbe, 0x81, 0x80,
+    0xd5, 0x56, 0x72, 0x54, 0xeb, 0x57, 0x8b, 0x55, 0x3a, 0x00, 0x01, 0xea, 0x57, 0x00, 0x55, 0x03, 0xea, 0x57, 0x4a, 0x55, 0xad, 0x57, 0x8a, 0x55,
+    0x60, 0x57, 0x86, 0x55, 0x03, 0x16, 0x57, 0x86, 0x55, 0xd6, 0x56, 0x4a, 0x55, 0xda, 0x56, 0xfd, 0x54, 0x03, 0xdd, 0x56, 0xb0, 0x54, 0x16, 0x57,
+    0x73, 0x54, 0x63, 0x57, 0x76, 0x54, 0x03, 0xaa, 0x57, 0x76, 0x54, 0xea, 0x57, 0xb3, 0x54, 0xea, 0x57, 0x00, 0x55, 0x04, 0x06, 0x03, 0xbe, 0x81,
+    0x80, 0x6b, 0x56, 0x6b, 0x55, 0x81, 0x57, 0x85, 0x56, 0x3a, 0x00, 0x01, 0x80, 0x57, 0xfa, 0x55, 0x03, 0x80, 0x57, 0x43, 0x56, 0x43, 0x57, 0x83,
+    0x56, 0xf6, 0x56, 0x80, 0x56, 0x03, 0xad, 0x56, 0x80, 0x56, 0x6d, 0x56, 0x43, 0x56, 0x70, 0x56, 0xf6, 0x55, 0x03, 0x73, 0x56, 0xaa, 0x55, 0xad,
+    0x56, 0x6d, 0x55, 0xfa, 0x56, 0x70, 0x55, 0x03, 0x43, 0x57, 0x70, 0x55, 0x80, 0x57, 0xad, 0x55, 0x80, 0x57, 0xfa, 0x55, 0x04, 0x06, 0x03, 0xbe,
+    0x81, 0x80, 0x75, 0x55, 0xd2, 0x55, 0x8b, 0x56, 0xeb, 0x56, 0x3a, 0x00, 0x01, 0x8a, 0x56, 0x60, 0x56, 0x03, 0x8a, 0x56, 0xaa, 0x56, 0x4d, 0x56,
+    0xea, 0x56, 0x00, 0x56, 0xe6, 0x56, 0x03, 0xb6, 0x55, 0xe6, 0x56, 0x76, 0x55, 0xaa, 0x56, 0x7a, 0x55, 0x5d, 0x56, 0x03, 0x7d, 0x55, 0x10, 0x56,
+    0xb6, 0x55, 0xd3, 0x55, 0x03, 0x56, 0xd6, 0x55, 0x03, 0x4a, 0x56, 0xd6, 0x55, 0x8a, 0x56, 0x13, 0x56, 0x8a, 0x56, 0x60, 0x56, 0x04, 0x06, 0x03,
+    0xbe, 0x81, 0x80, 0x7b, 0x54, 0x6b, 0x55, 0x91, 0x55, 0x85, 0x56, 0x3a, 0x00, 0x01, 0x90, 0x55, 0xfa, 0x55, 0x03, 0x90, 0x55, 0x43, 0x56, 0x53,
+    0x55, 0x83, 0x56, 0x06, 0x55, 0x80, 0x56, 0x03, 0xbd, 0x54, 0x80, 0x56, 0x7d, 0x54, 0x43, 0x56, 0x80, 0x54, 0xf6, 0x55, 0x03, 0x83, 0x54, 0xaa,
+    0x55, 0xbd, 0x54, 0x6d, 0x55, 0x0a, 0x55, 0x70, 0x55, 0x03, 0x53, 0x55, 0x70, 0x55, 0x90, 0x55, 0xad, 0x55, 0x90, 0x55, 0xfa, 0x55, 0x04, 0x06,
+    0x03, 0xbe, 0x81, 0x80, 0x15, 0x54, 0x72, 0x54, 0x2b, 0x55, 0x8b, 0x55, 0x3a, 0x00, 0x01, 0x2a, 0x55, 0x00, 0x55, 0x03, 0x2a, 0x55, 0x4a, 0x55,
+    0xed, 0x54, 0x8a, 0x55, 0xa0, 0x54, 0x86, 0x55, 0x03, 0x56, 0x54, 0x86, 0x55, 0x16, 0x54, 0x4a, 0x55, 0x1a, 0x54, 0xfd, 0x54, 0x03, 0x1d, 0x54,
+    0xb0, 0x54, 0x56, 0x54, 0x73, 0x54, 0xa3, 0x54, 0x76, 0x54, 0x03, 0xea, 0x54, 0x76, 0x54, 0x2a, 0x55, 0xb3, 0x54, 0x2a, 0x55, 0x00, 0x55, 0x04,
+    0x01, 0x03, 0x06, 0x55, 0x03, 0x54, 0x04, 0x35, 0x07, 0x06, 0x03, 0xc4, 0x80, 0x80, 0x75, 0xff, 0x78, 0xff, 0x8b, 0x00, 0x88, 0x00, 0x09, 0x00,
+    0x07, 0x76, 0xff, 0x7a, 0xff, 0x13, 0x01, 0x0d, 0x01, 0x02, 0x06, 0x03, 0xbe, 0x81, 0x80, 0x75, 0x55, 0x12, 0x53, 0x8b, 0x56, 0x2b, 0x54, 0x3a,
+    0x00, 0x01, 0x8a, 0x56, 0xa0, 0x53, 0x03, 0x8a, 0x56, 0xea, 0x53, 0x4d, 0x56, 0x2a, 0x54, 0x00, 0x56, 0x26, 0x54, 0x03, 0xb6, 0x55, 0x26, 0x54,
+    0x76, 0x55, 0xea, 0x53, 0x7a, 0x55, 0x9d, 0x53, 0x03, 0x7d, 0x55, 0x50, 0x53, 0xb6, 0x55, 0x13, 0x53, 0x03, 0x56, 0x16, 0x53, 0x03, 0x4a, 0x56,
+    0x16, 0x53, 0x8a, 0x56, 0x53, 0x53, 0x8a, 0x56, 0xa0, 0x53, 0x04, 0x01, 0x03, 0xf6, 0x56, 0x03, 0x54, 0x04, 0x35, 0x07, 0x06, 0x03, 0xc4, 0x80,
+    0x80, 0x75, 0xff, 0x78, 0xff, 0x8b, 0x00, 0x88, 0x00, 0x09, 0x00, 0x07, 0x76, 0xff, 0x7a, 0xff, 0x13, 0x01, 0x0d, 0x01, 0x02, 0x06, 0x00, 0xc7,
+    0x80, 0x80, 0x9a, 0x54, 0x9d, 0x53, 0x66, 0x57, 0x63, 0x56, 0x09, 0x00, 0x07, 0x9b, 0x54, 0x9e, 0x53, 0xca, 0x02, 0xc3, 0x02, 0x06, 0x02, 0xc6,
+    0x80, 0x7f, 0xa5, 0x41, 0x25, 0x18, 0x9b, 0x43, 0x1b, 0x1a, 0x09, 0x00, 0x07, 0xa6, 0x41, 0x26, 0x18, 0xf3, 0x01, 0xf3, 0x01, 0x06, 0x02, 0xc5,
+    0x7f, 0x7f, 0xdf, 0x40, 0x02, 0x1a, 0xd5, 0x42, 0xf8, 0x1b, 0x3a, 0x00, 0x01, 0xd3, 0x42, 0xfa, 0x1a, 0x03, 0xd3, 0x42, 0x83, 0x1b, 0x66, 0x42,
+    0xf3, 0x1b, 0xdd, 0x41, 0xf6, 0x1b, 0x03, 0x53, 0x41, 0xf6, 0x1b, 0xe3, 0x40, 0x8a, 0x1b, 0xe0, 0x40, 0x00, 0x1b, 0x03, 0xe0, 0x40, 0x76, 0x1a,
+    0x4d, 0x41, 0x06, 0x1a, 0xd6, 0x41, 0x03, 0x1a, 0x03, 0x63, 0x42, 0x03, 0x1a, 0xd3, 0x42, 0x70, 0x1a, 0xd3, 0x42, 0xfa, 0x1a, 0x04, 0x06, 0x02,
+    0xc6, 0x80, 0x80, 0x05, 0x3f, 0xc5, 0x1a, 0xfb, 0x40, 0xbb, 0x1c, 0x09, 0x00, 0x07, 0x06, 0x3f, 0xc6, 0x1a, 0xf3, 0x01, 0xf3, 0x01, 0x06, 0x02,
+    0xc6, 0x80, 0x7f, 0x28, 0x3d, 0xff, 0x19, 0x1e, 0x3f, 0xf5, 0x1b, 0x3a, 0x00, 0x01, 0x1d, 0x3f, 0xfa, 0x1a, 0x03, 0x1d, 0x3f, 0x83, 0x1b, 0xad,
+    0x3e, 0xf3, 0x1b, 0x23, 0x3e, 0xf3, 0x1b, 0x03, 0x9a, 0x3d, 0xf3, 0x1b, 0x2a, 0x3d, 0x83, 0x1b, 0x2a, 0x3d, 0xfa, 0x1a, 0x03, 0x2a, 0x3d, 0x70,
+    0x1a, 0x9a, 0x3d, 0x00, 0x1a, 0x23, 0x3e, 0x00, 0x1a, 0x03, 0xb0, 0x3e, 0x03, 0x1a, 0x1d, 0x3f, 0x70, 0x1a, 0x1d, 0x3f, 0xfa, 0x1a, 0x04, 0x06,
+    0x02, 0xc6, 0x80, 0x7f, 0x65, 0x3c, 0x25, 0x18, 0x5b, 0x3e, 0x1b, 0x1a, 0x09, 0x00, 0x07, 0x66, 0x3c, 0x26, 0x18, 0xf3, 0x01, 0xf3, 0x01, 0x06,
+    0x02, 0xc6, 0x80, 0x80, 0x28, 0x3d, 0x4b, 0x16, 0x1e, 0x3f, 0x41, 0x18, 0x09, 0x00, 0x07, 0x2a, 0x3d, 0x4d, 0x16, 0xf3, 0x01, 0xf3, 0x01, 0x06,
+    0x02, 0xc6, 0x80, 0x80, 0x05, 0x3f, 0x85, 0x15, 0xfb, 0x40, 0x7b, 0x17, 0x09, 0x00, 0x07, 0x06, 0x3f, 0x86, 0x15, 0xf3, 0x01, 0xf3, 0x01, 0x06,
+    0x02, 0xc4, 0x80, 0x80, 0xdf, 0x40, 0x4b, 0x16, 0xd5, 0x42, 0x45, 0x18, 0x3a, 0x00, 0x01, 0xd3, 0x42, 0x46, 0x17, 0x03, 0xd3, 0x42, 0xd0, 0x17,
+    0x66, 0x42, 0x40, 0x18, 0xdd, 0x41, 0x43, 0x18, 0x03, 0x53, 0x41, 0x43, 0x18, 0xe3, 0x40, 0xd6, 0x17, 0xe0, 0x40, 0x4d, 0x17, 0x03, 0xe0, 0x40,
+    0xc3, 0x16, 0x4d, 0x41, 0x53, 0x16, 0xd6, 0x41, 0x50, 0x16, 0x03, 0x63, 0x42, 0x4d, 0x16, 0xd3, 0x42, 0xba, 0x16, 0xd3, 0x42, 0x46, 0x17, 0x04,
+    0x06, 0x03, 0xc7, 0x7f, 0x80, 0x6f, 0x3d, 0x93, 0x16, 0x8e, 0x42, 0xad, 0x1b, 0x09, 0x00, 0x07, 0x70, 0x3d, 0x95, 0x16, 0x1d, 0x05, 0x16, 0x05,
+    0x01, 0x03, 0x62, 0x3d, 0xc2, 0x57, 0x04, 0xe5, 0x06, 0x06, 0x00, 0xc5, 0x80, 0x80, 0x33, 0xff, 0x30, 0xff, 0xcd, 0x00, 0xd0, 0x00, 0x09, 0x00,
+    0x07, 0x35, 0xff, 0x32, 0xff, 0x96, 0x01, 0x9d, 0x01, 0x02, 0x01, 0x03, 0x2b, 0x3c, 0x6b, 0x59, 0x04, 0xe5, 0x06, 0x06, 0x00, 0xc5, 0x80, 0x80,
+    0x33, 0xff, 0x30, 0xff, 0xcd, 0x00, 0xd0, 0x00, 0x09, 0x00, 0x07, 0x35, 0xff, 0x32, 0xff, 0x96, 0x01, 0x9d, 0x01, 0x02, 0x01, 0x03, 0x38, 0x3a,
+    0xc8, 0x58, 0x04, 0xe5, 0x06, 0x06, 0x00, 0xc5, 0x80, 0x80, 0x33, 0xff, 0x30, 0xff, 0xcd, 0x00, 0xd0, 0x00, 0x09, 0x00, 0x07, 0x35, 0xff, 0x32,
+    0xff, 0x96, 0x01, 0x9d, 0x01, 0x02, 0x01, 0x03, 0x38, 0x3a, 0xbb, 0x56, 0x04, 0xe5, 0x06, 0x06, 0x00, 0xc5, 0x80, 0x80, 0x33, 0xff, 0x30, 0xff,
+    0xcd, 0x00, 0xd0, 0x00, 0x09, 0x00, 0x07, 0x35, 0xff, 0x32, 0xff, 0x96, 0x01, 0x9d, 0x01, 0x02, 0x01, 0x03, 0x2b, 0x3c, 0x18, 0x56, 0x04, 0xe5,
+    0x06, 0x06, 0x00, 0xc5, 0x80, 0x80, 0x33, 0xff, 0x30, 0xff, 0xcd, 0x00, 0xd0, 0x00, 0x09, 0x00, 0x07, 0x35, 0xff, 0x32, 0xff, 0x96, 0x01, 0x9d,
+    0x01, 0x02, 0x06, 0x03, 0xc7, 0x80, 0x80, 0x42, 0x3a, 0x62, 0x56, 0xfe, 0x3c, 0x1e, 0x59, 0x09, 0x00, 0x07, 0x43, 0x3a, 0x63, 0x56, 0xba, 0x02,
+    0xba, 0x02, 0x06, 0x03, 0xc7, 0x80, 0x80, 0xda, 0x3b, 0x9d, 0x04, 0xa6, 0x3e, 0x63, 0x07, 0x09, 0x00, 0x07, 0xdb, 0x3b, 0x9e, 0x04, 0xca, 0x02,
+    0xc3, 0x02, 0x06, 0x03, 0xc5, 0x80, 0x80, 0x4b, 0x3a, 0x4f, 0x07, 0x15, 0x3d, 0x1b, 0x0a, 0x3a, 0x00, 0x01, 0x13, 0x3d, 0xb6, 0x08, 0x03, 0x13,
+    0x3d, 0x7a, 0x09, 0x73, 0x3c, 0x1a, 0x0a, 0xb0, 0x3b, 0x1a, 0x0a, 0x03, 0xed, 0x3a, 0x1a, 0x0a, 0x4d, 0x3a, 0x7a, 0x09, 0x4d, 0x3a, 0xb6, 0x08,
+    0x03, 0x4d, 0x3a, 0xf3, 0x07, 0xed, 0x3a, 0x53, 0x07, 0xb0, 0x3b, 0x53, 0x07, 0x03, 0x73, 0x3c, 0x50, 0x07, 0x13, 0x3d, 0xf0, 0x07, 0x13, 0x3d,
+    0xb6, 0x08, 0x04, 0x06, 0x03, 0xc5, 0x80, 0x80, 0x2b, 0x37, 0x4f, 0x07, 0xf5, 0x39, 0x1b, 0x0a, 0x3a, 0x00, 0x01, 0xf3, 0x39, 0xb6, 0x08, 0x03,
+    0xf3, 0x39, 0x7a, 0x09, 0x53, 0x39, 0x1a, 0x0a, 0x90, 0x38, 0x1a, 0x0a, 0x03, 0xcd, 0x37, 0x1a, 0x0a, 0x2d, 0x37, 0x7a, 0x09, 0x2d, 0x37, 0xb6,
+    0x08, 0x03, 0x2d, 0x37, 0xf3, 0x07, 0xcd, 0x37, 0x53, 0x07, 0x90, 0x38, 0x53, 0x07, 0x03, 0x53, 0x39, 0x50, 0x07, 0xf3, 0x39, 0xf0, 0x07, 0xf3,
+    0x39, 0xb6, 0x08, 0x04, 0x06, 0x03, 0xc7, 0x7f, 0x80, 0x9a, 0x35, 0x9d, 0x04, 0x66, 0x38, 0x63, 0x07, 0x09, 0x00, 0x07, 0x9b, 0x35, 0x9e, 0x04,
+    0xca, 0x02, 0xc3, 0x02, 0x06, 0x03, 0xc7, 0x80, 0x7f, 0x2a, 0x37, 0xe7, 0x01, 0xf6, 0x39, 0xad, 0x04, 0x09, 0x00, 0x07, 0x2b, 0x37, 0xe8, 0x01,
+    0xca, 0x02, 0xc3, 0x02, 0x06, 0x03, 0xc7, 0x80, 0x7f, 0x4a, 0x3a, 0xe7, 0x01, 0x16, 0x3d, 0xad, 0x04, 0x09, 0x00, 0x07, 0x4b, 0x3a, 0xe8, 0x01,
+    0xca, 0x02, 0xc3, 0x02, 0x06, 0x04, 0xc7, 0x7f, 0x7f, 0x55, 0x37, 0x35, 0x03, 0xe8, 0x3c, 0xc8, 0x08, 0x09, 0x00, 0x07, 0x56, 0x37, 0x36, 0x03,
+    0x90, 0x05, 0x90, 0x05, 0x06, 0x00, 0xc4, 0x80, 0x80, 0xa5, 0x27, 0x65, 0x4d, 0x9b, 0x28, 0x5b, 0x4e, 0x09, 0x00, 0x07, 0xa6, 0x27, 0x66, 0x4d,
+    0xf3, 0x00, 0xf3, 0x00, 0x06, 0x00, 0xc4, 0x80, 0x80, 0xf5, 0x26, 0x95, 0x4e, 0xeb, 0x27, 0x8b, 0x4f, 0x09, 0x00, 0x07, 0xf6, 0x26, 0x96, 0x4e,
+    0xf3, 0x00, 0xf3, 0x00, 0x06, 0x00, 0xc4, 0x80, 0x80, 0x95, 0x25, 0x95, 0x4e, 0x8b, 0x26, 0x8b, 0x4f, 0x09, 0x00, 0x07, 0x96, 0x25, 0x96, 0x4e,
+    0xf3, 0x00, 0xf3, 0x00, 0x06, 0x00, 0xc4, 0x80, 0x80, 0xe5, 0x24, 0x65, 0x4d, 0xdb, 0x25, 0x5b, 0x4e, 0x09, 0x00, 0x07, 0xe6, 0x24, 0x66, 0x4d,
+    0xf3, 0x00, 0xf3, 0x00, 0x06, 0x00, 0xc4, 0x80, 0x80, 0x95, 0x25, 0x35, 0x4c, 0x8b, 0x26, 0x2b, 0x4d, 0x09, 0x00, 0x07, 0x96, 0x25, 0x36, 0x4c,
+    0xf3, 0x00, 0xf3, 0x00, 0x06, 0x00, 0xc4, 0x80, 0x80, 0xf5, 0x26, 0x35, 0x4c, 0xeb, 0x27, 0x2b, 0x4d, 0x09, 0x00, 0x07, 0xf6, 0x26, 0x36, 0x4c,
+    0xf3, 0x00, 0xf3, 0x00, 0x06, 0x03, 0xc5, 0x80, 0x80, 0xcb, 0x25, 0xeb, 0x4c, 0xb5, 0x27, 0xd5, 0x4e, 0x09, 0x00, 0x07, 0xcd, 0x25, 0xed, 0x4c,
+    0xe6, 0x01, 0xe6, 0x01, 0x06, 0x03, 0xc7, 0x80, 0x80, 0x75, 0x24, 0x15, 0x07, 0xcb, 0x27, 0x6b, 0x0a, 0x09, 0x00, 0x07, 0x76, 0x24, 0x16, 0x07,
+    0x53, 0x03, 0x53, 0x03, 0x06, 0x03, 0xc7, 0x80, 0x80, 0xa5, 0x22, 0x38, 0x0a, 0xfb, 0x25, 0x8e, 0x0d, 0x09, 0x00, 0x07, 0xa6, 0x22, 0x3a, 0x0a,
+    0x53, 0x03, 0x53, 0x03, 0x06, 0x03, 0xc7, 0x80, 0x80, 0x05, 0x1f, 0x38, 0x0a, 0x5b, 0x22, 0x8e, 0x0d, 0x09, 0x00, 0x07, 0x06, 0x1f, 0x3a, 0x0a,
+    0x53, 0x03, 0x53, 0x03, 0x06, 0x03, 0xc7, 0x80, 0x80, 0x35, 0x1d, 0x15, 0x07, 0x8b, 0x20, 0x6b, 0x0a, 0x09, 0x00, 0x07, 0x36, 0x1d, 0x16, 0x07,
+    0x53, 0x03, 0x53, 0x03, 0x06, 0x03, 0xc7, 0x80, 0x7f, 0x05, 0x1f, 0xf2, 0x03, 0x5b, 0x22, 0x48, 0x07, 0x09, 0x00, 0x07, 0x06, 0x1f, 0xf3, 0x03,
+    0x53, 0x03, 0x53, 0x03, 0x06, 0x03, 0xc7, 0x80, 0x7f, 0xa5, 0x22, 0xf2, 0x03, 0xfb, 0x25, 0x48, 0x07, 0x09, 0x00, 0x07, 0xa6, 0x22, 0xf3, 0x03,
+    0x53, 0x03, 0x53, 0x03, 0x06, 0x00, 0xc8, 0x80, 0x80, 0x28, 0x1f, 0x6b, 0x05, 0xdb, 0x25, 0x18, 0x0c, 0x09, 0x00, 0x07, 0x2a, 0x1f, 0x6d, 0x05,
+    0xb0, 0x06, 0xaa, 0x06, 0x06, 0x00, 0xc6, 0x7f, 0x80, 0x02, 0x62, 0xc8, 0xff, 0xfe, 0x63, 0xbe, 0x01, 0x09, 0x00, 0x07, 0x03, 0x62, 0xca, 0xff,
+    0xfa, 0x01, 0xf3, 0x01, 0x06, 0x00, 0xc5, 0x80, 0x80, 0x82, 0x61, 0x85, 0x01, 0x78, 0x63, 0x7e, 0x03, 0x3a, 0x00, 0x01, 0x76, 0x63, 0x83, 0x02,
+    0x03, 0x76, 0x63, 0x0d, 0x03, 0x06, 0x63, 0x7d, 0x03, 0x7d, 0x62, 0x7d, 0x03, 0x03, 0xf3, 0x61, 0x7d, 0x03, 0x83, 0x61, 0x0d, 0x03, 0x83, 0x61,
+    0x83, 0x02, 0x03, 0x83, 0x61, 0xfa, 0x01, 0xf3, 0x61, 0x8a, 0x01, 0x7d, 0x62, 0x8a, 0x01, 0x03, 0x06, 0x63, 0x86, 0x01, 0x76, 0x63, 0xf6, 0x01,
+    0x76, 0x63, 0x83, 0x02, 0x04, 0x06, 0x00, 0xc5, 0x7f, 0x80, 0x1f, 0x60, 0xb8, 0x02, 0x15, 0x62, 0xb1, 0x04, 0x3a, 0x00, 0x01, 0x13, 0x62, 0xb6,
+    0x03, 0x03, 0x13, 0x62, 0x40, 0x04, 0xa3, 0x61, 0xb0, 0x04, 0x1a, 0x61, 0xb0, 0x04, 0x03, 0x90, 0x60, 0xb0, 0x04, 0x20, 0x60, 0x40, 0x04, 0x20,
+    0x60, 0xb6, 0x03, 0x03, 0x20, 0x60, 0x2d, 0x03, 0x90, 0x60, 0xbd, 0x02, 0x1a, 0x61, 0xbd, 0x02, 0x03, 0xa3, 0x61, 0xba, 0x02, 0x13, 0x62, 0x2a,
+    0x03, 0x13, 0x62, 0xb6, 0x03, 0x04, 0x06, 0x00, 0xc6, 0x7f, 0x80, 0x4f, 0x5e, 0xfb, 0x02, 0x45, 0x60, 0xf1, 0x04, 0x09, 0x00, 0x07, 0x50, 0x5e,
+    0xfd, 0x02, 0xf3, 0x01, 0xf3, 0x01, 0x06, 0x00, 0xc6, 0x80, 0x80, 0xa5, 0x5c, 0x38, 0x02, 0x9b, 0x5e, 0x2e, 0x04, 0x09, 0x00, 0x07, 0xa6, 0x5c,
+    0x3a, 0x02, 0xf3, 0x01, 0xf3, 0x01, 0x06, 0x00, 0xc6, 0x80, 0x7f, 0xa8, 0x5b, 0xaf, 0x00, 0x9e, 0x5d, 0xa5, 0x02, 0x09, 0x00, 0x07, 0xaa, 0x5b,
+    0xb0, 0x00, 0xf3, 0x01, 0xf3, 0x01, 0x06, 0x00, 0xc5, 0x80, 0x80, 0xa8, 0x5b, 0xd8, 0xfe, 0x9e, 0x5d, 0xd1, 0x00, 0x3a, 0x00, 0x01, 0x9d, 0x5d,
+    0xd6, 0xff, 0x03, 0x9d, 0x5d, 0x60, 0x00, 0x2d, 0x5d, 0xd0, 0x00, 0xa3, 0x5c, 0xd0, 0x00, 0x03, 0x1a, 0x5c, 0xd0, 0x00, 0xaa, 0x5b, 0x60, 0x00,
+    0xaa, 0x5b, 0xd6, 0xff, 0x03, 0xaa, 0x5b, 0x4d, 0xff, 0x1a, 0x5c, 0xdd, 0xfe, 0xa3, 0x5c, 0xdd, 0xfe, 0x03, 0x2d, 0x5d, 0xda, 0xfe, 0x9d, 0x5d,
+    0x4a, 0xff, 0x9d, 0x5d, 0xd6, 0xff, 0x04, 0x06, 0x00, 0xc5, 0x80, 0x80, 0xa5, 0x5c, 0x4f, 0xfd, 0x9b, 0x5e, 0x48, 0xff, 0x3a, 0x00, 0x01, 0x9a,
+    0x5e, 0x4d, 0xfe, 0x03, 0x9a, 0x5e, 0xd6, 0xfe, 0x2a, 0x5e, 0x46, 0xff, 0xa0, 0x5d, 0x46, 0xff, 0x03, 0x16, 0x5d, 0x46, 0xff, 0xa6, 0x5c, 0xd6,
+    0xfe, 0xa6, 0x5c, 0x4d, 0xfe, 0x03, 0xa6, 0x5c, 0xc3, 0xfd, 0x16, 0x5d, 0x53, 0xfd, 0xa0, 0x5d, 0x53, 0xfd, 0x03, 0x2a, 0x5e, 0x50, 0xfd, 0x9a,
+    0x5e, 0xc0, 0xfd, 0x9a, 0x5e, 0x4d, 0xfe, 0x04, 0x06, 0x00, 0xc5, 0x7f, 0x80, 0x4f, 0x5e, 0x8b, 0xfc, 0x45, 0x60, 0x85, 0xfe, 0x3a, 0x00, 0x01,
+    0x43, 0x60, 0x8a, 0xfd, 0x03, 0x43, 0x60, 0x13, 0xfe, 0xd3, 0x5f, 0x83, 0xfe, 0x4a, 0x5f, 0x83, 0xfe, 0x03, 0xc0, 0x5e, 0x83, 0xfe, 0x50, 0x5e,
+    0x13, 0xfe, 0x50, 0x5e, 0x8a, 0xfd, 0x03, 0x50, 0x5e, 0x00, 0xfd, 0xc0, 0x5e, 0x90, 0xfc, 0x4a, 0x5f, 0x90, 0xfc, 0x03, 0xd3, 0x5f, 0x8d, 0xfc,
+    0x43, 0x60, 0xfd, 0xfc, 0x43, 0x60, 0x8a, 0xfd, 0x04, 0x06, 0x00, 0xc6, 0x7f, 0x7f, 0x1f, 0x60, 0xcf, 0xfc, 0x15, 0x62, 0xc5, 0xfe, 0x09, 0x00,
+    0x07, 0x20, 0x60, 0xd0, 0xfc, 0xf3, 0x01, 0xf3, 0x01, 0x06, 0x00, 0xc6, 0x7f, 0x7f, 0x82, 0x61, 0x02, 0xfe, 0x78, 0x63, 0xf8, 0xff, 0x09, 0x00,
+    0x07, 0x83, 0x61, 0x03, 0xfe, 0xf3, 0x01, 0xf3, 0x01, 0x06, 0x02, 0xc8, 0x80, 0x80, 0x45, 0x5c, 0x45, 0xfd, 0x3b, 0x63, 0x3b, 0x04, 0x09, 0x00,
+    0x07, 0x46, 0x5c, 0x46, 0xfd, 0xf3, 0x06, 0xf3, 0x06, 0x06, 0x00, 0xc6, 0x80, 0x80, 0x75, 0x4b, 0x18, 0x3b, 0xce, 0x4d, 0x6b, 0x3d, 0x09, 0x00,
+    0x07, 0x76, 0x4b, 0x1a, 0x3b, 0x56, 0x02, 0x50, 0x02, 0x06, 0x00, 0xc6, 0x80, 0x80, 0xa5, 0x4a, 0x0b, 0x3d, 0xfe, 0x4c, 0x5e, 0x3f, 0x09, 0x00,
+    0x07, 0xa6, 0x4a, 0x0d, 0x3d, 0x56, 0x02, 0x50, 0x02, 0x06, 0x00, 0xc6, 0x80, 0x80, 0xb5, 0x48, 0xd8, 0x3d, 0x0e, 0x4b, 0x2b, 0x40, 0x09, 0x00,
+    0x07, 0xb6, 0x48, 0xda, 0x3d, 0x56, 0x02, 0x50, 0x02, 0x06, 0x00, 0xc6, 0x7f, 0x80, 0xc2, 0x46, 0x0b, 0x3d, 0x1b, 0x49, 0x5e, 0x3f, 0x09, 0x00,
+    0x07, 0xc3, 0x46, 0x0d, 0x3d, 0x56, 0x02, 0x50, 0x02, 0x06, 0x00, 0xc6, 0x80, 0x80, 0xf5, 0x45, 0x18, 0x3b, 0x4e, 0x48, 0x6b, 0x3d, 0x09, 0x00,
+    0x07, 0xf6, 0x45, 0x1a, 0x3b, 0x56, 0x02, 0x50, 0x02, 0x06, 0x00, 0xc6, 0x7f, 0x7f, 0xc2, 0x46, 0x22, 0x39, 0x18, 0x49, 0x78, 0x3b, 0x3a, 0x00,
+    0x01, 0x16, 0x49, 0x4d, 0x3a, 0x03, 0x16, 0x49, 0xf0, 0x3a, 0x90, 0x48, 0x76, 0x3b, 0xed, 0x47, 0x76, 0x3b, 0x03, 0x4a, 0x47, 0x76, 0x3b, 0xc3,
+    0x46, 0xf0, 0x3a, 0xc3, 0x46, 0x4d, 0x3a, 0x03, 0xc3, 0x46, 0xaa, 0x39, 0x4a, 0x47, 0x23, 0x39, 0xed, 0x47, 0x23, 0x39, 0x03, 0x93, 0x48, 0x26,
+    0x39, 0x16, 0x49, 0xaa, 0x39, 0x16, 0x49, 0x4d, 0x3a, 0x04, 0x06, 0x00, 0xc6, 0x80, 0x80, 0xb5, 0x48, 0x58, 0x38, 0x0e, 0x4b, 0xab, 0x3a, 0x09,
+    0x00, 0x07, 0xb6, 0x48, 0x5a, 0x38, 0x56, 0x02, 0x50, 0x02, 0x06, 0x00, 0xc6, 0x7f, 0x7f, 0xa5, 0x4a, 0x22, 0x39, 0xfb, 0x4c, 0x78, 0x3b, 0x3a,
+    0x00, 0x01, 0xfa, 0x4c, 0x4d, 0x3a, 0x03, 0xfa, 0x4c, 0xf0, 0x3a, 0x73, 0x4c, 0x76, 0x3b, 0xd0, 0x4b, 0x76, 0x3b, 0x03, 0x2d, 0x4b, 0x76, 0x3b,
+    0xa6, 0x4a, 0xf0, 0x3a, 0xa6, 0x4a, 0x4d, 0x3a, 0x03, 0xa6, 0x4a, 0xaa, 0x39, 0x2d, 0x4b, 0x23, 0x39, 0xd0, 0x4b, 0x23, 0x39, 0x03, 0x76, 0x4c,
+    0x26, 0x39, 0xfa, 0x4c, 0xaa, 0x39, 0xfa, 0x4c, 0x4d, 0x3a, 0x04, 0x06, 0x03, 0xc7, 0x7f, 0x7f, 0xd5, 0x46, 0x38, 0x39, 0xe8, 0x4c, 0x45, 0x3f,
+    0x09, 0x00, 0x07, 0xd6, 0x46, 0x3a, 0x39, 0x10, 0x06, 0x0a, 0x06, 0x06, 0x06, 0xc6, 0x80, 0x80, 0xa0, 0x59, 0x03, 0x43, 0xa0, 0x5c, 0xfd, 0x45,
+    0x09, 0x00, 0x07, 0xa2, 0x59, 0x05, 0x43, 0xfd, 0x02, 0xf6, 0x02, 0x06, 0x06, 0xc6, 0x7f, 0x80, 0x6b, 0x58, 0xeb, 0x45, 0x68, 0x5b, 0xe8, 0x48,
+    0x3a, 0x00, 0x01, 0x66, 0x5b, 0x6a, 0x47, 0x03, 0x66, 0x5b, 0x3d, 0x48, 0xbd, 0x5a, 0xe6, 0x48, 0xea, 0x59, 0xe6, 0x48, 0x03, 0x16, 0x59, 0xe6,
+    0x48, 0x6d, 0x58, 0x3d, 0x48, 0x6d, 0x58, 0x6a, 0x47, 0x03, 0x6d, 0x58, 0x96, 0x46, 0x16, 0x59, 0xed, 0x45, 0xea, 0x59, 0xed, 0x45, 0x03, 0xbd,
+    0x5a, 0xf0, 0x45, 0x66, 0x5b, 0x9a, 0x46, 0x66, 0x5b, 0x6a, 0x47, 0x04, 0x06, 0x06, 0xc6, 0x80, 0x80, 0x80, 0x55, 0x23, 0x47, 0x80, 0x58, 0x1d,
+    0x4a, 0x09, 0x00, 0x07, 0x82, 0x55, 0x25, 0x47, 0xfd, 0x02, 0xf6, 0x02, 0x06, 0x06, 0xc6, 0x7f, 0x80, 0x95, 0x52, 0xeb, 0x45, 0x91, 0x55, 0xe8,
+    0x48, 0x3a, 0x00, 0x01, 0x90, 0x55, 0x6a, 0x47, 0x03, 0x90, 0x55, 0x3d, 0x48, 0xe6, 0x54, 0xe6, 0x48, 0x13, 0x54, 0xe6, 0x48, 0x03, 0x40, 0x53,
+    0xe6, 0x48, 0x96, 0x52, 0x3d, 0x48, 0x96, 0x52, 0x6a, 0x47, 0x03, 0x96, 0x52, 0x96, 0x46, 0x40, 0x53, 0xed, 0x45, 0x13, 0x54, 0xed, 0x45, 0x03,
+    0xe6, 0x54, 0xf0, 0x45, 0x90, 0x55, 0x9a, 0x46, 0x90, 0x55, 0x6a, 0x47, 0x04, 0x06, 0x06, 0xc6, 0x80, 0x80, 0x60, 0x51, 0x03, 0x43, 0x60, 0x54,
+    0xfd, 0x45, 0x09, 0x00, 0x07, 0x62, 0x51, 0x05, 0x43, 0xfd, 0x02, 0xf6, 0x02, 0x06, 0x06, 0xc7, 0x80, 0x7f, 0x93, 0x52, 0x1a, 0x40, 0x93, 0x55,
+    0x13, 0x43, 0x09, 0x00, 0x07, 0x95, 0x52, 0x1b, 0x40, 0xfd, 0x02, 0xf6, 0x02, 0x06, 0x06, 0xc6, 0x80, 0x80, 0x80, 0x55, 0xe3, 0x3e, 0x80, 0x58,
+    0xdd, 0x41, 0x09, 0x00, 0x07, 0x82, 0x55, 0xe5, 0x3e, 0xfd, 0x02, 0xf6, 0x02, 0x06, 0x06, 0xc7, 0x80, 0x7f, 0x6a, 0x58, 0x1a, 0x40, 0x69, 0x5b,
+    0x13, 0x43, 0x09, 0x00, 0x07, 0x6b, 0x58, 0x1b, 0x40, 0xfd, 0x02, 0xf6, 0x02, 0x06, 0x04, 0xc8, 0x80, 0x7f, 0x1b, 0x53, 0xa2, 0x40, 0xe5, 0x5a,
+    0x65, 0x48, 0x09, 0x00, 0x07, 0x1d, 0x53, 0xa3, 0x40, 0xc6, 0x07, 0xc0, 0x07, 0x06, 0x04, 0xc7, 0x80, 0x80, 0x2f, 0x52, 0x8f, 0x28, 0x91, 0x54,
+    0xf1, 0x2a, 0x09, 0x00, 0x07, 0x30, 0x52, 0x90, 0x28, 0x60, 0x02, 0x60, 0x02, 0x06, 0x04, 0xc7, 0x80, 0x80, 0x98, 0x51, 0xbf, 0x2a, 0xfb, 0x53,
+    0x21, 0x2d, 0x09, 0x00, 0x07, 0x9a, 0x51, 0xc0, 0x2a, 0x60, 0x02, 0x60, 0x02, 0x06, 0x04, 0xc7, 0x80, 0x80, 0xff, 0x4f, 0x58, 0x2c, 0x61, 0x52,
+    0xbb, 0x2e, 0x09, 0x00, 0x07, 0x00, 0x50, 0x5a, 0x2c, 0x60, 0x02, 0x60, 0x02, 0x06, 0x04, 0xc7, 0x80, 0x80, 0xcf, 0x4d, 0xef, 0x2c, 0x31, 0x50,
+    0x51, 0x2f, 0x09, 0x00, 0x07, 0xd0, 0x4d, 0xf0, 0x2c, 0x60, 0x02, 0x60, 0x02, 0x06, 0x04, 0xc7, 0x80, 0x80, 0x9f, 0x4b, 0x58, 0x2c, 0x01, 0x4e,
+    0xbb, 0x2e, 0x09, 0x00, 0x07, 0xa0, 0x4b, 0x5a, 0x2c, 0x60, 0x02, 0x60, 0x02, 0x06, 0x04, 0xc7, 0x7f, 0x80, 0x05, 0x4a, 0xbf, 0x2a, 0x68, 0x4c,
+    0x21, 0x2d, 0x09, 0x00, 0x07, 0x06, 0x4a, 0xc0, 0x2a, 0x60, 0x02, 0x60, 0x02, 0x06, 0x04, 0xc7, 0x80, 0x80, 0x6f, 0x49, 0x8f, 0x28, 0xd1, 0x4b,
+    0xf1, 0x2a, 0x09, 0x00, 0x07, 0x70, 0x49, 0x90, 0x28, 0x60, 0x02, 0x60, 0x02, 0x06, 0x04, 0xc7, 0x7f, 0x80, 0x05, 0x4a, 0x5f, 0x26, 0x68, 0x4c,
+    0xc1, 0x28, 0x09, 0x00, 0x07, 0x06, 0x4a, 0x60, 0x26, 0x60, 0x02, 0x60, 0x02, 0x06, 0x04, 0xc7, 0x80, 0x7f, 0x9f, 0x4b, 0xc5, 0x24, 0x01, 0x4e,
+    0x28, 0x27, 0x09, 0x00, 0x07, 0xa0, 0x4b, 0xc6, 0x24, 0x60, 0x02, 0x60, 0x02, 0x06, 0x04, 0xc7, 0x80, 0x80, 0xcf, 0x4d, 0x2f, 0x24, 0x31, 0x50,
+    0x91, 0x26, 0x09, 0x00, 0x07, 0xd0, 0x4d, 0x30, 0x24, 0x60, 0x02, 0x60, 0x02, 0x06, 0x04, 0xc7, 0x80, 0x7f, 0xff, 0x4f, 0xc5, 0x24, 0x61, 0x52,
+    0x28, 0x27, 0x09, 0x00, 0x07, 0x00, 0x50, 0xc6, 0x24, 0x60, 0x02, 0x60, 0x02, 0x06, 0x04, 0xc7, 0x80, 0x80, 0x98, 0x51, 0x5f, 0x26, 0xfb, 0x53,
+    0xc1, 0x28, 0x09, 0x00, 0x07, 0x9a, 0x51, 0x60, 0x26, 0x60, 0x02, 0x60, 0x02, 0x06, 0x02, 0xc8, 0x80, 0x7f, 0x68, 0x4a, 0x25, 0x25, 0x9b, 0x53,
+    0x58, 0x2e, 0x09, 0x00, 0x07, 0x6a, 0x4a, 0x26, 0x25, 0x30, 0x09, 0x30, 0x09, 0x06, 0x00, 0xc5, 0x7f, 0x80, 0xdb, 0x1c, 0x38, 0x06, 0xa8, 0x1e,
+    0x05, 0x08, 0x3a, 0x00, 0x01, 0xa6, 0x1e, 0x20, 0x07, 0x03, 0xa6, 0x1e, 0x9d, 0x07, 0x40, 0x1e, 0x03, 0x08, 0xc0, 0x1d, 0x03, 0x08, 0x03, 0x40,
+    0x1d, 0x03, 0x08, 0xdd, 0x1c, 0x9d, 0x07, 0xdd, 0x1c, 0x1d, 0x07, 0x03, 0xdd, 0x1c, 0xa0, 0x06, 0x43, 0x1d, 0x3a, 0x06, 0xc3, 0x1d, 0x3a, 0x06,
+    0x03, 0x3d, 0x1e, 0x3a, 0x06, 0xa3, 0x1e, 0xa0, 0x06, 0xa6, 0x1e, 0x20, 0x07, 0x04, 0x06, 0x00, 0xc5, 0x7f, 0x80, 0x18, 0x1c, 0xc8, 0x07, 0xe5,
+    0x1d, 0x95, 0x09, 0x3a, 0x00, 0x01, 0xe3, 0x1d, 0xb0, 0x08, 0x03, 0xe3, 0x1d, 0x2d, 0x09, 0x7d, 0x1d, 0x93, 0x09, 0xfd, 0x1c, 0x93, 0x09, 0x03,
+    0x7d, 0x1c, 0x93, 0x09, 0x1a, 0x1c, 0x2d, 0x09, 0x1a, 0x1c, 0xad, 0x08, 0x03, 0x1a, 0x1c, 0x30, 0x08, 0x80, 0x1c, 0xca, 0x07, 0x00, 0x1d, 0xca,
+    0x07, 0x03, 0x7d, 0x1d, 0xcd, 0x07, 0xe3, 0x1d, 0x33, 0x08, 0xe3, 0x1d, 0xb0, 0x08, 0x04, 0x06, 0x00, 0xc5, 0x7f, 0x80, 0x68, 0x1a, 0x2b, 0x08,
+    0x35, 0x1c, 0xf8, 0x09, 0x09, 0x00, 0x07, 0x6a, 0x1a, 0x2d, 0x08, 0xca, 0x01, 0xca, 0x01, 0x01, 0x03, 0xf3, 0x19, 0x00, 0x08, 0x04, 0xc7, 0x06,
+    0x06, 0x00, 0xc5, 0x80, 0x80, 0x1b, 0xff, 0x18, 0xff, 0xe5, 0x00, 0xe8, 0x00, 0x09, 0x00, 0x07, 0x1d, 0xff, 0x1a, 0xff, 0xc6, 0x01, 0xcd, 0x01,
+    0x02, 0x06, 0x00, 0xc4, 0x80, 0x80, 0x0b, 0x19, 0x5b, 0x05, 0xd8, 0x1a, 0x2b, 0x07, 0x3a, 0x00, 0x01, 0xd6, 0x1a, 0x43, 0x06, 0x03, 0xd6, 0x1a,
+    0xc0, 0x06, 0x70, 0x1a, 0x2a, 0x07, 0xf3, 0x19, 0x2a, 0x07, 0x03, 0x76, 0x19, 0x2a, 0x07, 0x0d, 0x19, 0xc3, 0x06, 0x0d, 0x19, 0x46, 0x06, 0x03,
+    0x0d, 0x19, 0xca, 0x05, 0x73, 0x19, 0x60, 0x05, 0xf0, 0x19, 0x60, 0x05, 0x03, 0x70, 0x1a, 0x5d, 0x05, 0xd6, 0x1a, 0xc3, 0x05, 0xd6, 0x1a, 0x43,
+    0x06, 0x04, 0x06, 0x00, 0xc6, 0x7f, 0x80, 0x68, 0x1a, 0x45, 0x04, 0x35, 0x1c, 0x11, 0x06, 0x09, 0x00, 0x07, 0x6a, 0x1a, 0x46, 0x04, 0xca, 0x01,
+    0xca, 0x01, 0x06, 0x00, 0xc5, 0x7f, 0x7f, 0x18, 0x1c, 0xa8, 0x04, 0xe5, 0x1d, 0x75, 0x06, 0x09, 0x00, 0x07, 0x1a, 0x1c, 0xaa, 0x04, 0xca, 0x01,
+    0xca, 0x01, 0x06, 0x02, 0xc8, 0x7f, 0x80, 0xaf, 0x19, 0x0f, 0x05, 0xd1, 0x1d, 0x31, 0x09, 0x09, 0x00, 0x07, 0xb0, 0x19, 0x10, 0x05, 0x20, 0x04,
+    0x20, 0x04, 0x06, 0x03, 0xc7, 0x80, 0x80, 0x05, 0x30, 0xa5, 0x42, 0x3b, 0x34, 0xdb, 0x46, 0x09, 0x00, 0x07, 0x06, 0x30, 0xa6, 0x42, 0x33, 0x04,
+    0x33, 0x04, 0x06, 0x03, 0xc7, 0x80, 0x80, 0x98, 0x2d, 0xf8, 0x45, 0xce, 0x31, 0x2e, 0x4a, 0x09, 0x00, 0x07, 0x9a, 0x2d, 0xfa, 0x45, 0x33, 0x04,
+    0x33, 0x04, 0x06, 0x03, 0xc7, 0x7f, 0x80, 0xaf, 0x29, 0xb5, 0x44, 0xe5, 0x2d, 0xeb, 0x48, 0x09, 0x00, 0x07, 0xb0, 0x29, 0xb6, 0x44, 0x33, 0x04,
+    0x33, 0x04, 0x06, 0x03, 0xc7, 0x7f, 0x80, 0xaf, 0x29, 0x95, 0x40, 0xe5, 0x2d, 0xcb, 0x44, 0x09, 0x00, 0x07, 0xb0, 0x29, 0x96, 0x40, 0x33, 0x04,
+    0x33, 0x04, 0x06, 0x03, 0xc7, 0x80, 0x7f, 0x98, 0x2d, 0x52, 0x3f, 0xce, 0x31, 0x88, 0x43, 0x09, 0x00, 0x07, 0x9a, 0x2d, 0x53, 0x3f, 0x33, 0x04,
+    0x33, 0x04, 0x06, 0x00, 0xc8, 0x80, 0x80, 0x0b, 0x2b, 0x2b, 0x41, 0x35, 0x32, 0x4e, 0x48, 0x09, 0x00, 0x07, 0x0d, 0x2b, 0x2d, 0x41, 0x26, 0x07,
+    0x20, 0x07, 0x06, 0x00, 0xc7, 0x7f, 0x80, 0xe5, 0x35, 0x45, 0x19, 0x5b, 0x38, 0xbb, 0x1b, 0x09, 0x00, 0x07, 0xe6, 0x35, 0x46, 0x19, 0x73, 0x02,
+    0x73, 0x02, 0x06, 0x00, 0xc6, 0x7f, 0x80, 0x28, 0x35, 0x8b, 0x1b, 0x9e, 0x37, 0x01, 0x1e, 0x3a, 0x00, 0x01, 0x9d, 0x37, 0xc6, 0x1c, 0x03, 0x9d,
+    0x37, 0x73, 0x1d, 0x10, 0x37, 0x00, 0x1e, 0x63, 0x36, 0x00, 0x1e, 0x03, 0xb6, 0x35, 0x00, 0x1e, 0x2a, 0x35, 0x73, 0x1d, 0x2a, 0x35, 0xc6, 0x1c,
+    0x03, 0x2a, 0x35, 0x1a, 0x1c, 0xb6, 0x35, 0x8d, 0x1b, 0x63, 0x36, 0x8d, 0x1b, 0x03, 0x10, 0x37, 0x8d, 0x1b, 0x9a, 0x37, 0x1a, 0x1c, 0x9d, 0x37,
+    0xc6, 0x1c, 0x04, 0x06, 0x00, 0xc6, 0x7f, 0x80, 0x38, 0x33, 0xf5, 0x1c, 0xae, 0x35, 0x6b, 0x1f, 0x3a, 0x00, 0x01, 0xad, 0x35, 0x30, 0x1e, 0x03,
+    0xad, 0x35, 0xdd, 0x1e, 0x20, 0x35, 0x6a, 0x1f, 0x73, 0x34, 0x6a, 0x1f, 0x03, 0xc6, 0x33, 0x6a, 0x1f, 0x3a, 0x33, 0xdd, 0x1e, 0x3a, 0x33, 0x30,
+    0x1e, 0x03, 0x3a, 0x33, 0x83, 0x1d, 0xc6, 0x33, 0xf6, 0x1c, 0x73, 0x34, 0xf6, 0x1c, 0x03, 0x20, 0x35, 0xf6, 0x1c, 0xaa, 0x35, 0x83, 0x1d, 0xad,
+    0x35, 0x30, 0x1e, 0x04, 0x06, 0x00, 0xc7, 0x7f, 0x80, 0xd2, 0x30, 0xf5, 0x1c, 0x48, 0x33, 0x6b, 0x1f, 0x09, 0x00, 0x07, 0xd3, 0x30, 0xf6, 0x1c,
+    0x73, 0x02, 0x73, 0x02, 0x06, 0x00, 0xc7, 0x7f, 0x80, 0xe2, 0x2e, 0x8b, 0x1b, 0x58, 0x31, 0x01, 0x1e, 0x09, 0x00, 0x07, 0xe3, 0x2e, 0x8d, 0x1b,
+    0x73, 0x02, 0x73, 0x02, 0x06, 0x00, 0xc7, 0x80, 0x80, 0x25, 0x2e, 0x45, 0x19, 0x9b, 0x30, 0xbb, 0x1b, 0x09, 0x00, 0x07, 0x26, 0x2e, 0x46, 0x19,
+    0x73, 0x02, 0x73, 0x02, 0x06, 0x00, 0xc7, 0x7f, 0x7f, 0xe2, 0x2e, 0xff, 0x16, 0x58, 0x31, 0x75, 0x19, 0x09, 0x00, 0x07, 0xe3, 0x2e, 0x00, 0x17,
+    0x73, 0x02, 0x73, 0x02, 0x06, 0x00, 0xc7, 0x7f, 0x80, 0xd2, 0x30, 0x95, 0x15, 0x48, 0x33, 0x0b, 0x18, 0x09, 0x00, 0x07, 0xd3, 0x30, 0x96, 0x15,
+    0x73, 0x02, 0x73, 0x02, 0x06, 0x00, 0xc6, 0x7f, 0x80, 0x38, 0x33, 0x95, 0x15, 0xae, 0x35, 0x0b, 0x18, 0x3a, 0x00, 0x01, 0xad, 0x35, 0xd0, 0x16,
+    0x03, 0xad, 0x35, 0x7d, 0x17, 0x20, 0x35, 0x0a, 0x18, 0x73, 0x34, 0x0a, 0x18, 0x03, 0xc6, 0x33, 0x0a, 0x18, 0x3a, 0x33, 0x7d, 0x17, 0x3a, 0x33,
+    0xd0, 0x16, 0x03, 0x3a, 0x33, 0x23, 0x16, 0xc6, 0x33, 0x96, 0x15, 0x73, 0x34, 0x96, 0x15, 0x03, 0x20, 0x35, 0x96, 0x15, 0xaa, 0x35, 0x23, 0x16,
+    0xad, 0x35, 0xd0, 0x16, 0x04, 0x06, 0x00, 0xc6, 0x7f, 0x7f, 0x28, 0x35, 0xff, 0x16, 0x9e, 0x37, 0x75, 0x19, 0x3a, 0x00, 0x01, 0x9d, 0x37, 0x3a,
+    0x18, 0x03, 0x9d, 0x37, 0xe6, 0x18, 0x10, 0x37, 0x73, 0x19, 0x63, 0x36, 0x73, 0x19, 0x03, 0xb6, 0x35, 0x73, 0x19, 0x2a, 0x35, 0xe6, 0x18, 0x2a,
+    0x35, 0x3a, 0x18, 0x03, 0x2a, 0x35, 0x8d, 0x17, 0xb6, 0x35, 0x00, 0x17, 0x63, 0x36, 0x00, 0x17, 0x03, 0x10, 0x37, 0x00, 0x17, 0x9a, 0x37, 0x8d,
+    0x17, 0x9d, 0x37, 0x3a, 0x18, 0x04, 0x06, 0x03, 0xc8, 0x80, 0x80, 0x4b, 0x2f, 0x8b, 0x16, 0x35, 0x37, 0x75, 0x1e, 0x09, 0x00, 0x07, 0x4d, 0x2f,
+    0x8d, 0x16, 0xe6, 0x07, 0xe6, 0x07, 0x06, 0x03, 0xc4, 0x80, 0x80, 0x45, 0x0c, 0xe5, 0x19, 0x3b, 0x0d, 0xdb, 0x1a, 0x09, 0x00, 0x07, 0x46, 0x0c,
+    0xe6, 0x19, 0xf3, 0x00, 0xf3, 0x00, 0x06, 0x03, 0xc1, 0x7f, 0x81, 0xdf, 0x0b, 0xdb, 0x1a, 0xd5, 0x0c, 0xd5, 0x1b, 0x3a, 0x00, 0x01, 0xd3, 0x0c,
+    0x5a, 0x1b, 0x03, 0xd3, 0x0c, 0x9d, 0x1b, 0x9d, 0x0c, 0xd3, 0x1b, 0x5a, 0x0c, 0xd3, 0x1b, 0x03, 0x16, 0x0c, 0xd3, 0x1b, 0xe0, 0x0b, 0x9d, 0x1b,
+    0xe0, 0x0b, 0x5a, 0x1b, 0x03, 0xe0, 0x0b, 0x16, 0x1b, 0x16, 0x0c, 0xe0, 0x1a, 0x5a, 0x0c, 0xe0, 0x1a, 0x03, 0x9d, 0x0c, 0xdd, 0x1a, 0xd3, 0x0c,
+    0x16, 0x1b, 0xd3, 0x0c, 0x5a, 0x1b, 0x04, 0x06, 0x03, 0xc4, 0x80, 0x80, 0xe5, 0x0a, 0x45, 0x1b, 0xdb, 0x0b, 0x3b, 0x1c, 0x09, 0x00, 0x07, 0xe6,
+    0x0a, 0x46, 0x1b, 0xf3, 0x00, 0xf3, 0x00, 0x06, 0x03, 0xc3, 0x7f, 0x7f, 0xef, 0x09, 0xdf, 0x1a, 0xe5, 0x0a, 0xd5, 0x1b, 0x3a, 0x00, 0x01, 0xe3,
+    0x0a, 0x5a, 0x1b, 0x03, 0xe3, 0x0a, 0x9d, 0x1b, 0xad, 0x0a, 0xd3, 0x1b, 0x6a, 0x0a, 0xd3, 0x1b, 0x03, 0x26, 0x0a, 0xd3, 0x1b, 0xf0, 0x09, 0x9d,
+    0x1b, 0xf0, 0x09, 0x5a, 0x1b, 0x03, 0xf0, 0x09, 0x16, 0x1b, 0x26, 0x0a, 0xe0, 0x1a, 0x6a, 0x0a, 0xe0, 0x1a, 0x03, 0xaa, 0x0a, 0xe0, 0x1a, 0xe0,
+    0x0a, 0x16, 0x1b, 0xe3, 0x0a, 0x5a, 0x1b, 0x04, 0x06, 0x03, 0xc4, 0x80, 0x80, 0x85, 0x09, 0xe5, 0x19, 0x7b, 0x0a, 0xdb, 0x1a, 0x09, 0x00, 0x07,
+    0x86, 0x09, 0xe6, 0x19, 0xf3, 0x00, 0xf3, 0x00, 0x06, 0x03, 0xc3, 0x7f, 0x80, 0xef, 0x09, 0xeb, 0x18, 0xe5, 0x0a, 0xe1, 0x19, 0x3a, 0x00, 0x01,
+    0xe3, 0x0a, 0x66, 0x19, 0x03, 0xe3, 0x0a, 0xaa, 0x19, 0xad, 0x0a, 0xe0, 0x19, 0x6a, 0x0a, 0xe0, 0x19, 0x03, 0x26, 0x0a, 0xe0, 0x19, 0xf0, 0x09,
+    0xaa, 0x19, 0xf0, 0x09, 0x66, 0x19, 0x03, 0xf0, 0x09, 0x23, 0x19, 0x26, 0x0a, 0xed, 0x18, 0x6a, 0x0a, 0xed, 0x18, 0x03, 0xaa, 0x0a, 0xed, 0x18,
+    0xe0, 0x0a, 0x23, 0x19, 0xe3, 0x0a, 0x66, 0x19, 0x04, 0x06, 0x03, 0xc4, 0x80, 0x80, 0xe5, 0x0a, 0x85, 0x18, 0xdb, 0x0b, 0x7b, 0x19, 0x09, 0x00,
+    0x07, 0xe6, 0x0a, 0x86, 0x18, 0xf3, 0x00, 0xf3, 0x00, 0x06, 0x03, 0xc4, 0x7f, 0x80, 0xdf, 0x0b, 0xeb, 0x18, 0xd5, 0x0c, 0xe1, 0x19, 0x09, 0x00,
+    0x07, 0xe0, 0x0b, 0xed, 0x18, 0xf3, 0x00, 0xf3, 0x00, 0x06, 0x06, 0xc7, 0x80, 0x80, 0x1f, 0x0a, 0x1f, 0x19, 0xa1, 0x0c, 0xa1, 0x1b, 0x09, 0x00,
+    0x07, 0x20, 0x0a, 0x20, 0x19, 0x80, 0x02, 0x80, 0x02, 0x06, 0x01, 0xff, 0x80, 0x80, 0x5f, 0x17, 0x1f, 0x28, 0x61, 0x62, 0xe1, 0x44, 0x0b, 0x00,
+    0x06, 0x60, 0x17, 0x20, 0x28, 0x00, 0x4b, 0xc0, 0x1c, 0xe0, 0x01, 0x01, 0x08, 0x00, 0x01, 0x40, 0x07, 0x60, 0x1c, 0x20, 0x2d, 0xa0, 0x42, 0xa0,
+    0x07, 0x02, 0x01, 0x08, 0x01, 0x00, 0x18, 0x07, 0x60, 0x1c, 0xc0, 0x37, 0xa0, 0x42, 0xe0, 0x03, 0x02, 0x01, 0x08, 0x02, 0x02, 0x18, 0x07, 0x60,
+    0x1c, 0x00, 0x3c, 0xa0, 0x42, 0xe0, 0x03, 0x02, 0x33, 0x00, 0x33, 0x00, 0x80, 0x00, 0x99, 0x00, 0x4c, 0x00, 0xcc, 0x00, 0xb2, 0x00, 0xff, 0x00,
+    0x66, 0x00, 0x1a, 0x00, 0xe6, 0x01, 0x33, 0x01, 0xff, 0x01, 0x66, 0x01, 0x1a, 0x01, 0xb2, 0x01, 0x99, 0x01, 0xe6, 0x01, 0x80, 0x01, 0x4c, 0x01,
+    0xcc, 0x02, 0x1a, 0x02, 0xe6, 0x02, 0x66, 0x02, 0xcc, 0x02, 0x80, 0x02, 0x33, 0x02, 0x4c, 0x02, 0xff, 0x02, 0xb2, 0x02, 0x99, 0x03, 0x4c, 0x03,
+    0x1a, 0x03, 0x33, 0x03, 0xe6, 0x03, 0xb2, 0x03, 0x99, 0x03, 0x80, 0x03, 0xcc, 0x03, 0xff, 0x03, 0x66, 0x04, 0x33, 0x04, 0x4c, 0x04, 0x66, 0x04,
+    0x99, 0x04, 0x80, 0x04, 0xb2, 0x04, 0xe6, 0x04, 0xcc, 0x04, 0xff, 0x04, 0x1a, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xb4, 0x63, 0x00, 0x00, 0x06,
+    0x32, 0xff, 0x80, 0x80, 0xff, 0xff, 0xff, 0xff, 0x01, 0x60, 0x01, 0x60, 0x09, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x60, 0x06,
+    0x32, 0xff, 0x80, 0x80, 0xff, 0xff, 0xff, 0xff, 0x01, 0x60, 0x01, 0x60, 0x09, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x60, 0x06,
+    0x1d, 0xc7, 0x80, 0x7f, 0xbd, 0x04, 0x00, 0x49, 0xc3, 0x07, 0x00, 0x4c, 0x09, 0x00, 0x07, 0xbe, 0x04, 0x02, 0x49, 0x03, 0x03, 0xfd, 0x02, 0x06,
+    0x27, 0xc8, 0x80, 0x80, 0xff, 0x54, 0x9f, 0x56, 0x81, 0x5a, 0x21, 0x5c, 0x09, 0x00, 0x07, 0x00, 0x55, 0xa0, 0x56, 0x80, 0x05, 0x80, 0x05, 0x06,
+    0x06, 0xc7, 0x80, 0x80, 0x5f, 0x5b, 0xdf, 0x5e, 0x61, 0x5d, 0xe1, 0x60, 0x09, 0x00, 0x07, 0x60, 0x5b, 0xe0, 0x5e, 0x00, 0x02, 0x00, 0x02, 0x06,
+    0x1d, 0xc5, 0x80, 0x80, 0xff, 0x2a, 0x5f, 0x0f, 0x01, 0x2c, 0x61, 0x10, 0x09, 0x00, 0x07, 0x00, 0x2b, 0x60, 0x0f, 0x00, 0x01, 0x00, 0x01, 0x06,
+    0x14, 0xc7, 0x7f, 0x80, 0x3f, 0x4a, 0x62, 0x4c, 0x45, 0x4f, 0x61, 0x51, 0x09, 0x00, 0x07, 0x40, 0x4a, 0x63, 0x4c, 0x03, 0x05, 0xfd, 0x04, 0x01,
+    0x03, 0xfe, 0x26, 0x5e, 0x30, 0x04, 0xe0, 0x06, 0x06, 0x1e, 0xc5, 0x80, 0x80, 0x5d, 0xff, 0x60, 0xff, 0xa3, 0x00, 0xa0, 0x00, 0x09, 0x00, 0x07,
+    0x5e, 0xff, 0x62, 0xff, 0x43, 0x01, 0x3d, 0x01, 0x02, 0x06, 0x15, 0xc5, 0x80, 0x80, 0x5f, 0x1c, 0x7f, 0x37, 0x61, 0x1d, 0x81, 0x38, 0x09, 0x00,
+    0x07, 0x60, 0x1c, 0x80, 0x37, 0x00, 0x01, 0x00, 0x01, 0x06, 0x06, 0xc5, 0x80, 0x80, 0xff, 0x34, 0x5f, 0x16, 0xc1, 0x35, 0x21, 0x17, 0x3a, 0x00,
+    0x01, 0xc0, 0x35, 0xc0, 0x16, 0x03, 0xc0, 0x35, 0xf6, 0x16, 0x96, 0x35, 0x20, 0x17, 0x60, 0x35, 0x20, 0x17, 0x03, 0x2a, 0x35, 0x20, 0x17, 0x00,
+    0x35, 0xf6, 0x16, 0x00, 0x35, 0xc0, 0x16, 0x03, 0x00, 0x35, 0x8a, 0x16, 0x2a, 0x35, 0x60, 0x16, 0x60, 0x35, 0x60, 0x16, 0x03, 0x96, 0x35, 0x60,
+    0x16, 0xc0, 0x35, 0x8a, 0x16, 0xc0, 0x35, 0xc0, 0x16, 0x04, 0x06, 0x06, 0xc7, 0x80, 0x80, 0xbf, 0x3f, 0x3f, 0x35, 0x01, 0x43, 0x81, 0x38, 0x09,
+    0x00, 0x07, 0xc0, 0x3f, 0x40, 0x35, 0x40, 0x03, 0x40, 0x03, 0x06, 0x16, 0xc8, 0x7f, 0x80, 0x7f, 0x58, 0x5f, 0x53, 0xc1, 0x5c, 0xa1, 0x57, 0x09,
+    0x00, 0x07, 0x80, 0x58, 0x60, 0x53, 0x40, 0x04, 0x40, 0x04, 0x06, 0x28, 0xc6, 0x80, 0x80, 0xbf, 0x33, 0xbf, 0x26, 0x41, 0x35, 0x41, 0x28, 0x09,
+    0x00, 0x07, 0xc0, 0x33, 0xc0, 0x26, 0x80, 0x01, 0x80, 0x01, 0x06, 0x0b, 0xc2, 0x80, 0x80, 0x7f, 0x28, 0x7f, 0x17, 0x01, 0x29, 0x01, 0x18, 0x09,
+    0x00, 0x07, 0x80, 0x28, 0x80, 0x17, 0x80, 0x00, 0x80, 0x00, 0x06, 0x1b, 0xc2, 0x80, 0x80, 0x1f, 0x28, 0xbf, 0x53, 0xa1, 0x28, 0x41, 0x54, 0x09,
+    0x00, 0x07, 0x20, 0x28, 0xc0, 0x53, 0x80, 0x00, 0x80, 0x00, 0x06, 0x06, 0xc5, 0x7f, 0x7f, 0x9f, 0x25, 0x9f, 0x3e, 0x61, 0x26, 0x61, 0x3f, 0x3a,
+    0x00, 0x01, 0x60, 0x26, 0x00, 0x3f, 0x03, 0x60, 0x26, 0x36, 0x3f, 0x36, 0x26, 0x60, 0x3f, 0x00, 0x26, 0x60, 0x3f, 0x03, 0xca, 0x25, 0x60, 0x3f,
+    0xa0, 0x25, 0x36, 0x3f, 0xa0, 0x25, 0x00, 0x3f, 0x03, 0xa0, 0x25, 0xca, 0x3e, 0xca, 0x25, 0xa0, 0x3e, 0x00, 0x26, 0xa0, 0x3e, 0x03, 0x36, 0x26,
+    0xa0, 0x3e, 0x60, 0x26, 0xca, 0x3e, 0x60, 0x26, 0x00, 0x3f, 0x04, 0x06, 0x0a, 0xc7, 0x80, 0x80, 0xbd, 0x5c, 0x40, 0x55, 0xc3, 0x5f, 0x40, 0x58,
+    0x09, 0x00, 0x07, 0xbe, 0x5c, 0x42, 0x55, 0x03, 0x03, 0xfd, 0x02, 0x06, 0x1b, 0xc7, 0x80, 0x80, 0x5d, 0x07, 0x20, 0x0e, 0xe3, 0x0a, 0xa0, 0x11,
+    0x09, 0x00, 0x07, 0x5e, 0x07, 0x22, 0x0e, 0x83, 0x03, 0x7d, 0x03, 0x06, 0x1b, 0xc7, 0x80, 0x80, 0x3f, 0x42, 0xbf, 0x40, 0x01, 0x45, 0x81, 0x43,
+    0x09, 0x00, 0x07, 0x40, 0x42, 0xc0, 0x40, 0xc0, 0x02, 0xc0, 0x02, 0x06, 0x0b, 0xc6, 0x80, 0x80, 0x3d, 0x52, 0x80, 0x0b, 0x83, 0x54, 0xc0, 0x0d,
+    0x09, 0x00, 0x07, 0x3e, 0x52, 0x82, 0x0b, 0x43, 0x02, 0x3d, 0x02, 0x06, 0x16, 0xc2, 0x80, 0x80, 0x1f, 0x27, 0x7f, 0x1f, 0xa1, 0x27, 0x01, 0x20,
+    0x09, 0x00, 0x07, 0x20, 0x27, 0x80, 0x1f, 0x80, 0x00, 0x80, 0x00, 0x06, 0x17, 0xc2, 0x80, 0x80, 0xff, 0x32, 0x5f, 0x30, 0x81, 0x33, 0xe1, 0x30,
+    0x09, 0x00, 0x07, 0x00, 0x33, 0x60, 0x30, 0x80, 0x00, 0x80, 0x00, 0x06, 0x1f, 0xc8, 0x7f, 0x80, 0xff, 0x3b, 0x5f, 0x16, 0xc1, 0x40, 0x21, 0x1b,
+    0x09, 0x00, 0x07, 0x00, 0x3c, 0x60, 0x16, 0xc0, 0x04, 0xc0, 0x04, 0x06, 0x1b, 0xc7, 0x7f, 0x80, 0x1f, 0x44, 0x62, 0x3a, 0x25, 0x48, 0x61, 0x3e,
+    0x09, 0x00, 0x07, 0x20, 0x44, 0x63, 0x3a, 0x03, 0x04, 0xfd, 0x03, 0x06, 0x18, 0xc2, 0x80, 0x80, 0x3f, 0x4e, 0x3f, 0x48, 0xc1, 0x4e, 0xc1, 0x48,
+    0x09, 0x00, 0x07, 0x40, 0x4e, 0x40, 0x48, 0x80, 0x00, 0x80, 0x00, 0x01, 0x03, 0xfe, 0x17, 0xfe, 0x3a, 0x04, 0xe0, 0x06, 0x06, 0x1b, 0xc5, 0x80,
+    0x80, 0x5d, 0xff, 0x60, 0xff, 0xa3, 0x00, 0xa0, 0x00, 0x09, 0x00, 0x07, 0x5e, 0xff, 0x62, 0xff, 0x43, 0x01, 0x3d, 0x01, 0x02, 0x06, 0x00, 0xc5,
+    0x7f, 0x7f, 0x3f, 0x37, 0x1f, 0x2f, 0x01, 0x38, 0xe1, 0x2f, 0x3a, 0x00, 0x01, 0x00, 0x38, 0x80, 0x2f, 0x03, 0x00, 0x38, 0xb6, 0x2f, 0xd6, 0x37,
+    0xe0, 0x2f, 0xa0, 0x37, 0xe0, 0x2f, 0x03, 0x6a, 0x37, 0xe0, 0x2f, 0x40, 0x37, 0xb6, 0x2f, 0x40, 0x37, 0x80, 0x2f, 0x03, 0x40, 0x37, 0x4a, 0x2f,
+    0x6a, 0x37, 0x20, 0x2f, 0xa0, 0x37, 0x20, 0x2f, 0x03, 0xd6, 0x37, 0x20, 0x2f, 0x00, 0x38, 0x4a, 0x2f, 0x00, 0x38, 0x80, 0x2f, 0x04, 0x06, 0x0a,
+    0xc7, 0x80, 0x80, 0x3f, 0x1f, 0xbf, 0x2d, 0x41, 0x21, 0xc1, 0x2f, 0x09, 0x00, 0x07, 0x40, 0x1f, 0xc0, 0x2d, 0x00, 0x02, 0x00, 0x02, 0x06, 0x1b,
+    0xc6, 0x80, 0x7f, 0xfb, 0x30, 0x5f, 0x0d, 0xc1, 0x32, 0x1e, 0x0f, 0x09, 0x00, 0x07, 0xfd, 0x30, 0x60, 0x0d, 0xc3, 0x01, 0xbd, 0x01, 0x06, 0x19,
+    0xc7, 0x80, 0x80, 0xdd, 0x4c, 0x20, 0x39, 0xe3, 0x4f, 0x20, 0x3c, 0x09, 0x00, 0x07, 0xde, 0x4c, 0x22, 0x39, 0x03, 0x03, 0xfd, 0x02, 0x06, 0x30,
+    0xc8, 0x80, 0x7f, 0xbf, 0x52, 0x5f, 0x1d, 0x81, 0x57, 0x21, 0x22, 0x09, 0x00, 0x07, 0xc0, 0x52, 0x60, 0x1d, 0xc0, 0x04, 0xc0, 0x04, 0x06, 0x1f,
+    0xc2, 0x80, 0x80, 0xdf, 0x00, 0x5f, 0x5f, 0x61, 0x01, 0xe1, 0x5f, 0x09, 0x00, 0x07, 0xe0, 0x00, 0x60, 0x5f, 0x80, 0x00, 0x80, 0x00, 0x06, 0x15,
+    0xc7, 0x80, 0x80, 0x5f, 0x1f, 0xbf, 0x1b, 0x21, 0x22, 0x81, 0x1e, 0x09, 0x00, 0x07, 0x60, 0x1f, 0xc0, 0x1b, 0xc0, 0x02, 0xc0, 0x02, 0x06, 0x20,
+    0xc7, 0x80, 0x7f, 0xbf, 0x3c, 0x5f, 0x3c, 0x81, 0x3f, 0x21, 0x3f, 0x09, 0x00, 0x07, 0xc0, 0x3c, 0x60, 0x3c, 0xc0, 0x02, 0xc0, 0x02, 0x06, 0x06,
+    0xc6, 0x80, 0x80, 0x1f, 0x26, 0x1f, 0x4b, 0xa1, 0x27, 0xa1, 0x4c, 0x09, 0x00, 0x07, 0x20, 0x26, 0x20, 0x4b, 0x80, 0x01, 0x80, 0x01, 0x01, 0x03,
+    0xde, 0x27, 0x5e, 0x37, 0x04, 0xe0, 0x06, 0x06, 0x1b, 0xc5, 0x80, 0x80, 0x5d, 0xff, 0x60, 0xff, 0xa3, 0x00, 0xa0, 0x00, 0x09, 0x00, 0x07, 0x5e,
+    0xff, 0x62, 0xff, 0x43, 0x01, 0x3d, 0x01, 0x02, 0x06, 0x1b, 0xc7, 0x80, 0x80, 0x7f, 0x3b, 0xbf, 0x2f, 0x41, 0x3f, 0x81, 0x33, 0x09, 0x00, 0x07,
+    0x80, 0x3b, 0xc0, 0x2f, 0xc0, 0x03, 0xc0, 0x03, 0x06, 0x06, 0xc5, 0x80, 0x80, 0x7f, 0x00, 0x7f, 0x5a, 0x81, 0x01, 0x81, 0x5b, 0x09, 0x00, 0x07,
+    0x80, 0x00, 0x80, 0x5a, 0x00, 0x01, 0x00, 0x01, 0x06, 0x06, 0xc7, 0x80, 0x80, 0x5f, 0x38, 0xbf, 0x49, 0x61, 0x3a, 0xc1, 0x4b, 0x09, 0x00, 0x07,
+    0x60, 0x38, 0xc0, 0x49, 0x00, 0x02, 0x00, 0x02, 0x06, 0x29, 0xc8, 0x80, 0x80, 0x7f, 0x05, 0x3f, 0x25, 0xc1, 0x09, 0x81, 0x29, 0x09, 0x00, 0x07,
+    0x80, 0x05, 0x40, 0x25, 0x40, 0x04, 0x40, 0x04, 0x06, 0x26, 0xc5, 0x80, 0x80, 0xff, 0x27, 0x3f, 0x3c, 0x01, 0x29, 0x41, 0x3d, 0x09, 0x00, 0x07,
+    0x00, 0x28, 0x40, 0x3c, 0x00, 0x01, 0x00, 0x01, 0x06, 0x1e, 0xc7, 0x7f, 0x80, 0xff, 0x42, 0x22, 0x47, 0x05, 0x47, 0x21, 0x4b, 0x09, 0x00, 0x07,
+    0x00, 0x43, 0x23, 0x47, 0x03, 0x04, 0xfd, 0x03, 0x06, 0x1b, 0xc7, 0x80, 0x80, 0x7f, 0x47, 0x9f, 0x2d, 0x41, 0x4b, 0x61, 0x31, 0x09, 0x00, 0x07,
+    0x80, 0x47, 0xa0, 0x2d, 0xc0, 0x03, 0xc0, 0x03, 0x06, 0x30, 0xc7, 0x80, 0x80, 0x7f, 0x05, 0x3f, 0x41, 0x01, 0x08, 0xc1, 0x43, 0x09, 0x00, 0x07,
+    0x80, 0x05, 0x40, 0x41, 0x80, 0x02, 0x80, 0x02, 0x06, 0x0c, 0xc6, 0x80, 0x80, 0xdd, 0x15, 0x60, 0x2c, 0x23, 0x18, 0xa0, 0x2e, 0x09, 0x00, 0x07,
+    0xde, 0x15, 0x62, 0x2c, 0x43, 0x02, 0x3d, 0x02, 0x06, 0x06, 0xc7, 0x80, 0x80, 0x9d, 0x17, 0x60, 0x11, 0xa3, 0x1a, 0x60, 0x14, 0x09, 0x00, 0x07,
+    0x9e, 0x17, 0x62, 0x11, 0x03, 0x03, 0xfd, 0x02, 0x06, 0x0b, 0xc5, 0x7f, 0x7f, 0xdf, 0x06, 0x7f, 0x0e, 0xa1, 0x07, 0x41, 0x0f, 0x3a, 0x00, 0x01,
+    0xa0, 0x07, 0xe0, 0x0e, 0x03, 0xa0, 0x07, 0x16, 0x0f, 0x76, 0x07, 0x40, 0x0f, 0x40, 0x07, 0x40, 0x0f, 0x03, 0x0a, 0x07, 0x40, 0x0f, 0xe0, 0x06,
+    0x16, 0x0f, 0xe0, 0x06, 0xe0, 0x0e, 0x03, 0xe0, 0x06, 0xaa, 0x0e, 0x0a, 0x07, 0x80, 0x0e, 0x40, 0x07, 0x80, 0x0e, 0x03, 0x76, 0x07, 0x80, 0x0e,
+    0xa0, 0x07, 0xaa, 0x0e, 0xa0, 0x07, 0xe0, 0x0e, 0x04, 0x01, 0x03, 0x9e, 0x47, 0xbe, 0x1c, 0x04, 0xe0, 0x06, 0x06, 0x18, 0xc5, 0x80, 0x80, 0x5d,
+    0xff, 0x60, 0xff, 0xa3, 0x00, 0xa0, 0x00, 0x09, 0x00, 0x07, 0x5e, 0xff, 0x62, 0xff, 0x43, 0x01, 0x3d, 0x01, 0x02, 0x06, 0x30, 0xc8, 0x80, 0x80,
+    0x3f, 0x39, 0x5f, 0x09, 0x01, 0x40, 0x21, 0x10, 0x09, 0x00, 0x07, 0x40, 0x39, 0x60, 0x09, 0xc0, 0x06, 0xc0, 0x06, 0x06, 0x30, 0xc6, 0x80, 0x7f,
+    0xbb, 0x31, 0xbf, 0x59, 0x81, 0x33, 0x7e, 0x5b, 0x09, 0x00, 0x07, 0xbd, 0x31, 0xc0, 0x59, 0xc3, 0x01, 0xbd, 0x01, 0x06, 0x19, 0xc8, 0x80, 0x80,
+    0x7f, 0x04, 0xdf, 0xfd, 0xc1, 0x08, 0x21, 0x02, 0x09, 0x00, 0x07, 0x80, 0x04, 0xe0, 0xfd, 0x40, 0x04, 0x40, 0x04, 0x06, 0x17, 0xc7, 0x80, 0x80,
+    0x9d, 0x27, 0xe0, 0x0e, 0xa3, 0x2a, 0xe0, 0x11, 0x09, 0x00, 0x07, 0x9e, 0x27, 0xe2, 0x0e, 0x03, 0x03, 0xfd, 0x02, 0x06, 0x0d, 0xc8, 0x80, 0x80,
+    0xbf, 0x16, 0x9f, 0xfe, 0x01, 0x1d, 0xe1, 0x04, 0x09, 0x00, 0x07, 0xc0, 0x16, 0xa0, 0xfe, 0x40, 0x06, 0x40, 0x06, 0x06, 0x14, 0xc6, 0x80, 0x7f,
+    0xfb, 0x23, 0x9f, 0x5e, 0xc1, 0x25, 0x5e, 0x60, 0x09, 0x00, 0x07, 0xfd, 0x23, 0xa0, 0x5e, 0xc3, 0x01, 0xbd, 0x01, 0x06, 0x21, 0xc7, 0x80, 0x7f,
+    0xfd, 0x4c, 0x00, 0x02, 0x03, 0x50, 0x00, 0x05, 0x09, 0x00, 0x07, 0xfe, 0x4c, 0x02, 0x02, 0x03, 0x03, 0xfd, 0x02, 0x01, 0x03, 0x7e, 0x15, 0x5e,
+    0x4f, 0x04, 0xe0, 0x06, 0x06, 0x0a, 0xc5, 0x80, 0x80, 0x5d, 0xff, 0x60, 0xff, 0xa3, 0x00, 0xa0, 0x00, 0x09, 0x00, 0x07, 0x5e, 0xff, 0x62, 0xff,
+    0x43, 0x01, 0x3d, 0x01, 0x02, 0x06, 0x1a, 0xc6, 0x80, 0x7f, 0x5b, 0x1e, 0x3f, 0x29, 0x21, 0x20, 0xfe, 0x2a, 0x09, 0x00, 0x07, 0x5d, 0x1e, 0x40,
+    0x29, 0xc3, 0x01, 0xbd, 0x01, 0x06, 0x1f, 0xc6, 0x80, 0x80, 0x7f, 0x3d, 0x9f, 0x11, 0x01, 0x3f, 0x21, 0x13, 0x09, 0x00, 0x07, 0x80, 0x3d, 0xa0,
+    0x11, 0x80, 0x01, 0x80, 0x01, 0x06, 0x06, 0xc5, 0x80, 0x80, 0x7f, 0x10, 0xdf, 0x53, 0x81, 0x11, 0xe1, 0x54, 0x09, 0x00, 0x07, 0x80, 0x10, 0xe0,
+    0x53, 0x00, 0x01, 0x00, 0x01, 0x06, 0x1a, 0xc8, 0x80, 0x80, 0xbf, 0x58, 0x1f, 0x58, 0x01, 0x60, 0x61, 0x5f, 0x09, 0x00, 0x07, 0xc0, 0x58, 0x20,
+    0x58, 0x40, 0x07, 0x40, 0x07, 0x01, 0x03, 0xfe, 0x2c, 0x1e, 0x18, 0x04, 0xe0, 0x06, 0x06, 0x01, 0xc5, 0x80, 0x80, 0x5d, 0xff, 0x60, 0xff, 0xa3,
+    0x00, 0xa0, 0x00, 0x09, 0x00, 0x07, 0x5e, 0xff, 0x62, 0xff, 0x43, 0x01, 0x3d, 0x01, 0x02, 0x06, 0x1d, 0xc7, 0x7f, 0x80, 0xff, 0x2b, 0xc2, 0x08,
+    0x05, 0x30, 0xc1, 0x0c, 0x09, 0x00, 0x07, 0x00, 0x2c, 0xc3, 0x08, 0x03, 0x04, 0xfd, 0x03, 0x06, 0x02, 0xc7, 0x80, 0x80, 0x3f, 0x54, 0xdf, 0x32,
+    0x01, 0x57, 0xa1, 0x35, 0x09, 0x00, 0x07, 0x40, 0x54, 0xe0, 0x32, 0xc0, 0x02, 0xc0, 0x02, 0x06, 0x03, 0xc7, 0x7f, 0x80, 0x7f, 0x44, 0x82, 0x13,
+    0x05, 0x49, 0x01, 0x18, 0x09, 0x00, 0x07, 0x80, 0x44, 0x83, 0x13, 0x83, 0x04, 0x7d, 0x04, 0x06, 0x0e, 0xc7, 0x7f, 0x80, 0x7f, 0x3f, 0xc2, 0x16,
+    0x85, 0x44, 0xc1, 0x1b, 0x09, 0x00, 0x07, 0x80, 0x3f, 0xc3, 0x16, 0x03, 0x05, 0xfd, 0x04, 0x06, 0x1d, 0xc8, 0x80, 0x80, 0x3f, 0x32, 0x5f, 0x02,
+    0xc1, 0x38, 0xe1, 0x08, 0x09, 0x00, 0x07, 0x40, 0x32, 0x60, 0x02, 0x80, 0x06, 0x80, 0x06, 0x06, 0x22, 0xc7, 0x80, 0x80, 0xdf, 0x4b, 0x1f, 0x34,
+    0xa1, 0x4f, 0xe1, 0x37, 0x09, 0x00, 0x07, 0xe0, 0x4b, 0x20, 0x34, 0xc0, 0x03, 0xc0, 0x03, 0x06, 0x30, 0xc7, 0x80, 0x80, 0x9f, 0x3f, 0x7f, 0x4e,
+    0x61, 0x42, 0x41, 0x51, 0x09, 0x00, 0x07, 0xa0, 0x3f, 0x80, 0x4e, 0xc0, 0x02, 0xc0, 0x02, 0x06, 0x30, 0xc6, 0x80, 0x80, 0xff, 0x53, 0xff, 0x07,
+    0x81, 0x55, 0x81, 0x09, 0x09, 0x00, 0x07, 0x00, 0x54, 0x00, 0x08, 0x80, 0x01, 0x80, 0x01, 0x06, 0x1c, 0xc5, 0x80, 0x80, 0xff, 0x0b, 0x5f, 0x22,
+    0x01, 0x0d, 0x61, 0x23, 0x09, 0x00, 0x07, 0x00, 0x0c, 0x60, 0x22, 0x00, 0x01, 0x00, 0x01, 0x06, 0x0f, 0xc6, 0x80, 0x7f, 0x3b, 0x1b, 0x1f, 0x4d,
+    0x01, 0x1d, 0xde, 0x4e, 0x09, 0x00, 0x07, 0x3d, 0x1b, 0x20, 0x4d, 0xc3, 0x01, 0xbd, 0x01, 0x06, 0x1b, 0xc5, 0x80, 0x7f, 0x7f, 0x3e, 0xbf, 0x16,
+    0x81, 0x3f, 0xc1, 0x17, 0x09, 0x00, 0x07, 0x80, 0x3e, 0xc0, 0x16, 0x00, 0x01, 0x00, 0x01, 0x06, 0x1b, 0xc7, 0x80, 0x80, 0xbf, 0x39, 0x3f, 0x19,
+    0xc1, 0x3b, 0x41, 0x1b, 0x09, 0x00, 0x07, 0xc0, 0x39, 0x40, 0x19, 0x00, 0x02, 0x00, 0x02, 0x06, 0x00, 0xc6, 0x80, 0x80, 0x5d, 0x13, 0x20, 0x26,
+    0xa3, 0x15, 0x60, 0x28, 0x09, 0x00, 0x07, 0x5e, 0x13, 0x22, 0x26, 0x43, 0x02, 0x3d, 0x02, 0x06, 0x17, 0xc2, 0x80, 0x80, 0x5f, 0x3c, 0x5f, 0x15,
+    0xe1, 0x3c, 0xe1, 0x15, 0x09, 0x00, 0x07, 0x60, 0x3c, 0x60, 0x15, 0x80, 0x00, 0x80, 0x00, 0x06, 0x1a, 0xc5, 0x80, 0x80, 0x7f, 0x1b, 0x9f, 0x31,
+    0x41, 0x1c, 0x61, 0x32, 0x3a, 0x00, 0x01, 0x40, 0x1c, 0x00, 0x32, 0x03, 0x40, 0x1c, 0x36, 0x32, 0x16, 0x1c, 0x60, 0x32, 0xe0, 0x1b, 0x60, 0x32,
+    0x03, 0xaa, 0x1b, 0x60, 0x32, 0x80, 0x1b, 0x36, 0x32, 0x80, 0x1b, 0x00, 0x32, 0x03, 0x80, 0x1b, 0xca, 0x31, 0xaa, 0x1b, 0xa0, 0x31, 0xe0, 0x1b,
+    0xa0, 0x31, 0x03, 0x16, 0x1c, 0xa0, 0x31, 0x40, 0x1c, 0xca, 0x31, 0x40, 0x1c, 0x00, 0x32, 0x04, 0x06, 0x1d, 0xc2, 0x80, 0x80, 0x1f, 0x4a, 0xff,
+    0x31, 0xa1, 0x4a, 0x81, 0x32, 0x09, 0x00, 0x07, 0x20, 0x4a, 0x00, 0x32, 0x80, 0x00, 0x80, 0x00, 0x06, 0x15, 0xc7, 0x80, 0x80, 0x3f, 0x5a, 0xdf,
+    0x06, 0xc1, 0x5c, 0x61, 0x09, 0x09, 0x00, 0x07, 0x40, 0x5a, 0xe0, 0x06, 0x80, 0x02, 0x80, 0x02, 0x06, 0x0a, 0xc6, 0x80, 0x80, 0x7f, 0x02, 0xff,
+    0x49, 0x01, 0x04, 0x81, 0x4b, 0x09, 0x00, 0x07, 0x80, 0x02, 0x00, 0x4a, 0x80, 0x01, 0x80, 0x01, 0x06, 0x0a, 0xc7, 0x80, 0x80, 0x3f, 0x28, 0x3f,
+    0x0b, 0x81, 0x2b, 0x81, 0x0e, 0x09, 0x00, 0x07, 0x40, 0x28, 0x40, 0x0b, 0x40, 0x03, 0x40, 0x03, 0x06, 0x1b, 0xc2, 0x7f, 0x80, 0xff, 0x30, 0xff,
+    0x2e, 0x81, 0x31, 0x81, 0x2f, 0x09, 0x00, 0x07, 0x00, 0x31, 0x00, 0x2f, 0x80, 0x00, 0x80, 0x00, 0x06, 0x0f, 0xc7, 0x7f, 0x80, 0x3f, 0x46, 0x82,
+    0x3b, 0xc5, 0x4a, 0x01, 0x40, 0x09, 0x00, 0x07, 0x40, 0x46, 0x83, 0x3b, 0x83, 0x04, 0x7d, 0x04, 0x01, 0x03, 0x1e, 0x31, 0xde, 0x3b, 0x04, 0xe0,
+    0x06, 0x06, 0x30, 0xc5, 0x80, 0x80, 0x5d, 0xff, 0x60, 0xff, 0xa3, 0x00, 0xa0, 0x00, 0x09, 0x00, 0x07, 0x5e, 0xff, 0x62, 0xff, 0x43, 0x01, 0x3d,
+    0x01, 0x02, 0x06, 0x1d, 0xc7, 0x7f, 0x80, 0x9f, 0x5c, 0x42, 0xff, 0xa5, 0x61, 0x41, 0x04, 0x09, 0x00, 0x07, 0xa0, 0x5c, 0x43, 0xff, 0x03, 0x05,
+    0xfd, 0x04, 0x06, 0x1b, 0xc8, 0x80, 0x80, 0x9f, 0x34, 0x3f, 0x04, 0xe1, 0x3b, 0x81, 0x0b, 0x09, 0x00, 0x07, 0xa0, 0x34, 0x40, 0x04, 0x40, 0x07,
+    0x40, 0x07, 0x06, 0x1b, 0xc7, 0x7f, 0x80, 0xbf, 0x48, 0xa2, 0x04, 0xc5, 0x4c, 0xa1, 0x08, 0x09, 0x00, 0x07, 0xc0, 0x48, 0xa3, 0x04, 0x03, 0x04,
+    0xfd, 0x03, 0x06, 0x30, 0xc7, 0x80, 0x80, 0x1f, 0x33, 0xdf, 0x28, 0x21, 0x35, 0xe1, 0x2a, 0x09, 0x00, 0x07, 0x20, 0x33, 0xe0, 0x28, 0x00, 0x02,
+    0x00, 0x02, 0x06, 0x26, 0xc7, 0x80, 0x80, 0x5d, 0x0e, 0xa0, 0x57, 0xe3, 0x11, 0x20, 0x5b, 0x09, 0x00, 0x07, 0x5e, 0x0e, 0xa2, 0x57, 0x83, 0x03,
+    0x7d, 0x03, 0x06, 0x0d, 0xc6, 0x80, 0x80, 0x7f, 0x02, 0xbf, 0x2b, 0x01, 0x04, 0x41, 0x2d, 0x09, 0x00, 0x07, 0x80, 0x02, 0xc0, 0x2b, 0x80, 0x01,
+    0x80, 0x01, 0x06, 0x0b, 0xc8, 0x80, 0x80, 0xff, 0xff, 0xdf, 0xfd, 0x41, 0x05, 0x21, 0x03, 0x09, 0x00, 0x07, 0x00, 0x00, 0xe0, 0xfd, 0x40, 0x05,
+    0x40, 0x05, 0x06, 0x0a, 0xc8, 0x80, 0x80, 0x5f, 0x12, 0xff, 0x01, 0x21, 0x17, 0xc1, 0x06, 0x09, 0x00, 0x07, 0x60, 0x12, 0x00, 0x02, 0xc0, 0x04,
+    0xc0, 0x04, 0x06, 0x29, 0xc7, 0x80, 0x80, 0xdf, 0x21, 0x9f, 0x05, 0x21, 0x25, 0xe1, 0x08, 0x09, 0x00, 0x07, 0xe0, 0x21, 0xa0, 0x05, 0x40, 0x03,
+    0x40, 0x03, 0x06, 0x21, 0xc8, 0x80, 0x7f, 0xfb, 0x00, 0x9f, 0x0d, 0x81, 0x06, 0x1e, 0x13, 0x09, 0x00, 0x07, 0xfd, 0x00, 0xa0, 0x0d, 0x83, 0x05,
+    0x7d, 0x05, 0x06, 0x0f, 0xc7, 0x7f, 0x80, 0x7d, 0x3a, 0x40, 0x0e, 0x03, 0x3e, 0xc0, 0x11, 0x09, 0x00, 0x07, 0x7e, 0x3a, 0x42, 0x0e, 0x83, 0x03,
+    0x7d, 0x03, 0x06, 0x1b, 0xc7, 0x7f, 0x80, 0x7f, 0x5d, 0xc2, 0x5b, 0x85, 0x62, 0xc1, 0x60, 0x09, 0x00, 0x07, 0x80, 0x5d, 0xc3, 0x5b, 0x03, 0x05,
+    0xfd, 0x04, 0x06, 0x04, 0xc8, 0x80, 0x80, 0x3f, 0x42, 0x1f, 0x0f, 0x81, 0x47, 0x61, 0x14, 0x09, 0x00, 0x07, 0x40, 0x42, 0x20, 0x0f, 0x40, 0x05,
+    0x40, 0x05, 0x06, 0x0c, 0xc7, 0x80, 0x80, 0xbf, 0x2b, 0xdf, 0x26, 0x41, 0x2e, 0x61, 0x29, 0x09, 0x00, 0x07, 0xc0, 0x2b, 0xe0, 0x26, 0x80, 0x02,
+    0x80, 0x02, 0x06, 0x10, 0xc2, 0x80, 0x80, 0xff, 0x0b, 0x3f, 0x4d, 0x81, 0x0c, 0xc1, 0x4d, 0x09, 0x00, 0x07, 0x00, 0x0c, 0x40, 0x4d, 0x80, 0x00,
+    0x80, 0x00, 0x06, 0x04, 0xc7, 0x80, 0x80, 0x7f, 0x3a, 0x3f, 0x4c, 0x41, 0x3d, 0x01, 0x4f, 0x09, 0x00, 0x07, 0x80, 0x3a, 0x40, 0x4c, 0xc0, 0x02,
+    0xc0, 0x02, 0x01, 0x03, 0xbe, 0x12, 0x7e, 0x08, 0x04, 0xe0, 0x06, 0x06, 0x02, 0xc5, 0x80, 0x80, 0x5d, 0xff, 0x60, 0xff, 0xa3, 0x00, 0xa0, 0x00,
+    0x09, 0x00, 0x07, 0x5e, 0xff, 0x62, 0xff, 0x43, 0x01, 0x3d, 0x01, 0x02, 0x06, 0x0b, 0xc7, 0x7f, 0x80, 0xdf, 0x30, 0xe2, 0x01, 0xe5, 0x35, 0xe1,
+    0x06, 0x09, 0x00, 0x07, 0xe0, 0x30, 0xe3, 0x01, 0x03, 0x05, 0xfd, 0x04, 0x06, 0x1f, 0xc5, 0x7f, 0x7f, 0x9f, 0x2e, 0xff, 0x40, 0x61, 0x2f, 0xc1,
+    0x41, 0x3a, 0x00, 0x01, 0x60, 0x2f, 0x60, 0x41, 0x03, 0x60, 0x2f, 0x96, 0x41, 0x36, 0x2f, 0xc0, 0x41, 0x00, 0x2f, 0xc0, 0x41, 0x03, 0xca, 0x2e,
+    0xc0, 0x41, 0xa0, 0x2e, 0x96, 0x41, 0xa0, 0x2e, 0x60, 0x41, 0x03, 0xa0, 0x2e, 0x2a, 0x41, 0xca, 0x2e, 0x00, 0x41, 0x00, 0x2f, 0x00, 0x41, 0x03,
+    0x36, 0x2f, 0x00, 0x41, 0x60, 0x2f, 0x2a, 0x41, 0x60, 0x2f, 0x60, 0x41, 0x04, 0x06, 0x30, 0xc5, 0x80, 0x80, 0xff, 0x53, 0x3f, 0x0f, 0xc1, 0x54,
+    0x01, 0x10, 0x3a, 0x00, 0x01, 0xc0, 0x54, 0xa0, 0x0f, 0x03, 0xc0, 0x54, 0xd6, 0x0f, 0x96, 0x54, 0x00, 0x10, 0x60, 0x54, 0x00, 0x10, 0x03, 0x2a,
+    0x54, 0x00, 0x10, 0x00, 0x54, 0xd6, 0x0f, 0x00, 0x54, 0xa0, 0x0f, 0x03, 0x00, 0x54, 0x6a, 0x0f, 0x2a, 0x54, 0x40, 0x0f, 0x60, 0x54, 0x40, 0x0f,
+    0x03, 0x96, 0x54, 0x40, 0x0f, 0xc0, 0x54, 0x6a, 0x0f, 0xc0, 0x54, 0xa0, 0x0f, 0x04, 0x06, 0x16, 0xc2, 0x80, 0x80, 0xdf, 0x15, 0x9f, 0x46, 0x61,
+    0x16, 0x21, 0x47, 0x09, 0x00, 0x07, 0xe0, 0x15, 0xa0, 0x46, 0x80, 0x00, 0x80, 0x00, 0x06, 0x19, 0xc8, 0x80, 0x80, 0xff, 0x57, 0x9f, 0x2c, 0x41,
+    0x5c, 0xe1, 0x30, 0x09, 0x00, 0x07, 0x00, 0x58, 0xa0, 0x2c, 0x40, 0x04, 0x40, 0x04, 0x06, 0x00, 0xc7, 0x80, 0x80, 0xff, 0xff, 0xdf, 0x44, 0xc1,
+    0x02, 0xa1, 0x47, 0x09, 0x00, 0x07, 0x00, 0x00, 0xe0, 0x44, 0xc0, 0x02, 0xc0, 0x02, 0x06, 0x1e, 0xc8, 0x80, 0x80, 0x9f, 0x51, 0x3f, 0x3a, 0x61,
+    0x57, 0x01, 0x40, 0x09, 0x00, 0x07, 0xa0, 0x51, 0x40, 0x3a, 0xc0, 0x05, 0xc0, 0x05, 0x06, 0x30, 0xc7, 0x80, 0x80, 0x1f, 0x07, 0xff, 0x36, 0xe1,
+    0x09, 0xc1, 0x39, 0x09, 0x00, 0x07, 0x20, 0x07, 0x00, 0x37, 0xc0, 0x02, 0xc0, 0x02, 0x06, 0x30, 0xc8, 0x80, 0x80, 0xff, 0x5c, 0xbf, 0x56, 0x41,
+    0x61, 0x01, 0x5b, 0x09, 0x00, 0x07, 0x00, 0x5d, 0xc0, 0x56, 0x40, 0x04, 0x40, 0x04, 0x06, 0x20, 0xc6, 0x80, 0x80, 0x9f, 0x34, 0xdf, 0x3b, 0x21,
+    0x36, 0x61, 0x3d, 0x09, 0x00, 0x07, 0xa0, 0x34, 0xe0, 0x3b, 0x80, 0x01, 0x80, 0x01, 0x06, 0x30, 0xc2, 0x80, 0x80, 0xdf, 0x1b, 0xff, 0x41, 0x61,
+    0x1c, 0x81, 0x42, 0x09, 0x00, 0x07, 0xe0, 0x1b, 0x00, 0x42, 0x80, 0x00, 0x80, 0x00, 0x06, 0x15, 0xc8, 0x80, 0x80, 0x9f, 0x4c, 0x1f, 0x0a, 0x61,
+    0x54, 0xe1, 0x11, 0x09, 0x00, 0x07, 0xa0, 0x4c, 0x20, 0x0a, 0xc0, 0x07, 0xc0, 0x07, 0x06, 0x2a, 0xc2, 0x80, 0x80, 0xbf, 0x1e, 0x1f, 0x3f, 0x41,
+    0x1f, 0xa1, 0x3f, 0x09, 0x00, 0x07, 0xc0, 0x1e, 0x20, 0x3f, 0x80, 0x00, 0x80, 0x00, 0x06, 0x22, 0xc5, 0x7f, 0x7f, 0x9f, 0x2d, 0xff, 0x3e, 0x61,
+    0x2e, 0xc1, 0x3f, 0x3a, 0x00, 0x01, 0x60, 0x2e, 0x60, 0x3f, 0x03, 0x60, 0x2e, 0x96, 0x3f, 0x36, 0x2e, 0xc0, 0x3f, 0x00, 0x2e, 0xc0, 0x3f, 0x03,
+    0xca, 0x2d, 0xc0, 0x3f, 0xa0, 0x2d, 0x96, 0x3f, 0xa0, 0x2d, 0x60, 0x3f, 0x03, 0xa0, 0x2d, 0x2a, 0x3f, 0xca, 0x2d, 0x00, 0x3f, 0x00, 0x2e, 0x00,
+    0x3f, 0x03, 0x36, 0x2e, 0x00, 0x3f, 0x60, 0x2e, 0x2a, 0x3f, 0x60, 0x2e, 0x60, 0x3f, 0x04, 0x06, 0x26, 0xc6, 0x80, 0x7f, 0x9b, 0x42, 0x1f, 0x5e,
+    0x61, 0x44, 0xde, 0x5f, 0x09, 0x00, 0x07, 0x9d, 0x42, 0x20, 0x5e, 0xc3, 0x01, 0xbd, 0x01, 0x06, 0x1b, 0xc6, 0x80, 0x7f, 0x5b, 0x04, 0xdf, 0x36,
+    0x21, 0x06, 0x9e, 0x38, 0x09, 0x00, 0x07, 0x5d, 0x04, 0xe0, 0x36, 0xc3, 0x01, 0xbd, 0x01, 0x06, 0x0c, 0xc5, 0x80, 0x7f, 0x7f, 0x02, 0xff, 0x23,
+    0x41, 0x03, 0xc1, 0x24, 0x3a, 0x00, 0x01, 0x40, 0x03, 0x60, 0x24, 0x03, 0x40, 0x03, 0x96, 0x24, 0x16, 0x03, 0xc0, 0x24, 0xe0, 0x02, 0xc0, 0x24,
+    0x03, 0xaa, 0x02, 0xc0, 0x24, 0x80, 0x02, 0x96, 0x24, 0x80, 0x02, 0x60, 0x24, 0x03, 0x80, 0x02, 0x2a, 0x24, 0xaa, 0x02, 0x00, 0x24, 0xe0, 0x02,
+    0x00, 0x24, 0x03, 0x16, 0x03, 0x00, 0x24, 0x40, 0x03, 0x2a, 0x24, 0x40, 0x03, 0x60, 0x24, 0x04, 0x06, 0x04, 0xc5, 0x80, 0x7f, 0x3f, 0x0c, 0xbf,
+    0x28, 0x41, 0x0d, 0xc1, 0x29, 0x09, 0x00, 0x07, 0x40, 0x0c, 0xc0, 0x28, 0x00, 0x01, 0x00, 0x01, 0x06, 0x30, 0xc6, 0x80, 0x7f, 0xfb, 0x1c, 0xdf,
+    0x08, 0xc1, 0x1e, 0x9e, 0x0a, 0x09, 0x00, 0x07, 0xfd, 0x1c, 0xe0, 0x08, 0xc3, 0x01, 0xbd, 0x01, 0x06, 0x26, 0xc5, 0x80, 0x80, 0x9f, 0x26, 0xdf,
+    0x04, 0xa1, 0x27, 0xe1, 0x05, 0x09, 0x00, 0x07, 0xa0, 0x26, 0xe0, 0x04, 0x00, 0x01, 0x00, 0x01, 0x06, 0x1b, 0xc7, 0x7f, 0x80, 0x3f, 0x11, 0xe2,
+    0x16, 0x45, 0x15, 0xe1, 0x1a, 0x09, 0x00, 0x07, 0x40, 0x11, 0xe3, 0x16, 0x03, 0x04, 0xfd, 0x03, 0x06, 0x1b, 0xc6, 0x80, 0x80, 0x5d, 0x39, 0x20,
+    0x5b, 0xa3, 0x3b, 0x60, 0x5d, 0x09, 0x00, 0x07, 0x5e, 0x39, 0x22, 0x5b, 0x43, 0x02, 0x3d, 0x02, 0x06, 0x2b, 0xc6, 0x80, 0x7f, 0xbb, 0x19, 0x7f,
+    0x2e, 0x81, 0x1b, 0x3e, 0x30, 0x09, 0x00, 0x07, 0xbd, 0x19, 0x80, 0x2e, 0xc3, 0x01, 0xbd, 0x01, 0x06, 0x11, 0xc8, 0x7f, 0x80, 0xbf, 0x5c, 0x3f,
+    0x1b, 0x41, 0x62, 0xc1, 0x20, 0x09, 0x00, 0x07, 0xc0, 0x5c, 0x40, 0x1b, 0x80, 0x05, 0x80, 0x05, 0x06, 0x05, 0xc7, 0x80, 0x80, 0xff, 0x32, 0x1f,
+    0x5c, 0xc1, 0x36, 0xe1, 0x5f, 0x09, 0x00, 0x07, 0x00, 0x33, 0x20, 0x5c, 0xc0, 0x03, 0xc0, 0x03, 0x06, 0x17, 0xc5, 0x7f, 0x7f, 0x9f, 0x2d, 0x9f,
+    0x49, 0x61, 0x2e, 0x61, 0x4a, 0x3a, 0x00, 0x01, 0x60, 0x2e, 0x00, 0x4a, 0x03, 0x60, 0x2e, 0x36, 0x4a, 0x36, 0x2e, 0x60, 0x4a, 0x00, 0x2e, 0x60,
+    0x4a, 0x03, 0xca, 0x2d, 0x60, 0x4a, 0xa0, 0x2d, 0x36, 0x4a, 0xa0, 0x2d, 0x00, 0x4a, 0x03, 0xa0, 0x2d, 0xca, 0x49, 0xca, 0x2d, 0xa0, 0x49, 0x00,
+    0x2e, 0xa0, 0x49, 0x03, 0x36, 0x2e, 0xa0, 0x49, 0x60, 0x2e, 0xca, 0x49, 0x60, 0x2e, 0x00, 0x4a, 0x04, 0x06, 0x1a, 0xc2, 0x80, 0x80, 0x7f, 0x18,
+    0x7f, 0x42, 0x01, 0x19, 0x01, 0x43, 0x09, 0x00, 0x07, 0x80, 0x18, 0x80, 0x42, 0x80, 0x00, 0x80, 0x00, 0x06, 0x0e, 0xc7, 0x80, 0x80, 0xff, 0x4e,
+    0xbf, 0x3b, 0x41, 0x52, 0x01, 0x3f, 0x09, 0x00, 0x07, 0x00, 0x4f, 0xc0, 0x3b, 0x40, 0x03, 0x40, 0x03, 0x06, 0x10, 0xc7, 0x80, 0x80, 0xff, 0x23,
+    0x1f, 0x10, 0x41, 0x27, 0x61, 0x13, 0x09, 0x00, 0x07, 0x00, 0x24, 0x20, 0x10, 0x40, 0x03, 0x40, 0x03, 0x06, 0x1c, 0xc7, 0x80, 0x80, 0x9f, 0x1c,
+    0xbf, 0x10, 0x21, 0x1f, 0x41, 0x13, 0x09, 0x00, 0x07, 0xa0, 0x1c, 0xc0, 0x10, 0x80, 0x02, 0x80, 0x02, 0x06, 0x07, 0xc7, 0x80, 0x80, 0x3f, 0x24,
+    0xdf, 0x22, 0xc1, 0x26, 0x61, 0x25, 0x09, 0x00, 0x07, 0x40, 0x24, 0xe0, 0x22, 0x80, 0x02, 0x80, 0x02, 0x06, 0x15, 0xc2, 0x80, 0x80, 0x5f, 0x24,
+    0x9f, 0x41, 0xe1, 0x24, 0x21, 0x42, 0x09, 0x00, 0x07, 0x60, 0x24, 0xa0, 0x41, 0x80, 0x00, 0x80, 0x00, 0x06, 0x17, 0xc8, 0x80, 0x80, 0x5f, 0x37,
+    0xff, 0x01, 0xa1, 0x3e, 0x41, 0x09, 0x09, 0x00, 0x07, 0x60, 0x37, 0x00, 0x02, 0x40, 0x07, 0x40, 0x07, 0x06, 0x1b, 0xc7, 0x7f, 0x80, 0xbf, 0x2d,
+    0xe2, 0x19, 0x45, 0x32, 0x61, 0x1e, 0x09, 0x00, 0x07, 0xc0, 0x2d, 0xe3, 0x19, 0x83, 0x04, 0x7d, 0x04, 0x06, 0x0b, 0xc6, 0x80, 0x80, 0x5d, 0x07,
+    0x60, 0x31, 0xa3, 0x09, 0xa0, 0x33, 0x09, 0x00, 0x07, 0x5e, 0x07, 0x62, 0x31, 0x43, 0x02, 0x3d, 0x02, 0x06, 0x10, 0xc7, 0x7f, 0x80, 0x1f, 0x33,
+    0x02, 0x1e, 0x25, 0x37, 0x01, 0x22, 0x09, 0x00, 0x07, 0x20, 0x33, 0x03, 0x1e, 0x03, 0x04, 0xfd, 0x03, 0x01, 0x03, 0x5e, 0x06, 0xfe, 0x1c, 0x04,
+    0xe0, 0x06, 0x06, 0x23, 0xc5, 0x80, 0x80, 0x5d, 0xff, 0x60, 0xff, 0xa3, 0x00, 0xa0, 0x00, 0x09, 0x00, 0x07, 0x5e, 0xff, 0x62, 0xff, 0x43, 0x01,
+    0x3d, 0x01, 0x02, 0x06, 0x03, 0xc8, 0x80, 0x7f, 0x5b, 0x04, 0x1f, 0xff, 0x61, 0x0a, 0x1e, 0x05, 0x09, 0x00, 0x07, 0x5d, 0x04, 0x20, 0xff, 0x03,
+    0x06, 0xfd, 0x05, 0x06, 0x26, 0xc7, 0x80, 0x80, 0xbf, 0x29, 0xdf, 0x51, 0x41, 0x2c, 0x61, 0x54, 0x09, 0x00, 0x07, 0xc0, 0x29, 0xe0, 0x51, 0x80,
+    0x02, 0x80, 0x02, 0x06, 0x01, 0xc6, 0x80, 0x7f, 0x9f, 0x52, 0xdf, 0x02, 0x21, 0x54, 0x61, 0x04, 0x09, 0x00, 0x07, 0xa0, 0x52, 0xe0, 0x02, 0x80,
+    0x01, 0x80, 0x01, 0x06, 0x2c, 0xc7, 0x80, 0x80, 0x5f, 0x40, 0x1f, 0x3f, 0x61, 0x42, 0x21, 0x41, 0x09, 0x00, 0x07, 0x60, 0x40, 0x20, 0x3f, 0x00,
+    0x02, 0x00, 0x02, 0x01, 0x03, 0x5e, 0x28, 0x3e, 0x4f, 0x04, 0xe0, 0x06, 0x06, 0x17, 0xc5, 0x80, 0x80, 0x5d, 0xff, 0x60, 0xff, 0xa3, 0x00, 0xa0,
+    0x00, 0x09, 0x00, 0x07, 0x5e, 0xff, 0x62, 0xff, 0x43, 0x01, 0x3d, 0x01, 0x02, 0x06, 0x1b, 0xc8, 0x80, 0x80, 0x3f, 0x48, 0xff, 0x09, 0x01, 0x50,
+    0xc1, 0x11, 0x09, 0x00, 0x07, 0x40, 0x48, 0x00, 0x0a, 0xc0, 0x07, 0xc0, 0x07, 0x06, 0x1a, 0xc7, 0x7f, 0x80, 0xbf, 0x52, 0x02, 0x4f, 0x45, 0x57,
+    0x81, 0x53, 0x09, 0x00, 0x07, 0xc0, 0x52, 0x03, 0x4f, 0x83, 0x04, 0x7d, 0x04, 0x06, 0x1b, 0xc8, 0x80, 0x80, 0x3f, 0x49, 0xdf, 0x0f, 0x01, 0x4f,
+    0xa1, 0x15, 0x09, 0x00, 0x07, 0x40, 0x49, 0xe0, 0x0f, 0xc0, 0x05, 0xc0, 0x05, 0x06, 0x27, 0xc6, 0x80, 0x80, 0x9f, 0x2b, 0xdf, 0x46, 0x21, 0x2d,
+    0x61, 0x48, 0x09, 0x00, 0x07, 0xa0, 0x2b, 0xe0, 0x46, 0x80, 0x01, 0x80, 0x01, 0x06, 0x1b, 0xc7, 0x80, 0x80, 0x3f, 0x3d, 0x9f, 0x58, 0x81, 0x40,
+    0xe1, 0x5b, 0x09, 0x00, 0x07, 0x40, 0x3d, 0xa0, 0x58, 0x40, 0x03, 0x40, 0x03, 0x06, 0x06, 0xc8, 0x80, 0x80, 0xff, 0x37, 0x3f, 0x07, 0xc1, 0x3d,
+    0x01, 0x0d, 0x09, 0x00, 0x07, 0x00, 0x38, 0x40, 0x07, 0xc0, 0x05, 0xc0, 0x05, 0x06, 0x1b, 0xc7, 0x80, 0x80, 0x1f, 0x35, 0xbf, 0x0e, 0xe1, 0x38,
+    0x81, 0x12, 0x09, 0x00, 0x07, 0x20, 0x35, 0xc0, 0x0e, 0xc0, 0x03, 0xc0, 0x03, 0x06, 0x19, 0xc7, 0x7f, 0x80, 0x1f, 0x47, 0xa2, 0x26, 0x25, 0x4b,
+    0xa1, 0x2a, 0x09, 0x00, 0x07, 0x20, 0x47, 0xa3, 0x26, 0x03, 0x04, 0xfd, 0x03, 0x06, 0x2d, 0xc6, 0x80, 0x7f, 0xbb, 0x41, 0x3f, 0x20, 0x81, 0x43,
+    0xfe, 0x21, 0x09, 0x00, 0x07, 0xbd, 0x41, 0x40, 0x20, 0xc3, 0x01, 0xbd, 0x01, 0x01, 0x03, 0x5e, 0x0f, 0x9e, 0x02, 0x04, 0xe0, 0x06, 0x06, 0x15,
+    0xc5, 0x80, 0x80, 0x5d, 0xff, 0x60, 0xff, 0xa3, 0x00, 0xa0, 0x00, 0x09, 0x00, 0x07, 0x5e, 0xff, 0x62, 0xff, 0x43, 0x01, 0x3d, 0x01, 0x02, 0x06,
+    0x0b, 0xc6, 0x80, 0x7f, 0xfb, 0x04, 0xff, 0x53, 0xc1, 0x06, 0xbe, 0x55, 0x09, 0x00, 0x07, 0xfd, 0x04, 0x00, 0x54, 0xc3, 0x01, 0xbd, 0x01, 0x06,
+    0x1b, 0xc7, 0x80, 0x80, 0xbf, 0x1f, 0x1f, 0x52, 0xc1, 0x21, 0x21, 0x54, 0x09, 0x00, 0x07, 0xc0, 0x1f, 0x20, 0x52, 0x00, 0x02, 0x00, 0x02, 0x06,
+    0x1d, 0xc7, 0x7f, 0x80, 0x9f, 0x3f, 0x42, 0x04, 0xa5, 0x44, 0x41, 0x09, 0x09, 0x00, 0x07, 0xa0, 0x3f, 0x43, 0x04, 0x03, 0x05, 0xfd, 0x04, 0x06,
+    0x28, 0xc2, 0x80, 0x80, 0x7f, 0x50, 0xdf, 0x33, 0x01, 0x51, 0x61, 0x34, 0x09, 0x00, 0x07, 0x80, 0x50, 0xe0, 0x33, 0x80, 0x00, 0x80, 0x00, 0x06,
+    0x16, 0xc6, 0x80, 0x80, 0x9f, 0x4f, 0x1f, 0x26, 0x21, 0x51, 0xa1, 0x27, 0x09, 0x00, 0x07, 0xa0, 0x4f, 0x20, 0x26, 0x80, 0x01, 0x80, 0x01, 0x06,
+    0x11, 0xc7, 0x80, 0x80, 0x1f, 0x3f, 0xdf, 0x2f, 0x21, 0x41, 0xe1, 0x31, 0x09, 0x00, 0x07, 0x20, 0x3f, 0xe0, 0x2f, 0x00, 0x02, 0x00, 0x02, 0x06,
+    0x1b, 0xc7, 0x80, 0x80, 0xbf, 0x47, 0x1f, 0x4f, 0xc1, 0x49, 0x21, 0x51, 0x09, 0x00, 0x07, 0xc0, 0x47, 0x20, 0x4f, 0x00, 0x02, 0x00, 0x02, 0x06,
+    0x18, 0xc7, 0x80, 0x7f, 0xbf, 0x23, 0x5f, 0x1e, 0x41, 0x26, 0xe1, 0x20, 0x09, 0x00, 0x07, 0xc0, 0x23, 0x60, 0x1e, 0x80, 0x02, 0x80, 0x02, 0x06,
+    0x1b, 0xc5, 0x80, 0x80, 0x3f, 0x2e, 0x3f, 0x55, 0x41, 0x2f, 0x41, 0x56, 0x09, 0x00, 0x07, 0x40, 0x2e, 0x40, 0x55, 0x00, 0x01, 0x00, 0x01, 0x06,
+    0x1d, 0xc6, 0x80, 0x80, 0x5f, 0x23, 0x3f, 0x4e, 0xe1, 0x24, 0xc1, 0x4f, 0x09, 0x00, 0x07, 0x60, 0x23, 0x40, 0x4e, 0x80, 0x01, 0x80, 0x01, 0x06,
+    0x04, 0xc7, 0x80, 0x80, 0xdf, 0x00, 0x1f, 0x36, 0x21, 0x04, 0x61, 0x39, 0x09, 0x00, 0x07, 0xe0, 0x00, 0x20, 0x36, 0x40, 0x03, 0x40, 0x03, 0x06,
+    0x0b, 0xc6, 0x80, 0x80, 0xfd, 0x07, 0x80, 0x06, 0x43, 0x0a, 0xc0, 0x08, 0x09, 0x00, 0x07, 0xfe, 0x07, 0x82, 0x06, 0x43, 0x02, 0x3d, 0x02, 0x06,
+    0x1b, 0xc7, 0x80, 0x80, 0x7f, 0x54, 0x9f, 0x36, 0x81, 0x56, 0xa1, 0x38, 0x09, 0x00, 0x07, 0x80, 0x54, 0xa0, 0x36, 0x00, 0x02, 0x00, 0x02, 0x06,
+    0x18, 0xc7, 0x80, 0x80, 0x9d, 0x45, 0x00, 0x53, 0xa3, 0x48, 0x00, 0x56, 0x09, 0x00, 0x07, 0x9e, 0x45, 0x02, 0x53, 0x03, 0x03, 0xfd, 0x02, 0x06,
+    0x0a, 0xc8, 0x80, 0x80, 0xbf, 0x4c, 0x9f, 0x35, 0x01, 0x52, 0xe1, 0x3a, 0x09, 0x00, 0x07, 0xc0, 0x4c, 0xa0, 0x35, 0x40, 0x05, 0x40, 0x05, 0x06,
+    0x30, 0xc6, 0x80, 0x80, 0xfd, 0x21, 0xc0, 0x0d, 0x43, 0x24, 0x00, 0x10, 0x09, 0x00, 0x07, 0xfe, 0x21, 0xc2, 0x0d, 0x43, 0x02, 0x3d, 0x02, 0x06,
+    0x16, 0xc6, 0x80, 0x7f, 0xfb, 0x0c, 0x3f, 0x45, 0xc1, 0x0e, 0xfe, 0x46, 0x09, 0x00, 0x07, 0xfd, 0x0c, 0x40, 0x45, 0xc3, 0x01, 0xbd, 0x01, 0x06,
+    0x1b, 0xc7, 0x80, 0x80, 0xdd, 0x06, 0x40, 0x18, 0xe3, 0x09, 0x40, 0x1b, 0x09, 0x00, 0x07, 0xde, 0x06, 0x42, 0x18, 0x03, 0x03, 0xfd, 0x02, 0x06,
+    0x1b, 0xc2, 0x80, 0x80, 0xbf, 0x02, 0x7f, 0x08, 0x41, 0x03, 0x01, 0x09, 0x09, 0x00, 0x07, 0xc0, 0x02, 0x80, 0x08, 0x80, 0x00, 0x80, 0x00, 0x06,
+    0x16, 0xc7, 0x80, 0x80, 0xbf, 0x07, 0xbf, 0x57, 0x41, 0x0a, 0x41, 0x5a, 0x09, 0x00, 0x07, 0xc0, 0x07, 0xc0, 0x57, 0x80, 0x02, 0x80, 0x02, 0x06,
+    0x19, 0xc7, 0x7f, 0x80, 0xff, 0x2a, 0x82, 0x03, 0x05, 0x2f, 0x81, 0x07, 0x09, 0x00, 0x07, 0x00, 0x2b, 0x83, 0x03, 0x03, 0x04, 0xfd, 0x03, 0x06,
+    0x17, 0xc2, 0x80, 0x80, 0xff, 0x29, 0x3f, 0x08, 0x81, 0x2a, 0xc1, 0x08, 0x09, 0x00, 0x07, 0x00, 0x2a, 0x40, 0x08, 0x80, 0x00, 0x80, 0x00, 0x06,
+    0x2d, 0xc8, 0x80, 0x80, 0xdf, 0x4b, 0x9f, 0x04, 0x21, 0x51, 0xe1, 0x09, 0x09, 0x00, 0x07, 0xe0, 0x4b, 0xa0, 0x04, 0x40, 0x05, 0x40, 0x05, 0x06,
+    0x24, 0xc6, 0x80, 0x7f, 0xfb, 0x0e, 0xdf, 0x4b, 0xc1, 0x10, 0x9e, 0x4d, 0x09, 0x00, 0x07, 0xfd, 0x0e, 0xe0, 0x4b, 0xc3, 0x01, 0xbd, 0x01, 0x06,
+    0x14, 0xc5, 0x80, 0x80, 0x5f, 0x2b, 0xff, 0x5b, 0x61, 0x2c, 0x01, 0x5d, 0x09, 0x00, 0x07, 0x60, 0x2b, 0x00, 0x5c, 0x00, 0x01, 0x00, 0x01, 0x06,
+    0x16, 0xc6, 0x80, 0x80, 0xdd, 0x3c, 0x80, 0x41, 0x23, 0x3f, 0xc0, 0x43, 0x09, 0x00, 0x07, 0xde, 0x3c, 0x82, 0x41, 0x43, 0x02, 0x3d, 0x02, 0x06,
+    0x1f, 0xc2, 0x80, 0x80, 0x5f, 0x13, 0xbf, 0x22, 0xe1, 0x13, 0x41, 0x23, 0x09, 0x00, 0x07, 0x60, 0x13, 0xc0, 0x22, 0x80, 0x00, 0x80, 0x00, 0x06,
+    0x01, 0xc7, 0x80, 0x80, 0x5f, 0x44, 0x9f, 0x38, 0xa1, 0x47, 0xe1, 0x3b, 0x09, 0x00, 0x07, 0x60, 0x44, 0xa0, 0x38, 0x40, 0x03, 0x40, 0x03, 0x06,
+    0x0d, 0xc7, 0x80, 0x80, 0x5d, 0x05, 0x00, 0x3a, 0x63, 0x08, 0x00, 0x3d, 0x09, 0x00, 0x07, 0x5e, 0x05, 0x02, 0x3a, 0x03, 0x03, 0xfd, 0x02, 0x06,
+    0x08, 0xc6, 0x80, 0x80, 0xdd, 0x50, 0xe0, 0x55, 0x23, 0x53, 0x20, 0x58, 0x09, 0x00, 0x07, 0xde, 0x50, 0xe2, 0x55, 0x43, 0x02, 0x3d, 0x02, 0x06,
+    0x1b, 0xc7, 0x80, 0x80, 0x3d, 0x4d, 0x20, 0x2a, 0xc3, 0x50, 0xa0, 0x2d, 0x09, 0x00, 0x07, 0x3e, 0x4d, 0x22, 0x2a, 0x83, 0x03, 0x7d, 0x03, 0x06,
+    0x07, 0xc6, 0x80, 0x80, 0x5d, 0x00, 0xc0, 0x1f, 0xa3, 0x02, 0x00, 0x22, 0x09, 0x00, 0x07, 0x5e, 0x00, 0xc2, 0x1f, 0x43, 0x02, 0x3d, 0x02, 0x06,
+    0x1b, 0xc2, 0x80, 0x80, 0xff, 0x3e, 0xff, 0x2a, 0x81, 0x3f, 0x81, 0x2b, 0x09, 0x00, 0x07, 0x00, 0x3f, 0x00, 0x2b, 0x80, 0x00, 0x80, 0x00, 0x06,
+    0x02, 0xc8, 0x80, 0x80, 0x3f, 0x46, 0xff, 0x13, 0xc1, 0x4c, 0x81, 0x1a, 0x09, 0x00, 0x07, 0x40, 0x46, 0x00, 0x14, 0x80, 0x06, 0x80, 0x06, 0x06,
+    0x1b, 0xc5, 0x80, 0x80, 0x1f, 0x3d, 0xbf, 0x1c, 0xe1, 0x3d, 0x81, 0x1d, 0x3a, 0x00, 0x01, 0xe0, 0x3d, 0x20, 0x1d, 0x03, 0xe0, 0x3d, 0x56, 0x1d,
+    0xb6, 0x3d, 0x80, 0x1d, 0x80, 0x3d, 0x80, 0x1d, 0x03, 0x4a, 0x3d, 0x80, 0x1d, 0x20, 0x3d, 0x56, 0x1d, 0x20, 0x3d, 0x20, 0x1d, 0x03, 0x20, 0x3d,
+    0xea, 0x1c, 0x4a, 0x3d, 0xc0, 0x1c, 0x80, 0x3d, 0xc0, 0x1c, 0x03, 0xb6, 0x3d, 0xc0, 0x1c, 0xe0, 0x3d, 0xea, 0x1c, 0xe0, 0x3d, 0x20, 0x1d, 0x04,
+    0x06, 0x21, 0xc7, 0x7f, 0x80, 0xff, 0x35, 0x3f, 0x2b, 0xc1, 0x38, 0x01, 0x2e, 0x09, 0x00, 0x07, 0x00, 0x36, 0x40, 0x2b, 0xc0, 0x02, 0xc0, 0x02,
+    0x06, 0x1b, 0xc5, 0x80, 0x80, 0x1f, 0x42, 0xff, 0x32, 0x21, 0x43, 0x01, 0x34, 0x09, 0x00, 0x07, 0x20, 0x42, 0x00, 0x33, 0x00, 0x01, 0x00, 0x01,
+    0x06, 0x18, 0xc7, 0x7f, 0x80, 0xff, 0x45, 0x62, 0x5c, 0x05, 0x4b, 0x61, 0x61, 0x09, 0x00, 0x07, 0x00, 0x46, 0x63, 0x5c, 0x03, 0x05, 0xfd, 0x04,
+    0x06, 0x16, 0xc5, 0x80, 0x80, 0x9f, 0x15, 0x7f, 0x35, 0xa1, 0x16, 0x81, 0x36, 0x09, 0x00, 0x07, 0xa0, 0x15, 0x80, 0x35, 0x00, 0x01, 0x00, 0x01,
+    0x06, 0x0a, 0xc6, 0x80, 0x80, 0x3f, 0x3c, 0xdf, 0x29, 0xc1, 0x3d, 0x61, 0x2b, 0x09, 0x00, 0x07, 0x40, 0x3c, 0xe0, 0x29, 0x80, 0x01, 0x80, 0x01,
+    0x06, 0x1d, 0xc5, 0x7f, 0x80, 0x1f, 0x1c, 0xff, 0x23, 0x21, 0x1d, 0x01, 0x25, 0x09, 0x00, 0x07, 0x20, 0x1c, 0x00, 0x24, 0x00, 0x01, 0x00, 0x01,
+    0x06, 0x1b, 0xc6, 0x80, 0x7f, 0xfb, 0x2a, 0xbf, 0x11, 0xc1, 0x2c, 0x7e, 0x13, 0x09, 0x00, 0x07, 0xfd, 0x2a, 0xc0, 0x11, 0xc3, 0x01, 0xbd, 0x01,
+    0x06, 0x1b, 0xc7, 0x80, 0x80, 0xff, 0x08, 0x9f, 0x15, 0x41, 0x0c, 0xe1, 0x18, 0x09, 0x00, 0x07, 0x00, 0x09, 0xa0, 0x15, 0x40, 0x03, 0x40, 0x03,
+    0x06, 0x1b, 0xc5, 0x7f, 0x7f, 0xbf, 0x31, 0x3f, 0x18, 0x81, 0x32, 0x01, 0x19, 0x3a, 0x00, 0x01, 0x80, 0x32, 0xa0, 0x18, 0x03, 0x80, 0x32, 0xd6,
+    0x18, 0x56, 0x32, 0x00, 0x19, 0x20, 0x32, 0x00, 0x19, 0x03, 0xea, 0x31, 0x00, 0x19, 0xc0, 0x31, 0xd6, 0x18, 0xc0, 0x31, 0xa0, 0x18, 0x03, 0xc0,
+    0x31, 0x6a, 0x18, 0xea, 0x31, 0x40, 0x18, 0x20, 0x32, 0x40, 0x18, 0x03, 0x56, 0x32, 0x40, 0x18, 0x80, 0x32, 0x6a, 0x18, 0x80, 0x32, 0xa0, 0x18,
+    0x04, 0x06, 0x03, 0xc8, 0x80, 0x80, 0x3f, 0x4a, 0xff, 0xfb, 0xc1, 0x52, 0x81, 0x04, 0x09, 0x00, 0x07, 0x40, 0x4a, 0x00, 0xfc, 0x80, 0x08, 0x80,
+    0x08, 0x06, 0x2b, 0xc7, 0x80, 0x80, 0xdf, 0x4c, 0x5f, 0x18, 0xa1, 0x50, 0x21, 0x1c, 0x09, 0x00, 0x07, 0xe0, 0x4c, 0x60, 0x18, 0xc0, 0x03, 0xc0,
+    0x03, 0x06, 0x07, 0xc8, 0x80, 0x7f, 0xfb, 0xfc, 0x3f, 0x00, 0x81, 0x03, 0xbe, 0x06, 0x09, 0x00, 0x07, 0xfd, 0xfc, 0x40, 0x00, 0x83, 0x06, 0x7d,
+    0x06, 0x06, 0x15, 0xc6, 0x80, 0x80, 0x5f, 0x0c, 0xdf, 0x40, 0xe1, 0x0d, 0x61, 0x42, 0x09, 0x00, 0x07, 0x60, 0x0c, 0xe0, 0x40, 0x80, 0x01, 0x80,
+    0x01, 0x06, 0x1b, 0xc7, 0x80, 0x80, 0x9d, 0x0b, 0xc0, 0x5b, 0x23, 0x0f, 0x40, 0x5f, 0x09, 0x00, 0x07, 0x9e, 0x0b, 0xc2, 0x5b, 0x83, 0x03, 0x7d,
+    0x03, 0x06, 0x30, 0xc2, 0x80, 0x80, 0x3f, 0x51, 0x7f, 0x13, 0xc1, 0x51, 0x01, 0x14, 0x09, 0x00, 0x07, 0x40, 0x51, 0x80, 0x13, 0x80, 0x00, 0x80,
+    0x00, 0x01, 0x03, 0x7e, 0x41, 0x5e, 0x5a, 0x04, 0xe0, 0x06, 0x06, 0x11, 0xc5, 0x80, 0x80, 0x5d, 0xff, 0x60, 0xff, 0xa3, 0x00, 0xa0, 0x00, 0x09,
+    0x00, 0x07, 0x5e, 0xff, 0x62, 0xff, 0x43, 0x01, 0x3d, 0x01, 0x02, 0x06, 0x1b, 0xc2, 0x80, 0x7f, 0xbf, 0x08, 0x7f, 0x3b, 0x41, 0x09, 0x01, 0x3c,
+    0x09, 0x00, 0x07, 0xc0, 0x08, 0x80, 0x3b, 0x80, 0x00, 0x80, 0x00, 0x06, 0x1b, 0xc8, 0x80, 0x80, 0xff, 0x25, 0x7f, 0x10, 0x41, 0x2b, 0xc1, 0x15,
+    0x09, 0x00, 0x07, 0x00, 0x26, 0x80, 0x10, 0x40, 0x05, 0x40, 0x05, 0x06, 0x0b, 0xc7, 0x80, 0x80, 0x5f, 0x0c, 0x5f, 0x3d, 0x61, 0x0e, 0x61, 0x3f,
+    0x09, 0x00, 0x07, 0x60, 0x0c, 0x60, 0x3d, 0x00, 0x02, 0x00, 0x02, 0x06, 0x00, 0xc7, 0x80, 0x80, 0x7f, 0x48, 0x1f, 0x5a, 0xc1, 0x4b, 0x61, 0x5d,
+    0x09, 0x00, 0x07, 0x80, 0x48, 0x20, 0x5a, 0x40, 0x03, 0x40, 0x03, 0x06, 0x1b, 0xc5, 0x80, 0x80, 0xdf, 0x12, 0x5f, 0x3d, 0xa1, 0x13, 0x21, 0x3e,
+    0x3a, 0x00, 0x01, 0xa0, 0x13, 0xc0, 0x3d, 0x03, 0xa0, 0x13, 0xf6, 0x3d, 0x76, 0x13, 0x20, 0x3e, 0x40, 0x13, 0x20, 0x3e, 0x03, 0x0a, 0x13, 0x20,
+    0x3e, 0xe0, 0x12, 0xf6, 0x3d, 0xe0, 0x12, 0xc0, 0x3d, 0x03, 0xe0, 0x12, 0x8a, 0x3d, 0x0a, 0x13, 0x60, 0x3d, 0x40, 0x13, 0x60, 0x3d, 0x03, 0x76,
+    0x13, 0x60, 0x3d, 0xa0, 0x13, 0x8a, 0x3d, 0xa0, 0x13, 0xc0, 0x3d, 0x04, 0x06, 0x14, 0xc7, 0x7f, 0x80, 0x7d, 0x1b, 0xc0, 0x16, 0x03, 0x1f, 0x40,
+    0x1a, 0x09, 0x00, 0x07, 0x7e, 0x1b, 0xc2, 0x16, 0x83, 0x03, 0x7d, 0x03, 0x06, 0x2e, 0xc7, 0x80, 0x80, 0x5f, 0x4e, 0xdf, 0x1f, 0x61, 0x50, 0xe1,
+    0x21, 0x09, 0x00, 0x07, 0x60, 0x4e, 0xe0, 0x1f, 0x00, 0x02, 0x00, 0x02, 0x06, 0x06, 0xc7, 0x80, 0x80, 0xdf, 0x20, 0xbf, 0x01, 0xa1, 0x24, 0x81,
+    0x05, 0x09, 0x00, 0x07, 0xe0, 0x20, 0xc0, 0x01, 0xc0, 0x03, 0xc0, 0x03, 0x06, 0x0b, 0xc8, 0x80, 0x80, 0xdf, 0x48, 0x7f, 0x52, 0xa1, 0x4e, 0x41,
+    0x58, 0x09, 0x00, 0x07, 0xe0, 0x48, 0x80, 0x52, 0xc0, 0x05, 0xc0, 0x05, 0x06, 0x24, 0xc7, 0x80, 0x80, 0x9f, 0x2a, 0x1f, 0x1c, 0x21, 0x2d, 0xa1,
+    0x1e, 0x09, 0x00, 0x07, 0xa0, 0x2a, 0x20, 0x1c, 0x80, 0x02, 0x80, 0x02, 0x06, 0x30, 0xc6, 0x80, 0x7f, 0x9b, 0x4a, 0x7f, 0x15, 0x61, 0x4c, 0x3e,
+    0x17, 0x09, 0x00, 0x07, 0x9d, 0x4a, 0x80, 0x15, 0xc3, 0x01, 0xbd, 0x01, 0x06, 0x2b, 0xc6, 0x80, 0x80, 0xdf, 0x55, 0x5f, 0x49, 0x61, 0x57, 0xe1,
+    0x4a, 0x09, 0x00, 0x07, 0xe0, 0x55, 0x60, 0x49, 0x80, 0x01, 0x80, 0x01, 0x06, 0x12, 0xc7, 0x7f, 0x80, 0xdf, 0x5a, 0xc2, 0x44, 0x65, 0x5f, 0x41,
+    0x49, 0x09, 0x00, 0x07, 0xe0, 0x5a, 0xc3, 0x44, 0x83, 0x04, 0x7d, 0x04, 0x06, 0x19, 0xc7, 0x80, 0x80, 0x1f, 0x10, 0x7f, 0x24, 0x21, 0x12, 0x81,
+    0x26, 0x09, 0x00, 0x07, 0x20, 0x10, 0x80, 0x24, 0x00, 0x02, 0x00, 0x02, 0x06, 0x1b, 0xc7, 0x7f, 0x80, 0x9f, 0x43, 0xc2, 0x3c, 0x25, 0x48, 0x41,
+    0x41, 0x09, 0x00, 0x07, 0xa0, 0x43, 0xc3, 0x3c, 0x83, 0x04, 0x7d, 0x04, 0x06, 0x1a, 0xc6, 0x80, 0x80, 0x9d, 0x18, 0x80, 0x56, 0xe3, 0x1a, 0xc0,
+    0x58, 0x09, 0x00, 0x07, 0x9e, 0x18, 0x82, 0x56, 0x43, 0x02, 0x3d, 0x02, 0x06, 0x1b, 0xc7, 0x80, 0x80, 0xbd, 0x3b, 0x20, 0x44, 0xc3, 0x3e, 0x20,
+    0x47, 0x09, 0x00, 0x07, 0xbe, 0x3b, 0x22, 0x44, 0x03, 0x03, 0xfd, 0x02, 0x06, 0x18, 0xc8, 0x80, 0x80, 0xff, 0x19, 0xdf, 0xfe, 0x01, 0x21, 0xe1,
+    0x05, 0x09, 0x00, 0x07, 0x00, 0x1a, 0xe0, 0xfe, 0x00, 0x07, 0x00, 0x07, 0x06, 0x1b, 0xc2, 0x80, 0x80, 0x5f, 0x1f, 0x7f, 0x1f, 0xe1, 0x1f, 0x01,
+    0x20, 0x09, 0x00, 0x07, 0x60, 0x1f, 0x80, 0x1f, 0x80, 0x00, 0x80, 0x00, 0x06, 0x17, 0xc7, 0x7f, 0x80, 0x7f, 0x3d, 0x02, 0x0a, 0x05, 0x42, 0x81,
+    0x0e, 0x09, 0x00, 0x07, 0x80, 0x3d, 0x03, 0x0a, 0x83, 0x04, 0x7d, 0x04, 0x06, 0x1b, 0xc6, 0x80, 0x80, 0x5d, 0x32, 0xc0, 0x36, 0xa3, 0x34, 0x00,
+    0x39, 0x09, 0x00, 0x07, 0x5e, 0x32, 0xc2, 0x36, 0x43, 0x02, 0x3d, 0x02, 0x06, 0x1f, 0xc8, 0x80, 0x80, 0xff, 0x4b, 0x7f, 0x11, 0xc1, 0x51, 0x41,
+    0x17, 0x09, 0x00, 0x07, 0x00, 0x4c, 0x80, 0x11, 0xc0, 0x05, 0xc0, 0x05, 0x06, 0x0a, 0xc2, 0x7f, 0x80, 0xbf, 0x2b, 0x7f, 0x25, 0x41, 0x2c, 0x01,
+    0x26, 0x09, 0x00, 0x07, 0xc0, 0x2b, 0x80, 0x25, 0x80, 0x00, 0x80, 0x00, 0x06, 0x0d, 0xc7, 0x80, 0x80, 0x9f, 0x43, 0x1f, 0x29, 0x61, 0x46, 0xe1,
+    0x2b, 0x09, 0x00, 0x07, 0xa0, 0x43, 0x20, 0x29, 0xc0, 0x02, 0xc0, 0x02, 0x06, 0x1b, 0xc2, 0x80, 0x7f, 0xff, 0x43, 0x5f, 0x5b, 0x81, 0x44, 0xe1,
+    0x5b, 0x09, 0x00, 0x07, 0x00, 0x44, 0x60, 0x5b, 0x80, 0x00, 0x80, 0x00, 0x06, 0x2b, 0xc7, 0x7f, 0x80, 0x7f, 0x2d, 0x5f, 0x44, 0x81, 0x2f, 0x61,
+    0x46, 0x09, 0x00, 0x07, 0x80, 0x2d, 0x60, 0x44, 0x00, 0x02, 0x00, 0x02, 0x06, 0x18, 0xc7, 0x80, 0x80, 0x5f, 0x19, 0xff, 0x58, 0xa1, 0x1c, 0x41,
+    0x5c, 0x09, 0x00, 0x07, 0x60, 0x19, 0x00, 0x59, 0x40, 0x03, 0x40, 0x03, 0x06, 0x07, 0xc6, 0x80, 0x80, 0xbd, 0x13, 0xc0, 0x51, 0x03, 0x16, 0x00,
+    0x54, 0x09, 0x00, 0x07, 0xbe, 0x13, 0xc2, 0x51, 0x43, 0x02, 0x3d, 0x02, 0x06, 0x30, 0xc6, 0x80, 0x80, 0xdd, 0x56, 0xa0, 0x5b, 0x23, 0x59, 0xe0,
+    0x5d, 0x09, 0x00, 0x07, 0xde, 0x56, 0xa2, 0x5b, 0x43, 0x02, 0x3d, 0x02, 0x06, 0x30, 0xc6, 0x80, 0x7f, 0x5b, 0x3b, 0x9f, 0x54, 0x21, 0x3d, 0x5e,
+    0x56, 0x09, 0x00, 0x07, 0x5d, 0x3b, 0xa0, 0x54, 0xc3, 0x01, 0xbd, 0x01, 0x06, 0x17, 0xc7, 0x80, 0x80, 0xdf, 0x0b, 0x7f, 0x24, 0xe1, 0x0d, 0x81,
+    0x26, 0x09, 0x00, 0x07, 0xe0, 0x0b, 0x80, 0x24, 0x00, 0x02, 0x00, 0x02, 0x06, 0x17, 0xc8, 0x80, 0x80, 0x3f, 0x55, 0xbf, 0x10, 0x81, 0x5d, 0x01,
+    0x19, 0x09, 0x00, 0x07, 0x40, 0x55, 0xc0, 0x10, 0x40, 0x08, 0x40, 0x08, 0x06, 0x1b, 0xc7, 0x80, 0x80, 0xbf, 0x17, 0xff, 0x5b, 0x41, 0x1a, 0x81,
+    0x5e, 0x09, 0x00, 0x07, 0xc0, 0x17, 0x00, 0x5c, 0x80, 0x02, 0x80, 0x02, 0x06, 0x1b, 0xc8, 0x80, 0x80, 0x9f, 0x57, 0x7f, 0x0e, 0x61, 0x5d, 0x41,
+    0x14, 0x09, 0x00, 0x07, 0xa0, 0x57, 0x80, 0x0e, 0xc0, 0x05, 0xc0, 0x05, 0x06, 0x0b, 0xc8, 0x80, 0x80, 0xbf, 0x13, 0x1f, 0x16, 0x81, 0x18, 0xe1,
+    0x1a, 0x09, 0x00, 0x07, 0xc0, 0x13, 0x20, 0x16, 0xc0, 0x04, 0xc0, 0x04, 0x06, 0x0b, 0xc7, 0x80, 0x80, 0x1d, 0x4b, 0xe0, 0x42, 0x23, 0x4e, 0xe0,
+    0x45, 0x09, 0x00, 0x07, 0x1e, 0x4b, 0xe2, 0x42, 0x03, 0x03, 0xfd, 0x02, 0x06, 0x1f, 0xc7, 0x80, 0x80, 0xff, 0x06, 0x7f, 0x47, 0x01, 0x09, 0x81,
+    0x49, 0x09, 0x00, 0x07, 0x00, 0x07, 0x80, 0x47, 0x00, 0x02, 0x00, 0x02, 0x06, 0x1a, 0xc7, 0x80, 0x80, 0x5f, 0x52, 0x1f, 0x20, 0xe1, 0x54, 0xa1,
+    0x22, 0x09, 0x00, 0x07, 0x60, 0x52, 0x20, 0x20, 0x80, 0x02, 0x80, 0x02, 0x06, 0x26, 0xc6, 0x80, 0x80, 0x9d, 0x37, 0xe0, 0x01, 0xe3, 0x39, 0x20,
+    0x04, 0x09, 0x00, 0x07, 0x9e, 0x37, 0xe2, 0x01, 0x43, 0x02, 0x3d, 0x02, 0x01, 0x03, 0x5e, 0x21, 0x5e, 0x5d, 0x04, 0xe0, 0x06, 0x06, 0x16, 0xc5,
+    0x80, 0x80, 0x5d, 0xff, 0x60, 0xff, 0xa3, 0x00, 0xa0, 0x00, 0x09, 0x00, 0x07, 0x5e, 0xff, 0x62, 0xff, 0x43, 0x01, 0x3d, 0x01, 0x02, 0x06, 0x26,
+    0xc7, 0x80, 0x80, 0xdf, 0xfe, 0x1f, 0x31, 0xa1, 0x02, 0xe1, 0x34, 0x09, 0x00, 0x07, 0xe0, 0xfe, 0x20, 0x31, 0xc0, 0x03, 0xc0, 0x03, 0x06, 0x19,
+    0xc8, 0x80, 0x80, 0xbf, 0x5a, 0x5f, 0x07, 0xc1, 0x60, 0x61, 0x0d, 0x09, 0x00, 0x07, 0xc0, 0x5a, 0x60, 0x07, 0x00, 0x06, 0x00, 0x06, 0x06, 0x13,
+    0xc7, 0x80, 0x80, 0xff, 0x36, 0xdf, 0x4e, 0x01, 0x39, 0xe1, 0x50, 0x09, 0x00, 0x07, 0x00, 0x37, 0xe0, 0x4e, 0x00, 0x02, 0x00, 0x02, 0x06, 0x15,
+    0xc5, 0x80, 0x80, 0x7f, 0x35, 0x5f, 0x40, 0x81, 0x36, 0x61, 0x41, 0x09, 0x00, 0x07, 0x80, 0x35, 0x60, 0x40, 0x00, 0x01, 0x00, 0x01, 0x06, 0x12,
+    0xc6, 0x80, 0x80, 0xff, 0x36, 0x9f, 0x38, 0x81, 0x38, 0x21, 0x3a, 0x09, 0x00, 0x07, 0x00, 0x37, 0xa0, 0x38, 0x80, 0x01, 0x80, 0x01, 0x06, 0x2d,
+    0xc7, 0x7f, 0x80, 0x5f, 0x10, 0x42, 0x0d, 0xe5, 0x14, 0xc1, 0x11, 0x09, 0x00, 0x07, 0x60, 0x10, 0x43, 0x0d, 0x83, 0x04, 0x7d, 0x04, 0x06, 0x15,
+    0xc7, 0x7f, 0x80, 0xdf, 0x40, 0xc2, 0x36, 0xe5, 0x44, 0xc1, 0x3a, 0x09, 0x00, 0x07, 0xe0, 0x40, 0xc3, 0x36, 0x03, 0x04, 0xfd, 0x03, 0x06, 0x23,
+    0xc7, 0x80, 0x80, 0x9f, 0x35, 0xdf, 0x42, 0x21, 0x38, 0x61, 0x45, 0x09, 0x00, 0x07, 0xa0, 0x35, 0xe0, 0x42, 0x80, 0x02, 0x80, 0x02, 0x06, 0x24,
+    0xc8, 0x80, 0x80, 0xdf, 0x08, 0x7f, 0x18, 0x21, 0x0d, 0xc1, 0x1c, 0x09, 0x00, 0x07, 0xe0, 0x08, 0x80, 0x18, 0x40, 0x04, 0x40, 0x04, 0x06, 0x1c,
+    0xc7, 0x7f, 0x80, 0xdf, 0x50, 0xa2, 0x51, 0xe5, 0x54, 0xa1, 0x55, 0x09, 0x00, 0x07, 0xe0, 0x50, 0xa3, 0x51, 0x03, 0x04, 0xfd, 0x03, 0x06, 0x1b,
+    0xc2, 0x80, 0x80, 0xbf, 0xff, 0x3f, 0x1f, 0x41, 0x00, 0xc1, 0x1f, 0x09, 0x00, 0x07, 0xc0, 0xff, 0x40, 0x1f, 0x80, 0x00, 0x80, 0x00, 0x06, 0x26,
+    0xc5, 0x7f, 0x80, 0x3f, 0x5f, 0xff, 0x44, 0x41, 0x60, 0x01, 0x46, 0x09, 0x00, 0x07, 0x40, 0x5f, 0x00, 0x45, 0x00, 0x01, 0x00, 0x01, 0x06, 0x0b,
+    0xc8, 0x80, 0x80, 0xdf, 0x38, 0xff, 0x21, 0xa1, 0x3d, 0xc1, 0x26, 0x09, 0x00, 0x07, 0xe0, 0x38, 0x00, 0x22, 0xc0, 0x04, 0xc0, 0x04, 0x06, 0x1e,
+    0xc7, 0x7f, 0x80, 0x7f, 0x2e, 0xc2, 0x12, 0x85, 0x32, 0xc1, 0x16, 0x09, 0x00, 0x07, 0x80, 0x2e, 0xc3, 0x12, 0x03, 0x04, 0xfd, 0x03, 0x06, 0x15,
+    0xc5, 0x80, 0x80, 0xbf, 0x2b, 0x5f, 0x31, 0x81, 0x2c, 0x21, 0x32, 0x3a, 0x00, 0x01, 0x80, 0x2c, 0xc0, 0x31, 0x03, 0x80, 0x2c, 0xf6, 0x31, 0x56,
+    0x2c, 0x20, 0x32, 0x20, 0x2c, 0x20, 0x32, 0x03, 0xea, 0x2b, 0x20, 0x32, 0xc0, 0x2b, 0xf6, 0x31, 0xc0, 0x2b, 0xc0, 0x31, 0x03, 0xc0, 0x2b, 0x8a,
+    0x31, 0xea, 0x2b, 0x60, 0x31, 0x20, 0x2c, 0x60, 0x31, 0x03, 0x56, 0x2c, 0x60, 0x31, 0x80, 0x2c, 0x8a, 0x31, 0x80, 0x2c, 0xc0, 0x31, 0x04, 0x06,
+    0x0b, 0xc2, 0x80, 0x80, 0x9f, 0x43, 0x5f, 0x58, 0x21, 0x44, 0xe1, 0x58, 0x09, 0x00, 0x07, 0xa0, 0x43, 0x60, 0x58, 0x80, 0x00, 0x80, 0x00, 0x06,
+    0x1d, 0xc6, 0x80, 0x7f, 0xbf, 0x3d, 0xdf, 0x02, 0x41, 0x3f, 0x61, 0x04, 0x09, 0x00, 0x07, 0xc0, 0x3d, 0xe0, 0x02, 0x80, 0x01, 0x80, 0x01, 0x06,
+    0x01, 0xc7, 0x7f, 0x80, 0xdf, 0x24, 0x02, 0xff, 0xe5, 0x28, 0x01, 0x03, 0x09, 0x00, 0x07, 0xe0, 0x24, 0x03, 0xff, 0x03, 0x04, 0xfd, 0x03, 0x06,
+    0x30, 0xc7, 0x80, 0x80, 0x3f, 0x39, 0x3f, 0x29, 0x01, 0x3c, 0x01, 0x2c, 0x09, 0x00, 0x07, 0x40, 0x39, 0x40, 0x29, 0xc0, 0x02, 0xc0, 0x02, 0x01,
+    0x03, 0x1e, 0x11, 0x5e, 0x50, 0x04, 0xe0, 0x06, 0x06, 0x1b, 0xc5, 0x80, 0x80, 0x5d, 0xff, 0x60, 0xff, 0xa3, 0x00, 0xa0, 0x00, 0x09, 0x00, 0x07,
+    0x5e, 0xff, 0x62, 0xff, 0x43, 0x01, 0x3d, 0x01, 0x02, 0x06, 0x1c, 0xc5, 0x80, 0x80, 0xbf, 0x24, 0xdf, 0x2c, 0x81, 0x25, 0xa1, 0x2d, 0x3a, 0x00,
+    0x01, 0x80, 0x25, 0x40, 0x2d, 0x03, 0x80, 0x25, 0x76, 0x2d, 0x56, 0x25, 0xa0, 0x2d, 0x20, 0x25, 0xa0, 0x2d, 0x03, 0xea, 0x24, 0xa0, 0x2d, 0xc0,
+    0x24, 0x76, 0x2d, 0xc0, 0x24, 0x40, 0x2d, 0x03, 0xc0, 0x24, 0x0a, 0x2d, 0xea, 0x24, 0xe0, 0x2c, 0x20, 0x25, 0xe0, 0x2c, 0x03, 0x56, 0x25, 0xe0,
+    0x2c, 0x80, 0x25, 0x0a, 0x2d, 0x80, 0x25, 0x40, 0x2d, 0x04, 0x06, 0x1b, 0xc7, 0x80, 0x80, 0x3f, 0x0e, 0x9f, 0x04, 0xc1, 0x10, 0x21, 0x07, 0x09,
+    0x00, 0x07, 0x40, 0x0e, 0xa0, 0x04, 0x80, 0x02, 0x80, 0x02, 0x06, 0x00, 0xc7, 0x80, 0x80, 0x9f, 0x20, 0x9f, 0x05, 0x21, 0x23, 0x21, 0x08, 0x09,
+    0x00, 0x07, 0xa0, 0x20, 0xa0, 0x05, 0x80, 0x02, 0x80, 0x02, 0x06, 0x26, 0xc5, 0x80, 0x80, 0xff, 0x20, 0x3f, 0x47, 0xc1, 0x21, 0x01, 0x48, 0x3a,
+    0x00, 0x01, 0xc0, 0x21, 0xa0, 0x47, 0x03, 0xc0, 0x21, 0xd6, 0x47, 0x96, 0x21, 0x00, 0x48, 0x60, 0x21, 0x00, 0x48, 0x03, 0x2a, 0x21, 0x00, 0x48,
+    0x00, 0x21, 0xd6, 0x47, 0x00, 0x21, 0xa0, 0x47, 0x03, 0x00, 0x21, 0x6a, 0x47, 0x2a, 0x21, 0x40, 0x47, 0x60, 0x21, 0x40, 0x47, 0x03, 0x96, 0x21,
+    0x40, 0x47, 0xc0, 0x21, 0x6a, 0x47, 0xc0, 0x21, 0xa0, 0x47, 0x04, 0x06, 0x04, 0xc6, 0x80, 0x7f, 0x3b, 0x36, 0x5f, 0x21, 0x01, 0x38, 0x1e, 0x23,
+    0x09, 0x00, 0x07, 0x3d, 0x36, 0x60, 0x21, 0xc3, 0x01, 0xbd, 0x01, 0x06, 0x1b, 0xc5, 0x7f, 0x7f, 0x1f, 0x09, 0x9f, 0x4a, 0xe1, 0x09, 0x61, 0x4b,
+    0x3a, 0x00, 0x01, 0xe0, 0x09, 0x00, 0x4b, 0x03, 0xe0, 0x09, 0x36, 0x4b, 0xb6, 0x09, 0x60, 0x4b, 0x80, 0x09, 0x60, 0x4b, 0x03, 0x4a, 0x09, 0x60,
+    0x4b, 0x20, 0x09, 0x36, 0x4b, 0x20, 0x09, 0x00, 0x4b, 0x03, 0x20, 0x09, 0xca, 0x4a, 0x4a, 0x09, 0xa0, 0x4a, 0x80, 0x09, 0xa0, 0x4a, 0x03, 0xb6,
+    0x09, 0xa0, 0x4a, 0xe0, 0x09, 0xca, 0x4a, 0xe0, 0x09, 0x00, 0x4b, 0x04, 0x06, 0x1d, 0xc7, 0x80, 0x80, 0xdf, 0x19, 0x5f, 0x5b, 0x21, 0x1d, 0xa1,
+    0x5e, 0x09, 0x00, 0x07, 0xe0, 0x19, 0x60, 0x5b, 0x40, 0x03, 0x40, 0x03, 0x06, 0x1c, 0xc7, 0x80, 0x80, 0x3d, 0x38, 0x20, 0x24, 0x43, 0x3b, 0x20,
+    0x27, 0x09, 0x00, 0x07, 0x3e, 0x38, 0x22, 0x24, 0x03, 0x03, 0xfd, 0x02, 0x06, 0x00, 0xc5, 0x80, 0x80, 0xbf, 0x21, 0xdf, 0x30, 0xc1, 0x22, 0xe1,
+    0x31, 0x09, 0x00, 0x07, 0xc0, 0x21, 0xe0, 0x30, 0x00, 0x01, 0x00, 0x01, 0x06, 0x14, 0xc7, 0x80, 0x80, 0xdf, 0x0c, 0x7f, 0x47, 0xe1, 0x0e, 0x81,
+    0x49, 0x09, 0x00, 0x07, 0xe0, 0x0c, 0x80, 0x47, 0x00, 0x02, 0x00, 0x02, 0x06, 0x2f, 0xc6, 0x80, 0x80, 0xdf, 0x0a, 0x9f, 0x2e, 0x61, 0x0c, 0x21,
+    0x30, 0x09, 0x00, 0x07, 0xe0, 0x0a, 0xa0, 0x2e, 0x80, 0x01, 0x80, 0x01, 0x06, 0x30, 0xc6, 0x80, 0x80, 0xff, 0x30, 0x5f, 0x4a, 0x81, 0x32, 0xe1,
+    0x4b, 0x09, 0x00, 0x07, 0x00, 0x31, 0x60, 0x4a, 0x80, 0x01, 0x80, 0x01, 0x06, 0x09, 0xc8, 0x80, 0x80, 0xff, 0x21, 0x5f, 0x02, 0xc1, 0x27, 0x21,
+    0x08, 0x09, 0x00, 0x07, 0x00, 0x22, 0x60, 0x02, 0xc0, 0x05, 0xc0, 0x05, 0x06, 0x30, 0xc8, 0x80, 0x80, 0x3f, 0x44, 0x3f, 0x10, 0xc1, 0x4a, 0xc1,
+    0x16, 0x09, 0x00, 0x07, 0x40, 0x44, 0x40, 0x10, 0x80, 0x06, 0x80, 0x06, 0x06, 0x0a, 0xc6, 0x80, 0x80, 0xbf, 0x34, 0x1f, 0x02, 0x41, 0x36, 0xa1,
+    0x03, 0x09, 0x00, 0x07, 0xc0, 0x34, 0x20, 0x02, 0x80, 0x01, 0x80, 0x01, 0x06, 0x1a, 0xc6, 0x80, 0x80, 0x7f, 0x24, 0xdf, 0x58, 0x01, 0x26, 0x61,
+    0x5a, 0x09, 0x00, 0x07, 0x80, 0x24, 0xe0, 0x58, 0x80, 0x01, 0x80, 0x01, 0x06, 0x10, 0xc2, 0x80, 0x80, 0xbf, 0x24, 0x1f, 0x35, 0x41, 0x25, 0xa1,
+    0x35, 0x09, 0x00, 0x07, 0xc0, 0x24, 0x20, 0x35, 0x80, 0x00, 0x80, 0x00, 0x06, 0x1a, 0xc8, 0x80, 0x80, 0x1f, 0x51, 0x7f, 0x53, 0xe1, 0x56, 0x41,
+    0x59, 0x09, 0x00, 0x07, 0x20, 0x51, 0x80, 0x53, 0xc0, 0x05, 0xc0, 0x05, 0x06, 0x06, 0xc7, 0x7f, 0x80, 0x1f, 0x39, 0x82, 0x01, 0x25, 0x3d, 0x81,
+    0x05, 0x09, 0x00, 0x07, 0x20, 0x39, 0x83, 0x01, 0x03, 0x04, 0xfd, 0x03, 0x06, 0x1b, 0xc7, 0x80, 0x80, 0x7d, 0x46, 0xc0, 0x3f, 0x83, 0x49, 0xc0,
+    0x42, 0x09, 0x00, 0x07, 0x7e, 0x46, 0xc2, 0x3f, 0x03, 0x03, 0xfd, 0x02, 0x06, 0x2f, 0xc6, 0x80, 0x80, 0x3f, 0x2a, 0xff, 0x49, 0xc1, 0x2b, 0x81,
+    0x4b, 0x09, 0x00, 0x07, 0x40, 0x2a, 0x00, 0x4a, 0x80, 0x01, 0x80, 0x01, 0x06, 0x30, 0xc8, 0x80, 0x80, 0x7f, 0x01, 0xbf, 0x08, 0x41, 0x07, 0x81,
+    0x0e, 0x09, 0x00, 0x07, 0x80, 0x01, 0xc0, 0x08, 0xc0, 0x05, 0xc0, 0x05, 0x06, 0x14, 0xc8, 0x80, 0x80, 0xff, 0x51, 0xff, 0x00, 0x01, 0x5a, 0x01,
+    0x09, 0x09, 0x00, 0x07, 0x00, 0x52, 0x00, 0x01, 0x00, 0x08, 0x00, 0x08, 0x06, 0x19, 0xc2, 0x80, 0x80, 0x3f, 0x58, 0xbf, 0x50, 0xc1, 0x58, 0x41,
+    0x51, 0x09, 0x00, 0x07, 0x40, 0x58, 0xc0, 0x50, 0x80, 0x00, 0x80, 0x00, 0x06, 0x01, 0xc6, 0x80, 0x80, 0x9d, 0x03, 0x60, 0x1f, 0xe3, 0x05, 0xa0,
+    0x21, 0x09, 0x00, 0x07, 0x9e, 0x03, 0x62, 0x1f, 0x43, 0x02, 0x3d, 0x02, 0x06, 0x17, 0xc8, 0x80, 0x7f, 0x3b, 0x09, 0x9f, 0xff, 0x41, 0x0f, 0x9e,
+    0x05, 0x09, 0x00, 0x07, 0x3d, 0x09, 0xa0, 0xff, 0x03, 0x06, 0xfd, 0x05, 0x06, 0x0d, 0xc7, 0x80, 0x80, 0x5f, 0x26, 0x3f, 0x5b, 0xa1, 0x29, 0x81,
+    0x5e, 0x09, 0x00, 0x07, 0x60, 0x26, 0x40, 0x5b, 0x40, 0x03, 0x40, 0x03, 0x06, 0x18, 0xc7, 0x80, 0x80, 0x1d, 0x40, 0xc0, 0x27, 0xa3, 0x43, 0x40,
+    0x2b, 0x09, 0x00, 0x07, 0x1e, 0x40, 0xc2, 0x27, 0x83, 0x03, 0x7d, 0x03, 0x06, 0x1b, 0xc8, 0x80, 0x80, 0x3f, 0x4b, 0x7f, 0x2f, 0xc1, 0x50, 0x01,
+    0x35, 0x09, 0x00, 0x07, 0x40, 0x4b, 0x80, 0x2f, 0x80, 0x05, 0x80, 0x05, 0x06, 0x26, 0xc8, 0x80, 0x80, 0x3f, 0x22, 0x1f, 0x15, 0x01, 0x27, 0xe1,
+    0x19, 0x09, 0x00, 0x07, 0x40, 0x22, 0x20, 0x15, 0xc0, 0x04, 0xc0, 0x04, 0x06, 0x0b, 0xc6, 0x80, 0x7f, 0xdf, 0x1b, 0x5f, 0x5e, 0x61, 0x1d, 0xe1,
+    0x5f, 0x09, 0x00, 0x07, 0xe0, 0x1b, 0x60, 0x5e, 0x80, 0x01, 0x80, 0x01, 0x06, 0x17, 0xc6, 0x80, 0x80, 0x3d, 0x18, 0xc0, 0x1c, 0x83, 0x1a, 0x00,
+    0x1f, 0x09, 0x00, 0x07, 0x3e, 0x18, 0xc2, 0x1c, 0x43, 0x02, 0x3d, 0x02, 0x06, 0x1a, 0xc6, 0x80, 0x80, 0xbf, 0x19, 0x7f, 0x28, 0x41, 0x1b, 0x01,
+    0x2a, 0x09, 0x00, 0x07, 0xc0, 0x19, 0x80, 0x28, 0x80, 0x01, 0x80, 0x01, 0x06, 0x14, 0xc6, 0x80, 0x80, 0x7d, 0x4a, 0x00, 0x2c, 0xc3, 0x4c, 0x40,
+    0x2e, 0x09, 0x00, 0x07, 0x7e, 0x4a, 0x02, 0x2c, 0x43, 0x02, 0x3d, 0x02, 0x06, 0x18, 0xc2, 0x80, 0x80, 0x1f, 0x26, 0x7f, 0x3a, 0xa1, 0x26, 0x01,
+    0x3b, 0x09, 0x00, 0x07, 0x20, 0x26, 0x80, 0x3a, 0x80, 0x00, 0x80, 0x00, 0x06, 0x06, 0xc7, 0x80, 0x80, 0x3f, 0x5b, 0x3f, 0x4a, 0xc1, 0x5d, 0xc1,
+    0x4c, 0x09, 0x00, 0x07, 0x40, 0x5b, 0x40, 0x4a, 0x80, 0x02, 0x80, 0x02, 0x06, 0x21, 0xc7, 0x80, 0x80, 0x5d, 0x59, 0x00, 0x12, 0xe3, 0x5c, 0x80,
+    0x15, 0x09, 0x00, 0x07, 0x5e, 0x59, 0x02, 0x12, 0x83, 0x03, 0x7d, 0x03, 0x06, 0x09, 0xc7, 0x80, 0x80, 0x9f, 0x36, 0x9f, 0x28, 0xa1, 0x38, 0xa1,
+    0x2a, 0x09, 0x00, 0x07, 0xa0, 0x36, 0xa0, 0x28, 0x00, 0x02, 0x00, 0x02, 0x01, 0x03, 0x1e, 0x21, 0x5e, 0x09, 0x04, 0xe0, 0x06, 0x06, 0x1c, 0xc5,
+    0x80, 0x80, 0x5d, 0xff, 0x60, 0xff, 0xa3, 0x00, 0xa0, 0x00, 0x09, 0x00, 0x07, 0x5e, 0xff, 0x62, 0xff, 0x43, 0x01, 0x3d, 0x01, 0x02, 0x06, 0x2c,
+    0xc6, 0x80, 0x7f, 0x5b, 0x57, 0xff, 0x21, 0x21, 0x59, 0xbe, 0x23, 0x09, 0x00, 0x07, 0x5d, 0x57, 0x00, 0x22, 0xc3, 0x01, 0xbd, 0x01, 0x06, 0x09,
+    0xc2, 0x80, 0x80, 0xdf, 0x14, 0xdf, 0x39, 0x61, 0x15, 0x61, 0x3a, 0x09, 0x00, 0x07, 0xe0, 0x14, 0xe0, 0x39, 0x80, 0x00, 0x80, 0x00, 0x01, 0x03,
+    0xbe, 0x0f, 0x1e, 0x41, 0x04, 0xe0, 0x06, 0x06, 0x19, 0xc5, 0x80, 0x80, 0x5d, 0xff, 0x60, 0xff, 0xa3, 0x00, 0xa0, 0x00, 0x09, 0x00, 0x07, 0x5e,
+    0xff, 0x62, 0xff, 0x43, 0x01, 0x3d, 0x01, 0x02, 0x06, 0x09, 0xc8, 0x80, 0x7f, 0x9b, 0x08, 0x7f, 0x04, 0xa1, 0x0f, 0x7e, 0x0b, 0x09, 0x00, 0x07,
+    0x9d, 0x08, 0x80, 0x04, 0x03, 0x07, 0xfd, 0x06, 0x06, 0x21, 0xc5, 0x80, 0x80, 0x1f, 0x16, 0x7f, 0x54, 0x21, 0x17, 0x81, 0x55, 0x09, 0x00, 0x07,
+    0x20, 0x16, 0x80, 0x54, 0x00, 0x01, 0x00, 0x01, 0x06, 0x04, 0xc7, 0x80, 0x80, 0xfd, 0x14, 0x00, 0x1e, 0x83, 0x18, 0x80, 0x21, 0x09, 0x00, 0x07,
+    0xfe, 0x14, 0x02, 0x1e, 0x83, 0x03, 0x7d, 0x03, 0x06, 0x06, 0xc5, 0x80, 0x80, 0xdf, 0x50, 0xdf, 0x4a, 0xe1, 0x51, 0xe1, 0x4b, 0x09, 0x00, 0x07,
+    0xe0, 0x50, 0xe0, 0x4a, 0x00, 0x01, 0x00, 0x01, 0x06, 0x30, 0xc2, 0x80, 0x80, 0x3f, 0x40, 0x9f, 0x1e, 0xc1, 0x40, 0x21, 0x1f, 0x09, 0x00, 0x07,
+    0x40, 0x40, 0xa0, 0x1e, 0x80, 0x00, 0x80, 0x00, 0x06, 0x2c, 0xc7, 0x7f, 0x80, 0xdf, 0x50, 0xa2, 0x40, 0x65, 0x55, 0x21, 0x45, 0x09, 0x00, 0x07,
+    0xe0, 0x50, 0xa3, 0x40, 0x83, 0x04, 0x7d, 0x04, 0x06, 0x06, 0xc8, 0x80, 0x80, 0x5f, 0x5a, 0xbf, 0x10, 0x21, 0x60, 0x81, 0x16, 0x09, 0x00, 0x07,
+    0x60, 0x5a, 0xc0, 0x10, 0xc0, 0x05, 0xc0, 0x05, 0x06, 0x18, 0xc8, 0x80, 0x80, 0xff, 0x1e, 0x1f, 0x13, 0xc1, 0x23, 0xe1, 0x17, 0x09, 0x00, 0x07,
+    0x00, 0x1f, 0x20, 0x13, 0xc0, 0x04, 0xc0, 0x04, 0x06, 0x20, 0xc6, 0x80, 0x80, 0xff, 0x31, 0xff, 0x3c, 0x81, 0x33, 0x81, 0x3e, 0x09, 0x00, 0x07,
+    0x00, 0x32, 0x00, 0x3d, 0x80, 0x01, 0x80, 0x01, 0x06, 0x2b, 0xc7, 0x80, 0x80, 0x1f, 0x19, 0xbf, 0x5e, 0xa1, 0x1b, 0x41, 0x61, 0x09, 0x00, 0x07,
+    0x20, 0x19, 0xc0, 0x5e, 0x80, 0x02, 0x80, 0x02, 0x06, 0x1b, 0xc8, 0x80, 0x80, 0x9d, 0x53, 0x80, 0x07, 0x23, 0x5b, 0x00, 0x0f, 0x09, 0x00, 0x07,
+    0x9e, 0x53, 0x82, 0x07, 0x83, 0x07, 0x7d, 0x07, 0x01, 0x03, 0x7e, 0x35, 0x9e, 0x49, 0x04, 0xe0, 0x06, 0x06, 0x1f, 0xc5, 0x80, 0x80, 0x5d, 0xff,
+    0x60, 0xff, 0xa3, 0x00, 0xa0, 0x00, 0x09, 0x00, 0x07, 0x5e, 0xff, 0x62, 0xff, 0x43, 0x01, 0x3d, 0x01, 0x02, 0x06, 0x26, 0xc8, 0x80, 0x80, 0x1f,
+    0x45, 0x7f, 0x03, 0xa1, 0x4b, 0x01, 0x0a, 0x09, 0x00, 0x07, 0x20, 0x45, 0x80, 0x03, 0x80, 0x06, 0x80, 0x06, 0x06, 0x29, 0xc6, 0x80, 0x7f, 0xdb,
+    0x5c, 0x9f, 0x39, 0xa1, 0x5e, 0x5e, 0x3b, 0x09, 0x00, 0x07, 0xdd, 0x5c, 0xa0, 0x39, 0xc3, 0x01, 0xbd, 0x01, 0x06, 0x1b, 0xc7, 0x80, 0x80, 0x3f,
+    0x19, 0x1f, 0x0f, 0xc1, 0x1b, 0xa1, 0x11, 0x09, 0x00, 0x07, 0x40, 0x19, 0x20, 0x0f, 0x80, 0x02, 0x80, 0x02, 0x06, 0x0b, 0xc5, 0x80, 0x80, 0xff,
+    0x17, 0x5f, 0x55, 0xc1, 0x18, 0x21, 0x56, 0x3a, 0x00, 0x01, 0xc0, 0x18, 0xc0, 0x55, 0x03, 0xc0, 0x18, 0xf6, 0x55, 0x96, 0x18, 0x20, 0x56, 0x60,
+    0x18, 0x20, 0x56, 0x03, 0x2a, 0x18, 0x20, 0x56, 0x00, 0x18, 0xf6, 0x55, 0x00, 0x18, 0xc0, 0x55, 0x03, 0x00, 0x18, 0x8a, 0x55, 0x2a, 0x18, 0x60,
+    0x55, 0x60, 0x18, 0x60, 0x55, 0x03, 0x96, 0x18, 0x60, 0x55, 0xc0, 0x18, 0x8a, 0x55, 0xc0, 0x18, 0xc0, 0x55, 0x04, 0x06, 0x15, 0xc7, 0x7f, 0x80,
+    0xff, 0x4f, 0xe2, 0x07, 0x05, 0x55, 0xe1, 0x0c, 0x09, 0x00, 0x07, 0x00, 0x50, 0xe3, 0x07, 0x03, 0x05, 0xfd, 0x04, 0x06, 0x16, 0xc7, 0x80, 0x80,
+    0x9d, 0x44, 0x20, 0x41, 0xa3, 0x47, 0x20, 0x44, 0x09, 0x00, 0x07, 0x9e, 0x44, 0x22, 0x41, 0x03, 0x03, 0xfd, 0x02, 0x06, 0x1f, 0xc2, 0x80, 0x80,
+    0xbf, 0x39, 0x7f, 0x53, 0x41, 0x3a, 0x01, 0x54, 0x09, 0x00, 0x07, 0xc0, 0x39, 0x80, 0x53, 0x80, 0x00, 0x80, 0x00, 0x06, 0x30, 0xc7, 0x7f, 0x80,
+    0xdf, 0x54, 0xa2, 0x5d, 0xe5, 0x58, 0xa1, 0x61, 0x09, 0x00, 0x07, 0xe0, 0x54, 0xa3, 0x5d, 0x03, 0x04, 0xfd, 0x03, 0x06, 0x18, 0xc7, 0x80, 0x80,
+    0x3f, 0x3b, 0xbf, 0x36, 0x81, 0x3e, 0x01, 0x3a, 0x09, 0x00, 0x07, 0x40, 0x3b, 0xc0, 0x36, 0x40, 0x03, 0x40, 0x03, 0x06, 0x2f, 0xc5, 0x7f, 0x7f,
+    0x9f, 0x12, 0xdf, 0x34, 0x61, 0x13, 0xa1, 0x35, 0x3a, 0x00, 0x01, 0x60, 0x13, 0x40, 0x35, 0x03, 0x60, 0x13, 0x76, 0x35, 0x36, 0x13, 0xa0, 0x35,
+    0x00, 0x13, 0xa0, 0x35, 0x03, 0xca, 0x12, 0xa0, 0x35, 0xa0, 0x12, 0x76, 0x35, 0xa0, 0x12, 0x40, 0x35, 0x03, 0xa0, 0x12, 0x0a, 0x35, 0xca, 0x12,
+    0xe0, 0x34, 0x00, 0x13, 0xe0, 0x34, 0x03, 0x36, 0x13, 0xe0, 0x34, 0x60, 0x13, 0x0a, 0x35, 0x60, 0x13, 0x40, 0x35, 0x04, 0x06, 0x0b, 0xc7, 0x80,
+    0x80, 0x7f, 0x33, 0x3f, 0x0a, 0x41, 0x36, 0x01, 0x0d, 0x09, 0x00, 0x07, 0x80, 0x33, 0x40, 0x0a, 0xc0, 0x02, 0xc0, 0x02, 0x06, 0x14, 0xc7, 0x80,
+    0x80, 0x1d, 0x00, 0x60, 0x2f, 0xa3, 0x03, 0xe0, 0x32, 0x09, 0x00, 0x07, 0x1e, 0x00, 0x62, 0x2f, 0x83, 0x03, 0x7d, 0x03, 0x06, 0x26, 0xc8, 0x80,
+    0x80, 0xe0, 0x59, 0x00, 0x24, 0x63, 0x60, 0x80, 0x2a, 0x09, 0x00, 0x07, 0xe2, 0x59, 0x02, 0x24, 0x80, 0x06, 0x7d, 0x06, 0x06, 0x2f, 0xc2, 0x80,
+    0x80, 0x1f, 0x05, 0x5f, 0x5f, 0xa1, 0x05, 0xe1, 0x5f, 0x09, 0x00, 0x07, 0x20, 0x05, 0x60, 0x5f, 0x80, 0x00, 0x80, 0x00, 0x06, 0x2b, 0xc7, 0x7f,
+    0x80, 0x9f, 0x2b, 0x5f, 0x19, 0x61, 0x2e, 0x21, 0x1c, 0x09, 0x00, 0x07, 0xa0, 0x2b, 0x60, 0x19, 0xc0, 0x02, 0xc0, 0x02, 0x06, 0x14, 0xc5, 0x7f,
+    0x7f, 0x9f, 0x25, 0x3f, 0x14, 0x61, 0x26, 0x01, 0x15, 0x3a, 0x00, 0x01, 0x60, 0x26, 0xa0, 0x14, 0x03, 0x60, 0x26, 0xd6, 0x14, 0x36, 0x26, 0x00,
+    0x15, 0x00, 0x26, 0x00, 0x15, 0x03, 0xca, 0x25, 0x00, 0x15, 0xa0, 0x25, 0xd6, 0x14, 0xa0, 0x25, 0xa0, 0x14, 0x03, 0xa0, 0x25, 0x6a, 0x14, 0xca,
+    0x25, 0x40, 0x14, 0x00, 0x26, 0x40, 0x14, 0x03, 0x36, 0x26, 0x40, 0x14, 0x60, 0x26, 0x6a, 0x14, 0x60, 0x26, 0xa0, 0x14, 0x04, 0x06, 0x19, 0xc6,
+    0x80, 0x80, 0x5f, 0x3c, 0xbf, 0x26, 0xe1, 0x3d, 0x41, 0x28, 0x09, 0x00, 0x07, 0x60, 0x3c, 0xc0, 0x26, 0x80, 0x01, 0x80, 0x01, 0x06, 0x1b, 0xc8,
+    0x80, 0x80, 0xbf, 0x45, 0xff, 0x28, 0x01, 0x4b, 0x41, 0x2e, 0x09, 0x00, 0x07, 0xc0, 0x45, 0x00, 0x29, 0x40, 0x05, 0x40, 0x05, 0x06, 0x1b, 0xc7,
+    0x80, 0x80, 0xdf, 0x24, 0xbf, 0x30, 0xe1, 0x26, 0xc1, 0x32, 0x09, 0x00, 0x07, 0xe0, 0x24, 0xc0, 0x30, 0x00, 0x02, 0x00, 0x02, 0x06, 0x1d, 0xc8,
+    0x80, 0x80, 0x5f, 0x56, 0xbf, 0x43, 0xa1, 0x5c, 0x01, 0x4a, 0x09, 0x00, 0x07, 0x60, 0x56, 0xc0, 0x43, 0x40, 0x06, 0x40, 0x06, 0x06, 0x31, 0xc5,
+    0x80, 0x80, 0x3f, 0x57, 0xbf, 0x53, 0x41, 0x58, 0xc1, 0x54, 0x09, 0x00, 0x07, 0x40, 0x57, 0xc0, 0x53, 0x00, 0x01, 0x00, 0x01, 0x06, 0x12, 0xc8,
+    0x80, 0x80, 0xff, 0x41, 0x7f, 0x14, 0x81, 0x47, 0x01, 0x1a, 0x09, 0x00, 0x07, 0x00, 0x42, 0x80, 0x14, 0x80, 0x05, 0x80, 0x05, 0x06, 0x05, 0xc6,
+    0x80, 0x80, 0xbd, 0x3a, 0x20, 0x2c, 0x03, 0x3d, 0x60, 0x2e, 0x09, 0x00, 0x07, 0xbe, 0x3a, 0x22, 0x2c, 0x43, 0x02, 0x3d, 0x02, 0x06, 0x1b, 0xc8,
+    0x80, 0x80, 0xdf, 0x5c, 0xbf, 0x14, 0x21, 0x62, 0x01, 0x1a, 0x09, 0x00, 0x07, 0xe0, 0x5c, 0xc0, 0x14, 0x40, 0x05, 0x40, 0x05, 0x06, 0x16, 0xc6,
+    0x80, 0x7f, 0x3b, 0x08, 0x3f, 0x5e, 0x01, 0x0a, 0xfe, 0x5f, 0x09, 0x00, 0x07, 0x3d, 0x08, 0x40, 0x5e, 0xc3, 0x01, 0xbd, 0x01, 0x06, 0x13, 0xc7,
+    0x80, 0x80, 0x1f, 0x5a, 0xbf, 0x14, 0x61, 0x5d, 0x01, 0x18, 0x09, 0x00, 0x07, 0x20, 0x5a, 0xc0, 0x14, 0x40, 0x03, 0x40, 0x03, 0x06, 0x1f, 0xc8,
+    0x80, 0x80, 0x5f, 0x04, 0xbf, 0x0e, 0xa1, 0x09, 0x01, 0x14, 0x09, 0x00, 0x07, 0x60, 0x04, 0xc0, 0x0e, 0x40, 0x05, 0x40, 0x05, 0x06, 0x02, 0xc2,
+    0x80, 0x80, 0xbf, 0x25, 0x9f, 0x29, 0x41, 0x26, 0x21, 0x2a, 0x09, 0x00, 0x07, 0xc0, 0x25, 0xa0, 0x29, 0x80, 0x00, 0x80, 0x00, 0x06, 0x10, 0xc8,
+    0x80, 0x80, 0xff, 0x4d, 0x9f, 0x4e, 0x01, 0x54, 0xa1, 0x54, 0x09, 0x00, 0x07, 0x00, 0x4e, 0xa0, 0x4e, 0x00, 0x06, 0x00, 0x06, 0x06, 0x18, 0xc2,
+    0x80, 0x80, 0x9f, 0x23, 0xbf, 0x39, 0x21, 0x24, 0x41, 0x3a, 0x09, 0x00, 0x07, 0xa0, 0x23, 0xc0, 0x39, 0x80, 0x00, 0x80, 0x00, 0x06, 0x2d, 0xc5,
+    0x7f, 0x7f, 0xdf, 0x20, 0xff, 0x0b, 0xa1, 0x21, 0xc1, 0x0c, 0x3a, 0x00, 0x01, 0xa0, 0x21, 0x60, 0x0c, 0x03, 0xa0, 0x21, 0x96, 0x0c, 0x76, 0x21,
+    0xc0, 0x0c, 0x40, 0x21, 0xc0, 0x0c, 0x03, 0x0a, 0x21, 0xc0, 0x0c, 0xe0, 0x20, 0x96, 0x0c, 0xe0, 0x20, 0x60, 0x0c, 0x03, 0xe0, 0x20, 0x2a, 0x0c,
+    0x0a, 0x21, 0x00, 0x0c, 0x40, 0x21, 0x00, 0x0c, 0x03, 0x76, 0x21, 0x00, 0x0c, 0xa0, 0x21, 0x2a, 0x0c, 0xa0, 0x21, 0x60, 0x0c, 0x04, 0x06, 0x11,
+    0xc8, 0x80, 0x80, 0x3f, 0x51, 0xff, 0x2f, 0xc1, 0x56, 0x81, 0x35, 0x09, 0x00, 0x07, 0x40, 0x51, 0x00, 0x30, 0x80, 0x05, 0x80, 0x05, 0x06, 0x2c,
+    0xc6, 0x80, 0x80, 0x1f, 0x12, 0xff, 0x46, 0xa1, 0x13, 0x81, 0x48, 0x09, 0x00, 0x07, 0x20, 0x12, 0x00, 0x47, 0x80, 0x01, 0x80, 0x01, 0x01, 0x03,
+    0x1e, 0x2d, 0x7e, 0x3c, 0x04, 0xe0, 0x06, 0x06, 0x31, 0xc5, 0x80, 0x80, 0x5d, 0xff, 0x60, 0xff, 0xa3, 0x00, 0xa0, 0x00, 0x09, 0x00, 0x07, 0x5e,
+    0xff, 0x62, 0xff, 0x43, 0x01, 0x3d, 0x01, 0x02, 0x06, 0x17, 0xc6, 0x80, 0x80, 0x1d, 0x51, 0x20, 0x3e, 0x63, 0x53, 0x60, 0x40, 0x09, 0x00, 0x07,
+    0x1e, 0x51, 0x22, 0x3e, 0x43, 0x02, 0x3d, 0x02, 0x06, 0x2c, 0xc8, 0x80, 0x80, 0xbf, 0x30, 0x9f, 0x05, 0x81, 0x37, 0x61, 0x0c, 0x09, 0x00, 0x07,
+    0xc0, 0x30, 0xa0, 0x05, 0xc0, 0x06, 0xc0, 0x06, 0x06, 0x23, 0xc6, 0x80, 0x7f, 0x9b, 0x4d, 0x7f, 0x3d, 0x61, 0x4f, 0x3e, 0x3f, 0x09, 0x00, 0x07,
+    0x9d, 0x4d, 0x80, 0x3d, 0xc3, 0x01, 0xbd, 0x01, 0x06, 0x26, 0xc6, 0x80, 0x7f, 0xdb, 0x4e, 0x5f, 0x0a, 0xa1, 0x50, 0x1e, 0x0c, 0x09, 0x00, 0x07,
+    0xdd, 0x4e, 0x60, 0x0a, 0xc3, 0x01, 0xbd, 0x01, 0x06, 0x0b, 0xc6, 0x80, 0x80, 0xdd, 0x09, 0x20, 0x44, 0x23, 0x0c, 0x60, 0x46, 0x09, 0x00, 0x07,
+    0xde, 0x09, 0x22, 0x44, 0x43, 0x02, 0x3d, 0x02, 0x06, 0x06, 0xc8, 0x80, 0x80, 0x7f, 0x3c, 0x1f, 0xfe, 0xc1, 0x44, 0x61, 0x06, 0x09, 0x00, 0x07,
+    0x80, 0x3c, 0x20, 0xfe, 0x40, 0x08, 0x40, 0x08, 0x06, 0x1b, 0xc7, 0x80, 0x80, 0xdf, 0x1e, 0x9f, 0x22, 0x61, 0x21, 0x21, 0x25, 0x09, 0x00, 0x07,
+    0xe0, 0x1e, 0xa0, 0x22, 0x80, 0x02, 0x80, 0x02, 0x06, 0x08, 0xc7, 0x7f, 0x80, 0x7f, 0x3d, 0xa2, 0x5b, 0x05, 0x42, 0x21, 0x60, 0x09, 0x00, 0x07,
+    0x80, 0x3d, 0xa3, 0x5b, 0x83, 0x04, 0x7d, 0x04, 0x06, 0x1d, 0xc6, 0x80, 0x80, 0xbf, 0x1e, 0x9f, 0x30, 0x41, 0x20, 0x21, 0x32, 0x09, 0x00, 0x07,
+    0xc0, 0x1e, 0xa0, 0x30, 0x80, 0x01, 0x80, 0x01, 0x06, 0x28, 0xc5, 0x7f, 0x80, 0x5f, 0x1d, 0x7f, 0x25, 0x61, 0x1e, 0x81, 0x26, 0x09, 0x00, 0x07,
+    0x60, 0x1d, 0x80, 0x25, 0x00, 0x01, 0x00, 0x01, 0x06, 0x1b, 0xc6, 0x80, 0x7f, 0x5b, 0x04, 0xbf, 0x44, 0x21, 0x06, 0x7e, 0x46, 0x09, 0x00, 0x07,
+    0x5d, 0x04, 0xc0, 0x44, 0xc3, 0x01, 0xbd, 0x01, 0x06, 0x19, 0xc8, 0x80, 0x80, 0x3f, 0x04, 0xbf, 0x06, 0xc1, 0x09, 0x41, 0x0c, 0x09, 0x00, 0x07,
+    0x40, 0x04, 0xc0, 0x06, 0x80, 0x05, 0x80, 0x05, 0x06, 0x0a, 0xc6, 0x80, 0x7f, 0xbb, 0x33, 0xff, 0x1b, 0x81, 0x35, 0xbe, 0x1d, 0x09, 0x00, 0x07,
+    0xbd, 0x33, 0x00, 0x1c, 0xc3, 0x01, 0xbd, 0x01, 0x06, 0x1b, 0xc6, 0x80, 0x80, 0xff, 0x2b, 0xdf, 0x51, 0x81, 0x2d, 0x61, 0x53, 0x09, 0x00, 0x07,
+    0x00, 0x2c, 0xe0, 0x51, 0x80, 0x01, 0x80, 0x01, 0x06, 0x1b, 0xc6, 0x80, 0x80, 0xfd, 0x36, 0xa0, 0x11, 0x43, 0x39, 0xe0, 0x13, 0x09, 0x00, 0x07,
+    0xfe, 0x36, 0xa2, 0x11, 0x43, 0x02, 0x3d, 0x02, 0x06, 0x0b, 0xc7, 0x80, 0x80, 0xff, 0x08, 0xbf, 0x00, 0x01, 0x0b, 0xc1, 0x02, 0x09, 0x00, 0x07,
+    0x00, 0x09, 0xc0, 0x00, 0x00, 0x02, 0x00, 0x02, 0x06, 0x21, 0xc6, 0x80, 0x80, 0x9d, 0x32, 0x80, 0x40, 0xe3, 0x34, 0xc0, 0x42, 0x09, 0x00, 0x07,
+    0x9e, 0x32, 0x82, 0x40, 0x43, 0x02, 0x3d, 0x02, 0x06, 0x28, 0xc5, 0x80, 0x80, 0x5f, 0x02, 0x9f, 0x1e, 0x61, 0x03, 0xa1, 0x1f, 0x09, 0x00, 0x07,
+    0x60, 0x02, 0xa0, 0x1e, 0x00, 0x01, 0x00, 0x01, 0x01, 0x03, 0xde, 0x29, 0x9e, 0x5a, 0x04, 0xe0, 0x06, 0x06, 0x1b, 0xc5, 0x80, 0x80, 0x5d, 0xff,
+    0x60, 0xff, 0xa3, 0x00, 0xa0, 0x00, 0x09, 0x00, 0x07, 0x5e, 0xff, 0x62, 0xff, 0x43, 0x01, 0x3d, 0x01, 0x02, 0x06, 0x2b, 0xc2, 0x80, 0x80, 0xff,
+    0x18, 0x1f, 0x1a, 0x81, 0x19, 0xa1, 0x1a, 0x09, 0x00, 0x07, 0x00, 0x19, 0x20, 0x1a, 0x80, 0x00, 0x80, 0x00, 0x06, 0x1b, 0xc6, 0x80, 0x80, 0x1f,
+    0x35, 0xdf, 0x27, 0xa1, 0x36, 0x61, 0x29, 0x09, 0x00, 0x07, 0x20, 0x35, 0xe0, 0x27, 0x80, 0x01, 0x80, 0x01, 0x06, 0x1c, 0xc7, 0x7f, 0x80, 0xbf,
+    0x06, 0xe2, 0x59, 0xc5, 0x0a, 0xe1, 0x5d, 0x09, 0x00, 0x07, 0xc0, 0x06, 0xe3, 0x59, 0x03, 0x04, 0xfd, 0x03, 0x06, 0x15, 0xc7, 0x80, 0x80, 0xfd,
+    0x0d, 0x40, 0x26, 0x83, 0x11, 0xc0, 0x29, 0x09, 0x00, 0x07, 0xfe, 0x0d, 0x42, 0x26, 0x83, 0x03, 0x7d, 0x03, 0x06, 0x19, 0xc8, 0x80, 0x80, 0xff,
+    0x4e, 0xdf, 0x37, 0x41, 0x53, 0x21, 0x3c, 0x09, 0x00, 0x07, 0x00, 0x4f, 0xe0, 0x37, 0x40, 0x04, 0x40, 0x04, 0x06, 0x26, 0xc7, 0x80, 0x80, 0x7f,
+    0x56, 0xbf, 0x54, 0x41, 0x5a, 0x81, 0x58, 0x09, 0x00, 0x07, 0x80, 0x56, 0xc0, 0x54, 0xc0, 0x03, 0xc0, 0x03, 0x06, 0x30, 0xc8, 0x80, 0x80, 0xff,
+    0x3d, 0x1f, 0xfc, 0x41, 0x46, 0x61, 0x04, 0x09, 0x00, 0x07, 0x00, 0x3e, 0x20, 0xfc, 0x40, 0x08, 0x40, 0x08, 0x06, 0x1b, 0xc7, 0x80, 0x80, 0x9d,
+    0x4b, 0xa0, 0x1f, 0xa3, 0x4e, 0xa0, 0x22, 0x09, 0x00, 0x07, 0x9e, 0x4b, 0xa2, 0x1f, 0x03, 0x03, 0xfd, 0x02, 0x06, 0x06, 0xc7, 0x7f, 0x80, 0xdf,
+    0x47, 0xc2, 0x42, 0xe5, 0x4b, 0xc1, 0x46, 0x09, 0x00, 0x07, 0xe0, 0x47, 0xc3, 0x42, 0x03, 0x04, 0xfd, 0x03, 0x06, 0x0e, 0xc6, 0x80, 0x7f, 0x7b,
+    0x2f, 0x1f, 0x24, 0x41, 0x31, 0xde, 0x25, 0x09, 0x00, 0x07, 0x7d, 0x2f, 0x20, 0x24, 0xc3, 0x01, 0xbd, 0x01, 0x06, 0x18, 0xc7, 0x80, 0x80, 0x9d,
+    0x56, 0x00, 0x10, 0x23, 0x5a, 0x80, 0x13, 0x09, 0x00, 0x07, 0x9e, 0x56, 0x02, 0x10, 0x83, 0x03, 0x7d, 0x03, 0x06, 0x0b, 0xc8, 0x80, 0x80, 0xdf,
+    0x4a, 0x1f, 0x26, 0xa1, 0x50, 0xe1, 0x2b, 0x09, 0x00, 0x07, 0xe0, 0x4a, 0x20, 0x26, 0xc0, 0x05, 0xc0, 0x05, 0x06, 0x0d, 0xc5, 0x80, 0x80, 0x3f,
+    0x49, 0x1f, 0x53, 0x01, 0x4a, 0xe1, 0x53, 0x3a, 0x00, 0x01, 0x00, 0x4a, 0x80, 0x53, 0x03, 0x00, 0x4a, 0xb6, 0x53, 0xd6, 0x49, 0xe0, 0x53, 0xa0,
+    0x49, 0xe0, 0x53, 0x03, 0x6a, 0x49, 0xe0, 0x53, 0x40, 0x49, 0xb6, 0x53, 0x40, 0x49, 0x80, 0x53, 0x03, 0x40, 0x49, 0x4a, 0x53, 0x6a, 0x49, 0x20,
+    0x53, 0xa0, 0x49, 0x20, 0x53, 0x03, 0xd6, 0x49, 0x20, 0x53, 0x00, 0x4a, 0x4a, 0x53, 0x00, 0x4a, 0x80, 0x53, 0x04, 0x06, 0x0f, 0xc7, 0x80, 0x80,
+    0x5f, 0x07, 0x5f, 0x13, 0x21, 0x0a, 0x21, 0x16, 0x09, 0x00, 0x07, 0x60, 0x07, 0x60, 0x13, 0xc0, 0x02, 0xc0, 0x02, 0x06, 0x0e, 0xc8, 0x80, 0x80,
+    0x9f, 0x5c, 0x7f, 0x1e, 0xe1, 0x61, 0xc1, 0x23, 0x09, 0x00, 0x07, 0xa0, 0x5c, 0x80, 0x1e, 0x40, 0x05, 0x40, 0x05, 0x06, 0x1c, 0xc5, 0x7f, 0x7f,
+    0xff, 0x23, 0xbf, 0x44, 0xc1, 0x24, 0x81, 0x45, 0x3a, 0x00, 0x01, 0xc0, 0x24, 0x20, 0x45, 0x03, 0xc0, 0x24, 0x56, 0x45, 0x96, 0x24, 0x80, 0x45,
+    0x60, 0x24, 0x80, 0x45, 0x03, 0x2a, 0x24, 0x80, 0x45, 0x00, 0x24, 0x56, 0x45, 0x00, 0x24, 0x20, 0x45, 0x03, 0x00, 0x24, 0xea, 0x44, 0x2a, 0x24,
+    0xc0, 0x44, 0x60, 0x24, 0xc0, 0x44, 0x03, 0x96, 0x24, 0xc0, 0x44, 0xc0, 0x24, 0xea, 0x44, 0xc0, 0x24, 0x20, 0x45, 0x04, 0x06, 0x20, 0xc7, 0x7f,
+    0x80, 0x9f, 0x4e, 0x62, 0x44, 0xa5, 0x52, 0x61, 0x48, 0x09, 0x00, 0x07, 0xa0, 0x4e, 0x63, 0x44, 0x03, 0x04, 0xfd, 0x03, 0x06, 0x1e, 0xc8, 0x80,
+    0x80, 0x1f, 0x51, 0x9f, 0x5d, 0xe1, 0x55, 0x61, 0x62, 0x09, 0x00, 0x07, 0x20, 0x51, 0xa0, 0x5d, 0xc0, 0x04, 0xc0, 0x04, 0x06, 0x2b, 0xc5, 0x7f,
+    0x7f, 0x5f, 0x3e, 0x5f, 0x2e, 0x21, 0x3f, 0x21, 0x2f, 0x3a, 0x00, 0x01, 0x20, 0x3f, 0xc0, 0x2e, 0x03, 0x20, 0x3f, 0xf6, 0x2e, 0xf6, 0x3e, 0x20,
+    0x2f, 0xc0, 0x3e, 0x20, 0x2f, 0x03, 0x8a, 0x3e, 0x20, 0x2f, 0x60, 0x3e, 0xf6, 0x2e, 0x60, 0x3e, 0xc0, 0x2e, 0x03, 0x60, 0x3e, 0x8a, 0x2e, 0x8a,
+    0x3e, 0x60, 0x2e, 0xc0, 0x3e, 0x60, 0x2e, 0x03, 0xf6, 0x3e, 0x60, 0x2e, 0x20, 0x3f, 0x8a, 0x2e, 0x20, 0x3f, 0xc0, 0x2e, 0x04, 0x06, 0x08, 0xc7,
+    0x7f, 0x80, 0xdf, 0x3f, 0x82, 0x51, 0x65, 0x44, 0x01, 0x56, 0x09, 0x00, 0x07, 0xe0, 0x3f, 0x83, 0x51, 0x83, 0x04, 0x7d, 0x04, 0x06, 0x10, 0xc5,
+    0x80, 0x80, 0x7f, 0x04, 0xdf, 0x39, 0x81, 0x05, 0xe1, 0x3a, 0x09, 0x00, 0x07, 0x80, 0x04, 0xe0, 0x39, 0x00, 0x01, 0x00, 0x01, 0x06, 0x0d, 0xc7,
+    0x80, 0x80, 0xdd, 0x32, 0xe0, 0xfe, 0xe3, 0x35, 0xe0, 0x01, 0x09, 0x00, 0x07, 0xde, 0x32, 0xe2, 0xfe, 0x03, 0x03, 0xfd, 0x02, 0x06, 0x1b, 0xc7,
+    0x80, 0x80, 0xbf, 0x59, 0x5f, 0x50, 0x01, 0x5d, 0xa1, 0x53, 0x09, 0x00, 0x07, 0xc0, 0x59, 0x60, 0x50, 0x40, 0x03, 0x40, 0x03, 0x06, 0x28, 0xc8,
+    0x80, 0x80, 0x3f, 0x34, 0xdf, 0x04, 0x01, 0x39, 0xa1, 0x09, 0x09, 0x00, 0x07, 0x40, 0x34, 0xe0, 0x04, 0xc0, 0x04, 0xc0, 0x04, 0x06, 0x1c, 0xc6,
+    0x7f, 0x80, 0x7f, 0x0a, 0x1f, 0x50, 0x01, 0x0c, 0xa1, 0x51, 0x09, 0x00, 0x07, 0x80, 0x0a, 0x20, 0x50, 0x80, 0x01, 0x80, 0x01, 0x06, 0x1b, 0xc2,
+    0x80, 0x80, 0x3f, 0x1d, 0xbf, 0x50, 0xc1, 0x1d, 0x41, 0x51, 0x09, 0x00, 0x07, 0x40, 0x1d, 0xc0, 0x50, 0x80, 0x00, 0x80, 0x00, 0x06, 0x11, 0xc7,
+    0x80, 0x80, 0xbf, 0x09, 0x7f, 0x46, 0x81, 0x0c, 0x41, 0x49, 0x09, 0x00, 0x07, 0xc0, 0x09, 0x80, 0x46, 0xc0, 0x02, 0xc0, 0x02, 0x06, 0x0b, 0xc7,
+    0x80, 0x80, 0xff, 0x1a, 0x3f, 0x12, 0x81, 0x1d, 0xc1, 0x14, 0x09, 0x00, 0x07, 0x00, 0x1b, 0x40, 0x12, 0x80, 0x02, 0x80, 0x02, 0x06, 0x15, 0xc2,
+    0x80, 0x80, 0xdf, 0x27, 0xff, 0x44, 0x61, 0x28, 0x81, 0x45, 0x09, 0x00, 0x07, 0xe0, 0x27, 0x00, 0x45, 0x80, 0x00, 0x80, 0x00, 0x06, 0x14, 0xc7,
+    0x80, 0x80, 0x1f, 0x26, 0x7f, 0x09, 0xa1, 0x28, 0x01, 0x0c, 0x09, 0x00, 0x07, 0x20, 0x26, 0x80, 0x09, 0x80, 0x02, 0x80, 0x02, 0x06, 0x1b, 0xc8,
+    0x80, 0x80, 0x7f, 0x58, 0x3f, 0x28, 0x81, 0x5e, 0x41, 0x2e, 0x09, 0x00, 0x07, 0x80, 0x58, 0x40, 0x28, 0x00, 0x06, 0x00, 0x06, 0x06, 0x15, 0xc7,
+    0x7f, 0x80, 0x9f, 0x49, 0x62, 0x01, 0x25, 0x4e, 0xe1, 0x05, 0x09, 0x00, 0x07, 0xa0, 0x49, 0x63, 0x01, 0x83, 0x04, 0x7d, 0x04, 0x06, 0x1b, 0xc7,
+    0x7f, 0x80, 0x7f, 0x2b, 0xe2, 0x0e, 0x05, 0x30, 0x61, 0x13, 0x09, 0x00, 0x07, 0x80, 0x2b, 0xe3, 0x0e, 0x83, 0x04, 0x7d, 0x04, 0x06, 0x1b, 0xc6,
+    0x80, 0x7f, 0x1b, 0x18, 0x1f, 0x31, 0xe1, 0x19, 0xde, 0x32, 0x09, 0x00, 0x07, 0x1d, 0x18, 0x20, 0x31, 0xc3, 0x01, 0xbd, 0x01, 0x06, 0x1b, 0xc7,
+    0x80, 0x80, 0xdf, 0x29, 0x9f, 0x2c, 0x61, 0x2c, 0x21, 0x2f, 0x09, 0x00, 0x07, 0xe0, 0x29, 0xa0, 0x2c, 0x80, 0x02, 0x80, 0x02, 0x01, 0x03, 0xde,
+    0x45, 0x7e, 0x34, 0x04, 0xe0, 0x06, 0x06, 0x19, 0xc5, 0x80, 0x80, 0x5d, 0xff, 0x60, 0xff, 0xa3, 0x00, 0xa0, 0x00, 0x09, 0x00, 0x07, 0x5e, 0xff,
+    0x62, 0xff, 0x43, 0x01, 0x3d, 0x01, 0x02, 0x06, 0x1d, 0xc8, 0x80, 0x80, 0x1f, 0x48, 0x5f, 0x16, 0x21, 0x4e, 0x61, 0x1c, 0x09, 0x00, 0x07, 0x20,
+    0x48, 0x60, 0x16, 0x00, 0x06, 0x00, 0x06, 0x06, 0x24, 0xc6, 0x80, 0x80, 0xbd, 0x0b, 0x20, 0x49, 0x03, 0x0e, 0x60, 0x4b, 0x09, 0x00, 0x07, 0xbe,
+    0x0b, 0x22, 0x49, 0x43, 0x02, 0x3d, 0x02, 0x06, 0x1b, 0xc7, 0x80, 0x80, 0x7f, 0x1a, 0x1f, 0x04, 0x01, 0x1d, 0xa1, 0x06, 0x09, 0x00, 0x07, 0x80,
+    0x1a, 0x20, 0x04, 0x80, 0x02, 0x80, 0x02, 0x06, 0x15, 0xc5, 0x7f, 0x7f, 0x7f, 0x31, 0xbf, 0x42, 0x41, 0x32, 0x81, 0x43, 0x3a, 0x00, 0x01, 0x40,
+    0x32, 0x20, 0x43, 0x03, 0x40, 0x32, 0x56, 0x43, 0x16, 0x32, 0x80, 0x43, 0xe0, 0x31, 0x80, 0x43, 0x03, 0xaa, 0x31, 0x80, 0x43, 0x80, 0x31, 0x56,
+    0x43, 0x80, 0x31, 0x20, 0x43, 0x03, 0x80, 0x31, 0xea, 0x42, 0xaa, 0x31, 0xc0, 0x42, 0xe0, 0x31, 0xc0, 0x42, 0x03, 0x16, 0x32, 0xc0, 0x42, 0x40,
+    0x32, 0xea, 0x42, 0x40, 0x32, 0x20, 0x43, 0x04, 0x06, 0x2c, 0xc5, 0x80, 0x80, 0x1f, 0x20, 0x7f, 0x49, 0x21, 0x21, 0x81, 0x4a, 0x09, 0x00, 0x07,
+    0x20, 0x20, 0x80, 0x49, 0x00, 0x01, 0x00, 0x01, 0x06, 0x1d, 0xc5, 0x80, 0x80, 0x3f, 0x54, 0x5f, 0x24, 0x41, 0x55, 0x61, 0x25, 0x09, 0x00, 0x07,
+    0x40, 0x54, 0x60, 0x24, 0x00, 0x01, 0x00, 0x01, 0x06, 0x24, 0xc8, 0x7f, 0x80, 0x7f, 0x1a, 0xbf, 0x0b, 0x81, 0x1f, 0xc1, 0x10, 0x09, 0x00, 0x07,
+    0x80, 0x1a, 0xc0, 0x0b, 0x00, 0x05, 0x00, 0x05, 0x06, 0x26, 0xc5, 0x80, 0x80, 0x5f, 0x31, 0xff, 0x3f, 0x61, 0x32, 0x01, 0x41, 0x09, 0x00, 0x07,
+    0x60, 0x31, 0x00, 0x40, 0x00, 0x01, 0x00, 0x01, 0x06, 0x20, 0xc6, 0x80, 0x7f, 0x1b, 0x3c, 0x5f, 0x4f, 0xe1, 0x3d, 0x1e, 0x51, 0x09, 0x00, 0x07,
+    0x1d, 0x3c, 0x60, 0x4f, 0xc3, 0x01, 0xbd, 0x01, 0x01, 0x03, 0x5e, 0x05, 0x9e, 0x51, 0x04, 0xe0, 0x06, 0x06, 0x30, 0xc5, 0x80, 0x80, 0x5d, 0xff,
+    0x60, 0xff, 0xa3, 0x00, 0xa0, 0x00, 0x09, 0x00, 0x07, 0x5e, 0xff, 0x62, 0xff, 0x43, 0x01, 0x3d, 0x01, 0x02, 0x06, 0x14, 0xc6, 0x80, 0x80, 0x3d,
+    0x38, 0x80, 0x43, 0x83, 0x3a, 0xc0, 0x45, 0x09, 0x00, 0x07, 0x3e, 0x38, 0x82, 0x43, 0x43, 0x02, 0x3d, 0x02, 0x06, 0x05, 0xc6, 0x80, 0x7f, 0xbb,
+    0x09, 0x5f, 0x10, 0x81, 0x0b, 0x1e, 0x12, 0x09, 0x00, 0x07, 0xbd, 0x09, 0x60, 0x10, 0xc3, 0x01, 0xbd, 0x01, 0x01, 0x03, 0x7e, 0x07, 0x7e, 0x29,
+    0x04, 0xe0, 0x06, 0x06, 0x1b, 0xc5, 0x80, 0x80, 0x5d, 0xff, 0x60, 0xff, 0xa3, 0x00, 0xa0, 0x00, 0x09, 0x00, 0x07, 0x5e, 0xff, 0x62, 0xff, 0x43,
+    0x01, 0x3d, 0x01, 0x02, 0x06, 0x1b, 0xc5, 0x80, 0x80, 0xff, 0x1e, 0x1f, 0x39, 0xc1, 0x1f, 0xe1, 0x39, 0x3a, 0x00, 0x01, 0xc0, 0x1f, 0x80, 0x39,
+    0x03, 0xc0, 0x1f, 0xb6, 0x39, 0x96, 0x1f, 0xe0, 0x39, 0x60, 0x1f, 0xe0, 0x39, 0x03, 0x2a, 0x1f, 0xe0, 0x39, 0x00, 0x1f, 0xb6, 0x39, 0x00, 0x1f,
+    0x80, 0x39, 0x03, 0x00, 0x1f, 0x4a, 0x39, 0x2a, 0x1f, 0x20, 0x39, 0x60, 0x1f, 0x20, 0x39, 0x03, 0x96, 0x1f, 0x20, 0x39, 0xc0, 0x1f, 0x4a, 0x39,
+    0xc0, 0x1f, 0x80, 0x39, 0x04, 0x06, 0x30, 0xc8, 0x80, 0x7f, 0xdb, 0x02, 0xbf, 0x09, 0x61, 0x09, 0x3e, 0x10, 0x09, 0x00, 0x07, 0xdd, 0x02, 0xc0,
+    0x09, 0x83, 0x06, 0x7d, 0x06, 0x06, 0x15, 0xc7, 0x80, 0x80, 0xff, 0x1c, 0x7f, 0x5d, 0xc1, 0x20, 0x41, 0x61, 0x09, 0x00, 0x07, 0x00, 0x1d, 0x80,
+    0x5d, 0xc0, 0x03, 0xc0, 0x03, 0x06, 0x1c, 0xc6, 0x80, 0x7f, 0xbb, 0xff, 0xff, 0x54, 0x81, 0x01, 0xbe, 0x56, 0x09, 0x00, 0x07, 0xbd, 0xff, 0x00,
+    0x55, 0xc3, 0x01, 0xbd, 0x01, 0x06, 0x17, 0xc6, 0x80, 0x7f, 0xff, 0x2f, 0xdf, 0x04, 0x81, 0x31, 0x61, 0x06, 0x09, 0x00, 0x07, 0x00, 0x30, 0xe0,
+    0x04, 0x80, 0x01, 0x80, 0x01, 0x06, 0x04, 0xc7, 0x80, 0x80, 0xdf, 0x0c, 0xdf, 0x0d, 0x61, 0x0f, 0x61, 0x10, 0x09, 0x00, 0x07, 0xe0, 0x0c, 0xe0,
+    0x0d, 0x80, 0x02, 0x80, 0x02, 0x06, 0x2f, 0xc7, 0x7f, 0x80, 0x3d, 0x3e, 0xa0, 0x4c, 0x43, 0x41, 0xa0, 0x4f, 0x09, 0x00, 0x07, 0x3e, 0x3e, 0xa2,
+    0x4c, 0x03, 0x03, 0xfd, 0x02, 0x06, 0x1b, 0xc5, 0x80, 0x80, 0x3f, 0x00, 0x7f, 0x23, 0x01, 0x01, 0x41, 0x24, 0x3a, 0x00, 0x01, 0x00, 0x01, 0xe0,
+    0x23, 0x03, 0x00, 0x01, 0x16, 0x24, 0xd6, 0x00, 0x40, 0x24, 0xa0, 0x00, 0x40, 0x24, 0x03, 0x6a, 0x00, 0x40, 0x24, 0x40, 0x00, 0x16, 0x24, 0x40,
+    0x00, 0xe0, 0x23, 0x03, 0x40, 0x00, 0xaa, 0x23, 0x6a, 0x00, 0x80, 0x23, 0xa0, 0x00, 0x80, 0x23, 0x03, 0xd6, 0x00, 0x80, 0x23, 0x00, 0x01, 0xaa,
+    0x23, 0x00, 0x01, 0xe0, 0x23, 0x04, 0x06, 0x1b, 0xc2, 0x80, 0x80, 0x9f, 0x1e, 0x9f, 0x3b, 0x21, 0x1f, 0x21, 0x3c, 0x09, 0x00, 0x07, 0xa0, 0x1e,
+    0xa0, 0x3b, 0x80, 0x00, 0x80, 0x00, 0x06, 0x15, 0xc6, 0x80, 0x80, 0x5f, 0x19, 0x3f, 0x08, 0xe1, 0x1a, 0xc1, 0x09, 0x09, 0x00, 0x07, 0x60, 0x19,
+    0x40, 0x08, 0x80, 0x01, 0x80, 0x01, 0x06, 0x1a, 0xc7, 0x7f, 0x80, 0x3f, 0x5d, 0x02, 0x46, 0x45, 0x62, 0x01, 0x4b, 0x09, 0x00, 0x07, 0x40, 0x5d,
+    0x03, 0x46, 0x03, 0x05, 0xfd, 0x04, 0x06, 0x2f, 0xc7, 0x7f, 0x80, 0x3f, 0x5a, 0x22, 0x3f, 0xc5, 0x5e, 0xa1, 0x43, 0x09, 0x00, 0x07, 0x40, 0x5a,
+    0x23, 0x3f, 0x83, 0x04, 0x7d, 0x04, 0x01, 0x03, 0x1e, 0x0e, 0x9e, 0x2d, 0x04, 0xe0, 0x06, 0x06, 0x26, 0xc5, 0x80, 0x80, 0x5d, 0xff, 0x60, 0xff,
+    0xa3, 0x00, 0xa0, 0x00, 0x09, 0x00, 0x07, 0x5e, 0xff, 0x62, 0xff, 0x43, 0x01, 0x3d, 0x01, 0x02, 0x06, 0x1b, 0xc5, 0x80, 0x80, 0xff, 0x54, 0xdf,
+    0x40, 0xc1, 0x55, 0xa1, 0x41, 0x3a, 0x00, 0x01, 0xc0, 0x55, 0x40, 0x41, 0x03, 0xc0, 0x55, 0x76, 0x41, 0x96, 0x55, 0xa0, 0x41, 0x60, 0x55, 0xa0,
+    0x41, 0x03, 0x2a, 0x55, 0xa0, 0x41, 0x00, 0x55, 0x76, 0x41, 0x00, 0x55, 0x40, 0x41, 0x03, 0x00, 0x55, 0x0a, 0x41, 0x2a, 0x55, 0xe0, 0x40, 0x60,
+    0x55, 0xe0, 0x40, 0x03, 0x96, 0x55, 0xe0, 0x40, 0xc0, 0x55, 0x0a, 0x41, 0xc0, 0x55, 0x40, 0x41, 0x04, 0x06, 0x1b, 0xc8, 0x80, 0x80, 0xdf, 0x3c,
+    0x1f, 0x02, 0xe1, 0x43, 0x21, 0x09, 0x09, 0x00, 0x07, 0xe0, 0x3c, 0x20, 0x02, 0x00, 0x07, 0x00, 0x07, 0x06, 0x0b, 0xc7, 0x80, 0x80, 0x9d, 0x29,
+    0x20, 0x1e, 0xa3, 0x2c, 0x20, 0x21, 0x09, 0x00, 0x07, 0x9e, 0x29, 0x22, 0x1e, 0x03, 0x03, 0xfd, 0x02, 0x06, 0x13, 0xc7, 0x7f, 0x80, 0xbf, 0x30,
+    0x82, 0x11, 0xc5, 0x35, 0x81, 0x16, 0x09, 0x00, 0x07, 0xc0, 0x30, 0x83, 0x11, 0x03, 0x05, 0xfd, 0x04, 0x06, 0x06, 0xc7, 0x7f, 0x80, 0x5f, 0x1e,
+    0xc2, 0xff, 0x65, 0x23, 0xc1, 0x04, 0x09, 0x00, 0x07, 0x60, 0x1e, 0xc3, 0xff, 0x03, 0x05, 0xfd, 0x04, 0x01, 0x03, 0xfe, 0x1c, 0x1e, 0x53, 0x04,
+    0xe0, 0x06, 0x06, 0x19, 0xc5, 0x80, 0x80, 0x5d, 0xff, 0x60, 0xff, 0xa3, 0x00, 0xa0, 0x00, 0x09, 0x00, 0x07, 0x5e, 0xff, 0x62, 0xff, 0x43, 0x01,
+    0x3d, 0x01, 0x02, 0x06, 0x0a, 0xc8, 0x80, 0x80, 0xbf, 0x01, 0x1f, 0x00, 0x81, 0x07, 0xe1, 0x05, 0x09, 0x00, 0x07, 0xc0, 0x01, 0x20, 0x00, 0xc0,
+    0x05, 0xc0, 0x05, 0x06, 0x25, 0xc7, 0x80, 0x80, 0x9f, 0x44, 0x9f, 0x02, 0xa1, 0x46, 0xa1, 0x04, 0x09, 0x00, 0x07, 0xa0, 0x44, 0xa0, 0x02, 0x00,
+    0x02, 0x00, 0x02, 0x06, 0x0f, 0xc7, 0x80, 0x80, 0xbf, 0x37, 0xdf, 0x1c, 0x81, 0x3a, 0xa1, 0x1f, 0x09, 0x00, 0x07, 0xc0, 0x37, 0xe0, 0x1c, 0xc0,
+    0x02, 0xc0, 0x02, 0x06, 0x1b, 0xc2, 0x80, 0x80, 0x1f, 0x23, 0x3f, 0x1d, 0xa1, 0x23, 0xc1, 0x1d, 0x09, 0x00, 0x07, 0x20, 0x23, 0x40, 0x1d, 0x80,
+    0x00, 0x80, 0x00, 0x06, 0x26, 0xc7, 0x80, 0x80, 0xff, 0xfe, 0xff, 0x1b, 0xc1, 0x02, 0xc1, 0x1f, 0x09, 0x00, 0x07, 0x00, 0xff, 0x00, 0x1c, 0xc0,
+    0x03, 0xc0, 0x03, 0x06, 0x26, 0xc6, 0x80, 0x7f, 0xfb, 0x48, 0x9f, 0x0e, 0xc1, 0x4a, 0x5e, 0x10, 0x09, 0x00, 0x07, 0xfd, 0x48, 0xa0, 0x0e, 0xc3,
+    0x01, 0xbd, 0x01, 0x06, 0x30, 0xc5, 0x80, 0x80, 0x3f, 0x0e, 0xff, 0x1d, 0x41, 0x0f, 0x01, 0x1f, 0x09, 0x00, 0x07, 0x40, 0x0e, 0x00, 0x1e, 0x00,
+    0x01, 0x00, 0x01, 0x06, 0x0b, 0xc2, 0x80, 0x80, 0x1f, 0x1a, 0xdf, 0x4b, 0xa1, 0x1a, 0x61, 0x4c, 0x09, 0x00, 0x07, 0x20, 0x1a, 0xe0, 0x4b, 0x80,
+    0x00, 0x80, 0x00, 0x06, 0x14, 0xc8, 0x80, 0x80, 0xc0, 0x58, 0x40, 0x54, 0x43, 0x5f, 0xc0, 0x5a, 0x09, 0x00, 0x07, 0xc2, 0x58, 0x42, 0x54, 0x80,
+    0x06, 0x7d, 0x06, 0x06, 0x26, 0xc7, 0x80, 0x80, 0xdf, 0x52, 0x3f, 0x21, 0x21, 0x56, 0x81, 0x24, 0x09, 0x00, 0x07, 0xe0, 0x52, 0x40, 0x21, 0x40,
+    0x03, 0x40, 0x03, 0x06, 0x1a, 0xc7, 0x80, 0x80, 0xfd, 0x0d, 0xe0, 0x59, 0x83, 0x11, 0x60, 0x5d, 0x09, 0x00, 0x07, 0xfe, 0x0d, 0xe2, 0x59, 0x83,
+    0x03, 0x7d, 0x03, 0x06, 0x1b, 0xc7, 0x80, 0x80, 0x9d, 0x52, 0xc0, 0x14, 0xa3, 0x55, 0xc0, 0x17, 0x09, 0x00, 0x07, 0x9e, 0x52, 0xc2, 0x14, 0x03,
+    0x03, 0xfd, 0x02, 0x06, 0x0e, 0xc7, 0x80, 0x7f, 0x5f, 0x06, 0x9f, 0x3e, 0xe1, 0x08, 0x21, 0x41, 0x09, 0x00, 0x07, 0x60, 0x06, 0xa0, 0x3e, 0x80,
+    0x02, 0x80, 0x02, 0x06, 0x26, 0xc6, 0x80, 0x80, 0x7d, 0x3f, 0xe0, 0x1a, 0xc3, 0x41, 0x20, 0x1d, 0x09, 0x00, 0x07, 0x7e, 0x3f, 0xe2, 0x1a, 0x43,
+    0x02, 0x3d, 0x02, 0x06, 0x06, 0xc7, 0x80, 0x80, 0xdf, 0x06, 0xbf, 0x2e, 0x21, 0x0a, 0x01, 0x32, 0x09, 0x00, 0x07, 0xe0, 0x06, 0xc0, 0x2e, 0x40,
+    0x03, 0x40, 0x03, 0x06, 0x1d, 0xc2, 0x80, 0x80, 0x5f, 0x41, 0xdf, 0x4a, 0xe1, 0x41, 0x61, 0x4b, 0x09, 0x00, 0x07, 0x60, 0x41, 0xe0, 0x4a, 0x80,
+    0x00, 0x80, 0x00, 0x06, 0x14, 0xc6, 0x80, 0x80, 0x3f, 0x32, 0x1f, 0x50, 0xc1, 0x33, 0xa1, 0x51, 0x09, 0x00, 0x07, 0x40, 0x32, 0x20, 0x50, 0x80,
+    0x01, 0x80, 0x01, 0x06, 0x1c, 0xc7, 0x80, 0x80, 0x1f, 0x58, 0xdf, 0x27, 0xe1, 0x5a, 0xa1, 0x2a, 0x09, 0x00, 0x07, 0x20, 0x58, 0xe0, 0x27, 0xc0,
+    0x02, 0xc0, 0x02, 0x06, 0x08, 0xc2, 0x80, 0x80, 0x3f, 0x17, 0x9f, 0x48, 0xc1, 0x17, 0x21, 0x49, 0x09, 0x00, 0x07, 0x40, 0x17, 0xa0, 0x48, 0x80,
+    0x00, 0x80, 0x00, 0x06, 0x1b, 0xc7, 0x80, 0x80, 0xdf, 0x38, 0xff, 0x33, 0xe1, 0x3a, 0x01, 0x36, 0x09, 0x00, 0x07, 0xe0, 0x38, 0x00, 0x34, 0x00,
+    0x02, 0x00, 0x02, 0x06, 0x2c, 0xc7, 0x80, 0x80, 0x5f, 0x15, 0x9f, 0x13, 0x21, 0x19, 0x61, 0x17, 0x09, 0x00, 0x07, 0x60, 0x15, 0xa0, 0x13, 0xc0,
+    0x03, 0xc0, 0x03, 0x06, 0x02, 0xc7, 0x7f, 0x80, 0x1d, 0x3c, 0xe0, 0x50, 0xa3, 0x3f, 0x60, 0x54, 0x09, 0x00, 0x07, 0x1e, 0x3c, 0xe2, 0x50, 0x83,
+    0x03, 0x7d, 0x03, 0x06, 0x06, 0xc6, 0x80, 0x7f, 0x3b, 0x53, 0xff, 0x57, 0x01, 0x55, 0xbe, 0x59, 0x09, 0x00, 0x07, 0x3d, 0x53, 0x00, 0x58, 0xc3,
+    0x01, 0xbd, 0x01, 0x06, 0x06, 0xc6, 0x80, 0x80, 0x3f, 0x11, 0x9f, 0x32, 0xc1, 0x12, 0x21, 0x34, 0x09, 0x00, 0x07, 0x40, 0x11, 0xa0, 0x32, 0x80,
+    0x01, 0x80, 0x01, 0x06, 0x06, 0xc5, 0x80, 0x80, 0xff, 0x41, 0x5f, 0x10, 0x01, 0x43, 0x61, 0x11, 0x09, 0x00, 0x07, 0x00, 0x42, 0x60, 0x10, 0x00,
+    0x01, 0x00, 0x01, 0x06, 0x12, 0xc6, 0x80, 0x7f, 0xfb, 0x33, 0x1f, 0x23, 0xc1, 0x35, 0xde, 0x24, 0x09, 0x00, 0x07, 0xfd, 0x33, 0x20, 0x23, 0xc3,
+    0x01, 0xbd, 0x01, 0x06, 0x03, 0xc2, 0x80, 0x80, 0x3f, 0x37, 0xdf, 0x0c, 0xc1, 0x37, 0x61, 0x0d, 0x09, 0x00, 0x07, 0x40, 0x37, 0xe0, 0x0c, 0x80,
+    0x00, 0x80, 0x00, 0x06, 0x08, 0xc8, 0x7f, 0x80, 0xbf, 0x54, 0x02, 0x03, 0x05, 0x5e, 0x41, 0x0c, 0x09, 0x00, 0x07, 0xc0, 0x54, 0x03, 0x03, 0x43,
+    0x09, 0x3d, 0x09, 0x06, 0x12, 0xc5, 0x80, 0x80, 0x1f, 0x07, 0x9f, 0x03, 0x21, 0x08, 0xa1, 0x04, 0x09, 0x00, 0x07, 0x20, 0x07, 0xa0, 0x03, 0x00,
+    0x01, 0x00, 0x01, 0x06, 0x26, 0xc8, 0x80, 0x7f, 0x9f, 0x35, 0xbf, 0x13, 0x21, 0x3b, 0x41, 0x19, 0x09, 0x00, 0x07, 0xa0, 0x35, 0xc0, 0x13, 0x80,
+    0x05, 0x80, 0x05, 0x06, 0x08, 0xc6, 0x80, 0x80, 0x3f, 0x4f, 0x7f, 0x53, 0xc1, 0x50, 0x01, 0x55, 0x09, 0x00, 0x07, 0x40, 0x4f, 0x80, 0x53, 0x80,
+    0x01, 0x80, 0x01, 0x06, 0x26, 0xc7, 0x80, 0x80, 0xff, 0x33, 0x7f, 0x50, 0x41, 0x37, 0xc1, 0x53, 0x09, 0x00, 0x07, 0x00, 0x34, 0x80, 0x50, 0x40,
+    0x03, 0x40, 0x03, 0x06, 0x06, 0xc8, 0x80, 0x80, 0xbf, 0x52, 0xdf, 0x10, 0x81, 0x58, 0xa1, 0x16, 0x09, 0x00, 0x07, 0xc0, 0x52, 0xe0, 0x10, 0xc0,
+    0x05, 0xc0, 0x05, 0x06, 0x2b, 0xc7, 0x80, 0x80, 0x5f, 0x1e, 0x1f, 0x18, 0x21, 0x22, 0xe1, 0x1b, 0x09, 0x00, 0x07, 0x60, 0x1e, 0x20, 0x18, 0xc0,
+    0x03, 0xc0, 0x03, 0x06, 0x1b, 0xc7, 0x80, 0x80, 0x5d, 0x35, 0x40, 0x53, 0x63, 0x38, 0x40, 0x56, 0x09, 0x00, 0x07, 0x5e, 0x35, 0x42, 0x53, 0x03,
+    0x03, 0xfd, 0x02, 0x06, 0x14, 0xc5, 0x7f, 0x7f, 0x9f, 0x38, 0xbf, 0x31, 0x61, 0x39, 0x81, 0x32, 0x3a, 0x00, 0x01, 0x60, 0x39, 0x20, 0x32, 0x03,
+    0x60, 0x39, 0x56, 0x32, 0x36, 0x39, 0x80, 0x32, 0x00, 0x39, 0x80, 0x32, 0x03, 0xca, 0x38, 0x80, 0x32, 0xa0, 0x38, 0x56, 0x32, 0xa0, 0x38, 0x20,
+    0x32, 0x03, 0xa0, 0x38, 0xea, 0x31, 0xca, 0x38, 0xc0, 0x31, 0x00, 0x39, 0xc0, 0x31, 0x03, 0x36, 0x39, 0xc0, 0x31, 0x60, 0x39, 0xea, 0x31, 0x60,
+    0x39, 0x20, 0x32, 0x04, 0x06, 0x0b, 0xc7, 0x80, 0x80, 0xbf, 0x2c, 0x9f, 0x1e, 0x01, 0x30, 0xe1, 0x21, 0x09, 0x00, 0x07, 0xc0, 0x2c, 0xa0, 0x1e,
+    0x40, 0x03, 0x40, 0x03, 0x06, 0x1b, 0xc5, 0x7f, 0x7f, 0xdf, 0x19, 0xbf, 0x39, 0xa1, 0x1a, 0x81, 0x3a, 0x3a, 0x00, 0x01, 0xa0, 0x1a, 0x20, 0x3a,
+    0x03, 0xa0, 0x1a, 0x56, 0x3a, 0x76, 0x1a, 0x80, 0x3a, 0x40, 0x1a, 0x80, 0x3a, 0x03, 0x0a, 0x1a, 0x80, 0x3a, 0xe0, 0x19, 0x56, 0x3a, 0xe0, 0x19,
+    0x20, 0x3a, 0x03, 0xe0, 0x19, 0xea, 0x39, 0x0a, 0x1a, 0xc0, 0x39, 0x40, 0x1a, 0xc0, 0x39, 0x03, 0x76, 0x1a, 0xc0, 0x39, 0xa0, 0x1a, 0xea, 0x39,
+    0xa0, 0x1a, 0x20, 0x3a, 0x04, 0x06, 0x18, 0xc7, 0x80, 0x80, 0x7d, 0x0d, 0xe0, 0x22, 0x83, 0x10, 0xe0, 0x25, 0x09, 0x00, 0x07, 0x7e, 0x0d, 0xe2,
+    0x22, 0x03, 0x03, 0xfd, 0x02, 0x06, 0x30, 0xc7, 0x80, 0x80, 0xbd, 0x2b, 0x20, 0x13, 0x43, 0x2f, 0xa0, 0x16, 0x09, 0x00, 0x07, 0xbe, 0x2b, 0x22,
+    0x13, 0x83, 0x03, 0x7d, 0x03, 0x06, 0x01, 0xc7, 0x80, 0x80, 0x7d, 0x10, 0xa0, 0x19, 0x03, 0x14, 0x20, 0x1d, 0x09, 0x00, 0x07, 0x7e, 0x10, 0xa2,
+    0x19, 0x83, 0x03, 0x7d, 0x03, 0x06, 0x17, 0xc6, 0x80, 0x80, 0x9d, 0x2d, 0x20, 0x51, 0xe3, 0x2f, 0x60, 0x53, 0x09, 0x00, 0x07, 0x9e, 0x2d, 0x22,
+    0x51, 0x43, 0x02, 0x3d, 0x02, 0x01, 0x03, 0x7e, 0x00, 0x7e, 0x27, 0x04, 0xe0, 0x06, 0x06, 0x1b, 0xc5, 0x80, 0x80, 0x5d, 0xff, 0x60, 0xff, 0xa3,
+    0x00, 0xa0, 0x00, 0x09, 0x00, 0x07, 0x5e, 0xff, 0x62, 0xff, 0x43, 0x01, 0x3d, 0x01, 0x02, 0x01, 0x03, 0x5e, 0x48, 0x1e, 0x22, 0x04, 0xe0, 0x06,
+    0x06, 0x18, 0xc5, 0x80, 0x80, 0x5d, 0xff, 0x60, 0xff, 0xa3, 0x00, 0xa0, 0x00, 0x09, 0x00, 0x07, 0x5e, 0xff, 0x62, 0xff, 0x43, 0x01, 0x3d, 0x01,
+    0x02, 0x06, 0x30, 0xc5, 0x7f, 0x7f, 0xff, 0x23, 0xdf, 0x46, 0xc1, 0x24, 0xa1, 0x47, 0x3a, 0x00, 0x01, 0xc0, 0x24, 0x40, 0x47, 0x03, 0xc0, 0x24,
+    0x76, 0x47, 0x96, 0x24, 0xa0, 0x47, 0x60, 0x24, 0xa0, 0x47, 0x03, 0x2a, 0x24, 0xa0, 0x47, 0x00, 0x24, 0x76, 0x47, 0x00, 0x24, 0x40, 0x47, 0x03,
+    0x00, 0x24, 0x0a, 0x47, 0x2a, 0x24, 0xe0, 0x46, 0x60, 0x24, 0xe0, 0x46, 0x03, 0x96, 0x24, 0xe0, 0x46, 0xc0, 0x24, 0x0a, 0x47, 0xc0, 0x24, 0x40,
+    0x47, 0x04, 0x06, 0x14, 0xc7, 0x80, 0x80, 0x5f, 0x33, 0x3f, 0x45, 0xe1, 0x35, 0xc1, 0x47, 0x09, 0x00, 0x07, 0x60, 0x33, 0x40, 0x45, 0x80, 0x02,
+    0x80, 0x02, 0x06, 0x15, 0xc6, 0x80, 0x80, 0x5d, 0x3a, 0x80, 0x2e, 0xa3, 0x3c, 0xc0, 0x30, 0x09, 0x00, 0x07, 0x5e, 0x3a, 0x82, 0x2e, 0x43, 0x02,
+    0x3d, 0x02, 0x06, 0x06, 0xc7, 0x80, 0x80, 0x5f, 0x57, 0xdf, 0x3c, 0xe1, 0x59, 0x61, 0x3f, 0x09, 0x00, 0x07, 0x60, 0x57, 0xe0, 0x3c, 0x80, 0x02,
+    0x80, 0x02, 0x06, 0x26, 0xc7, 0x7f, 0x80, 0x9d, 0x3b, 0x60, 0x21, 0x23, 0x3f, 0xe0, 0x24, 0x09, 0x00, 0x07, 0x9e, 0x3b, 0x62, 0x21, 0x83, 0x03,
+    0x7d, 0x03, 0x06, 0x17, 0xc5, 0x80, 0x80, 0x7f, 0x1f, 0x3f, 0x4d, 0x41, 0x20, 0x01, 0x4e, 0x3a, 0x00, 0x01, 0x40, 0x20, 0xa0, 0x4d, 0x03, 0x40,
+    0x20, 0xd6, 0x4d, 0x16, 0x20, 0x00, 0x4e, 0xe0, 0x1f, 0x00, 0x4e, 0x03, 0xaa, 0x1f, 0x00, 0x4e, 0x80, 0x1f, 0xd6, 0x4d, 0x80, 0x1f, 0xa0, 0x4d,
+    0x03, 0x80, 0x1f, 0x6a, 0x4d, 0xaa, 0x1f, 0x40, 0x4d, 0xe0, 0x1f, 0x40, 0x4d, 0x03, 0x16, 0x20, 0x40, 0x4d, 0x40, 0x20, 0x6a, 0x4d, 0x40, 0x20,
+    0xa0, 0x4d, 0x04, 0x06, 0x1d, 0xc2, 0x80, 0x80, 0x9f, 0x1b, 0xff, 0x3a, 0x21, 0x1c, 0x81, 0x3b, 0x09, 0x00, 0x07, 0xa0, 0x1b, 0x00, 0x3b, 0x80,
+    0x00, 0x80, 0x00, 0x06, 0x1a, 0xc7, 0x7f, 0x80, 0x1f, 0x08, 0x02, 0x02, 0x25, 0x0d, 0x01, 0x07, 0x09, 0x00, 0x07, 0x20, 0x08, 0x03, 0x02, 0x03,
+    0x05, 0xfd, 0x04, 0x06, 0x14, 0xc5, 0x7f, 0x7f, 0x9f, 0x4f, 0xdf, 0x4c, 0x61, 0x50, 0xa1, 0x4d, 0x3a, 0x00, 0x01, 0x60, 0x50, 0x40, 0x4d, 0x03,
+    0x60, 0x50, 0x76, 0x4d, 0x36, 0x50, 0xa0, 0x4d, 0x00, 0x50, 0xa0, 0x4d, 0x03, 0xca, 0x4f, 0xa0, 0x4d, 0xa0, 0x4f, 0x76, 0x4d, 0xa0, 0x4f, 0x40,
+    0x4d, 0x03, 0xa0, 0x4f, 0x0a, 0x4d, 0xca, 0x4f, 0xe0, 0x4c, 0x00, 0x50, 0xe0, 0x4c, 0x03, 0x36, 0x50, 0xe0, 0x4c, 0x60, 0x50, 0x0a, 0x4d, 0x60,
+    0x50, 0x40, 0x4d, 0x04, 0x06, 0x2d, 0xc6, 0x80, 0x7f, 0xfb, 0x11, 0x3f, 0x2f, 0xc1, 0x13, 0xfe, 0x30, 0x09, 0x00, 0x07, 0xfd, 0x11, 0x40, 0x2f,
+    0xc3, 0x01, 0xbd, 0x01, 0x01, 0x03, 0xde, 0x2c, 0xbe, 0x4f, 0x04, 0xe0, 0x06, 0x06, 0x30, 0xc5, 0x80, 0x80, 0x5d, 0xff, 0x60, 0xff, 0xa3, 0x00,
+    0xa0, 0x00, 0x09, 0x00, 0x07, 0x5e, 0xff, 0x62, 0xff, 0x43, 0x01, 0x3d, 0x01, 0x02, 0x06, 0x17, 0xc6, 0x80, 0x80, 0x1f, 0x32, 0x5f, 0x55, 0xa1,
+    0x33, 0xe1, 0x56, 0x09, 0x00, 0x07, 0x20, 0x32, 0x60, 0x55, 0x80, 0x01, 0x80, 0x01, 0x06, 0x02, 0xc7, 0x80, 0x80, 0x1f, 0x35, 0x5f, 0x19, 0xe1,
+    0x37, 0x21, 0x1c, 0x09, 0x00, 0x07, 0x20, 0x35, 0x60, 0x19, 0xc0, 0x02, 0xc0, 0x02, 0x06, 0x08, 0xc8, 0x80, 0x80, 0x7f, 0x16, 0xdf, 0x13, 0x41,
+    0x1b, 0xa1, 0x18, 0x09, 0x00, 0x07, 0x80, 0x16, 0xe0, 0x13, 0xc0, 0x04, 0xc0, 0x04, 0x01, 0x03, 0xbe, 0x18, 0x9e, 0x26, 0x04, 0xe0, 0x06, 0x06,
+    0x1b, 0xc5, 0x80, 0x80, 0x5d, 0xff, 0x60, 0xff, 0xa3, 0x00, 0xa0, 0x00, 0x09, 0x00, 0x07, 0x5e, 0xff, 0x62, 0xff, 0x43, 0x01, 0x3d, 0x01, 0x02,
+    0x06, 0x1b, 0xc6, 0x80, 0x7f, 0x3b, 0x30, 0xff, 0x25, 0x01, 0x32, 0xbe, 0x27, 0x09, 0x00, 0x07, 0x3d, 0x30, 0x00, 0x26, 0xc3, 0x01, 0xbd, 0x01,
+    0x06, 0x17, 0xc6, 0x80, 0x80, 0x7f, 0x0e, 0x1f, 0x1b, 0x01, 0x10, 0xa1, 0x1c, 0x09, 0x00, 0x07, 0x80, 0x0e, 0x20, 0x1b, 0x80, 0x01, 0x80, 0x01,
+    0x06, 0x01, 0xc2, 0x80, 0x80, 0x1f, 0x02, 0xff, 0x27, 0xa1, 0x02, 0x81, 0x28, 0x09, 0x00, 0x07, 0x20, 0x02, 0x00, 0x28, 0x80, 0x00, 0x80, 0x00,
+    0x06, 0x1f, 0xc6, 0x80, 0x7f, 0xdb, 0x55, 0xff, 0x42, 0xa1, 0x57, 0xbe, 0x44, 0x09, 0x00, 0x07, 0xdd, 0x55, 0x00, 0x43, 0xc3, 0x01, 0xbd, 0x01,
+    0x06, 0x2c, 0xc8, 0x80, 0x80, 0x9f, 0x2e, 0x5f, 0xff, 0x61, 0x34, 0x21, 0x05, 0x09, 0x00, 0x07, 0xa0, 0x2e, 0x60, 0xff, 0xc0, 0x05, 0xc0, 0x05,
+    0x06, 0x1b, 0xc6, 0x80, 0x7f, 0x3b, 0x1e, 0xbf, 0x26, 0x01, 0x20, 0x7e, 0x28, 0x09, 0x00, 0x07, 0x3d, 0x1e, 0xc0, 0x26, 0xc3, 0x01, 0xbd, 0x01,
+    0x06, 0x0b, 0xc7, 0x80, 0x80, 0xbf, 0x3a, 0xdf, 0x1e, 0x01, 0x3e, 0x21, 0x22, 0x09, 0x00, 0x07, 0xc0, 0x3a, 0xe0, 0x1e, 0x40, 0x03, 0x40, 0x03,
+    0x01, 0x03, 0x5e, 0x3d, 0x9e, 0x5e, 0x04, 0xe0, 0x06, 0x06, 0x1b, 0xc5, 0x80, 0x80, 0x5d, 0xff, 0x60, 0xff, 0xa3, 0x00, 0xa0, 0x00, 0x09, 0x00,
+    0x07, 0x5e, 0xff, 0x62, 0xff, 0x43, 0x01, 0x3d, 0x01, 0x02, 0x06, 0x1b, 0xc5, 0x7f, 0x7f, 0x3f, 0x50, 0x7f, 0x59, 0x01, 0x51, 0x41, 0x5a, 0x3a,
+    0x00, 0x01, 0x00, 0x51, 0xe0, 0x59, 0x03, 0x00, 0x51, 0x16, 0x5a, 0xd6, 0x50, 0x40, 0x5a, 0xa0, 0x50, 0x40, 0x5a, 0x03, 0x6a, 0x50, 0x40, 0x5a,
+    0x40, 0x50, 0x16, 0x5a, 0x40, 0x50, 0xe0, 0x59, 0x03, 0x40, 0x50, 0xaa, 0x59, 0x6a, 0x50, 0x80, 0x59, 0xa0, 0x50, 0x80, 0x59, 0x03, 0xd6, 0x50,
+    0x80, 0x59, 0x00, 0x51, 0xaa, 0x59, 0x00, 0x51, 0xe0, 0x59, 0x04, 0x06, 0x26, 0xc8, 0x80, 0x80, 0xff, 0x4e, 0xff, 0xfe, 0x81, 0x54, 0x81, 0x04,
+    0x09, 0x00, 0x07, 0x00, 0x4f, 0x00, 0xff, 0x80, 0x05, 0x80, 0x05, 0x01, 0x03, 0x7e, 0x26, 0x7e, 0x1a, 0x04, 0xe0, 0x06, 0x06, 0x01, 0xc5, 0x80,
+    0x80, 0x5d, 0xff, 0x60, 0xff, 0xa3, 0x00, 0xa0, 0x00, 0x09, 0x00, 0x07, 0x5e, 0xff, 0x62, 0xff, 0x43, 0x01, 0x3d, 0x01, 0x02, 0x01, 0x03, 0x1e,
+    0x3f, 0x9e, 0x37, 0x04, 0xe0, 0x06, 0x06, 0x1b, 0xc5, 0x80, 0x80, 0x5d, 0xff, 0x60, 0xff, 0xa3, 0x00, 0xa0, 0x00, 0x09, 0x00, 0x07, 0x5e, 0xff,
+    0x62, 0xff, 0x43, 0x01, 0x3d, 0x01, 0x02, 0x06, 0x1c, 0xc6, 0x80, 0x80, 0x5f, 0x06, 0x1f, 0x35, 0xe1, 0x07, 0xa1, 0x36, 0x09, 0x00, 0x07, 0x60,
+    0x06, 0x20, 0x35, 0x80, 0x01, 0x80, 0x01, 0x06, 0x1e, 0xc7, 0x7f, 0x80, 0x9f, 0x03, 0xc2, 0x03, 0xa5, 0x08, 0xc1, 0x08, 0x09, 0x00, 0x07, 0xa0,
+    0x03, 0xc3, 0x03, 0x03, 0x05, 0xfd, 0x04, 0x06, 0x18, 0xc7, 0x80, 0x80, 0xff, 0x15, 0xff, 0x29, 0x81, 0x18, 0x81, 0x2c, 0x09, 0x00, 0x07, 0x00,
+    0x16, 0x00, 0x2a, 0x80, 0x02, 0x80, 0x02, 0x06, 0x0d, 0xc5, 0x80, 0x80, 0x1f, 0x23, 0x9f, 0x27, 0x21, 0x24, 0xa1, 0x28, 0x09, 0x00, 0x07, 0x20,
+    0x23, 0xa0, 0x27, 0x00, 0x01, 0x00, 0x01, 0x06, 0x03, 0xc8, 0x80, 0x80, 0x9f, 0x56, 0xdf, 0x3c, 0x61, 0x5d, 0xa1, 0x43, 0x09, 0x00, 0x07, 0xa0,
+    0x56, 0xe0, 0x3c, 0xc0, 0x06, 0xc0, 0x06, 0x06, 0x0b, 0xc5, 0x7f, 0x7f, 0xff, 0x2f, 0xbf, 0x35, 0xc1, 0x30, 0x81, 0x36, 0x3a, 0x00, 0x01, 0xc0,
+    0x30, 0x20, 0x36, 0x03, 0xc0, 0x30, 0x56, 0x36, 0x96, 0x30, 0x80, 0x36, 0x60, 0x30, 0x80, 0x36, 0x03, 0x2a, 0x30, 0x80, 0x36, 0x00, 0x30, 0x56,
+    0x36, 0x00, 0x30, 0x20, 0x36, 0x03, 0x00, 0x30, 0xea, 0x35, 0x2a, 0x30, 0xc0, 0x35, 0x60, 0x30, 0xc0, 0x35, 0x03, 0x96, 0x30, 0xc0, 0x35, 0xc0,
+    0x30, 0xea, 0x35, 0xc0, 0x30, 0x20, 0x36, 0x04, 0x06, 0x30, 0xc5, 0x7f, 0x7f, 0x3f, 0x11, 0xdf, 0x1f, 0x01, 0x12, 0xa1, 0x20, 0x3a, 0x00, 0x01,
+    0x00, 0x12, 0x40, 0x20, 0x03, 0x00, 0x12, 0x76, 0x20, 0xd6, 0x11, 0xa0, 0x20, 0xa0, 0x11, 0xa0, 0x20, 0x03, 0x6a, 0x11, 0xa0, 0x20, 0x40, 0x11,
+    0x76, 0x20, 0x40, 0x11, 0x40, 0x20, 0x03, 0x40, 0x11, 0x0a, 0x20, 0x6a, 0x11, 0xe0, 0x1f, 0xa0, 0x11, 0xe0, 0x1f, 0x03, 0xd6, 0x11, 0xe0, 0x1f,
+    0x00, 0x12, 0x0a, 0x20, 0x00, 0x12, 0x40, 0x20, 0x04, 0x06, 0x1a, 0xc7, 0x80, 0x80, 0x7f, 0x35, 0xdf, 0x58, 0xc1, 0x38, 0x21, 0x5c, 0x09, 0x00,
+    0x07, 0x80, 0x35, 0xe0, 0x58, 0x40, 0x03, 0x40, 0x03, 0x06, 0x17, 0xc5, 0x80, 0x80, 0x9f, 0x1f, 0x7f, 0x36, 0x61, 0x20, 0x41, 0x37, 0x3a, 0x00,
+    0x01, 0x60, 0x20, 0xe0, 0x36, 0x03, 0x60, 0x20, 0x16, 0x37, 0x36, 0x20, 0x40, 0x37, 0x00, 0x20, 0x40, 0x37, 0x03, 0xca, 0x1f, 0x40, 0x37, 0xa0,
+    0x1f, 0x16, 0x37, 0xa0, 0x1f, 0xe0, 0x36, 0x03, 0xa0, 0x1f, 0xaa, 0x36, 0xca, 0x1f, 0x80, 0x36, 0x00, 0x20, 0x80, 0x36, 0x03, 0x36, 0x20, 0x80,
+    0x36, 0x60, 0x20, 0xaa, 0x36, 0x60, 0x20, 0xe0, 0x36, 0x04, 0x06, 0x00, 0xc2, 0x80, 0x80, 0x5f, 0x21, 0xff, 0x41, 0xe1, 0x21, 0x81, 0x42, 0x09,
+    0x00, 0x07, 0x60, 0x21, 0x00, 0x42, 0x80, 0x00, 0x80, 0x00, 0x06, 0x2c, 0xc7, 0x7f, 0x80, 0xdf, 0x1c, 0xc2, 0x05, 0xe5, 0x21, 0xc1, 0x0a, 0x09,
+    0x00, 0x07, 0xe0, 0x1c, 0xc3, 0x05, 0x03, 0x05, 0xfd, 0x04, 0x06, 0x06, 0xc7, 0x80, 0x80, 0x3f, 0x48, 0x9f, 0xff, 0x41, 0x4a, 0xa1, 0x01, 0x09,
+    0x00, 0x07, 0x40, 0x48, 0xa0, 0xff, 0x00, 0x02, 0x00, 0x02, 0x06, 0x0e, 0xc5, 0x80, 0x80, 0xdf, 0x34, 0x5f, 0x34, 0xe1, 0x35, 0x61, 0x35, 0x09,
+    0x00, 0x07, 0xe0, 0x34, 0x60, 0x34, 0x00, 0x01, 0x00, 0x01, 0x01, 0x03, 0x3e, 0x44, 0x7e, 0x0d, 0x04, 0xe0, 0x06, 0x06, 0x1b, 0xc5, 0x80, 0x80,
+    0x5d, 0xff, 0x60, 0xff, 0xa3, 0x00, 0xa0, 0x00, 0x09, 0x00, 0x07, 0x5e, 0xff, 0x62, 0xff, 0x43, 0x01, 0x3d, 0x01, 0x02, 0x06, 0x29, 0xc7, 0x80,
+    0x80, 0xff, 0x2e, 0x3f, 0x0e, 0x01, 0x31, 0x41, 0x10, 0x09, 0x00, 0x07, 0x00, 0x2f, 0x40, 0x0e, 0x00, 0x02, 0x00, 0x02, 0x06, 0x1b, 0xc6, 0x80,
+    0x7f, 0x9b, 0x34, 0x3f, 0x56, 0x61, 0x36, 0xfe, 0x57, 0x09, 0x00, 0x07, 0x9d, 0x34, 0x40, 0x56, 0xc3, 0x01, 0xbd, 0x01, 0x06, 0x2f, 0xc6, 0x80,
+    0x80, 0x9d, 0x09, 0x60, 0x1d, 0xe3, 0x0b, 0xa0, 0x1f, 0x09, 0x00, 0x07, 0x9e, 0x09, 0x62, 0x1d, 0x43, 0x02, 0x3d, 0x02, 0x06, 0x26, 0xc5, 0x80,
+    0x80, 0x1f, 0x11, 0xff, 0x44, 0xe1, 0x11, 0xc1, 0x45, 0x3a, 0x00, 0x01, 0xe0, 0x11, 0x60, 0x45, 0x03, 0xe0, 0x11, 0x96, 0x45, 0xb6, 0x11, 0xc0,
+    0x45, 0x80, 0x11, 0xc0, 0x45, 0x03, 0x4a, 0x11, 0xc0, 0x45, 0x20, 0x11, 0x96, 0x45, 0x20, 0x11, 0x60, 0x45, 0x03, 0x20, 0x11, 0x2a, 0x45, 0x4a,
+    0x11, 0x00, 0x45, 0x80, 0x11, 0x00, 0x45, 0x03, 0xb6, 0x11, 0x00, 0x45, 0xe0, 0x11, 0x2a, 0x45, 0xe0, 0x11, 0x60, 0x45, 0x04, 0x06, 0x2e, 0xc5,
+    0x7f, 0x7f, 0x9f, 0x59, 0x7f, 0x43, 0x61, 0x5a, 0x41, 0x44, 0x3a, 0x00, 0x01, 0x60, 0x5a, 0xe0, 0x43, 0x03, 0x60, 0x5a, 0x16, 0x44, 0x36, 0x5a,
+    0x40, 0x44, 0x00, 0x5a, 0x40, 0x44, 0x03, 0xca, 0x59, 0x40, 0x44, 0xa0, 0x59, 0x16, 0x44, 0xa0, 0x59, 0xe0, 0x43, 0x03, 0xa0, 0x59, 0xaa, 0x43,
+    0xca, 0x59, 0x80, 0x43, 0x00, 0x5a, 0x80, 0x43, 0x03, 0x36, 0x5a, 0x80, 0x43, 0x60, 0x5a, 0xaa, 0x43, 0x60, 0x5a, 0xe0, 0x43, 0x04, 0x06, 0x0b,
+    0xc7, 0x80, 0x80, 0x3f, 0x5b, 0xbf, 0x2d, 0x41, 0x5d, 0xc1, 0x2f, 0x09, 0x00, 0x07, 0x40, 0x5b, 0xc0, 0x2d, 0x00, 0x02, 0x00, 0x02, 0x06, 0x15,
+    0xc6, 0x7f, 0x80, 0x5f, 0x3e, 0x5f, 0x3a, 0xe1, 0x3f, 0xe1, 0x3b, 0x09, 0x00, 0x07, 0x60, 0x3e, 0x60, 0x3a, 0x80, 0x01, 0x80, 0x01, 0x06, 0x1b,
+    0xc7, 0x80, 0x80, 0x1f, 0x0a, 0xbf, 0x51, 0x21, 0x0c, 0xc1, 0x53, 0x09, 0x00, 0x07, 0x20, 0x0a, 0xc0, 0x51, 0x00, 0x02, 0x00, 0x02, 0x06, 0x1b,
+    0xc7, 0x80, 0x80, 0xdf, 0x2d, 0x5f, 0x2d, 0xe1, 0x2f, 0x61, 0x2f, 0x09, 0x00, 0x07, 0xe0, 0x2d, 0x60, 0x2d, 0x00, 0x02, 0x00, 0x02, 0x06, 0x0c,
+    0xc8, 0x80, 0x80, 0x9f, 0x53, 0x3f, 0xfe, 0xa1, 0x59, 0x41, 0x04, 0x09, 0x00, 0x07, 0xa0, 0x53, 0x40, 0xfe, 0x00, 0x06, 0x00, 0x06, 0x06, 0x1e,
+    0xc7, 0x7f, 0x80, 0xbf, 0x00, 0x02, 0x03, 0xc5, 0x04, 0x01, 0x07, 0x09, 0x00, 0x07, 0xc0, 0x00, 0x03, 0x03, 0x03, 0x04, 0xfd, 0x03, 0x06, 0x06,
+    0xc7, 0x80, 0x80, 0x7f, 0x5c, 0x9f, 0x42, 0x01, 0x5f, 0x21, 0x45, 0x09, 0x00, 0x07, 0x80, 0x5c, 0xa0, 0x42, 0x80, 0x02, 0x80, 0x02, 0x06, 0x19,
+    0xc7, 0x80, 0x80, 0xff, 0x22, 0x7f, 0x0a, 0xc1, 0x26, 0x41, 0x0e, 0x09, 0x00, 0x07, 0x00, 0x23, 0x80, 0x0a, 0xc0, 0x03, 0xc0, 0x03, 0x06, 0x31,
+    0xc7, 0x7f, 0x80, 0x9f, 0x00, 0x3f, 0x3c, 0x21, 0x03, 0xc1, 0x3e, 0x09, 0x00, 0x07, 0xa0, 0x00, 0x40, 0x3c, 0x80, 0x02, 0x80, 0x02, 0x06, 0x0b,
+    0xc7, 0x80, 0x80, 0xbf, 0x2c, 0x9f, 0x57, 0xc1, 0x2e, 0xa1, 0x59, 0x09, 0x00, 0x07, 0xc0, 0x2c, 0xa0, 0x57, 0x00, 0x02, 0x00, 0x02, 0x06, 0x30,
+    0xc7, 0x80, 0x80, 0x1f, 0x52, 0x7f, 0x2e, 0xe1, 0x55, 0x41, 0x32, 0x09, 0x00, 0x07, 0x20, 0x52, 0x80, 0x2e, 0xc0, 0x03, 0xc0, 0x03, 0x06, 0x0e,
+    0xc5, 0x7f, 0x80, 0x1f, 0x14, 0x7f, 0x5b, 0x21, 0x15, 0x81, 0x5c, 0x09, 0x00, 0x07, 0x20, 0x14, 0x80, 0x5b, 0x00, 0x01, 0x00, 0x01, 0x06, 0x17,
+    0xc6, 0x80, 0x80, 0x3f, 0x2f, 0x3f, 0x58, 0xc1, 0x30, 0xc1, 0x59, 0x09, 0x00, 0x07, 0x40, 0x2f, 0x40, 0x58, 0x80, 0x01, 0x80, 0x01, 0x06, 0x16,
+    0xc8, 0x80, 0x80, 0x7f, 0x05, 0xbf, 0x08, 0xc1, 0x0b, 0x01, 0x0f, 0x09, 0x00, 0x07, 0x80, 0x05, 0xc0, 0x08, 0x40, 0x06, 0x40, 0x06, 0x06, 0x14,
+    0xc5, 0x7f, 0x7f, 0xdf, 0x11, 0x7f, 0x29, 0xa1, 0x12, 0x41, 0x2a, 0x3a, 0x00, 0x01, 0xa0, 0x12, 0xe0, 0x29, 0x03, 0xa0, 0x12, 0x16, 0x2a, 0x76,
+    0x12, 0x40, 0x2a, 0x40, 0x12, 0x40, 0x2a, 0x03, 0x0a, 0x12, 0x40, 0x2a, 0xe0, 0x11, 0x16, 0x2a, 0xe0, 0x11, 0xe0, 0x29, 0x03, 0xe0, 0x11, 0xaa,
+    0x29, 0x0a, 0x12, 0x80, 0x29, 0x40, 0x12, 0x80, 0x29, 0x03, 0x76, 0x12, 0x80, 0x29, 0xa0, 0x12, 0xaa, 0x29, 0xa0, 0x12, 0xe0, 0x29, 0x04, 0x06,
+    0x10, 0xc7, 0x80, 0x80, 0x1f, 0x3f, 0x9f, 0x1f, 0x61, 0x42, 0xe1, 0x22, 0x09, 0x00, 0x07, 0x20, 0x3f, 0xa0, 0x1f, 0x40, 0x03, 0x40, 0x03, 0x06,
+    0x30, 0xc5, 0x7f, 0x7f, 0x9f, 0x19, 0x1f, 0x2c, 0x61, 0x1a, 0xe1, 0x2c, 0x3a, 0x00, 0x01, 0x60, 0x1a, 0x80, 0x2c, 0x03, 0x60, 0x1a, 0xb6, 0x2c,
+    0x36, 0x1a, 0xe0, 0x2c, 0x00, 0x1a, 0xe0, 0x2c, 0x03, 0xca, 0x19, 0xe0, 0x2c, 0xa0, 0x19, 0xb6, 0x2c, 0xa0, 0x19, 0x80, 0x2c, 0x03, 0xa0, 0x19,
+    0x4a, 0x2c, 0xca, 0x19, 0x20, 0x2c, 0x00, 0x1a, 0x20, 0x2c, 0x03, 0x36, 0x1a, 0x20, 0x2c, 0x60, 0x1a, 0x4a, 0x2c, 0x60, 0x1a, 0x80, 0x2c, 0x04,
+    0x06, 0x17, 0xc7, 0x7f, 0x80, 0x3f, 0x5d, 0xe2, 0x4f, 0x45, 0x61, 0xe1, 0x53, 0x09, 0x00, 0x07, 0x40, 0x5d, 0xe3, 0x4f, 0x03, 0x04, 0xfd, 0x03,
+    0x06, 0x02, 0xc6, 0x80, 0x7f, 0xbb, 0x3c, 0x7f, 0x4a, 0x81, 0x3e, 0x3e, 0x4c, 0x09, 0x00, 0x07, 0xbd, 0x3c, 0x80, 0x4a, 0xc3, 0x01, 0xbd, 0x01,
+    0x06, 0x24, 0xc7, 0x80, 0x80, 0xdf, 0x2f, 0x5f, 0x52, 0xa1, 0x32, 0x21, 0x55, 0x09, 0x00, 0x07, 0xe0, 0x2f, 0x60, 0x52, 0xc0, 0x02, 0xc0, 0x02,
+    0x06, 0x30, 0xc8, 0x80, 0x80, 0xa0, 0x57, 0x60, 0x2f, 0x23, 0x5e, 0xe0, 0x35, 0x09, 0x00, 0x07, 0xa2, 0x57, 0x62, 0x2f, 0x80, 0x06, 0x7d, 0x06,
+    0x06, 0x1b, 0xc7, 0x80, 0x80, 0x7d, 0x41, 0x80, 0x42, 0x83, 0x44, 0x80, 0x45, 0x09, 0x00, 0x07, 0x7e, 0x41, 0x82, 0x42, 0x03, 0x03, 0xfd, 0x02,
+    0x06, 0x2e, 0xc2, 0x80, 0x80, 0x9f, 0x40, 0x3f, 0x3c, 0x21, 0x41, 0xc1, 0x3c, 0x09, 0x00, 0x07, 0xa0, 0x40, 0x40, 0x3c, 0x80, 0x00, 0x80, 0x00,
+    0x06, 0x07, 0xc7, 0x80, 0x7f, 0xff, 0x33, 0xbf, 0x38, 0x81, 0x36, 0x41, 0x3b, 0x09, 0x00, 0x07, 0x00, 0x34, 0xc0, 0x38, 0x80, 0x02, 0x80, 0x02,
+    0x06, 0x1b, 0xc7, 0x80, 0x80, 0xff, 0x31, 0x3f, 0x2c, 0x01, 0x34, 0x41, 0x2e, 0x09, 0x00, 0x07, 0x00, 0x32, 0x40, 0x2c, 0x00, 0x02, 0x00, 0x02,
+    0x01, 0x03, 0x5e, 0x00, 0xde, 0x47, 0x04, 0xe0, 0x06, 0x06, 0x20, 0xc5, 0x80, 0x80, 0x5d, 0xff, 0x60, 0xff, 0xa3, 0x00, 0xa0, 0x00, 0x09, 0x00,
+    0x07, 0x5e, 0xff, 0x62, 0xff, 0x43, 0x01, 0x3d, 0x01, 0x02, 0x06, 0x03, 0xc5, 0x80, 0x80, 0x3f, 0x4d, 0xff, 0x51, 0x01, 0x4e, 0xc1, 0x52, 0x3a,
+    0x00, 0x01, 0x00, 0x4e, 0x60, 0x52, 0x03, 0x00, 0x4e, 0x96, 0x52, 0xd6, 0x4d, 0xc0, 0x52, 0xa0, 0x4d, 0xc0, 0x52, 0x03, 0x6a, 0x4d, 0xc0, 0x52,
+    0x40, 0x4d, 0x96, 0x52, 0x40, 0x4d, 0x60, 0x52, 0x03, 0x40, 0x4d, 0x2a, 0x52, 0x6a, 0x4d, 0x00, 0x52, 0xa0, 0x4d, 0x00, 0x52, 0x03, 0xd6, 0x4d,
+    0x00, 0x52, 0x00, 0x4e, 0x2a, 0x52, 0x00, 0x4e, 0x60, 0x52, 0x04, 0x06, 0x22, 0xc8, 0x80, 0x7f, 0xfb, 0x15, 0xdf, 0x01, 0x81, 0x1c, 0x5e, 0x08,
+    0x09, 0x00, 0x07, 0xfd, 0x15, 0xe0, 0x01, 0x83, 0x06, 0x7d, 0x06, 0x06, 0x18, 0xc2, 0x80, 0x80, 0xdf, 0x5d, 0x3f, 0x54, 0x61, 0x5e, 0xc1, 0x54,
+    0x09, 0x00, 0x07, 0xe0, 0x5d, 0x40, 0x54, 0x80, 0x00, 0x80, 0x00, 0x06, 0x1d, 0xc7, 0x80, 0x80, 0x3f, 0x27, 0x3f, 0x04, 0x01, 0x2b, 0x01, 0x08,
+    0x09, 0x00, 0x07, 0x40, 0x27, 0x40, 0x04, 0xc0, 0x03, 0xc0, 0x03, 0x06, 0x21, 0xc7, 0x80, 0x80, 0x1f, 0x0b, 0x9f, 0x2a, 0xe1, 0x0d, 0x61, 0x2d,
+    0x09, 0x00, 0x07, 0x20, 0x0b, 0xa0, 0x2a, 0xc0, 0x02, 0xc0, 0x02, 0x06, 0x1c, 0xc2, 0x80, 0x80, 0xdf, 0x14, 0xdf, 0x49, 0x61, 0x15, 0x61, 0x4a,
+    0x09, 0x00, 0x07, 0xe0, 0x14, 0xe0, 0x49, 0x80, 0x00, 0x80, 0x00, 0x06, 0x21, 0xc8, 0x80, 0x80, 0x7f, 0x4a, 0x7f, 0x47, 0xc1, 0x4f, 0xc1, 0x4c,
+    0x09, 0x00, 0x07, 0x80, 0x4a, 0x80, 0x47, 0x40, 0x05, 0x40, 0x05, 0x06, 0x1b, 0xc2, 0x80, 0x80, 0xff, 0x23, 0x5f, 0x37, 0x81, 0x24, 0xe1, 0x37,
+    0x09, 0x00, 0x07, 0x00, 0x24, 0x60, 0x37, 0x80, 0x00, 0x80, 0x00, 0x06, 0x12, 0xc8, 0x80, 0x80, 0x3f, 0x3f, 0xdf, 0xff, 0x81, 0x46, 0x21, 0x07,
+    0x09, 0x00, 0x07, 0x40, 0x3f, 0xe0, 0xff, 0x40, 0x07, 0x40, 0x07, 0x01, 0x03, 0xde, 0x06, 0xde, 0x44, 0x04, 0xe0, 0x06, 0x06, 0x26, 0xc5, 0x80,
+    0x80, 0x5d, 0xff, 0x60, 0xff, 0xa3, 0x00, 0xa0, 0x00, 0x09, 0x00, 0x07, 0x5e, 0xff, 0x62, 0xff, 0x43, 0x01, 0x3d, 0x01, 0x02, 0x06, 0x14, 0xc5,
+    0x80, 0x80, 0xff, 0x30, 0xdf, 0x46, 0xc1, 0x31, 0xa1, 0x47, 0x3a, 0x00, 0x01, 0xc0, 0x31, 0x40, 0x47, 0x03, 0xc0, 0x31, 0x76, 0x47, 0x96, 0x31,
+    0xa0, 0x47, 0x60, 0x31, 0xa0, 0x47, 0x03, 0x2a, 0x31, 0xa0, 0x47, 0x00, 0x31, 0x76, 0x47, 0x00, 0x31, 0x40, 0x47, 0x03, 0x00, 0x31, 0x0a, 0x47,
+    0x2a, 0x31, 0xe0, 0x46, 0x60, 0x31, 0xe0, 0x46, 0x03, 0x96, 0x31, 0xe0, 0x46, 0xc0, 0x31, 0x0a, 0x47, 0xc0, 0x31, 0x40, 0x47, 0x04, 0x06, 0x04,
+    0xc6, 0x80, 0x80, 0xff, 0x0d, 0x3f, 0x4e, 0x81, 0x0f, 0xc1, 0x4f, 0x09, 0x00, 0x07, 0x00, 0x0e, 0x40, 0x4e, 0x80, 0x01, 0x80, 0x01, 0x06, 0x0b,
+    0xc7, 0x80, 0x80, 0x3f, 0x4b, 0x3f, 0x46, 0x41, 0x4d, 0x41, 0x48, 0x09, 0x00, 0x07, 0x40, 0x4b, 0x40, 0x46, 0x00, 0x02, 0x00, 0x02, 0x06, 0x14,
+    0xc6, 0x80, 0x80, 0x7d, 0x1c, 0x00, 0x1b, 0xc3, 0x1e, 0x40, 0x1d, 0x09, 0x00, 0x07, 0x7e, 0x1c, 0x02, 0x1b, 0x43, 0x02, 0x3d, 0x02, 0x06, 0x1b,
+    0xc7, 0x80, 0x80, 0xff, 0x4a, 0x1f, 0x1b, 0x41, 0x4e, 0x61, 0x1e, 0x09, 0x00, 0x07, 0x00, 0x4b, 0x20, 0x1b, 0x40, 0x03, 0x40, 0x03, 0x06, 0x0b,
+    0xc6, 0x80, 0x7f, 0x9b, 0x23, 0x3f, 0x55, 0x61, 0x25, 0xfe, 0x56, 0x09, 0x00, 0x07, 0x9d, 0x23, 0x40, 0x55, 0xc3, 0x01, 0xbd, 0x01, 0x06, 0x2b,
+    0xc7, 0x80, 0x80, 0x1d, 0x42, 0x20, 0x4e, 0x23, 0x45, 0x20, 0x51, 0x09, 0x00, 0x07, 0x1e, 0x42, 0x22, 0x4e, 0x03, 0x03, 0xfd, 0x02, 0x06, 0x06,
+    0xc5, 0x80, 0x80, 0x1f, 0x2e, 0xff, 0x37, 0x21, 0x2f, 0x01, 0x39, 0x09, 0x00, 0x07, 0x20, 0x2e, 0x00, 0x38, 0x00, 0x01, 0x00, 0x01, 0x06, 0x30,
+    0xc2, 0x80, 0x80, 0xdf, 0x5e, 0x9f, 0x2d, 0x61, 0x5f, 0x21, 0x2e, 0x09, 0x00, 0x07, 0xe0, 0x5e, 0xa0, 0x2d, 0x80, 0x00, 0x80, 0x00, 0x06, 0x30,
+    0xc6, 0x80, 0x80, 0x9d, 0x27, 0x00, 0x27, 0xe3, 0x29, 0x40, 0x29, 0x09, 0x00, 0x07, 0x9e, 0x27, 0x02, 0x27, 0x43, 0x02, 0x3d, 0x02, 0x06, 0x2c,
+    0xc6, 0x80, 0x80, 0xff, 0x12, 0x7f, 0x4c, 0x81, 0x14, 0x01, 0x4e, 0x09, 0x00, 0x07, 0x00, 0x13, 0x80, 0x4c, 0x80, 0x01, 0x80, 0x01, 0x06, 0x1e,
+    0xc5, 0x7f, 0x7f, 0xdf, 0x4e, 0x7f, 0x43, 0xa1, 0x4f, 0x41, 0x44, 0x3a, 0x00, 0x01, 0xa0, 0x4f, 0xe0, 0x43, 0x03, 0xa0, 0x4f, 0x16, 0x44, 0x76,
+    0x4f, 0x40, 0x44, 0x40, 0x4f, 0x40, 0x44, 0x03, 0x0a, 0x4f, 0x40, 0x44, 0xe0, 0x4e, 0x16, 0x44, 0xe0, 0x4e, 0xe0, 0x43, 0x03, 0xe0, 0x4e, 0xaa,
+    0x43, 0x0a, 0x4f, 0x80, 0x43, 0x40, 0x4f, 0x80, 0x43, 0x03, 0x76, 0x4f, 0x80, 0x43, 0xa0, 0x4f, 0xaa, 0x43, 0xa0, 0x4f, 0xe0, 0x43, 0x04, 0x06,
+    0x1b, 0xc6, 0x80, 0x80, 0x9d, 0x0c, 0xa0, 0x36, 0xe3, 0x0e, 0xe0, 0x38, 0x09, 0x00, 0x07, 0x9e, 0x0c, 0xa2, 0x36, 0x43, 0x02, 0x3d, 0x02, 0x06,
+    0x1b, 0xc8, 0x80, 0x80, 0x5f, 0x5c, 0x5f, 0x09, 0x21, 0x63, 0x21, 0x10, 0x09, 0x00, 0x07, 0x60, 0x5c, 0x60, 0x09, 0xc0, 0x06, 0xc0, 0x06, 0x06,
+    0x1f, 0xc8, 0x80, 0x80, 0x9f, 0x59, 0xbf, 0x35, 0xe1, 0x5e, 0x01, 0x3b, 0x09, 0x00, 0x07, 0xa0, 0x59, 0xc0, 0x35, 0x40, 0x05, 0x40, 0x05, 0x06,
+    0x24, 0xc8, 0x80, 0x80, 0x00, 0x58, 0x00, 0x46, 0x83, 0x5e, 0x80, 0x4c, 0x09, 0x00, 0x07, 0x02, 0x58, 0x02, 0x46, 0x80, 0x06, 0x7d, 0x06, 0x06,
+    0x1b, 0xc7, 0x80, 0x80, 0x5f, 0x5d, 0x5f, 0x28, 0x21, 0x61, 0x21, 0x2c, 0x09, 0x00, 0x07, 0x60, 0x5d, 0x60, 0x28, 0xc0, 0x03, 0xc0, 0x03, 0x01,
+    0x03, 0xde, 0x3f, 0xfe, 0x52, 0x04, 0xe0, 0x06, 0x06, 0x0c, 0xc5, 0x80, 0x80, 0x5d, 0xff, 0x60, 0xff, 0xa3, 0x00, 0xa0, 0x00, 0x09, 0x00, 0x07,
+    0x5e, 0xff, 0x62, 0xff, 0x43, 0x01, 0x3d, 0x01, 0x02, 0x06, 0x1b, 0xc8, 0x80, 0x80, 0xbf, 0xfd, 0x5f, 0x03, 0x81, 0x04, 0x21, 0x0a, 0x09, 0x00,
+    0x07, 0xc0, 0xfd, 0x60, 0x03, 0xc0, 0x06, 0xc0, 0x06, 0x06, 0x25, 0xc7, 0x80, 0x80, 0x7f, 0x03, 0x9f, 0x4d, 0x01, 0x06, 0x21, 0x50, 0x09, 0x00,
+    0x07, 0x80, 0x03, 0xa0, 0x4d, 0x80, 0x02, 0x80, 0x02, 0x06, 0x12, 0xc7, 0x80, 0x80, 0xbf, 0x06, 0xff, 0x4c, 0x01, 0x0a, 0x41, 0x50, 0x09, 0x00,
+    0x07, 0xc0, 0x06, 0x00, 0x4d, 0x40, 0x03, 0x40, 0x03, 0x06, 0x15, 0xc7, 0x80, 0x80, 0x1f, 0x5d, 0x9f, 0x18, 0x21, 0x5f, 0xa1, 0x1a, 0x09, 0x00,
+    0x07, 0x20, 0x5d, 0xa0, 0x18, 0x00, 0x02, 0x00, 0x02, 0x06, 0x23, 0xc5, 0x80, 0x80, 0x7f, 0x13, 0xbf, 0x40, 0x81, 0x14, 0xc1, 0x41, 0x09, 0x00,
+    0x07, 0x80, 0x13, 0xc0, 0x40, 0x00, 0x01, 0x00, 0x01, 0x06, 0x0b, 0xc8, 0x80, 0x80, 0x5f, 0x5b, 0x3f, 0x04, 0x21, 0x60, 0x01, 0x09, 0x09, 0x00,
+    0x07, 0x60, 0x5b, 0x40, 0x04, 0xc0, 0x04, 0xc0, 0x04, 0x06, 0x1a, 0xc6, 0x80, 0x80, 0xbf, 0xff, 0x1f, 0x2d, 0x41, 0x01, 0xa1, 0x2e, 0x09, 0x00,
+    0x07, 0xc0, 0xff, 0x20, 0x2d, 0x80, 0x01, 0x80, 0x01, 0x06, 0x26, 0xc7, 0x80, 0x80, 0xbf, 0x51, 0xbf, 0x25, 0x01, 0x55, 0x01, 0x29, 0x09, 0x00,
+    0x07, 0xc0, 0x51, 0xc0, 0x25, 0x40, 0x03, 0x40, 0x03, 0x06, 0x24, 0xc7, 0x7f, 0x80, 0x9f, 0x40, 0xc2, 0x4b, 0xa5, 0x44, 0xc1, 0x4f, 0x09, 0x00,
+    0x07, 0xa0, 0x40, 0xc3, 0x4b, 0x03, 0x04, 0xfd, 0x03, 0x06, 0x30, 0xc7, 0x7f, 0x80, 0xdf, 0x0c, 0xbf, 0x50, 0xa1, 0x0f, 0x81, 0x53, 0x09, 0x00,
+    0x07, 0xe0, 0x0c, 0xc0, 0x50, 0xc0, 0x02, 0xc0, 0x02, 0x06, 0x1b, 0xc7, 0x80, 0x80, 0x1f, 0x11, 0xbf, 0xff, 0xa1, 0x13, 0x41, 0x02, 0x09, 0x00,
+    0x07, 0x20, 0x11, 0xc0, 0xff, 0x80, 0x02, 0x80, 0x02, 0x06, 0x0a, 0xc7, 0x7f, 0x80, 0xff, 0x04, 0x42, 0x20, 0x05, 0x09, 0x41, 0x24, 0x09, 0x00,
+    0x07, 0x00, 0x05, 0x43, 0x20, 0x03, 0x04, 0xfd, 0x03, 0x06, 0x1b, 0xc5, 0x7f, 0x7f, 0x7f, 0x13, 0xdf, 0x05, 0x41, 0x14, 0xa1, 0x06, 0x3a, 0x00,
+    0x01, 0x40, 0x14, 0x40, 0x06, 0x03, 0x40, 0x14, 0x76, 0x06, 0x16, 0x14, 0xa0, 0x06, 0xe0, 0x13, 0xa0, 0x06, 0x03, 0xaa, 0x13, 0xa0, 0x06, 0x80,
+    0x13, 0x76, 0x06, 0x80, 0x13, 0x40, 0x06, 0x03, 0x80, 0x13, 0x0a, 0x06, 0xaa, 0x13, 0xe0, 0x05, 0xe0, 0x13, 0xe0, 0x05, 0x03, 0x16, 0x14, 0xe0,
+    0x05, 0x40, 0x14, 0x0a, 0x06, 0x40, 0x14, 0x40, 0x06, 0x04, 0x06, 0x30, 0xc8, 0x80, 0x80, 0x5f, 0x46, 0x1f, 0x08, 0xe1, 0x4c, 0xa1, 0x0e, 0x09,
+    0x00, 0x07, 0x60, 0x46, 0x20, 0x08, 0x80, 0x06, 0x80, 0x06, 0x06, 0x1b, 0xc5, 0x80, 0x7f, 0x5f, 0x56, 0x1f, 0x18, 0x61, 0x57, 0x21, 0x19, 0x09,
+    0x00, 0x07, 0x60, 0x56, 0x20, 0x18, 0x00, 0x01, 0x00, 0x01, 0x06, 0x17, 0xc7, 0x80, 0x80, 0x3f, 0x0a, 0x1f, 0x59, 0x81, 0x0d, 0x61, 0x5c, 0x09,
+    0x00, 0x07, 0x40, 0x0a, 0x20, 0x59, 0x40, 0x03, 0x40, 0x03, 0x06, 0x24, 0xc2, 0x80, 0x80, 0x7f, 0x45, 0x9f, 0x20, 0x01, 0x46, 0x21, 0x21, 0x09,
+    0x00, 0x07, 0x80, 0x45, 0xa0, 0x20, 0x80, 0x00, 0x80, 0x00, 0x06, 0x0e, 0xc8, 0x7f, 0x80, 0xbf, 0x00, 0x7f, 0x5a, 0x01, 0x05, 0xc1, 0x5e, 0x09,
+    0x00, 0x07, 0xc0, 0x00, 0x80, 0x5a, 0x40, 0x04, 0x40, 0x04, 0x06, 0x0b, 0xc8, 0x80, 0x80, 0x1f, 0x57, 0x5f, 0x09, 0xa1, 0x5c, 0xe1, 0x0e, 0x09,
+    0x00, 0x07, 0x20, 0x57, 0x60, 0x09, 0x80, 0x05, 0x80, 0x05, 0x06, 0x1a, 0xc7, 0x80, 0x80, 0xbd, 0x3e, 0xe0, 0x46, 0xc3, 0x41, 0xe0, 0x49, 0x09,
+    0x00, 0x07, 0xbe, 0x3e, 0xe2, 0x46, 0x03, 0x03, 0xfd, 0x02, 0x06, 0x1b, 0xc2, 0x80, 0x80, 0x3f, 0x59, 0x3f, 0x1c, 0xc1, 0x59, 0xc1, 0x1c, 0x09,
+    0x00, 0x07, 0x40, 0x59, 0x40, 0x1c, 0x80, 0x00, 0x80, 0x00, 0x06, 0x02, 0xc2, 0x80, 0x80, 0x1f, 0x1c, 0xff, 0x46, 0xa1, 0x1c, 0x81, 0x47, 0x09,
+    0x00, 0x07, 0x20, 0x1c, 0x00, 0x47, 0x80, 0x00, 0x80, 0x00, 0x01, 0x03, 0xfe, 0x2a, 0x7e, 0x3d, 0x04, 0xe0, 0x06, 0x06, 0x04, 0xc5, 0x80, 0x80,
+    0x5d, 0xff, 0x60, 0xff, 0xa3, 0x00, 0xa0, 0x00, 0x09, 0x00, 0x07, 0x5e, 0xff, 0x62, 0xff, 0x43, 0x01, 0x3d, 0x01, 0x02, 0x06, 0x28, 0xc6, 0x80,
+    0x80, 0xfd, 0x3d, 0xa0, 0x31, 0x43, 0x40, 0xe0, 0x33, 0x09, 0x00, 0x07, 0xfe, 0x3d, 0xa2, 0x31, 0x43, 0x02, 0x3d, 0x02, 0x06, 0x06, 0xc6, 0x80,
+    0x80, 0x1f, 0x35, 0x9f, 0x12, 0xa1, 0x36, 0x21, 0x14, 0x09, 0x00, 0x07, 0x20, 0x35, 0xa0, 0x12, 0x80, 0x01, 0x80, 0x01, 0x01, 0x03, 0x7e, 0x43,
+    0x7e, 0x27, 0x04, 0xe0, 0x06, 0x06, 0x1b, 0xc5, 0x80, 0x80, 0x5d, 0xff, 0x60, 0xff, 0xa3, 0x00, 0xa0, 0x00, 0x09, 0x00, 0x07, 0x5e, 0xff, 0x62,
+    0xff, 0x43, 0x01, 0x3d, 0x01, 0x02, 0x06, 0x30, 0xc7, 0x80, 0x80, 0xfd, 0x2f, 0x60, 0x1f, 0x03, 0x33, 0x60, 0x22, 0x09, 0x00, 0x07, 0xfe, 0x2f,
+    0x62, 0x1f, 0x03, 0x03, 0xfd, 0x02, 0x06, 0x26, 0xc2, 0x80, 0x80, 0xff, 0x3b, 0xff, 0x3a, 0x81, 0x3c, 0x81, 0x3b, 0x09, 0x00, 0x07, 0x00, 0x3c,
+    0x00, 0x3b, 0x80, 0x00, 0x80, 0x00, 0x06, 0x1b, 0xc6, 0x80, 0x80, 0x7d, 0x44, 0xa0, 0x4c, 0xc3, 0x46, 0xe0, 0x4e, 0x09, 0x00, 0x07, 0x7e, 0x44,
+    0xa2, 0x4c, 0x43, 0x02, 0x3d, 0x02, 0x06, 0x1d, 0xc7, 0x80, 0x80, 0x7f, 0x2b, 0xff, 0x20, 0x41, 0x2f, 0xc1, 0x24, 0x09, 0x00, 0x07, 0x80, 0x2b,
+    0x00, 0x21, 0xc0, 0x03, 0xc0, 0x03, 0x06, 0x30, 0xc7, 0x7f, 0x80, 0x5f, 0x5d, 0xc2, 0x03, 0x65, 0x62, 0xc1, 0x08, 0x09, 0x00, 0x07, 0x60, 0x5d,
+    0xc3, 0x03, 0x03, 0x05, 0xfd, 0x04, 0x06, 0x06, 0xc7, 0x80, 0x80, 0xff, 0x15, 0xff, 0x09, 0x41, 0x19, 0x41, 0x0d, 0x09, 0x00, 0x07, 0x00, 0x16,
+    0x00, 0x0a, 0x40, 0x03, 0x40, 0x03, 0x06, 0x1b, 0xc6, 0x80, 0x80, 0x1f, 0x14, 0x9f, 0x19, 0xa1, 0x15, 0x21, 0x1b, 0x09, 0x00, 0x07, 0x20, 0x14,
+    0xa0, 0x19, 0x80, 0x01, 0x80, 0x01, 0x06, 0x19, 0xc6, 0x80, 0x80, 0x3d, 0x00, 0x60, 0x17, 0x83, 0x02, 0xa0, 0x19, 0x09, 0x00, 0x07, 0x3e, 0x00,
+    0x62, 0x17, 0x43, 0x02, 0x3d, 0x02, 0x06, 0x25, 0xc6, 0x80, 0x80, 0xbd, 0x03, 0xa0, 0x3e, 0x03, 0x06, 0xe0, 0x40, 0x09, 0x00, 0x07, 0xbe, 0x03,
+    0xa2, 0x3e, 0x43, 0x02, 0x3d, 0x02, 0x06, 0x1a, 0xc7, 0x80, 0x80, 0xdf, 0x15, 0xbf, 0x00, 0xe1, 0x17, 0xc1, 0x02, 0x09, 0x00, 0x07, 0xe0, 0x15,
+    0xc0, 0x00, 0x00, 0x02, 0x00, 0x02, 0x06, 0x16, 0xc8, 0x80, 0x7f, 0x3b, 0x14, 0xdf, 0x04, 0x41, 0x1a, 0xde, 0x0a, 0x09, 0x00, 0x07, 0x3d, 0x14,
+    0xe0, 0x04, 0x03, 0x06, 0xfd, 0x05, 0x01, 0x03, 0x1e, 0x2b, 0x1e, 0x45, 0x04, 0xe0, 0x06, 0x06, 0x19, 0xc5, 0x80, 0x80, 0x5d, 0xff, 0x60, 0xff,
+    0xa3, 0x00, 0xa0, 0x00, 0x09, 0x00, 0x07, 0x5e, 0xff, 0x62, 0xff, 0x43, 0x01, 0x3d, 0x01, 0x02, 0x06, 0x28, 0xc8, 0x80, 0x80, 0x1f, 0x49, 0xbf,
+    0x5c, 0xe1, 0x4d, 0x81, 0x61, 0x09, 0x00, 0x07, 0x20, 0x49, 0xc0, 0x5c, 0xc0, 0x04, 0xc0, 0x04, 0x06, 0x31, 0xc7, 0x80, 0x80, 0xbd, 0x51, 0x00,
+    0x04, 0xc3, 0x54, 0x00, 0x07, 0x09, 0x00, 0x07, 0xbe, 0x51, 0x02, 0x04, 0x03, 0x03, 0xfd, 0x02, 0x06, 0x0e, 0xc6, 0x80, 0x7f, 0xfb, 0x3f, 0x3f,
+    0x5e, 0xc1, 0x41, 0xfe, 0x5f, 0x09, 0x00, 0x07, 0xfd, 0x3f, 0x40, 0x5e, 0xc3, 0x01, 0xbd, 0x01, 0x06, 0x15, 0xc8, 0x80, 0x80, 0x5f, 0x57, 0x7f,
+    0x37, 0x61, 0x5d, 0x81, 0x3d, 0x09, 0x00, 0x07, 0x60, 0x57, 0x80, 0x37, 0x00, 0x06, 0x00, 0x06, 0x06, 0x1b, 0xc8, 0x80, 0x80, 0xbf, 0x3d, 0x5f,
+    0x0b, 0xc1, 0x43, 0x61, 0x11, 0x09, 0x00, 0x07, 0xc0, 0x3d, 0x60, 0x0b, 0x00, 0x06, 0x00, 0x06, 0x06, 0x1b, 0xc5, 0x7f, 0x7f, 0x3f, 0x25, 0x9f,
+    0x52, 0x01, 0x26, 0x61, 0x53, 0x3a, 0x00, 0x01, 0x00, 0x26, 0x00, 0x53, 0x03, 0x00, 0x26, 0x36, 0x53, 0xd6, 0x25, 0x60, 0x53, 0xa0, 0x25, 0x60,
+    0x53, 0x03, 0x6a, 0x25, 0x60, 0x53, 0x40, 0x25, 0x36, 0x53, 0x40, 0x25, 0x00, 0x53, 0x03, 0x40, 0x25, 0xca, 0x52, 0x6a, 0x25, 0xa0, 0x52, 0xa0,
+    0x25, 0xa0, 0x52, 0x03, 0xd6, 0x25, 0xa0, 0x52, 0x00, 0x26, 0xca, 0x52, 0x00, 0x26, 0x00, 0x53, 0x04, 0x06, 0x06, 0xc7, 0x80, 0x80, 0x7d, 0x5a,
+    0xc0, 0x3b, 0x03, 0x5e, 0x40, 0x3f, 0x09, 0x00, 0x07, 0x7e, 0x5a, 0xc2, 0x3b, 0x83, 0x03, 0x7d, 0x03, 0x01, 0x03, 0x1e, 0x28, 0x3e, 0x2d, 0x04,
+    0xe0, 0x06, 0x06, 0x00, 0xc5, 0x80, 0x80, 0x5d, 0xff, 0x60, 0xff, 0xa3, 0x00, 0xa0, 0x00, 0x09, 0x00, 0x07, 0x5e, 0xff, 0x62, 0xff, 0x43, 0x01,
+    0x3d, 0x01, 0x02, 0x06, 0x11, 0xc5, 0x80, 0x80, 0x5f, 0x1c, 0xbf, 0x4a, 0x21, 0x1d, 0x81, 0x4b, 0x3a, 0x00, 0x01, 0x20, 0x1d, 0x20, 0x4b, 0x03,
+    0x20, 0x1d, 0x56, 0x4b, 0xf6, 0x1c, 0x80, 0x4b, 0xc0, 0x1c, 0x80, 0x4b, 0x03, 0x8a, 0x1c, 0x80, 0x4b, 0x60, 0x1c, 0x56, 0x4b, 0x60, 0x1c, 0x20,
+    0x4b, 0x03, 0x60, 0x1c, 0xea, 0x4a, 0x8a, 0x1c, 0xc0, 0x4a, 0xc0, 0x1c, 0xc0, 0x4a, 0x03, 0xf6, 0x1c, 0xc0, 0x4a, 0x20, 0x1d, 0xea, 0x4a, 0x20,
+    0x1d, 0x20, 0x4b, 0x04, 0x01, 0x03, 0x9e, 0x00, 0x7e, 0x16, 0x04, 0xe0, 0x06, 0x06, 0x1b, 0xc5, 0x80, 0x80, 0x5d, 0xff, 0x60, 0xff, 0xa3, 0x00,
+    0xa0, 0x00, 0x09, 0x00, 0x07, 0x5e, 0xff, 0x62, 0xff, 0x43, 0x01, 0x3d, 0x01, 0x02, 0x06, 0x1c, 0xc7, 0x80, 0x80, 0x1f, 0x29, 0x3f, 0x31, 0x21,
+    0x2b, 0x41, 0x33, 0x09, 0x00, 0x07, 0x20, 0x29, 0x40, 0x31, 0x00, 0x02, 0x00, 0x02, 0x06, 0x17, 0xc7, 0x80, 0x80, 0x3f, 0x0b, 0x1f, 0x56, 0x01,
+    0x0f, 0xe1, 0x59, 0x09, 0x00, 0x07, 0x40, 0x0b, 0x20, 0x56, 0xc0, 0x03, 0xc0, 0x03, 0x06, 0x08, 0xc7, 0x7f, 0x80, 0x1f, 0x57, 0xa2, 0x15, 0xa5,
+    0x5b, 0x21, 0x1a, 0x09, 0x00, 0x07, 0x20, 0x57, 0xa3, 0x15, 0x83, 0x04, 0x7d, 0x04, 0x06, 0x26, 0xc7, 0x7f, 0x80, 0xdf, 0x35, 0xdf, 0x46, 0x61,
+    0x38, 0x61, 0x49, 0x09, 0x00, 0x07, 0xe0, 0x35, 0xe0, 0x46, 0x80, 0x02, 0x80, 0x02, 0x06, 0x16, 0xc7, 0x80, 0x80, 0x7f, 0x12, 0xbf, 0x54, 0x81,
+    0x14, 0xc1, 0x56, 0x09, 0x00, 0x07, 0x80, 0x12, 0xc0, 0x54, 0x00, 0x02, 0x00, 0x02, 0x06, 0x1b, 0xc7, 0x80, 0x80, 0xdf, 0x21, 0x5f, 0x53, 0xe1,
+    0x23, 0x61, 0x55, 0x09, 0x00, 0x07, 0xe0, 0x21, 0x60, 0x53, 0x00, 0x02, 0x00, 0x02, 0x06, 0x24, 0xc6, 0x80, 0x80, 0x3f, 0x04, 0x9f, 0x2f, 0xc1,
+    0x05, 0x21, 0x31, 0x09, 0x00, 0x07, 0x40, 0x04, 0xa0, 0x2f, 0x80, 0x01, 0x80, 0x01, 0x06, 0x1a, 0xc8, 0x80, 0x80, 0x9f, 0x43, 0xdf, 0x5b, 0xe1,
+    0x47, 0x21, 0x60, 0x09, 0x00, 0x07, 0xa0, 0x43, 0xe0, 0x5b, 0x40, 0x04, 0x40, 0x04, 0x06, 0x1b, 0xc7, 0x80, 0x80, 0x1f, 0x23, 0x1f, 0x07, 0x61,
+    0x26, 0x61, 0x0a, 0x09, 0x00, 0x07, 0x20, 0x23, 0x20, 0x07, 0x40, 0x03, 0x40, 0x03, 0x06, 0x19, 0xc8, 0x80, 0x80, 0x3f, 0x2e, 0x9f, 0x08, 0x81,
+    0x34, 0xe1, 0x0e, 0x09, 0x00, 0x07, 0x40, 0x2e, 0xa0, 0x08, 0x40, 0x06, 0x40, 0x06, 0x06, 0x19, 0xc8, 0x7f, 0x80, 0xdf, 0x59, 0x7f, 0x01, 0x21,
+    0x5e, 0xc1, 0x05, 0x09, 0x00, 0x07, 0xe0, 0x59, 0x80, 0x01, 0x40, 0x04, 0x40, 0x04, 0x06, 0x1e, 0xc2, 0x80, 0x80, 0x1f, 0x17, 0x5f, 0x44, 0xa1,
+    0x17, 0xe1, 0x44, 0x09, 0x00, 0x07, 0x20, 0x17, 0x60, 0x44, 0x80, 0x00, 0x80, 0x00, 0x06, 0x17, 0xc7, 0x7f, 0x80, 0xff, 0x47, 0x22, 0x3a, 0x05,
+    0x4c, 0x21, 0x3e, 0x09, 0x00, 0x07, 0x00, 0x48, 0x23, 0x3a, 0x03, 0x04, 0xfd, 0x03, 0x06, 0x1b, 0xc7, 0x80, 0x80, 0xbd, 0x44, 0x80, 0x43, 0x43,
+    0x48, 0x00, 0x47, 0x09, 0x00, 0x07, 0xbe, 0x44, 0x82, 0x43, 0x83, 0x03, 0x7d, 0x03, 0x06, 0x1b, 0xc5, 0x80, 0x80, 0x5f, 0x5a, 0x9f, 0xff, 0x61,
+    0x5b, 0xa1, 0x00, 0x09, 0x00, 0x07, 0x60, 0x5a, 0xa0, 0xff, 0x00, 0x01, 0x00, 0x01, 0x06, 0x17, 0xc5, 0x80, 0x80, 0x9f, 0x1e, 0xbf, 0x45, 0x61,
+    0x1f, 0x81, 0x46, 0x3a, 0x00, 0x01, 0x60, 0x1f, 0x20, 0x46, 0x03, 0x60, 0x1f, 0x56, 0x46, 0x36, 0x1f, 0x80, 0x46, 0x00, 0x1f, 0x80, 0x46, 0x03,
+    0xca, 0x1e, 0x80, 0x46, 0xa0, 0x1e, 0x56, 0x46, 0xa0, 0x1e, 0x20, 0x46, 0x03, 0xa0, 0x1e, 0xea, 0x45, 0xca, 0x1e, 0xc0, 0x45, 0x00, 0x1f, 0xc0,
+    0x45, 0x03, 0x36, 0x1f, 0xc0, 0x45, 0x60, 0x1f, 0xea, 0x45, 0x60, 0x1f, 0x20, 0x46, 0x04, 0x06, 0x1b, 0xc5, 0x80, 0x80, 0xdf, 0x05, 0x9f, 0x24,
+    0xe1, 0x06, 0xa1, 0x25, 0x09, 0x00, 0x07, 0xe0, 0x05, 0xa0, 0x24, 0x00, 0x01, 0x00, 0x01, 0x06, 0x2a, 0xc7, 0x80, 0x80, 0x7f, 0x3f, 0x1f, 0x2d,
+    0x01, 0x42, 0xa1, 0x2f, 0x09, 0x00, 0x07, 0x80, 0x3f, 0x20, 0x2d, 0x80, 0x02, 0x80, 0x02, 0x06, 0x0d, 0xc2, 0x80, 0x80, 0xdf, 0x22, 0x9f, 0x3c,
+    0x61, 0x23, 0x21, 0x3d, 0x09, 0x00, 0x07, 0xe0, 0x22, 0xa0, 0x3c, 0x80, 0x00, 0x80, 0x00, 0x06, 0x20, 0xc8, 0x80, 0x80, 0x3f, 0x4d, 0xff, 0x01,
+    0x01, 0x53, 0xc1, 0x07, 0x09, 0x00, 0x07, 0x40, 0x4d, 0x00, 0x02, 0xc0, 0x05, 0xc0, 0x05, 0x06, 0x1b, 0xc7, 0x80, 0x80, 0xbd, 0x0c, 0x00, 0x15,
+    0x43, 0x10, 0x80, 0x18, 0x09, 0x00, 0x07, 0xbe, 0x0c, 0x02, 0x15, 0x83, 0x03, 0x7d, 0x03, 0x06, 0x19, 0xc6, 0x7f, 0x80, 0x7f, 0x0a, 0x3f, 0x36,
+    0x01, 0x0c, 0xc1, 0x37, 0x09, 0x00, 0x07, 0x80, 0x0a, 0x40, 0x36, 0x80, 0x01, 0x80, 0x01, 0x06, 0x05, 0xc6, 0x80, 0x7f, 0xbb, 0x4e, 0x9f, 0x2f,
+    0x81, 0x50, 0x5e, 0x31, 0x09, 0x00, 0x07, 0xbd, 0x4e, 0xa0, 0x2f, 0xc3, 0x01, 0xbd, 0x01, 0x06, 0x1b, 0xc7, 0x80, 0x80, 0xdf, 0x13, 0x9f, 0x5e,
+    0x61, 0x16, 0x21, 0x61, 0x09, 0x00, 0x07, 0xe0, 0x13, 0xa0, 0x5e, 0x80, 0x02, 0x80, 0x02, 0x01, 0x03, 0x7e, 0x1e, 0xfe, 0x5b, 0x04, 0xe0, 0x06,
+    0x06, 0x15, 0xc5, 0x80, 0x80, 0x5d, 0xff, 0x60, 0xff, 0xa3, 0x00, 0xa0, 0x00, 0x09, 0x00, 0x07, 0x5e, 0xff, 0x62, 0xff, 0x43, 0x01, 0x3d, 0x01,
+    0x02, 0x06, 0x1b, 0xc6, 0x80, 0x80, 0x9f, 0x2a, 0xff, 0x35, 0x21, 0x2c, 0x81, 0x37, 0x09, 0x00, 0x07, 0xa0, 0x2a, 0x00, 0x36, 0x80, 0x01, 0x80,
+    0x01, 0x06, 0x1b, 0xc7, 0x80, 0x80, 0xdf, 0x29, 0x5f, 0x23, 0xe1, 0x2b, 0x61, 0x25, 0x09, 0x00, 0x07, 0xe0, 0x29, 0x60, 0x23, 0x00, 0x02, 0x00,
+    0x02, 0x06, 0x15, 0xc5, 0x80, 0x80, 0x1f, 0x52, 0x9f, 0x07, 0xe1, 0x52, 0x61, 0x08, 0x3a, 0x00, 0x01, 0xe0, 0x52, 0x00, 0x08, 0x03, 0xe0, 0x52,
+    0x36, 0x08, 0xb6, 0x52, 0x60, 0x08, 0x80, 0x52, 0x60, 0x08, 0x03, 0x4a, 0x52, 0x60, 0x08, 0x20, 0x52, 0x36, 0x08, 0x20, 0x52, 0x00, 0x08, 0x03,
+    0x20, 0x52, 0xca, 0x07, 0x4a, 0x52, 0xa0, 0x07, 0x80, 0x52, 0xa0, 0x07, 0x03, 0xb6, 0x52, 0xa0, 0x07, 0xe0, 0x52, 0xca, 0x07, 0xe0, 0x52, 0x00,
+    0x08, 0x04, 0x06, 0x29, 0xc7, 0x80, 0x80, 0xbf, 0x1d, 0xff, 0x03, 0x81, 0x20, 0xc1, 0x06, 0x09, 0x00, 0x07, 0xc0, 0x1d, 0x00, 0x04, 0xc0, 0x02,
+    0xc0, 0x02, 0x06, 0x16, 0xc7, 0x7f, 0x80, 0x9f, 0x50, 0xc2, 0x18, 0x25, 0x55, 0x41, 0x1d, 0x09, 0x00, 0x07, 0xa0, 0x50, 0xc3, 0x18, 0x83, 0x04,
+    0x7d, 0x04, 0x06, 0x1b, 0xc8, 0x7f, 0x80, 0x9f, 0x5b, 0xbf, 0x21, 0x21, 0x61, 0x41, 0x27, 0x09, 0x00, 0x07, 0xa0, 0x5b, 0xc0, 0x21, 0x80, 0x05,
+    0x80, 0x05, 0x06, 0x06, 0xc7, 0x7f, 0x80, 0xff, 0x0d, 0x3f, 0x31, 0x01, 0x10, 0x41, 0x33, 0x09, 0x00, 0x07, 0x00, 0x0e, 0x40, 0x31, 0x00, 0x02,
+    0x00, 0x02, 0x06, 0x1c, 0xc2, 0x80, 0x80, 0x7f, 0x19, 0x9f, 0x36, 0x01, 0x1a, 0x21, 0x37, 0x09, 0x00, 0x07, 0x80, 0x19, 0xa0, 0x36, 0x80, 0x00,
+    0x80, 0x00, 0x06, 0x1b, 0xc7, 0x80, 0x80, 0xbd, 0x1c, 0x80, 0x0e, 0xc3, 0x1f, 0x80, 0x11, 0x09, 0x00, 0x07, 0xbe, 0x1c, 0x82, 0x0e, 0x03, 0x03,
+    0xfd, 0x02, 0x06, 0x30, 0xc7, 0x80, 0x80, 0xff, 0x08, 0xdf, 0x3c, 0x81, 0x0b, 0x61, 0x3f, 0x09, 0x00, 0x07, 0x00, 0x09, 0xe0, 0x3c, 0x80, 0x02,
+    0x80, 0x02, 0x06, 0x30, 0xc8, 0x80, 0x80, 0x3f, 0x35, 0xdf, 0x5c, 0x81, 0x39, 0x21, 0x61, 0x09, 0x00, 0x07, 0x40, 0x35, 0xe0, 0x5c, 0x40, 0x04,
+    0x40, 0x04, 0x06, 0x1b, 0xc7, 0x7f, 0x80, 0xbf, 0x4a, 0x02, 0x09, 0xc5, 0x4e, 0x01, 0x0d, 0x09, 0x00, 0x07, 0xc0, 0x4a, 0x03, 0x09, 0x03, 0x04,
+    0xfd, 0x03, 0x06, 0x14, 0xc7, 0x80, 0x80, 0x9f, 0x35, 0x5f, 0x25, 0xa1, 0x37, 0x61, 0x27, 0x09, 0x00, 0x07, 0xa0, 0x35, 0x60, 0x25, 0x00, 0x02,
+    0x00, 0x02, 0x06, 0x0d, 0xc8, 0x80, 0x7f, 0x1f, 0x43, 0x9f, 0x09, 0x61, 0x4a, 0xe1, 0x10, 0x09, 0x00, 0x07, 0x20, 0x43, 0xa0, 0x09, 0x40, 0x07,
+    0x40, 0x07, 0x06, 0x1b, 0xc7, 0x80, 0x80, 0x9d, 0x19, 0x40, 0x1a, 0xa3, 0x1c, 0x40, 0x1d, 0x09, 0x00, 0x07, 0x9e, 0x19, 0x42, 0x1a, 0x03, 0x03,
+    0xfd, 0x02, 0x06, 0x2f, 0xc7, 0x80, 0x80, 0x9d, 0x34, 0x20, 0x4b, 0xa3, 0x37, 0x20, 0x4e, 0x09, 0x00, 0x07, 0x9e, 0x34, 0x22, 0x4b, 0x03, 0x03,
+    0xfd, 0x02, 0x06, 0x15, 0xc8, 0x80, 0x80, 0x9f, 0x3b, 0x1f, 0x0c, 0x21, 0x42, 0xa1, 0x12, 0x09, 0x00, 0x07, 0xa0, 0x3b, 0x20, 0x0c, 0x80, 0x06,
+    0x80, 0x06, 0x06, 0x1b, 0xc7, 0x80, 0x80, 0xdf, 0x10, 0xdf, 0x10, 0x61, 0x13, 0x61, 0x13, 0x09, 0x00, 0x07, 0xe0, 0x10, 0xe0, 0x10, 0x80, 0x02,
+    0x80, 0x02, 0x06, 0x17, 0xc6, 0x80, 0x80, 0x7f, 0x1f, 0x5f, 0x59, 0x01, 0x21, 0xe1, 0x5a, 0x09, 0x00, 0x07, 0x80, 0x1f, 0x60, 0x59, 0x80, 0x01,
+    0x80, 0x01, 0x06, 0x1d, 0xc6, 0x80, 0x7f, 0x9b, 0x38, 0x7f, 0x0f, 0x61, 0x3a, 0x3e, 0x11, 0x09, 0x00, 0x07, 0x9d, 0x38, 0x80, 0x0f, 0xc3, 0x01,
+    0xbd, 0x01, 0x06, 0x01, 0xc6, 0x80, 0x7f, 0x3b, 0x04, 0x1f, 0x5c, 0x01, 0x06, 0xde, 0x5d, 0x09, 0x00, 0x07, 0x3d, 0x04, 0x20, 0x5c, 0xc3, 0x01,
+    0xbd, 0x01, 0x06, 0x30, 0xc6, 0x80, 0x80, 0x3f, 0x22, 0xdf, 0x59, 0xc1, 0x23, 0x61, 0x5b, 0x09, 0x00, 0x07, 0x40, 0x22, 0xe0, 0x59, 0x80, 0x01,
+    0x80, 0x01, 0x01, 0x03, 0xfe, 0x50, 0xbe, 0x1e, 0x04, 0xe0, 0x06, 0x06, 0x19, 0xc5, 0x80, 0x80, 0x5d, 0xff, 0x60, 0xff, 0xa3, 0x00, 0xa0, 0x00,
+    0x09, 0x00, 0x07, 0x5e, 0xff, 0x62, 0xff, 0x43, 0x01, 0x3d, 0x01, 0x02, 0x06, 0x30, 0xc7, 0x7f, 0x80, 0x1f, 0x3b, 0x22, 0x56, 0x25, 0x3f, 0x21,
+    0x5a, 0x09, 0x00, 0x07, 0x20, 0x3b, 0x23, 0x56, 0x03, 0x04, 0xfd, 0x03, 0x06, 0x0a, 0xc2, 0x80, 0x80, 0x3f, 0x1b, 0x5f, 0x3f, 0xc1, 0x1b, 0xe1,
+    0x3f, 0x09, 0x00, 0x07, 0x40, 0x1b, 0x60, 0x3f, 0x80, 0x00, 0x80, 0x00, 0x06, 0x26, 0xc2, 0x80, 0x80, 0x5f, 0x1d, 0x3f, 0x44, 0xe1, 0x1d, 0xc1,
+    0x44, 0x09, 0x00, 0x07, 0x60, 0x1d, 0x40, 0x44, 0x80, 0x00, 0x80, 0x00, 0x06, 0x0b, 0xc2, 0x80, 0x7f, 0xff, 0x49, 0x3f, 0x3e, 0x81, 0x4a, 0xc1,
+    0x3e, 0x09, 0x00, 0x07, 0x00, 0x4a, 0x40, 0x3e, 0x80, 0x00, 0x80, 0x00, 0x06, 0x1b, 0xc8, 0x80, 0x80, 0x9f, 0x4f, 0xff, 0x0c, 0x21, 0x55, 0x81,
+    0x12, 0x09, 0x00, 0x07, 0xa0, 0x4f, 0x00, 0x0d, 0x80, 0x05, 0x80, 0x05, 0x06, 0x30, 0xc5, 0x80, 0x80, 0xbf, 0x1c, 0x3f, 0x34, 0xc1, 0x1d, 0x41,
+    0x35, 0x09, 0x00, 0x07, 0xc0, 0x1c, 0x40, 0x34, 0x00, 0x01, 0x00, 0x01, 0x06, 0x16, 0xc6, 0x80, 0x80, 0xfd, 0x27, 0x00, 0x22, 0x43, 0x2a, 0x40,
+    0x24, 0x09, 0x00, 0x07, 0xfe, 0x27, 0x02, 0x22, 0x43, 0x02, 0x3d, 0x02, 0x06, 0x2a, 0xc5, 0x7f, 0x7f, 0xff, 0x42, 0x7f, 0x47, 0xc1, 0x43, 0x41,
+    0x48, 0x3a, 0x00, 0x01, 0xc0, 0x43, 0xe0, 0x47, 0x03, 0xc0, 0x43, 0x16, 0x48, 0x96, 0x43, 0x40, 0x48, 0x60, 0x43, 0x40, 0x48, 0x03, 0x2a, 0x43,
+    0x40, 0x48, 0x00, 0x43, 0x16, 0x48, 0x00, 0x43, 0xe0, 0x47, 0x03, 0x00, 0x43, 0xaa, 0x47, 0x2a, 0x43, 0x80, 0x47, 0x60, 0x43, 0x80, 0x47, 0x03,
+    0x96, 0x43, 0x80, 0x47, 0xc0, 0x43, 0xaa, 0x47, 0xc0, 0x43, 0xe0, 0x47, 0x04, 0x06, 0x06, 0xc8, 0x80, 0x80, 0xff, 0x1f, 0xdf, 0x07, 0x01, 0x26,
+    0xe1, 0x0d, 0x09, 0x00, 0x07, 0x00, 0x20, 0xe0, 0x07, 0x00, 0x06, 0x00, 0x06, 0x06, 0x06, 0xc7, 0x80, 0x80, 0xdf, 0x1a, 0x5f, 0x56, 0x61, 0x1d,
+    0xe1, 0x58, 0x09, 0x00, 0x07, 0xe0, 0x1a, 0x60, 0x56, 0x80, 0x02, 0x80, 0x02, 0x06, 0x1a, 0xc7, 0x7f, 0x80, 0xdf, 0x07, 0xe2, 0x20, 0xe5, 0x0b,
+    0xe1, 0x24, 0x09, 0x00, 0x07, 0xe0, 0x07, 0xe3, 0x20, 0x03, 0x04, 0xfd, 0x03, 0x06, 0x06, 0xc6, 0x80, 0x7f, 0x3b, 0x44, 0xff, 0x2f, 0x01, 0x46,
+    0xbe, 0x31, 0x09, 0x00, 0x07, 0x3d, 0x44, 0x00, 0x30, 0xc3, 0x01, 0xbd, 0x01, 0x06, 0x06, 0xc7, 0x80, 0x80, 0x7f, 0x20, 0x1f, 0x2b, 0x81, 0x22,
+    0x21, 0x2d, 0x09, 0x00, 0x07, 0x80, 0x20, 0x20, 0x2b, 0x00, 0x02, 0x00, 0x02, 0x06, 0x22, 0xc6, 0x80, 0x80, 0xbd, 0x0e, 0xa0, 0x2f, 0x03, 0x11,
+    0xe0, 0x31, 0x09, 0x00, 0x07, 0xbe, 0x0e, 0xa2, 0x2f, 0x43, 0x02, 0x3d, 0x02, 0x06, 0x30, 0xc7, 0x7f, 0x80, 0xbf, 0x59, 0xc2, 0x4b, 0x45, 0x5e,
+    0x41, 0x50, 0x09, 0x00, 0x07, 0xc0, 0x59, 0xc3, 0x4b, 0x83, 0x04, 0x7d, 0x04, 0x06, 0x1b, 0xc7, 0x80, 0x80, 0xff, 0x40, 0xdf, 0x11, 0xc1, 0x43,
+    0xa1, 0x14, 0x09, 0x00, 0x07, 0x00, 0x41, 0xe0, 0x11, 0xc0, 0x02, 0xc0, 0x02, 0x06, 0x0d, 0xc6, 0x80, 0x7f, 0x9b, 0x16, 0xdf, 0x4b, 0x61, 0x18,
+    0x9e, 0x4d, 0x09, 0x00, 0x07, 0x9d, 0x16, 0xe0, 0x4b, 0xc3, 0x01, 0xbd, 0x01, 0x06, 0x21, 0xc7, 0x80, 0x80, 0x1f, 0x20, 0xbf, 0x55, 0xa1, 0x22,
+    0x41, 0x58, 0x09, 0x00, 0x07, 0x20, 0x20, 0xc0, 0x55, 0x80, 0x02, 0x80, 0x02, 0x06, 0x1b, 0xc7, 0x80, 0x80, 0x9f, 0x5a, 0xbf, 0x0b, 0x61, 0x5e,
+    0x81, 0x0f, 0x09, 0x00, 0x07, 0xa0, 0x5a, 0xc0, 0x0b, 0xc0, 0x03, 0xc0, 0x03, 0x06, 0x30, 0xc8, 0x80, 0x80, 0x9f, 0x4b, 0x7f, 0x53, 0x61, 0x51,
+    0x41, 0x59, 0x09, 0x00, 0x07, 0xa0, 0x4b, 0x80, 0x53, 0xc0, 0x05, 0xc0, 0x05, 0x06, 0x14, 0xc8, 0x80, 0x80, 0xdf, 0x2d, 0xbf, 0xfc, 0x61, 0x34,
+    0x41, 0x03, 0x09, 0x00, 0x07, 0xe0, 0x2d, 0xc0, 0xfc, 0x80, 0x06, 0x80, 0x06, 0x06, 0x26, 0xc8, 0x80, 0x80, 0xbf, 0x45, 0x7f, 0x17, 0x01, 0x4a,
+    0xc1, 0x1b, 0x09, 0x00, 0x07, 0xc0, 0x45, 0x80, 0x17, 0x40, 0x04, 0x40, 0x04, 0x06, 0x1b, 0xc8, 0x80, 0x80, 0xff, 0x43, 0x3f, 0x4f, 0xc1, 0x48,
+    0x01, 0x54, 0x09, 0x00, 0x07, 0x00, 0x44, 0x40, 0x4f, 0xc0, 0x04, 0xc0, 0x04, 0x06, 0x03, 0xc7, 0x80, 0x80, 0x7f, 0x01, 0x3f, 0x40, 0x41, 0x04,
+    0x01, 0x43, 0x09, 0x00, 0x07, 0x80, 0x01, 0x40, 0x40, 0xc0, 0x02, 0xc0, 0x02, 0x06, 0x19, 0xc7, 0x80, 0x80, 0x9f, 0x48, 0x7f, 0x22, 0x61, 0x4c,
+    0x41, 0x26, 0x09, 0x00, 0x07, 0xa0, 0x48, 0x80, 0x22, 0xc0, 0x03, 0xc0, 0x03, 0x06, 0x1b, 0xc2, 0x80, 0x80, 0xbf, 0x23, 0xff, 0x32, 0x41, 0x24,
+    0x81, 0x33, 0x09, 0x00, 0x07, 0xc0, 0x23, 0x00, 0x33, 0x80, 0x00, 0x80, 0x00, 0x06, 0x02, 0xc6, 0x80, 0x80, 0xdd, 0x0f, 0x20, 0x2b, 0x23, 0x12,
+    0x60, 0x2d, 0x09, 0x00, 0x07, 0xde, 0x0f, 0x22, 0x2b, 0x43, 0x02, 0x3d, 0x02, 0x06, 0x1b, 0xc7, 0x80, 0x80, 0x5f, 0x3d, 0x9f, 0x23, 0xe1, 0x3f,
+    0x21, 0x26, 0x09, 0x00, 0x07, 0x60, 0x3d, 0xa0, 0x23, 0x80, 0x02, 0x80, 0x02, 0x06, 0x1d, 0xc8, 0x80, 0x80, 0x7f, 0x12, 0xff, 0x06, 0x41, 0x17,
+    0xc1, 0x0b, 0x09, 0x00, 0x07, 0x80, 0x12, 0x00, 0x07, 0xc0, 0x04, 0xc0, 0x04, 0x06, 0x1b, 0xc8, 0x80, 0x80, 0x5f, 0x44, 0xff, 0x47, 0x21, 0x49,
+    0xc1, 0x4c, 0x09, 0x00, 0x07, 0x60, 0x44, 0x00, 0x48, 0xc0, 0x04, 0xc0, 0x04, 0x01, 0x03, 0xde, 0x50, 0xbe, 0x23, 0x04, 0xe0, 0x06, 0x06, 0x1b,
+    0xc5, 0x80, 0x80, 0x5d, 0xff, 0x60, 0xff, 0xa3, 0x00, 0xa0, 0x00, 0x09, 0x00, 0x07, 0x5e, 0xff, 0x62, 0xff, 0x43, 0x01, 0x3d, 0x01, 0x02, 0x06,
+    0x03, 0xc7, 0x80, 0x80, 0xbf, 0x20, 0xdf, 0x1f, 0x01, 0x24, 0x21, 0x23, 0x09, 0x00, 0x07, 0xc0, 0x20, 0xe0, 0x1f, 0x40, 0x03, 0x40, 0x03, 0x06,
+    0x15, 0xc2, 0x80, 0x80, 0x3f, 0x12, 0x9f, 0x0c, 0xc1, 0x12, 0x21, 0x0d, 0x09, 0x00, 0x07, 0x40, 0x12, 0xa0, 0x0c, 0x80, 0x00, 0x80, 0x00, 0x06,
+    0x16, 0xc6, 0x80, 0x80, 0x1d, 0x50, 0x40, 0x16, 0x63, 0x52, 0x80, 0x18, 0x09, 0x00, 0x07, 0x1e, 0x50, 0x42, 0x16, 0x43, 0x02, 0x3d, 0x02, 0x06,
+    0x1e, 0xc2, 0x80, 0x80, 0x1f, 0x44, 0x9f, 0x1b, 0xa1, 0x44, 0x21, 0x1c, 0x09, 0x00, 0x07, 0x20, 0x44, 0xa0, 0x1b, 0x80, 0x00, 0x80, 0x00, 0x06,
+    0x06, 0xc7, 0x80, 0x80, 0x9f, 0x57, 0xff, 0x49, 0x21, 0x5a, 0x81, 0x4c, 0x09, 0x00, 0x07, 0xa0, 0x57, 0x00, 0x4a, 0x80, 0x02, 0x80, 0x02, 0x06,
+    0x0e, 0xc6, 0x80, 0x80, 0x9d, 0x07, 0x20, 0x50, 0xe3, 0x09, 0x60, 0x52, 0x09, 0x00, 0x07, 0x9e, 0x07, 0x22, 0x50, 0x43, 0x02, 0x3d, 0x02, 0x06,
+    0x16, 0xc6, 0x80, 0x80, 0xdf, 0x0b, 0x3f, 0x3a, 0x61, 0x0d, 0xc1, 0x3b, 0x09, 0x00, 0x07, 0xe0, 0x0b, 0x40, 0x3a, 0x80, 0x01, 0x80, 0x01, 0x06,
+    0x15, 0xc7, 0x80, 0x80, 0xfd, 0x4c, 0x00, 0x0f, 0x83, 0x50, 0x80, 0x12, 0x09, 0x00, 0x07, 0xfe, 0x4c, 0x02, 0x0f, 0x83, 0x03, 0x7d, 0x03, 0x06,
+    0x0e, 0xc2, 0x80, 0x80, 0x7f, 0x17, 0xdf, 0x1b, 0x01, 0x18, 0x61, 0x1c, 0x09, 0x00, 0x07, 0x80, 0x17, 0xe0, 0x1b, 0x80, 0x00, 0x80, 0x00, 0x06,
+    0x16, 0xc7, 0x7f, 0x80, 0x7f, 0x40, 0x42, 0x09, 0x05, 0x45, 0xc1, 0x0d, 0x09, 0x00, 0x07, 0x80, 0x40, 0x43, 0x09, 0x83, 0x04, 0x7d, 0x04, 0x06,
+    0x22, 0xc7, 0x80, 0x80, 0x7f, 0x3c, 0xff, 0x04, 0x41, 0x3f, 0xc1, 0x07, 0x09, 0x00, 0x07, 0x80, 0x3c, 0x00, 0x05, 0xc0, 0x02, 0xc0, 0x02, 0x01,
+    0x03, 0x9e, 0x49, 0x7e, 0x34, 0x04, 0xe0, 0x06, 0x06, 0x30, 0xc5, 0x80, 0x80, 0x5d, 0xff, 0x60, 0xff, 0xa3, 0x00, 0xa0, 0x00, 0x09, 0x00, 0x07,
+    0x5e, 0xff, 0x62, 0xff, 0x43, 0x01, 0x3d, 0x01, 0x02, 0x06, 0x17, 0xc6, 0x80, 0x80, 0x9d, 0x49, 0x00, 0x29, 0xe3, 0x4b, 0x40, 0x2b, 0x09, 0x00,
+    0x07, 0x9e, 0x49, 0x02, 0x29, 0x43, 0x02, 0x3d, 0x02, 0x06, 0x06, 0xc2, 0x80, 0x7f, 0x1f, 0x21, 0x3f, 0x3e, 0xa1, 0x21, 0xc1, 0x3e, 0x09, 0x00,
+    0x07, 0x20, 0x21, 0x40, 0x3e, 0x80, 0x00, 0x80, 0x00, 0x06, 0x1b, 0xc7, 0x80, 0x80, 0x3f, 0x2e, 0x5f, 0x30, 0xc1, 0x30, 0xe1, 0x32, 0x09, 0x00,
+    0x07, 0x40, 0x2e, 0x60, 0x30, 0x80, 0x02, 0x80, 0x02, 0x06, 0x1d, 0xc7, 0x80, 0x80, 0x9f, 0x5e, 0x5f, 0x4c, 0x61, 0x61, 0x21, 0x4f, 0x09, 0x00,
+    0x07, 0xa0, 0x5e, 0x60, 0x4c, 0xc0, 0x02, 0xc0, 0x02, 0x06, 0x11, 0xc5, 0x7f, 0x7f, 0xbf, 0x26, 0xff, 0x47, 0x81, 0x27, 0xc1, 0x48, 0x3a, 0x00,
+    0x01, 0x80, 0x27, 0x60, 0x48, 0x03, 0x80, 0x27, 0x96, 0x48, 0x56, 0x27, 0xc0, 0x48, 0x20, 0x27, 0xc0, 0x48, 0x03, 0xea, 0x26, 0xc0, 0x48, 0xc0,
+    0x26, 0x96, 0x48, 0xc0, 0x26, 0x60, 0x48, 0x03, 0xc0, 0x26, 0x2a, 0x48, 0xea, 0x26, 0x00, 0x48, 0x20, 0x27, 0x00, 0x48, 0x03, 0x56, 0x27, 0x00,
+    0x48, 0x80, 0x27, 0x2a, 0x48, 0x80, 0x27, 0x60, 0x48, 0x04, 0x06, 0x1b, 0xc8, 0x80, 0x80, 0xff, 0x41, 0x5f, 0x05, 0x81, 0x47, 0xe1, 0x0a, 0x09,
+    0x00, 0x07, 0x00, 0x42, 0x60, 0x05, 0x80, 0x05, 0x80, 0x05, 0x01, 0x03, 0xde, 0x0a, 0x3e, 0x5d, 0x04, 0xe0, 0x06, 0x06, 0x26, 0xc5, 0x80, 0x80,
+    0x5d, 0xff, 0x60, 0xff, 0xa3, 0x00, 0xa0, 0x00, 0x09, 0x00, 0x07, 0x5e, 0xff, 0x62, 0xff, 0x43, 0x01, 0x3d, 0x01, 0x02, 0x06, 0x24, 0xc5, 0x80,
+    0x80, 0xbf, 0x30, 0xff, 0x32, 0x81, 0x31, 0xc1, 0x33, 0x3a, 0x00, 0x01, 0x80, 0x31, 0x60, 0x33, 0x03, 0x80, 0x31, 0x96, 0x33, 0x56, 0x31, 0xc0,
+    0x33, 0x20, 0x31, 0xc0, 0x33, 0x03, 0xea, 0x30, 0xc0, 0x33, 0xc0, 0x30, 0x96, 0x33, 0xc0, 0x30, 0x60, 0x33, 0x03, 0xc0, 0x30, 0x2a, 0x33, 0xea,
+    0x30, 0x00, 0x33, 0x20, 0x31, 0x00, 0x33, 0x03, 0x56, 0x31, 0x00, 0x33, 0x80, 0x31, 0x2a, 0x33, 0x80, 0x31, 0x60, 0x33, 0x04, 0x06, 0x2d, 0xc7,
+    0x80, 0x80, 0x3f, 0x0c, 0x3f, 0x0a, 0x41, 0x0e, 0x41, 0x0c, 0x09, 0x00, 0x07, 0x40, 0x0c, 0x40, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x06, 0x21, 0xc2,
+    0x80, 0x80, 0xff, 0x1c, 0xbf, 0x2d, 0x81, 0x1d, 0x41, 0x2e, 0x09, 0x00, 0x07, 0x00, 0x1d, 0xc0, 0x2d, 0x80, 0x00, 0x80, 0x00, 0x06, 0x08, 0xc6,
+    0x80, 0x80, 0x1f, 0x30, 0x5f, 0x4f, 0xa1, 0x31, 0xe1, 0x50, 0x09, 0x00, 0x07, 0x20, 0x30, 0x60, 0x4f, 0x80, 0x01, 0x80, 0x01, 0x06, 0x05, 0xc7,
+    0x80, 0x80, 0xfd, 0x5a, 0xe0, 0x1a, 0x03, 0x5e, 0xe0, 0x1d, 0x09, 0x00, 0x07, 0xfe, 0x5a, 0xe2, 0x1a, 0x03, 0x03, 0xfd, 0x02, 0x06, 0x10, 0xc8,
+    0x80, 0x80, 0xbf, 0x55, 0x7f, 0x34, 0x01, 0x5c, 0xc1, 0x3a, 0x09, 0x00, 0x07, 0xc0, 0x55, 0x80, 0x34, 0x40, 0x06, 0x40, 0x06, 0x06, 0x18, 0xc7,
+    0x80, 0x80, 0xdf, 0x32, 0x5f, 0x0d, 0x61, 0x35, 0xe1, 0x0f, 0x09, 0x00, 0x07, 0xe0, 0x32, 0x60, 0x0d, 0x80, 0x02, 0x80, 0x02, 0x06, 0x13, 0xc7,
+    0x80, 0x80, 0x7f, 0x5d, 0x5f, 0x10, 0x01, 0x60, 0xe1, 0x12, 0x09, 0x00, 0x07, 0x80, 0x5d, 0x60, 0x10, 0x80, 0x02, 0x80, 0x02, 0x06, 0x14, 0xc7,
+    0x80, 0x80, 0x5f, 0x3d, 0xff, 0x45, 0x21, 0x40, 0xc1, 0x48, 0x09, 0x00, 0x07, 0x60, 0x3d, 0x00, 0x46, 0xc0, 0x02, 0xc0, 0x02, 0x06, 0x0c, 0xc5,
+    0x7f, 0x7f, 0x7f, 0x15, 0xff, 0x41, 0x41, 0x16, 0xc1, 0x42, 0x3a, 0x00, 0x01, 0x40, 0x16, 0x60, 0x42, 0x03, 0x40, 0x16, 0x96, 0x42, 0x16, 0x16,
+    0xc0, 0x42, 0xe0, 0x15, 0xc0, 0x42, 0x03, 0xaa, 0x15, 0xc0, 0x42, 0x80, 0x15, 0x96, 0x42, 0x80, 0x15, 0x60, 0x42, 0x03, 0x80, 0x15, 0x2a, 0x42,
+    0xaa, 0x15, 0x00, 0x42, 0xe0, 0x15, 0x00, 0x42, 0x03, 0x16, 0x16, 0x00, 0x42, 0x40, 0x16, 0x2a, 0x42, 0x40, 0x16, 0x60, 0x42, 0x04, 0x06, 0x04,
+    0xc8, 0x80, 0x7f, 0xbb, 0x17, 0x7f, 0x0b, 0x41, 0x1d, 0xfe, 0x10, 0x09, 0x00, 0x07, 0xbd, 0x17, 0x80, 0x0b, 0x83, 0x05, 0x7d, 0x05, 0x06, 0x26,
+    0xc6, 0x80, 0x80, 0x3f, 0x3c, 0xff, 0x34, 0xc1, 0x3d, 0x81, 0x36, 0x09, 0x00, 0x07, 0x40, 0x3c, 0x00, 0x35, 0x80, 0x01, 0x80, 0x01, 0x06, 0x10,
+    0xc8, 0x80, 0x80, 0x7d, 0x43, 0xa0, 0xfd, 0x03, 0x4b, 0x20, 0x05, 0x09, 0x00, 0x07, 0x7e, 0x43, 0xa2, 0xfd, 0x83, 0x07, 0x7d, 0x07, 0x06, 0x06,
+    0xc6, 0x80, 0x7f, 0x9b, 0x2e, 0x7f, 0x4c, 0x61, 0x30, 0x3e, 0x4e, 0x09, 0x00, 0x07, 0x9d, 0x2e, 0x80, 0x4c, 0xc3, 0x01, 0xbd, 0x01, 0x06, 0x1c,
+    0xc6, 0x80, 0x80, 0xff, 0x15, 0xbf, 0x27, 0x81, 0x17, 0x41, 0x29, 0x09, 0x00, 0x07, 0x00, 0x16, 0xc0, 0x27, 0x80, 0x01, 0x80, 0x01, 0x06, 0x26,
+    0xc7, 0x7f, 0x80, 0x9f, 0x2c, 0xe2, 0xfe, 0xa5, 0x31, 0xe1, 0x03, 0x09, 0x00, 0x07, 0xa0, 0x2c, 0xe3, 0xfe, 0x03, 0x05, 0xfd, 0x04, 0x06, 0x1c,
+    0xc5, 0x80, 0x80, 0x9f, 0x44, 0xbf, 0x55, 0xa1, 0x45, 0xc1, 0x56, 0x09, 0x00, 0x07, 0xa0, 0x44, 0xc0, 0x55, 0x00, 0x01, 0x00, 0x01, 0x06, 0x1b,
+    0xc6, 0x80, 0x80, 0x5d, 0x33, 0xa0, 0x0f, 0xa3, 0x35, 0xe0, 0x11, 0x09, 0x00, 0x07, 0x5e, 0x33, 0xa2, 0x0f, 0x43, 0x02, 0x3d, 0x02, 0x06, 0x05,
+    0xc5, 0x80, 0x80, 0x7f, 0x22, 0xff, 0x50, 0x81, 0x23, 0x01, 0x52, 0x09, 0x00, 0x07, 0x80, 0x22, 0x00, 0x51, 0x00, 0x01, 0x00, 0x01, 0x06, 0x26,
+    0xc7, 0x80, 0x80, 0x1f, 0x2f, 0x7f, 0x27, 0x21, 0x31, 0x81, 0x29, 0x09, 0x00, 0x07, 0x20, 0x2f, 0x80, 0x27, 0x00, 0x02, 0x00, 0x02, 0x06, 0x1c,
+    0xc2, 0x80, 0x80, 0x1f, 0x26, 0x5f, 0x0e, 0xa1, 0x26, 0xe1, 0x0e, 0x09, 0x00, 0x07, 0x20, 0x26, 0x60, 0x0e, 0x80, 0x00, 0x80, 0x00, 0x06, 0x2a,
+    0xc7, 0x80, 0x80, 0xff, 0x50, 0xdf, 0x27, 0xc1, 0x54, 0xa1, 0x2b, 0x09, 0x00, 0x07, 0x00, 0x51, 0xe0, 0x27, 0xc0, 0x03, 0xc0, 0x03, 0x06, 0x30,
+    0xc7, 0x7f, 0x80, 0xff, 0x44, 0xe2, 0x2f, 0x85, 0x49, 0x61, 0x34, 0x09, 0x00, 0x07, 0x00, 0x45, 0xe3, 0x2f, 0x83, 0x04, 0x7d, 0x04, 0x06, 0x2a,
+    0xc7, 0x80, 0x80, 0xff, 0x0e, 0x1f, 0x20, 0x41, 0x12, 0x61, 0x23, 0x09, 0x00, 0x07, 0x00, 0x0f, 0x20, 0x20, 0x40, 0x03, 0x40, 0x03, 0x06, 0x23,
+    0xc6, 0x80, 0x80, 0x1d, 0x38, 0x40, 0x56, 0x63, 0x3a, 0x80, 0x58, 0x09, 0x00, 0x07, 0x1e, 0x38, 0x42, 0x56, 0x43, 0x02, 0x3d, 0x02, 0x06, 0x26,
+    0xc5, 0x80, 0x80, 0x3f, 0x05, 0x5f, 0x2d, 0x41, 0x06, 0x61, 0x2e, 0x09, 0x00, 0x07, 0x40, 0x05, 0x60, 0x2d, 0x00, 0x01, 0x00, 0x01, 0x06, 0x1b,
+    0xc6, 0x80, 0x80, 0x9f, 0x4a, 0xff, 0x4b, 0x21, 0x4c, 0x81, 0x4d, 0x09, 0x00, 0x07, 0xa0, 0x4a, 0x00, 0x4c, 0x80, 0x01, 0x80, 0x01, 0x06, 0x30,
+    0xc7, 0x7f, 0x7f, 0x9f, 0x11, 0xdf, 0x1b, 0xe1, 0x15, 0x21, 0x20, 0x3a, 0x00, 0x01, 0xe0, 0x15, 0x00, 0x1e, 0x03, 0xe0, 0x15, 0x2d, 0x1f, 0xed,
+    0x14, 0x20, 0x20, 0xc0, 0x13, 0x20, 0x20, 0x03, 0x93, 0x12, 0x20, 0x20, 0xa0, 0x11, 0x2d, 0x1f, 0xa0, 0x11, 0x00, 0x1e, 0x03, 0xa0, 0x11, 0xd3,
+    0x1c, 0x93, 0x12, 0xe0, 0x1b, 0xc0, 0x13, 0xe0, 0x1b, 0x03, 0xed, 0x14, 0xe0, 0x1b, 0xe0, 0x15, 0xd3, 0x1c, 0xe0, 0x15, 0x00, 0x1e, 0x04, 0x06,
+    0x01, 0xc7, 0x80, 0x80, 0x7f, 0x2f, 0xdf, 0x2a, 0x01, 0x32, 0x61, 0x2d, 0x09, 0x00, 0x07, 0x80, 0x2f, 0xe0, 0x2a, 0x80, 0x02, 0x80, 0x02, 0x06,
+    0x06, 0xc7, 0x80, 0x80, 0xbf, 0x36, 0xbf, 0x17, 0x81, 0x3a, 0x81, 0x1b, 0x09, 0x00, 0x07, 0xc0, 0x36, 0xc0, 0x17, 0xc0, 0x03, 0xc0, 0x03, 0x06,
+    0x11, 0xc7, 0x80, 0x80, 0x1d, 0x0e, 0x00, 0x16, 0xa3, 0x11, 0x80, 0x19, 0x09, 0x00, 0x07, 0x1e, 0x0e, 0x02, 0x16, 0x83, 0x03, 0x7d, 0x03, 0x06,
+    0x1b, 0xc5, 0x80, 0x80, 0x3f, 0x43, 0x5f, 0x3a, 0x01, 0x44, 0x21, 0x3b, 0x3a, 0x00, 0x01, 0x00, 0x44, 0xc0, 0x3a, 0x03, 0x00, 0x44, 0xf6, 0x3a,
+    0xd6, 0x43, 0x20, 0x3b, 0xa0, 0x43, 0x20, 0x3b, 0x03, 0x6a, 0x43, 0x20, 0x3b, 0x40, 0x43, 0xf6, 0x3a, 0x40, 0x43, 0xc0, 0x3a, 0x03, 0x40, 0x43,
+    0x8a, 0x3a, 0x6a, 0x43, 0x60, 0x3a, 0xa0, 0x43, 0x60, 0x3a, 0x03, 0xd6, 0x43, 0x60, 0x3a, 0x00, 0x44, 0x8a, 0x3a, 0x00, 0x44, 0xc0, 0x3a, 0x04,
+    0x06, 0x30, 0xc8, 0x80, 0x80, 0x7f, 0x50, 0x1f, 0x0e, 0x41, 0x58, 0xe1, 0x15, 0x09, 0x00, 0x07, 0x80, 0x50, 0x20, 0x0e, 0xc0, 0x07, 0xc0, 0x07,
+    0x06, 0x14, 0xc7, 0x80, 0x80, 0x7d, 0x17, 0x60, 0x1f, 0x03, 0x1b, 0xe0, 0x22, 0x09, 0x00, 0x07, 0x7e, 0x17, 0x62, 0x1f, 0x83, 0x03, 0x7d, 0x03,
+    0x06, 0x1b, 0xc6, 0x80, 0x80, 0x7d, 0x3f, 0xc0, 0x24, 0xc3, 0x41, 0x00, 0x27, 0x09, 0x00, 0x07, 0x7e, 0x3f, 0xc2, 0x24, 0x43, 0x02, 0x3d, 0x02,
+    0x06, 0x0c, 0xc7, 0x7f, 0x80, 0x9f, 0x21, 0x42, 0x18, 0xa5, 0x25, 0x41, 0x1c, 0x09, 0x00, 0x07, 0xa0, 0x21, 0x43, 0x18, 0x03, 0x04, 0xfd, 0x03,
+    0x06, 0x2f, 0xc7, 0x80, 0x80, 0xff, 0x1a, 0x9f, 0x1f, 0x41, 0x1e, 0xe1, 0x22, 0x09, 0x00, 0x07, 0x00, 0x1b, 0xa0, 0x1f, 0x40, 0x03, 0x40, 0x03,
+    0x06, 0x0b, 0xc7, 0x80, 0x80, 0x1f, 0x36, 0xff, 0x32, 0x21, 0x38, 0x01, 0x35, 0x09, 0x00, 0x07, 0x20, 0x36, 0x00, 0x33, 0x00, 0x02, 0x00, 0x02,
+    0x06, 0x08, 0xc8, 0x80, 0x80, 0xbf, 0x2d, 0x5f, 0x06, 0x01, 0x33, 0xa1, 0x0b, 0x09, 0x00, 0x07, 0xc0, 0x2d, 0x60, 0x06, 0x40, 0x05, 0x40, 0x05,
+    0x06, 0x01, 0xc8, 0x80, 0x80, 0x1f, 0xfe, 0x9f, 0x0d, 0x61, 0x03, 0xe1, 0x12, 0x09, 0x00, 0x07, 0x20, 0xfe, 0xa0, 0x0d, 0x40, 0x05, 0x40, 0x05,
+    0x06, 0x25, 0xc8, 0x80, 0x80, 0x5f, 0x59, 0xdf, 0x1f, 0x21, 0x5f, 0xa1, 0x25, 0x09, 0x00, 0x07, 0x60, 0x59, 0xe0, 0x1f, 0xc0, 0x05, 0xc0, 0x05,
+    0x06, 0x1b, 0xc7, 0x80, 0x7f, 0x1f, 0x2b, 0xff, 0x0a, 0xe1, 0x2e, 0xc1, 0x0e, 0x09, 0x00, 0x07, 0x20, 0x2b, 0x00, 0x0b, 0xc0, 0x03, 0xc0, 0x03,
+    0x06, 0x1b, 0xc6, 0x80, 0x80, 0x1f, 0x19, 0x1f, 0x52, 0xa1, 0x1a, 0xa1, 0x53, 0x09, 0x00, 0x07, 0x20, 0x19, 0x20, 0x52, 0x80, 0x01, 0x80, 0x01,
+    0x06, 0x20, 0xc7, 0x80, 0x80, 0x5f, 0xfe, 0x7f, 0x35, 0x21, 0x02, 0x41, 0x39, 0x09, 0x00, 0x07, 0x60, 0xfe, 0x80, 0x35, 0xc0, 0x03, 0xc0, 0x03,
+    0x06, 0x0a, 0xc7, 0x80, 0x80, 0x1f, 0x33, 0x9f, 0x2c, 0x61, 0x36, 0xe1, 0x2f, 0x09, 0x00, 0x07, 0x20, 0x33, 0xa0, 0x2c, 0x40, 0x03, 0x40, 0x03,
+    0x06, 0x1b, 0xc7, 0x80, 0x7f, 0xfd, 0x20, 0xc0, 0x23, 0x03, 0x24, 0xc0, 0x26, 0x09, 0x00, 0x07, 0xfe, 0x20, 0xc2, 0x23, 0x03, 0x03, 0xfd, 0x02,
+    0x06, 0x2f, 0xc8, 0x80, 0x7f, 0xbb, 0x0c, 0x9f, 0x06, 0x41, 0x13, 0x1e, 0x0d, 0x09, 0x00, 0x07, 0xbd, 0x0c, 0xa0, 0x06, 0x83, 0x06, 0x7d, 0x06,
+    0x06, 0x18, 0xc2, 0x80, 0x80, 0x5f, 0x10, 0xdf, 0x42, 0xe1, 0x10, 0x61, 0x43, 0x09, 0x00, 0x07, 0x60, 0x10, 0xe0, 0x42, 0x80, 0x00, 0x80, 0x00,
+    0x06, 0x0b, 0xc8, 0x80, 0x7f, 0x9b, 0x11, 0x7f, 0xfd, 0x21, 0x17, 0xfe, 0x02, 0x09, 0x00, 0x07, 0x9d, 0x11, 0x80, 0xfd, 0x83, 0x05, 0x7d, 0x05,
+    0x06, 0x26, 0xc7, 0x7f, 0x80, 0x9f, 0x49, 0x82, 0x51, 0xa5, 0x4d, 0x81, 0x55, 0x09, 0x00, 0x07, 0xa0, 0x49, 0x83, 0x51, 0x03, 0x04, 0xfd, 0x03,
+    0x06, 0x24, 0xc7, 0x7f, 0x80, 0xdf, 0x5b, 0xa2, 0x33, 0xe5, 0x60, 0xa1, 0x38, 0x09, 0x00, 0x07, 0xe0, 0x5b, 0xa3, 0x33, 0x03, 0x05, 0xfd, 0x04,
+    0x06, 0x06, 0xc7, 0x7f, 0x80, 0x9f, 0x4b, 0x22, 0x5b, 0xa5, 0x50, 0x21, 0x60, 0x09, 0x00, 0x07, 0xa0, 0x4b, 0x23, 0x5b, 0x03, 0x05, 0xfd, 0x04,
+    0x06, 0x15, 0xc8, 0x80, 0x80, 0x7f, 0x4d, 0x1f, 0x3f, 0x01, 0x53, 0xa1, 0x44, 0x09, 0x00, 0x07, 0x80, 0x4d, 0x20, 0x3f, 0x80, 0x05, 0x80, 0x05,
+    0x06, 0x15, 0xc8, 0x80, 0x80, 0x7f, 0x54, 0x1f, 0x26, 0xc1, 0x58, 0x61, 0x2a, 0x09, 0x00, 0x07, 0x80, 0x54, 0x20, 0x26, 0x40, 0x04, 0x40, 0x04,
+    0x06, 0x0a, 0xc5, 0x80, 0x80, 0xbf, 0x4b, 0xff, 0x40, 0xc1, 0x4c, 0x01, 0x42, 0x09, 0x00, 0x07, 0xc0, 0x4b, 0x00, 0x41, 0x00, 0x01, 0x00, 0x01,
+    0x06, 0x30, 0xc7, 0x7f, 0x80, 0x1f, 0x41, 0x42, 0x2c, 0xa5, 0x45, 0xc1, 0x30, 0x09, 0x00, 0x07, 0x20, 0x41, 0x43, 0x2c, 0x83, 0x04, 0x7d, 0x04,
+    0x06, 0x18, 0xc2, 0x80, 0x80, 0xff, 0x26, 0x1f, 0x58, 0x81, 0x27, 0xa1, 0x58, 0x09, 0x00, 0x07, 0x00, 0x27, 0x20, 0x58, 0x80, 0x00, 0x80, 0x00,
+    0x06, 0x1d, 0xc2, 0x80, 0x80, 0x7f, 0x3c, 0x9f, 0x13, 0x01, 0x3d, 0x21, 0x14, 0x09, 0x00, 0x07, 0x80, 0x3c, 0xa0, 0x13, 0x80, 0x00, 0x80, 0x00,
+    0x06, 0x1b, 0xc8, 0x80, 0x80, 0x5f, 0x58, 0xff, 0x1c, 0xa1, 0x5e, 0x41, 0x23, 0x09, 0x00, 0x07, 0x60, 0x58, 0x00, 0x1d, 0x40, 0x06, 0x40, 0x06,
+    0x06, 0x1b, 0xc7, 0x7f, 0x80, 0x7f, 0x34, 0xc2, 0xfe, 0x05, 0x39, 0x41, 0x03, 0x09, 0x00, 0x07, 0x80, 0x34, 0xc3, 0xfe, 0x83, 0x04, 0x7d, 0x04,
+    0x01, 0x03, 0x1e, 0x0f, 0x1e, 0x3c, 0x04, 0xe0, 0x06, 0x06, 0x21, 0xc5, 0x80, 0x80, 0x5d, 0xff, 0x60, 0xff, 0xa3, 0x00, 0xa0, 0x00, 0x09, 0x00,
+    0x07, 0x5e, 0xff, 0x62, 0xff, 0x43, 0x01, 0x3d, 0x01, 0x02, 0x06, 0x0b, 0xc6, 0x80, 0x7f, 0x9b, 0x28, 0xdf, 0x01, 0x61, 0x2a, 0x9e, 0x03, 0x09,
+    0x00, 0x07, 0x9d, 0x28, 0xe0, 0x01, 0xc3, 0x01, 0xbd, 0x01, 0x06, 0x08, 0xc7, 0x80, 0x80, 0xff, 0x3a, 0x1f, 0xff, 0xc1, 0x3e, 0xe1, 0x02, 0x09,
+    0x00, 0x07, 0x00, 0x3b, 0x20, 0xff, 0xc0, 0x03, 0xc0, 0x03, 0x06, 0x30, 0xc7, 0x80, 0x80, 0x3d, 0x06, 0x00, 0x4b, 0x43, 0x09, 0x00, 0x4e, 0x09,
+    0x00, 0x07, 0x3e, 0x06, 0x02, 0x4b, 0x03, 0x03, 0xfd, 0x02, 0x06, 0x04, 0xc7, 0x7f, 0x80, 0xdf, 0x47, 0x82, 0x37, 0x65, 0x4c, 0x01, 0x3c, 0x09,
+    0x00, 0x07, 0xe0, 0x47, 0x83, 0x37, 0x83, 0x04, 0x7d, 0x04, 0x06, 0x0b, 0xc5, 0x80, 0x80, 0xbf, 0xff, 0x5f, 0x41, 0x81, 0x00, 0x21, 0x42, 0x3a,
+    0x00, 0x01, 0x80, 0x00, 0xc0, 0x41, 0x03, 0x80, 0x00, 0xf6, 0x41, 0x56, 0x00, 0x20, 0x42, 0x20, 0x00, 0x20, 0x42, 0x03, 0xea, 0xff, 0x20, 0x42,
+    0xc0, 0xff, 0xf6, 0x41, 0xc0, 0xff, 0xc0, 0x41, 0x03, 0xc0, 0xff, 0x8a, 0x41, 0xea, 0xff, 0x60, 0x41, 0x20, 0x00, 0x60, 0x41, 0x03, 0x56, 0x00,
+    0x60, 0x41, 0x80, 0x00, 0x8a, 0x41, 0x80, 0x00, 0xc0, 0x41, 0x04, 0x06, 0x1b, 0xc7, 0x80, 0x80, 0x7f, 0x30, 0x3f, 0x5c, 0x41, 0x34, 0x01, 0x60,
+    0x09, 0x00, 0x07, 0x80, 0x30, 0x40, 0x5c, 0xc0, 0x03, 0xc0, 0x03, 0x06, 0x1b, 0xc7, 0x80, 0x80, 0x9f, 0x14, 0x5f, 0x22, 0x21, 0x17, 0xe1, 0x24,
+    0x09, 0x00, 0x07, 0xa0, 0x14, 0x60, 0x22, 0x80, 0x02, 0x80, 0x02, 0x06, 0x1d, 0xc8, 0x80, 0x80, 0x7f, 0x53, 0xdf, 0x0b, 0xc1, 0x59, 0x21, 0x12,
+    0x09, 0x00, 0x07, 0x80, 0x53, 0xe0, 0x0b, 0x40, 0x06, 0x40, 0x06, 0x06, 0x1b, 0xc7, 0x80, 0x7f, 0xdf, 0x01, 0x1f, 0x55, 0xe1, 0x03, 0x21, 0x57,
+    0x09, 0x00, 0x07, 0xe0, 0x01, 0x20, 0x55, 0x00, 0x02, 0x00, 0x02, 0x06, 0x30, 0xc6, 0x80, 0x80, 0xff, 0x00, 0xff, 0x0b, 0x81, 0x02, 0x81, 0x0d,
+    0x09, 0x00, 0x07, 0x00, 0x01, 0x00, 0x0c, 0x80, 0x01, 0x80, 0x01, 0x06, 0x1c, 0xc7, 0x80, 0x80, 0x7f, 0x07, 0x3f, 0x2b, 0x81, 0x09, 0x41, 0x2d,
+    0x09, 0x00, 0x07, 0x80, 0x07, 0x40, 0x2b, 0x00, 0x02, 0x00, 0x02, 0x06, 0x14, 0xc2, 0x7f, 0x80, 0xff, 0x16, 0xdf, 0x5a, 0x81, 0x17, 0x61, 0x5b,
+    0x09, 0x00, 0x07, 0x00, 0x17, 0xe0, 0x5a, 0x80, 0x00, 0x80, 0x00, 0x06, 0x20, 0xc7, 0x80, 0x80, 0xdd, 0x41, 0xc0, 0x51, 0x63, 0x45, 0x40, 0x55,
+    0x09, 0x00, 0x07, 0xde, 0x41, 0xc2, 0x51, 0x83, 0x03, 0x7d, 0x03, 0x06, 0x1a, 0xc5, 0x80, 0x80, 0xdf, 0x29, 0x3f, 0x4d, 0xa1, 0x2a, 0x01, 0x4e,
+    0x3a, 0x00, 0x01, 0xa0, 0x2a, 0xa0, 0x4d, 0x03, 0xa0, 0x2a, 0xd6, 0x4d, 0x76, 0x2a, 0x00, 0x4e, 0x40, 0x2a, 0x00, 0x4e, 0x03, 0x0a, 0x2a, 0x00,
+    0x4e, 0xe0, 0x29, 0xd6, 0x4d, 0xe0, 0x29, 0xa0, 0x4d, 0x03, 0xe0, 0x29, 0x6a, 0x4d, 0x0a, 0x2a, 0x40, 0x4d, 0x40, 0x2a, 0x40, 0x4d, 0x03, 0x76,
+    0x2a, 0x40, 0x4d, 0xa0, 0x2a, 0x6a, 0x4d, 0xa0, 0x2a, 0xa0, 0x4d, 0x04, 0x06, 0x1e, 0xc7, 0x80, 0x80, 0x1f, 0x1d, 0x9f, 0x13, 0xa1, 0x1f, 0x21,
+    0x16, 0x09, 0x00, 0x07, 0x20, 0x1d, 0xa0, 0x13, 0x80, 0x02, 0x80, 0x02, 0x01, 0x03, 0x1e, 0x55, 0x7e, 0x2d, 0x04, 0xe0, 0x06, 0x06, 0x25, 0xc5,
+    0x80, 0x80, 0x5d, 0xff, 0x60, 0xff, 0xa3, 0x00, 0xa0, 0x00, 0x09, 0x00, 0x07, 0x5e, 0xff, 0x62, 0xff, 0x43, 0x01, 0x3d, 0x01, 0x02, 0x06, 0x2f,
+    0xc5, 0x80, 0x80, 0xbf, 0x10, 0xff, 0x39, 0xc1, 0x11, 0x01, 0x3b, 0x09, 0x00, 0x07, 0xc0, 0x10, 0x00, 0x3a, 0x00, 0x01, 0x00, 0x01, 0x06, 0x15,
+    0xc7, 0x80, 0x80, 0x7f, 0x31, 0xbf, 0x56, 0x41, 0x34, 0x81, 0x59, 0x09, 0x00, 0x07, 0x80, 0x31, 0xc0, 0x56, 0xc0, 0x02, 0xc0, 0x02, 0x06, 0x06,
+    0xc5, 0x80, 0x80, 0xff, 0x10, 0x5f, 0x48, 0xc1, 0x11, 0x21, 0x49, 0x3a, 0x00, 0x01, 0xc0, 0x11, 0xc0, 0x48, 0x03, 0xc0, 0x11, 0xf6, 0x48, 0x96,
+    0x11, 0x20, 0x49, 0x60, 0x11, 0x20, 0x49, 0x03, 0x2a, 0x11, 0x20, 0x49, 0x00, 0x11, 0xf6, 0x48, 0x00, 0x11, 0xc0, 0x48, 0x03, 0x00, 0x11, 0x8a,
+    0x48, 0x2a, 0x11, 0x60, 0x48, 0x60, 0x11, 0x60, 0x48, 0x03, 0x96, 0x11, 0x60, 0x48, 0xc0, 0x11, 0x8a, 0x48, 0xc0, 0x11, 0xc0, 0x48, 0x04, 0x06,
+    0x1d, 0xc5, 0x80, 0x80, 0xbf, 0x17, 0xdf, 0x3c, 0xc1, 0x18, 0xe1, 0x3d, 0x09, 0x00, 0x07, 0xc0, 0x17, 0xe0, 0x3c, 0x00, 0x01, 0x00, 0x01, 0x06,
+    0x1b, 0xc8, 0x80, 0x80, 0xff, 0x38, 0xbf, 0x5c, 0x41, 0x3d, 0x01, 0x61, 0x09, 0x00, 0x07, 0x00, 0x39, 0xc0, 0x5c, 0x40, 0x04, 0x40, 0x04, 0x06,
+    0x1e, 0xc5, 0x80, 0x80, 0x7f, 0x57, 0x9f, 0x33, 0x41, 0x58, 0x61, 0x34, 0x3a, 0x00, 0x01, 0x40, 0x58, 0x00, 0x34, 0x03, 0x40, 0x58, 0x36, 0x34,
+    0x16, 0x58, 0x60, 0x34, 0xe0, 0x57, 0x60, 0x34, 0x03, 0xaa, 0x57, 0x60, 0x34, 0x80, 0x57, 0x36, 0x34, 0x80, 0x57, 0x00, 0x34, 0x03, 0x80, 0x57,
+    0xca, 0x33, 0xaa, 0x57, 0xa0, 0x33, 0xe0, 0x57, 0xa0, 0x33, 0x03, 0x16, 0x58, 0xa0, 0x33, 0x40, 0x58, 0xca, 0x33, 0x40, 0x58, 0x00, 0x34, 0x04,
+    0x01, 0x03, 0xfe, 0x56, 0x5e, 0x4e, 0x04, 0xe0, 0x06, 0x06, 0x0a, 0xc5, 0x80, 0x80, 0x5d, 0xff, 0x60, 0xff, 0xa3, 0x00, 0xa0, 0x00, 0x09, 0x00,
+    0x07, 0x5e, 0xff, 0x62, 0xff, 0x43, 0x01, 0x3d, 0x01, 0x02, 0x06, 0x0a, 0xc6, 0x80, 0x80, 0x1f, 0x0a, 0xff, 0x0c, 0xa1, 0x0b, 0x81, 0x0e, 0x09,
+    0x00, 0x07, 0x20, 0x0a, 0x00, 0x0d, 0x80, 0x01, 0x80, 0x01, 0x06, 0x1b, 0xc7, 0x80, 0x80, 0x9d, 0x52, 0xa0, 0x59, 0x23, 0x56, 0x20, 0x5d, 0x09,
+    0x00, 0x07, 0x9e, 0x52, 0xa2, 0x59, 0x83, 0x03, 0x7d, 0x03, 0x06, 0x1c, 0xc7, 0x80, 0x80, 0xbf, 0x0b, 0xdf, 0x1d, 0xc1, 0x0d, 0xe1, 0x1f, 0x09,
+    0x00, 0x07, 0xc0, 0x0b, 0xe0, 0x1d, 0x00, 0x02, 0x00, 0x02, 0x06, 0x1b, 0xc7, 0x80, 0x80, 0xdf, 0x49, 0x9f, 0x1e, 0x61, 0x4c, 0x21, 0x21, 0x09,
+    0x00, 0x07, 0xe0, 0x49, 0xa0, 0x1e, 0x80, 0x02, 0x80, 0x02, 0x06, 0x26, 0xc5, 0x7f, 0x7f, 0x7f, 0x32, 0xdf, 0x48, 0x41, 0x33, 0xa1, 0x49, 0x3a,
+    0x00, 0x01, 0x40, 0x33, 0x40, 0x49, 0x03, 0x40, 0x33, 0x76, 0x49, 0x16, 0x33, 0xa0, 0x49, 0xe0, 0x32, 0xa0, 0x49, 0x03, 0xaa, 0x32, 0xa0, 0x49,
+    0x80, 0x32, 0x76, 0x49, 0x80, 0x32, 0x40, 0x49, 0x03, 0x80, 0x32, 0x0a, 0x49, 0xaa, 0x32, 0xe0, 0x48, 0xe0, 0x32, 0xe0, 0x48, 0x03, 0x16, 0x33,
+    0xe0, 0x48, 0x40, 0x33, 0x0a, 0x49, 0x40, 0x33, 0x40, 0x49, 0x04, 0x01, 0x03, 0x5e, 0x01, 0x1e, 0x52, 0x04, 0xe0, 0x06, 0x06, 0x09, 0xc5, 0x80,
+    0x80, 0x5d, 0xff, 0x60, 0xff, 0xa3, 0x00, 0xa0, 0x00, 0x09, 0x00, 0x07, 0x5e, 0xff, 0x62, 0xff, 0x43, 0x01, 0x3d, 0x01, 0x02, 0x06, 0x18, 0xc7,
+    0x7f, 0x80, 0xff, 0x0d, 0xdf, 0x55, 0x41, 0x11, 0x21, 0x59, 0x09, 0x00, 0x07, 0x00, 0x0e, 0xe0, 0x55, 0x40, 0x03, 0x40, 0x03, 0x06, 0x2b, 0xc8,
+    0x80, 0x80, 0x1f, 0x48, 0x9f, 0xfd, 0xe1, 0x4d, 0x61, 0x03, 0x09, 0x00, 0x07, 0x20, 0x48, 0xa0, 0xfd, 0xc0, 0x05, 0xc0, 0x05, 0x06, 0x1b, 0xc8,
+    0x80, 0x80, 0xff, 0x49, 0x5f, 0x05, 0x81, 0x50, 0xe1, 0x0b, 0x09, 0x00, 0x07, 0x00, 0x4a, 0x60, 0x05, 0x80, 0x06, 0x80, 0x06, 0x06, 0x26, 0xc2,
+    0x7f, 0x80, 0x9f, 0x19, 0x1f, 0x46, 0x21, 0x1a, 0xa1, 0x46, 0x09, 0x00, 0x07, 0xa0, 0x19, 0x20, 0x46, 0x80, 0x00, 0x80, 0x00, 0x01, 0x03, 0x9e,
+    0x40, 0x1e, 0x56, 0x04, 0xe0, 0x06, 0x06, 0x21, 0xc5, 0x80, 0x80, 0x5d, 0xff, 0x60, 0xff, 0xa3, 0x00, 0xa0, 0x00, 0x09, 0x00, 0x07, 0x5e, 0xff,
+    0x62, 0xff, 0x43, 0x01, 0x3d, 0x01, 0x02, 0x06, 0x1a, 0xc5, 0x80, 0x80, 0xbf, 0x10, 0x1f, 0x5e, 0xc1, 0x11, 0x21, 0x5f, 0x09, 0x00, 0x07, 0xc0,
+    0x10, 0x20, 0x5e, 0x00, 0x01, 0x00, 0x01, 0x06, 0x0f, 0xc8, 0x80, 0x7f, 0x9b, 0x13, 0x3f, 0xfd, 0x21, 0x19, 0xbe, 0x02, 0x09, 0x00, 0x07, 0x9d,
+    0x13, 0x40, 0xfd, 0x83, 0x05, 0x7d, 0x05, 0x06, 0x0b, 0xc2, 0x80, 0x80, 0xff, 0x39, 0x5f, 0x50, 0x81, 0x3a, 0xe1, 0x50, 0x09, 0x00, 0x07, 0x00,
+    0x3a, 0x60, 0x50, 0x80, 0x00, 0x80, 0x00, 0x06, 0x2b, 0xc7, 0x80, 0x80, 0xfd, 0x03, 0x00, 0x58, 0x03, 0x07, 0x00, 0x5b, 0x09, 0x00, 0x07, 0xfe,
+    0x03, 0x02, 0x58, 0x03, 0x03, 0xfd, 0x02, 0x01, 0x03, 0x9e, 0x0a, 0x1e, 0x34, 0x04, 0xe0, 0x06, 0x06, 0x26, 0xc5, 0x80, 0x80, 0x5d, 0xff, 0x60,
+    0xff, 0xa3, 0x00, 0xa0, 0x00, 0x09, 0x00, 0x07, 0x5e, 0xff, 0x62, 0xff, 0x43, 0x01, 0x3d, 0x01, 0x02, 0x06, 0x2c, 0xc7, 0x80, 0x80, 0x5f, 0x3b,
+    0x3f, 0x47, 0x21, 0x3e, 0x01, 0x4a, 0x09, 0x00, 0x07, 0x60, 0x3b, 0x40, 0x47, 0xc0, 0x02, 0xc0, 0x02, 0x06, 0x30, 0xc5, 0x7f, 0x7f, 0xff, 0x02,
+    0xbf, 0x52, 0xc1, 0x03, 0x81, 0x53, 0x3a, 0x00, 0x01, 0xc0, 0x03, 0x20, 0x53, 0x03, 0xc0, 0x03, 0x56, 0x53, 0x96, 0x03, 0x80, 0x53, 0x60, 0x03,
+    0x80, 0x53, 0x03, 0x2a, 0x03, 0x80, 0x53, 0x00, 0x03, 0x56, 0x53, 0x00, 0x03, 0x20, 0x53, 0x03, 0x00, 0x03, 0xea, 0x52, 0x2a, 0x03, 0xc0, 0x52,
+    0x60, 0x03, 0xc0, 0x52, 0x03, 0x96, 0x03, 0xc0, 0x52, 0xc0, 0x03, 0xea, 0x52, 0xc0, 0x03, 0x20, 0x53, 0x04, 0x06, 0x1c, 0xc7, 0x80, 0x80, 0x3d,
+    0x02, 0x20, 0x33, 0xc3, 0x05, 0xa0, 0x36, 0x09, 0x00, 0x07, 0x3e, 0x02, 0x22, 0x33, 0x83, 0x03, 0x7d, 0x03, 0x06, 0x02, 0xc7, 0x80, 0x80, 0x9f,
+    0x48, 0x3f, 0x56, 0xa1, 0x4a, 0x41, 0x58, 0x09, 0x00, 0x07, 0xa0, 0x48, 0x40, 0x56, 0x00, 0x02, 0x00, 0x02, 0x06, 0x17, 0xc5, 0x7f, 0x7f, 0xbf,
+    0x37, 0x9f, 0x3f, 0x81, 0x38, 0x61, 0x40, 0x3a, 0x00, 0x01, 0x80, 0x38, 0x00, 0x40, 0x03, 0x80, 0x38, 0x36, 0x40, 0x56, 0x38, 0x60, 0x40, 0x20,
+    0x38, 0x60, 0x40, 0x03, 0xea, 0x37, 0x60, 0x40, 0xc0, 0x37, 0x36, 0x40, 0xc0, 0x37, 0x00, 0x40, 0x03, 0xc0, 0x37, 0xca, 0x3f, 0xea, 0x37, 0xa0,
+    0x3f, 0x20, 0x38, 0xa0, 0x3f, 0x03, 0x56, 0x38, 0xa0, 0x3f, 0x80, 0x38, 0xca, 0x3f, 0x80, 0x38, 0x00, 0x40, 0x04, 0x01, 0x03, 0xbe, 0x5a, 0x9e,
+    0x5d, 0x04, 0xe0, 0x06, 0x06, 0x0b, 0xc5, 0x80, 0x80, 0x5d, 0xff, 0x60, 0xff, 0xa3, 0x00, 0xa0, 0x00, 0x09, 0x00, 0x07, 0x5e, 0xff, 0x62, 0xff,
+    0x43, 0x01, 0x3d, 0x01, 0x02, 0x06, 0x13, 0xc6, 0x80, 0x7f, 0x9b, 0x27, 0x1f, 0x50, 0x61, 0x29, 0xde, 0x51, 0x09, 0x00, 0x07, 0x9d, 0x27, 0x20,
+    0x50, 0xc3, 0x01, 0xbd, 0x01, 0x06, 0x1b, 0xc8, 0x80, 0x80, 0x9f, 0x11, 0xdf, 0x11, 0xe1, 0x16, 0x21, 0x17, 0x09, 0x00, 0x07, 0xa0, 0x11, 0xe0,
+    0x11, 0x40, 0x05, 0x40, 0x05, 0x06, 0x1d, 0xc5, 0x80, 0x80, 0x5f, 0x23, 0x3f, 0x2b, 0x21, 0x24, 0x01, 0x2c, 0x3a, 0x00, 0x01, 0x20, 0x24, 0xa0,
+    0x2b, 0x03, 0x20, 0x24, 0xd6, 0x2b, 0xf6, 0x23, 0x00, 0x2c, 0xc0, 0x23, 0x00, 0x2c, 0x03, 0x8a, 0x23, 0x00, 0x2c, 0x60, 0x23, 0xd6, 0x2b, 0x60,
+    0x23, 0xa0, 0x2b, 0x03, 0x60, 0x23, 0x6a, 0x2b, 0x8a, 0x23, 0x40, 0x2b, 0xc0, 0x23, 0x40, 0x2b, 0x03, 0xf6, 0x23, 0x40, 0x2b, 0x20, 0x24, 0x6a,
+    0x2b, 0x20, 0x24, 0xa0, 0x2b, 0x04, 0x06, 0x1b, 0xc6, 0x80, 0x80, 0x1d, 0x4a, 0x80, 0x50, 0x63, 0x4c, 0xc0, 0x52, 0x09, 0x00, 0x07, 0x1e, 0x4a,
+    0x82, 0x50, 0x43, 0x02, 0x3d, 0x02, 0x06, 0x2e, 0xc2, 0x80, 0x80, 0xbf, 0x39, 0xdf, 0x39, 0x41, 0x3a, 0x61, 0x3a, 0x09, 0x00, 0x07, 0xc0, 0x39,
+    0xe0, 0x39, 0x80, 0x00, 0x80, 0x00, 0x06, 0x06, 0xc2, 0x80, 0x80, 0x7f, 0x29, 0xff, 0x40, 0x01, 0x2a, 0x81, 0x41, 0x09, 0x00, 0x07, 0x80, 0x29,
+    0x00, 0x41, 0x80, 0x00, 0x80, 0x00, 0x06, 0x06, 0xc8, 0x80, 0x80, 0xbf, 0x0e, 0x3f, 0x12, 0x81, 0x13, 0x01, 0x17, 0x09, 0x00, 0x07, 0xc0, 0x0e,
+    0x40, 0x12, 0xc0, 0x04, 0xc0, 0x04, 0x06, 0x24, 0xc7, 0x80, 0x80, 0x1f, 0x40, 0xbf, 0x21, 0xe1, 0x43, 0x81, 0x25, 0x09, 0x00, 0x07, 0x20, 0x40,
+    0xc0, 0x21, 0xc0, 0x03, 0xc0, 0x03, 0x06, 0x19, 0xc8, 0x80, 0x80, 0x7d, 0x40, 0x00, 0xfc, 0x43, 0x49, 0xc0, 0x04, 0x09, 0x00, 0x07, 0x7e, 0x40,
+    0x02, 0xfc, 0xc3, 0x08, 0xbd, 0x08, 0x06, 0x16, 0xc8, 0x80, 0x80, 0x3f, 0x58, 0xbf, 0x22, 0x81, 0x5d, 0x01, 0x28, 0x09, 0x00, 0x07, 0x40, 0x58,
+    0xc0, 0x22, 0x40, 0x05, 0x40, 0x05, 0x01, 0x03, 0x5e, 0x5f, 0xfe, 0x3f, 0x04, 0xe0, 0x06, 0x06, 0x31, 0xc5, 0x80, 0x80, 0x5d, 0xff, 0x60, 0xff,
+    0xa3, 0x00, 0xa0, 0x00, 0x09, 0x00, 0x07, 0x5e, 0xff, 0x62, 0xff, 0x43, 0x01, 0x3d, 0x01, 0x02, 0x06, 0x29, 0xc5, 0x80, 0x80, 0x7f, 0x20, 0xbf,
+    0x33, 0x41, 0x21, 0x81, 0x34, 0x3a, 0x00, 0x01, 0x40, 0x21, 0x20, 0x34, 0x03, 0x40, 0x21, 0x56, 0x34, 0x16, 0x21, 0x80, 0x34, 0xe0, 0x20, 0x80,
+    0x34, 0x03, 0xaa, 0x20, 0x80, 0x34, 0x80, 0x20, 0x56, 0x34, 0x80, 0x20, 0x20, 0x34, 0x03, 0x80, 0x20, 0xea, 0x33, 0xaa, 0x20, 0xc0, 0x33, 0xe0,
+    0x20, 0xc0, 0x33, 0x03, 0x16, 0x21, 0xc0, 0x33, 0x40, 0x21, 0xea, 0x33, 0x40, 0x21, 0x20, 0x34, 0x04, 0x01, 0x03, 0x7e, 0x12, 0x1e, 0x4b, 0x04,
+    0xe0, 0x06, 0x06, 0x19, 0xc5, 0x80, 0x80, 0x5d, 0xff, 0x60, 0xff, 0xa3, 0x00, 0xa0, 0x00, 0x09, 0x00, 0x07, 0x5e, 0xff, 0x62, 0xff, 0x43, 0x01,
+    0x3d, 0x01, 0x02, 0x06, 0x14, 0xc7, 0x80, 0x80, 0xdf, 0x39, 0x3f, 0x3d, 0x61, 0x3c, 0xc1, 0x3f, 0x09, 0x00, 0x07, 0xe0, 0x39, 0x40, 0x3d, 0x80,
+    0x02, 0x80, 0x02, 0x06, 0x30, 0xc7, 0x80, 0x80, 0x7f, 0x21, 0xdf, 0x11, 0x81, 0x23, 0xe1, 0x13, 0x09, 0x00, 0x07, 0x80, 0x21, 0xe0, 0x11, 0x00,
+    0x02, 0x00, 0x02, 0x06, 0x30, 0xc6, 0x80, 0x80, 0xbf, 0x29, 0x1f, 0x57, 0x41, 0x2b, 0xa1, 0x58, 0x09, 0x00, 0x07, 0xc0, 0x29, 0x20, 0x57, 0x80,
+    0x01, 0x80, 0x01, 0x06, 0x1b, 0xc6, 0x7f, 0x80, 0xbf, 0x15, 0x3f, 0x32, 0x41, 0x17, 0xc1, 0x33, 0x09, 0x00, 0x07, 0xc0, 0x15, 0x40, 0x32, 0x80,
+    0x01, 0x80, 0x01, 0x06, 0x10, 0xc7, 0x80, 0x80, 0xbf, 0x03, 0xdf, 0x18, 0x01, 0x07, 0x21, 0x1c, 0x09, 0x00, 0x07, 0xc0, 0x03, 0xe0, 0x18, 0x40,
+    0x03, 0x40, 0x03, 0x06, 0x18, 0xc8, 0x80, 0x80, 0x7f, 0x25, 0x5f, 0x0b, 0x81, 0x2b, 0x61, 0x11, 0x09, 0x00, 0x07, 0x80, 0x25, 0x60, 0x0b, 0x00,
+    0x06, 0x00, 0x06, 0x06, 0x20, 0xc8, 0x80, 0x80, 0x9f, 0x48, 0x3f, 0x34, 0x61, 0x4d, 0x01, 0x39, 0x09, 0x00, 0x07, 0xa0, 0x48, 0x40, 0x34, 0xc0,
+    0x04, 0xc0, 0x04, 0x06, 0x15, 0xc5, 0x80, 0x80, 0x9f, 0x29, 0x1f, 0x34, 0xa1, 0x2a, 0x21, 0x35, 0x09, 0x00, 0x07, 0xa0, 0x29, 0x20, 0x34, 0x00,
+    0x01, 0x00, 0x01, 0x06, 0x16, 0xc2, 0x80, 0x80, 0x3f, 0x0a, 0x5f, 0x42, 0xc1, 0x0a, 0xe1, 0x42, 0x09, 0x00, 0x07, 0x40, 0x0a, 0x60, 0x42, 0x80,
+    0x00, 0x80, 0x00, 0x06, 0x14, 0xc2, 0x80, 0x80, 0xbf, 0x09, 0x9f, 0x40, 0x41, 0x0a, 0x21, 0x41, 0x09, 0x00, 0x07, 0xc0, 0x09, 0xa0, 0x40, 0x80,
+    0x00, 0x80, 0x00, 0x06, 0x18, 0xc6, 0x80, 0x80, 0x3d, 0x1f, 0x80, 0x16, 0x83, 0x21, 0xc0, 0x18, 0x09, 0x00, 0x07, 0x3e, 0x1f, 0x82, 0x16, 0x43,
+    0x02, 0x3d, 0x02, 0x06, 0x1b, 0xc7, 0x7f, 0x80, 0x1f, 0x01, 0x82, 0x56, 0xa5, 0x05, 0x01, 0x5b, 0x09, 0x00, 0x07, 0x20, 0x01, 0x83, 0x56, 0x83,
+    0x04, 0x7d, 0x04, 0x06, 0x06, 0xc7, 0x80, 0x80, 0x5f, 0x00, 0xdf, 0x4c, 0xe1, 0x02, 0x61, 0x4f, 0x09, 0x00, 0x07, 0x60, 0x00, 0xe0, 0x4c, 0x80,
+    0x02, 0x80, 0x02, 0x01, 0x03, 0x5e, 0x2f, 0xde, 0x5b, 0x04, 0xe0, 0x06, 0x06, 0x0b, 0xc5, 0x80, 0x80, 0x5d, 0xff, 0x60, 0xff, 0xa3, 0x00, 0xa0,
+    0x00, 0x09, 0x00, 0x07, 0x5e, 0xff, 0x62, 0xff, 0x43, 0x01, 0x3d, 0x01, 0x02, 0x06, 0x06, 0xc6, 0x80, 0x7f, 0x5b, 0x0b, 0xbf, 0x53, 0x21, 0x0d,
+    0x7e, 0x55, 0x09, 0x00, 0x07, 0x5d, 0x0b, 0xc0, 0x53, 0xc3, 0x01, 0xbd, 0x01, 0x06, 0x02, 0xc5, 0x80, 0x80, 0xdf, 0x38, 0xdf, 0x2c, 0xe1, 0x39,
+    0xe1, 0x2d, 0x09, 0x00, 0x07, 0xe0, 0x38, 0xe0, 0x2c, 0x00, 0x01, 0x00, 0x01, 0x06, 0x1d, 0xc8, 0x80, 0x80, 0x7f, 0x5c, 0x3f, 0x2d, 0xc1, 0x62,
+    0x81, 0x33, 0x09, 0x00, 0x07, 0x80, 0x5c, 0x40, 0x2d, 0x40, 0x06, 0x40, 0x06, 0x06, 0x26, 0xc7, 0x80, 0x80, 0x1f, 0x39, 0xff, 0x3f, 0xe1, 0x3b,
+    0xc1, 0x42, 0x09, 0x00, 0x07, 0x20, 0x39, 0x00, 0x40, 0xc0, 0x02, 0xc0, 0x02, 0x06, 0x10, 0xc5, 0x80, 0x80, 0xff, 0x14, 0x1f, 0x58, 0x01, 0x16,
+    0x21, 0x59, 0x09, 0x00, 0x07, 0x00, 0x15, 0x20, 0x58, 0x00, 0x01, 0x00, 0x01, 0x06, 0x1b, 0xc6, 0x80, 0x7f, 0xfb, 0x45, 0xff, 0x59, 0xc1, 0x47,
+    0xbe, 0x5b, 0x09, 0x00, 0x07, 0xfd, 0x45, 0x00, 0x5a, 0xc3, 0x01, 0xbd, 0x01, 0x06, 0x06, 0xc6, 0x80, 0x80, 0xbf, 0x31, 0xdf, 0x0f, 0x41, 0x33,
+    0x61, 0x11, 0x09, 0x00, 0x07, 0xc0, 0x31, 0xe0, 0x0f, 0x80, 0x01, 0x80, 0x01, 0x06, 0x1a, 0xc8, 0x80, 0x80, 0xbf, 0x01, 0xff, 0x10, 0x81, 0x07,
+    0xc1, 0x16, 0x09, 0x00, 0x07, 0xc0, 0x01, 0x00, 0x11, 0xc0, 0x05, 0xc0, 0x05, 0x06, 0x1d, 0xc8, 0x80, 0x80, 0x9d, 0x3c, 0x00, 0x04, 0x23, 0x44,
+    0x80, 0x0b, 0x09, 0x00, 0x07, 0x9e, 0x3c, 0x02, 0x04, 0x83, 0x07, 0x7d, 0x07, 0x06, 0x1b, 0xc2, 0x80, 0x80, 0xff, 0x11, 0x5f, 0x43, 0x81, 0x12,
+    0xe1, 0x43, 0x09, 0x00, 0x07, 0x00, 0x12, 0x60, 0x43, 0x80, 0x00, 0x80, 0x00, 0x06, 0x28, 0xc8, 0x80, 0x80, 0x9f, 0x49, 0x5f, 0x56, 0x61, 0x4f,
+    0x21, 0x5c, 0x09, 0x00, 0x07, 0xa0, 0x49, 0x60, 0x56, 0xc0, 0x05, 0xc0, 0x05, 0x01, 0x03, 0xfe, 0x16, 0xfe, 0x0e, 0x04, 0xe0, 0x06, 0x06, 0x1a,
+    0xc5, 0x80, 0x80, 0x5d, 0xff, 0x60, 0xff, 0xa3, 0x00, 0xa0, 0x00, 0x09, 0x00, 0x07, 0x5e, 0xff, 0x62, 0xff, 0x43, 0x01, 0x3d, 0x01, 0x02, 0x01,
+    0x03, 0x9e, 0x13, 0x1e, 0x37, 0x04, 0xe0, 0x06, 0x06, 0x1a, 0xc5, 0x80, 0x80, 0x5d, 0xff, 0x60, 0xff, 0xa3, 0x00, 0xa0, 0x00, 0x09, 0x00, 0x07,
+    0x5e, 0xff, 0x62, 0xff, 0x43, 0x01, 0x3d, 0x01, 0x02, 0x06, 0x06, 0xc7, 0x80, 0x80, 0xff, 0x42, 0x9f, 0x22, 0x41, 0x46, 0xe1, 0x25, 0x09, 0x00,
+    0x07, 0x00, 0x43, 0xa0, 0x22, 0x40, 0x03, 0x40, 0x03, 0x06, 0x20, 0xc6, 0x80, 0x80, 0x7d, 0x0e, 0xe0, 0x33, 0xc3, 0x10, 0x20, 0x36, 0x09, 0x00,
+    0x07, 0x7e, 0x0e, 0xe2, 0x33, 0x43, 0x02, 0x3d, 0x02, 0x01, 0x03, 0x9e, 0x17, 0xde, 0x2f, 0x04, 0xe0, 0x06, 0x06, 0x29, 0xc5, 0x80, 0x80, 0x5d,
+    0xff, 0x60, 0xff, 0xa3, 0x00, 0xa0, 0x00, 0x09, 0x00, 0x07, 0x5e, 0xff, 0x62, 0xff, 0x43, 0x01, 0x3d, 0x01, 0x02, 0x06, 0x15, 0xc6, 0x80, 0x80,
+    0x9f, 0x2c, 0xff, 0x29, 0x21, 0x2e, 0x81, 0x2b, 0x09, 0x00, 0x07, 0xa0, 0x2c, 0x00, 0x2a, 0x80, 0x01, 0x80, 0x01, 0x06, 0x21, 0xc2, 0x80, 0x80,
+    0xff, 0x09, 0x5f, 0x26, 0x81, 0x0a, 0xe1, 0x26, 0x09, 0x00, 0x07, 0x00, 0x0a, 0x60, 0x26, 0x80, 0x00, 0x80, 0x00, 0x06, 0x1b, 0xc8, 0x80, 0x7f,
+    0x3b, 0xfe, 0xff, 0x10, 0x41, 0x04, 0xfe, 0x16, 0x09, 0x00, 0x07, 0x3d, 0xfe, 0x00, 0x11, 0x03, 0x06, 0xfd, 0x05, 0x06, 0x30, 0xc8, 0x80, 0x80,
+    0xbf, 0x47, 0xff, 0x44, 0x81, 0x4c, 0xc1, 0x49, 0x09, 0x00, 0x07, 0xc0, 0x47, 0x00, 0x45, 0xc0, 0x04, 0xc0, 0x04, 0x06, 0x02, 0xc7, 0x80, 0x80,
+    0x1f, 0x13, 0x3f, 0x2b, 0xa1, 0x15, 0xc1, 0x2d, 0x09, 0x00, 0x07, 0x20, 0x13, 0x40, 0x2b, 0x80, 0x02, 0x80, 0x02, 0x06, 0x2c, 0xc7, 0x80, 0x80,
+    0xff, 0x0c, 0x1f, 0x12, 0x81, 0x0f, 0xa1, 0x14, 0x09, 0x00, 0x07, 0x00, 0x0d, 0x20, 0x12, 0x80, 0x02, 0x80, 0x02, 0x06, 0x1a, 0xc7, 0x80, 0x80,
+    0x1d, 0x2d, 0x40, 0x5e, 0xa3, 0x30, 0xc0, 0x61, 0x09, 0x00, 0x07, 0x1e, 0x2d, 0x42, 0x5e, 0x83, 0x03, 0x7d, 0x03, 0x06, 0x09, 0xc8, 0x80, 0x80,
+    0xbf, 0x4a, 0x7f, 0x22, 0x41, 0x50, 0x01, 0x28, 0x09, 0x00, 0x07, 0xc0, 0x4a, 0x80, 0x22, 0x80, 0x05, 0x80, 0x05, 0x06, 0x1b, 0xc2, 0x80, 0x80,
+    0x9f, 0x32, 0x1f, 0x4d, 0x21, 0x33, 0xa1, 0x4d, 0x09, 0x00, 0x07, 0xa0, 0x32, 0x20, 0x4d, 0x80, 0x00, 0x80, 0x00, 0x06, 0x30, 0xc8, 0x80, 0x80,
+    0xbf, 0x54, 0xbf, 0xff, 0xc1, 0x5c, 0xc1, 0x07, 0x09, 0x00, 0x07, 0xc0, 0x54, 0xc0, 0xff, 0x00, 0x08, 0x00, 0x08, 0x06, 0x1b, 0xc7, 0x80, 0x80,
+    0x9d, 0x0d, 0xc0, 0x0f, 0xa3, 0x10, 0xc0, 0x12, 0x09, 0x00, 0x07, 0x9e, 0x0d, 0xc2, 0x0f, 0x03, 0x03, 0xfd, 0x02, 0x06, 0x17, 0xc6, 0x80, 0x80,
+    0xff, 0x05, 0xdf, 0x16, 0x81, 0x07, 0x61, 0x18, 0x09, 0x00, 0x07, 0x00, 0x06, 0xe0, 0x16, 0x80, 0x01, 0x80, 0x01, 0x06, 0x0d, 0xc2, 0x80, 0x80,
+    0xbf, 0x16, 0x5f, 0x40, 0x41, 0x17, 0xe1, 0x40, 0x09, 0x00, 0x07, 0xc0, 0x16, 0x60, 0x40, 0x80, 0x00, 0x80, 0x00, 0x06, 0x30, 0xc7, 0x80, 0x7f,
+    0x1f, 0x5e, 0x5f, 0x3a, 0xa1, 0x60, 0xe1, 0x3c, 0x09, 0x00, 0x07, 0x20, 0x5e, 0x60, 0x3a, 0x80, 0x02, 0x80, 0x02, 0x06, 0x04, 0xc5, 0x7f, 0x7f,
+    0xdf, 0x51, 0x7f, 0x2e, 0xa1, 0x52, 0x41, 0x2f, 0x3a, 0x00, 0x01, 0xa0, 0x52, 0xe0, 0x2e, 0x03, 0xa0, 0x52, 0x16, 0x2f, 0x76, 0x52, 0x40, 0x2f,
+    0x40, 0x52, 0x40, 0x2f, 0x03, 0x0a, 0x52, 0x40, 0x2f, 0xe0, 0x51, 0x16, 0x2f, 0xe0, 0x51, 0xe0, 0x2e, 0x03, 0xe0, 0x51, 0xaa, 0x2e, 0x0a, 0x52,
+    0x80, 0x2e, 0x40, 0x52, 0x80, 0x2e, 0x03, 0x76, 0x52, 0x80, 0x2e, 0xa0, 0x52, 0xaa, 0x2e, 0xa0, 0x52, 0xe0, 0x2e, 0x04, 0x06, 0x04, 0xc7, 0x80,
+    0x80, 0xbf, 0x03, 0x1f, 0x29, 0xc1, 0x05, 0x21, 0x2b, 0x09, 0x00, 0x07, 0xc0, 0x03, 0x20, 0x29, 0x00, 0x02, 0x00, 0x02, 0x06, 0x1b, 0xc6, 0x80,
+    0x80, 0x1f, 0x2b, 0xdf, 0x38, 0xa1, 0x2c, 0x61, 0x3a, 0x09, 0x00, 0x07, 0x20, 0x2b, 0xe0, 0x38, 0x80, 0x01, 0x80, 0x01, 0x06, 0x1a, 0xc6, 0x80,
+    0x80, 0x9f, 0x1f, 0x3f, 0x10, 0x21, 0x21, 0xc1, 0x11, 0x09, 0x00, 0x07, 0xa0, 0x1f, 0x40, 0x10, 0x80, 0x01, 0x80, 0x01, 0x06, 0x1b, 0xc8, 0x80,
+    0x80, 0xdf, 0x3b, 0x3f, 0x07, 0x21, 0x40, 0x81, 0x0b, 0x09, 0x00, 0x07, 0xe0, 0x3b, 0x40, 0x07, 0x40, 0x04, 0x40, 0x04, 0x06, 0x01, 0xc8, 0x80,
+    0x80, 0x7f, 0x44, 0x7f, 0x23, 0xc1, 0x48, 0xc1, 0x27, 0x09, 0x00, 0x07, 0x80, 0x44, 0x80, 0x23, 0x40, 0x04, 0x40, 0x04, 0x06, 0x1b, 0xc5, 0x80,
+    0x80, 0xbf, 0x29, 0xdf, 0x5e, 0xc1, 0x2a, 0xe1, 0x5f, 0x09, 0x00, 0x07, 0xc0, 0x29, 0xe0, 0x5e, 0x00, 0x01, 0x00, 0x01, 0x06, 0x1b, 0xc8, 0x7f,
+    0x80, 0xdf, 0x4e, 0xff, 0x58, 0xa1, 0x54, 0xc1, 0x5e, 0x09, 0x00, 0x07, 0xe0, 0x4e, 0x00, 0x59, 0xc0, 0x05, 0xc0, 0x05, 0x06, 0x17, 0xc5, 0x80,
+    0x80, 0x7f, 0x53, 0x3f, 0x46, 0x81, 0x54, 0x41, 0x47, 0x09, 0x00, 0x07, 0x80, 0x53, 0x40, 0x46, 0x00, 0x01, 0x00, 0x01, 0x06, 0x1b, 0xc7, 0x7f,
+    0x80, 0x1f, 0x52, 0xc2, 0x4b, 0xa5, 0x56, 0x41, 0x50, 0x09, 0x00, 0x07, 0x20, 0x52, 0xc3, 0x4b, 0x83, 0x04, 0x7d, 0x04, 0x06, 0x05, 0xc6, 0x80,
+    0x7f, 0x1b, 0x1a, 0xbf, 0x16, 0xe1, 0x1b, 0x7e, 0x18, 0x09, 0x00, 0x07, 0x1d, 0x1a, 0xc0, 0x16, 0xc3, 0x01, 0xbd, 0x01, 0x06, 0x09, 0xff, 0x80,
+    0x80, 0x9f, 0xfd, 0x1f, 0x28, 0xa1, 0x48, 0xe1, 0x44, 0x0b, 0x00, 0x06, 0xa0, 0xfd, 0x20, 0x28, 0x00, 0x4b, 0xc0, 0x1c, 0xe0, 0x01, 0x01, 0x08,
+    0x00, 0x01, 0x40, 0x32, 0xa0, 0x02, 0x20, 0x2d, 0xa0, 0x42, 0xa0, 0x07, 0x02, 0x01, 0x08, 0x01, 0x00, 0x18, 0x32, 0xa0, 0x02, 0xc0, 0x37, 0xa0,
+    0x42, 0xe0, 0x03, 0x02, 0x01, 0x08, 0x02, 0x02, 0x18, 0x32, 0xa0, 0x02, 0x00, 0x3c, 0xa0, 0x42, 0xe0, 0x03, 0x02, 0x35, 0xff, 0x00, 0x00, 0x00,
+    0x89, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00, 0x33, 0x00, 0x80, 0x00, 0x99, 0x00, 0x4c, 0x00, 0xcc, 0x00, 0xb2, 0x00, 0xff, 0x00, 0x66, 0x00, 0x1a,
+    0x00, 0xe6, 0x01, 0x33, 0x01, 0xff, 0x01, 0x66, 0x01, 0x1a, 0x01, 0xb2, 0x01, 0x99, 0x01, 0xe6, 0x01, 0x80, 0x01, 0x4c, 0x01, 0xcc, 0x02, 0x1a,
+    0x02, 0xe6, 0x02, 0x66, 0x02, 0xcc, 0x02, 0x80, 0x02, 0x33, 0x02, 0x4c, 0x02, 0xff, 0x02, 0xb2, 0x02, 0x99, 0x03, 0x4c, 0x03, 0x1a, 0x03, 0x33,
+    0x03, 0xe6, 0x03, 0xb2, 0x03, 0x99, 0x03, 0x80, 0x03, 0xcc, 0x03, 0xff, 0x03, 0x66, 0x04, 0x33, 0x04, 0x4c, 0x04, 0x66, 0x04, 0x99, 0x04, 0x80,
+    0x04, 0xb2, 0x04, 0xe6, 0x04, 0xcc, 0x04, 0xff, 0x04, 0x1a, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0x02, 0x08, 0x00, 0x00, 0x01, 0xff, 0xff, 0x22,
+    0x44, 0x00, 0x00, 0x01, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x60, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x60, 0x03,
+    0x02, 0x06, 0x09, 0xc7, 0x7f, 0x80, 0x5f, 0x47, 0x42, 0x2f, 0x65, 0x4b, 0x41, 0x33, 0x09, 0x00, 0x07, 0x60, 0x47, 0x43, 0x2f, 0x03, 0x04, 0xfd,
+    0x03, 0x06, 0x32, 0xc7, 0x7f, 0x80, 0x1f, 0x36, 0x82, 0x39, 0x25, 0x3a, 0x81, 0x3d, 0x09, 0x00, 0x07, 0x20, 0x36, 0x83, 0x39, 0x03, 0x04, 0xfd,
+    0x03, 0x06, 0x1e, 0xc7, 0x80, 0x80, 0x3d, 0x16, 0x20, 0x2d, 0xc3, 0x19, 0xa0, 0x30, 0x09, 0x00, 0x07, 0x3e, 0x16, 0x22, 0x2d, 0x83, 0x03, 0x7d,
+    0x03, 0x06, 0x1f, 0xc5, 0x80, 0x80, 0xbf, 0x0f, 0xbf, 0x22, 0x81, 0x10, 0x81, 0x23, 0x3a, 0x00, 0x01, 0x80, 0x10, 0x20, 0x23, 0x03, 0x80, 0x10,
+    0x56, 0x23, 0x56, 0x10, 0x80, 0x23, 0x20, 0x10, 0x80, 0x23, 0x03, 0xea, 0x0f, 0x80, 0x23, 0xc0, 0x0f, 0x56, 0x23, 0xc0, 0x0f, 0x20, 0x23, 0x03,
+    0xc0, 0x0f, 0xea, 0x22, 0xea, 0x0f, 0xc0, 0x22, 0x20, 0x10, 0xc0, 0x22, 0x03, 0x56, 0x10, 0xc0, 0x22, 0x80, 0x10, 0xea, 0x22, 0x80, 0x10, 0x20,
+    0x23, 0x04, 0x06, 0x02, 0xc5, 0x80, 0x80, 0xbf, 0x41, 0xff, 0x43, 0xc1, 0x42, 0x01, 0x45, 0x09, 0x00, 0x07, 0xc0, 0x41, 0x00, 0x44, 0x00, 0x01,
+    0x00, 0x01, 0x06, 0x18, 0xc5, 0x80, 0x80, 0x9f, 0x4e, 0xbf, 0x19, 0xa1, 0x4f, 0xc1, 0x1a, 0x09, 0x00, 0x07, 0xa0, 0x4e, 0xc0, 0x19, 0x00, 0x01,
+    0x00, 0x01, 0x06, 0x2f, 0xc6, 0x80, 0x80, 0x3d, 0x24, 0xa0, 0x14, 0x83, 0x26, 0xe0, 0x16, 0x09, 0x00, 0x07, 0x3e, 0x24, 0xa2, 0x14, 0x43, 0x02,
+    0x3d, 0x02, 0x06, 0x24, 0xc2, 0x7f, 0x80, 0xbf, 0x0a, 0x3f, 0x46, 0x41, 0x0b, 0xc1, 0x46, 0x09, 0x00, 0x07, 0xc0, 0x0a, 0x40, 0x46, 0x80, 0x00,
+    0x80, 0x00, 0x06, 0x11, 0xc8, 0x80, 0x80, 0xff, 0x40, 0x5f, 0x23, 0x41, 0x47, 0xa1, 0x29, 0x09, 0x00, 0x07, 0x00, 0x41, 0x60, 0x23, 0x40, 0x06,
+    0x40, 0x06, 0x06, 0x13, 0xc5, 0x80, 0x80, 0x7f, 0x16, 0x9f, 0x01, 0x41, 0x17, 0x61, 0x02, 0x3a, 0x00, 0x01, 0x40, 0x17, 0x00, 0x02, 0x03, 0x40,
+    0x17, 0x36, 0x02, 0x16, 0x17, 0x60, 0x02, 0xe0, 0x16, 0x60, 0x02, 0x03, 0xaa, 0x16, 0x60, 0x02, 0x80, 0x16, 0x36, 0x02, 0x80, 0x16, 0x00, 0x02,
+    0x03, 0x80, 0x16, 0xca, 0x01, 0xaa, 0x16, 0xa0, 0x01, 0xe0, 0x16, 0xa0, 0x01, 0x03, 0x16, 0x17, 0xa0, 0x01, 0x40, 0x17, 0xca, 0x01, 0x40, 0x17,
+    0x00, 0x02, 0x04, 0x06, 0x19, 0xc7, 0x80, 0x80, 0x3f, 0x48, 0xff, 0x45, 0xc1, 0x4a, 0x81, 0x48, 0x09, 0x00, 0x07, 0x40, 0x48, 0x00, 0x46, 0x80,
+    0x02, 0x80, 0x02, 0x06, 0x21, 0xc7, 0x80, 0x80, 0xfd, 0x28, 0x60, 0x41, 0x03, 0x2c, 0x60, 0x44, 0x09, 0x00, 0x07, 0xfe, 0x28, 0x62, 0x41, 0x03,
+    0x03, 0xfd, 0x02, 0x06, 0x1a, 0xc8, 0x80, 0x7f, 0x9f, 0x3f, 0x1f, 0x1d, 0x21, 0x45, 0xa1, 0x22, 0x09, 0x00, 0x07, 0xa0, 0x3f, 0x20, 0x1d, 0x80,
+    0x05, 0x80, 0x05, 0x06, 0x18, 0xc6, 0x80, 0x7f, 0x9b, 0x55, 0xbf, 0x59, 0x61, 0x57, 0x7e, 0x5b, 0x09, 0x00, 0x07, 0x9d, 0x55, 0xc0, 0x59, 0xc3,
+    0x01, 0xbd, 0x01, 0x06, 0x12, 0xc5, 0x80, 0x80, 0x9f, 0x07, 0xdf, 0x41, 0xa1, 0x08, 0xe1, 0x42, 0x09, 0x00, 0x07, 0xa0, 0x07, 0xe0, 0x41, 0x00,
+    0x01, 0x00, 0x01, 0x06, 0x0d, 0xc7, 0x80, 0x80, 0x9d, 0x21, 0x80, 0x2e, 0xa3, 0x24, 0x80, 0x31, 0x09, 0x00, 0x07, 0x9e, 0x21, 0x82, 0x2e, 0x03,
+    0x03, 0xfd, 0x02, 0x06, 0x28, 0xc5, 0x7f, 0x7f, 0x5f, 0x23, 0xdf, 0x41, 0x21, 0x24, 0xa1, 0x42, 0x3a, 0x00, 0x01, 0x20, 0x24, 0x40, 0x42, 0x03,
+    0x20, 0x24, 0x76, 0x42, 0xf6, 0x23, 0xa0, 0x42, 0xc0, 0x23, 0xa0, 0x42, 0x03, 0x8a, 0x23, 0xa0, 0x42, 0x60, 0x23, 0x76, 0x42, 0x60, 0x23, 0x40,
+    0x42, 0x03, 0x60, 0x23, 0x0a, 0x42, 0x8a, 0x23, 0xe0, 0x41, 0xc0, 0x23, 0xe0, 0x41, 0x03, 0xf6, 0x23, 0xe0, 0x41, 0x20, 0x24, 0x0a, 0x42, 0x20,
+    0x24, 0x40, 0x42, 0x04, 0x06, 0x16, 0xc7, 0x80, 0x80, 0x3f, 0x1c, 0x5f, 0x48, 0x01, 0x1f, 0x21, 0x4b, 0x09, 0x00, 0x07, 0x40, 0x1c, 0x60, 0x48,
+    0xc0, 0x02, 0xc0, 0x02, 0x06, 0x18, 0xc7, 0x80, 0x80, 0x5f, 0x33, 0x1f, 0x04, 0x61, 0x35, 0x21, 0x06, 0x09, 0x00, 0x07, 0x60, 0x33, 0x20, 0x04,
+    0x00, 0x02, 0x00, 0x02, 0x06, 0x2b, 0xc7, 0x80, 0x80, 0x9f, 0x21, 0x5f, 0x39, 0xe1, 0x24, 0xa1, 0x3c, 0x09, 0x00, 0x07, 0xa0, 0x21, 0x60, 0x39,
+    0x40, 0x03, 0x40, 0x03, 0x06, 0x0d, 0xc7, 0x80, 0x7f, 0xdf, 0x2c, 0xdf, 0x30, 0xa1, 0x30, 0xa1, 0x34, 0x09, 0x00, 0x07, 0xe0, 0x2c, 0xe0, 0x30,
+    0xc0, 0x03, 0xc0, 0x03, 0x06, 0x0c, 0xc7, 0x80, 0x80, 0xbf, 0x36, 0xdf, 0x4c, 0xc1, 0x38, 0xe1, 0x4e, 0x09, 0x00, 0x07, 0xc0, 0x36, 0xe0, 0x4c,
+    0x00, 0x02, 0x00, 0x02, 0x06, 0x18, 0xc7, 0x7f, 0x80, 0xbf, 0x2a, 0xdf, 0x51, 0xc1, 0x2c, 0xe1, 0x53, 0x09, 0x00, 0x07, 0xc0, 0x2a, 0xe0, 0x51,
+    0x00, 0x02, 0x00, 0x02, 0x06, 0x1f, 0xc6, 0x80, 0x80, 0x9f, 0x07, 0x9f, 0x1b, 0x21, 0x09, 0x21, 0x1d, 0x09, 0x00, 0x07, 0xa0, 0x07, 0xa0, 0x1b,
+    0x80, 0x01, 0x80, 0x01, 0x06, 0x21, 0xc5, 0x80, 0x80, 0x1f, 0x10, 0x9f, 0x5f, 0x21, 0x11, 0xa1, 0x60, 0x09, 0x00, 0x07, 0x20, 0x10, 0xa0, 0x5f,
+    0x00, 0x01, 0x00, 0x01, 0x06, 0x08, 0xc5, 0x7f, 0x7f, 0x7f, 0x2b, 0x5f, 0x5b, 0x41, 0x2c, 0x21, 0x5c, 0x3a, 0x00, 0x01, 0x40, 0x2c, 0xc0, 0x5b,
+    0x03, 0x40, 0x2c, 0xf6, 0x5b, 0x16, 0x2c, 0x20, 0x5c, 0xe0, 0x2b, 0x20, 0x5c, 0x03, 0xaa, 0x2b, 0x20, 0x5c, 0x80, 0x2b, 0xf6, 0x5b, 0x80, 0x2b,
+    0xc0, 0x5b, 0x03, 0x80, 0x2b, 0x8a, 0x5b, 0xaa, 0x2b, 0x60, 0x5b, 0xe0, 0x2b, 0x60, 0x5b, 0x03, 0x16, 0x2c, 0x60, 0x5b, 0x40, 0x2c, 0x8a, 0x5b,
+    0x40, 0x2c, 0xc0, 0x5b, 0x04, 0x06, 0x14, 0xc6, 0x80, 0x7f, 0x9b, 0x2c, 0x1f, 0x55, 0x61, 0x2e, 0xde, 0x56, 0x09, 0x00, 0x07, 0x9d, 0x2c, 0x20,
+    0x55, 0xc3, 0x01, 0xbd, 0x01, 0x06, 0x0f, 0xc5, 0x80, 0x80, 0xdf, 0x09, 0x9f, 0x53, 0xe1, 0x0a, 0xa1, 0x54, 0x09, 0x00, 0x07, 0xe0, 0x09, 0xa0,
+    0x53, 0x00, 0x01, 0x00, 0x01, 0x06, 0x32, 0xc5, 0x80, 0x80, 0x5f, 0x0e, 0xdf, 0x5b, 0x21, 0x0f, 0xa1, 0x5c, 0x3a, 0x00, 0x01, 0x20, 0x0f, 0x40,
+    0x5c, 0x03, 0x20, 0x0f, 0x76, 0x5c, 0xf6, 0x0e, 0xa0, 0x5c, 0xc0, 0x0e, 0xa0, 0x5c, 0x03, 0x8a, 0x0e, 0xa0, 0x5c, 0x60, 0x0e, 0x76, 0x5c, 0x60,
+    0x0e, 0x40, 0x5c, 0x03, 0x60, 0x0e, 0x0a, 0x5c, 0x8a, 0x0e, 0xe0, 0x5b, 0xc0, 0x0e, 0xe0, 0x5b, 0x03, 0xf6, 0x0e, 0xe0, 0x5b, 0x20, 0x0f, 0x0a,
+    0x5c, 0x20, 0x0f, 0x40, 0x5c, 0x04, 0x06, 0x0d, 0xc2, 0x80, 0x7f, 0xff, 0x02, 0x1f, 0x01, 0x81, 0x03, 0xa1, 0x01, 0x09, 0x00, 0x07, 0x00, 0x03,
+    0x20, 0x01, 0x80, 0x00, 0x80, 0x00, 0x01, 0x03, 0xde, 0x12, 0x5e, 0x01, 0x04, 0xe0, 0x06, 0x06, 0x29, 0xc5, 0x80, 0x80, 0x5d, 0xff, 0x60, 0xff,
+    0xa3, 0x00, 0xa0, 0x00, 0x09, 0x00, 0x07, 0x5e, 0xff, 0x62, 0xff, 0x43, 0x01, 0x3d, 0x01, 0x02, 0x06, 0x2e, 0xc7, 0x80, 0x80, 0x3f, 0x1e, 0x3f,
+    0x08, 0x81, 0x21, 0x81, 0x0b, 0x09, 0x00, 0x07, 0x40, 0x1e, 0x40, 0x08, 0x40, 0x03, 0x40, 0x03, 0x06, 0x0d, 0xc7, 0x7f, 0x80, 0x7f, 0x48, 0x42,
+    0x39, 0x05, 0x4d, 0xc1, 0x3d, 0x09, 0x00, 0x07, 0x80, 0x48, 0x43, 0x39, 0x83, 0x04, 0x7d, 0x04, 0x01, 0x03, 0x3e, 0x28, 0x1e, 0x1c, 0x04, 0xe0,
+    0x06, 0x06, 0x1c, 0xc5, 0x80, 0x80, 0x5d, 0xff, 0x60, 0xff, 0xa3, 0x00, 0xa0, 0x00, 0x09, 0x00, 0x07, 0x5e, 0xff, 0x62, 0xff, 0x43, 0x01, 0x3d,
+    0x01, 0x02, 0x06, 0x04, 0xc7, 0x80, 0x80, 0xbd, 0x1a, 0x60, 0x2b, 0xc3, 0x1d, 0x60, 0x2e, 0x09, 0x00, 0x07, 0xbe, 0x1a, 0x62, 0x2b, 0x03, 0x03,
+    0xfd, 0x02, 0x06, 0x23, 0xc5, 0x7f, 0x80, 0xff, 0x06, 0xff, 0x57, 0x01, 0x08, 0x01, 0x59, 0x09, 0x00, 0x07, 0x00, 0x07, 0x00, 0x58, 0x00, 0x01,
+    0x00, 0x01, 0x06, 0x18, 0xc7, 0x7f, 0x80, 0x5f, 0x21, 0x42, 0x15, 0xe5, 0x25, 0xc1, 0x19, 0x09, 0x00, 0x07, 0x60, 0x21, 0x43, 0x15, 0x83, 0x04,
+    0x7d, 0x04, 0x06, 0x03, 0xc7, 0x80, 0x80, 0x7d, 0x4c, 0xe0, 0x10, 0x03, 0x50, 0x60, 0x14, 0x09, 0x00, 0x07, 0x7e, 0x4c, 0xe2, 0x10, 0x83, 0x03,
+    0x7d, 0x03, 0x06, 0x1d, 0xc7, 0x80, 0x7f, 0xff, 0x48, 0x7f, 0x16, 0xc1, 0x4c, 0x41, 0x1a, 0x09, 0x00, 0x07, 0x00, 0x49, 0x80, 0x16, 0xc0, 0x03,
+    0xc0, 0x03, 0x06, 0x1d, 0xc6, 0x80, 0x80, 0xff, 0x59, 0xdf, 0x50, 0x81, 0x5b, 0x61, 0x52, 0x09, 0x00, 0x07, 0x00, 0x5a, 0xe0, 0x50, 0x80, 0x01,
+    0x80, 0x01, 0x06, 0x1c, 0xc8, 0x80, 0x80, 0xdf, 0x3c, 0x5f, 0x26, 0xa1, 0x41, 0x21, 0x2b, 0x09, 0x00, 0x07, 0xe0, 0x3c, 0x60, 0x26, 0xc0, 0x04,
+    0xc0, 0x04, 0x06, 0x0d, 0xc5, 0x80, 0x80, 0xdf, 0x47, 0xff, 0x25, 0xe1, 0x48, 0x01, 0x27, 0x09, 0x00, 0x07, 0xe0, 0x47, 0x00, 0x26, 0x00, 0x01,
+    0x00, 0x01, 0x06, 0x28, 0xc5, 0x7f, 0x80, 0x3f, 0x5f, 0x5f, 0x47, 0x41, 0x60, 0x61, 0x48, 0x09, 0x00, 0x07, 0x40, 0x5f, 0x60, 0x47, 0x00, 0x01,
+    0x00, 0x01, 0x01, 0x03, 0xbe, 0x00, 0xfe, 0x1f, 0x04, 0xe0, 0x06, 0x06, 0x19, 0xc5, 0x80, 0x80, 0x5d, 0xff, 0x60, 0xff, 0xa3, 0x00, 0xa0, 0x00,
+    0x09, 0x00, 0x07, 0x5e, 0xff, 0x62, 0xff, 0x43, 0x01, 0x3d, 0x01, 0x02, 0x06, 0x1d, 0xc6, 0x80, 0x7f, 0x1b, 0x43, 0xdf, 0x4b, 0xe1, 0x44, 0x9e,
+    0x4d, 0x09, 0x00, 0x07, 0x1d, 0x43, 0xe0, 0x4b, 0xc3, 0x01, 0xbd, 0x01, 0x06, 0x31, 0xc6, 0x80, 0x80, 0x3f, 0x1f, 0x5f, 0x39, 0xc1, 0x20, 0xe1,
+    0x3a, 0x09, 0x00, 0x07, 0x40, 0x1f, 0x60, 0x39, 0x80, 0x01, 0x80, 0x01, 0x06, 0x32, 0xc6, 0x80, 0x80, 0x1d, 0x3c, 0x00, 0x58, 0x63, 0x3e, 0x40,
+    0x5a, 0x09, 0x00, 0x07, 0x1e, 0x3c, 0x02, 0x58, 0x43, 0x02, 0x3d, 0x02, 0x06, 0x1b, 0xc7, 0x80, 0x80, 0x9f, 0x41, 0x3f, 0x51, 0x21, 0x44, 0xc1,
+    0x53, 0x09, 0x00, 0x07, 0xa0, 0x41, 0x40, 0x51, 0x80, 0x02, 0x80, 0x02, 0x06, 0x2b, 0xc7, 0x80, 0x80, 0x5d, 0x31, 0xe0, 0x4a, 0x63, 0x34, 0xe0,
+    0x4d, 0x09, 0x00, 0x07, 0x5e, 0x31, 0xe2, 0x4a, 0x03, 0x03, 0xfd, 0x02, 0x06, 0x27, 0xc5, 0x80, 0x80, 0x1f, 0x04, 0x5f, 0x1a, 0x21, 0x05, 0x61,
+    0x1b, 0x09, 0x00, 0x07, 0x20, 0x04, 0x60, 0x1a, 0x00, 0x01, 0x00, 0x01, 0x06, 0x2b, 0xc7, 0x80, 0x80, 0x1f, 0x2c, 0xbf, 0x3d, 0xa1, 0x2e, 0x41,
+    0x40, 0x09, 0x00, 0x07, 0x20, 0x2c, 0xc0, 0x3d, 0x80, 0x02, 0x80, 0x02, 0x06, 0x19, 0xc7, 0x80, 0x80, 0xdd, 0x1d, 0x60, 0x32, 0x63, 0x21, 0xe0,
+    0x35, 0x09, 0x00, 0x07, 0xde, 0x1d, 0x62, 0x32, 0x83, 0x03, 0x7d, 0x03, 0x06, 0x0c, 0xc5, 0x7f, 0x7f, 0x3f, 0x14, 0x5f, 0x21, 0x01, 0x15, 0x21,
+    0x22, 0x3a, 0x00, 0x01, 0x00, 0x15, 0xc0, 0x21, 0x03, 0x00, 0x15, 0xf6, 0x21, 0xd6, 0x14, 0x20, 0x22, 0xa0, 0x14, 0x20, 0x22, 0x03, 0x6a, 0x14,
+    0x20, 0x22, 0x40, 0x14, 0xf6, 0x21, 0x40, 0x14, 0xc0, 0x21, 0x03, 0x40, 0x14, 0x8a, 0x21, 0x6a, 0x14, 0x60, 0x21, 0xa0, 0x14, 0x60, 0x21, 0x03,
+    0xd6, 0x14, 0x60, 0x21, 0x00, 0x15, 0x8a, 0x21, 0x00, 0x15, 0xc0, 0x21, 0x04, 0x06, 0x1d, 0xc6, 0x80, 0x7f, 0x3b, 0x31, 0xff, 0x57, 0x01, 0x33,
+    0xbe, 0x59, 0x09, 0x00, 0x07, 0x3d, 0x31, 0x00, 0x58, 0xc3, 0x01, 0xbd, 0x01, 0x06, 0x1d, 0xc6, 0x7f, 0x80, 0x5f, 0x51, 0xbf, 0x51, 0xe1, 0x52,
+    0x41, 0x53, 0x09, 0x00, 0x07, 0x60, 0x51, 0xc0, 0x51, 0x80, 0x01, 0x80, 0x01, 0x06, 0x08, 0xc5, 0x80, 0x80, 0x5f, 0x16, 0x7f, 0x0b, 0x61, 0x17,
+    0x81, 0x0c, 0x09, 0x00, 0x07, 0x60, 0x16, 0x80, 0x0b, 0x00, 0x01, 0x00, 0x01, 0x01, 0x03, 0x5e, 0x60, 0xfe, 0x25, 0x04, 0xe0, 0x06, 0x06, 0x2f,
+    0xc5, 0x80, 0x80, 0x5d, 0xff, 0x60, 0xff, 0xa3, 0x00, 0xa0, 0x00, 0x09, 0x00, 0x07, 0x5e, 0xff, 0x62, 0xff, 0x43, 0x01, 0x3d, 0x01, 0x02, 0x06,
+    0x04, 0xc7, 0x80, 0x80, 0x1d, 0x14, 0x20, 0x17, 0xa3, 0x17, 0xa0, 0x1a, 0x09, 0x00, 0x07, 0x1e, 0x14, 0x22, 0x17, 0x83, 0x03, 0x7d, 0x03, 0x06,
+    0x0d, 0xc2, 0x80, 0x80, 0x9f, 0x04, 0x9f, 0x60, 0x21, 0x05, 0x21, 0x61, 0x09, 0x00, 0x07, 0xa0, 0x04, 0xa0, 0x60, 0x80, 0x00, 0x80, 0x00, 0x06,
+    0x1d, 0xc5, 0x80, 0x80, 0xdf, 0x12, 0xdf, 0x29, 0xa1, 0x13, 0xa1, 0x2a, 0x3a, 0x00, 0x01, 0xa0, 0x13, 0x40, 0x2a, 0x03, 0xa0, 0x13, 0x76, 0x2a,
+    0x76, 0x13, 0xa0, 0x2a, 0x40, 0x13, 0xa0, 0x2a, 0x03, 0x0a, 0x13, 0xa0, 0x2a, 0xe0, 0x12, 0x76, 0x2a, 0xe0, 0x12, 0x40, 0x2a, 0x03, 0xe0, 0x12,
+    0x0a, 0x2a, 0x0a, 0x13, 0xe0, 0x29, 0x40, 0x13, 0xe0, 0x29, 0x03, 0x76, 0x13, 0xe0, 0x29, 0xa0, 0x13, 0x0a, 0x2a, 0xa0, 0x13, 0x40, 0x2a, 0x04,
+    0x06, 0x25, 0xc5, 0x80, 0x80, 0x7f, 0x2e, 0xff, 0x5a, 0x81, 0x2f, 0x01, 0x5c, 0x09, 0x00, 0x07, 0x80, 0x2e, 0x00, 0x5b, 0x00, 0x01, 0x00, 0x01,
+    0x06, 0x28, 0xc6, 0x80, 0x80, 0xfd, 0x51, 0xa0, 0x54, 0x43, 0x54, 0xe0, 0x56, 0x09, 0x00, 0x07, 0xfe, 0x51, 0xa2, 0x54, 0x43, 0x02, 0x3d, 0x02,
+    0x06, 0x08, 0xc7, 0x80, 0x80, 0x7f, 0x36, 0x7f, 0x0b, 0x81, 0x38, 0x81, 0x0d, 0x09, 0x00, 0x07, 0x80, 0x36, 0x80, 0x0b, 0x00, 0x02, 0x00, 0x02,
+    0x06, 0x1d, 0xc8, 0x80, 0x80, 0xff, 0x3f, 0x7f, 0x0b, 0x41, 0x44, 0xc1, 0x0f, 0x09, 0x00, 0x07, 0x00, 0x40, 0x80, 0x0b, 0x40, 0x04, 0x40, 0x04,
+    0x06, 0x2c, 0xc6, 0x80, 0x80, 0x7f, 0x14, 0x5f, 0x37, 0x01, 0x16, 0xe1, 0x38, 0x09, 0x00, 0x07, 0x80, 0x14, 0x60, 0x37, 0x80, 0x01, 0x80, 0x01,
+    0x06, 0x1d, 0xc2, 0x80, 0x80, 0x1f, 0x12, 0xdf, 0x23, 0xa1, 0x12, 0x61, 0x24, 0x09, 0x00, 0x07, 0x20, 0x12, 0xe0, 0x23, 0x80, 0x00, 0x80, 0x00,
+    0x01, 0x03, 0xfe, 0x20, 0x1e, 0x1e, 0x04, 0xe0, 0x06, 0x06, 0x08, 0xc5, 0x80, 0x80, 0x5d, 0xff, 0x60, 0xff, 0xa3, 0x00, 0xa0, 0x00, 0x09, 0x00,
+    0x07, 0x5e, 0xff, 0x62, 0xff, 0x43, 0x01, 0x3d, 0x01, 0x02, 0x06, 0x29, 0xc2, 0x80, 0x80, 0x1f, 0x37, 0xff, 0x5b, 0xa1, 0x37, 0x81, 0x5c, 0x09,
+    0x00, 0x07, 0x20, 0x37, 0x00, 0x5c, 0x80, 0x00, 0x80, 0x00, 0x06, 0x13, 0xc6, 0x80, 0x80, 0x9f, 0x08, 0x9f, 0x4f, 0x21, 0x0a, 0x21, 0x51, 0x09,
+    0x00, 0x07, 0xa0, 0x08, 0xa0, 0x4f, 0x80, 0x01, 0x80, 0x01, 0x06, 0x28, 0xc6, 0x80, 0x7f, 0x9b, 0x4e, 0xbf, 0x5d, 0x61, 0x50, 0x7e, 0x5f, 0x09,
+    0x00, 0x07, 0x9d, 0x4e, 0xc0, 0x5d, 0xc3, 0x01, 0xbd, 0x01, 0x06, 0x05, 0xc7, 0x80, 0x80, 0x1f, 0x3b, 0xbf, 0x2f, 0xa1, 0x3d, 0x41, 0x32, 0x09,
+    0x00, 0x07, 0x20, 0x3b, 0xc0, 0x2f, 0x80, 0x02, 0x80, 0x02, 0x06, 0x08, 0xc7, 0x80, 0x80, 0x9f, 0x26, 0x9f, 0x2a, 0xa1, 0x28, 0xa1, 0x2c, 0x09,
+    0x00, 0x07, 0xa0, 0x26, 0xa0, 0x2a, 0x00, 0x02, 0x00, 0x02, 0x06, 0x23, 0xc2, 0x80, 0x80, 0x3f, 0x20, 0x7f, 0x3c, 0xc1, 0x20, 0x01, 0x3d, 0x09,
+    0x00, 0x07, 0x40, 0x20, 0x80, 0x3c, 0x80, 0x00, 0x80, 0x00, 0x06, 0x15, 0xc5, 0x80, 0x80, 0x1f, 0x1b, 0x5f, 0x02, 0x21, 0x1c, 0x61, 0x03, 0x09,
+    0x00, 0x07, 0x20, 0x1b, 0x60, 0x02, 0x00, 0x01, 0x00, 0x01, 0x06, 0x08, 0xc5, 0x7f, 0x7f, 0x5f, 0x33, 0x3f, 0x45, 0x21, 0x34, 0x01, 0x46, 0x3a,
+    0x00, 0x01, 0x20, 0x34, 0xa0, 0x45, 0x03, 0x20, 0x34, 0xd6, 0x45, 0xf6, 0x33, 0x00, 0x46, 0xc0, 0x33, 0x00, 0x46, 0x03, 0x8a, 0x33, 0x00, 0x46,
+    0x60, 0x33, 0xd6, 0x45, 0x60, 0x33, 0xa0, 0x45, 0x03, 0x60, 0x33, 0x6a, 0x45, 0x8a, 0x33, 0x40, 0x45, 0xc0, 0x33, 0x40, 0x45, 0x03, 0xf6, 0x33,
+    0x40, 0x45, 0x20, 0x34, 0x6a, 0x45, 0x20, 0x34, 0xa0, 0x45, 0x04, 0x06, 0x06, 0xc6, 0x80, 0x80, 0xbf, 0x56, 0x3f, 0x12, 0x41, 0x58, 0xc1, 0x13,
+    0x09, 0x00, 0x07, 0xc0, 0x56, 0x40, 0x12, 0x80, 0x01, 0x80, 0x01, 0x06, 0x18, 0xc5, 0x7f, 0x7f, 0x7f, 0x47, 0x9f, 0x4d, 0x41, 0x48, 0x61, 0x4e,
+    0x3a, 0x00, 0x01, 0x40, 0x48, 0x00, 0x4e, 0x03, 0x40, 0x48, 0x36, 0x4e, 0x16, 0x48, 0x60, 0x4e, 0xe0, 0x47, 0x60, 0x4e, 0x03, 0xaa, 0x47, 0x60,
+    0x4e, 0x80, 0x47, 0x36, 0x4e, 0x80, 0x47, 0x00, 0x4e, 0x03, 0x80, 0x47, 0xca, 0x4d, 0xaa, 0x47, 0xa0, 0x4d, 0xe0, 0x47, 0xa0, 0x4d, 0x03, 0x16,
+    0x48, 0xa0, 0x4d, 0x40, 0x48, 0xca, 0x4d, 0x40, 0x48, 0x00, 0x4e, 0x04, 0x06, 0x1b, 0xc6, 0x80, 0x7f, 0x1b, 0x18, 0x9f, 0x1a, 0xe1, 0x19, 0x5e,
+    0x1c, 0x09, 0x00, 0x07, 0x1d, 0x18, 0xa0, 0x1a, 0xc3, 0x01, 0xbd, 0x01, 0x06, 0x1d, 0xc7, 0x80, 0x80, 0xbf, 0x39, 0x1f, 0x59, 0xc1, 0x3b, 0x21,
+    0x5b, 0x09, 0x00, 0x07, 0xc0, 0x39, 0x20, 0x59, 0x00, 0x02, 0x00, 0x02, 0x06, 0x0c, 0xc7, 0x80, 0x80, 0xbf, 0x35, 0x9f, 0x03, 0xc1, 0x37, 0xa1,
+    0x05, 0x09, 0x00, 0x07, 0xc0, 0x35, 0xa0, 0x03, 0x00, 0x02, 0x00, 0x02, 0x06, 0x02, 0xc7, 0x80, 0x80, 0xdf, 0x46, 0x5f, 0x14, 0xa1, 0x4a, 0x21,
+    0x18, 0x09, 0x00, 0x07, 0xe0, 0x46, 0x60, 0x14, 0xc0, 0x03, 0xc0, 0x03, 0x06, 0x1d, 0xc5, 0x80, 0x80, 0x3f, 0x5f, 0x3f, 0x12, 0x01, 0x60, 0x01,
+    0x13, 0x3a, 0x00, 0x01, 0x00, 0x60, 0xa0, 0x12, 0x03, 0x00, 0x60, 0xd6, 0x12, 0xd6, 0x5f, 0x00, 0x13, 0xa0, 0x5f, 0x00, 0x13, 0x03, 0x6a, 0x5f,
+    0x00, 0x13, 0x40, 0x5f, 0xd6, 0x12, 0x40, 0x5f, 0xa0, 0x12, 0x03, 0x40, 0x5f, 0x6a, 0x12, 0x6a, 0x5f, 0x40, 0x12, 0xa0, 0x5f, 0x40, 0x12, 0x03,
+    0xd6, 0x5f, 0x40, 0x12, 0x00, 0x60, 0x6a, 0x12, 0x00, 0x60, 0xa0, 0x12, 0x04, 0x06, 0x16, 0xc5, 0x80, 0x80, 0x3f, 0x00, 0xdf, 0x1b, 0x41, 0x01,
+    0xe1, 0x1c, 0x09, 0x00, 0x07, 0x40, 0x00, 0xe0, 0x1b, 0x00, 0x01, 0x00, 0x01, 0x06, 0x24, 0xc5, 0x7f, 0x7f, 0x1f, 0x09, 0xdf, 0x5f, 0xe1, 0x09,
+    0xa1, 0x60, 0x3a, 0x00, 0x01, 0xe0, 0x09, 0x40, 0x60, 0x03, 0xe0, 0x09, 0x76, 0x60, 0xb6, 0x09, 0xa0, 0x60, 0x80, 0x09, 0xa0, 0x60, 0x03, 0x4a,
+    0x09, 0xa0, 0x60, 0x20, 0x09, 0x76, 0x60, 0x20, 0x09, 0x40, 0x60, 0x03, 0x20, 0x09, 0x0a, 0x60, 0x4a, 0x09, 0xe0, 0x5f, 0x80, 0x09, 0xe0, 0x5f,
+    0x03, 0xb6, 0x09, 0xe0, 0x5f, 0xe0, 0x09, 0x0a, 0x60, 0xe0, 0x09, 0x40, 0x60, 0x04, 0x06, 0x1d, 0xc6, 0x7f, 0x80, 0x5f, 0x24, 0x3f, 0x1d, 0xe1,
+    0x25, 0xc1, 0x1e, 0x09, 0x00, 0x07, 0x60, 0x24, 0x40, 0x1d, 0x80, 0x01, 0x80, 0x01, 0x06, 0x03, 0xc7, 0x80, 0x80, 0x5f, 0x28, 0x7f, 0x58, 0x61,
+    0x2a, 0x81, 0x5a, 0x09, 0x00, 0x07, 0x60, 0x28, 0x80, 0x58, 0x00, 0x02, 0x00, 0x02, 0x06, 0x1d, 0xc6, 0x80, 0x80, 0xff, 0x31, 0x9f, 0x55, 0x81,
+    0x33, 0x21, 0x57, 0x09, 0x00, 0x07, 0x00, 0x32, 0xa0, 0x55, 0x80, 0x01, 0x80, 0x01, 0x06, 0x0d, 0xc6, 0x80, 0x7f, 0xdb, 0x58, 0x1f, 0x00, 0xa1,
+    0x5a, 0xde, 0x01, 0x09, 0x00, 0x07, 0xdd, 0x58, 0x20, 0x00, 0xc3, 0x01, 0xbd, 0x01, 0x06, 0x19, 0xc6, 0x80, 0x80, 0x1d, 0x14, 0xa0, 0x40, 0x63,
+    0x16, 0xe0, 0x42, 0x09, 0x00, 0x07, 0x1e, 0x14, 0xa2, 0x40, 0x43, 0x02, 0x3d, 0x02, 0x06, 0x0a, 0xc8, 0x80, 0x80, 0x7f, 0x3f, 0xdf, 0x31, 0x01,
+    0x45, 0x61, 0x37, 0x09, 0x00, 0x07, 0x80, 0x3f, 0xe0, 0x31, 0x80, 0x05, 0x80, 0x05, 0x06, 0x1d, 0xc5, 0x80, 0x80, 0x7f, 0x5f, 0x7f, 0x4a, 0x81,
+    0x60, 0x81, 0x4b, 0x09, 0x00, 0x07, 0x80, 0x5f, 0x80, 0x4a, 0x00, 0x01, 0x00, 0x01, 0x06, 0x23, 0xc6, 0x80, 0x80, 0x3d, 0x11, 0xc0, 0x38, 0x83,
+    0x13, 0x00, 0x3b, 0x09, 0x00, 0x07, 0x3e, 0x11, 0xc2, 0x38, 0x43, 0x02, 0x3d, 0x02, 0x06, 0x08, 0xc7, 0x80, 0x80, 0x7f, 0x3a, 0x5f, 0x53, 0x81,
+    0x3c, 0x61, 0x55, 0x09, 0x00, 0x07, 0x80, 0x3a, 0x60, 0x53, 0x00, 0x02, 0x00, 0x02, 0x06, 0x2e, 0xc6, 0x80, 0x80, 0x9f, 0x5e, 0xff, 0x59, 0x21,
+    0x60, 0x81, 0x5b, 0x09, 0x00, 0x07, 0xa0, 0x5e, 0x00, 0x5a, 0x80, 0x01, 0x80, 0x01, 0x06, 0x0e, 0xc6, 0x80, 0x80, 0x1d, 0x0b, 0x40, 0x1d, 0x63,
+    0x0d, 0x80, 0x1f, 0x09, 0x00, 0x07, 0x1e, 0x0b, 0x42, 0x1d, 0x43, 0x02, 0x3d, 0x02, 0x06, 0x05, 0xc7, 0x80, 0x80, 0xbf, 0x29, 0x1f, 0x06, 0x01,
+    0x2d, 0x61, 0x09, 0x09, 0x00, 0x07, 0xc0, 0x29, 0x20, 0x06, 0x40, 0x03, 0x40, 0x03, 0x06, 0x1d, 0xc7, 0x7f, 0x80, 0xbf, 0x34, 0xe2, 0x2b, 0x45,
+    0x39, 0x61, 0x30, 0x09, 0x00, 0x07, 0xc0, 0x34, 0xe3, 0x2b, 0x83, 0x04, 0x7d, 0x04, 0x06, 0x17, 0xc6, 0x80, 0x7f, 0x1b, 0x1a, 0xbf, 0x20, 0xe1,
+    0x1b, 0x7e, 0x22, 0x09, 0x00, 0x07, 0x1d, 0x1a, 0xc0, 0x20, 0xc3, 0x01, 0xbd, 0x01, 0x06, 0x08, 0xc6, 0x80, 0x80, 0xbf, 0x35, 0xdf, 0x00, 0x41,
+    0x37, 0x61, 0x02, 0x09, 0x00, 0x07, 0xc0, 0x35, 0xe0, 0x00, 0x80, 0x01, 0x80, 0x01, 0x06, 0x27, 0xc6, 0x80, 0x7f, 0x9b, 0x25, 0x3f, 0x58, 0x61,
+    0x27, 0xfe, 0x59, 0x09, 0x00, 0x07, 0x9d, 0x25, 0x40, 0x58, 0xc3, 0x01, 0xbd, 0x01, 0x06, 0x2e, 0xc6, 0x80, 0x80, 0xdd, 0x19, 0xe0, 0x2f, 0x23,
+    0x1c, 0x20, 0x32, 0x09, 0x00, 0x07, 0xde, 0x19, 0xe2, 0x2f, 0x43, 0x02, 0x3d, 0x02, 0x01, 0x03, 0xde, 0x53, 0x7e, 0x28, 0x04, 0xe0, 0x06, 0x06,
+    0x1f, 0xc5, 0x80, 0x80, 0x5d, 0xff, 0x60, 0xff, 0xa3, 0x00, 0xa0, 0x00, 0x09, 0x00, 0x07, 0x5e, 0xff, 0x62, 0xff, 0x43, 0x01, 0x3d, 0x01, 0x02,
+    0x06, 0x21, 0xc5, 0x7f, 0x7f, 0x5f, 0x05, 0x1f, 0x5d, 0x21, 0x06, 0xe1, 0x5d, 0x3a, 0x00, 0x01, 0x20, 0x06, 0x80, 0x5d, 0x03, 0x20, 0x06, 0xb6,
+    0x5d, 0xf6, 0x05, 0xe0, 0x5d, 0xc0, 0x05, 0xe0, 0x5d, 0x03, 0x8a, 0x05, 0xe0, 0x5d, 0x60, 0x05, 0xb6, 0x5d, 0x60, 0x05, 0x80, 0x5d, 0x03, 0x60,
+    0x05, 0x4a, 0x5d, 0x8a, 0x05, 0x20, 0x5d, 0xc0, 0x05, 0x20, 0x5d, 0x03, 0xf6, 0x05, 0x20, 0x5d, 0x20, 0x06, 0x4a, 0x5d, 0x20, 0x06, 0x80, 0x5d,
+    0x04, 0x06, 0x23, 0xc6, 0x80, 0x80, 0xfd, 0x47, 0xa0, 0x12, 0x43, 0x4a, 0xe0, 0x14, 0x09, 0x00, 0x07, 0xfe, 0x47, 0xa2, 0x12, 0x43, 0x02, 0x3d,
+    0x02, 0x06, 0x20, 0xc6, 0x80, 0x80, 0xfd, 0x1f, 0x60, 0x48, 0x43, 0x22, 0xa0, 0x4a, 0x09, 0x00, 0x07, 0xfe, 0x1f, 0x62, 0x48, 0x43, 0x02, 0x3d,
+    0x02, 0x06, 0x32, 0xc7, 0x80, 0x80, 0xbd, 0x52, 0x40, 0x14, 0xc3, 0x55, 0x40, 0x17, 0x09, 0x00, 0x07, 0xbe, 0x52, 0x42, 0x14, 0x03, 0x03, 0xfd,
+    0x02, 0x06, 0x1d, 0xc7, 0x80, 0x80, 0xdf, 0x29, 0x1f, 0x19, 0xa1, 0x2d, 0xe1, 0x1c, 0x09, 0x00, 0x07, 0xe0, 0x29, 0x20, 0x19, 0xc0, 0x03, 0xc0,
+    0x03, 0x06, 0x32, 0xc7, 0x80, 0x80, 0x7d, 0x3d, 0xe0, 0x42, 0x03, 0x41, 0x60, 0x46, 0x09, 0x00, 0x07, 0x7e, 0x3d, 0xe2, 0x42, 0x83, 0x03, 0x7d,
+    0x03, 0x06, 0x0d, 0xc5, 0x80, 0x80, 0x5f, 0x07, 0x9f, 0x1e, 0x21, 0x08, 0x61, 0x1f, 0x3a, 0x00, 0x01, 0x20, 0x08, 0x00, 0x1f, 0x03, 0x20, 0x08,
+    0x36, 0x1f, 0xf6, 0x07, 0x60, 0x1f, 0xc0, 0x07, 0x60, 0x1f, 0x03, 0x8a, 0x07, 0x60, 0x1f, 0x60, 0x07, 0x36, 0x1f, 0x60, 0x07, 0x00, 0x1f, 0x03,
+    0x60, 0x07, 0xca, 0x1e, 0x8a, 0x07, 0xa0, 0x1e, 0xc0, 0x07, 0xa0, 0x1e, 0x03, 0xf6, 0x07, 0xa0, 0x1e, 0x20, 0x08, 0xca, 0x1e, 0x20, 0x08, 0x00,
+    0x1f, 0x04, 0x06, 0x1a, 0xc5, 0x80, 0x80, 0x1f, 0x13, 0x7f, 0x3d, 0xe1, 0x13, 0x41, 0x3e, 0x3a, 0x00, 0x01, 0xe0, 0x13, 0xe0, 0x3d, 0x03, 0xe0,
+    0x13, 0x16, 0x3e, 0xb6, 0x13, 0x40, 0x3e, 0x80, 0x13, 0x40, 0x3e, 0x03, 0x4a, 0x13, 0x40, 0x3e, 0x20, 0x13, 0x16, 0x3e, 0x20, 0x13, 0xe0, 0x3d,
+    0x03, 0x20, 0x13, 0xaa, 0x3d, 0x4a, 0x13, 0x80, 0x3d, 0x80, 0x13, 0x80, 0x3d, 0x03, 0xb6, 0x13, 0x80, 0x3d, 0xe0, 0x13, 0xaa, 0x3d, 0xe0, 0x13,
+    0xe0, 0x3d, 0x04, 0x06, 0x08, 0xc2, 0x80, 0x80, 0x9f, 0x00, 0xdf, 0x39, 0x21, 0x01, 0x61, 0x3a, 0x09, 0x00, 0x07, 0xa0, 0x00, 0xe0, 0x39, 0x80,
+    0x00, 0x80, 0x00, 0x06, 0x1d, 0xc7, 0x80, 0x80, 0xdf, 0x2b, 0x3f, 0x28, 0xa1, 0x2f, 0x01, 0x2c, 0x09, 0x00, 0x07, 0xe0, 0x2b, 0x40, 0x28, 0xc0,
+    0x03, 0xc0, 0x03, 0x01, 0x03, 0x5e, 0x45, 0xfe, 0x60, 0x04, 0xe0, 0x06, 0x06, 0x05, 0xc5, 0x80, 0x80, 0x5d, 0xff, 0x60, 0xff, 0xa3, 0x00, 0xa0,
+    0x00, 0x09, 0x00, 0x07, 0x5e, 0xff, 0x62, 0xff, 0x43, 0x01, 0x3d, 0x01, 0x02, 0x06, 0x33, 0xc5, 0x80, 0x80, 0xbf, 0x45, 0xbf, 0x58, 0x81, 0x46,
+    0x81, 0x59, 0x3a, 0x00, 0x01, 0x80, 0x46, 0x20, 0x59, 0x03, 0x80, 0x46, 0x56, 0x59, 0x56, 0x46, 0x80, 0x59, 0x20, 0x46, 0x80, 0x59, 0x03, 0xea,
+    0x45, 0x80, 0x59, 0xc0, 0x45, 0x56, 0x59, 0xc0, 0x45, 0x20, 0x59, 0x03, 0xc0, 0x45, 0xea, 0x58, 0xea, 0x45, 0xc0, 0x58, 0x20, 0x46, 0xc0, 0x58,
+    0x03, 0x56, 0x46, 0xc0, 0x58, 0x80, 0x46, 0xea, 0x58, 0x80, 0x46, 0x20, 0x59, 0x04, 0x01, 0x03, 0xde, 0x34, 0x1e, 0x5f, 0x04, 0xe0, 0x06, 0x06,
+    0x0d, 0xc5, 0x80, 0x80, 0x5d, 0xff, 0x60, 0xff, 0xa3, 0x00, 0xa0, 0x00, 0x09, 0x00, 0x07, 0x5e, 0xff, 0x62, 0xff, 0x43, 0x01, 0x3d, 0x01, 0x02,
+    0x06, 0x0d, 0xc6, 0x80, 0x80, 0x9f, 0x1e, 0xdf, 0x51, 0x21, 0x20, 0x61, 0x53, 0x09, 0x00, 0x07, 0xa0, 0x1e, 0xe0, 0x51, 0x80, 0x01, 0x80, 0x01,
+    0x06, 0x30, 0xc7, 0x80, 0x80, 0x9f, 0x36, 0x1f, 0x07, 0xa1, 0x38, 0x21, 0x09, 0x09, 0x00, 0x07, 0xa0, 0x36, 0x20, 0x07, 0x00, 0x02, 0x00, 0x02,
+    0x06, 0x0e, 0xc7, 0x80, 0x80, 0xff, 0x0a, 0xdf, 0x12, 0x01, 0x0d, 0xe1, 0x14, 0x09, 0x00, 0x07, 0x00, 0x0b, 0xe0, 0x12, 0x00, 0x02, 0x00, 0x02,
+    0x06, 0x15, 0xc2, 0x80, 0x80, 0x9f, 0x08, 0xff, 0x5a, 0x21, 0x09, 0x81, 0x5b, 0x09, 0x00, 0x07, 0xa0, 0x08, 0x00, 0x5b, 0x80, 0x00, 0x80, 0x00,
+    0x06, 0x0d, 0xc2, 0x7f, 0x80, 0x7f, 0x33, 0x7f, 0x34, 0x01, 0x34, 0x01, 0x35, 0x09, 0x00, 0x07, 0x80, 0x33, 0x80, 0x34, 0x80, 0x00, 0x80, 0x00,
+    0x06, 0x2b, 0xc7, 0x80, 0x80, 0x9f, 0x50, 0x3f, 0x2a, 0x61, 0x54, 0x01, 0x2e, 0x09, 0x00, 0x07, 0xa0, 0x50, 0x40, 0x2a, 0xc0, 0x03, 0xc0, 0x03,
+    0x06, 0x1c, 0xc6, 0x80, 0x80, 0xfd, 0x33, 0xc0, 0x52, 0x43, 0x36, 0x00, 0x55, 0x09, 0x00, 0x07, 0xfe, 0x33, 0xc2, 0x52, 0x43, 0x02, 0x3d, 0x02,
+    0x06, 0x1b, 0xc5, 0x7f, 0x80, 0x9f, 0x2c, 0x7f, 0x49, 0xa1, 0x2d, 0x81, 0x4a, 0x09, 0x00, 0x07, 0xa0, 0x2c, 0x80, 0x49, 0x00, 0x01, 0x00, 0x01,
+    0x01, 0x03, 0x5e, 0x38, 0xde, 0x51, 0x04, 0xe0, 0x06, 0x06, 0x1b, 0xc5, 0x80, 0x80, 0x5d, 0xff, 0x60, 0xff, 0xa3, 0x00, 0xa0, 0x00, 0x09, 0x00,
+    0x07, 0x5e, 0xff, 0x62, 0xff, 0x43, 0x01, 0x3d, 0x01, 0x02, 0x06, 0x17, 0xc7, 0x80, 0x80, 0x9d, 0x40, 0x00, 0x06, 0xa3, 0x43, 0x00, 0x09, 0x09,
+    0x00, 0x07, 0x9e, 0x40, 0x02, 0x06, 0x03, 0x03, 0xfd, 0x02, 0x06, 0x11, 0xc5, 0x7f, 0x7f, 0xdf, 0x4e, 0x3f, 0x53, 0xa1, 0x4f, 0x01, 0x54, 0x3a,
+    0x00, 0x01, 0xa0, 0x4f, 0xa0, 0x53, 0x03, 0xa0, 0x4f, 0xd6, 0x53, 0x76, 0x4f, 0x00, 0x54, 0x40, 0x4f, 0x00, 0x54, 0x03, 0x0a, 0x4f, 0x00, 0x54,
+    0xe0, 0x4e, 0xd6, 0x53, 0xe0, 0x4e, 0xa0, 0x53, 0x03, 0xe0, 0x4e, 0x6a, 0x53, 0x0a, 0x4f, 0x40, 0x53, 0x40, 0x4f, 0x40, 0x53, 0x03, 0x76, 0x4f,
+    0x40, 0x53, 0xa0, 0x4f, 0x6a, 0x53, 0xa0, 0x4f, 0xa0, 0x53, 0x04, 0x01, 0x03, 0xfe, 0x56, 0x7e, 0x35, 0x04, 0xe0, 0x06, 0x06, 0x0b, 0xc5, 0x80,
+    0x80, 0x5d, 0xff, 0x60, 0xff, 0xa3, 0x00, 0xa0, 0x00, 0x09, 0x00, 0x07, 0x5e, 0xff, 0x62, 0xff, 0x43, 0x01, 0x3d, 0x01, 0x02, 0x06, 0x12, 0xc7,
+    0x80, 0x80, 0xbf, 0x4b, 0x5f, 0x13, 0x01, 0x4f, 0xa1, 0x16, 0x09, 0x00, 0x07, 0xc0, 0x4b, 0x60, 0x13, 0x40, 0x03, 0x40, 0x03, 0x01, 0x03, 0x9e,
+    0x5a, 0xde, 0x58, 0x04, 0xe0, 0x06, 0x06, 0x10, 0xc5, 0x80, 0x80, 0x5d, 0xff, 0x60, 0xff, 0xa3, 0x00, 0xa0, 0x00, 0x09, 0x00, 0x07, 0x5e, 0xff,
+    0x62, 0xff, 0x43, 0x01, 0x3d, 0x01, 0x02, 0x06, 0x0b, 0xc7, 0x80, 0x80, 0xfd, 0x0f, 0x00, 0x12, 0x03, 0x13, 0x00, 0x15, 0x09, 0x00, 0x07, 0xfe,
+    0x0f, 0x02, 0x12, 0x03, 0x03, 0xfd, 0x02, 0x06, 0x26, 0xc2, 0x80, 0x80, 0x9f, 0x1b, 0x1f, 0x06, 0x21, 0x1c, 0xa1, 0x06, 0x09, 0x00, 0x07, 0xa0,
+    0x1b, 0x20, 0x06, 0x80, 0x00, 0x80, 0x00, 0x06, 0x1d, 0xc7, 0x80, 0x80, 0x3f, 0x2f, 0x5f, 0x05, 0x01, 0x32, 0x21, 0x08, 0x09, 0x00, 0x07, 0x40,
+    0x2f, 0x60, 0x05, 0xc0, 0x02, 0xc0, 0x02, 0x06, 0x1e, 0xc7, 0x80, 0x80, 0x1d, 0x39, 0xa0, 0x3e, 0xa3, 0x3c, 0x20, 0x42, 0x09, 0x00, 0x07, 0x1e,
+    0x39, 0xa2, 0x3e, 0x83, 0x03, 0x7d, 0x03, 0x06, 0x32, 0xc5, 0x80, 0x80, 0x9f, 0x4f, 0x9f, 0x04, 0xa1, 0x50, 0xa1, 0x05, 0x09, 0x00, 0x07, 0xa0,
+    0x4f, 0xa0, 0x04, 0x00, 0x01, 0x00, 0x01, 0x06, 0x1d, 0xc7, 0x80, 0x80, 0x5f, 0x54, 0x3f, 0x48, 0x61, 0x56, 0x41, 0x4a, 0x09, 0x00, 0x07, 0x60,
+    0x54, 0x40, 0x48, 0x00, 0x02, 0x00, 0x02, 0x06, 0x29, 0xc6, 0x80, 0x80, 0xdd, 0x4e, 0x00, 0x00, 0x23, 0x51, 0x40, 0x02, 0x09, 0x00, 0x07, 0xde,
+    0x4e, 0x02, 0x00, 0x43, 0x02, 0x3d, 0x02, 0x06, 0x22, 0xc8, 0x80, 0x80, 0x3f, 0x31, 0xbf, 0x17, 0x01, 0x36, 0x81, 0x1c, 0x09, 0x00, 0x07, 0x40,
+    0x31, 0xc0, 0x17, 0xc0, 0x04, 0xc0, 0x04, 0x06, 0x1d, 0xc5, 0x80, 0x80, 0x1f, 0x5c, 0x1f, 0x49, 0x21, 0x5d, 0x21, 0x4a, 0x09, 0x00, 0x07, 0x20,
+    0x5c, 0x20, 0x49, 0x00, 0x01, 0x00, 0x01, 0x06, 0x2f, 0xc6, 0x80, 0x7f, 0x9b, 0x07, 0x5f, 0x25, 0x61, 0x09, 0x1e, 0x27, 0x09, 0x00, 0x07, 0x9d,
+    0x07, 0x60, 0x25, 0xc3, 0x01, 0xbd, 0x01, 0x06, 0x0d, 0xc6, 0x80, 0x7f, 0xbb, 0x18, 0x5f, 0x13, 0x81, 0x1a, 0x1e, 0x15, 0x09, 0x00, 0x07, 0xbd,
+    0x18, 0x60, 0x13, 0xc3, 0x01, 0xbd, 0x01, 0x06, 0x17, 0xc6, 0x80, 0x80, 0xdf, 0x34, 0xdf, 0x4e, 0x61, 0x36, 0x61, 0x50, 0x09, 0x00, 0x07, 0xe0,
+    0x34, 0xe0, 0x4e, 0x80, 0x01, 0x80, 0x01, 0x06, 0x13, 0xc5, 0x80, 0x80, 0x9f, 0x2f, 0xff, 0x1c, 0xa1, 0x30, 0x01, 0x1e, 0x09, 0x00, 0x07, 0xa0,
+    0x2f, 0x00, 0x1d, 0x00, 0x01, 0x00, 0x01, 0x06, 0x20, 0xc7, 0x80, 0x80, 0xbf, 0x2a, 0x1f, 0x34, 0x01, 0x2e, 0x61, 0x37, 0x09, 0x00, 0x07, 0xc0,
+    0x2a, 0x20, 0x34, 0x40, 0x03, 0x40, 0x03, 0x06, 0x13, 0xc7, 0x7f, 0x80, 0x9f, 0x4f, 0x02, 0x1e, 0x25, 0x54, 0x81, 0x22, 0x09, 0x00, 0x07, 0xa0,
+    0x4f, 0x03, 0x1e, 0x83, 0x04, 0x7d, 0x04, 0x06, 0x1d, 0xc2, 0x80, 0x80, 0x5f, 0x57, 0xff, 0x07, 0xe1, 0x57, 0x81, 0x08, 0x09, 0x00, 0x07, 0x60,
+    0x57, 0x00, 0x08, 0x80, 0x00, 0x80, 0x00, 0x06, 0x29, 0xc2, 0x80, 0x80, 0xff, 0x19, 0xdf, 0x09, 0x81, 0x1a, 0x61, 0x0a, 0x09, 0x00, 0x07, 0x00,
+    0x1a, 0xe0, 0x09, 0x80, 0x00, 0x80, 0x00, 0x06, 0x0f, 0xc6, 0x80, 0x7f, 0x5b, 0x42, 0x9f, 0x3a, 0x21, 0x44, 0x5e, 0x3c, 0x09, 0x00, 0x07, 0x5d,
+    0x42, 0xa0, 0x3a, 0xc3, 0x01, 0xbd, 0x01, 0x06, 0x11, 0xc8, 0x80, 0x80, 0xdf, 0x28, 0x7f, 0x1b, 0xa1, 0x2e, 0x41, 0x21, 0x09, 0x00, 0x07, 0xe0,
+    0x28, 0x80, 0x1b, 0xc0, 0x05, 0xc0, 0x05, 0x01, 0x03, 0x7e, 0x5f, 0xde, 0x19, 0x04, 0xe0, 0x06, 0x06, 0x09, 0xc5, 0x80, 0x80, 0x5d, 0xff, 0x60,
+    0xff, 0xa3, 0x00, 0xa0, 0x00, 0x09, 0x00, 0x07, 0x5e, 0xff, 0x62, 0xff, 0x43, 0x01, 0x3d, 0x01, 0x02, 0x01, 0x03, 0xfe, 0x29, 0x7e, 0x0e, 0x04,
+    0xe0, 0x06, 0x06, 0x0d, 0xc5, 0x80, 0x80, 0x5d, 0xff, 0x60, 0xff, 0xa3, 0x00, 0xa0, 0x00, 0x09, 0x00, 0x07, 0x5e, 0xff, 0x62, 0xff, 0x43, 0x01,
+    0x3d, 0x01, 0x02, 0x06, 0x16, 0xc5, 0x80, 0x80, 0xdf, 0x4f, 0x9f, 0x10, 0xa1, 0x50, 0x61, 0x11, 0x3a, 0x00, 0x01, 0xa0, 0x50, 0x00, 0x11, 0x03,
+    0xa0, 0x50, 0x36, 0x11, 0x76, 0x50, 0x60, 0x11, 0x40, 0x50, 0x60, 0x11, 0x03, 0x0a, 0x50, 0x60, 0x11, 0xe0, 0x4f, 0x36, 0x11, 0xe0, 0x4f, 0x00,
+    0x11, 0x03, 0xe0, 0x4f, 0xca, 0x10, 0x0a, 0x50, 0xa0, 0x10, 0x40, 0x50, 0xa0, 0x10, 0x03, 0x76, 0x50, 0xa0, 0x10, 0xa0, 0x50, 0xca, 0x10, 0xa0,
+    0x50, 0x00, 0x11, 0x04, 0x06, 0x28, 0xc2, 0x80, 0x80, 0xff, 0x11, 0x3f, 0x27, 0x81, 0x12, 0xc1, 0x27, 0x09, 0x00, 0x07, 0x00, 0x12, 0x40, 0x27,
+    0x80, 0x00, 0x80, 0x00, 0x06, 0x32, 0xc5, 0x80, 0x80, 0x7f, 0x0c, 0x5f, 0x05, 0x81, 0x0d, 0x61, 0x06, 0x09, 0x00, 0x07, 0x80, 0x0c, 0x60, 0x05,
+    0x00, 0x01, 0x00, 0x01, 0x06, 0x31, 0xc6, 0x80, 0x80, 0xff, 0x4c, 0x9f, 0x56, 0x81, 0x4e, 0x21, 0x58, 0x09, 0x00, 0x07, 0x00, 0x4d, 0xa0, 0x56,
+    0x80, 0x01, 0x80, 0x01, 0x06, 0x16, 0xc5, 0x80, 0x80, 0x3f, 0x14, 0xdf, 0x4d, 0x41, 0x15, 0xe1, 0x4e, 0x09, 0x00, 0x07, 0x40, 0x14, 0xe0, 0x4d,
+    0x00, 0x01, 0x00, 0x01, 0x06, 0x0d, 0xc6, 0x80, 0x80, 0x5d, 0x24, 0x20, 0x0a, 0xa3, 0x26, 0x60, 0x0c, 0x09, 0x00, 0x07, 0x5e, 0x24, 0x22, 0x0a,
+    0x43, 0x02, 0x3d, 0x02, 0x06, 0x1d, 0xc6, 0x7f, 0x7f, 0x9f, 0x49, 0xdf, 0x52, 0x21, 0x4b, 0x61, 0x54, 0x3a, 0x00, 0x01, 0x20, 0x4b, 0xa0, 0x53,
+    0x03, 0x20, 0x4b, 0x0a, 0x54, 0xca, 0x4a, 0x60, 0x54, 0x60, 0x4a, 0x60, 0x54, 0x03, 0xf6, 0x49, 0x60, 0x54, 0xa0, 0x49, 0x0a, 0x54, 0xa0, 0x49,
+    0xa0, 0x53, 0x03, 0xa0, 0x49, 0x36, 0x53, 0xf6, 0x49, 0xe0, 0x52, 0x60, 0x4a, 0xe0, 0x52, 0x03, 0xca, 0x4a, 0xe0, 0x52, 0x20, 0x4b, 0x36, 0x53,
+    0x20, 0x4b, 0xa0, 0x53, 0x04, 0x06, 0x09, 0xc5, 0x80, 0x80, 0x7f, 0x46, 0xdf, 0x1e, 0x81, 0x47, 0xe1, 0x1f, 0x09, 0x00, 0x07, 0x80, 0x46, 0xe0,
+    0x1e, 0x00, 0x01, 0x00, 0x01, 0x06, 0x1e, 0xc5, 0x80, 0x7f, 0x9f, 0x32, 0x7f, 0x3b, 0xa1, 0x33, 0x81, 0x3c, 0x09, 0x00, 0x07, 0xa0, 0x32, 0x80,
+    0x3b, 0x00, 0x01, 0x00, 0x01, 0x06, 0x0b, 0xc6, 0x80, 0x80, 0x3f, 0x55, 0x1f, 0x60, 0xc1, 0x56, 0xa1, 0x61, 0x09, 0x00, 0x07, 0x40, 0x55, 0x20,
+    0x60, 0x80, 0x01, 0x80, 0x01, 0x06, 0x1a, 0xc5, 0x80, 0x80, 0x1f, 0x2e, 0xff, 0x5e, 0x21, 0x2f, 0x01, 0x60, 0x09, 0x00, 0x07, 0x20, 0x2e, 0x00,
+    0x5f, 0x00, 0x01, 0x00, 0x01, 0x06, 0x32, 0xc6, 0x80, 0x80, 0xff, 0x5e, 0x7f, 0x03, 0x81, 0x60, 0x01, 0x05, 0x09, 0x00, 0x07, 0x00, 0x5f, 0x80,
+    0x03, 0x80, 0x01, 0x80, 0x01, 0x06, 0x24, 0xc2, 0x80, 0x7f, 0x9f, 0x54, 0x5f, 0x32, 0x21, 0x55, 0xe1, 0x32, 0x09, 0x00, 0x07, 0xa0, 0x54, 0x60,
+    0x32, 0x80, 0x00, 0x80, 0x00, 0x06, 0x08, 0xc6, 0x80, 0x80, 0x7f, 0x1e, 0x3f, 0x0c, 0x01, 0x20, 0xc1, 0x0d, 0x09, 0x00, 0x07, 0x80, 0x1e, 0x40,
+    0x0c, 0x80, 0x01, 0x80, 0x01, 0x06, 0x1b, 0xc6, 0x80, 0x80, 0x9d, 0x37, 0xa0, 0x2f, 0xe3, 0x39, 0xe0, 0x31, 0x09, 0x00, 0x07, 0x9e, 0x37, 0xa2,
+    0x2f, 0x43, 0x02, 0x3d, 0x02, 0x06, 0x1d, 0xc6, 0x80, 0x7f, 0x7b, 0x12, 0x7f, 0x03, 0x41, 0x14, 0x3e, 0x05, 0x09, 0x00, 0x07, 0x7d, 0x12, 0x80,
+    0x03, 0xc3, 0x01, 0xbd, 0x01, 0x06, 0x08, 0xc2, 0x80, 0x80, 0x9f, 0x05, 0x9f, 0x54, 0x21, 0x06, 0x21, 0x55, 0x09, 0x00, 0x07, 0xa0, 0x05, 0xa0,
+    0x54, 0x80, 0x00, 0x80, 0x00, 0x06, 0x32, 0xc2, 0x80, 0x80, 0xdf, 0x4c, 0xbf, 0x41, 0x61, 0x4d, 0x41, 0x42, 0x09, 0x00, 0x07, 0xe0, 0x4c, 0xc0,
+    0x41, 0x80, 0x00, 0x80, 0x00, 0x06, 0x1d, 0xc7, 0x80, 0x80, 0x5f, 0x54, 0xff, 0x4b, 0x61, 0x56, 0x01, 0x4e, 0x09, 0x00, 0x07, 0x60, 0x54, 0x00,
+    0x4c, 0x00, 0x02, 0x00, 0x02, 0x06, 0x08, 0xc5, 0x80, 0x80, 0xdf, 0x03, 0x5f, 0x5b, 0xa1, 0x04, 0x21, 0x5c, 0x3a, 0x00, 0x01, 0xa0, 0x04, 0xc0,
+    0x5b, 0x03, 0xa0, 0x04, 0xf6, 0x5b, 0x76, 0x04, 0x20, 0x5c, 0x40, 0x04, 0x20, 0x5c, 0x03, 0x0a, 0x04, 0x20, 0x5c, 0xe0, 0x03, 0xf6, 0x5b, 0xe0,
+    0x03, 0xc0, 0x5b, 0x03, 0xe0, 0x03, 0x8a, 0x5b, 0x0a, 0x04, 0x60, 0x5b, 0x40, 0x04, 0x60, 0x5b, 0x03, 0x76, 0x04, 0x60, 0x5b, 0xa0, 0x04, 0x8a,
+    0x5b, 0xa0, 0x04, 0xc0, 0x5b, 0x04, 0x01, 0x03, 0x3e, 0x4c, 0xbe, 0x2b, 0x04, 0xe0, 0x06, 0x06, 0x2e, 0xc5, 0x80, 0x80, 0x5d, 0xff, 0x60, 0xff,
+    0xa3, 0x00, 0xa0, 0x00, 0x09, 0x00, 0x07, 0x5e, 0xff, 0x62, 0xff, 0x43, 0x01, 0x3d, 0x01, 0x02, 0x06, 0x2b, 0xc7, 0x80, 0x80, 0x5d, 0x2b, 0xc0,
+    0x2b, 0x63, 0x2e, 0xc0, 0x2e, 0x09, 0x00, 0x07, 0x5e, 0x2b, 0xc2, 0x2b, 0x03, 0x03, 0xfd, 0x02, 0x06, 0x10, 0xc2, 0x80, 0x80, 0xff, 0x51, 0x9f,
+    0x09, 0x81, 0x52, 0x21, 0x0a, 0x09, 0x00, 0x07, 0x00, 0x52, 0xa0, 0x09, 0x80, 0x00, 0x80, 0x00, 0x06, 0x1f, 0xc6, 0x80, 0x80, 0xbd, 0x33, 0x00,
+    0x2a, 0x03, 0x36, 0x40, 0x2c, 0x09, 0x00, 0x07, 0xbe, 0x33, 0x02, 0x2a, 0x43, 0x02, 0x3d, 0x02, 0x01, 0x03, 0xbe, 0x03, 0x3e, 0x43, 0x04, 0xe0,
+    0x06, 0x06, 0x1f, 0xc5, 0x80, 0x80, 0x5d, 0xff, 0x60, 0xff, 0xa3, 0x00, 0xa0, 0x00, 0x09, 0x00, 0x07, 0x5e, 0xff, 0x62, 0xff, 0x43, 0x01, 0x3d,
+    0x01, 0x02, 0x06, 0x1d, 0xc8, 0x80, 0x80, 0xdf, 0x36, 0xff, 0x26, 0xa1, 0x3b, 0xc1, 0x2b, 0x09, 0x00, 0x07, 0xe0, 0x36, 0x00, 0x27, 0xc0, 0x04,
+    0xc0, 0x04, 0x01, 0x03, 0x1e, 0x25, 0x5e, 0x55, 0x04, 0xe0, 0x06, 0x06, 0x0d, 0xc5, 0x80, 0x80, 0x5d, 0xff, 0x60, 0xff, 0xa3, 0x00, 0xa0, 0x00,
+    0x09, 0x00, 0x07, 0x5e, 0xff, 0x62, 0xff, 0x43, 0x01, 0x3d, 0x01, 0x02, 0x06, 0x28, 0xc5, 0x80, 0x80, 0xbf, 0x50, 0x9f, 0x3b, 0xc1, 0x51, 0xa1,
+    0x3c, 0x09, 0x00, 0x07, 0xc0, 0x50, 0xa0, 0x3b, 0x00, 0x01, 0x00, 0x01, 0x06, 0x1d, 0xc7, 0x80, 0x80, 0xbf, 0x1c, 0xbf, 0x12, 0x81, 0x1f, 0x81,
+    0x15, 0x09, 0x00, 0x07, 0xc0, 0x1c, 0xc0, 0x12, 0xc0, 0x02, 0xc0, 0x02, 0x06, 0x18, 0xc7, 0x7f, 0x80, 0xff, 0x41, 0x22, 0x1a, 0x05, 0x47, 0x21,
+    0x1f, 0x09, 0x00, 0x07, 0x00, 0x42, 0x23, 0x1a, 0x03, 0x05, 0xfd, 0x04, 0x01, 0x03, 0xfe, 0x41, 0xfe, 0x4e, 0x04, 0xe0, 0x06, 0x06, 0x16, 0xc5,
+    0x80, 0x80, 0x5d, 0xff, 0x60, 0xff, 0xa3, 0x00, 0xa0, 0x00, 0x09, 0x00, 0x07, 0x5e, 0xff, 0x62, 0xff, 0x43, 0x01, 0x3d, 0x01, 0x02, 0x06, 0x1d,
+    0xc5, 0x80, 0x80, 0x1f, 0x0d, 0x1f, 0x42, 0xe1, 0x0d, 0xe1, 0x42, 0x3a, 0x00, 0x01, 0xe0, 0x0d, 0x80, 0x42, 0x03, 0xe0, 0x0d, 0xb6, 0x42, 0xb6,
+    0x0d, 0xe0, 0x42, 0x80, 0x0d, 0xe0, 0x42, 0x03, 0x4a, 0x0d, 0xe0, 0x42, 0x20, 0x0d, 0xb6, 0x42, 0x20, 0x0d, 0x80, 0x42, 0x03, 0x20, 0x0d, 0x4a,
+    0x42, 0x4a, 0x0d, 0x20, 0x42, 0x80, 0x0d, 0x20, 0x42, 0x03, 0xb6, 0x0d, 0x20, 0x42, 0xe0, 0x0d, 0x4a, 0x42, 0xe0, 0x0d, 0x80, 0x42, 0x04, 0x06,
+    0x04, 0xc5, 0x80, 0x80, 0xdf, 0x0f, 0x3f, 0x16, 0xe1, 0x10, 0x41, 0x17, 0x09, 0x00, 0x07, 0xe0, 0x0f, 0x40, 0x16, 0x00, 0x01, 0x00, 0x01, 0x06,
+    0x31, 0xc5, 0x80, 0x80, 0xbf, 0x1b, 0x1f, 0x59, 0x81, 0x1c, 0xe1, 0x59, 0x3a, 0x00, 0x01, 0x80, 0x1c, 0x80, 0x59, 0x03, 0x80, 0x1c, 0xb6, 0x59,
+    0x56, 0x1c, 0xe0, 0x59, 0x20, 0x1c, 0xe0, 0x59, 0x03, 0xea, 0x1b, 0xe0, 0x59, 0xc0, 0x1b, 0xb6, 0x59, 0xc0, 0x1b, 0x80, 0x59, 0x03, 0xc0, 0x1b,
+    0x4a, 0x59, 0xea, 0x1b, 0x20, 0x59, 0x20, 0x1c, 0x20, 0x59, 0x03, 0x56, 0x1c, 0x20, 0x59, 0x80, 0x1c, 0x4a, 0x59, 0x80, 0x1c, 0x80, 0x59, 0x04,
+    0x06, 0x0e, 0xc7, 0x80, 0x80, 0x9f, 0x31, 0xdf, 0x14, 0xe1, 0x34, 0x21, 0x18, 0x09, 0x00, 0x07, 0xa0, 0x31, 0xe0, 0x14, 0x40, 0x03, 0x40, 0x03,
+    0x06, 0x14, 0xc5, 0x80, 0x80, 0x1f, 0x06, 0x9f, 0x46, 0x21, 0x07, 0xa1, 0x47, 0x09, 0x00, 0x07, 0x20, 0x06, 0xa0, 0x46, 0x00, 0x01, 0x00, 0x01,
+    0x06, 0x0d, 0xc7, 0x80, 0x80, 0x1f, 0x3d, 0xbf, 0x4b, 0xe1, 0x3f, 0x81, 0x4e, 0x09, 0x00, 0x07, 0x20, 0x3d, 0xc0, 0x4b, 0xc0, 0x02, 0xc0, 0x02,
+    0x06, 0x1d, 0xc6, 0x80, 0x80, 0x3d, 0x3c, 0xe0, 0x48, 0x83, 0x3e, 0x20, 0x4b, 0x09, 0x00, 0x07, 0x3e, 0x3c, 0xe2, 0x48, 0x43, 0x02, 0x3d, 0x02,
+    0x06, 0x13, 0xc2, 0x80, 0x80, 0x5f, 0x00, 0x7f, 0x29, 0xe1, 0x00, 0x01, 0x2a, 0x09, 0x00, 0x07, 0x60, 0x00, 0x80, 0x29, 0x80, 0x00, 0x80, 0x00,
+    0x06, 0x1d, 0xc6, 0x80, 0x80, 0xff, 0x55, 0x3f, 0x2f, 0x81, 0x57, 0xc1, 0x30, 0x09, 0x00, 0x07, 0x00, 0x56, 0x40, 0x2f, 0x80, 0x01, 0x80, 0x01,
+    0x06, 0x1a, 0xc7, 0x80, 0x80, 0x3d, 0x33, 0x40, 0x36, 0x43, 0x36, 0x40, 0x39, 0x09, 0x00, 0x07, 0x3e, 0x33, 0x42, 0x36, 0x03, 0x03, 0xfd, 0x02,
+    0x06, 0x02, 0xc7, 0x80, 0x80, 0x3f, 0x17, 0x1f, 0x28, 0x81, 0x1a, 0x61, 0x2b, 0x09, 0x00, 0x07, 0x40, 0x17, 0x20, 0x28, 0x40, 0x03, 0x40, 0x03,
+    0x06, 0x26, 0xc6, 0x80, 0x80, 0x9f, 0x52, 0x1f, 0x22, 0x21, 0x54, 0xa1, 0x23, 0x09, 0x00, 0x07, 0xa0, 0x52, 0x20, 0x22, 0x80, 0x01, 0x80, 0x01,
+    0x06, 0x1c, 0xc6, 0x80, 0x80, 0x3f, 0x20, 0x1f, 0x01, 0xc1, 0x21, 0xa1, 0x02, 0x09, 0x00, 0x07, 0x40, 0x20, 0x20, 0x01, 0x80, 0x01, 0x80, 0x01,
+    0x06, 0x0d, 0xc7, 0x80, 0x80, 0x1f, 0x54, 0x5f, 0x39, 0xe1, 0x57, 0x21, 0x3d, 0x09, 0x00, 0x07, 0x20, 0x54, 0x60, 0x39, 0xc0, 0x03, 0xc0, 0x03,
+    0x06, 0x18, 0xc7, 0x80, 0x80, 0x1f, 0x13, 0xff, 0x2d, 0x61, 0x16, 0x41, 0x31, 0x09, 0x00, 0x07, 0x20, 0x13, 0x00, 0x2e, 0x40, 0x03, 0x40, 0x03,
+    0x06, 0x1b, 0xc6, 0x80, 0x80, 0x7f, 0x5b, 0xbf, 0x55, 0x01, 0x5d, 0x41, 0x57, 0x09, 0x00, 0x07, 0x80, 0x5b, 0xc0, 0x55, 0x80, 0x01, 0x80, 0x01,
+    0x06, 0x0d, 0xc5, 0x80, 0x80, 0x1f, 0x53, 0x3f, 0x3e, 0xe1, 0x53, 0x01, 0x3f, 0x3a, 0x00, 0x01, 0xe0, 0x53, 0xa0, 0x3e, 0x03, 0xe0, 0x53, 0xd6,
+    0x3e, 0xb6, 0x53, 0x00, 0x3f, 0x80, 0x53, 0x00, 0x3f, 0x03, 0x4a, 0x53, 0x00, 0x3f, 0x20, 0x53, 0xd6, 0x3e, 0x20, 0x53, 0xa0, 0x3e, 0x03, 0x20,
+    0x53, 0x6a, 0x3e, 0x4a, 0x53, 0x40, 0x3e, 0x80, 0x53, 0x40, 0x3e, 0x03, 0xb6, 0x53, 0x40, 0x3e, 0xe0, 0x53, 0x6a, 0x3e, 0xe0, 0x53, 0xa0, 0x3e,
+    0x04, 0x06, 0x16, 0xc7, 0x80, 0x80, 0x3f, 0x2e, 0xdf, 0x33, 0x81, 0x31, 0x21, 0x37, 0x09, 0x00, 0x07, 0x40, 0x2e, 0xe0, 0x33, 0x40, 0x03, 0x40,
+    0x03, 0x01, 0x03, 0xfe, 0x12, 0xde, 0x19, 0x04, 0xe0, 0x06, 0x06, 0x1c, 0xc5, 0x80, 0x80, 0x5d, 0xff, 0x60, 0xff, 0xa3, 0x00, 0xa0, 0x00, 0x09,
+    0x00, 0x07, 0x5e, 0xff, 0x62, 0xff, 0x43, 0x01, 0x3d, 0x01, 0x02, 0x01, 0x03, 0x3e, 0x02, 0x5e, 0x13, 0x04, 0xe0, 0x06, 0x06, 0x1d, 0xc5, 0x80,
+    0x80, 0x5d, 0xff, 0x60, 0xff, 0xa3, 0x00, 0xa0, 0x00, 0x09, 0x00, 0x07, 0x5e, 0xff, 0x62, 0xff, 0x43, 0x01, 0x3d, 0x01, 0x02, 0x06, 0x02, 0xc6,
+    0x80, 0x80, 0xbf, 0x2c, 0x7f, 0x58, 0x41, 0x2e, 0x01, 0x5a, 0x09, 0x00, 0x07, 0xc0, 0x2c, 0x80, 0x58, 0x80, 0x01, 0x80, 0x01, 0x06, 0x1c, 0xc7,
+    0x80, 0x80, 0x5f, 0x5e, 0x5f, 0x3e, 0x61, 0x60, 0x61, 0x40, 0x09, 0x00, 0x07, 0x60, 0x5e, 0x60, 0x3e, 0x00, 0x02, 0x00, 0x02, 0x06, 0x17, 0xc6,
+    0x80, 0x7f, 0x1b, 0x29, 0xbf, 0x49, 0xe1, 0x2a, 0x7e, 0x4b, 0x09, 0x00, 0x07, 0x1d, 0x29, 0xc0, 0x49, 0xc3, 0x01, 0xbd, 0x01, 0x06, 0x1d, 0xc7,
+    0x7f, 0x80, 0x5f, 0x2e, 0xbf, 0x4b, 0x21, 0x31, 0x81, 0x4e, 0x09, 0x00, 0x07, 0x60, 0x2e, 0xc0, 0x4b, 0xc0, 0x02, 0xc0, 0x02, 0x06, 0x1d, 0xc5,
+    0x80, 0x80, 0x9f, 0x10, 0x1f, 0x5a, 0xa1, 0x11, 0x21, 0x5b, 0x09, 0x00, 0x07, 0xa0, 0x10, 0x20, 0x5a, 0x00, 0x01, 0x00, 0x01, 0x06, 0x0d, 0xc2,
+    0x80, 0x80, 0xbf, 0x5b, 0x5f, 0x1e, 0x41, 0x5c, 0xe1, 0x1e, 0x09, 0x00, 0x07, 0xc0, 0x5b, 0x60, 0x1e, 0x80, 0x00, 0x80, 0x00, 0x06, 0x2c, 0xc7,
+    0x80, 0x80, 0xbd, 0x0e, 0x80, 0x34, 0xc3, 0x11, 0x80, 0x37, 0x09, 0x00, 0x07, 0xbe, 0x0e, 0x82, 0x34, 0x03, 0x03, 0xfd, 0x02, 0x06, 0x12, 0xc7,
+    0x80, 0x80, 0x9f, 0x2a, 0x3f, 0x4c, 0x61, 0x2d, 0x01, 0x4f, 0x09, 0x00, 0x07, 0xa0, 0x2a, 0x40, 0x4c, 0xc0, 0x02, 0xc0, 0x02, 0x06, 0x0c, 0xc6,
+    0x80, 0x80, 0xbf, 0x02, 0xbf, 0x03, 0x41, 0x04, 0x41, 0x05, 0x09, 0x00, 0x07, 0xc0, 0x02, 0xc0, 0x03, 0x80, 0x01, 0x80, 0x01, 0x06, 0x1d, 0xc7,
+    0x80, 0x80, 0x5f, 0x26, 0xbf, 0x0f, 0x21, 0x29, 0x81, 0x12, 0x09, 0x00, 0x07, 0x60, 0x26, 0xc0, 0x0f, 0xc0, 0x02, 0xc0, 0x02, 0x06, 0x02, 0xc6,
+    0x80, 0x80, 0x5d, 0x1b, 0x60, 0x26, 0xa3, 0x1d, 0xa0, 0x28, 0x09, 0x00, 0x07, 0x5e, 0x1b, 0x62, 0x26, 0x43, 0x02, 0x3d, 0x02, 0x06, 0x17, 0xc6,
+    0x80, 0x80, 0x5f, 0x5c, 0x9f, 0x5e, 0xe1, 0x5d, 0x21, 0x60, 0x09, 0x00, 0x07, 0x60, 0x5c, 0xa0, 0x5e, 0x80, 0x01, 0x80, 0x01, 0x06, 0x09, 0xc5,
+    0x80, 0x80, 0x9f, 0x04, 0xdf, 0x27, 0xa1, 0x05, 0xe1, 0x28, 0x09, 0x00, 0x07, 0xa0, 0x04, 0xe0, 0x27, 0x00, 0x01, 0x00, 0x01, 0x06, 0x0f, 0xc2,
+    0x80, 0x80, 0xff, 0x04, 0x3f, 0x22, 0x81, 0x05, 0xc1, 0x22, 0x09, 0x00, 0x07, 0x00, 0x05, 0x40, 0x22, 0x80, 0x00, 0x80, 0x00, 0x06, 0x09, 0xc5,
+    0x7f, 0x80, 0x1f, 0x0b, 0xbf, 0x10, 0x21, 0x0c, 0xc1, 0x11, 0x09, 0x00, 0x07, 0x20, 0x0b, 0xc0, 0x10, 0x00, 0x01, 0x00, 0x01, 0x06, 0x0d, 0xc5,
+    0x80, 0x80, 0x9f, 0x1d, 0x1f, 0x45, 0x61, 0x1e, 0xe1, 0x45, 0x3a, 0x00, 0x01, 0x60, 0x1e, 0x80, 0x45, 0x03, 0x60, 0x1e, 0xb6, 0x45, 0x36, 0x1e,
+    0xe0, 0x45, 0x00, 0x1e, 0xe0, 0x45, 0x03, 0xca, 0x1d, 0xe0, 0x45, 0xa0, 0x1d, 0xb6, 0x45, 0xa0, 0x1d, 0x80, 0x45, 0x03, 0xa0, 0x1d, 0x4a, 0x45,
+    0xca, 0x1d, 0x20, 0x45, 0x00, 0x1e, 0x20, 0x45, 0x03, 0x36, 0x1e, 0x20, 0x45, 0x60, 0x1e, 0x4a, 0x45, 0x60, 0x1e, 0x80, 0x45, 0x04, 0x06, 0x1d,
+    0xc6, 0x80, 0x80, 0x5f, 0x4a, 0xbf, 0x22, 0xe1, 0x4b, 0x41, 0x24, 0x09, 0x00, 0x07, 0x60, 0x4a, 0xc0, 0x22, 0x80, 0x01, 0x80, 0x01, 0x01, 0x03,
+    0x9e, 0x5b, 0x3e, 0x06, 0x04, 0xe0, 0x06, 0x06, 0x1d, 0xc5, 0x80, 0x80, 0x5d, 0xff, 0x60, 0xff, 0xa3, 0x00, 0xa0, 0x00, 0x09, 0x00, 0x07, 0x5e,
+    0xff, 0x62, 0xff, 0x43, 0x01, 0x3d, 0x01, 0x02, 0x06, 0x33, 0xc5, 0x80, 0x80, 0x9f, 0x0b, 0x7f, 0x2a, 0xa1, 0x0c, 0x81, 0x2b, 0x09, 0x00, 0x07,
+    0xa0, 0x0b, 0x80, 0x2a, 0x00, 0x01, 0x00, 0x01, 0x06, 0x1e, 0xc5, 0x80, 0x7f, 0xff, 0x5c, 0x5f, 0x37, 0x01, 0x5e, 0x61, 0x38, 0x09, 0x00, 0x07,
+    0x00, 0x5d, 0x60, 0x37, 0x00, 0x01, 0x00, 0x01, 0x06, 0x06, 0xc5, 0x80, 0x80, 0xdf, 0x1a, 0x1f, 0x47, 0xe1, 0x1b, 0x21, 0x48, 0x09, 0x00, 0x07,
+    0xe0, 0x1a, 0x20, 0x47, 0x00, 0x01, 0x00, 0x01, 0x06, 0x2a, 0xc6, 0x80, 0x7f, 0x7b, 0x28, 0x5f, 0x20, 0x41, 0x2a, 0x1e, 0x22, 0x09, 0x00, 0x07,
+    0x7d, 0x28, 0x60, 0x20, 0xc3, 0x01, 0xbd, 0x01, 0x06, 0x12, 0xc5, 0x80, 0x80, 0x5f, 0x31, 0x3f, 0x38, 0x61, 0x32, 0x41, 0x39, 0x09, 0x00, 0x07,
+    0x60, 0x31, 0x40, 0x38, 0x00, 0x01, 0x00, 0x01, 0x06, 0x1d, 0xc7, 0x80, 0x80, 0xbf, 0x49, 0x9f, 0x06, 0x81, 0x4c, 0x61, 0x09, 0x09, 0x00, 0x07,
+    0xc0, 0x49, 0xa0, 0x06, 0xc0, 0x02, 0xc0, 0x02, 0x06, 0x0d, 0xc5, 0x80, 0x80, 0xbf, 0x2f, 0x7f, 0x51, 0xc1, 0x30, 0x81, 0x52, 0x09, 0x00, 0x07,
+    0xc0, 0x2f, 0x80, 0x51, 0x00, 0x01, 0x00, 0x01, 0x06, 0x32, 0xc5, 0x7f, 0x7f, 0x7f, 0x51, 0xbf, 0x41, 0x41, 0x52, 0x81, 0x42, 0x3a, 0x00, 0x01,
+    0x40, 0x52, 0x20, 0x42, 0x03, 0x40, 0x52, 0x56, 0x42, 0x16, 0x52, 0x80, 0x42, 0xe0, 0x51, 0x80, 0x42, 0x03, 0xaa, 0x51, 0x80, 0x42, 0x80, 0x51,
+    0x56, 0x42, 0x80, 0x51, 0x20, 0x42, 0x03, 0x80, 0x51, 0xea, 0x41, 0xaa, 0x51, 0xc0, 0x41, 0xe0, 0x51, 0xc0, 0x41, 0x03, 0x16, 0x52, 0xc0, 0x41,
+    0x40, 0x52, 0xea, 0x41, 0x40, 0x52, 0x20, 0x42, 0x04, 0x06, 0x1a, 0xc2, 0x80, 0x80, 0x3f, 0x47, 0xff, 0x29, 0xc1, 0x47, 0x81, 0x2a, 0x09, 0x00,
+    0x07, 0x40, 0x47, 0x00, 0x2a, 0x80, 0x00, 0x80, 0x00, 0x06, 0x0d, 0xc5, 0x80, 0x80, 0x1f, 0x1b, 0xbf, 0x41, 0x21, 0x1c, 0xc1, 0x42, 0x09, 0x00,
+    0x07, 0x20, 0x1b, 0xc0, 0x41, 0x00, 0x01, 0x00, 0x01, 0x06, 0x28, 0xc2, 0x80, 0x80, 0xff, 0x02, 0x9f, 0x32, 0x81, 0x03, 0x21, 0x33, 0x09, 0x00,
+    0x07, 0x00, 0x03, 0xa0, 0x32, 0x80, 0x00, 0x80, 0x00, 0x06, 0x1d, 0xc7, 0x80, 0x80, 0xdf, 0x3b, 0xbf, 0x34, 0x21, 0x3f, 0x01, 0x38, 0x09, 0x00,
+    0x07, 0xe0, 0x3b, 0xc0, 0x34, 0x40, 0x03, 0x40, 0x03, 0x06, 0x21, 0xc7, 0x80, 0x80, 0xbf, 0x3e, 0xdf, 0x09, 0x81, 0x42, 0xa1, 0x0d, 0x09, 0x00,
+    0x07, 0xc0, 0x3e, 0xe0, 0x09, 0xc0, 0x03, 0xc0, 0x03, 0x06, 0x10, 0xc5, 0x80, 0x80, 0x9f, 0x00, 0x3f, 0x31, 0xa1, 0x01, 0x41, 0x32, 0x09, 0x00,
+    0x07, 0xa0, 0x00, 0x40, 0x31, 0x00, 0x01, 0x00, 0x01, 0x06, 0x1d, 0xc5, 0x80, 0x80, 0x3f, 0x52, 0x3f, 0x4f, 0x01, 0x53, 0x01, 0x50, 0x3a, 0x00,
+    0x01, 0x00, 0x53, 0xa0, 0x4f, 0x03, 0x00, 0x53, 0xd6, 0x4f, 0xd6, 0x52, 0x00, 0x50, 0xa0, 0x52, 0x00, 0x50, 0x03, 0x6a, 0x52, 0x00, 0x50, 0x40,
+    0x52, 0xd6, 0x4f, 0x40, 0x52, 0xa0, 0x4f, 0x03, 0x40, 0x52, 0x6a, 0x4f, 0x6a, 0x52, 0x40, 0x4f, 0xa0, 0x52, 0x40, 0x4f, 0x03, 0xd6, 0x52, 0x40,
+    0x4f, 0x00, 0x53, 0x6a, 0x4f, 0x00, 0x53, 0xa0, 0x4f, 0x04, 0x06, 0x0a, 0xc5, 0x7f, 0x7f, 0x5f, 0x5d, 0x5f, 0x45, 0x21, 0x5e, 0x21, 0x46, 0x3a,
+    0x00, 0x01, 0x20, 0x5e, 0xc0, 0x45, 0x03, 0x20, 0x5e, 0xf6, 0x45, 0xf6, 0x5d, 0x20, 0x46, 0xc0, 0x5d, 0x20, 0x46, 0x03, 0x8a, 0x5d, 0x20, 0x46,
+    0x60, 0x5d, 0xf6, 0x45, 0x60, 0x5d, 0xc0, 0x45, 0x03, 0x60, 0x5d, 0x8a, 0x45, 0x8a, 0x5d, 0x60, 0x45, 0xc0, 0x5d, 0x60, 0x45, 0x03, 0xf6, 0x5d,
+    0x60, 0x45, 0x20, 0x5e, 0x8a, 0x45, 0x20, 0x5e, 0xc0, 0x45, 0x04, 0x06, 0x1a, 0xc7, 0x80, 0x80, 0xff, 0x5a, 0x9f, 0x10, 0x01, 0x5d, 0xa1, 0x12,
+    0x09, 0x00, 0x07, 0x00, 0x5b, 0xa0, 0x10, 0x00, 0x02, 0x00, 0x02, 0x06, 0x08, 0xc5, 0x80, 0x80, 0xbf, 0x12, 0x1f, 0x4a, 0xc1, 0x13, 0x21, 0x4b,
+    0x09, 0x00, 0x07, 0xc0, 0x12, 0x20, 0x4a, 0x00, 0x01, 0x00, 0x01, 0x06, 0x1d, 0xc7, 0x80, 0x80, 0x7f, 0x5d, 0x3f, 0x31, 0x81, 0x5f, 0x41, 0x33,
+    0x09, 0x00, 0x07, 0x80, 0x5d, 0x40, 0x31, 0x00, 0x02, 0x00, 0x02, 0x06, 0x03, 0xc5, 0x80, 0x80, 0xbf, 0x08, 0x5f, 0x03, 0xc1, 0x09, 0x61, 0x04,
+    0x09, 0x00, 0x07, 0xc0, 0x08, 0x60, 0x03, 0x00, 0x01, 0x00, 0x01, 0x06, 0x0d, 0xc5, 0x80, 0x80, 0x7f, 0x12, 0x9f, 0x08, 0x41, 0x13, 0x61, 0x09,
+    0x3a, 0x00, 0x01, 0x40, 0x13, 0x00, 0x09, 0x03, 0x40, 0x13, 0x36, 0x09, 0x16, 0x13, 0x60, 0x09, 0xe0, 0x12, 0x60, 0x09, 0x03, 0xaa, 0x12, 0x60,
+    0x09, 0x80, 0x12, 0x36, 0x09, 0x80, 0x12, 0x00, 0x09, 0x03, 0x80, 0x12, 0xca, 0x08, 0xaa, 0x12, 0xa0, 0x08, 0xe0, 0x12, 0xa0, 0x08, 0x03, 0x16,
+    0x13, 0xa0, 0x08, 0x40, 0x13, 0xca, 0x08, 0x40, 0x13, 0x00, 0x09, 0x04, 0x06, 0x28, 0xc7, 0x80, 0x80, 0x5f, 0x17, 0x5f, 0x10, 0xe1, 0x19, 0xe1,
+    0x12, 0x09, 0x00, 0x07, 0x60, 0x17, 0x60, 0x10, 0x80, 0x02, 0x80, 0x02, 0x06, 0x18, 0xc6, 0x80, 0x80, 0xbf, 0x06, 0x1f, 0x01, 0x41, 0x08, 0xa1,
+    0x02, 0x09, 0x00, 0x07, 0xc0, 0x06, 0x20, 0x01, 0x80, 0x01, 0x80, 0x01, 0x06, 0x2c, 0xc2, 0x80, 0x7f, 0x1f, 0x56, 0xbf, 0x0e, 0xa1, 0x56, 0x41,
+    0x0f, 0x09, 0x00, 0x07, 0x20, 0x56, 0xc0, 0x0e, 0x80, 0x00, 0x80, 0x00, 0x06, 0x18, 0xc7, 0x80, 0x80, 0x3f, 0x34, 0xbf, 0x58, 0x41, 0x36, 0xc1,
+    0x5a, 0x09, 0x00, 0x07, 0x40, 0x34, 0xc0, 0x58, 0x00, 0x02, 0x00, 0x02, 0x06, 0x19, 0xc5, 0x7f, 0x7f, 0xbf, 0x1d, 0x3f, 0x55, 0x81, 0x1e, 0x01,
+    0x56, 0x3a, 0x00, 0x01, 0x80, 0x1e, 0xa0, 0x55, 0x03, 0x80, 0x1e, 0xd6, 0x55, 0x56, 0x1e, 0x00, 0x56, 0x20, 0x1e, 0x00, 0x56, 0x03, 0xea, 0x1d,
+    0x00, 0x56, 0xc0, 0x1d, 0xd6, 0x55, 0xc0, 0x1d, 0xa0, 0x55, 0x03, 0xc0, 0x1d, 0x6a, 0x55, 0xea, 0x1d, 0x40, 0x55, 0x20, 0x1e, 0x40, 0x55, 0x03,
+    0x56, 0x1e, 0x40, 0x55, 0x80, 0x1e, 0x6a, 0x55, 0x80, 0x1e, 0xa0, 0x55, 0x04, 0x01, 0x03, 0x7e, 0x3c, 0x9e, 0x1d, 0x04, 0xe0, 0x06, 0x06, 0x1d,
+    0xc5, 0x80, 0x80, 0x5d, 0xff, 0x60, 0xff, 0xa3, 0x00, 0xa0, 0x00, 0x09, 0x00, 0x07, 0x5e, 0xff, 0x62, 0xff, 0x43, 0x01, 0x3d, 0x01, 0x02, 0x06,
+    0x18, 0xc5, 0x80, 0x80, 0x5f, 0x52, 0xff, 0x59, 0x61, 0x53, 0x01, 0x5b, 0x09, 0x00, 0x07, 0x60, 0x52, 0x00, 0x5a, 0x00, 0x01, 0x00, 0x01, 0x06,
+    0x32, 0xc7, 0x80, 0x80, 0x9d, 0x22, 0xc0, 0x26, 0x23, 0x26, 0x40, 0x2a, 0x09, 0x00, 0x07, 0x9e, 0x22, 0xc2, 0x26, 0x83, 0x03, 0x7d, 0x03, 0x06,
+    0x16, 0xc5, 0x80, 0x80, 0x5f, 0x50, 0x7f, 0x2f, 0x61, 0x51, 0x81, 0x30, 0x09, 0x00, 0x07, 0x60, 0x50, 0x80, 0x2f, 0x00, 0x01, 0x00, 0x01, 0x06,
+    0x1d, 0xc7, 0x80, 0x80, 0x1f, 0x28, 0xbf, 0x27, 0xa1, 0x2a, 0x41, 0x2a, 0x09, 0x00, 0x07, 0x20, 0x28, 0xc0, 0x27, 0x80, 0x02, 0x80, 0x02, 0x06,
+    0x22, 0xc2, 0x80, 0x7f, 0xff, 0x03, 0xbf, 0x3b, 0x81, 0x04, 0x41, 0x3c, 0x09, 0x00, 0x07, 0x00, 0x04, 0xc0, 0x3b, 0x80, 0x00, 0x80, 0x00, 0x06,
+    0x1c, 0xc7, 0x80, 0x80, 0x9f, 0x1f, 0x5f, 0x45, 0xa1, 0x21, 0x61, 0x47, 0x09, 0x00, 0x07, 0xa0, 0x1f, 0x60, 0x45, 0x00, 0x02, 0x00, 0x02, 0x01,
+    0x03, 0x9e, 0x07, 0x5e, 0x0d, 0x04, 0xe0, 0x06, 0x06, 0x0d, 0xc5, 0x80, 0x80, 0x5d, 0xff, 0x60, 0xff, 0xa3, 0x00, 0xa0, 0x00, 0x09, 0x00, 0x07,
+    0x5e, 0xff, 0x62, 0xff, 0x43, 0x01, 0x3d, 0x01, 0x02, 0x06, 0x26, 0xc7, 0x80, 0x80, 0x3d, 0x57, 0x80, 0x3c, 0x43, 0x5a, 0x80, 0x3f, 0x09, 0x00,
+    0x07, 0x3e, 0x57, 0x82, 0x3c, 0x03, 0x03, 0xfd, 0x02, 0x06, 0x13, 0xc2, 0x80, 0x80, 0xdf, 0x20, 0xff, 0x5b, 0x61, 0x21, 0x81, 0x5c, 0x09, 0x00,
+    0x07, 0xe0, 0x20, 0x00, 0x5c, 0x80, 0x00, 0x80, 0x00, 0x06, 0x12, 0xc5, 0x80, 0x80, 0x9f, 0x19, 0xbf, 0x3d, 0xa1, 0x1a, 0xc1, 0x3e, 0x09, 0x00,
+    0x07, 0xa0, 0x19, 0xc0, 0x3d, 0x00, 0x01, 0x00, 0x01, 0x06, 0x1d, 0xc5, 0x80, 0x80, 0x9f, 0x45, 0x9f, 0x11, 0xa1, 0x46, 0xa1, 0x12, 0x09, 0x00,
+    0x07, 0xa0, 0x45, 0xa0, 0x11, 0x00, 0x01, 0x00, 0x01, 0x06, 0x1d, 0xc6, 0x80, 0x7f, 0xbb, 0x4d, 0x3f, 0x44, 0x81, 0x4f, 0xfe, 0x45, 0x09, 0x00,
+    0x07, 0xbd, 0x4d, 0x40, 0x44, 0xc3, 0x01, 0xbd, 0x01, 0x06, 0x0d, 0xc7, 0x80, 0x80, 0x7f, 0x57, 0x9f, 0x22, 0x01, 0x5a, 0x21, 0x25, 0x09, 0x00,
+    0x07, 0x80, 0x57, 0xa0, 0x22, 0x80, 0x02, 0x80, 0x02, 0x06, 0x0d, 0xc7, 0x7f, 0x7f, 0xdf, 0x1c, 0xdf, 0x36, 0xe1, 0x1e, 0xe1, 0x38, 0x09, 0x00,
+    0x07, 0xe0, 0x1c, 0xe0, 0x36, 0x00, 0x02, 0x00, 0x02, 0x06, 0x16, 0xc6, 0x80, 0x7f, 0xbb, 0x2e, 0xdf, 0x20, 0x81, 0x30, 0x9e, 0x22, 0x09, 0x00,
+    0x07, 0xbd, 0x2e, 0xe0, 0x20, 0xc3, 0x01, 0xbd, 0x01, 0x06, 0x2b, 0xc7, 0x80, 0x80, 0xff, 0x0f, 0x1f, 0x43, 0x01, 0x12, 0x21, 0x45, 0x09, 0x00,
+    0x07, 0x00, 0x10, 0x20, 0x43, 0x00, 0x02, 0x00, 0x02, 0x06, 0x20, 0xc2, 0x80, 0x7f, 0x1f, 0x58, 0x3f, 0x57, 0xa1, 0x58, 0xc1, 0x57, 0x09, 0x00,
+    0x07, 0x20, 0x58, 0x40, 0x57, 0x80, 0x00, 0x80, 0x00, 0x06, 0x1d, 0xc6, 0x80, 0x80, 0xff, 0x0b, 0xff, 0x30, 0x81, 0x0d, 0x81, 0x32, 0x09, 0x00,
+    0x07, 0x00, 0x0c, 0x00, 0x31, 0x80, 0x01, 0x80, 0x01, 0x06, 0x28, 0xc6, 0x80, 0x7f, 0xdb, 0x15, 0x9f, 0x24, 0xa1, 0x17, 0x5e, 0x26, 0x09, 0x00,
+    0x07, 0xdd, 0x15, 0xa0, 0x24, 0xc3, 0x01, 0xbd, 0x01, 0x01, 0x03, 0xfe, 0x1a, 0x7e, 0x4a, 0x04, 0xe0, 0x06, 0x06, 0x1d, 0xc5, 0x80, 0x80, 0x5d,
+    0xff, 0x60, 0xff, 0xa3, 0x00, 0xa0, 0x00, 0x09, 0x00, 0x07, 0x5e, 0xff, 0x62, 0xff, 0x43, 0x01, 0x3d, 0x01, 0x02, 0x01, 0x03, 0xde, 0x04, 0x1e,
+    0x40, 0x04, 0xe0, 0x06, 0x06, 0x1d, 0xc5, 0x80, 0x80, 0x5d, 0xff, 0x60, 0xff, 0xa3, 0x00, 0xa0, 0x00, 0x09, 0x00, 0x07, 0x5e, 0xff, 0x62, 0xff,
+    0x43, 0x01, 0x3d, 0x01, 0x02, 0x06, 0x28, 0xc7, 0x80, 0x80, 0x3f, 0x0c, 0x3f, 0x36, 0x41, 0x0e, 0x41, 0x38, 0x09, 0x00, 0x07, 0x40, 0x0c, 0x40,
+    0x36, 0x00, 0x02, 0x00, 0x02, 0x01, 0x03, 0xde, 0x58, 0x9e, 0x4e, 0x04, 0xe0, 0x06, 0x06, 0x1d, 0xc5, 0x80, 0x80, 0x5d, 0xff, 0x60, 0xff, 0xa3,
+    0x00, 0xa0, 0x00, 0x09, 0x00, 0x07, 0x5e, 0xff, 0x62, 0xff, 0x43, 0x01, 0x3d, 0x01, 0x02, 0x06, 0x1b, 0xc7, 0x80, 0x80, 0x7d, 0x4a, 0x40, 0x1b,
+    0x83, 0x4d, 0x40, 0x1e, 0x09, 0x00, 0x07, 0x7e, 0x4a, 0x42, 0x1b, 0x03, 0x03, 0xfd, 0x02, 0x06, 0x1a, 0xc7, 0x80, 0x80, 0xbf, 0x3d, 0xff, 0x22,
+    0x41, 0x40, 0x81, 0x25, 0x09, 0x00, 0x07, 0xc0, 0x3d, 0x00, 0x23, 0x80, 0x02, 0x80, 0x02, 0x06, 0x1b, 0xc5, 0x80, 0x80, 0xdf, 0x16, 0x9f, 0x04,
+    0xe1, 0x17, 0xa1, 0x05, 0x09, 0x00, 0x07, 0xe0, 0x16, 0xa0, 0x04, 0x00, 0x01, 0x00, 0x01, 0x06, 0x1d, 0xc7, 0x80, 0x80, 0x5f, 0x46, 0x3f, 0x03,
+    0x21, 0x49, 0x01, 0x06, 0x09, 0x00, 0x07, 0x60, 0x46, 0x40, 0x03, 0xc0, 0x02, 0xc0, 0x02, 0x06, 0x28, 0xc7, 0x80, 0x80, 0x1f, 0x17, 0x7f, 0x54,
+    0x21, 0x19, 0x81, 0x56, 0x09, 0x00, 0x07, 0x20, 0x17, 0x80, 0x54, 0x00, 0x02, 0x00, 0x02, 0x06, 0x1b, 0xc7, 0x80, 0x80, 0x7f, 0x2a, 0x3f, 0x3c,
+    0x81, 0x2c, 0x41, 0x3e, 0x09, 0x00, 0x07, 0x80, 0x2a, 0x40, 0x3c, 0x00, 0x02, 0x00, 0x02, 0x06, 0x1b, 0xc7, 0x80, 0x80, 0x7f, 0x49, 0xff, 0x32,
+    0x41, 0x4c, 0xc1, 0x35, 0x09, 0x00, 0x07, 0x80, 0x49, 0x00, 0x33, 0xc0, 0x02, 0xc0, 0x02, 0x06, 0x16, 0xc6, 0x80, 0x7f, 0x7b, 0x0f, 0xff, 0x0a,
+    0x41, 0x11, 0xbe, 0x0c, 0x09, 0x00, 0x07, 0x7d, 0x0f, 0x00, 0x0b, 0xc3, 0x01, 0xbd, 0x01, 0x01, 0x03, 0x5e, 0x3d, 0x7e, 0x14, 0x04, 0xe0, 0x06,
+    0x06, 0x22, 0xc5, 0x80, 0x80, 0x5d, 0xff, 0x60, 0xff, 0xa3, 0x00, 0xa0, 0x00, 0x09, 0x00, 0x07, 0x5e, 0xff, 0x62, 0xff, 0x43, 0x01, 0x3d, 0x01,
+    0x02, 0x06, 0x1c, 0xc6, 0x80, 0x80, 0x1f, 0x5c, 0xbf, 0x3a, 0xa1, 0x5d, 0x41, 0x3c, 0x09, 0x00, 0x07, 0x20, 0x5c, 0xc0, 0x3a, 0x80, 0x01, 0x80,
+    0x01, 0x06, 0x08, 0xc5, 0x80, 0x80, 0x1f, 0x39, 0x1f, 0x12, 0xe1, 0x39, 0xe1, 0x12, 0x3a, 0x00, 0x01, 0xe0, 0x39, 0x80, 0x12, 0x03, 0xe0, 0x39,
+    0xb6, 0x12, 0xb6, 0x39, 0xe0, 0x12, 0x80, 0x39, 0xe0, 0x12, 0x03, 0x4a, 0x39, 0xe0, 0x12, 0x20, 0x39, 0xb6, 0x12, 0x20, 0x39, 0x80, 0x12, 0x03,
+    0x20, 0x39, 0x4a, 0x12, 0x4a, 0x39, 0x20, 0x12, 0x80, 0x39, 0x20, 0x12, 0x03, 0xb6, 0x39, 0x20, 0x12, 0xe0, 0x39, 0x4a, 0x12, 0xe0, 0x39, 0x80,
+    0x12, 0x04, 0x06, 0x0d, 0xc7, 0x80, 0x80, 0x1d, 0x43, 0x60, 0x2a, 0xa3, 0x46, 0xe0, 0x2d, 0x09, 0x00, 0x07, 0x1e, 0x43, 0x62, 0x2a, 0x83, 0x03,
+    0x7d, 0x03, 0x01, 0x03, 0x7e, 0x5f, 0x9e, 0x51, 0x04, 0xe0, 0x06, 0x06, 0x0a, 0xc5, 0x80, 0x80, 0x5d, 0xff, 0x60, 0xff, 0xa3, 0x00, 0xa0, 0x00,
+    0x09, 0x00, 0x07, 0x5e, 0xff, 0x62, 0xff, 0x43, 0x01, 0x3d, 0x01, 0x02, 0x06, 0x1a, 0xc7, 0x80, 0x80, 0x5f, 0x3d, 0x3f, 0x3b, 0xa1, 0x40, 0x81,
+    0x3e, 0x09, 0x00, 0x07, 0x60, 0x3d, 0x40, 0x3b, 0x40, 0x03, 0x40, 0x03, 0x06, 0x08, 0xc8, 0x80, 0x80, 0xdf, 0x3b, 0x3f, 0x1e, 0x21, 0x41, 0x81,
+    0x23, 0x09, 0x00, 0x07, 0xe0, 0x3b, 0x40, 0x1e, 0x40, 0x05, 0x40, 0x05, 0x06, 0x1b, 0xc2, 0x80, 0x80, 0xdf, 0x15, 0x9f, 0x3b, 0x61, 0x16, 0x21,
+    0x3c, 0x09, 0x00, 0x07, 0xe0, 0x15, 0xa0, 0x3b, 0x80, 0x00, 0x80, 0x00, 0x06, 0x24, 0xc8, 0x80, 0x80, 0xdf, 0x3a, 0x7f, 0x24, 0x21, 0x3f, 0xc1,
+    0x28, 0x09, 0x00, 0x07, 0xe0, 0x3a, 0x80, 0x24, 0x40, 0x04, 0x40, 0x04, 0x06, 0x08, 0xc7, 0x80, 0x80, 0x5f, 0x42, 0xdf, 0x21, 0x21, 0x46, 0xa1,
+    0x25, 0x09, 0x00, 0x07, 0x60, 0x42, 0xe0, 0x21, 0xc0, 0x03, 0xc0, 0x03, 0x06, 0x1d, 0xc6, 0x80, 0x80, 0xdf, 0x21, 0x7f, 0x0f, 0x61, 0x23, 0x01,
+    0x11, 0x09, 0x00, 0x07, 0xe0, 0x21, 0x80, 0x0f, 0x80, 0x01, 0x80, 0x01, 0x01, 0x03, 0xde, 0x32, 0xde, 0x50, 0x04, 0xe0, 0x06, 0x06, 0x10, 0xc5,
+    0x80, 0x80, 0x5d, 0xff, 0x60, 0xff, 0xa3, 0x00, 0xa0, 0x00, 0x09, 0x00, 0x07, 0x5e, 0xff, 0x62, 0xff, 0x43, 0x01, 0x3d, 0x01, 0x02, 0x06, 0x0c,
+    0xc2, 0x80, 0x80, 0x3f, 0x24, 0x9f, 0x5d, 0xc1, 0x24, 0x21, 0x5e, 0x09, 0x00, 0x07, 0x40, 0x24, 0xa0, 0x5d, 0x80, 0x00, 0x80, 0x00, 0x06, 0x1d,
+    0xc7, 0x80, 0x80, 0x5f, 0x41, 0x9f, 0x17, 0x21, 0x45, 0x61, 0x1b, 0x09, 0x00, 0x07, 0x60, 0x41, 0xa0, 0x17, 0xc0, 0x03, 0xc0, 0x03, 0x01, 0x03,
+    0x1e, 0x37, 0xde, 0x56, 0x04, 0xe0, 0x06, 0x06, 0x1e, 0xc5, 0x80, 0x80, 0x5d, 0xff, 0x60, 0xff, 0xa3, 0x00, 0xa0, 0x00, 0x09, 0x00, 0x07, 0x5e,
+    0xff, 0x62, 0xff, 0x43, 0x01, 0x3d, 0x01, 0x02, 0x06, 0x12, 0xc7, 0x80, 0x80, 0x7f, 0x2c, 0x7f, 0x01, 0xc1, 0x2f, 0xc1, 0x04, 0x09, 0x00, 0x07,
+    0x80, 0x2c, 0x80, 0x01, 0x40, 0x03, 0x40, 0x03, 0x06, 0x17, 0xc5, 0x80, 0x80, 0x9f, 0x5f, 0xbf, 0x08, 0xa1, 0x60, 0xc1, 0x09, 0x09, 0x00, 0x07,
+    0xa0, 0x5f, 0xc0, 0x08, 0x00, 0x01, 0x00, 0x01, 0x06, 0x2c, 0xc6, 0x80, 0x80, 0x3f, 0x36, 0x7f, 0x48, 0xc1, 0x37, 0x01, 0x4a, 0x09, 0x00, 0x07,
+    0x40, 0x36, 0x80, 0x48, 0x80, 0x01, 0x80, 0x01, 0x06, 0x19, 0xc6, 0x80, 0x7f, 0xdb, 0x2a, 0x5f, 0x2f, 0xa1, 0x2c, 0x1e, 0x31, 0x09, 0x00, 0x07,
+    0xdd, 0x2a, 0x60, 0x2f, 0xc3, 0x01, 0xbd, 0x01, 0x01, 0x03, 0xfe, 0x44, 0xde, 0x30, 0x04, 0xe0, 0x06, 0x06, 0x0b, 0xc5, 0x80, 0x80, 0x5d, 0xff,
+    0x60, 0xff, 0xa3, 0x00, 0xa0, 0x00, 0x09, 0x00, 0x07, 0x5e, 0xff, 0x62, 0xff, 0x43, 0x01, 0x3d, 0x01, 0x02, 0x06, 0x08, 0xc7, 0x80, 0x80, 0xbf,
+    0x38, 0xff, 0x37, 0x01, 0x3c, 0x41, 0x3b, 0x09, 0x00, 0x07, 0xc0, 0x38, 0x00, 0x38, 0x40, 0x03, 0x40, 0x03, 0x06, 0x2c, 0xc7, 0x80, 0x80, 0x5d,
+    0x0d, 0x80, 0x27, 0x63, 0x10, 0x80, 0x2a, 0x09, 0x00, 0x07, 0x5e, 0x0d, 0x82, 0x27, 0x03, 0x03, 0xfd, 0x02, 0x06, 0x1d, 0xc6, 0x80, 0x80, 0x1f,
+    0x23, 0x3f, 0x04, 0xa1, 0x24, 0xc1, 0x05, 0x09, 0x00, 0x07, 0x20, 0x23, 0x40, 0x04, 0x80, 0x01, 0x80, 0x01, 0x06, 0x08, 0xc5, 0x80, 0x7f, 0xff,
+    0x09, 0x9f, 0x3c, 0x01, 0x0b, 0xa1, 0x3d, 0x09, 0x00, 0x07, 0x00, 0x0a, 0xa0, 0x3c, 0x00, 0x01, 0x00, 0x01, 0x06, 0x31, 0xc5, 0x80, 0x80, 0x5f,
+    0x03, 0x5f, 0x37, 0x21, 0x04, 0x21, 0x38, 0x3a, 0x00, 0x01, 0x20, 0x04, 0xc0, 0x37, 0x03, 0x20, 0x04, 0xf6, 0x37, 0xf6, 0x03, 0x20, 0x38, 0xc0,
+    0x03, 0x20, 0x38, 0x03, 0x8a, 0x03, 0x20, 0x38, 0x60, 0x03, 0xf6, 0x37, 0x60, 0x03, 0xc0, 0x37, 0x03, 0x60, 0x03, 0x8a, 0x37, 0x8a, 0x03, 0x60,
+    0x37, 0xc0, 0x03, 0x60, 0x37, 0x03, 0xf6, 0x03, 0x60, 0x37, 0x20, 0x04, 0x8a, 0x37, 0x20, 0x04, 0xc0, 0x37, 0x04, 0x06, 0x1d, 0xc6, 0x80, 0x80,
+    0x3f, 0x1a, 0x7f, 0x39, 0xc1, 0x1b, 0x01, 0x3b, 0x09, 0x00, 0x07, 0x40, 0x1a, 0x80, 0x39, 0x80, 0x01, 0x80, 0x01, 0x01, 0x03, 0xde, 0x25, 0x5e,
+    0x08, 0x04, 0xe0, 0x06, 0x06, 0x03, 0xc5, 0x80, 0x80, 0x5d, 0xff, 0x60, 0xff, 0xa3, 0x00, 0xa0, 0x00, 0x09, 0x00, 0x07, 0x5e, 0xff, 0x62, 0xff,
+    0x43, 0x01, 0x3d, 0x01, 0x02, 0x06, 0x0d, 0xc5, 0x7f, 0x7f, 0xbf, 0x12, 0x3f, 0x10, 0x81, 0x13, 0x01, 0x11, 0x3a, 0x00, 0x01, 0x80, 0x13, 0xa0,
+    0x10, 0x03, 0x80, 0x13, 0xd6, 0x10, 0x56, 0x13, 0x00, 0x11, 0x20, 0x13, 0x00, 0x11, 0x03, 0xea, 0x12, 0x00, 0x11, 0xc0, 0x12, 0xd6, 0x10, 0xc0,
+    0x12, 0xa0, 0x10, 0x03, 0xc0, 0x12, 0x6a, 0x10, 0xea, 0x12, 0x40, 0x10, 0x20, 0x13, 0x40, 0x10, 0x03, 0x56, 0x13, 0x40, 0x10, 0x80, 0x13, 0x6a,
+    0x10, 0x80, 0x13, 0xa0, 0x10, 0x04, 0x06, 0x1f, 0xc7, 0x7f, 0x80, 0x5f, 0x3c, 0x1f, 0x3f, 0x21, 0x3f, 0xe1, 0x41, 0x09, 0x00, 0x07, 0x60, 0x3c,
+    0x20, 0x3f, 0xc0, 0x02, 0xc0, 0x02, 0x06, 0x13, 0xc5, 0x80, 0x80, 0x9f, 0x00, 0xbf, 0x3d, 0x61, 0x01, 0x81, 0x3e, 0x3a, 0x00, 0x01, 0x60, 0x01,
+    0x20, 0x3e, 0x03, 0x60, 0x01, 0x56, 0x3e, 0x36, 0x01, 0x80, 0x3e, 0x00, 0x01, 0x80, 0x3e, 0x03, 0xca, 0x00, 0x80, 0x3e, 0xa0, 0x00, 0x56, 0x3e,
+    0xa0, 0x00, 0x20, 0x3e, 0x03, 0xa0, 0x00, 0xea, 0x3d, 0xca, 0x00, 0xc0, 0x3d, 0x00, 0x01, 0xc0, 0x3d, 0x03, 0x36, 0x01, 0xc0, 0x3d, 0x60, 0x01,
+    0xea, 0x3d, 0x60, 0x01, 0x20, 0x3e, 0x04, 0x06, 0x1c, 0xc2, 0x7f, 0x80, 0x9f, 0x01, 0xbf, 0x47, 0x21, 0x02, 0x41, 0x48, 0x09, 0x00, 0x07, 0xa0,
+    0x01, 0xc0, 0x47, 0x80, 0x00, 0x80, 0x00, 0x06, 0x32, 0xc5, 0x80, 0x80, 0xbf, 0x3e, 0x1f, 0x03, 0xc1, 0x3f, 0x21, 0x04, 0x09, 0x00, 0x07, 0xc0,
+    0x3e, 0x20, 0x03, 0x00, 0x01, 0x00, 0x01, 0x06, 0x17, 0xc7, 0x80, 0x80, 0x5d, 0x25, 0xc0, 0x41, 0x63, 0x28, 0xc0, 0x44, 0x09, 0x00, 0x07, 0x5e,
+    0x25, 0xc2, 0x41, 0x03, 0x03, 0xfd, 0x02, 0x06, 0x2a, 0xc6, 0x80, 0x80, 0x9f, 0x1d, 0x7f, 0x0f, 0x21, 0x1f, 0x01, 0x11, 0x09, 0x00, 0x07, 0xa0,
+    0x1d, 0x80, 0x0f, 0x80, 0x01, 0x80, 0x01, 0x06, 0x18, 0xc7, 0x80, 0x80, 0x3f, 0x0a, 0xdf, 0x38, 0x41, 0x0c, 0xe1, 0x3a, 0x09, 0x00, 0x07, 0x40,
+    0x0a, 0xe0, 0x38, 0x00, 0x02, 0x00, 0x02, 0x06, 0x2b, 0xc7, 0x7f, 0x7f, 0x7f, 0x06, 0x7f, 0x3d, 0x81, 0x08, 0x81, 0x3f, 0x09, 0x00, 0x07, 0x80,
+    0x06, 0x80, 0x3d, 0x00, 0x02, 0x00, 0x02, 0x06, 0x1f, 0xc7, 0x80, 0x80, 0xbf, 0x2b, 0xdf, 0x23, 0x81, 0x2f, 0xa1, 0x27, 0x09, 0x00, 0x07, 0xc0,
+    0x2b, 0xe0, 0x23, 0xc0, 0x03, 0xc0, 0x03, 0x06, 0x08, 0xc8, 0x80, 0x80, 0x5f, 0x3e, 0x9f, 0x15, 0xa1, 0x43, 0xe1, 0x1a, 0x09, 0x00, 0x07, 0x60,
+    0x3e, 0xa0, 0x15, 0x40, 0x05, 0x40, 0x05, 0x06, 0x28, 0xc7, 0x80, 0x80, 0x7f, 0x3c, 0x9f, 0x4e, 0x41, 0x3f, 0x61, 0x51, 0x09, 0x00, 0x07, 0x80,
+    0x3c, 0xa0, 0x4e, 0xc0, 0x02, 0xc0, 0x02, 0x06, 0x18, 0xc6, 0x80, 0x80, 0xbd, 0x56, 0x40, 0x44, 0x03, 0x59, 0x80, 0x46, 0x09, 0x00, 0x07, 0xbe,
+    0x56, 0x42, 0x44, 0x43, 0x02, 0x3d, 0x02, 0x06, 0x1a, 0xc7, 0x80, 0x80, 0xff, 0x22, 0xdf, 0x36, 0xc1, 0x25, 0xa1, 0x39, 0x09, 0x00, 0x07, 0x00,
+    0x23, 0xe0, 0x36, 0xc0, 0x02, 0xc0, 0x02, 0x06, 0x0e, 0xc7, 0x80, 0x80, 0xbd, 0x4d, 0xc0, 0x25, 0xc3, 0x50, 0xc0, 0x28, 0x09, 0x00, 0x07, 0xbe,
+    0x4d, 0xc2, 0x25, 0x03, 0x03, 0xfd, 0x02, 0x06, 0x0d, 0xc6, 0x80, 0x80, 0x9d, 0x1c, 0xa0, 0x22, 0xe3, 0x1e, 0xe0, 0x24, 0x09, 0x00, 0x07, 0x9e,
+    0x1c, 0xa2, 0x22, 0x43, 0x02, 0x3d, 0x02, 0x06, 0x06, 0xc5, 0x80, 0x80, 0x3f, 0x1c, 0x7f, 0x5e, 0x41, 0x1d, 0x81, 0x5f, 0x09, 0x00, 0x07, 0x40,
+    0x1c, 0x80, 0x5e, 0x00, 0x01, 0x00, 0x01, 0x06, 0x1d, 0xc6, 0x80, 0x7f, 0x7b, 0x26, 0x5f, 0x51, 0x41, 0x28, 0x1e, 0x53, 0x09, 0x00, 0x07, 0x7d,
+    0x26, 0x60, 0x51, 0xc3, 0x01, 0xbd, 0x01, 0x06, 0x1d, 0xc2, 0x80, 0x80, 0x3f, 0x0e, 0x9f, 0x50, 0xc1, 0x0e, 0x21, 0x51, 0x09, 0x00, 0x07, 0x40,
+    0x0e, 0xa0, 0x50, 0x80, 0x00, 0x80, 0x00, 0x06, 0x28, 0xc5, 0x80, 0x80, 0x3f, 0x4d, 0x9f, 0x2f, 0x41, 0x4e, 0xa1, 0x30, 0x09, 0x00, 0x07, 0x40,
+    0x4d, 0xa0, 0x2f, 0x00, 0x01, 0x00, 0x01, 0x06, 0x08, 0xc7, 0x80, 0x80, 0xff, 0x26, 0xff, 0x03, 0x41, 0x2a, 0x41, 0x07, 0x09, 0x00, 0x07, 0x00,
+    0x27, 0x00, 0x04, 0x40, 0x03, 0x40, 0x03, 0x06, 0x05, 0xc5, 0x7f, 0x7f, 0xdf, 0x41, 0x5f, 0x4a, 0xa1, 0x42, 0x21, 0x4b, 0x3a, 0x00, 0x01, 0xa0,
+    0x42, 0xc0, 0x4a, 0x03, 0xa0, 0x42, 0xf6, 0x4a, 0x76, 0x42, 0x20, 0x4b, 0x40, 0x42, 0x20, 0x4b, 0x03, 0x0a, 0x42, 0x20, 0x4b, 0xe0, 0x41, 0xf6,
+    0x4a, 0xe0, 0x41, 0xc0, 0x4a, 0x03, 0xe0, 0x41, 0x8a, 0x4a, 0x0a, 0x42, 0x60, 0x4a, 0x40, 0x42, 0x60, 0x4a, 0x03, 0x76, 0x42, 0x60, 0x4a, 0xa0,
+    0x42, 0x8a, 0x4a, 0xa0, 0x42, 0xc0, 0x4a, 0x04, 0x01, 0x03, 0xfe, 0x05, 0xde, 0x05, 0x04, 0xe0, 0x06, 0x06, 0x19, 0xc5, 0x80, 0x80, 0x5d, 0xff,
+    0x60, 0xff, 0xa3, 0x00, 0xa0, 0x00, 0x09, 0x00, 0x07, 0x5e, 0xff, 0x62, 0xff, 0x43, 0x01, 0x3d, 0x01, 0x02, 0x06, 0x1d, 0xc7, 0x80, 0x80, 0x5f,
+    0x44, 0x9f, 0x3b, 0x21, 0x48, 0x61, 0x3f, 0x09, 0x00, 0x07, 0x60, 0x44, 0xa0, 0x3b, 0xc0, 0x03, 0xc0, 0x03, 0x01, 0x03, 0x3e, 0x42, 0x1e, 0x5d,
+    0x04, 0xe0, 0x06, 0x06, 0x17, 0xc5, 0x80, 0x80, 0x5d, 0xff, 0x60, 0xff, 0xa3, 0x00, 0xa0, 0x00, 0x09, 0x00, 0x07, 0x5e, 0xff, 0x62, 0xff, 0x43,
+    0x01, 0x3d, 0x01, 0x02, 0x06, 0x29, 0xc7, 0x80, 0x80, 0x3d, 0x1f, 0x60, 0x3f, 0xc3, 0x22, 0xe0, 0x42, 0x09, 0x00, 0x07, 0x3e, 0x1f, 0x62, 0x3f,
+    0x83, 0x03, 0x7d, 0x03, 0x06, 0x2c, 0xc2, 0x80, 0x80, 0x5f, 0x55, 0x3f, 0x25, 0xe1, 0x55, 0xc1, 0x25, 0x09, 0x00, 0x07, 0x60, 0x55, 0x40, 0x25,
+    0x80, 0x00, 0x80, 0x00, 0x06, 0x1d, 0xc7, 0x80, 0x7f, 0x1f, 0x31, 0xdf, 0x09, 0xe1, 0x33, 0xa1, 0x0c, 0x09, 0x00, 0x07, 0x20, 0x31, 0xe0, 0x09,
+    0xc0, 0x02, 0xc0, 0x02, 0x06, 0x2b, 0xc6, 0x80, 0x80, 0xdd, 0x3a, 0x40, 0x44, 0x23, 0x3d, 0x80, 0x46, 0x09, 0x00, 0x07, 0xde, 0x3a, 0x42, 0x44,
+    0x43, 0x02, 0x3d, 0x02, 0x06, 0x09, 0xc7, 0x80, 0x80, 0x5f, 0x1a, 0x1f, 0x33, 0xa1, 0x1d, 0x61, 0x36, 0x09, 0x00, 0x07, 0x60, 0x1a, 0x20, 0x33,
+    0x40, 0x03, 0x40, 0x03, 0x06, 0x1b, 0xc7, 0x7f, 0x80, 0x9f, 0x20, 0x42, 0x2a, 0xa5, 0x25, 0x41, 0x2f, 0x09, 0x00, 0x07, 0xa0, 0x20, 0x43, 0x2a,
+    0x03, 0x05, 0xfd, 0x04, 0x06, 0x20, 0xc7, 0x80, 0x7f, 0x9f, 0x46, 0x5f, 0x38, 0x61, 0x4a, 0x21, 0x3c, 0x09, 0x00, 0x07, 0xa0, 0x46, 0x60, 0x38,
+    0xc0, 0x03, 0xc0, 0x03, 0x06, 0x1d, 0xc5, 0x7f, 0x7f, 0x1f, 0x50, 0x1f, 0x1d, 0xe1, 0x50, 0xe1, 0x1d, 0x3a, 0x00, 0x01, 0xe0, 0x50, 0x80, 0x1d,
+    0x03, 0xe0, 0x50, 0xb6, 0x1d, 0xb6, 0x50, 0xe0, 0x1d, 0x80, 0x50, 0xe0, 0x1d, 0x03, 0x4a, 0x50, 0xe0, 0x1d, 0x20, 0x50, 0xb6, 0x1d, 0x20, 0x50,
+    0x80, 0x1d, 0x03, 0x20, 0x50, 0x4a, 0x1d, 0x4a, 0x50, 0x20, 0x1d, 0x80, 0x50, 0x20, 0x1d, 0x03, 0xb6, 0x50, 0x20, 0x1d, 0xe0, 0x50, 0x4a, 0x1d,
+    0xe0, 0x50, 0x80, 0x1d, 0x04, 0x06, 0x0d, 0xc2, 0x80, 0x80, 0xff, 0x0b, 0x1f, 0x25, 0x81, 0x0c, 0xa1, 0x25, 0x09, 0x00, 0x07, 0x00, 0x0c, 0x20,
+    0x25, 0x80, 0x00, 0x80, 0x00, 0x06, 0x1d, 0xc6, 0x80, 0x80, 0x9d, 0x26, 0xe0, 0x44, 0xe3, 0x28, 0x20, 0x47, 0x09, 0x00, 0x07, 0x9e, 0x26, 0xe2,
+    0x44, 0x43, 0x02, 0x3d, 0x02, 0x06, 0x32, 0xc6, 0x80, 0x7f, 0x3b, 0x58, 0xbf, 0x5c, 0x01, 0x5a, 0x7e, 0x5e, 0x09, 0x00, 0x07, 0x3d, 0x58, 0xc0,
+    0x5c, 0xc3, 0x01, 0xbd, 0x01, 0x06, 0x0b, 0xc7, 0x80, 0x80, 0x7f, 0x22, 0x1f, 0x24, 0x81, 0x24, 0x21, 0x26, 0x09, 0x00, 0x07, 0x80, 0x22, 0x20,
+    0x24, 0x00, 0x02, 0x00, 0x02, 0x06, 0x22, 0xc6, 0x80, 0x80, 0x5f, 0x58, 0xdf, 0x40, 0xe1, 0x59, 0x61, 0x42, 0x09, 0x00, 0x07, 0x60, 0x58, 0xe0,
+    0x40, 0x80, 0x01, 0x80, 0x01, 0x06, 0x1b, 0xc7, 0x7f, 0x80, 0xbf, 0x42, 0x82, 0x0c, 0xc5, 0x46, 0x81, 0x10, 0x09, 0x00, 0x07, 0xc0, 0x42, 0x83,
+    0x0c, 0x03, 0x04, 0xfd, 0x03, 0x06, 0x05, 0xc6, 0x80, 0x80, 0x9d, 0x5e, 0xc0, 0x14, 0xe3, 0x60, 0x00, 0x17, 0x09, 0x00, 0x07, 0x9e, 0x5e, 0xc2,
+    0x14, 0x43, 0x02, 0x3d, 0x02, 0x06, 0x1d, 0xc6, 0x80, 0x7f, 0x5b, 0x5f, 0x7f, 0x0a, 0x21, 0x61, 0x3e, 0x0c, 0x09, 0x00, 0x07, 0x5d, 0x5f, 0x80,
+    0x0a, 0xc3, 0x01, 0xbd, 0x01, 0x06, 0x1d, 0xc5, 0x80, 0x80, 0x1f, 0x2d, 0xff, 0x07, 0x21, 0x2e, 0x01, 0x09, 0x09, 0x00, 0x07, 0x20, 0x2d, 0x00,
+    0x08, 0x00, 0x01, 0x00, 0x01, 0x06, 0x32, 0xc6, 0x80, 0x80, 0x3f, 0x03, 0x3f, 0x14, 0xc1, 0x04, 0xc1, 0x15, 0x09, 0x00, 0x07, 0x40, 0x03, 0x40,
+    0x14, 0x80, 0x01, 0x80, 0x01, 0x06, 0x28, 0xc7, 0x80, 0x80, 0xff, 0x5a, 0x7f, 0x08, 0xc1, 0x5d, 0x41, 0x0b, 0x09, 0x00, 0x07, 0x00, 0x5b, 0x80,
+    0x08, 0xc0, 0x02, 0xc0, 0x02, 0x06, 0x02, 0xc5, 0x80, 0x80, 0x7f, 0x0e, 0x7f, 0x09, 0x41, 0x0f, 0x41, 0x0a, 0x3a, 0x00, 0x01, 0x40, 0x0f, 0xe0,
+    0x09, 0x03, 0x40, 0x0f, 0x16, 0x0a, 0x16, 0x0f, 0x40, 0x0a, 0xe0, 0x0e, 0x40, 0x0a, 0x03, 0xaa, 0x0e, 0x40, 0x0a, 0x80, 0x0e, 0x16, 0x0a, 0x80,
+    0x0e, 0xe0, 0x09, 0x03, 0x80, 0x0e, 0xaa, 0x09, 0xaa, 0x0e, 0x80, 0x09, 0xe0, 0x0e, 0x80, 0x09, 0x03, 0x16, 0x0f, 0x80, 0x09, 0x40, 0x0f, 0xaa,
+    0x09, 0x40, 0x0f, 0xe0, 0x09, 0x04, 0x06, 0x14, 0xc7, 0x80, 0x80, 0x3d, 0x44, 0x40, 0x38, 0x43, 0x47, 0x40, 0x3b, 0x09, 0x00, 0x07, 0x3e, 0x44,
+    0x42, 0x38, 0x03, 0x03, 0xfd, 0x02, 0x06, 0x1d, 0xc5, 0x80, 0x80, 0x7f, 0x06, 0x5f, 0x2b, 0x81, 0x07, 0x61, 0x2c, 0x09, 0x00, 0x07, 0x80, 0x06,
+    0x60, 0x2b, 0x00, 0x01, 0x00, 0x01, 0x06, 0x2c, 0xc5, 0x80, 0x80, 0xbf, 0x37, 0xdf, 0x5f, 0xc1, 0x38, 0xe1, 0x60, 0x09, 0x00, 0x07, 0xc0, 0x37,
+    0xe0, 0x5f, 0x00, 0x01, 0x00, 0x01, 0x06, 0x08, 0xc7, 0x80, 0x80, 0x7d, 0x4b, 0x40, 0x3d, 0x03, 0x4f, 0xc0, 0x40, 0x09, 0x00, 0x07, 0x7e, 0x4b,
+    0x42, 0x3d, 0x83, 0x03, 0x7d, 0x03, 0x06, 0x27, 0xc2, 0x80, 0x7f, 0x7f, 0x58, 0xbf, 0x15, 0x01, 0x59, 0x41, 0x16, 0x09, 0x00, 0x07, 0x80, 0x58,
+    0xc0, 0x15, 0x80, 0x00, 0x80, 0x00, 0x06, 0x1c, 0xc7, 0x7f, 0x80, 0x7f, 0x1e, 0x82, 0x20, 0x85, 0x22, 0x81, 0x24, 0x09, 0x00, 0x07, 0x80, 0x1e,
+    0x83, 0x20, 0x03, 0x04, 0xfd, 0x03, 0x01, 0x03, 0x3e, 0x15, 0xde, 0x5f, 0x04, 0xe0, 0x06, 0x06, 0x29, 0xc5, 0x80, 0x80, 0x5d, 0xff, 0x60, 0xff,
+    0xa3, 0x00, 0xa0, 0x00, 0x09, 0x00, 0x07, 0x5e, 0xff, 0x62, 0xff, 0x43, 0x01, 0x3d, 0x01, 0x02, 0x06, 0x1c, 0xc7, 0x80, 0x80, 0x5f, 0x5b, 0x5f,
+    0x17, 0x61, 0x5d, 0x61, 0x19, 0x09, 0x00, 0x07, 0x60, 0x5b, 0x60, 0x17, 0x00, 0x02, 0x00, 0x02, 0x06, 0x11, 0xc7, 0x80, 0x80, 0x7f, 0x1f, 0x7f,
+    0x57, 0x81, 0x21, 0x81, 0x59, 0x09, 0x00, 0x07, 0x80, 0x1f, 0x80, 0x57, 0x00, 0x02, 0x00, 0x02, 0x01, 0x03, 0xde, 0x37, 0x9e, 0x20, 0x04, 0xe0,
+    0x06, 0x06, 0x1d, 0xc5, 0x80, 0x80, 0x5d, 0xff, 0x60, 0xff, 0xa3, 0x00, 0xa0, 0x00, 0x09, 0x00, 0x07, 0x5e, 0xff, 0x62, 0xff, 0x43, 0x01, 0x3d,
+    0x01, 0x02, 0x01, 0x03, 0x1e, 0x1d, 0xbe, 0x4e, 0x04, 0xe0, 0x06, 0x06, 0x17, 0xc5, 0x80, 0x80, 0x5d, 0xff, 0x60, 0xff, 0xa3, 0x00, 0xa0, 0x00,
+    0x09, 0x00, 0x07, 0x5e, 0xff, 0x62, 0xff, 0x43, 0x01, 0x3d, 0x01, 0x02, 0x06, 0x08, 0xc6, 0x80, 0x80, 0x7d, 0x3a, 0x00, 0x0f, 0xc3, 0x3c, 0x40,
+    0x11, 0x09, 0x00, 0x07, 0x7e, 0x3a, 0x02, 0x0f, 0x43, 0x02, 0x3d, 0x02, 0x06, 0x1b, 0xc7, 0x80, 0x80, 0x9f, 0x22, 0xdf, 0x44, 0x61, 0x25, 0xa1,
+    0x47, 0x09, 0x00, 0x07, 0xa0, 0x22, 0xe0, 0x44, 0xc0, 0x02, 0xc0, 0x02, 0x06, 0x1b, 0xc6, 0x80, 0x7f, 0x7b, 0x29, 0x7f, 0x32, 0x41, 0x2b, 0x3e,
+    0x34, 0x09, 0x00, 0x07, 0x7d, 0x29, 0x80, 0x32, 0xc3, 0x01, 0xbd, 0x01, 0x06, 0x1d, 0xc7, 0x80, 0x80, 0x3f, 0x1c, 0x9f, 0x18, 0x41, 0x1e, 0xa1,
+    0x1a, 0x09, 0x00, 0x07, 0x40, 0x1c, 0xa0, 0x18, 0x00, 0x02, 0x00, 0x02, 0x06, 0x0b, 0xc5, 0x7f, 0x7f, 0x3f, 0x00, 0x1f, 0x05, 0x01, 0x01, 0xe1,
+    0x05, 0x3a, 0x00, 0x01, 0x00, 0x01, 0x80, 0x05, 0x03, 0x00, 0x01, 0xb6, 0x05, 0xd6, 0x00, 0xe0, 0x05, 0xa0, 0x00, 0xe0, 0x05, 0x03, 0x6a, 0x00,
+    0xe0, 0x05, 0x40, 0x00, 0xb6, 0x05, 0x40, 0x00, 0x80, 0x05, 0x03, 0x40, 0x00, 0x4a, 0x05, 0x6a, 0x00, 0x20, 0x05, 0xa0, 0x00, 0x20, 0x05, 0x03,
+    0xd6, 0x00, 0x20, 0x05, 0x00, 0x01, 0x4a, 0x05, 0x00, 0x01, 0x80, 0x05, 0x04, 0x06, 0x0c, 0xc6, 0x80, 0x80, 0x5d, 0x05, 0xc0, 0x32, 0xa3, 0x07,
+    0x00, 0x35, 0x09, 0x00, 0x07, 0x5e, 0x05, 0xc2, 0x32, 0x43, 0x02, 0x3d, 0x02, 0x06, 0x1d, 0xc7, 0x80, 0x80, 0x9d, 0x2c, 0xe0, 0x11, 0x23, 0x30,
+    0x60, 0x15, 0x09, 0x00, 0x07, 0x9e, 0x2c, 0xe2, 0x11, 0x83, 0x03, 0x7d, 0x03, 0x06, 0x19, 0xc6, 0x80, 0x80, 0x1d, 0x31, 0x80, 0x12, 0x63, 0x33,
+    0xc0, 0x14, 0x09, 0x00, 0x07, 0x1e, 0x31, 0x82, 0x12, 0x43, 0x02, 0x3d, 0x02, 0x06, 0x28, 0xc7, 0x80, 0x80, 0xdf, 0x27, 0xbf, 0x14, 0xa1, 0x2a,
+    0x81, 0x17, 0x09, 0x00, 0x07, 0xe0, 0x27, 0xc0, 0x14, 0xc0, 0x02, 0xc0, 0x02, 0x06, 0x32, 0xc2, 0x80, 0x80, 0x5f, 0x01, 0x9f, 0x5c, 0xe1, 0x01,
+    0x21, 0x5d, 0x09, 0x00, 0x07, 0x60, 0x01, 0xa0, 0x5c, 0x80, 0x00, 0x80, 0x00, 0x06, 0x16, 0xc6, 0x80, 0x80, 0x9f, 0x0a, 0x7f, 0x3e, 0x21, 0x0c,
+    0x01, 0x40, 0x09, 0x00, 0x07, 0xa0, 0x0a, 0x80, 0x3e, 0x80, 0x01, 0x80, 0x01, 0x06, 0x16, 0xc6, 0x80, 0x80, 0x3f, 0x5f, 0x5f, 0x35, 0xc1, 0x60,
+    0xe1, 0x36, 0x09, 0x00, 0x07, 0x40, 0x5f, 0x60, 0x35, 0x80, 0x01, 0x80, 0x01, 0x06, 0x1c, 0xc8, 0x80, 0x80, 0xdf, 0x2d, 0x9f, 0x16, 0xa1, 0x32,
+    0x61, 0x1b, 0x09, 0x00, 0x07, 0xe0, 0x2d, 0xa0, 0x16, 0xc0, 0x04, 0xc0, 0x04, 0x01, 0x03, 0xfe, 0x03, 0x9e, 0x4b, 0x04, 0xe0, 0x06, 0x06, 0x2d,
+    0xc5, 0x80, 0x80, 0x5d, 0xff, 0x60, 0xff, 0xa3, 0x00, 0xa0, 0x00, 0x09, 0x00, 0x07, 0x5e, 0xff, 0x62, 0xff, 0x43, 0x01, 0x3d, 0x01, 0x02, 0x06,
+    0x18, 0xc5, 0x80, 0x80, 0xdf, 0x45, 0x5f, 0x09, 0xe1, 0x46, 0x61, 0x0a, 0x09, 0x00, 0x07, 0xe0, 0x45, 0x60, 0x09, 0x00, 0x01, 0x00, 0x01, 0x06,
+    0x1e, 0xc8, 0x80, 0x80, 0x7f, 0x4a, 0xff, 0x1d, 0xc1, 0x4f, 0x41, 0x23, 0x09, 0x00, 0x07, 0x80, 0x4a, 0x00, 0x1e, 0x40, 0x05, 0x40, 0x05, 0x06,
+    0x19, 0xc7, 0x80, 0x80, 0xbf, 0x59, 0x9f, 0x30, 0x01, 0x5d, 0xe1, 0x33, 0x09, 0x00, 0x07, 0xc0, 0x59, 0xa0, 0x30, 0x40, 0x03, 0x40, 0x03, 0x06,
+    0x1d, 0xc7, 0x80, 0x80, 0xff, 0x5a, 0xff, 0x4b, 0x01, 0x5d, 0x01, 0x4e, 0x09, 0x00, 0x07, 0x00, 0x5b, 0x00, 0x4c, 0x00, 0x02, 0x00, 0x02, 0x06,
+    0x1d, 0xc5, 0x80, 0x80, 0xbf, 0x42, 0x3f, 0x11, 0xc1, 0x43, 0x41, 0x12, 0x09, 0x00, 0x07, 0xc0, 0x42, 0x40, 0x11, 0x00, 0x01, 0x00, 0x01, 0x06,
+    0x1c, 0xc6, 0x80, 0x80, 0xfd, 0x30, 0xe0, 0x47, 0x43, 0x33, 0x20, 0x4a, 0x09, 0x00, 0x07, 0xfe, 0x30, 0xe2, 0x47, 0x43, 0x02, 0x3d, 0x02, 0x06,
+    0x08, 0xc6, 0x80, 0x7f, 0xdb, 0x3f, 0x1f, 0x5f, 0xa1, 0x41, 0xde, 0x60, 0x09, 0x00, 0x07, 0xdd, 0x3f, 0x20, 0x5f, 0xc3, 0x01, 0xbd, 0x01, 0x06,
+    0x10, 0xc6, 0x80, 0x7f, 0x9b, 0x3c, 0x1f, 0x19, 0x61, 0x3e, 0xde, 0x1a, 0x09, 0x00, 0x07, 0x9d, 0x3c, 0x20, 0x19, 0xc3, 0x01, 0xbd, 0x01, 0x06,
+    0x25, 0xc2, 0x80, 0x80, 0x5f, 0x4a, 0x9f, 0x5d, 0xe1, 0x4a, 0x21, 0x5e, 0x09, 0x00, 0x07, 0x60, 0x4a, 0xa0, 0x5d, 0x80, 0x00, 0x80, 0x00, 0x06,
+    0x0b, 0xc2, 0x80, 0x80, 0xbf, 0x01, 0xdf, 0x52, 0x41, 0x02, 0x61, 0x53, 0x09, 0x00, 0x07, 0xc0, 0x01, 0xe0, 0x52, 0x80, 0x00, 0x80, 0x00, 0x06,
+    0x0d, 0xc7, 0x80, 0x80, 0x1f, 0x39, 0xbf, 0x22, 0x61, 0x3c, 0x01, 0x26, 0x09, 0x00, 0x07, 0x20, 0x39, 0xc0, 0x22, 0x40, 0x03, 0x40, 0x03, 0x06,
+    0x1d, 0xc6, 0x80, 0x7f, 0xbb, 0x09, 0xff, 0x06, 0x81, 0x0b, 0xbe, 0x08, 0x09, 0x00, 0x07, 0xbd, 0x09, 0x00, 0x07, 0xc3, 0x01, 0xbd, 0x01, 0x06,
+    0x1f, 0xc7, 0x7f, 0x80, 0xbf, 0x31, 0x42, 0x2b, 0xc5, 0x36, 0x41, 0x30, 0x09, 0x00, 0x07, 0xc0, 0x31, 0x43, 0x2b, 0x03, 0x05, 0xfd, 0x04, 0x06,
+    0x22, 0xc7, 0x7f, 0x80, 0x7f, 0x47, 0xa2, 0x0b, 0x85, 0x4b, 0xa1, 0x0f, 0x09, 0x00, 0x07, 0x80, 0x47, 0xa3, 0x0b, 0x03, 0x04, 0xfd, 0x03, 0x06,
+    0x15, 0xc6, 0x80, 0x7f, 0x7b, 0x45, 0x5f, 0x5b, 0x41, 0x47, 0x1e, 0x5d, 0x09, 0x00, 0x07, 0x7d, 0x45, 0x60, 0x5b, 0xc3, 0x01, 0xbd, 0x01, 0x06,
+    0x28, 0xc5, 0x80, 0x80, 0xdf, 0x26, 0xff, 0x36, 0xe1, 0x27, 0x01, 0x38, 0x09, 0x00, 0x07, 0xe0, 0x26, 0x00, 0x37, 0x00, 0x01, 0x00, 0x01, 0x06,
+    0x0d, 0xc7, 0x80, 0x80, 0x7f, 0x43, 0xbf, 0x14, 0x41, 0x47, 0x81, 0x18, 0x09, 0x00, 0x07, 0x80, 0x43, 0xc0, 0x14, 0xc0, 0x03, 0xc0, 0x03, 0x06,
+    0x1b, 0xc2, 0x80, 0x80, 0xdf, 0x01, 0xff, 0x5f, 0x61, 0x02, 0x81, 0x60, 0x09, 0x00, 0x07, 0xe0, 0x01, 0x00, 0x60, 0x80, 0x00, 0x80, 0x00, 0x06,
+    0x32, 0xc7, 0x80, 0x80, 0x3f, 0x4f, 0xff, 0x5a, 0x41, 0x51, 0x01, 0x5d, 0x09, 0x00, 0x07, 0x40, 0x4f, 0x00, 0x5b, 0x00, 0x02, 0x00, 0x02, 0x06,
+    0x1d, 0xc6, 0x80, 0x80, 0x7f, 0x0e, 0x1f, 0x48, 0x01, 0x10, 0xa1, 0x49, 0x09, 0x00, 0x07, 0x80, 0x0e, 0x20, 0x48, 0x80, 0x01, 0x80, 0x01, 0x06,
+    0x18, 0xc5, 0x7f, 0x7f, 0xbf, 0x59, 0x5f, 0x0c, 0x81, 0x5a, 0x21, 0x0d, 0x3a, 0x00, 0x01, 0x80, 0x5a, 0xc0, 0x0c, 0x03, 0x80, 0x5a, 0xf6, 0x0c,
+    0x56, 0x5a, 0x20, 0x0d, 0x20, 0x5a, 0x20, 0x0d, 0x03, 0xea, 0x59, 0x20, 0x0d, 0xc0, 0x59, 0xf6, 0x0c, 0xc0, 0x59, 0xc0, 0x0c, 0x03, 0xc0, 0x59,
+    0x8a, 0x0c, 0xea, 0x59, 0x60, 0x0c, 0x20, 0x5a, 0x60, 0x0c, 0x03, 0x56, 0x5a, 0x60, 0x0c, 0x80, 0x5a, 0x8a, 0x0c, 0x80, 0x5a, 0xc0, 0x0c, 0x04,
+    0x06, 0x30, 0xc6, 0x80, 0x7f, 0x9b, 0x21, 0xdf, 0x0b, 0x61, 0x23, 0x9e, 0x0d, 0x09, 0x00, 0x07, 0x9d, 0x21, 0xe0, 0x0b, 0xc3, 0x01, 0xbd, 0x01,
+    0x06, 0x26, 0xc8, 0x80, 0x80, 0x3f, 0x3e, 0x1f, 0x2b, 0xc1, 0x43, 0xa1, 0x30, 0x09, 0x00, 0x07, 0x40, 0x3e, 0x20, 0x2b, 0x80, 0x05, 0x80, 0x05,
+    0x06, 0x16, 0xc7, 0x7f, 0x80, 0x3f, 0x1a, 0x1f, 0x52, 0x41, 0x1c, 0x21, 0x54, 0x09, 0x00, 0x07, 0x40, 0x1a, 0x20, 0x52, 0x00, 0x02, 0x00, 0x02,
+    0x06, 0x33, 0xc7, 0x80, 0x80, 0x5f, 0x15, 0x9f, 0x14, 0xe1, 0x17, 0x21, 0x17, 0x09, 0x00, 0x07, 0x60, 0x15, 0xa0, 0x14, 0x80, 0x02, 0x80, 0x02,
+    0x06, 0x0a, 0xc7, 0x80, 0x80, 0x9d, 0x2c, 0x60, 0x42, 0x23, 0x30, 0xe0, 0x45, 0x09, 0x00, 0x07, 0x9e, 0x2c, 0x62, 0x42, 0x83, 0x03, 0x7d, 0x03,
+    0x01, 0x03, 0x9e, 0x10, 0x3e, 0x06, 0x04, 0xe0, 0x06, 0x06, 0x17, 0xc5, 0x80, 0x80, 0x5d, 0xff, 0x60, 0xff, 0xa3, 0x00, 0xa0, 0x00, 0x09, 0x00,
+    0x07, 0x5e, 0xff, 0x62, 0xff, 0x43, 0x01, 0x3d, 0x01, 0x02, 0x06, 0x28, 0xc6, 0x80, 0x80, 0x3f, 0x24, 0xbf, 0x3e, 0xc1, 0x25, 0x41, 0x40, 0x09,
+    0x00, 0x07, 0x40, 0x24, 0xc0, 0x3e, 0x80, 0x01, 0x80, 0x01, 0x06, 0x1d, 0xc6, 0x80, 0x7f, 0x5b, 0x27, 0x3f, 0x5f, 0x21, 0x29, 0xfe, 0x60, 0x09,
+    0x00, 0x07, 0x5d, 0x27, 0x40, 0x5f, 0xc3, 0x01, 0xbd, 0x01, 0x01, 0x03, 0x9e, 0x0a, 0x9e, 0x49, 0x04, 0xe0, 0x06, 0x06, 0x2e, 0xc5, 0x80, 0x80,
+    0x5d, 0xff, 0x60, 0xff, 0xa3, 0x00, 0xa0, 0x00, 0x09, 0x00, 0x07, 0x5e, 0xff, 0x62, 0xff, 0x43, 0x01, 0x3d, 0x01, 0x02, 0x06, 0x05, 0xc7, 0x80,
+    0x80, 0xbf, 0x30, 0x7f, 0x5f, 0xc1, 0x32, 0x81, 0x61, 0x09, 0x00, 0x07, 0xc0, 0x30, 0x80, 0x5f, 0x00, 0x02, 0x00, 0x02, 0x06, 0x19, 0xc7, 0x80,
+    0x80, 0x3f, 0x46, 0x1f, 0x42, 0x01, 0x4a, 0xe1, 0x45, 0x09, 0x00, 0x07, 0x40, 0x46, 0x20, 0x42, 0xc0, 0x03, 0xc0, 0x03, 0x06, 0x08, 0xc5, 0x80,
+    0x80, 0x5f, 0x40, 0x3f, 0x39, 0x61, 0x41, 0x41, 0x3a, 0x09, 0x00, 0x07, 0x60, 0x40, 0x40, 0x39, 0x00, 0x01, 0x00, 0x01, 0x06, 0x18, 0xc7, 0x80,
+    0x80, 0x9d, 0x5e, 0xa0, 0x1f, 0xa3, 0x61, 0xa0, 0x22, 0x09, 0x00, 0x07, 0x9e, 0x5e, 0xa2, 0x1f, 0x03, 0x03, 0xfd, 0x02, 0x06, 0x1d, 0xc6, 0x7f,
+    0x80, 0x9d, 0x57, 0x00, 0x49, 0xe3, 0x59, 0x40, 0x4b, 0x09, 0x00, 0x07, 0x9e, 0x57, 0x02, 0x49, 0x43, 0x02, 0x3d, 0x02, 0x01, 0x03, 0xfe, 0x4e,
+    0x7e, 0x49, 0x04, 0xe0, 0x06, 0x06, 0x08, 0xc5, 0x80, 0x80, 0x5d, 0xff, 0x60, 0xff, 0xa3, 0x00, 0xa0, 0x00, 0x09, 0x00, 0x07, 0x5e, 0xff, 0x62,
+    0xff, 0x43, 0x01, 0x3d, 0x01, 0x02, 0x06, 0x18, 0xc6, 0x80, 0x80, 0x7f, 0x02, 0x1f, 0x2d, 0x01, 0x04, 0xa1, 0x2e, 0x09, 0x00, 0x07, 0x80, 0x02,
+    0x20, 0x2d, 0x80, 0x01, 0x80, 0x01, 0x06, 0x28, 0xc7, 0x80, 0x80, 0x9f, 0x2f, 0xff, 0x28, 0xa1, 0x31, 0x01, 0x2b, 0x09, 0x00, 0x07, 0xa0, 0x2f,
+    0x00, 0x29, 0x00, 0x02, 0x00, 0x02, 0x06, 0x33, 0xc7, 0x80, 0x80, 0xff, 0x2c, 0xdf, 0x0c, 0x01, 0x2f, 0xe1, 0x0e, 0x09, 0x00, 0x07, 0x00, 0x2d,
+    0xe0, 0x0c, 0x00, 0x02, 0x00, 0x02, 0x06, 0x10, 0xc6, 0x80, 0x7f, 0xbb, 0x36, 0x3f, 0x34, 0x81, 0x38, 0xfe, 0x35, 0x09, 0x00, 0x07, 0xbd, 0x36,
+    0x40, 0x34, 0xc3, 0x01, 0xbd, 0x01, 0x01, 0x03, 0x7e, 0x4c, 0xde, 0x02, 0x04, 0xe0, 0x06, 0x06, 0x1b, 0xc5, 0x80, 0x80, 0x5d, 0xff, 0x60, 0xff,
+    0xa3, 0x00, 0xa0, 0x00, 0x09, 0x00, 0x07, 0x5e, 0xff, 0x62, 0xff, 0x43, 0x01, 0x3d, 0x01, 0x02, 0x06, 0x0d, 0xc7, 0x80, 0x80, 0x7f, 0x33, 0x1f,
+    0x30, 0x41, 0x37, 0xe1, 0x33, 0x09, 0x00, 0x07, 0x80, 0x33, 0x20, 0x30, 0xc0, 0x03, 0xc0, 0x03, 0x06, 0x0c, 0xc6, 0x80, 0x7f, 0x9b, 0x20, 0x5f,
+    0x5f, 0x61, 0x22, 0x1e, 0x61, 0x09, 0x00, 0x07, 0x9d, 0x20, 0x60, 0x5f, 0xc3, 0x01, 0xbd, 0x01, 0x06, 0x04, 0xc6, 0x80, 0x80, 0x1f, 0x0e, 0x1f,
+    0x45, 0xa1, 0x0f, 0xa1, 0x46, 0x09, 0x00, 0x07, 0x20, 0x0e, 0x20, 0x45, 0x80, 0x01, 0x80, 0x01, 0x06, 0x1d, 0xc5, 0x80, 0x80, 0xdf, 0x01, 0x5f,
+    0x0b, 0xe1, 0x02, 0x61, 0x0c, 0x09, 0x00, 0x07, 0xe0, 0x01, 0x60, 0x0b, 0x00, 0x01, 0x00, 0x01, 0x06, 0x2d, 0xc8, 0x80, 0x80, 0x7f, 0x4f, 0xdf,
+    0x11, 0xc1, 0x53, 0x21, 0x16, 0x09, 0x00, 0x07, 0x80, 0x4f, 0xe0, 0x11, 0x40, 0x04, 0x40, 0x04, 0x06, 0x20, 0xc7, 0x80, 0x80, 0xff, 0x2c, 0x5f,
+    0x4f, 0x01, 0x2f, 0x61, 0x51, 0x09, 0x00, 0x07, 0x00, 0x2d, 0x60, 0x4f, 0x00, 0x02, 0x00, 0x02, 0x06, 0x1d, 0xc8, 0x80, 0x80, 0xdf, 0x1f, 0x3f,
+    0x34, 0x21, 0x24, 0x81, 0x38, 0x09, 0x00, 0x07, 0xe0, 0x1f, 0x40, 0x34, 0x40, 0x04, 0x40, 0x04, 0x06, 0x28, 0xc7, 0x7f, 0x80, 0x7f, 0x14, 0xff,
+    0x06, 0x41, 0x17, 0xc1, 0x09, 0x09, 0x00, 0x07, 0x80, 0x14, 0x00, 0x07, 0xc0, 0x02, 0xc0, 0x02, 0x06, 0x24, 0xc5, 0x80, 0x80, 0xdf, 0x0a, 0xdf,
+    0x42, 0xe1, 0x0b, 0xe1, 0x43, 0x09, 0x00, 0x07, 0xe0, 0x0a, 0xe0, 0x42, 0x00, 0x01, 0x00, 0x01, 0x06, 0x0d, 0xc6, 0x80, 0x7f, 0x5b, 0x42, 0x5f,
+    0x54, 0x21, 0x44, 0x1e, 0x56, 0x09, 0x00, 0x07, 0x5d, 0x42, 0x60, 0x54, 0xc3, 0x01, 0xbd, 0x01, 0x06, 0x0d, 0xc5, 0x80, 0x80, 0x5f, 0x4f, 0xff,
+    0x31, 0x61, 0x50, 0x01, 0x33, 0x09, 0x00, 0x07, 0x60, 0x4f, 0x00, 0x32, 0x00, 0x01, 0x00, 0x01, 0x06, 0x08, 0xc6, 0x80, 0x80, 0x1f, 0x05, 0x5f,
+    0x10, 0xa1, 0x06, 0xe1, 0x11, 0x09, 0x00, 0x07, 0x20, 0x05, 0x60, 0x10, 0x80, 0x01, 0x80, 0x01, 0x06, 0x09, 0xc7, 0x80, 0x80, 0xff, 0x36, 0xdf,
+    0x1a, 0xc1, 0x39, 0xa1, 0x1d, 0x09, 0x00, 0x07, 0x00, 0x37, 0xe0, 0x1a, 0xc0, 0x02, 0xc0, 0x02, 0x06, 0x1a, 0xc6, 0x80, 0x80, 0x3d, 0x3e, 0x20,
+    0x5b, 0x83, 0x40, 0x60, 0x5d, 0x09, 0x00, 0x07, 0x3e, 0x3e, 0x22, 0x5b, 0x43, 0x02, 0x3d, 0x02, 0x06, 0x04, 0xc2, 0x80, 0x7f, 0x7f, 0x4b, 0xff,
+    0x30, 0x01, 0x4c, 0x81, 0x31, 0x09, 0x00, 0x07, 0x80, 0x4b, 0x00, 0x31, 0x80, 0x00, 0x80, 0x00, 0x06, 0x30, 0xc5, 0x80, 0x80, 0x9f, 0x29, 0xff,
+    0x54, 0xa1, 0x2a, 0x01, 0x56, 0x09, 0x00, 0x07, 0xa0, 0x29, 0x00, 0x55, 0x00, 0x01, 0x00, 0x01, 0x06, 0x19, 0xc5, 0x80, 0x80, 0xff, 0x52, 0x1f,
+    0x34, 0x01, 0x54, 0x21, 0x35, 0x09, 0x00, 0x07, 0x00, 0x53, 0x20, 0x34, 0x00, 0x01, 0x00, 0x01, 0x06, 0x07, 0xc6, 0x80, 0x80, 0x3d, 0x43, 0x80,
+    0x40, 0x83, 0x45, 0xc0, 0x42, 0x09, 0x00, 0x07, 0x3e, 0x43, 0x82, 0x40, 0x43, 0x02, 0x3d, 0x02, 0x06, 0x29, 0xc7, 0x80, 0x80, 0x1f, 0x4c, 0x5f,
+    0x0a, 0x21, 0x4e, 0x61, 0x0c, 0x09, 0x00, 0x07, 0x20, 0x4c, 0x60, 0x0a, 0x00, 0x02, 0x00, 0x02, 0x06, 0x25, 0xc6, 0x80, 0x7f, 0x7b, 0x1c, 0xdf,
+    0x1d, 0x41, 0x1e, 0x9e, 0x1f, 0x09, 0x00, 0x07, 0x7d, 0x1c, 0xe0, 0x1d, 0xc3, 0x01, 0xbd, 0x01, 0x06, 0x32, 0xc5, 0x80, 0x80, 0x7f, 0x5c, 0x3f,
+    0x52, 0x41, 0x5d, 0x01, 0x53, 0x3a, 0x00, 0x01, 0x40, 0x5d, 0xa0, 0x52, 0x03, 0x40, 0x5d, 0xd6, 0x52, 0x16, 0x5d, 0x00, 0x53, 0xe0, 0x5c, 0x00,
+    0x53, 0x03, 0xaa, 0x5c, 0x00, 0x53, 0x80, 0x5c, 0xd6, 0x52, 0x80, 0x5c, 0xa0, 0x52, 0x03, 0x80, 0x5c, 0x6a, 0x52, 0xaa, 0x5c, 0x40, 0x52, 0xe0,
+    0x5c, 0x40, 0x52, 0x03, 0x16, 0x5d, 0x40, 0x52, 0x40, 0x5d, 0x6a, 0x52, 0x40, 0x5d, 0xa0, 0x52, 0x04, 0x06, 0x1d, 0xc7, 0x80, 0x80, 0xff, 0x23,
+    0x7f, 0x10, 0xc1, 0x26, 0x41, 0x13, 0x09, 0x00, 0x07, 0x00, 0x24, 0x80, 0x10, 0xc0, 0x02, 0xc0, 0x02, 0x06, 0x16, 0xc5, 0x80, 0x80, 0x5f, 0x59,
+    0xff, 0x1f, 0x61, 0x5a, 0x01, 0x21, 0x09, 0x00, 0x07, 0x60, 0x59, 0x00, 0x20, 0x00, 0x01, 0x00, 0x01, 0x06, 0x1f, 0xc7, 0x80, 0x80, 0xfd, 0x1b,
+    0x00, 0x3d, 0x83, 0x1f, 0x80, 0x40, 0x09, 0x00, 0x07, 0xfe, 0x1b, 0x02, 0x3d, 0x83, 0x03, 0x7d, 0x03, 0x01, 0x03, 0x5e, 0x18, 0xfe, 0x40, 0x04,
+    0xe0, 0x06, 0x06, 0x1d, 0xc5, 0x80, 0x80, 0x5d, 0xff, 0x60, 0xff, 0xa3, 0x00, 0xa0, 0x00, 0x09, 0x00, 0x07, 0x5e, 0xff, 0x62, 0xff, 0x43, 0x01,
+    0x3d, 0x01, 0x02, 0x06, 0x16, 0xc2, 0x80, 0x80, 0x5f, 0x06, 0x9f, 0x50, 0xe1, 0x06, 0x21, 0x51, 0x09, 0x00, 0x07, 0x60, 0x06, 0xa0, 0x50, 0x80,
+    0x00, 0x80, 0x00, 0x06, 0x19, 0xc2, 0x80, 0x80, 0x5f, 0x16, 0x3f, 0x51, 0xe1, 0x16, 0xc1, 0x51, 0x09, 0x00, 0x07, 0x60, 0x16, 0x40, 0x51, 0x80,
+    0x00, 0x80, 0x00, 0x06, 0x33, 0xc8, 0x7f, 0x80, 0x7f, 0x2e, 0x3f, 0x24, 0x41, 0x34, 0x01, 0x2a, 0x09, 0x00, 0x07, 0x80, 0x2e, 0x40, 0x24, 0xc0,
+    0x05, 0xc0, 0x05, 0x06, 0x08, 0xc7, 0x80, 0x80, 0x1d, 0x23, 0xe0, 0x4b, 0x23, 0x26, 0xe0, 0x4e, 0x09, 0x00, 0x07, 0x1e, 0x23, 0xe2, 0x4b, 0x03,
+    0x03, 0xfd, 0x02, 0x06, 0x05, 0xc6, 0x80, 0x7f, 0x9b, 0x1d, 0xbf, 0x2e, 0x61, 0x1f, 0x7e, 0x30, 0x09, 0x00, 0x07, 0x9d, 0x1d, 0xc0, 0x2e, 0xc3,
+    0x01, 0xbd, 0x01, 0x06, 0x0d, 0xc7, 0x80, 0x80, 0x7d, 0x27, 0xc0, 0x09, 0x03, 0x2b, 0x40, 0x0d, 0x09, 0x00, 0x07, 0x7e, 0x27, 0xc2, 0x09, 0x83,
+    0x03, 0x7d, 0x03, 0x06, 0x19, 0xc6, 0x80, 0x80, 0xbd, 0x19, 0x60, 0x15, 0x03, 0x1c, 0xa0, 0x17, 0x09, 0x00, 0x07, 0xbe, 0x19, 0x62, 0x15, 0x43,
+    0x02, 0x3d, 0x02, 0x06, 0x16, 0xc7, 0x80, 0x80, 0x9f, 0x54, 0x9f, 0x2a, 0xe1, 0x57, 0xe1, 0x2d, 0x09, 0x00, 0x07, 0xa0, 0x54, 0xa0, 0x2a, 0x40,
+    0x03, 0x40, 0x03, 0x06, 0x28, 0xc2, 0x80, 0x80, 0xdf, 0x00, 0x7f, 0x56, 0x61, 0x01, 0x01, 0x57, 0x09, 0x00, 0x07, 0xe0, 0x00, 0x80, 0x56, 0x80,
+    0x00, 0x80, 0x00, 0x06, 0x17, 0xc6, 0x80, 0x80, 0xff, 0x09, 0x1f, 0x0d, 0x81, 0x0b, 0xa1, 0x0e, 0x09, 0x00, 0x07, 0x00, 0x0a, 0x20, 0x0d, 0x80,
+    0x01, 0x80, 0x01, 0x06, 0x1f, 0xc5, 0x80, 0x80, 0x3f, 0x2f, 0x3f, 0x2e, 0x41, 0x30, 0x41, 0x2f, 0x09, 0x00, 0x07, 0x40, 0x2f, 0x40, 0x2e, 0x00,
+    0x01, 0x00, 0x01, 0x06, 0x1d, 0xc7, 0x80, 0x7f, 0xff, 0x5c, 0x9f, 0x0c, 0x01, 0x5f, 0xa1, 0x0e, 0x09, 0x00, 0x07, 0x00, 0x5d, 0xa0, 0x0c, 0x00,
+    0x02, 0x00, 0x02, 0x06, 0x02, 0xc5, 0x80, 0x80, 0x7f, 0x11, 0x1f, 0x51, 0x81, 0x12, 0x21, 0x52, 0x09, 0x00, 0x07, 0x80, 0x11, 0x20, 0x51, 0x00,
+    0x01, 0x00, 0x01, 0x01, 0x03, 0xfe, 0x02, 0xde, 0x08, 0x04, 0xe0, 0x06, 0x06, 0x1e, 0xc5, 0x80, 0x80, 0x5d, 0xff, 0x60, 0xff, 0xa3, 0x00, 0xa0,
+    0x00, 0x09, 0x00, 0x07, 0x5e, 0xff, 0x62, 0xff, 0x43, 0x01, 0x3d, 0x01, 0x02, 0x06, 0x17, 0xc7, 0x80, 0x80, 0xdf, 0x13, 0xdf, 0x44, 0x61, 0x16,
+    0x61, 0x47, 0x09, 0x00, 0x07, 0xe0, 0x13, 0xe0, 0x44, 0x80, 0x02, 0x80, 0x02, 0x06, 0x1b, 0xc5, 0x80, 0x80, 0x7f, 0x01, 0xdf, 0x4f, 0x41, 0x02,
+    0xa1, 0x50, 0x3a, 0x00, 0x01, 0x40, 0x02, 0x40, 0x50, 0x03, 0x40, 0x02, 0x76, 0x50, 0x16, 0x02, 0xa0, 0x50, 0xe0, 0x01, 0xa0, 0x50, 0x03, 0xaa,
+    0x01, 0xa0, 0x50, 0x80, 0x01, 0x76, 0x50, 0x80, 0x01, 0x40, 0x50, 0x03, 0x80, 0x01, 0x0a, 0x50, 0xaa, 0x01, 0xe0, 0x4f, 0xe0, 0x01, 0xe0, 0x4f,
+    0x03, 0x16, 0x02, 0xe0, 0x4f, 0x40, 0x02, 0x0a, 0x50, 0x40, 0x02, 0x40, 0x50, 0x04, 0x06, 0x08, 0xc6, 0x80, 0x80, 0xff, 0x11, 0xff, 0x46, 0x81,
+    0x13, 0x81, 0x48, 0x09, 0x00, 0x07, 0x00, 0x12, 0x00, 0x47, 0x80, 0x01, 0x80, 0x01, 0x06, 0x1d, 0xc7, 0x80, 0x80, 0xbd, 0x53, 0x40, 0x18, 0xc3,
+    0x56, 0x40, 0x1b, 0x09, 0x00, 0x07, 0xbe, 0x53, 0x42, 0x18, 0x03, 0x03, 0xfd, 0x02, 0x06, 0x1d, 0xc6, 0x80, 0x80, 0xdd, 0x39, 0xe0, 0x4c, 0x23,
+    0x3c, 0x20, 0x4f, 0x09, 0x00, 0x07, 0xde, 0x39, 0xe2, 0x4c, 0x43, 0x02, 0x3d, 0x02, 0x06, 0x1d, 0xc7, 0x80, 0x7f, 0xdf, 0x36, 0xdf, 0x3c, 0x21,
+    0x3a, 0x21, 0x40, 0x09, 0x00, 0x07, 0xe0, 0x36, 0xe0, 0x3c, 0x40, 0x03, 0x40, 0x03, 0x06, 0x1d, 0xc7, 0x80, 0x7f, 0xbf, 0x5d, 0xbf, 0x2a, 0xc1,
+    0x5f, 0xc1, 0x2c, 0x09, 0x00, 0x07, 0xc0, 0x5d, 0xc0, 0x2a, 0x00, 0x02, 0x00, 0x02, 0x06, 0x17, 0xc7, 0x80, 0x80, 0x7d, 0x12, 0x60, 0x33, 0x83,
+    0x15, 0x60, 0x36, 0x09, 0x00, 0x07, 0x7e, 0x12, 0x62, 0x33, 0x03, 0x03, 0xfd, 0x02, 0x06, 0x0d, 0xc7, 0x80, 0x80, 0x9f, 0x5f, 0xdf, 0x1b, 0xa1,
+    0x61, 0xe1, 0x1d, 0x09, 0x00, 0x07, 0xa0, 0x5f, 0xe0, 0x1b, 0x00, 0x02, 0x00, 0x02, 0x06, 0x1d, 0xc7, 0x80, 0x80, 0x7f, 0x24, 0x7f, 0x0d, 0x41,
+    0x27, 0x41, 0x10, 0x09, 0x00, 0x07, 0x80, 0x24, 0x80, 0x0d, 0xc0, 0x02, 0xc0, 0x02, 0x06, 0x12, 0xc5, 0x80, 0x80, 0x7f, 0x14, 0xdf, 0x5b, 0x81,
+    0x15, 0xe1, 0x5c, 0x09, 0x00, 0x07, 0x80, 0x14, 0xe0, 0x5b, 0x00, 0x01, 0x00, 0x01, 0x06, 0x28, 0xc6, 0x80, 0x7f, 0x5b, 0x09, 0xbf, 0x2d, 0x21,
+    0x0b, 0x7e, 0x2f, 0x09, 0x00, 0x07, 0x5d, 0x09, 0xc0, 0x2d, 0xc3, 0x01, 0xbd, 0x01, 0x01, 0x03, 0x1e, 0x0e, 0x9e, 0x54, 0x04, 0xe0, 0x06, 0x06,
+    0x16, 0xc5, 0x80, 0x80, 0x5d, 0xff, 0x60, 0xff, 0xa3, 0x00, 0xa0, 0x00, 0x09, 0x00, 0x07, 0x5e, 0xff, 0x62, 0xff, 0x43, 0x01, 0x3d, 0x01, 0x02,
+    0x06, 0x1e, 0xc6, 0x80, 0x80, 0x3f, 0x24, 0xbf, 0x19, 0xc1, 0x25, 0x41, 0x1b, 0x09, 0x00, 0x07, 0x40, 0x24, 0xc0, 0x19, 0x80, 0x01, 0x80, 0x01,
+    0x06, 0x1d, 0xc2, 0x80, 0x80, 0xdf, 0x18, 0x9f, 0x59, 0x61, 0x19, 0x21, 0x5a, 0x09, 0x00, 0x07, 0xe0, 0x18, 0xa0, 0x59, 0x80, 0x00, 0x80, 0x00,
+    0x06, 0x1f, 0xc7, 0x80, 0x80, 0x5f, 0x5e, 0x9f, 0x38, 0xa1, 0x61, 0xe1, 0x3b, 0x09, 0x00, 0x07, 0x60, 0x5e, 0xa0, 0x38, 0x40, 0x03, 0x40, 0x03,
+    0x01, 0x03, 0x7e, 0x10, 0x7e, 0x30, 0x04, 0xe0, 0x06, 0x06, 0x2f, 0xc5, 0x80, 0x80, 0x5d, 0xff, 0x60, 0xff, 0xa3, 0x00, 0xa0, 0x00, 0x09, 0x00,
+    0x07, 0x5e, 0xff, 0x62, 0xff, 0x43, 0x01, 0x3d, 0x01, 0x02, 0x06, 0x0e, 0xc7, 0x80, 0x80, 0xfd, 0x39, 0x60, 0x3b, 0x83, 0x3d, 0xe0, 0x3e, 0x09,
+    0x00, 0x07, 0xfe, 0x39, 0x62, 0x3b, 0x83, 0x03, 0x7d, 0x03, 0x06, 0x0e, 0xc6, 0x80, 0x80, 0xdf, 0x55, 0xbf, 0x02, 0x61, 0x57, 0x41, 0x04, 0x09,
+    0x00, 0x07, 0xe0, 0x55, 0xc0, 0x02, 0x80, 0x01, 0x80, 0x01, 0x06, 0x1d, 0xc6, 0x80, 0x7f, 0xbb, 0x0a, 0xbf, 0x33, 0x81, 0x0c, 0x7e, 0x35, 0x09,
+    0x00, 0x07, 0xbd, 0x0a, 0xc0, 0x33, 0xc3, 0x01, 0xbd, 0x01, 0x01, 0x03, 0x5e, 0x53, 0x1e, 0x03, 0x04, 0xe0, 0x06, 0x06, 0x32, 0xc5, 0x80, 0x80,
+    0x5d, 0xff, 0x60, 0xff, 0xa3, 0x00, 0xa0, 0x00, 0x09, 0x00, 0x07, 0x5e, 0xff, 0x62, 0xff, 0x43, 0x01, 0x3d, 0x01, 0x02, 0x06, 0x1d, 0xc5, 0x80,
+    0x80, 0xff, 0x15, 0x1f, 0x2b, 0x01, 0x17, 0x21, 0x2c, 0x09, 0x00, 0x07, 0x00, 0x16, 0x20, 0x2b, 0x00, 0x01, 0x00, 0x01, 0x06, 0x0d, 0xc2, 0x80,
+    0x80, 0xdf, 0x0b, 0xbf, 0x51, 0x61, 0x0c, 0x41, 0x52, 0x09, 0x00, 0x07, 0xe0, 0x0b, 0xc0, 0x51, 0x80, 0x00, 0x80, 0x00, 0x06, 0x1d, 0xc7, 0x80,
+    0x80, 0x9f, 0x48, 0x1f, 0x49, 0xe1, 0x4b, 0x61, 0x4c, 0x09, 0x00, 0x07, 0xa0, 0x48, 0x20, 0x49, 0x40, 0x03, 0x40, 0x03, 0x06, 0x17, 0xc6, 0x80,
+    0x7f, 0xdb, 0x4c, 0x7f, 0x59, 0xa1, 0x4e, 0x3e, 0x5b, 0x09, 0x00, 0x07, 0xdd, 0x4c, 0x80, 0x59, 0xc3, 0x01, 0xbd, 0x01, 0x01, 0x03, 0xbe, 0x3d,
+    0xde, 0x60, 0x04, 0xe0, 0x06, 0x06, 0x1d, 0xc5, 0x80, 0x80, 0x5d, 0xff, 0x60, 0xff, 0xa3, 0x00, 0xa0, 0x00, 0x09, 0x00, 0x07, 0x5e, 0xff, 0x62,
+    0xff, 0x43, 0x01, 0x3d, 0x01, 0x02, 0x06, 0x08, 0xc6, 0x80, 0x80, 0xbd, 0x0d, 0x20, 0x3a, 0x03, 0x10, 0x60, 0x3c, 0x09, 0x00, 0x07, 0xbe, 0x0d,
+    0x22, 0x3a, 0x43, 0x02, 0x3d, 0x02, 0x06, 0x1c, 0xc6, 0x80, 0x7f, 0x5b, 0x49, 0xff, 0x59, 0x21, 0x4b, 0xbe, 0x5b, 0x09, 0x00, 0x07, 0x5d, 0x49,
+    0x00, 0x5a, 0xc3, 0x01, 0xbd, 0x01, 0x06, 0x28, 0xc8, 0x80, 0x80, 0xe0, 0x30, 0x40, 0x1e, 0x63, 0x37, 0xc0, 0x24, 0x09, 0x00, 0x07, 0xe2, 0x30,
+    0x42, 0x1e, 0x80, 0x06, 0x7d, 0x06, 0x06, 0x16, 0xc7, 0x80, 0x7f, 0x5f, 0x57, 0xff, 0x31, 0x21, 0x5a, 0xc1, 0x34, 0x09, 0x00, 0x07, 0x60, 0x57,
+    0x00, 0x32, 0xc0, 0x02, 0xc0, 0x02, 0x06, 0x19, 0xc6, 0x80, 0x80, 0x3f, 0x5d, 0xbf, 0x4d, 0xc1, 0x5e, 0x41, 0x4f, 0x09, 0x00, 0x07, 0x40, 0x5d,
+    0xc0, 0x4d, 0x80, 0x01, 0x80, 0x01, 0x06, 0x0d, 0xc5, 0x7f, 0x80, 0xbf, 0x59, 0x3f, 0x35, 0xc1, 0x5a, 0x41, 0x36, 0x09, 0x00, 0x07, 0xc0, 0x59,
+    0x40, 0x35, 0x00, 0x01, 0x00, 0x01, 0x06, 0x33, 0xc2, 0x80, 0x80, 0x7f, 0x52, 0xff, 0x46, 0x01, 0x53, 0x81, 0x47, 0x09, 0x00, 0x07, 0x80, 0x52,
+    0x00, 0x47, 0x80, 0x00, 0x80, 0x00, 0x06, 0x18, 0xc5, 0x7f, 0x7f, 0x9f, 0x49, 0x5f, 0x20, 0x61, 0x4a, 0x21, 0x21, 0x3a, 0x00, 0x01, 0x60, 0x4a,
+    0xc0, 0x20, 0x03, 0x60, 0x4a, 0xf6, 0x20, 0x36, 0x4a, 0x20, 0x21, 0x00, 0x4a, 0x20, 0x21, 0x03, 0xca, 0x49, 0x20, 0x21, 0xa0, 0x49, 0xf6, 0x20,
+    0xa0, 0x49, 0xc0, 0x20, 0x03, 0xa0, 0x49, 0x8a, 0x20, 0xca, 0x49, 0x60, 0x20, 0x00, 0x4a, 0x60, 0x20, 0x03, 0x36, 0x4a, 0x60, 0x20, 0x60, 0x4a,
+    0x8a, 0x20, 0x60, 0x4a, 0xc0, 0x20, 0x04, 0x06, 0x08, 0xc2, 0x7f, 0x80, 0xff, 0x54, 0xbf, 0x41, 0x81, 0x55, 0x41, 0x42, 0x09, 0x00, 0x07, 0x00,
+    0x55, 0xc0, 0x41, 0x80, 0x00, 0x80, 0x00, 0x06, 0x0d, 0xc6, 0x80, 0x80, 0xff, 0x3a, 0xff, 0x5c, 0x81, 0x3c, 0x81, 0x5e, 0x09, 0x00, 0x07, 0x00,
+    0x3b, 0x00, 0x5d, 0x80, 0x01, 0x80, 0x01, 0x06, 0x20, 0xc8, 0x80, 0x80, 0x1f, 0x4a, 0x5f, 0x0e, 0x61, 0x4e, 0xa1, 0x12, 0x09, 0x00, 0x07, 0x20,
+    0x4a, 0x60, 0x0e, 0x40, 0x04, 0x40, 0x04, 0x06, 0x0f, 0xc7, 0x7f, 0x80, 0x7f, 0x24, 0xe2, 0x3a, 0x85, 0x28, 0xe1, 0x3e, 0x09, 0x00, 0x07, 0x80,
+    0x24, 0xe3, 0x3a, 0x03, 0x04, 0xfd, 0x03, 0x06, 0x1d, 0xc6, 0x80, 0x80, 0x3d, 0x3c, 0xa0, 0x2a, 0x83, 0x3e, 0xe0, 0x2c, 0x09, 0x00, 0x07, 0x3e,
+    0x3c, 0xa2, 0x2a, 0x43, 0x02, 0x3d, 0x02, 0x06, 0x28, 0xc2, 0x80, 0x80, 0x5f, 0x52, 0x9f, 0x4b, 0xe1, 0x52, 0x21, 0x4c, 0x09, 0x00, 0x07, 0x60,
+    0x52, 0xa0, 0x4b, 0x80, 0x00, 0x80, 0x00, 0x06, 0x20, 0xc5, 0x80, 0x7f, 0x5f, 0x00, 0x7f, 0x23, 0x21, 0x01, 0x41, 0x24, 0x3a, 0x00, 0x01, 0x20,
+    0x01, 0xe0, 0x23, 0x03, 0x20, 0x01, 0x16, 0x24, 0xf6, 0x00, 0x40, 0x24, 0xc0, 0x00, 0x40, 0x24, 0x03, 0x8a, 0x00, 0x40, 0x24, 0x60, 0x00, 0x16,
+    0x24, 0x60, 0x00, 0xe0, 0x23, 0x03, 0x60, 0x00, 0xaa, 0x23, 0x8a, 0x00, 0x80, 0x23, 0xc0, 0x00, 0x80, 0x23, 0x03, 0xf6, 0x00, 0x80, 0x23, 0x20,
+    0x01, 0xaa, 0x23, 0x20, 0x01, 0xe0, 0x23, 0x04, 0x06, 0x18, 0xc7, 0x80, 0x80, 0x5d, 0x23, 0xc0, 0x29, 0x63, 0x26, 0xc0, 0x2c, 0x09, 0x00, 0x07,
+    0x5e, 0x23, 0xc2, 0x29, 0x03, 0x03, 0xfd, 0x02, 0x06, 0x27, 0xc5, 0x7f, 0x7f, 0xbf, 0x48, 0xff, 0x3e, 0x81, 0x49, 0xc1, 0x3f, 0x3a, 0x00, 0x01,
+    0x80, 0x49, 0x60, 0x3f, 0x03, 0x80, 0x49, 0x96, 0x3f, 0x56, 0x49, 0xc0, 0x3f, 0x20, 0x49, 0xc0, 0x3f, 0x03, 0xea, 0x48, 0xc0, 0x3f, 0xc0, 0x48,
+    0x96, 0x3f, 0xc0, 0x48, 0x60, 0x3f, 0x03, 0xc0, 0x48, 0x2a, 0x3f, 0xea, 0x48, 0x00, 0x3f, 0x20, 0x49, 0x00, 0x3f, 0x03, 0x56, 0x49, 0x00, 0x3f,
+    0x80, 0x49, 0x2a, 0x3f, 0x80, 0x49, 0x60, 0x3f, 0x04, 0x06, 0x1f, 0xc7, 0x80, 0x80, 0x1d, 0x4d, 0x00, 0x33, 0xa3, 0x50, 0x80, 0x36, 0x09, 0x00,
+    0x07, 0x1e, 0x4d, 0x02, 0x33, 0x83, 0x03, 0x7d, 0x03, 0x06, 0x32, 0xc6, 0x80, 0x7f, 0xfb, 0x12, 0x5f, 0x54, 0xc1, 0x14, 0x1e, 0x56, 0x09, 0x00,
+    0x07, 0xfd, 0x12, 0x60, 0x54, 0xc3, 0x01, 0xbd, 0x01, 0x06, 0x1d, 0xc6, 0x80, 0x80, 0x7f, 0x5f, 0x7f, 0x54, 0x01, 0x61, 0x01, 0x56, 0x09, 0x00,
+    0x07, 0x80, 0x5f, 0x80, 0x54, 0x80, 0x01, 0x80, 0x01, 0x06, 0x28, 0xc2, 0x80, 0x80, 0x7f, 0x16, 0x5f, 0x49, 0x01, 0x17, 0xe1, 0x49, 0x09, 0x00,
+    0x07, 0x80, 0x16, 0x60, 0x49, 0x80, 0x00, 0x80, 0x00, 0x06, 0x1d, 0xc7, 0x7f, 0x80, 0xbf, 0x50, 0x22, 0x1b, 0xc5, 0x54, 0x21, 0x1f, 0x09, 0x00,
+    0x07, 0xc0, 0x50, 0x23, 0x1b, 0x03, 0x04, 0xfd, 0x03, 0x06, 0x14, 0xc8, 0x80, 0x80, 0x7f, 0x3f, 0x1f, 0x3b, 0xc1, 0x43, 0x61, 0x3f, 0x09, 0x00,
+    0x07, 0x80, 0x3f, 0x20, 0x3b, 0x40, 0x04, 0x40, 0x04, 0x06, 0x2b, 0xc7, 0x80, 0x80, 0x1f, 0x34, 0x5f, 0x42, 0x61, 0x37, 0xa1, 0x45, 0x09, 0x00,
+    0x07, 0x20, 0x34, 0x60, 0x42, 0x40, 0x03, 0x40, 0x03, 0x06, 0x1e, 0xc6, 0x80, 0x80, 0xff, 0x31, 0xbf, 0x41, 0x81, 0x33, 0x41, 0x43, 0x09, 0x00,
+    0x07, 0x00, 0x32, 0xc0, 0x41, 0x80, 0x01, 0x80, 0x01, 0x06, 0x09, 0xc7, 0x80, 0x80, 0x3f, 0x5c, 0xbf, 0x22, 0xc1, 0x5e, 0x41, 0x25, 0x09, 0x00,
+    0x07, 0x40, 0x5c, 0xc0, 0x22, 0x80, 0x02, 0x80, 0x02, 0x06, 0x1f, 0xc7, 0x7f, 0x80, 0xbf, 0x50, 0xe2, 0x35, 0xc5, 0x54, 0xe1, 0x39, 0x09, 0x00,
+    0x07, 0xc0, 0x50, 0xe3, 0x35, 0x03, 0x04, 0xfd, 0x03, 0x06, 0x16, 0xc7, 0x7f, 0x80, 0x7f, 0x3c, 0x9f, 0x06, 0x41, 0x40, 0x61, 0x0a, 0x09, 0x00,
+    0x07, 0x80, 0x3c, 0xa0, 0x06, 0xc0, 0x03, 0xc0, 0x03, 0x06, 0x18, 0xc7, 0x80, 0x80, 0x7f, 0x24, 0x3f, 0x00, 0x81, 0x26, 0x41, 0x02, 0x09, 0x00,
+    0x07, 0x80, 0x24, 0x40, 0x00, 0x00, 0x02, 0x00, 0x02, 0x06, 0x1c, 0xc6, 0x80, 0x7f, 0x5b, 0x0c, 0xdf, 0x20, 0x21, 0x0e, 0x9e, 0x22, 0x09, 0x00,
+    0x07, 0x5d, 0x0c, 0xe0, 0x20, 0xc3, 0x01, 0xbd, 0x01, 0x06, 0x17, 0xc5, 0x80, 0x80, 0x5f, 0x2a, 0xdf, 0x01, 0x21, 0x2b, 0xa1, 0x02, 0x3a, 0x00,
+    0x01, 0x20, 0x2b, 0x40, 0x02, 0x03, 0x20, 0x2b, 0x76, 0x02, 0xf6, 0x2a, 0xa0, 0x02, 0xc0, 0x2a, 0xa0, 0x02, 0x03, 0x8a, 0x2a, 0xa0, 0x02, 0x60,
+    0x2a, 0x76, 0x02, 0x60, 0x2a, 0x40, 0x02, 0x03, 0x60, 0x2a, 0x0a, 0x02, 0x8a, 0x2a, 0xe0, 0x01, 0xc0, 0x2a, 0xe0, 0x01, 0x03, 0xf6, 0x2a, 0xe0,
+    0x01, 0x20, 0x2b, 0x0a, 0x02, 0x20, 0x2b, 0x40, 0x02, 0x04, 0x06, 0x28, 0xc5, 0x7f, 0x7f, 0x9f, 0x00, 0xdf, 0x34, 0x61, 0x01, 0xa1, 0x35, 0x3a,
+    0x00, 0x01, 0x60, 0x01, 0x40, 0x35, 0x03, 0x60, 0x01, 0x76, 0x35, 0x36, 0x01, 0xa0, 0x35, 0x00, 0x01, 0xa0, 0x35, 0x03, 0xca, 0x00, 0xa0, 0x35,
+    0xa0, 0x00, 0x76, 0x35, 0xa0, 0x00, 0x40, 0x35, 0x03, 0xa0, 0x00, 0x0a, 0x35, 0xca, 0x00, 0xe0, 0x34, 0x00, 0x01, 0xe0, 0x34, 0x03, 0x36, 0x01,
+    0xe0, 0x34, 0x60, 0x01, 0x0a, 0x35, 0x60, 0x01, 0x40, 0x35, 0x04, 0x06, 0x27, 0xc7, 0x7f, 0x80, 0x7f, 0x24, 0x62, 0x20, 0x85, 0x28, 0x61, 0x24,
+    0x09, 0x00, 0x07, 0x80, 0x24, 0x63, 0x20, 0x03, 0x04, 0xfd, 0x03, 0x06, 0x1d, 0xc7, 0x80, 0x80, 0xdd, 0x1e, 0xc0, 0x29, 0xe3, 0x21, 0xc0, 0x2c,
+    0x09, 0x00, 0x07, 0xde, 0x1e, 0xc2, 0x29, 0x03, 0x03, 0xfd, 0x02, 0x01, 0x03, 0xbe, 0x2b, 0xde, 0x5f, 0x04, 0xe0, 0x06, 0x06, 0x0d, 0xc5, 0x80,
+    0x80, 0x5d, 0xff, 0x60, 0xff, 0xa3, 0x00, 0xa0, 0x00, 0x09, 0x00, 0x07, 0x5e, 0xff, 0x62, 0xff, 0x43, 0x01, 0x3d, 0x01, 0x02, 0x06, 0x22, 0xc5,
+    0x80, 0x80, 0x9f, 0x12, 0x3f, 0x5e, 0x61, 0x13, 0x01, 0x5f, 0x3a, 0x00, 0x01, 0x60, 0x13, 0xa0, 0x5e, 0x03, 0x60, 0x13, 0xd6, 0x5e, 0x36, 0x13,
+    0x00, 0x5f, 0x00, 0x13, 0x00, 0x5f, 0x03, 0xca, 0x12, 0x00, 0x5f, 0xa0, 0x12, 0xd6, 0x5e, 0xa0, 0x12, 0xa0, 0x5e, 0x03, 0xa0, 0x12, 0x6a, 0x5e,
+    0xca, 0x12, 0x40, 0x5e, 0x00, 0x13, 0x40, 0x5e, 0x03, 0x36, 0x13, 0x40, 0x5e, 0x60, 0x13, 0x6a, 0x5e, 0x60, 0x13, 0xa0, 0x5e, 0x04, 0x06, 0x13,
+    0xc6, 0x80, 0x80, 0x1f, 0x38, 0x5f, 0x17, 0xa1, 0x39, 0xe1, 0x18, 0x09, 0x00, 0x07, 0x20, 0x38, 0x60, 0x17, 0x80, 0x01, 0x80, 0x01, 0x06, 0x1d,
+    0xc7, 0x80, 0x80, 0xff, 0x46, 0xdf, 0x2b, 0x81, 0x49, 0x61, 0x2e, 0x09, 0x00, 0x07, 0x00, 0x47, 0xe0, 0x2b, 0x80, 0x02, 0x80, 0x02, 0x06, 0x1d,
+    0xc7, 0x80, 0x80, 0x9f, 0x30, 0xff, 0x5a, 0xa1, 0x32, 0x01, 0x5d, 0x09, 0x00, 0x07, 0xa0, 0x30, 0x00, 0x5b, 0x00, 0x02, 0x00, 0x02, 0x06, 0x33,
+    0xc7, 0x80, 0x80, 0x5f, 0x35, 0xdf, 0x11, 0xe1, 0x37, 0x61, 0x14, 0x09, 0x00, 0x07, 0x60, 0x35, 0xe0, 0x11, 0x80, 0x02, 0x80, 0x02, 0x06, 0x1d,
+    0xc6, 0x80, 0x80, 0x1f, 0x02, 0xbf, 0x17, 0xa1, 0x03, 0x41, 0x19, 0x09, 0x00, 0x07, 0x20, 0x02, 0xc0, 0x17, 0x80, 0x01, 0x80, 0x01, 0x06, 0x04,
+    0xc7, 0x80, 0x7f, 0x5d, 0x25, 0x00, 0x31, 0x63, 0x28, 0x00, 0x34, 0x09, 0x00, 0x07, 0x5e, 0x25, 0x02, 0x31, 0x03, 0x03, 0xfd, 0x02, 0x06, 0x14,
+    0xc6, 0x80, 0x7f, 0x9b, 0x2e, 0xbf, 0x3a, 0x61, 0x30, 0x7e, 0x3c, 0x09, 0x00, 0x07, 0x9d, 0x2e, 0xc0, 0x3a, 0xc3, 0x01, 0xbd, 0x01, 0x01, 0x03,
+    0xde, 0x02, 0xde, 0x0e, 0x04, 0xe0, 0x06, 0x06, 0x1d, 0xc5, 0x80, 0x80, 0x5d, 0xff, 0x60, 0xff, 0xa3, 0x00, 0xa0, 0x00, 0x09, 0x00, 0x07, 0x5e,
+    0xff, 0x62, 0xff, 0x43, 0x01, 0x3d, 0x01, 0x02, 0x06, 0x1d, 0xc8, 0x80, 0x80, 0x5f, 0x3e, 0x5f, 0x1c, 0xa1, 0x42, 0xa1, 0x20, 0x09, 0x00, 0x07,
+    0x60, 0x3e, 0x60, 0x1c, 0x40, 0x04, 0x40, 0x04, 0x06, 0x1d, 0xc7, 0x80, 0x80, 0x9f, 0x4a, 0x3f, 0x36, 0xe1, 0x4d, 0x81, 0x39, 0x09, 0x00, 0x07,
+    0xa0, 0x4a, 0x40, 0x36, 0x40, 0x03, 0x40, 0x03, 0x06, 0x08, 0xc2, 0x80, 0x80, 0x7f, 0x00, 0x5f, 0x4b, 0x01, 0x01, 0xe1, 0x4b, 0x09, 0x00, 0x07,
+    0x80, 0x00, 0x60, 0x4b, 0x80, 0x00, 0x80, 0x00, 0x06, 0x2d, 0xc5, 0x80, 0x80, 0xdf, 0x29, 0xdf, 0x4f, 0xe1, 0x2a, 0xe1, 0x50, 0x09, 0x00, 0x07,
+    0xe0, 0x29, 0xe0, 0x4f, 0x00, 0x01, 0x00, 0x01, 0x06, 0x1d, 0xc6, 0x80, 0x80, 0x7f, 0x44, 0xdf, 0x00, 0x01, 0x46, 0x61, 0x02, 0x09, 0x00, 0x07,
+    0x80, 0x44, 0xe0, 0x00, 0x80, 0x01, 0x80, 0x01, 0x06, 0x30, 0xc5, 0x80, 0x80, 0xdf, 0x59, 0x5f, 0x47, 0xe1, 0x5a, 0x61, 0x48, 0x09, 0x00, 0x07,
+    0xe0, 0x59, 0x60, 0x47, 0x00, 0x01, 0x00, 0x01, 0x06, 0x1c, 0xc5, 0x80, 0x80, 0x9f, 0x11, 0xbf, 0x2c, 0xa1, 0x12, 0xc1, 0x2d, 0x09, 0x00, 0x07,
+    0xa0, 0x11, 0xc0, 0x2c, 0x00, 0x01, 0x00, 0x01, 0x06, 0x1d, 0xc5, 0x80, 0x80, 0xff, 0x40, 0x9f, 0x31, 0x01, 0x42, 0xa1, 0x32, 0x09, 0x00, 0x07,
+    0x00, 0x41, 0xa0, 0x31, 0x00, 0x01, 0x00, 0x01, 0x06, 0x03, 0xc5, 0x80, 0x80, 0xdf, 0x12, 0x5f, 0x1e, 0xa1, 0x13, 0x21, 0x1f, 0x3a, 0x00, 0x01,
+    0xa0, 0x13, 0xc0, 0x1e, 0x03, 0xa0, 0x13, 0xf6, 0x1e, 0x76, 0x13, 0x20, 0x1f, 0x40, 0x13, 0x20, 0x1f, 0x03, 0x0a, 0x13, 0x20, 0x1f, 0xe0, 0x12,
+    0xf6, 0x1e, 0xe0, 0x12, 0xc0, 0x1e, 0x03, 0xe0, 0x12, 0x8a, 0x1e, 0x0a, 0x13, 0x60, 0x1e, 0x40, 0x13, 0x60, 0x1e, 0x03, 0x76, 0x13, 0x60, 0x1e,
+    0xa0, 0x13, 0x8a, 0x1e, 0xa0, 0x13, 0xc0, 0x1e, 0x04, 0x06, 0x08, 0xc7, 0x80, 0x80, 0x3d, 0x5a, 0xa0, 0x3c, 0x43, 0x5d, 0xa0, 0x3f, 0x09, 0x00,
+    0x07, 0x3e, 0x5a, 0xa2, 0x3c, 0x03, 0x03, 0xfd, 0x02, 0x06, 0x0a, 0xc7, 0x80, 0x80, 0x5f, 0x26, 0x3f, 0x2d, 0x21, 0x2a, 0x01, 0x31, 0x09, 0x00,
+    0x07, 0x60, 0x26, 0x40, 0x2d, 0xc0, 0x03, 0xc0, 0x03, 0x06, 0x1d, 0xc5, 0x80, 0x80, 0xbf, 0x56, 0x7f, 0x53, 0xc1, 0x57, 0x81, 0x54, 0x09, 0x00,
+    0x07, 0xc0, 0x56, 0x80, 0x53, 0x00, 0x01, 0x00, 0x01, 0x06, 0x18, 0xc8, 0x80, 0x7f, 0x1f, 0x37, 0x7f, 0x30, 0x21, 0x3d, 0x81, 0x36, 0x09, 0x00,
+    0x07, 0x20, 0x37, 0x80, 0x30, 0x00, 0x06, 0x00, 0x06, 0x06, 0x1e, 0xc7, 0x80, 0x80, 0xff, 0x0c, 0xdf, 0x2b, 0xc1, 0x0f, 0xa1, 0x2e, 0x09, 0x00,
+    0x07, 0x00, 0x0d, 0xe0, 0x2b, 0xc0, 0x02, 0xc0, 0x02, 0x06, 0x07, 0xc2, 0x80, 0x80, 0xbf, 0x07, 0x3f, 0x4c, 0x41, 0x08, 0xc1, 0x4c, 0x09, 0x00,
+    0x07, 0xc0, 0x07, 0x40, 0x4c, 0x80, 0x00, 0x80, 0x00, 0x06, 0x1f, 0xc7, 0x80, 0x80, 0xdf, 0x10, 0x5f, 0x3f, 0xe1, 0x12, 0x61, 0x41, 0x09, 0x00,
+    0x07, 0xe0, 0x10, 0x60, 0x3f, 0x00, 0x02, 0x00, 0x02, 0x06, 0x1f, 0xc7, 0x80, 0x80, 0x5f, 0x2a, 0xff, 0x20, 0x21, 0x2e, 0xc1, 0x24, 0x09, 0x00,
+    0x07, 0x60, 0x2a, 0x00, 0x21, 0xc0, 0x03, 0xc0, 0x03, 0x06, 0x28, 0xc7, 0x80, 0x80, 0xdd, 0x41, 0x60, 0x35, 0x63, 0x45, 0xe0, 0x38, 0x09, 0x00,
+    0x07, 0xde, 0x41, 0x62, 0x35, 0x83, 0x03, 0x7d, 0x03, 0x06, 0x1b, 0xc7, 0x80, 0x80, 0xbf, 0x07, 0xbf, 0x21, 0xc1, 0x09, 0xc1, 0x23, 0x09, 0x00,
+    0x07, 0xc0, 0x07, 0xc0, 0x21, 0x00, 0x02, 0x00, 0x02, 0x06, 0x08, 0xc6, 0x80, 0x7f, 0x5f, 0x2b, 0xdf, 0x04, 0xe1, 0x2c, 0x61, 0x06, 0x09, 0x00,
+    0x07, 0x60, 0x2b, 0xe0, 0x04, 0x80, 0x01, 0x80, 0x01, 0x06, 0x28, 0xc6, 0x80, 0x7f, 0xfb, 0x4c, 0x3f, 0x4f, 0xc1, 0x4e, 0xfe, 0x50, 0x09, 0x00,
+    0x07, 0xfd, 0x4c, 0x40, 0x4f, 0xc3, 0x01, 0xbd, 0x01, 0x06, 0x03, 0xc6, 0x80, 0x80, 0x9f, 0x04, 0xdf, 0x09, 0x21, 0x06, 0x61, 0x0b, 0x09, 0x00,
+    0x07, 0xa0, 0x04, 0xe0, 0x09, 0x80, 0x01, 0x80, 0x01, 0x06, 0x0b, 0xc6, 0x80, 0x7f, 0x3b, 0x3d, 0x7f, 0x39, 0x01, 0x3f, 0x3e, 0x3b, 0x09, 0x00,
+    0x07, 0x3d, 0x3d, 0x80, 0x39, 0xc3, 0x01, 0xbd, 0x01, 0x06, 0x31, 0xc7, 0x7f, 0x80, 0x1f, 0x31, 0x82, 0x0d, 0x25, 0x35, 0x81, 0x11, 0x09, 0x00,
+    0x07, 0x20, 0x31, 0x83, 0x0d, 0x03, 0x04, 0xfd, 0x03, 0x06, 0x1a, 0xc7, 0x80, 0x80, 0xbf, 0x1e, 0xbf, 0x16, 0x41, 0x21, 0x41, 0x19, 0x09, 0x00,
+    0x07, 0xc0, 0x1e, 0xc0, 0x16, 0x80, 0x02, 0x80, 0x02, 0x06, 0x1f, 0xc7, 0x80, 0x80, 0xff, 0x43, 0x5f, 0x47, 0x01, 0x46, 0x61, 0x49, 0x09, 0x00,
+    0x07, 0x00, 0x44, 0x60, 0x47, 0x00, 0x02, 0x00, 0x02, 0x06, 0x1e, 0xc7, 0x80, 0x80, 0x5d, 0x15, 0xe0, 0x31, 0x63, 0x18, 0xe0, 0x34, 0x09, 0x00,
+    0x07, 0x5e, 0x15, 0xe2, 0x31, 0x03, 0x03, 0xfd, 0x02, 0x06, 0x1e, 0xc2, 0x80, 0x80, 0x1f, 0x59, 0x9f, 0x28, 0xa1, 0x59, 0x21, 0x29, 0x09, 0x00,
+    0x07, 0x20, 0x59, 0xa0, 0x28, 0x80, 0x00, 0x80, 0x00, 0x01, 0x03, 0x3e, 0x31, 0x5e, 0x40, 0x04, 0xe0, 0x06, 0x06, 0x1d, 0xc5, 0x80, 0x80, 0x5d,
+    0xff, 0x60, 0xff, 0xa3, 0x00, 0xa0, 0x00, 0x09, 0x00, 0x07, 0x5e, 0xff, 0x62, 0xff, 0x43, 0x01, 0x3d, 0x01, 0x02, 0x06, 0x1d, 0xc6, 0x80, 0x80,
+    0x5d, 0x45, 0x20, 0x21, 0xa3, 0x47, 0x60, 0x23, 0x09, 0x00, 0x07, 0x5e, 0x45, 0x22, 0x21, 0x43, 0x02, 0x3d, 0x02, 0x06, 0x32, 0xc7, 0x7f, 0x80,
+    0xdf, 0x52, 0xbf, 0x11, 0xe1, 0x54, 0xc1, 0x13, 0x09, 0x00, 0x07, 0xe0, 0x52, 0xc0, 0x11, 0x00, 0x02, 0x00, 0x02, 0x01, 0x03, 0xde, 0x46, 0xde,
+    0x50, 0x04, 0xe0, 0x06, 0x06, 0x1f, 0xc5, 0x80, 0x80, 0x5d, 0xff, 0x60, 0xff, 0xa3, 0x00, 0xa0, 0x00, 0x09, 0x00, 0x07, 0x5e, 0xff, 0x62, 0xff,
+    0x43, 0x01, 0x3d, 0x01, 0x02, 0x06, 0x32, 0xc8, 0x80, 0x80, 0x9f, 0x32, 0x3f, 0x24, 0xe1, 0x36, 0x81, 0x28, 0x09, 0x00, 0x07, 0xa0, 0x32, 0x40,
+    0x24, 0x40, 0x04, 0x40, 0x04, 0x06, 0x13, 0xc5, 0x7f, 0x80, 0x3f, 0x5f, 0x3f, 0x42, 0x41, 0x60, 0x41, 0x43, 0x09, 0x00, 0x07, 0x40, 0x5f, 0x40,
+    0x42, 0x00, 0x01, 0x00, 0x01, 0x06, 0x1e, 0xc5, 0x80, 0x80, 0x7f, 0x06, 0x9f, 0x14, 0x81, 0x07, 0xa1, 0x15, 0x09, 0x00, 0x07, 0x80, 0x06, 0xa0,
+    0x14, 0x00, 0x01, 0x00, 0x01, 0x06, 0x1a, 0xc7, 0x80, 0x80, 0x5f, 0x19, 0x5f, 0x0e, 0x61, 0x1b, 0x61, 0x10, 0x09, 0x00, 0x07, 0x60, 0x19, 0x60,
+    0x0e, 0x00, 0x02, 0x00, 0x02, 0x06, 0x1d, 0xc7, 0x80, 0x80, 0x3f, 0x23, 0xdf, 0x48, 0xc1, 0x25, 0x61, 0x4b, 0x09, 0x00, 0x07, 0x40, 0x23, 0xe0,
+    0x48, 0x80, 0x02, 0x80, 0x02, 0x06, 0x28, 0xc6, 0x80, 0x7f, 0xfb, 0x45, 0x1f, 0x55, 0xc1, 0x47, 0xde, 0x56, 0x09, 0x00, 0x07, 0xfd, 0x45, 0x20,
+    0x55, 0xc3, 0x01, 0xbd, 0x01, 0x06, 0x08, 0xc7, 0x80, 0x7f, 0xdd, 0x37, 0x00, 0x0d, 0x63, 0x3b, 0x80, 0x10, 0x09, 0x00, 0x07, 0xde, 0x37, 0x02,
+    0x0d, 0x83, 0x03, 0x7d, 0x03, 0x06, 0x2d, 0xc6, 0x80, 0x80, 0xbf, 0x0e, 0x5f, 0x57, 0x41, 0x10, 0xe1, 0x58, 0x09, 0x00, 0x07, 0xc0, 0x0e, 0x60,
+    0x57, 0x80, 0x01, 0x80, 0x01, 0x06, 0x14, 0xc7, 0x80, 0x80, 0x5d, 0x49, 0xa0, 0x26, 0x63, 0x4c, 0xa0, 0x29, 0x09, 0x00, 0x07, 0x5e, 0x49, 0xa2,
+    0x26, 0x03, 0x03, 0xfd, 0x02, 0x06, 0x1d, 0xc6, 0x80, 0x80, 0xfd, 0x42, 0xc0, 0x03, 0x43, 0x45, 0x00, 0x06, 0x09, 0x00, 0x07, 0xfe, 0x42, 0xc2,
+    0x03, 0x43, 0x02, 0x3d, 0x02, 0x06, 0x28, 0xc6, 0x80, 0x80, 0x9f, 0x26, 0xdf, 0x49, 0x21, 0x28, 0x61, 0x4b, 0x09, 0x00, 0x07, 0xa0, 0x26, 0xe0,
+    0x49, 0x80, 0x01, 0x80, 0x01, 0x06, 0x0d, 0xc7, 0x80, 0x80, 0x3f, 0x0a, 0xbf, 0x17, 0xc1, 0x0c, 0x41, 0x1a, 0x09, 0x00, 0x07, 0x40, 0x0a, 0xc0,
+    0x17, 0x80, 0x02, 0x80, 0x02, 0x06, 0x03, 0xc8, 0x80, 0x80, 0x5f, 0x27, 0xbf, 0x16, 0x21, 0x2c, 0x81, 0x1b, 0x09, 0x00, 0x07, 0x60, 0x27, 0xc0,
+    0x16, 0xc0, 0x04, 0xc0, 0x04, 0x06, 0x1d, 0xc6, 0x80, 0x80, 0xfd, 0x2e, 0xc0, 0x45, 0x43, 0x31, 0x00, 0x48, 0x09, 0x00, 0x07, 0xfe, 0x2e, 0xc2,
+    0x45, 0x43, 0x02, 0x3d, 0x02, 0x06, 0x0d, 0xc7, 0x80, 0x80, 0x9f, 0x46, 0x7f, 0x19, 0x61, 0x4a, 0x41, 0x1d, 0x09, 0x00, 0x07, 0xa0, 0x46, 0x80,
+    0x19, 0xc0, 0x03, 0xc0, 0x03, 0x06, 0x08, 0xc5, 0x7f, 0x7f, 0xff, 0x09, 0x5f, 0x58, 0xc1, 0x0a, 0x21, 0x59, 0x3a, 0x00, 0x01, 0xc0, 0x0a, 0xc0,
+    0x58, 0x03, 0xc0, 0x0a, 0xf6, 0x58, 0x96, 0x0a, 0x20, 0x59, 0x60, 0x0a, 0x20, 0x59, 0x03, 0x2a, 0x0a, 0x20, 0x59, 0x00, 0x0a, 0xf6, 0x58, 0x00,
+    0x0a, 0xc0, 0x58, 0x03, 0x00, 0x0a, 0x8a, 0x58, 0x2a, 0x0a, 0x60, 0x58, 0x60, 0x0a, 0x60, 0x58, 0x03, 0x96, 0x0a, 0x60, 0x58, 0xc0, 0x0a, 0x8a,
+    0x58, 0xc0, 0x0a, 0xc0, 0x58, 0x04, 0x01, 0x03, 0x7e, 0x59, 0x5e, 0x39, 0x04, 0xe0, 0x06, 0x06, 0x1a, 0xc5, 0x80, 0x80, 0x5d, 0xff, 0x60, 0xff,
+    0xa3, 0x00, 0xa0, 0x00, 0x09, 0x00, 0x07, 0x5e, 0xff, 0x62, 0xff, 0x43, 0x01, 0x3d, 0x01, 0x02, 0x06, 0x18, 0xc7, 0x80, 0x7f, 0xdf, 0x15, 0xdf,
+    0x1d, 0x61, 0x18, 0x61, 0x20, 0x09, 0x00, 0x07, 0xe0, 0x15, 0xe0, 0x1d, 0x80, 0x02, 0x80, 0x02, 0x06, 0x19, 0xc7, 0x80, 0x80, 0xdf, 0x38, 0x9f,
+    0x05, 0xa1, 0x3c, 0x61, 0x09, 0x09, 0x00, 0x07, 0xe0, 0x38, 0xa0, 0x05, 0xc0, 0x03, 0xc0, 0x03, 0x06, 0x32, 0xc6, 0x80, 0x7f, 0x1b, 0x1d, 0x1f,
+    0x1b, 0xe1, 0x1e, 0xde, 0x1c, 0x09, 0x00, 0x07, 0x1d, 0x1d, 0x20, 0x1b, 0xc3, 0x01, 0xbd, 0x01, 0x06, 0x08, 0xc7, 0x80, 0x80, 0x9f, 0x54, 0x3f,
+    0x0a, 0x21, 0x57, 0xc1, 0x0c, 0x09, 0x00, 0x07, 0xa0, 0x54, 0x40, 0x0a, 0x80, 0x02, 0x80, 0x02, 0x06, 0x16, 0xc5, 0x80, 0x80, 0xff, 0x26, 0xff,
+    0x3f, 0x01, 0x28, 0x01, 0x41, 0x09, 0x00, 0x07, 0x00, 0x27, 0x00, 0x40, 0x00, 0x01, 0x00, 0x01, 0x01, 0x03, 0xfe, 0x4f, 0x7e, 0x39, 0x04, 0xe0,
+    0x06, 0x06, 0x03, 0xc5, 0x80, 0x80, 0x5d, 0xff, 0x60, 0xff, 0xa3, 0x00, 0xa0, 0x00, 0x09, 0x00, 0x07, 0x5e, 0xff, 0x62, 0xff, 0x43, 0x01, 0x3d,
+    0x01, 0x02, 0x01, 0x03, 0x3e, 0x5c, 0x3e, 0x2f, 0x04, 0xe0, 0x06, 0x06, 0x1c, 0xc5, 0x80, 0x80, 0x5d, 0xff, 0x60, 0xff, 0xa3, 0x00, 0xa0, 0x00,
+    0x09, 0x00, 0x07, 0x5e, 0xff, 0x62, 0xff, 0x43, 0x01, 0x3d, 0x01, 0x02, 0x06, 0x14, 0xc2, 0x80, 0x80, 0xdf, 0x0c, 0xbf, 0x02, 0x61, 0x0d, 0x41,
+    0x03, 0x09, 0x00, 0x07, 0xe0, 0x0c, 0xc0, 0x02, 0x80, 0x00, 0x80, 0x00, 0x06, 0x1d, 0xc7, 0x80, 0x80, 0xdd, 0x45, 0x40, 0x35, 0xe3, 0x48, 0x40,
+    0x38, 0x09, 0x00, 0x07, 0xde, 0x45, 0x42, 0x35, 0x03, 0x03, 0xfd, 0x02, 0x06, 0x18, 0xc6, 0x80, 0x7f, 0xbb, 0x28, 0x1f, 0x24, 0x81, 0x2a, 0xde,
+    0x25, 0x09, 0x00, 0x07, 0xbd, 0x28, 0x20, 0x24, 0xc3, 0x01, 0xbd, 0x01, 0x06, 0x2a, 0xc7, 0x80, 0x80, 0x7f, 0x48, 0xff, 0x56, 0x01, 0x4b, 0x81,
+    0x59, 0x09, 0x00, 0x07, 0x80, 0x48, 0x00, 0x57, 0x80, 0x02, 0x80, 0x02, 0x06, 0x14, 0xc5, 0x80, 0x80, 0x9f, 0x0f, 0x9f, 0x0d, 0xa1, 0x10, 0xa1,
+    0x0e, 0x09, 0x00, 0x07, 0xa0, 0x0f, 0xa0, 0x0d, 0x00, 0x01, 0x00, 0x01, 0x06, 0x17, 0xc5, 0x7f, 0x80, 0xbf, 0x16, 0x5f, 0x5d, 0xc1, 0x17, 0x61,
+    0x5e, 0x09, 0x00, 0x07, 0xc0, 0x16, 0x60, 0x5d, 0x00, 0x01, 0x00, 0x01, 0x06, 0x26, 0xc7, 0x80, 0x80, 0x1f, 0x12, 0x3f, 0x0b, 0xa1, 0x14, 0xc1,
+    0x0d, 0x09, 0x00, 0x07, 0x20, 0x12, 0x40, 0x0b, 0x80, 0x02, 0x80, 0x02, 0x06, 0x1d, 0xc7, 0x80, 0x80, 0xbf, 0x35, 0x9f, 0x22, 0xc1, 0x37, 0xa1,
+    0x24, 0x09, 0x00, 0x07, 0xc0, 0x35, 0xa0, 0x22, 0x00, 0x02, 0x00, 0x02, 0x06, 0x1a, 0xc5, 0x7f, 0x7f, 0xbf, 0x51, 0x9f, 0x60, 0x81, 0x52, 0x61,
+    0x61, 0x3a, 0x00, 0x01, 0x80, 0x52, 0x00, 0x61, 0x03, 0x80, 0x52, 0x36, 0x61, 0x56, 0x52, 0x60, 0x61, 0x20, 0x52, 0x60, 0x61, 0x03, 0xea, 0x51,
+    0x60, 0x61, 0xc0, 0x51, 0x36, 0x61, 0xc0, 0x51, 0x00, 0x61, 0x03, 0xc0, 0x51, 0xca, 0x60, 0xea, 0x51, 0xa0, 0x60, 0x20, 0x52, 0xa0, 0x60, 0x03,
+    0x56, 0x52, 0xa0, 0x60, 0x80, 0x52, 0xca, 0x60, 0x80, 0x52, 0x00, 0x61, 0x04, 0x06, 0x1e, 0xc7, 0x80, 0x7f, 0x3d, 0x16, 0xdd, 0x34, 0x43, 0x19,
+    0xdd, 0x37, 0x09, 0x00, 0x07, 0x3e, 0x16, 0xde, 0x34, 0x03, 0x03, 0xfd, 0x02, 0x06, 0x0e, 0xc6, 0x80, 0x80, 0x9d, 0x3a, 0xc0, 0x00, 0xe3, 0x3c,
+    0x00, 0x03, 0x09, 0x00, 0x07, 0x9e, 0x3a, 0xc2, 0x00, 0x43, 0x02, 0x3d, 0x02, 0x06, 0x08, 0xc6, 0x80, 0x80, 0xdf, 0x1e, 0x3f, 0x05, 0x61, 0x20,
+    0xc1, 0x06, 0x09, 0x00, 0x07, 0xe0, 0x1e, 0x40, 0x05, 0x80, 0x01, 0x80, 0x01, 0x06, 0x16, 0xc7, 0x80, 0x80, 0x1f, 0x56, 0xbf, 0x1a, 0x61, 0x59,
+    0x01, 0x1e, 0x09, 0x00, 0x07, 0x20, 0x56, 0xc0, 0x1a, 0x40, 0x03, 0x40, 0x03, 0x06, 0x1d, 0xc2, 0x80, 0x80, 0xbf, 0x05, 0x9f, 0x18, 0x41, 0x06,
+    0x21, 0x19, 0x09, 0x00, 0x07, 0xc0, 0x05, 0xa0, 0x18, 0x80, 0x00, 0x80, 0x00, 0x06, 0x32, 0xc7, 0x80, 0x80, 0x9d, 0x39, 0x40, 0x09, 0x23, 0x3d,
+    0xc0, 0x0c, 0x09, 0x00, 0x07, 0x9e, 0x39, 0x42, 0x09, 0x83, 0x03, 0x7d, 0x03, 0x06, 0x2a, 0xc7, 0x80, 0x80, 0x1f, 0x4e, 0x9f, 0x06, 0x21, 0x50,
+    0xa1, 0x08, 0x09, 0x00, 0x07, 0x20, 0x4e, 0xa0, 0x06, 0x00, 0x02, 0x00, 0x02, 0x06, 0x32, 0xc2, 0x80, 0x80, 0xbf, 0x5f, 0x5f, 0x60, 0x41, 0x60,
+    0xe1, 0x60, 0x09, 0x00, 0x07, 0xc0, 0x5f, 0x60, 0x60, 0x80, 0x00, 0x80, 0x00, 0x06, 0x1e, 0xc7, 0x80, 0x80, 0x9f, 0x3e, 0xbf, 0x54, 0xa1, 0x40,
+    0xc1, 0x56, 0x09, 0x00, 0x07, 0xa0, 0x3e, 0xc0, 0x54, 0x00, 0x02, 0x00, 0x02, 0x06, 0x32, 0xc5, 0x80, 0x80, 0x5f, 0x40, 0x7f, 0x58, 0x61, 0x41,
+    0x81, 0x59, 0x09, 0x00, 0x07, 0x60, 0x40, 0x80, 0x58, 0x00, 0x01, 0x00, 0x01, 0x06, 0x2f, 0xc5, 0x80, 0x80, 0x5f, 0x22, 0xdf, 0x50, 0x61, 0x23,
+    0xe1, 0x51, 0x09, 0x00, 0x07, 0x60, 0x22, 0xe0, 0x50, 0x00, 0x01, 0x00, 0x01, 0x06, 0x00, 0xff, 0x80, 0x80, 0x9f, 0xfd, 0x3f, 0x43, 0x81, 0x69,
+    0x01, 0x60, 0x0b, 0x00, 0x06, 0xa0, 0xfd, 0x40, 0x43, 0xe0, 0x6b, 0xc0, 0x1c, 0xe0, 0x01, 0x01, 0x08, 0x00, 0x01, 0x40, 0x34, 0xc0, 0x03, 0x80,
+    0x48, 0xa0, 0x42, 0xa0, 0x07, 0x02, 0x01, 0x08, 0x01, 0x00, 0x18, 0x34, 0xc0, 0x03, 0x20, 0x53, 0xa0, 0x42, 0xe0, 0x03, 0x02, 0x01, 0x08, 0x02,
+    0x02, 0x18, 0x34, 0xc0, 0x03, 0x60, 0x57, 0xa0, 0x42, 0xe0, 0x03, 0x02,
+};
+
+const size_t RelistenAlbumArtsDisplayListLength = sizeof(RelistenAlbumArtsDisplayList);
+
+} // namespace AlbumArt
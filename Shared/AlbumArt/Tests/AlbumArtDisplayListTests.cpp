@@ -0,0 +1,193 @@
+//
+//  AlbumArtDisplayListTests.cpp
+//  RelistenShared
+//
+//  Copyright © 2018 Alec Gorge. All rights reserved.
+//
+
+// Tests AlbumArt::DisplayList against malformed input: every design at odd bitmap sizes, truncated lists, and lists
+// with corrupted bytes, checking that replay never writes outside the bitmap. Then times each design at the image
+// cache's sizes and compares the 224px and 64px renders against 8x supersampled ones. Run it under ASan/UBSan too.
+//
+//   g++ -std=c++14 -O2 -Wno-unknown-pragmas -I.. ../AlbumArtDisplayList.cpp ../RelistenAlbumArtsDisplayList.cpp AlbumArtDisplayListTests.cpp -o display_list_tests && ./display_list_tests
+
+#include "AlbumArtDisplayList.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+using namespace AlbumArt;
+
+namespace {
+
+int failures = 0;
+
+void expect(bool condition, const char *description) {
+    if (!condition) {
+        std::printf("FAILED: %s\n", description);
+        failures++;
+    }
+}
+
+const int DesignCount = 4;
+const uint32_t Canary = 0xDEADBEEF;
+
+// A bitmap with a canary column at the end of each row and a canary row below it, to catch writes outside it.
+struct GuardedBitmap {
+    std::vector<uint32_t> storage;
+    Bitmap bitmap;
+
+    GuardedBitmap(int width, int height) : storage((size_t)(width + 1) * (height + 1), Canary) {
+        bitmap = {storage.data(), width, height, (size_t)(width + 1) * 4};
+        for (int y = 0; y < height; y++) {
+            std::fill_n(storage.data() + (size_t)y * (width + 1), width, 0);
+        }
+    }
+
+    bool canariesAreIntact() const {
+        const int width = bitmap.width;
+        for (size_t i = 0; i < storage.size(); i++) {
+            const bool inside = (int)(i / (width + 1)) < bitmap.height && (int)(i % (width + 1)) < width;
+            if (!inside && storage[i] != Canary) {
+                return false;
+            }
+        }
+        return true;
+    }
+};
+
+void testOddSizes(const DisplayList &list, const Palette &palette) {
+    const int sizes[][2] = {{1, 1}, {3, 7}, {37, 100}, {300, 41}, {768, 768}, {1024, 1024}};
+    for (const auto &size : sizes) {
+        for (int design = 0; design < DesignCount; design++) {
+            for (Detail detail : {Detail::Full, Detail::Reduced, Detail::Minimal}) {
+                GuardedBitmap guarded(size[0], size[1]);
+                int labels = 0;
+                list.render((Design)design, palette, true, guarded.bitmap, detail, [&](const Label &) { labels++; });
+                expect(guarded.canariesAreIntact(), "replay stays inside the bitmap");
+                expect(labels > 0, "every design has labels");
+            }
+        }
+    }
+
+    GuardedBitmap guarded(16, 16);
+    list.render((Design)DesignCount, palette, true, guarded.bitmap, nullptr);
+    expect(std::all_of(guarded.storage.begin(), guarded.storage.begin() + 16, [](uint32_t pixel) { return pixel == 0; }), "a design past the end draws nothing");
+}
+
+void testMalformedLists(const Palette &palette) {
+    const uint8_t *bytes = RelistenAlbumArtsDisplayList;
+    const size_t length = RelistenAlbumArtsDisplayListLength;
+
+    DisplayList list;
+    expect(list.load(bytes, length), "the compiled list loads");
+    expect(list.designCount() == DesignCount, "the compiled list has every design");
+
+    // Every design runs to the end of its data, so any truncation cuts one short
+    int truncations = 0;
+    for (size_t n = 0; n < length; n += n + 64 < length ? 997 : 1) {
+        DisplayList truncated;
+        const bool loaded = truncated.load(bytes, n);
+        expect(!loaded, "a truncated list is rejected");
+        expect(truncated.designCount() == 0, "a rejected list has no designs");
+        truncations++;
+    }
+
+    std::vector<uint8_t> otherVersion(bytes, bytes + length);
+    otherVersion[4] ^= 1;
+    expect(!list.load(otherVersion.data(), otherVersion.size()), "a list of another version is rejected");
+    expect(list.designCount() == 0, "a list that fails to load drops its designs");
+
+    // A corrupted byte is either caught while loading, or makes a list that still replays inside the bitmap
+    int rejected = 0, rendered = 0;
+    std::vector<uint8_t> corrupted(bytes, bytes + length);
+    for (size_t i = 12; i < length; i += 131) {
+        corrupted[i] ^= 0x5a;
+        DisplayList damaged;
+        if (!damaged.load(corrupted.data(), corrupted.size())) {
+            rejected++;
+        } else {
+            for (int design = 0; design < DesignCount; design++) {
+                GuardedBitmap guarded(64, 48);
+                damaged.render((Design)design, palette, true, guarded.bitmap, Detail::Full, nullptr);
+                expect(guarded.canariesAreIntact(), "a corrupted list replays inside the bitmap");
+            }
+            rendered++;
+        }
+        corrupted[i] ^= 0x5a;
+    }
+    std::printf("rejected %d truncations; of %d corrupted lists, %d rejected and %d rendered\n", truncations, rejected + rendered, rejected, rendered);
+}
+
+void benchmark(const DisplayList &list, const Palette &palette) {
+    for (int size : {768, 224, 64}) {
+        std::vector<uint32_t> pixels((size_t)size * size);
+        const Bitmap bitmap = {pixels.data(), size, size, (size_t)size * 4};
+        const int iterations = size == 768 ? 20 : 100;
+        for (int design = 0; design < DesignCount; design++) {
+            const auto start = std::chrono::steady_clock::now();
+            for (int i = 0; i < iterations; i++) {
+                std::fill(pixels.begin(), pixels.end(), 0);
+                list.render((Design)design, palette, true, bitmap, Detail::Full, nullptr);
+            }
+            const double milliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() / iterations;
+            std::printf("design %d at %dpx: %.2fms\n", design, size, milliseconds);
+        }
+    }
+
+    // Each pixel against the mean of its 8x8 block in a render 8 times as large, per channel
+    const int factor = 8;
+    for (int size : {224, 64}) {
+        const int large = size * factor;
+        std::vector<uint32_t> reference((size_t)large * large), pixels((size_t)size * size);
+        for (int design = 0; design < DesignCount; design++) {
+            std::fill(reference.begin(), reference.end(), 0);
+            std::fill(pixels.begin(), pixels.end(), 0);
+            list.render((Design)design, palette, true, {reference.data(), large, large, (size_t)large * 4}, Detail::Full, nullptr);
+            list.render((Design)design, palette, true, {pixels.data(), size, size, (size_t)size * 4}, Detail::Full, nullptr);
+
+            double totalError = 0;
+            int maximumError = 0;
+            for (int y = 0; y < size; y++) {
+                for (int x = 0; x < size; x++) {
+                    for (int shift = 0; shift < 32; shift += 8) {
+                        int sum = 0;
+                        for (int j = 0; j < factor; j++) {
+                            for (int i = 0; i < factor; i++) {
+                                sum += (reference[(size_t)(y * factor + j) * large + x * factor + i] >> shift) & 0xFF;
+                            }
+                        }
+                        const int expected = (int)std::lround(sum / (double)(factor * factor));
+                        const int error = std::abs(expected - (int)((pixels[(size_t)y * size + x] >> shift) & 0xFF));
+                        totalError += error;
+                        maximumError = std::max(maximumError, error);
+                    }
+                }
+            }
+            const double meanError = totalError / (size * size * 4);
+            std::printf("design %d at %dpx: mean error %.2f levels, maximum %d\n", design, size, meanError, maximumError);
+            expect(meanError < (size < 128 ? 4 : 2), "a render matches a supersampled one on average");
+        }
+    }
+}
+
+} // namespace
+
+int main() {
+    const DisplayList &list = DisplayList::shared();
+    const Palette palette = Palette::forBaseColor({0.204f, 0.596f, 0.859f, 1});
+
+    testOddSizes(list, palette);
+    testMalformedLists(palette);
+    benchmark(list, palette);
+
+    if (failures > 0) {
+        return EXIT_FAILURE;
+    }
+    std::printf("OK\n");
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,431 @@
+#!/usr/bin/env python3
+# coding: utf-8
+
+"""
+    Compiles the PaintCode drawing methods in RelistenAlbumArts.m into the display list that AlbumArtDisplayList.cpp
+    replays, written out as a C++ byte array. The format is described in AlbumArtDisplayList.h.
+
+    Only the statements PaintCode writes for these designs are understood. Anything else stops the compiler, so a
+    re-exported design can't be compiled into something that draws differently.
+
+    :usage: ./compile_display_list.py [-i RelistenAlbumArts.m] [-o RelistenAlbumArtsDisplayList.cpp]
+"""
+
+import math
+import os
+import re
+import struct
+import sys
+from optparse import OptionParser
+
+# In the order of AlbumArt::Design
+DESIGNS = ['ShatterExplosion', 'RandomFlowers', 'Splash', 'CityGlitters']
+
+VERSION = 2
+CANVAS_SIZE = (768, 768)
+COORDINATE_FRACTION_BITS = 5
+LITERAL_COLOR = 0xFF
+
+OP_SAVE, OP_RESTORE, OP_TRANSLATE, OP_ROTATE, OP_CLIP_RECT, OP_FILL_PATH, OP_LINEAR_GRADIENT, OP_TEXT = range(1, 9)
+VERB_MOVE, VERB_LINE, VERB_CURVE, VERB_CLOSE, VERB_RECT, VERB_ROUNDED_RECT, VERB_OVAL = range(1, 8)
+GRADIENT_FLAGS = {
+    'kCGGradientDrawsBeforeStartLocation': 1 << 0,
+    'kCGGradientDrawsAfterEndLocation': 1 << 1,
+}
+LABEL_TEXTS = {'dateStr': 0, 'venueStr': 1, 'locationStr': 2}
+FONT_STYLES = {'systemFontOfSize': 0, 'boldSystemFontOfSize': 1, 'italicSystemFontOfSize': 2}
+
+NUMBER = r'(-?[\d.]+)'
+POINT = r'CGPointMake\(%s, %s\)' % (NUMBER, NUMBER)
+RECT = r'CGRectMake\(%s, %s, %s, %s\)' % (NUMBER, NUMBER, NUMBER, NUMBER)
+
+
+class CompileError(Exception):
+    pass
+
+
+def coordinate(value):
+    fixed = int(round(float(value) * (1 << COORDINATE_FRACTION_BITS)))
+    if not -32768 <= fixed <= 32767:
+        raise CompileError('coordinate %s is out of range' % value)
+    return fixed
+
+
+def unit(value):
+    return int(round(min(max(float(value), 0.0), 1.0) * 255))
+
+
+class Path(object):
+    def __init__(self):
+        self.body = bytearray()
+        self.points = []
+        # The outline of each subpath, with curves flattened, and the shapes added whole as (area, center x, center y)
+        self.subpaths = []
+        self.shapes = []
+
+    def add(self, verb, values, points):
+        self.body += struct.pack('<B%dh' % len(values), verb, *[coordinate(v) for v in values])
+        self.points += [(float(x), float(y)) for (x, y) in points]
+
+        if verb == VERB_MOVE:
+            self.subpaths.append([self.points[-1]])
+        elif verb == VERB_LINE:
+            self.subpaths[-1].append(self.points[-1])
+        elif verb == VERB_CURVE:
+            (x0, y0), (x1, y1), (x2, y2), (x3, y3) = [self.subpaths[-1][-1]] + self.points[-3:]
+            for step in range(1, 17):
+                t = step / 16.0
+                u = 1 - t
+                self.subpaths[-1].append((u * u * u * x0 + 3 * u * u * t * x1 + 3 * u * t * t * x2 + t * t * t * x3,
+                                          u * u * u * y0 + 3 * u * u * t * y1 + 3 * u * t * t * y2 + t * t * t * y3))
+
+    def add_rect(self, verb, x, y, width, height, *extra):
+        x, y, width, height = float(x), float(y), float(width), float(height)
+        self.add(verb, [x, y, width, height] + list(extra), [(x, y), (x + width, y + height)])
+
+        if verb == VERB_OVAL:
+            area = math.pi / 4 * width * height
+        elif verb == VERB_ROUNDED_RECT:
+            radius = min(float(extra[0]), width / 2, height / 2)
+            area = width * height - (4 - math.pi) * radius * radius
+        else:
+            area = width * height
+        self.shapes.append((abs(area), x + width / 2, y + height / 2))
+
+    def summary(self):
+        """
+        The share of its bounds the path fills, then the x and y of its centroid as shares of its bounds, all from 0 to
+        255. Overlapping subpaths are counted twice.
+        """
+        # The outlines' signed area and its moments, then the shapes'
+        signed_area = moment_x = moment_y = 0.0
+        for outline in self.subpaths:
+            for ((x0, y0), (x1, y1)) in zip(outline, outline[1:] + outline[:1]):
+                cross = x0 * y1 - x1 * y0
+                signed_area += cross / 2
+                moment_x += (x0 + x1) * cross / 6
+                moment_y += (y0 + y1) * cross / 6
+        if signed_area < 0:
+            signed_area, moment_x, moment_y = -signed_area, -moment_x, -moment_y
+        area = signed_area + sum(a for (a, _, _) in self.shapes)
+        moment_x += sum(a * x for (a, x, _) in self.shapes)
+        moment_y += sum(a * y for (a, _, y) in self.shapes)
+
+        minX, minY, maxX, maxY = self.bounds()
+        if area > 0:
+            centroid = (moment_x / area, moment_y / area)
+        else:
+            centroid = ((minX + maxX) / 2, (minY + maxY) / 2)
+
+        def share(value):
+            return int(round(min(max(value, 0.0), 1.0) * 255))
+        return [share(area / ((maxX - minX) * (maxY - minY))),
+                share((centroid[0] - minX) / (maxX - minX)), share((centroid[1] - minY) / (maxY - minY))]
+
+    def bounds(self):
+        xs = [x for (x, _) in self.points]
+        ys = [y for (_, y) in self.points]
+        # Round outwards, so the bounds still hold the path once it's quantized
+        scale = float(1 << COORDINATE_FRACTION_BITS)
+        return [(min(xs) * scale // 1 - 1) / scale, (min(ys) * scale // 1 - 1) / scale,
+                (-(-max(xs) * scale // 1) + 1) / scale, (-(-max(ys) * scale // 1) + 1) / scale]
+
+
+class DesignCompiler(object):
+    def __init__(self, name):
+        self.name = name
+        self.colors = []
+        self.color_indexes = {}
+        self.gradients = []
+        self.gradient_indexes = {}
+        self.gradient_locations = {}
+        self.paths = {}
+        self.rects = {}
+        self.art = bytearray()
+        self.label = bytearray()
+        self.ops = self.art
+        self.blocks = []
+        self.fill_color = None
+        self.text = None
+        self.text_attributes = {}
+        self.counts = {}
+
+    def fail(self, statement, reason='unexpected statement'):
+        raise CompileError('%s: %s: %s' % (self.name, reason, statement))
+
+    def emit(self, op, format='', *values):
+        self.ops += struct.pack('<B' + format, op, *values)
+        self.counts[op] = self.counts.get(op, 0) + 1
+
+    def declare_color(self, name, entry):
+        if entry not in self.colors:
+            self.colors.append(entry)
+        self.color_indexes[name] = self.colors.index(entry)
+
+    def color(self, statement, name):
+        if name not in self.color_indexes:
+            self.fail(statement, 'undeclared color %s' % name)
+        return self.color_indexes[name]
+
+    def path(self, statement, name):
+        if name not in self.paths:
+            self.fail(statement, 'undeclared path %s' % name)
+        return self.paths[name]
+
+    def compile(self, statements):
+        for statement in statements:
+            self.compile_statement(statement)
+        if self.blocks:
+            self.fail('}', 'unbalanced braces')
+
+    def compile_statement(self, s):
+        matches = []
+
+        def match(pattern):
+            statement_match = re.match(pattern + r'$', s)
+            if statement_match:
+                matches.append(statement_match)
+            return statement_match
+
+        # Blocks
+        if s == '{':
+            self.blocks.append('group')
+        elif s == 'if (drawLabel) {':
+            if self.ops is self.label:
+                self.fail(s, 'nested label')
+            self.blocks.append('label')
+            self.ops = self.label
+        elif s == '}':
+            if not self.blocks:
+                self.fail(s, 'unbalanced braces')
+            if self.blocks.pop() == 'label':
+                self.ops = self.art
+            self.text = None
+
+        # Declarations that don't draw anything
+        elif (match(r'CGColorSpaceRef colorSpace = CGColorSpaceCreateDeviceRGB\(\);') or
+              match(r'CGContextRef context = UIGraphicsGetCurrentContext\(\);') or
+              match(r'NSArray<UIColor \*> \*colors = PHODColorPalleteForBaseColor\(color\);') or
+              match(r'CGGradientRelease\(\w+\);') or
+              match(r'CGColorSpaceRelease\(colorSpace\);') or
+              match(r'\w+\.miterLimit = %s;' % NUMBER)):
+            pass
+
+        # Colors and gradients
+        elif match(r'UIColor\* (\w+) *= \[colors\[(\d)\] colorWithAlphaComponent: %s\];' % NUMBER):
+            name, index, alpha = matches[0].groups()
+            if not 0 <= int(index) < 5:
+                self.fail(s, 'palette index out of range')
+            self.declare_color(name, (int(index), unit(alpha)))
+        elif match(r'UIColor\* (\w+) *= \[UIColor colorWithRed: %s green: %s blue: %s alpha: %s\];' % (NUMBER, NUMBER, NUMBER, NUMBER)):
+            name, red, green, blue, alpha = matches[0].groups()
+            self.declare_color(name, (LITERAL_COLOR, unit(red), unit(green), unit(blue), unit(alpha)))
+        elif match(r'CGFloat (\w+)Locations\[\] = \{([-\d., ]+)\};'):
+            name, locations = matches[0].groups()
+            self.gradient_locations[name] = [float(location) for location in locations.split(',')]
+        elif match(r'CGGradientRef (\w+) = CGGradientCreateWithColors\(colorSpace, \(__bridge CFArrayRef\)@\[(.*)\], (\w+)Locations\);'):
+            name, colors, locations = matches[0].groups()
+            colors = [self.color(s, color) for color in re.findall(r'\(id\)(\w+)\.CGColor', colors)]
+            locations = self.gradient_locations.get(locations)
+            if locations is None or len(locations) != len(colors):
+                self.fail(s, 'gradient locations don\'t match its colors')
+            self.gradient_indexes[name] = len(self.gradients)
+            self.gradients.append(list(zip(colors, locations)))
+
+        # Graphics state
+        elif match(r'CGContextSaveGState\(context\);'):
+            self.emit(OP_SAVE)
+        elif match(r'CGContextRestoreGState\(context\);'):
+            self.emit(OP_RESTORE)
+        elif match(r'CGContextTranslateCTM\(context, %s, %s\);' % (NUMBER, NUMBER)):
+            self.emit(OP_TRANSLATE, '2h', *[coordinate(v) for v in matches[0].groups()])
+        elif match(r'CGContextRotateCTM\(context, %s \* M_PI / 180\);' % NUMBER):
+            self.emit(OP_ROTATE, 'h', int(round(float(matches[0].group(1)) * 100)))
+
+        # Paths
+        elif match(r'UIBezierPath\* (\w+) = \[UIBezierPath bezierPath\];'):
+            self.paths[matches[0].group(1)] = Path()
+        elif match(r'UIBezierPath\* (\w+) = \[UIBezierPath bezierPathWithRect: %s\];' % RECT):
+            name, x, y, width, height = matches[0].groups()
+            self.paths[name] = Path()
+            self.paths[name].add_rect(VERB_RECT, x, y, width, height)
+        elif match(r'UIBezierPath\* (\w+) = \[UIBezierPath bezierPathWithRoundedRect: %s cornerRadius: %s\];' % (RECT, NUMBER)):
+            name, x, y, width, height, radius = matches[0].groups()
+            self.paths[name] = Path()
+            self.paths[name].add_rect(VERB_ROUNDED_RECT, x, y, width, height, float(radius))
+        elif match(r'UIBezierPath\* (\w+) = \[UIBezierPath bezierPathWithOvalInRect: %s\];' % RECT):
+            name, x, y, width, height = matches[0].groups()
+            self.paths[name] = Path()
+            self.paths[name].add_rect(VERB_OVAL, x, y, width, height)
+        elif match(r'\[(\w+) moveToPoint: %s\];' % POINT):
+            name, x, y = matches[0].groups()
+            self.path(s, name).add(VERB_MOVE, [x, y], [(x, y)])
+        elif match(r'\[(\w+) addLineToPoint: %s\];' % POINT):
+            name, x, y = matches[0].groups()
+            self.path(s, name).add(VERB_LINE, [x, y], [(x, y)])
+        elif match(r'\[(\w+) addCurveToPoint: %s controlPoint1: %s controlPoint2: %s\];' % (POINT, POINT, POINT)):
+            name, x, y, x1, y1, x2, y2 = matches[0].groups()
+            self.path(s, name).add(VERB_CURVE, [x1, y1, x2, y2, x, y], [(x1, y1), (x2, y2), (x, y)])
+        elif match(r'\[(\w+) closePath\];'):
+            self.path(s, matches[0].group(1)).add(VERB_CLOSE, [], [])
+
+        # Drawing
+        elif match(r'\[(\w+) setFill\];'):
+            self.fill_color = self.color(s, matches[0].group(1))
+        elif match(r'\[(\w+) fill\];'):
+            path = self.path(s, matches[0].group(1))
+            if self.fill_color is None:
+                self.fail(s, 'fill without a color')
+            if not path.points:
+                self.fail(s, 'empty path')
+            self.emit(OP_FILL_PATH, 'B3B4hH', self.fill_color, *(path.summary() + [coordinate(v) for v in path.bounds()] + [len(path.body)]))
+            self.ops += path.body
+        elif match(r'\[(\w+) addClip\];'):
+            # Only rects can be clipped to
+            path = self.path(s, matches[0].group(1))
+            if path.body[0] != VERB_RECT or len(path.body) != 9:
+                self.fail(s, 'only rects can be clipped to')
+            self.emit(OP_CLIP_RECT, '4h', *struct.unpack('<4h', bytes(path.body[1:])))
+        elif match(r'CGContextDrawLinearGradient\(context, (\w+), %s, %s, ([\w| ]+)\);' % (POINT, POINT)):
+            name, x0, y0, x1, y1, flags = matches[0].groups()
+            if name not in self.gradient_indexes:
+                self.fail(s, 'undeclared gradient %s' % name)
+            flags = sum(GRADIENT_FLAGS[flag.strip()] for flag in flags.split('|'))
+            self.emit(OP_LINEAR_GRADIENT, 'B4hB', self.gradient_indexes[name], coordinate(x0), coordinate(y0), coordinate(x1), coordinate(y1), flags)
+
+        # Labels
+        elif match(r'CGRect (\w+)Rect = %s;' % RECT):
+            name, x, y, width, height = matches[0].groups()
+            self.rects[name] = [x, y, width, height]
+        elif match(r'NSString\* textContent = (\w+);'):
+            if matches[0].group(1) not in LABEL_TEXTS:
+                self.fail(s, 'unknown label text')
+            self.text = LABEL_TEXTS[matches[0].group(1)]
+        elif (match(r'NSMutableParagraphStyle\* \w+Style = NSMutableParagraphStyle\.defaultParagraphStyle\.mutableCopy;') or
+              match(r'\w+Style\.alignment = NSTextAlignmentLeft;') or
+              match(r'CGFloat \w+TextHeight = \[textContent boundingRectWithSize: CGSizeMake\(\w+Rect\.size\.width, INFINITY\)  options: NSStringDrawingUsesLineFragmentOrigin attributes: \w+FontAttributes context: nil\]\.size\.height;') or
+              match(r'CGContextClipToRect\(context, \w+Rect\);')):
+            # Drawing the label left aligned, centered vertically and clipped to its rect is up to the caller
+            if self.text is None:
+                self.fail(s, 'label statement outside a label')
+        elif match(r'NSDictionary\* (\w+)FontAttributes = @\{NSFontAttributeName: \[UIFont (\w+): %s\], NSForegroundColorAttributeName: (\w+), NSParagraphStyleAttributeName: \w+Style\};' % NUMBER):
+            name, font, size, color = matches[0].groups()
+            if font not in FONT_STYLES:
+                self.fail(s, 'unknown font')
+            self.text_attributes[name] = (FONT_STYLES[font], int(round(float(size))), self.color(s, color))
+        elif match(r'\[textContent drawInRect: CGRectMake\(CGRectGetMinX\((\w+)Rect\), CGRectGetMinY\(\1Rect\) \+ \(CGRectGetHeight\(\1Rect\) - \1TextHeight\) / 2, CGRectGetWidth\(\1Rect\), \1TextHeight\) withAttributes: \1FontAttributes\];'):
+            name = matches[0].group(1)
+            if self.text is None or name not in self.rects or name not in self.text_attributes:
+                self.fail(s, 'incomplete label')
+            font, size, color = self.text_attributes[name]
+            self.emit(OP_TEXT, 'BBBB4h', self.text, font, size, color, *[coordinate(v) for v in self.rects[name]])
+
+        else:
+            self.fail(s)
+
+    def data(self):
+        data = bytearray(struct.pack('<B', len(self.colors)))
+        for color in self.colors:
+            data += struct.pack('<%dB' % len(color), *color)
+        data += struct.pack('<B', len(self.gradients))
+        for stops in self.gradients:
+            data += struct.pack('<B', len(stops))
+            for (color, location) in stops:
+                data += struct.pack('<BH', color, int(round(location * 65535)))
+        label_offset = len(data) + 4 + len(self.art)
+        return data + struct.pack('<I', label_offset) + self.art + self.label
+
+
+def statements(body):
+    """Splits a method body into statements, one per line except where PaintCode wraps a call."""
+    statement = ''
+    for line in body.split('\n'):
+        line = line.strip()
+        if not line or line.startswith('//'):
+            continue
+        statement = (statement + ' ' + line).strip() if statement else line
+        if statement.endswith((';', '{', '}')):
+            yield statement
+            statement = ''
+    if statement:
+        raise CompileError('unterminated statement: %s' % statement)
+
+
+def compile_designs(source):
+    methods = list(re.finditer(r'^\+ \(void\)draw(\w+)WithBaseColor:[^{]*\{\n(.*?)^\}', source, re.M | re.S))
+    names = [method.group(1) for method in methods]
+    if names != DESIGNS:
+        raise CompileError('expected the designs %s, found %s' % (', '.join(DESIGNS), ', '.join(names)))
+
+    designs = []
+    for method in methods:
+        design = DesignCompiler(method.group(1))
+        design.compile(statements(method.group(2)))
+        designs.append(design)
+    return designs
+
+
+def display_list(designs):
+    header_length = 12 + 8 * len(designs)
+    header = bytearray(b'RADL' + struct.pack('<HHHH', VERSION, len(designs), CANVAS_SIZE[0], CANVAS_SIZE[1]))
+    data = bytearray()
+    for design in designs:
+        design_data = design.data()
+        header += struct.pack('<II', header_length + len(data), len(design_data))
+        data += design_data
+    return header + data
+
+
+def write_source(data, path):
+    lines = []
+    for offset in range(0, len(data), 24):
+        lines.append('    ' + ' '.join('0x%02x,' % byte for byte in data[offset:offset + 24]))
+
+    with open(path, 'w') as output:
+        output.write('''//
+//  %s
+//  RelistenShared
+//
+//  Generated by compile_display_list.py from RelistenAlbumArts.m. Don't edit it: change the designs and compile them
+//  again instead.
+//
+
+#include "AlbumArtDisplayList.h"
+
+namespace AlbumArt {
+
+const uint8_t RelistenAlbumArtsDisplayList[] = {
+%s
+};
+
+const size_t RelistenAlbumArtsDisplayListLength = sizeof(RelistenAlbumArtsDisplayList);
+
+} // namespace AlbumArt
+''' % (os.path.basename(path), '\n'.join(lines)))
+
+
+def main():
+    directory = os.path.dirname(os.path.abspath(__file__))
+    parser = OptionParser(usage='%prog [-i RelistenAlbumArts.m] [-o RelistenAlbumArtsDisplayList.cpp]')
+    parser.add_option('-i', '--input', dest='input', default=os.path.join(directory, 'RelistenAlbumArts.m'))
+    parser.add_option('-o', '--output', dest='output', default=os.path.join(directory, 'RelistenAlbumArtsDisplayList.cpp'))
+    (options, _) = parser.parse_args()
+
+    try:
+        with open(options.input) as source:
+            designs = compile_designs(source.read())
+    except CompileError as error:
+        sys.stderr.write('error: %s\n' % error)
+        sys.exit(1)
+
+    data = display_list(designs)
+    write_source(data, options.output)
+
+    for design in designs:
+        print('%-16s %6d bytes, %4d paths, %2d gradients, %d labels' % (design.name, len(design.data()),
+              design.counts.get(OP_FILL_PATH, 0), design.counts.get(OP_LINEAR_GRADIENT, 0), design.counts.get(OP_TEXT, 0)))
+    print('%-16s %6d bytes, from %d bytes of drawing code' % ('total', len(data), os.path.getsize(options.input)))
+
+
+if __name__ == '__main__':
+    main()
@@ -162,6 +162,13 @@ public class ShowCellNode : ASCellNode {
         }
     }
     
+    public override func didEnterPreloadState() {
+        super.didEnterPreloadState()
+        
+        // Start reading the artwork in from the image table before the cell is shown
+        AlbumArtImageCache.shared.cache.prefetchImages(for: [show.fastImageCacheWrapper()], withFormatName: AlbumArtImageCache.imageFormatSmall)
+    }
+    
     private func cellLayoutSpecThatFits(_ constrainedSize: ASSizeRange) -> ASLayoutSpec {
         let showAndOffline = ASStackLayoutSpec(
             direction: .horizontal,
@@ -10,22 +10,31 @@ import Foundation
 import FastImageCache
 
 public class ShowFICWrapper : NSObject, FICEntity {
-    private let show : ShowCellDataSource
+    // Copied out of the show, so the wrapper can be used off the thread the show belongs to, e.g. to prerender album art
+    private let uuid : String
+    private let displayDate : String
+    private let venueName : String
+    private let venueLocation : String
+    private let artistID : Int
     
     public init(_ show: ShowCellDataSource) {
-        self.show = show
+        uuid = show.uuid.uuidString
+        displayDate = show.display_date
+        venueName = show.venueDataSource?.name ?? ""
+        venueLocation = show.venueDataSource?.location ?? ""
+        artistID = show.artist_id
     }
     
-    public var fic_UUID: String { return show.uuid.uuidString }
-    public var fic_sourceImageUUID: String { return show.uuid.uuidString }
+    public var fic_UUID: String { return uuid }
+    public var fic_sourceImageUUID: String { return uuid }
     public func fic_sourceImageURL(withFormatName formatName: String) -> URL? {
         guard var components : URLComponents = URLComponents(string: "relisten://shatter") else {
             return nil
         }
-        let queryDictionary : [String : String] = ["date" : show.display_date,
-                                                   "venue" : show.venueDataSource?.name ?? "",
-                                                   "location" : show.venueDataSource?.location ?? "",
-                                                   "artistID" : String(show.artist_id)]
+        let queryDictionary : [String : String] = ["date" : displayDate,
+                                                   "venue" : venueName,
+                                                   "location" : venueLocation,
+                                                   "artistID" : String(artistID)]
         var queryItems : [URLQueryItem] = []
         for (key, value) in queryDictionary {
             queryItems.append(URLQueryItem(name: key, value: value))
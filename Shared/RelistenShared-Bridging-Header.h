@@ -8,3 +8,4 @@
 
 #import <CommonCrypto/CommonCrypto.h>
 #import "RelistenAlbumArts.h"
+#import "RelistenAlbumArtRenderer.h"
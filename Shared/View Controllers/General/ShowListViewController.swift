@@ -206,7 +206,82 @@ public class NewShowListViewController<T, DataSource: ShowListDataSource> : Reli
             ds.showListDataChanged(data)
         }
         
+        // The rows queued for the old data may not be there anymore
+        AlbumArtImageCache.shared.prerenderer.cancel(for: self)
+        
         super.dataChanged(data)
+        
+        tableNode.onDidFinishProcessingUpdates { [weak self] in
+            self?.prerenderAlbumArt()
+        }
+    }
+    
+    public override func viewDidDisappear(_ animated: Bool) {
+        super.viewDidDisappear(animated)
+        
+        AlbumArtImageCache.shared.prerenderer.cancel(for: self)
+    }
+    
+    // MARK: Album Art
+    
+    // Queues the album art of the visible rows, then of the rows as far ahead as twice the table's preload range and as
+    // far back as its trailing preload buffer, replacing the rows queued before. Cells ask for their own images once
+    // they're in the preload range; this gets the next ones drawn before that, without queueing the whole list.
+    private func prerenderAlbumArt() {
+        guard let ds = dataSource, isViewLoaded, view.window != nil else { return }
+        
+        let visibleRows = tableNode.indexPathsForVisibleRows().sorted()
+        // Before the first layout, assume a screenful of 60pt rows from the top
+        let rowsPerScreenful = visibleRows.count > 0 ? visibleRows.count : max(1, Int(tableNode.bounds.height / 60))
+        let preload = tableNode.tuningParameters(for: .preload)
+        let rowsAhead = Int((CGFloat(rowsPerScreenful) * 2 * preload.leadingBufferScreenfuls).rounded(.up))
+        let rowsBehind = Int((CGFloat(rowsPerScreenful) * preload.trailingBufferScreenfuls).rounded(.up))
+        
+        var shows : [ShowCellDataSource] = []
+        let filtering = isFiltering()
+        tableUpdateQueue.sync {
+            // Rows are numbered through all sections, in list order
+            let rowCounts = (0..<ds.numberOfSections(whileFiltering: filtering)).map({ ds.numberOfShows(in: $0, whileFiltering: filtering) })
+            let rowCount = rowCounts.reduce(0, +)
+            guard rowCount > 0 else { return }
+            
+            func listIndex(of indexPath: IndexPath) -> Int {
+                return rowCounts.prefix(indexPath.section).reduce(0, +) + indexPath.row
+            }
+            func indexPath(atListIndex index: Int) -> IndexPath {
+                var row = index
+                for (section, count) in rowCounts.enumerated() {
+                    if row < count {
+                        return IndexPath(row: row, section: section)
+                    }
+                    row -= count
+                }
+                return IndexPath(row: 0, section: 0)
+            }
+            
+            let first = visibleRows.first.map(listIndex(of:)) ?? 0
+            let last = first + rowsPerScreenful
+            let ahead = min(first, rowCount)..<min(last + rowsAhead, rowCount)
+            let behind = max(first - rowsBehind, 0)..<min(first, rowCount)
+            // Visible and ahead first, in list order, then behind, nearest first
+            for index in Array(ahead) + behind.reversed() {
+                if let show = ds.cellShow(at: indexPath(atListIndex: index), whileFiltering: filtering) {
+                    shows.append(show)
+                }
+            }
+        }
+        
+        AlbumArtImageCache.shared.prerenderer.prerender(shows, for: self)
+    }
+    
+    public func scrollViewDidEndDragging(_ scrollView: UIScrollView, willDecelerate decelerate: Bool) {
+        if !decelerate {
+            prerenderAlbumArt()
+        }
+    }
+    
+    public func scrollViewDidEndDecelerating(_ scrollView: UIScrollView) {
+        prerenderAlbumArt()
     }
     
     // MARK: Table Data Source
@@ -291,6 +366,10 @@ public class NewShowListViewController<T, DataSource: ShowListDataSource> : Reli
         guard let ds = dataSource else { return }
 
         ds.showListFilterTextChanged(searchText, inScope: scope)
+        
+        tableNode.onDidFinishProcessingUpdates { [weak self] in
+            self?.prerenderAlbumArt()
+        }
     }
     
     // MARK: DZNEmptyDataSetSource